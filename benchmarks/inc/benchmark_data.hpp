@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Every benchmark draws its inputs from a fixed seed so that two runs (or two STL builds) see identical data.
+inline constexpr std::uint32_t benchmark_seed = 1729;
+
+template <class T>
+std::vector<T> random_vector(const std::size_t size, const T low, const T high) {
+    std::mt19937_64 engine{benchmark_seed};
+    std::vector<T> result(size);
+
+    if constexpr (std::is_floating_point_v<T>) {
+        std::uniform_real_distribution<T> dist{low, high};
+        std::generate(result.begin(), result.end(), [&] { return dist(engine); });
+    } else if constexpr (sizeof(T) == 1) {
+        std::uniform_int_distribution<int> dist{low, high};
+        std::generate(result.begin(), result.end(), [&] { return static_cast<T>(dist(engine)); });
+    } else {
+        std::uniform_int_distribution<T> dist{low, high};
+        std::generate(result.begin(), result.end(), [&] { return dist(engine); });
+    }
+
+    return result;
+}
+
+template <class T>
+std::vector<T> random_vector(const std::size_t size) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return random_vector<T>(size, T{-1}, T{1});
+    } else {
+        return random_vector<T>(size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    }
+}
+
+inline std::vector<std::string> random_strings(const std::size_t count, const std::size_t min_length,
+    const std::size_t max_length) {
+    std::mt19937_64 engine{benchmark_seed};
+    std::uniform_int_distribution<std::size_t> length_dist{min_length, max_length};
+    std::uniform_int_distribution<int> char_dist{'a', 'z'};
+    std::vector<std::string> result(count);
+
+    for (auto& str : result) {
+        str.resize(length_dist(engine));
+        std::generate(str.begin(), str.end(), [&] { return static_cast<char>(char_dist(engine)); });
+    }
+
+    return result;
+}
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Sorting, partitioning, and searching in <algorithm>.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    enum class input_order { random, sorted, reversed, few_unique };
+
+    template <class T>
+    vector<T> make_input(const size_t size, const input_order order) {
+        vector<T> v;
+        if constexpr (is_same_v<T, string>) {
+            v = order == input_order::few_unique ? random_strings(size, 1, 1) : random_strings(size, 4, 24);
+        } else {
+            v = order == input_order::few_unique ? random_vector<T>(size, T{0}, T{15}) : random_vector<T>(size);
+        }
+
+        if (order == input_order::sorted) {
+            sort(v.begin(), v.end());
+        } else if (order == input_order::reversed) {
+            sort(v.begin(), v.end(), greater<>{});
+        }
+
+        return v;
+    }
+
+    template <class T, input_order Order>
+    void bm_sort(benchmark::State& state) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = make_input<T>(size, Order);
+        vector<T> v;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            v = input;
+            state.ResumeTiming();
+            sort(v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class T, input_order Order>
+    void bm_stable_sort(benchmark::State& state) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = make_input<T>(size, Order);
+        vector<T> v;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            v = input;
+            state.ResumeTiming();
+            stable_sort(v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class T>
+    void bm_nth_element(benchmark::State& state) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = make_input<T>(size, input_order::random);
+        vector<T> v;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            v = input;
+            state.ResumeTiming();
+            nth_element(v.begin(), v.begin() + static_cast<ptrdiff_t>(size / 2), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class T>
+    void bm_partial_sort(benchmark::State& state) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = make_input<T>(size, input_order::random);
+        vector<T> v;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            v = input;
+            state.ResumeTiming();
+            partial_sort(v.begin(), v.begin() + static_cast<ptrdiff_t>(size / 10), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class T>
+    void bm_lower_bound(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto v    = make_input<T>(size, input_order::sorted);
+        const auto keys = make_input<T>(1024, input_order::random);
+        size_t found    = 0;
+
+        for (auto _ : state) {
+            for (const auto& key : keys) {
+                found += static_cast<size_t>(lower_bound(v.begin(), v.end(), key) - v.begin());
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+    }
+
+    template <class T>
+    void bm_equal_range(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto v    = make_input<T>(size, input_order::sorted);
+        const auto keys = make_input<T>(1024, input_order::random);
+        size_t found    = 0;
+
+        for (auto _ : state) {
+            for (const auto& key : keys) {
+                const auto [first, last] = equal_range(v.begin(), v.end(), key);
+                found += static_cast<size_t>(last - first);
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * keys.size()));
+    }
+
+    template <class T>
+    void bm_merge(benchmark::State& state) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto left  = make_input<T>(size, input_order::sorted);
+        auto right       = make_input<T>(size, input_order::random);
+        sort(right.begin(), right.end());
+        vector<T> dest(size * 2);
+
+        for (auto _ : state) {
+            merge(left.begin(), left.end(), right.begin(), right.end(), dest.begin());
+            benchmark::DoNotOptimize(dest.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size * 2));
+    }
+
+    void bm_string_search(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        auto haystack   = random_strings(1, size, size)[0];
+        const string needle{"benchmarkneedle"};
+        haystack.replace(size - needle.size(), needle.size(), needle);
+        const boyer_moore_horspool_searcher searcher{needle.begin(), needle.end()};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(haystack.data());
+            benchmark::DoNotOptimize(search(haystack.begin(), haystack.end(), searcher));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+} // unnamed namespace
+
+BENCHMARK(bm_sort<uint32_t, input_order::random>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_sort<uint32_t, input_order::sorted>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_sort<uint32_t, input_order::reversed>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_sort<uint32_t, input_order::few_unique>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_sort<double, input_order::random>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_sort<string, input_order::random>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bm_stable_sort<uint32_t, input_order::random>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_stable_sort<uint32_t, input_order::sorted>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_stable_sort<string, input_order::random>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bm_nth_element<uint32_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_partial_sort<uint32_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_lower_bound<uint32_t>)->Range(1 << 8, 1 << 22);
+BENCHMARK(bm_lower_bound<string>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bm_equal_range<uint32_t>)->Range(1 << 8, 1 << 22);
+BENCHMARK(bm_merge<uint32_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_string_search)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// to_chars and from_chars for integers and floating-point values.
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    constexpr size_t value_count = 1024;
+
+    template <class T, class... Args>
+    void bm_to_chars(benchmark::State& state, type_identity<T>, const Args... args) {
+        const auto values = random_vector<T>(value_count);
+        char buffer[64];
+
+        for (auto _ : state) {
+            for (const auto& value : values) {
+                const auto result = to_chars(buffer, buffer + sizeof(buffer), value, args...);
+                benchmark::DoNotOptimize(result.ptr);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+    }
+
+    template <class T, class... Args>
+    void bm_from_chars(benchmark::State& state, type_identity<T>, const Args... args) {
+        const auto values = random_vector<T>(value_count);
+        vector<string> strings;
+        strings.reserve(value_count);
+        char buffer[64];
+        for (const auto& value : values) {
+            const auto result = to_chars(buffer, buffer + sizeof(buffer), value, args...);
+            strings.emplace_back(buffer, result.ptr);
+        }
+
+        for (auto _ : state) {
+            for (const auto& str : strings) {
+                T value{};
+                const auto result = from_chars(str.data(), str.data() + str.size(), value, args...);
+                benchmark::DoNotOptimize(value);
+                benchmark::DoNotOptimize(result.ec);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+    }
+} // unnamed namespace
+
+BENCHMARK_CAPTURE(bm_to_chars, uint32_t, type_identity<uint32_t>{});
+BENCHMARK_CAPTURE(bm_to_chars, uint64_t, type_identity<uint64_t>{});
+BENCHMARK_CAPTURE(bm_to_chars, int64_t_hex, type_identity<int64_t>{}, 16);
+BENCHMARK_CAPTURE(bm_to_chars, float, type_identity<float>{});
+BENCHMARK_CAPTURE(bm_to_chars, double, type_identity<double>{});
+BENCHMARK_CAPTURE(bm_to_chars, double_scientific, type_identity<double>{}, chars_format::scientific, 17);
+BENCHMARK_CAPTURE(bm_to_chars, double_fixed, type_identity<double>{}, chars_format::fixed, 6);
+BENCHMARK_CAPTURE(bm_to_chars, double_hex, type_identity<double>{}, chars_format::hex);
+BENCHMARK_CAPTURE(bm_from_chars, uint32_t, type_identity<uint32_t>{});
+BENCHMARK_CAPTURE(bm_from_chars, uint64_t, type_identity<uint64_t>{});
+BENCHMARK_CAPTURE(bm_from_chars, int64_t_hex, type_identity<int64_t>{}, 16);
+BENCHMARK_CAPTURE(bm_from_chars, float, type_identity<float>{});
+BENCHMARK_CAPTURE(bm_from_chars, double, type_identity<double>{});
+BENCHMARK_CAPTURE(bm_from_chars, double_hex, type_identity<double>{}, chars_format::hex);
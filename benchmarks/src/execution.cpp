@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Scaling of the parallel algorithms in <execution>: each algorithm runs with the seq and par policies over
+// increasing sizes, so the reports show where par starts to pay off and how close it gets to linear speedup.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    template <class Policy>
+    void bm_sort(benchmark::State& state, const Policy& policy) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = random_vector<uint32_t>(size);
+        vector<uint32_t> v;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            v = input;
+            state.ResumeTiming();
+            sort(policy, v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Policy>
+    void bm_transform_reduce(benchmark::State& state, const Policy& policy) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto left  = random_vector<double>(size);
+        const auto right = random_vector<double>(size);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(transform_reduce(policy, left.begin(), left.end(), right.begin(), 0.0));
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Policy>
+    void bm_inclusive_scan(benchmark::State& state, const Policy& policy) {
+        const auto size  = static_cast<size_t>(state.range(0));
+        const auto input = random_vector<uint64_t>(size);
+        vector<uint64_t> dest(size);
+
+        for (auto _ : state) {
+            inclusive_scan(policy, input.begin(), input.end(), dest.begin());
+            benchmark::DoNotOptimize(dest.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Policy>
+    void bm_for_each(benchmark::State& state, const Policy& policy) {
+        const auto size = static_cast<size_t>(state.range(0));
+        auto v          = random_vector<double>(size);
+
+        for (auto _ : state) {
+            for_each(policy, v.begin(), v.end(), [](double& x) { x = x * 0.5 + 0.25; });
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Policy>
+    void bm_find(benchmark::State& state, const Policy& policy) {
+        const auto size = static_cast<size_t>(state.range(0));
+        vector<uint32_t> v(size, 1u);
+        v.back() = 2u;
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(find(policy, v.begin(), v.end(), 2u));
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+} // unnamed namespace
+
+#define EXECUTION_BENCHMARK(FN)                                                                             \
+    BENCHMARK_CAPTURE(FN, seq, execution::seq)->RangeMultiplier(8)->Range(1 << 10, 1 << 24)->UseRealTime(); \
+    BENCHMARK_CAPTURE(FN, par, execution::par)->RangeMultiplier(8)->Range(1 << 10, 1 << 24)->UseRealTime()
+
+EXECUTION_BENCHMARK(bm_sort);
+EXECUTION_BENCHMARK(bm_transform_reduce);
+EXECUTION_BENCHMARK(bm_inclusive_scan);
+EXECUTION_BENCHMARK(bm_for_each);
+EXECUTION_BENCHMARK(bm_find);
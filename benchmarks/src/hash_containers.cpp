@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// unordered_map and unordered_set, built on <xhash>.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    template <class Key>
+    vector<Key> make_keys(const size_t size) {
+        if constexpr (is_same_v<Key, string>) {
+            return random_strings(size, 8, 32);
+        } else {
+            return random_vector<Key>(size);
+        }
+    }
+
+    template <class Key>
+    void bm_insert(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto keys = make_keys<Key>(size);
+
+        for (auto _ : state) {
+            unordered_map<Key, uint32_t> m;
+            for (const auto& key : keys) {
+                m.emplace(key, 0u);
+            }
+
+            benchmark::DoNotOptimize(m.size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Key>
+    void bm_insert_reserved(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto keys = make_keys<Key>(size);
+
+        for (auto _ : state) {
+            unordered_map<Key, uint32_t> m;
+            m.reserve(size);
+            for (const auto& key : keys) {
+                m.emplace(key, 0u);
+            }
+
+            benchmark::DoNotOptimize(m.size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Key>
+    void bm_find_hit(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto keys = make_keys<Key>(size);
+        const unordered_set<Key> s(keys.begin(), keys.end());
+        size_t found = 0;
+
+        for (auto _ : state) {
+            for (const auto& key : keys) {
+                found += s.count(key);
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Key>
+    void bm_find_miss(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        auto keys       = make_keys<Key>(size * 2);
+        const unordered_set<Key> s(keys.begin(), keys.begin() + static_cast<ptrdiff_t>(size));
+        keys.erase(keys.begin(), keys.begin() + static_cast<ptrdiff_t>(size));
+        size_t found = 0;
+
+        for (auto _ : state) {
+            for (const auto& key : keys) {
+                found += s.count(key);
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Key>
+    void bm_erase(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto keys = make_keys<Key>(size);
+        const unordered_set<Key> original(keys.begin(), keys.end());
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto s = original;
+            state.ResumeTiming();
+            for (const auto& key : keys) {
+                s.erase(key);
+            }
+
+            benchmark::DoNotOptimize(s.size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    template <class Key>
+    void bm_iterate(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto keys = make_keys<Key>(size);
+        const unordered_set<Key> s(keys.begin(), keys.end());
+
+        for (auto _ : state) {
+            for (const auto& key : s) {
+                benchmark::DoNotOptimize(&key);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * s.size()));
+    }
+} // unnamed namespace
+
+BENCHMARK(bm_insert<uint64_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_insert<string>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bm_insert_reserved<uint64_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_find_hit<uint64_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_find_hit<string>)->Range(1 << 8, 1 << 18);
+BENCHMARK(bm_find_miss<uint64_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_erase<uint64_t>)->Range(1 << 8, 1 << 20);
+BENCHMARK(bm_iterate<uint64_t>)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Formatted and unformatted I/O through stringstreams and filebufs.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    constexpr size_t value_count = 4096;
+
+    template <class T>
+    void bm_ostringstream_insert(benchmark::State& state) {
+        const auto values = random_vector<T>(value_count);
+
+        for (auto _ : state) {
+            ostringstream os;
+            for (const auto& value : values) {
+                os << value << ' ';
+            }
+
+            benchmark::DoNotOptimize(os.str().size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+    }
+
+    template <class T>
+    void bm_istringstream_extract(benchmark::State& state) {
+        const auto values = random_vector<T>(value_count);
+        ostringstream os;
+        os.precision(17);
+        for (const auto& value : values) {
+            os << value << ' ';
+        }
+
+        const string text = os.str();
+
+        for (auto _ : state) {
+            istringstream is{text};
+            T value{};
+            while (is >> value) {
+                benchmark::DoNotOptimize(value);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * value_count));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+
+    void bm_getline(benchmark::State& state) {
+        string text;
+        for (const auto& line : random_strings(value_count, 0, 120)) {
+            text += line;
+            text += '\n';
+        }
+
+        for (auto _ : state) {
+            istringstream is{text};
+            string line;
+            size_t total = 0;
+            while (getline(is, line)) {
+                total += line.size();
+            }
+
+            benchmark::DoNotOptimize(total);
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+
+    void bm_ofstream_write(benchmark::State& state) {
+        const auto chunk_size = static_cast<size_t>(state.range(0));
+        const string chunk(chunk_size, 'x');
+        constexpr size_t total_size = 16 << 20;
+        const string path           = "benchmark-iostreams-" + to_string(chunk_size) + ".tmp";
+
+        for (auto _ : state) {
+            ofstream out{path, ios::binary | ios::trunc};
+            for (size_t written = 0; written < total_size; written += chunk_size) {
+                out.write(chunk.data(), static_cast<streamsize>(chunk_size));
+            }
+        }
+
+        (void) remove(path.c_str());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * total_size));
+    }
+
+    void bm_ifstream_read(benchmark::State& state) {
+        const auto chunk_size       = static_cast<size_t>(state.range(0));
+        constexpr size_t total_size = 16 << 20;
+        const string path           = "benchmark-iostreams-" + to_string(chunk_size) + ".tmp";
+        {
+            ofstream out{path, ios::binary | ios::trunc};
+            const string contents(total_size, 'x');
+            out.write(contents.data(), static_cast<streamsize>(total_size));
+        }
+
+        vector<char> chunk(chunk_size);
+
+        for (auto _ : state) {
+            ifstream in{path, ios::binary};
+            while (in.read(chunk.data(), static_cast<streamsize>(chunk_size))) {
+                benchmark::DoNotOptimize(chunk.data());
+            }
+        }
+
+        (void) remove(path.c_str());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * total_size));
+    }
+} // unnamed namespace
+
+BENCHMARK(bm_ostringstream_insert<int32_t>);
+BENCHMARK(bm_ostringstream_insert<double>);
+BENCHMARK(bm_istringstream_extract<int32_t>);
+BENCHMARK(bm_istringstream_extract<double>);
+BENCHMARK(bm_getline);
+BENCHMARK(bm_ofstream_write)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(bm_ifstream_read)->RangeMultiplier(16)->Range(16, 1 << 16);
@@ -0,0 +1,473 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how the parallel algorithms in <execution> scale with the number of threads they may use.
+//
+// For every algorithm and input size, the seq overload is timed once; then, for every requested thread count, the
+// process affinity is restricted to that many logical processors and the par overload is timed. (When built against
+// an STL that provides stdext::parallel_algorithms_scope, the algorithms are also told to partition for that many
+// threads; otherwise they still partition for thread::hardware_concurrency() and only the affinity is restricted.)
+// The report records the speedup over seq and, for each thread count, the crossover: the smallest size from which par
+// is faster than seq at every larger measured size.
+//
+// Usage: benchmark-parallel_scaling [--out=<file.json>] [--threads=<n>,<n>...] [--min-size=<n>] [--max-size=<n>]
+//                                   [--min-time-ms=<n>] [--filter=<substring>]
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <Windows.h>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    struct options {
+        string out_path = "parallel_scaling.json";
+        vector<unsigned int> threads;
+        size_t min_size = size_t{1} << 6;
+        size_t max_size = size_t{1} << 24;
+        chrono::milliseconds min_time{20};
+        size_t min_runs = 5;
+        size_t max_runs = 10000;
+        string filter;
+    };
+
+    // One algorithm under test: prepare() (untimed) resets any state the previous run modified, run_seq() and
+    // run_par() call the algorithm with the corresponding policy.
+    class workload {
+    public:
+        virtual ~workload() = default;
+
+        virtual void prepare() {}
+        virtual void run_seq() = 0;
+        virtual void run_par() = 0;
+    };
+
+    volatile size_t observed; // keeps results alive without perturbing the measured code
+
+    void observe(const size_t value) {
+        observed = value;
+    }
+
+    template <class Algorithm>
+    class read_only_workload : public workload {
+    public:
+        read_only_workload(const size_t size, Algorithm algorithm)
+            : input(random_vector<uint32_t>(size, 0u, 1u << 20)), algorithm(move(algorithm)) {}
+
+        void run_seq() override {
+            observe(algorithm(execution::seq, input));
+        }
+
+        void run_par() override {
+            observe(algorithm(execution::par, input));
+        }
+
+    private:
+        vector<uint32_t> input;
+        Algorithm algorithm;
+    };
+
+    template <class Algorithm>
+    class mutating_workload : public workload {
+    public:
+        mutating_workload(const size_t size, Algorithm algorithm)
+            : input(random_vector<uint32_t>(size)), data(size), algorithm(move(algorithm)) {}
+
+        void prepare() override {
+            copy(input.begin(), input.end(), data.begin());
+        }
+
+        void run_seq() override {
+            observe(algorithm(execution::seq, data));
+        }
+
+        void run_par() override {
+            observe(algorithm(execution::par, data));
+        }
+
+    private:
+        vector<uint32_t> input;
+        vector<uint32_t> data;
+        Algorithm algorithm;
+    };
+
+    template <class Algorithm>
+    class two_sorted_ranges_workload : public workload {
+    public:
+        two_sorted_ranges_workload(const size_t size, Algorithm algorithm)
+            : left(random_vector<uint32_t>(size, 0u, static_cast<uint32_t>(size * 2))), right(left),
+              dest(size * 2), algorithm(move(algorithm)) {
+            shuffle(right.begin(), right.end(), mt19937_64{benchmark_seed + 1});
+            right.resize(right.size() / 2);
+            sort(left.begin(), left.end());
+            sort(right.begin(), right.end());
+        }
+
+        void run_seq() override {
+            observe(algorithm(execution::seq, left, right, dest));
+        }
+
+        void run_par() override {
+            observe(algorithm(execution::par, left, right, dest));
+        }
+
+    private:
+        vector<uint32_t> left;
+        vector<uint32_t> right;
+        vector<uint32_t> dest;
+        Algorithm algorithm;
+    };
+
+    struct algorithm_entry {
+        const char* name;
+        function<unique_ptr<workload>(size_t)> factory;
+    };
+
+    template <template <class> class Workload, class Algorithm>
+    void add(vector<algorithm_entry>& algorithms, const char* const name, Algorithm algorithm) {
+        algorithms.push_back({name, [algorithm](const size_t size) -> unique_ptr<workload> {
+                                  return make_unique<Workload<Algorithm>>(size, algorithm);
+                              }});
+    }
+
+    using elements = vector<uint32_t>;
+
+    vector<algorithm_entry> make_algorithms() {
+        vector<algorithm_entry> algorithms;
+
+        add<mutating_workload>(algorithms, "sort", [](const auto& policy, elements& v) {
+            sort(policy, v.begin(), v.end());
+            return static_cast<size_t>(v.front());
+        });
+        add<mutating_workload>(algorithms, "stable_sort", [](const auto& policy, elements& v) {
+            stable_sort(policy, v.begin(), v.end());
+            return static_cast<size_t>(v.front());
+        });
+        add<mutating_workload>(algorithms, "partition", [](const auto& policy, elements& v) {
+            const auto is_even = [](const uint32_t x) { return (x & 1) == 0; };
+            return static_cast<size_t>(partition(policy, v.begin(), v.end(), is_even) - v.begin());
+        });
+        add<mutating_workload>(algorithms, "remove_if", [](const auto& policy, elements& v) {
+            const auto is_multiple_of_4 = [](const uint32_t x) { return (x & 3) == 0; };
+            return static_cast<size_t>(remove_if(policy, v.begin(), v.end(), is_multiple_of_4) - v.begin());
+        });
+        add<read_only_workload>(algorithms, "reduce", [](const auto& policy, const elements& v) {
+            return static_cast<size_t>(reduce(policy, v.begin(), v.end(), uint64_t{0}));
+        });
+        add<read_only_workload>(algorithms, "transform_reduce", [](const auto& policy, const elements& v) {
+            const auto square = [](const uint32_t x) { return uint64_t{x} * x; };
+            return static_cast<size_t>(transform_reduce(policy, v.begin(), v.end(), uint64_t{0}, plus<>{}, square));
+        });
+        add<mutating_workload>(algorithms, "inclusive_scan", [](const auto& policy, elements& v) {
+            inclusive_scan(policy, v.begin(), v.end(), v.begin());
+            return static_cast<size_t>(v.back());
+        });
+        add<mutating_workload>(algorithms, "exclusive_scan", [](const auto& policy, elements& v) {
+            exclusive_scan(policy, v.begin(), v.end(), v.begin(), 0u);
+            return static_cast<size_t>(v.back());
+        });
+        add<mutating_workload>(algorithms, "transform", [](const auto& policy, elements& v) {
+            transform(policy, v.begin(), v.end(), v.begin(), [](const uint32_t x) { return x * 2654435761u; });
+            return static_cast<size_t>(v.back());
+        });
+        add<mutating_workload>(algorithms, "for_each", [](const auto& policy, elements& v) {
+            for_each(policy, v.begin(), v.end(), [](uint32_t& x) { x ^= x >> 7; });
+            return static_cast<size_t>(v.back());
+        });
+        add<read_only_workload>(algorithms, "find", [](const auto& policy, const elements& v) {
+            // the value is outside the generated range, so the whole input is searched
+            return static_cast<size_t>(find(policy, v.begin(), v.end(), 1u << 21) - v.begin());
+        });
+        add<read_only_workload>(algorithms, "count_if", [](const auto& policy, const elements& v) {
+            return static_cast<size_t>(count_if(policy, v.begin(), v.end(), [](const uint32_t x) { return x < 1000; }));
+        });
+        add<read_only_workload>(algorithms, "is_sorted_until", [](const auto& policy, const elements& v) {
+            // the input is random, so this stops almost at once; it measures the cost of dispatching par
+            return static_cast<size_t>(is_sorted_until(policy, v.begin(), v.end()) - v.begin());
+        });
+        add<read_only_workload>(algorithms, "all_of", [](const auto& policy, const elements& v) {
+            const auto in_range = [](const uint32_t x) { return x < (1u << 21); };
+            return static_cast<size_t>(all_of(policy, v.begin(), v.end(), in_range));
+        });
+        add<two_sorted_ranges_workload>(
+            algorithms, "set_intersection", [](const auto& policy, const elements& l, const elements& r, elements& d) {
+                return static_cast<size_t>(
+                    set_intersection(policy, l.begin(), l.end(), r.begin(), r.end(), d.begin()) - d.begin());
+            });
+        add<two_sorted_ranges_workload>(
+            algorithms, "set_difference", [](const auto& policy, const elements& l, const elements& r, elements& d) {
+                return static_cast<size_t>(
+                    set_difference(policy, l.begin(), l.end(), r.begin(), r.end(), d.begin()) - d.begin());
+            });
+
+        return algorithms;
+    }
+
+    // Returns the median duration of one call, running at least options.min_runs times and for at least
+    // options.min_time in total.
+    template <class Run>
+    double measure_ns(const options& opts, workload& w, Run run) {
+        vector<double> samples;
+        chrono::nanoseconds total{0};
+        while (samples.size() < opts.max_runs && (samples.size() < opts.min_runs || total < opts.min_time)) {
+            w.prepare();
+            const auto start = chrono::steady_clock::now();
+            run(w);
+            const auto elapsed = chrono::steady_clock::now() - start;
+            total += elapsed;
+            samples.push_back(static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(elapsed).count()));
+        }
+
+        const auto mid = samples.begin() + static_cast<ptrdiff_t>(samples.size() / 2);
+        nth_element(samples.begin(), mid, samples.end());
+        return *mid;
+    }
+
+    // Restricts the process to its first thread_count allowed logical processors for as long as it is alive.
+    // Only the processors of the process's primary processor group are considered.
+    class affinity_scope {
+    public:
+        explicit affinity_scope(const unsigned int thread_count) {
+            DWORD_PTR system_mask;
+            if (!GetProcessAffinityMask(GetCurrentProcess(), &old_mask, &system_mask)) {
+                old_mask = 0;
+                return;
+            }
+
+            DWORD_PTR new_mask = 0;
+            unsigned int taken = 0;
+            for (DWORD_PTR bit = 1; bit != 0 && taken < thread_count; bit <<= 1) {
+                if (old_mask & bit) {
+                    new_mask |= bit;
+                    ++taken;
+                }
+            }
+
+            (void) SetProcessAffinityMask(GetCurrentProcess(), new_mask);
+        }
+
+        affinity_scope(const affinity_scope&) = delete;
+        affinity_scope& operator=(const affinity_scope&) = delete;
+
+        ~affinity_scope() {
+            if (old_mask != 0) {
+                (void) SetProcessAffinityMask(GetCurrentProcess(), old_mask);
+            }
+        }
+
+    private:
+        DWORD_PTR old_mask = 0;
+    };
+
+    unsigned int allowed_processors() {
+        DWORD_PTR process_mask;
+        DWORD_PTR system_mask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+            return thread::hardware_concurrency();
+        }
+
+        unsigned int count = 0;
+        for (; process_mask != 0; process_mask &= process_mask - 1) {
+            ++count;
+        }
+
+        return count;
+    }
+
+    struct result {
+        const char* algorithm;
+        size_t size;
+        unsigned int threads;
+        double seq_ns;
+        double par_ns;
+    };
+
+    // The crossover for one algorithm and thread count is the smallest measured size from which par beats seq at
+    // every larger measured size; there is none if par loses at the largest size.
+    optional<size_t> find_crossover(const vector<result>& results, const char* const algorithm,
+        const unsigned int threads) {
+        optional<size_t> crossover;
+        for (const auto& r : results) {
+            if (r.algorithm != algorithm || r.threads != threads) {
+                continue;
+            }
+
+            if (r.par_ns < r.seq_ns) {
+                if (!crossover) {
+                    crossover = r.size;
+                }
+            } else {
+                crossover.reset();
+            }
+        }
+
+        return crossover;
+    }
+
+    [[noreturn]] void usage_error(const string_view arg) {
+        fprintf(stderr, "benchmark-parallel_scaling: unrecognized argument '%.*s'\n", static_cast<int>(arg.size()),
+            arg.data());
+        exit(EXIT_FAILURE);
+    }
+
+    options parse_options(const int argc, char** const argv) {
+        options opts;
+        for (int i = 1; i < argc; ++i) {
+            const string_view arg{argv[i]};
+            const auto value_of = [&](const string_view name) -> optional<string_view> {
+                if (arg.size() > name.size() && arg.substr(0, name.size()) == name && arg[name.size()] == '=') {
+                    return arg.substr(name.size() + 1);
+                }
+
+                return nullopt;
+            };
+
+            const auto to_size = [&](const string_view value) {
+                char* end;
+                const string str{value};
+                const auto parsed = strtoull(str.c_str(), &end, 10);
+                if (str.empty() || *end != '\0') {
+                    usage_error(arg);
+                }
+
+                return static_cast<size_t>(parsed);
+            };
+
+            if (const auto value = value_of("--out")) {
+                opts.out_path = string{*value};
+            } else if (const auto value = value_of("--threads")) {
+                for (size_t first = 0; first <= value->size();) {
+                    const auto last = min(value->find(',', first), value->size());
+                    opts.threads.push_back(static_cast<unsigned int>(to_size(value->substr(first, last - first))));
+                    first = last + 1;
+                }
+            } else if (const auto value = value_of("--min-size")) {
+                opts.min_size = to_size(*value);
+            } else if (const auto value = value_of("--max-size")) {
+                opts.max_size = to_size(*value);
+            } else if (const auto value = value_of("--min-time-ms")) {
+                opts.min_time = chrono::milliseconds{static_cast<long long>(to_size(*value))};
+            } else if (const auto value = value_of("--filter")) {
+                opts.filter = string{*value};
+            } else {
+                usage_error(arg);
+            }
+        }
+
+        if (opts.threads.empty()) {
+            // powers of two, and the number of processors the process may use
+            const unsigned int processors = allowed_processors();
+            for (unsigned int n = 1; n < processors; n *= 2) {
+                opts.threads.push_back(n);
+            }
+
+            opts.threads.push_back(processors);
+        }
+
+        if (opts.min_size == 0 || opts.min_size > opts.max_size) {
+            usage_error("--min-size");
+        }
+
+        return opts;
+    }
+
+    void write_report(const options& opts, const vector<algorithm_entry>& algorithms, const vector<result>& results) {
+        FILE* const file = fopen(opts.out_path.c_str(), "w");
+        if (!file) {
+            fprintf(stderr, "benchmark-parallel_scaling: cannot open '%s'\n", opts.out_path.c_str());
+            exit(EXIT_FAILURE);
+        }
+
+        fprintf(file, "{\n  \"context\": {\n");
+        fprintf(file, "    \"hardware_concurrency\": %u,\n", thread::hardware_concurrency());
+        fprintf(file, "    \"allowed_processors\": %u,\n", allowed_processors());
+#ifdef BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE
+        fprintf(file, "    \"max_concurrency_scoped\": true,\n");
+#else // ^^^ BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE / !BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE vvv
+        fprintf(file, "    \"max_concurrency_scoped\": false,\n");
+#endif // ^^^ !BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE ^^^
+        fprintf(file, "    \"min_time_ms\": %lld\n  },\n", static_cast<long long>(opts.min_time.count()));
+
+        fprintf(file, "  \"results\": [");
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            fprintf(file,
+                "%s\n    {\"algorithm\": \"%s\", \"size\": %zu, \"threads\": %u, \"seq_ns\": %.1f, \"par_ns\": %.1f, "
+                "\"speedup\": %.4f}",
+                i == 0 ? "" : ",", r.algorithm, r.size, r.threads, r.seq_ns, r.par_ns, r.seq_ns / r.par_ns);
+        }
+
+        fprintf(file, "\n  ],\n  \"crossovers\": [");
+        bool first = true;
+        for (const auto& algorithm : algorithms) {
+            const auto matches = [&](const result& r) { return r.algorithm == algorithm.name; };
+            if (none_of(results.begin(), results.end(), matches)) {
+                continue;
+            }
+
+            for (const auto threads : opts.threads) {
+                const auto crossover = find_crossover(results, algorithm.name, threads);
+                fprintf(file, "%s\n    {\"algorithm\": \"%s\", \"threads\": %u, \"size\": ", first ? "" : ",",
+                    algorithm.name, threads);
+                if (crossover) {
+                    fprintf(file, "%zu}", *crossover);
+                } else {
+                    fprintf(file, "null}");
+                }
+
+                first = false;
+            }
+        }
+
+        fprintf(file, "\n  ]\n}\n");
+        fclose(file);
+    }
+} // unnamed namespace
+
+int main(const int argc, char** const argv) {
+    const auto opts       = parse_options(argc, argv);
+    const auto algorithms = make_algorithms();
+    vector<result> results;
+
+    printf("%-18s %10s %8s %14s %14s %8s\n", "algorithm", "size", "threads", "seq (ns)", "par (ns)", "speedup");
+    for (const auto& algorithm : algorithms) {
+        if (!opts.filter.empty() && string_view{algorithm.name}.find(opts.filter) == string_view::npos) {
+            continue;
+        }
+
+        for (size_t size = opts.min_size; size <= opts.max_size; size *= 4) {
+            const auto w        = algorithm.factory(size);
+            const double seq_ns = measure_ns(opts, *w, [](workload& x) { x.run_seq(); });
+
+            for (const auto threads : opts.threads) {
+                const affinity_scope affinity{threads};
+#ifdef BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE
+                const stdext::parallel_algorithms_scope scope{nullptr, threads};
+#endif // BENCHMARKS_HAS_PARALLEL_ALGORITHMS_SCOPE
+                const double par_ns = measure_ns(opts, *w, [](workload& x) { x.run_par(); });
+                results.push_back({algorithm.name, size, threads, seq_ns, par_ns});
+                printf("%-18s %10zu %8u %14.0f %14.0f %8.2f\n", algorithm.name, size, threads, seq_ns, par_ns,
+                    seq_ns / par_ns);
+            }
+        }
+    }
+
+    write_report(opts, algorithms, results);
+}
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Kernels that the STL dispatches to stl/src/vector_algorithms.cpp for trivial element types.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark_data.hpp>
+
+using namespace std;
+
+namespace {
+    template <class T>
+    void bm_find(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        vector<T> v(size, T{1});
+        v.back() = T{2};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(v.data());
+            benchmark::DoNotOptimize(find(v.begin(), v.end(), T{2}));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_count(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto v    = random_vector<T>(size, T{0}, T{3});
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(v.data());
+            benchmark::DoNotOptimize(count(v.begin(), v.end(), T{2}));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_minmax_element(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto v    = random_vector<T>(size);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(v.data());
+            benchmark::DoNotOptimize(minmax_element(v.begin(), v.end()));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_reverse(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        auto v          = random_vector<T>(size);
+
+        for (auto _ : state) {
+            reverse(v.begin(), v.end());
+            benchmark::DoNotOptimize(v.data());
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_reverse_copy(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto src  = random_vector<T>(size);
+        vector<T> dest(size);
+
+        for (auto _ : state) {
+            reverse_copy(src.begin(), src.end(), dest.begin());
+            benchmark::DoNotOptimize(dest.data());
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_swap_ranges(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        auto left       = random_vector<T>(size);
+        auto right      = random_vector<T>(size);
+
+        for (auto _ : state) {
+            swap_ranges(left.begin(), left.end(), right.begin());
+            benchmark::DoNotOptimize(left.data());
+            benchmark::DoNotOptimize(right.data());
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T) * 2));
+    }
+
+    template <class T>
+    void bm_mismatch(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto left = random_vector<T>(size);
+        auto right      = left;
+        right.back()    = static_cast<T>(right.back() + 1);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(left.data());
+            benchmark::DoNotOptimize(right.data());
+            benchmark::DoNotOptimize(mismatch(left.begin(), left.end(), right.begin(), right.end()));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T) * 2));
+    }
+
+    template <class T>
+    void bm_remove_copy(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto src  = random_vector<T>(size, T{0}, T{3});
+        vector<T> dest(size);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(remove_copy(src.begin(), src.end(), dest.begin(), T{2}));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    template <class T>
+    void bm_unique(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto src  = random_vector<T>(size, T{0}, T{1});
+        vector<T> v(size);
+
+        for (auto _ : state) {
+            v = src;
+            benchmark::DoNotOptimize(unique(v.begin(), v.end()));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size * sizeof(T)));
+    }
+
+    void bm_string_find_first_of(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        string haystack(size, 'a');
+        haystack.back() = 'z';
+        const string needles{"0123456789xyz"};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(haystack.data());
+            benchmark::DoNotOptimize(haystack.find_first_of(needles));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    void bm_search(benchmark::State& state) {
+        const auto size = static_cast<size_t>(state.range(0));
+        string haystack(size, 'a');
+        const string needle{"aaaaaaab"};
+        haystack.replace(size - needle.size(), needle.size(), needle);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(haystack.data());
+            benchmark::DoNotOptimize(search(haystack.begin(), haystack.end(), needle.begin(), needle.end()));
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+} // unnamed namespace
+
+#define VECTOR_ALGORITHMS_BENCHMARK(FN)         \
+    BENCHMARK(FN<int8_t>)->Range(64, 1 << 20);  \
+    BENCHMARK(FN<int16_t>)->Range(64, 1 << 20); \
+    BENCHMARK(FN<int32_t>)->Range(64, 1 << 20); \
+    BENCHMARK(FN<int64_t>)->Range(64, 1 << 20)
+
+VECTOR_ALGORITHMS_BENCHMARK(bm_find);
+VECTOR_ALGORITHMS_BENCHMARK(bm_count);
+VECTOR_ALGORITHMS_BENCHMARK(bm_minmax_element);
+BENCHMARK(bm_minmax_element<float>)->Range(64, 1 << 20);
+BENCHMARK(bm_minmax_element<double>)->Range(64, 1 << 20);
+VECTOR_ALGORITHMS_BENCHMARK(bm_reverse);
+VECTOR_ALGORITHMS_BENCHMARK(bm_reverse_copy);
+VECTOR_ALGORITHMS_BENCHMARK(bm_swap_ranges);
+VECTOR_ALGORITHMS_BENCHMARK(bm_mismatch);
+VECTOR_ALGORITHMS_BENCHMARK(bm_remove_copy);
+VECTOR_ALGORITHMS_BENCHMARK(bm_unique);
+BENCHMARK(bm_string_find_first_of)->Range(64, 1 << 20);
+BENCHMARK(bm_search)->Range(64, 1 << 20);
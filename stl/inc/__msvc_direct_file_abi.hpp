@@ -0,0 +1,71 @@
+// __msvc_direct_file_abi.hpp internal header (core)
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+#ifndef __MSVC_DIRECT_FILE_ABI_HPP
+#define __MSVC_DIRECT_FILE_ABI_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+#include <cstddef>
+#include <cstdint>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+#ifdef _M_CEE_PURE
+#define __CLRCALL_PURE_OR_STDCALL __clrcall
+#else
+#define __CLRCALL_PURE_OR_STDCALL __stdcall
+#endif
+
+enum class __std_direct_file_handle : intptr_t { _Invalid = -1 };
+
+struct __std_mapped_file_view {
+    const void* _Data; // nullptr for an empty file
+    size_t _Size;
+    bool _Success;
+};
+
+_EXTERN_C
+// opens _File_name with the ios_base::openmode bits in _Mode, returning _Invalid on failure
+_NODISCARD __std_direct_file_handle __CLRCALL_PURE_OR_STDCALL __std_direct_file_open(
+    _In_z_ const wchar_t* _File_name, int _Mode) noexcept;
+_NODISCARD __std_direct_file_handle __CLRCALL_PURE_OR_STDCALL __std_direct_file_open_narrow(
+    _In_z_ const char* _File_name, int _Mode) noexcept;
+
+_NODISCARD bool __CLRCALL_PURE_OR_STDCALL __std_direct_file_close(__std_direct_file_handle _Handle) noexcept;
+
+// returns the number of bytes read, 0 at end of file or on failure
+_NODISCARD size_t __CLRCALL_PURE_OR_STDCALL __std_direct_file_read(
+    __std_direct_file_handle _Handle, _Out_writes_bytes_to_(_Size, return) void* _Buf, size_t _Size) noexcept;
+
+// returns whether all _Size bytes were written
+_NODISCARD bool __CLRCALL_PURE_OR_STDCALL __std_direct_file_write(
+    __std_direct_file_handle _Handle, _In_reads_bytes_(_Size) const void* _Buf, size_t _Size) noexcept;
+
+// _Way is SEEK_SET, SEEK_CUR, or SEEK_END; returns the new position, or -1 on failure
+_NODISCARD long long __CLRCALL_PURE_OR_STDCALL __std_direct_file_seek(
+    __std_direct_file_handle _Handle, long long _Offset, int _Way) noexcept;
+
+// maps the whole of _File_name read-only; the view stays valid until passed to __std_mapped_file_unmap
+_NODISCARD __std_mapped_file_view __CLRCALL_PURE_OR_STDCALL __std_mapped_file_map(
+    _In_z_ const wchar_t* _File_name) noexcept;
+_NODISCARD __std_mapped_file_view __CLRCALL_PURE_OR_STDCALL __std_mapped_file_map_narrow(
+    _In_z_ const char* _File_name) noexcept;
+
+void __CLRCALL_PURE_OR_STDCALL __std_mapped_file_unmap(const void* _Data) noexcept;
+_END_EXTERN_C
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_DIRECT_FILE_ABI_HPP
@@ -0,0 +1,42 @@
+// __msvc_direct_file_async.hpp internal header (core)
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Included at the end of <fstream> and <future>, by whichever of the two comes second, so that neither has to include
+// the other.
+
+#pragma once
+#ifndef __MSVC_DIRECT_FILE_ASYNC_HPP
+#define __MSVC_DIRECT_FILE_ASYNC_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+#include <fstream>
+#include <future>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+#if defined(__cpp_lib_span) && _HAS_STD_BYTE
+_STDEXT_BEGIN
+// FUNCTION TEMPLATE read_into_async
+template <class _Elem, class _Traits>
+_NODISCARD _STD future<size_t> read_into_async(
+    basic_direct_filebuf<_Elem, _Traits>& _Buf, const _STD span<_STD byte> _Dest) {
+    // call _Buf.read_into(_Dest) on another thread, so that the next block of a file can be read while the last one
+    // is processed; neither _Buf nor _Dest may be used until the result is ready
+    return _STD async(_STD launch::async, [&_Buf, _Dest] { return _Buf.read_into(_Dest); });
+}
+_STDEXT_END
+#endif // defined(__cpp_lib_span) && _HAS_STD_BYTE
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_DIRECT_FILE_ASYNC_HPP
@@ -0,0 +1,412 @@
+// __msvc_parallel_filesystem.hpp internal header (core)
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Included at the end of <execution> and <filesystem>, by whichever of the two comes second, so that neither has to
+// include the other.
+
+#pragma once
+#ifndef __MSVC_PARALLEL_FILESYSTEM_HPP
+#define __MSVC_PARALLEL_FILESYSTEM_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#if _HAS_CXX17
+#include <execution>
+#include <filesystem>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_STDEXT_BEGIN
+namespace filesystem {
+    // CLASS TEMPLATE _Parallel_walk
+    template <class _Fn>
+    struct _Parallel_walk {
+        // directories are walked one per threadpool callback; a walked directory adds its subdirectories to _Pending
+        // and submits one callback per subdirectory, and the walk is over when _Outstanding drops to zero
+        using _Path_t = _STD filesystem::path;
+
+        _Parallel_walk(_Fn& _Func_, const _STD filesystem::directory_options _Options_)
+            : _Func(_Func_), _Options(_Options_) {}
+
+        _Parallel_walk(const _Parallel_walk&) = delete;
+        _Parallel_walk& operator=(const _Parallel_walk&) = delete;
+
+        void _Fail(const _STD error_code& _Ec, const _Path_t& _Where) {
+            _Canceled.store(true, _STD memory_order_relaxed);
+            _STD lock_guard<_STD mutex> _Lock{_Mtx};
+            if (!_Error && !_Exception) {
+                _Error      = _Ec;
+                _Error_path = _Where;
+            }
+        }
+
+        void _Walk_one(const _Path_t& _Dir) noexcept {
+            _STD vector<_Path_t> _Subdirs;
+            if (!_Canceled.load(_STD memory_order_relaxed)) {
+                _TRY_BEGIN
+                _STD error_code _Ec;
+                _STD filesystem::directory_iterator _Iter(_Dir, _Options, _Ec);
+                const _STD filesystem::directory_iterator _End;
+                while (!_Ec && _Iter != _End && !_Canceled.load(_STD memory_order_relaxed)) {
+                    const auto& _Entry = *_Iter;
+                    _Func(_Entry);
+                    const auto _Result =
+                        _STD filesystem::_Recursive_dir_enum_impl::_Should_recurse_into(_Entry, _Options);
+                    if (_Result._Error != __std_win_error::_Success) {
+                        _Fail(_STD filesystem::_Make_ec(_Result._Error), _Entry.path());
+                        break;
+                    }
+
+                    if (_Result._Should_recurse) {
+                        _Subdirs.push_back(_Entry.path());
+                    }
+
+                    _Iter.increment(_Ec);
+                }
+
+                if (_Ec) {
+                    _Fail(_Ec, _Dir);
+                }
+                _CATCH_ALL
+                _Canceled.store(true, _STD memory_order_relaxed);
+                _Subdirs.clear();
+                _STD lock_guard<_STD mutex> _Lock{_Mtx};
+                if (!_Exception) {
+                    _Exception = _STD current_exception();
+                }
+                _CATCH_END
+            }
+
+            if (_Canceled.load(_STD memory_order_relaxed)) {
+                _Subdirs.clear(); // don't start any more directories
+            }
+
+            // hereafter nothrow or terminate
+            const size_t _Found = _Subdirs.size();
+            bool _Finished;
+            {
+                _STD lock_guard<_STD mutex> _Lock{_Mtx};
+                for (auto& _Subdir : _Subdirs) {
+                    _Pending.push_back(_STD move(_Subdir));
+                }
+
+                _Outstanding += _Found;
+                _Finished = --_Outstanding == 0;
+            }
+
+            if (_Finished) {
+                _Done.store(1);
+                __std_execution_wake_by_address_all(&_Done);
+            } else if (_Found != 0 && _Work) {
+                _Work->_Submit(_Found);
+            }
+        }
+
+        void _Run() noexcept { // walk pending directories until there are none
+            for (;;) {
+                _Path_t _Dir;
+                {
+                    _STD lock_guard<_STD mutex> _Lock{_Mtx};
+                    if (_Pending.empty()) {
+                        return;
+                    }
+
+                    _Dir = _STD move(_Pending.back());
+                    _Pending.pop_back();
+                }
+
+                _Walk_one(_Dir);
+            }
+        }
+
+        void _Wait() noexcept { // wait for directories that threadpool callbacks are still walking
+            for (;;) {
+                const unsigned char _State = _Done.load();
+                if (_State != 0) {
+                    return;
+                }
+
+                __std_execution_wait_on_uchar(reinterpret_cast<const unsigned char*>(&_Done), _State);
+            }
+        }
+
+        static void __stdcall _Threadpool_callback(
+            __std_PTP_CALLBACK_INSTANCE, void* const _Context, __std_PTP_WORK) noexcept {
+            static_cast<_Parallel_walk*>(_Context)->_Run();
+        }
+
+        _Fn& _Func;
+        const _STD filesystem::directory_options _Options;
+        const _STD _Work_ptr* _Work = nullptr; // null when walking serially
+        _STD atomic<bool> _Canceled{false};
+        _STD atomic<unsigned char> _Done{0};
+        _STD mutex _Mtx;
+        _STD vector<_Path_t> _Pending; // guarded by _Mtx
+        size_t _Outstanding = 1; // directories pending or being walked, guarded by _Mtx
+        _STD error_code _Error; // first error, guarded by _Mtx
+        _Path_t _Error_path; // guarded by _Mtx
+        _STD exception_ptr _Exception; // first exception thrown by _Func, guarded by _Mtx
+    };
+
+    template <class _Fn>
+    void _Run_parallel_walk(_Parallel_walk<_Fn>& _Operation, const _STD filesystem::path& _Root) {
+        _Operation._Pending.push_back(_Root);
+        if (__std_parallel_algorithms_hw_threads() > 1) {
+            _TRY_BEGIN
+            const _STD _Work_ptr _Work_op{_Operation};
+            // setup complete, hereafter nothrow or terminate
+            _Operation._Work = _STD addressof(_Work_op);
+            _Operation._Run();
+            _Operation._Wait();
+            return;
+            _CATCH(const _STD _Parallelism_resources_exhausted&)
+            // fall through to serial case below
+            _CATCH_END
+        }
+
+        _Operation._Run();
+    }
+
+    // FUNCTION TEMPLATE parallel_walk
+    template <class _Fn>
+    void parallel_walk(const _STD filesystem::path& _Root, _Fn _Func,
+        const _STD filesystem::directory_options _Options, _STD error_code& _Ec) {
+        // call _Func with the directory_entry of everything below _Root, as recursive_directory_iterator(_Root,
+        // _Options) would visit it; subdirectories are enumerated concurrently on the threadpool used by the
+        // parallel algorithms, so _Func is called from several threads at once, in no particular order
+        _Parallel_walk<_Fn> _Operation{_Func, _Options};
+        _Run_parallel_walk(_Operation, _Root);
+        if (_Operation._Exception) {
+            _STD rethrow_exception(_Operation._Exception);
+        }
+
+        _Ec = _Operation._Error;
+    }
+
+    template <class _Fn>
+    void parallel_walk(const _STD filesystem::path& _Root, _Fn _Func, _STD error_code& _Ec) {
+        _STDEXT filesystem::parallel_walk(_Root, _STD move(_Func), _STD filesystem::directory_options::none, _Ec);
+    }
+
+    template <class _Fn>
+    void parallel_walk(const _STD filesystem::path& _Root, _Fn _Func,
+        const _STD filesystem::directory_options _Options = _STD filesystem::directory_options::none) {
+        _Parallel_walk<_Fn> _Operation{_Func, _Options};
+        _Run_parallel_walk(_Operation, _Root);
+        if (_Operation._Exception) {
+            _STD rethrow_exception(_Operation._Exception);
+        }
+
+        if (_Operation._Error) {
+            _THROW(_STD filesystem::filesystem_error("parallel_walk", _Operation._Error_path, _Operation._Error));
+        }
+    }
+
+    // STRUCT _Parallel_copy_entry
+    struct _Parallel_copy_entry { // copies one entry that parallel_walk found below the source directory
+        _NODISCARD bool _Follows_symlinks() const noexcept {
+            return !_Bitmask_includes(
+                _Options, _STD filesystem::copy_options::skip_symlinks | _STD filesystem::copy_options::copy_symlinks);
+        }
+
+        void operator()(const _STD filesystem::directory_entry& _Entry) const {
+            using _STD filesystem::copy_options;
+            const auto _Target = _To / _Entry.path().lexically_relative(_From);
+            _STD error_code _Ec;
+            const auto _Status = _Follows_symlinks() ? _Entry.status(_Ec) : _Entry.symlink_status(_Ec);
+            if (!_Ec) {
+                if (_STD filesystem::is_directory(_Status)) {
+                    // create the directory the way copy does, without iterating it; the walk visits its contents
+                    _STD filesystem::_Copy_impl(
+                        _Entry, _Target, (_Options & ~copy_options::recursive) | copy_options::directories_only, _Ec);
+                } else if (_STD filesystem::is_regular_file(_Status)
+                           && !_Bitmask_includes(_Options, copy_options::directories_only
+                                                               | copy_options::create_symlinks
+                                                               | copy_options::create_hard_links)) {
+                    (void) _STDEXT filesystem::copy_file_ex(_Entry.path(), _Target, _Options, _Flags, _Ec);
+                } else {
+                    _STD filesystem::_Copy_impl(_Entry, _Target, _Options, _Ec);
+                }
+            }
+
+            if (_Ec) {
+                _Walk->_Fail(_Ec, _Entry.path());
+            }
+        }
+
+        const _STD filesystem::path& _From;
+        const _STD filesystem::path& _To;
+        _STD filesystem::copy_options _Options;
+        copy_file_flags _Flags;
+        _Parallel_walk<_Parallel_copy_entry>* _Walk;
+    };
+
+    inline _STD error_code _Parallel_copy(const _STD filesystem::path& _From, const _STD filesystem::path& _To,
+        const _STD filesystem::copy_options _Options, const copy_file_flags _Flags, _STD filesystem::path& _Where) {
+        using _STD filesystem::copy_options;
+        _Parallel_copy_entry _Copy_entry{_From, _To, _Options | copy_options::recursive, _Flags, nullptr};
+        _STD error_code _Ec;
+        const auto _From_status = _Copy_entry._Follows_symlinks() ? _STD filesystem::status(_From, _Ec)
+                                                                  : _STD filesystem::symlink_status(_From, _Ec);
+        if (_Ec || !_STD filesystem::is_directory(_From_status)) { // nothing to parallelize
+            _STD filesystem::copy(_From, _To, _Copy_entry._Options, _Ec);
+            _Where = _From;
+            return _Ec;
+        }
+
+        // check and create _To as copy does, without iterating _From
+        _STD filesystem::copy(
+            _From, _To, (_Options & ~copy_options::recursive) | copy_options::directories_only, _Ec);
+        if (_Ec) {
+            _Where = _From;
+            return _Ec;
+        }
+
+        const auto _Walk_options = _Copy_entry._Follows_symlinks()
+                                     ? _STD filesystem::directory_options::follow_directory_symlink
+                                     : _STD filesystem::directory_options::none;
+        _Parallel_walk<_Parallel_copy_entry> _Operation{_Copy_entry, _Walk_options};
+        _Copy_entry._Walk = _STD addressof(_Operation);
+        _Run_parallel_walk(_Operation, _From);
+        if (_Operation._Exception) {
+            _STD rethrow_exception(_Operation._Exception);
+        }
+
+        _Where = _STD move(_Operation._Error_path);
+        return _Operation._Error;
+    }
+
+    // FUNCTION parallel_copy
+    inline void parallel_copy(const _STD filesystem::path& _From, const _STD filesystem::path& _To,
+        const _STD filesystem::copy_options _Options, const copy_file_flags _Flags, _STD error_code& _Ec) {
+        // copy _From -> _To like std::filesystem::copy(_From, _To, _Options | copy_options::recursive), with the
+        // entries below a source directory copied concurrently by parallel_walk and regular files copied by
+        // copy_file_ex(_Flags); the first error stops the copy, leaving what was copied so far in place
+        _STD filesystem::path _Where;
+        _Ec = _Parallel_copy(_From, _To, _Options, _Flags, _Where);
+    }
+
+    inline void parallel_copy(const _STD filesystem::path& _From, const _STD filesystem::path& _To,
+        const _STD filesystem::copy_options _Options = _STD filesystem::copy_options::none,
+        const copy_file_flags _Flags                 = copy_file_flags::none) {
+        _STD filesystem::path _Where;
+        const auto _Ec = _Parallel_copy(_From, _To, _Options, _Flags, _Where);
+        if (_Ec) {
+            _THROW(_STD filesystem::filesystem_error("parallel_copy", _Where, _To, _Ec));
+        }
+    }
+
+    // STRUCT _Parallel_remove_entry
+    struct _Parallel_remove_entry { // removes the nondirectories parallel_walk finds, remembering the directories
+        void operator()(const _STD filesystem::directory_entry& _Entry) {
+            _STD error_code _Ec;
+            const auto _Status = _Entry.symlink_status(_Ec);
+            if (!_Ec) {
+                if (_STD filesystem::is_directory(_Status)) { // removed after the walk, once empty
+                    _STD lock_guard<_STD mutex> _Lock{_Mtx};
+                    _Directories.push_back(_Entry.path());
+                    return;
+                }
+
+                if (_STD filesystem::remove(_Entry.path(), _Ec)) {
+                    _Removed.fetch_add(1, _STD memory_order_relaxed);
+                }
+            }
+
+            if (_Ec) {
+                _Walk->_Fail(_Ec, _Entry.path());
+            }
+        }
+
+        _STD mutex _Mtx;
+        _STD vector<_STD filesystem::path> _Directories;
+        _STD atomic<_STD uintmax_t> _Removed{0};
+        _Parallel_walk<_Parallel_remove_entry>* _Walk = nullptr;
+    };
+
+    inline _STD error_code _Parallel_remove_all(
+        const _STD filesystem::path& _Path, _STD uintmax_t& _Removed_count, _STD filesystem::path& _Where) {
+        _STD error_code _Ec;
+        _Where = _Path;
+        const auto _Status = _STD filesystem::symlink_status(_Path, _Ec);
+        if (_Ec || !_STD filesystem::is_directory(_Status)) { // nothing to parallelize
+            _Removed_count = _STD filesystem::remove_all(_Path, _Ec);
+            return _Ec;
+        }
+
+        _Parallel_remove_entry _Remove_entry;
+        _Parallel_walk<_Parallel_remove_entry> _Operation{_Remove_entry, _STD filesystem::directory_options::none};
+        _Remove_entry._Walk = _STD addressof(_Operation);
+        _Run_parallel_walk(_Operation, _Path);
+        if (_Operation._Exception) {
+            _STD rethrow_exception(_Operation._Exception);
+        }
+
+        _Removed_count = _Remove_entry._Removed.load(_STD memory_order_relaxed);
+        if (_Operation._Error) {
+            _Where = _STD move(_Operation._Error_path);
+            return _Operation._Error;
+        }
+
+        // a directory's path is longer than its parent's, so this removes children before their parents; remove_all
+        // also takes care of anything added since the walk
+        auto& _Directories = _Remove_entry._Directories;
+        _STD sort(_Directories.begin(), _Directories.end(),
+            [](const _STD filesystem::path& _Left, const _STD filesystem::path& _Right) {
+                return _Left.native().size() > _Right.native().size();
+            });
+        _Directories.push_back(_Path);
+        for (auto& _Directory : _Directories) {
+            const auto _Removed = _STD filesystem::remove_all(_Directory, _Ec);
+            if (_Ec) {
+                _Where = _STD move(_Directory);
+                return _Ec;
+            }
+
+            _Removed_count += _Removed;
+        }
+
+        return _Ec;
+    }
+
+    // FUNCTION parallel_remove_all
+    inline _STD uintmax_t parallel_remove_all(const _STD filesystem::path& _Path, _STD error_code& _Ec) {
+        // remove _Path, including any contents, like std::filesystem::remove_all; the nondirectories below _Path are
+        // removed concurrently by parallel_walk, then the directories, deepest first
+        _STD uintmax_t _Removed_count = 0;
+        _STD filesystem::path _Where;
+        _Ec = _Parallel_remove_all(_Path, _Removed_count, _Where);
+        if (_Ec) {
+            _Removed_count = static_cast<_STD uintmax_t>(-1);
+        }
+
+        return _Removed_count;
+    }
+
+    inline _STD uintmax_t parallel_remove_all(const _STD filesystem::path& _Path) {
+        _STD uintmax_t _Removed_count = 0;
+        _STD filesystem::path _Where;
+        const auto _Ec = _Parallel_remove_all(_Path, _Removed_count, _Where);
+        if (_Ec) {
+            _THROW(_STD filesystem::filesystem_error("parallel_remove_all", _Where, _Ec));
+        }
+
+        return _Removed_count;
+    }
+} // namespace filesystem
+_STDEXT_END
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // _HAS_CXX17
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_PARALLEL_FILESYSTEM_HPP
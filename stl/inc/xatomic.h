@@ -3,7 +3,7 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-#pragma once
+// not #pragma once, see the barrier macros at the end
 #ifndef _XATOMIC_H
 #define _XATOMIC_H
 #include <yvals.h>
@@ -116,3 +116,16 @@ _STL_RESTORE_CLANG_WARNINGS
 #pragma pack(pop)
 #endif // _STL_COMPILER_PREPROCESSOR
 #endif // _XATOMIC_H
+
+// <atomic> undefines the barrier macros at its end, so every inclusion of this header defines them again if needed
+#if _STL_COMPILER_PREPROCESSOR && !defined(_Compiler_barrier)
+#define _Compiler_barrier() _STL_DISABLE_DEPRECATED_WARNING _ReadWriteBarrier() _STL_RESTORE_DEPRECATED_WARNING
+
+#if defined(_M_ARM) || defined(_M_ARM64) || defined(_M_ARM64EC)
+#define _Memory_barrier()             __dmb(0xB) // inner shared data memory barrier
+#define _Compiler_or_memory_barrier() _Memory_barrier()
+#else // ^^^ ARM32/ARM64 / x86/x64 vvv
+// x86/x64 hardware only emits memory barriers inside _Interlocked intrinsics
+#define _Compiler_or_memory_barrier() _Compiler_barrier()
+#endif // hardware
+#endif // _STL_COMPILER_PREPROCESSOR && !defined(_Compiler_barrier)
@@ -45,6 +45,12 @@ int __stdcall __std_atomic_wait_direct(
 void __stdcall __std_atomic_notify_one_direct(const void* _Storage) noexcept;
 void __stdcall __std_atomic_notify_all_direct(const void* _Storage) noexcept;
 
+// Like __std_atomic_wait_direct, but with _Remaining_timeout in 100-nanosecond units; where high resolution waitable
+// timers are available (Windows 10, version 1803 and later), it is not rounded to the next tick of the system timer.
+// May return before the timeout expires even if not notified, so callers must recompute the remaining timeout.
+int __stdcall __std_atomic_wait_direct_precise(
+    const void* _Storage, void* _Comparand, size_t _Size, unsigned long long _Remaining_timeout) noexcept;
+
 // The "indirect" functions are used when the size is not 1, 2, 4, or 8; these notionally wait on another value which is
 // of one of those sizes whose value changes upon notify, hence "indirect". (As of 2020-07-24, this always uses the
 // fallback SRWLOCK and CONDITION_VARIABLE implementation but that is not contractual.)
@@ -62,6 +68,16 @@ void __stdcall __std_atomic_notify_all_indirect(const void* _Storage) noexcept;
 unsigned long long __stdcall __std_atomic_wait_get_deadline(unsigned long long _Timeout) noexcept;
 unsigned long __stdcall __std_atomic_wait_get_remaining_timeout(unsigned long long _Deadline) noexcept;
 
+// Diagnostics for the SRWLOCK and CONDITION_VARIABLE based implementation, summed over the whole wait table; the
+// counters are updated without synchronization, so they are approximate while other threads wait or notify.
+struct __std_atomic_wait_statistics {
+    unsigned long long _Blocked_waits; // waits that went to sleep rather than seeing the value change while spinning
+    unsigned long long _Contended_locks; // waits and notifies that found their wait table entry locked
+    size_t _Table_size; // the number of entries that addresses are hashed into
+};
+
+void __stdcall __std_atomic_wait_get_statistics(__std_atomic_wait_statistics* _Statistics) noexcept;
+
 _END_EXTERN_C
 
 #pragma pop_macro("new")
@@ -398,6 +398,7 @@ inline constexpr uint64_t __DOUBLE_POW5_SPLIT[326][2] = {
 
 // ^^^^^^^^^^ DERIVED FROM d2s_full_table.h ^^^^^^^^^^
 
+#if !_STL_CHARCONV_COMPACT_TABLES // in compact mode, the printf-style algorithms don't need these tables
 // vvvvvvvvvv DERIVED FROM d2fixed_full_table.h vvvvvvvvvv
 
 inline constexpr int __TABLE_SIZE = 64;
@@ -4799,6 +4800,7 @@ inline constexpr uint64_t __POW10_SPLIT_2[3133][3] = {
 };
 
 // ^^^^^^^^^^ DERIVED FROM d2fixed_full_table.h ^^^^^^^^^^
+#endif // !_STL_CHARCONV_COMPACT_TABLES
 
 // clang-format on
 
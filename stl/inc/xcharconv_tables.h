@@ -0,0 +1,464 @@
+// xcharconv_tables.h internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+#ifndef _XCHARCONV_TABLES_H
+#define _XCHARCONV_TABLES_H
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#include <cstdint>
+#include <xbit_ops.h>
+#include <xcharconv_ryu.h>
+
+#if !_HAS_CXX17
+#error The contents of <charconv> are only available with C++17. (Also, you should not include this internal header.)
+#endif // !_HAS_CXX17
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_STD_BEGIN
+
+// The 128 most significant bits of 5^q for q in [_Eisel_lemire_min_power, _Eisel_lemire_max_power], stored as
+// { high, low } with the most significant bit of high set. Negative powers are the reciprocals 2^k / 5^-q, rounded
+// up. This is the table used by the Eisel-Lemire algorithm; see D. Lemire, "Number Parsing at a Gigabyte per Second",
+// Software: Practice and Experience 51(8), 2021.
+inline constexpr int _Eisel_lemire_min_power = -342;
+inline constexpr int _Eisel_lemire_max_power = 308;
+
+// clang-format off
+
+inline constexpr uint64_t _Eisel_lemire_pow5_128[651][2] = {
+  { 17218479456385750618u,  1242899115359157055u }, { 10761549660241094136u,  5388497965526861063u },
+  { 13451937075301367670u,  6735622456908576329u }, { 16814921344126709587u, 17642900107990496220u },
+  { 10509325840079193492u,  8720969558280366185u }, { 13136657300098991865u, 10901211947850457732u },
+  { 16420821625123739831u, 18238200953240460069u }, { 10263013515702337394u, 18316404623416369399u },
+  { 12828766894627921743u, 13672133742415685941u }, { 16035958618284902179u, 12478481159592219522u },
+  { 10022474136428063862u,  5493207715531443249u }, { 12528092670535079827u, 16089881681269079869u },
+  { 15660115838168849784u, 15500666083158961933u }, {  9787572398855531115u,  9687916301974351208u },
+  { 12234465498569413894u,  7498209359040551106u }, { 15293081873211767368u,   149389661945913074u },
+  {  9558176170757354605u,    93368538716195671u }, { 11947720213446693256u,  4728396691822632493u },
+  { 14934650266808366570u,  5910495864778290617u }, {  9334156416755229106u,  8305745933913819539u },
+  { 11667695520944036383u,  1158810380537498616u }, { 14584619401180045478u, 15283571030954036982u },
+  { 18230774251475056848u,  9881091751837770420u }, { 11394233907171910530u,  6175682344898606512u },
+  { 14242792383964888162u, 16942974967978033949u }, { 17803490479956110203u, 11955346673117766628u },
+  { 11127181549972568877u,  5166248661484910190u }, { 13908976937465711096u, 11069496845283525642u },
+  { 17386221171832138870u, 13836871056604407053u }, { 10866388232395086794u,  4036358391950366504u },
+  { 13582985290493858492u, 14268820026792733938u }, { 16978731613117323115u, 17836025033490917422u },
+  { 10611707258198326947u,  8841672636718129437u }, { 13264634072747908684u,  6440404777470273892u },
+  { 16580792590934885855u,  8050505971837842365u }, { 10362995369334303659u, 11949095260039733334u },
+  { 12953744211667879574u, 10324683056622278764u }, { 16192180264584849468u,  3682481783923072647u },
+  { 10120112665365530917u, 11524923151806696212u }, { 12650140831706913647u,   571095884476206553u },
+  { 15812676039633642058u, 14548927910877421904u }, {  9882922524771026286u, 13704765962725776594u },
+  { 12353653155963782858u,  7907585416552444934u }, { 15442066444954728573u,   661109733835780360u },
+  {  9651291528096705358u,  2719036592861056677u }, { 12064114410120881697u, 12622167777931096654u },
+  { 15080143012651102122u,  1942651667131707105u }, {  9425089382906938826u,  5825843310384704845u },
+  { 11781361728633673532u, 16505676174835656864u }, { 14726702160792091916u,  2185351144835019464u },
+  { 18408377700990114895u,  2731688931043774330u }, { 11505236063118821809u,  8624834609543440812u },
+  { 14381545078898527261u, 15392729280356688919u }, { 17976931348623159077u,  5405853545163697437u },
+  { 11235582092889474423u,  5684501474941004850u }, { 14044477616111843029u,  2493940825248868159u },
+  { 17555597020139803786u,  7729112049988473103u }, { 10972248137587377366u,  9442381049670183593u },
+  { 13715310171984221708u,  2579604275232953683u }, { 17144137714980277135u,  3224505344041192104u },
+  { 10715086071862673209u,  8932844867666826921u }, { 13393857589828341511u, 15777742103010921555u },
+  { 16742321987285426889u, 15110491610336264040u }, { 10463951242053391806u,  2526528228819083169u },
+  { 13079939052566739757u, 12381532322878629770u }, { 16349923815708424697u,  1641857348316123500u },
+  { 10218702384817765435u, 12555375888766046947u }, { 12773377981022206794u, 11082533842530170780u },
+  { 15966722476277758493u,  4629795266307937667u }, {  9979201547673599058u,  5199465050656154994u },
+  { 12474001934591998822u, 15722703350174969551u }, { 15592502418239998528u, 10430007150863936130u },
+  {  9745314011399999080u,  6518754469289960081u }, { 12181642514249998850u,  8148443086612450102u },
+  { 15227053142812498563u,   962181821410786819u }, {  9516908214257811601u, 16742264702877599426u },
+  { 11896135267822264502u,  7092772823314835570u }, { 14870169084777830627u, 18089338065998320271u },
+  {  9293855677986144142u,  8999993282035256217u }, { 11617319597482680178u,  2026619565689294464u },
+  { 14521649496853350222u, 11756646493966393888u }, { 18152061871066687778u,  5472436080603216552u },
+  { 11345038669416679861u,  8031958568804398249u }, { 14181298336770849826u, 14651634229432885715u },
+  { 17726622920963562283u,  9091170749936331336u }, { 11079139325602226427u,  3376138709496513133u },
+  { 13848924157002783033u, 18055231442152805128u }, { 17311155196253478792u,  8733981247408842698u },
+  { 10819471997658424245u,  5458738279630526686u }, { 13524339997073030306u, 11435108867965546262u },
+  { 16905424996341287883u,  5070514048102157020u }, { 10565890622713304927u,   863228270850154185u },
+  { 13207363278391631158u, 14914093393844856443u }, { 16509204097989538948u,  9419244705451294746u },
+  { 10318252561243461842u, 15110399977761835024u }, { 12897815701554327303u,  9664627935347517973u },
+  { 16122269626942909129u,  7469098900757009562u }, { 10076418516839318205u, 16197401859041600736u },
+  { 12595523146049147757u,  6411694268519837208u }, { 15744403932561434696u, 12626303854077184414u },
+  {  9840252457850896685u,  7891439908798240259u }, { 12300315572313620856u, 14475985904425188227u },
+  { 15375394465392026070u, 18094982380531485284u }, {  9609621540870016294u,  6697677969404790399u },
+  { 12012026926087520367u, 17595469498610763806u }, { 15015033657609400459u, 17382650854836066854u },
+  {  9384396036005875287u,  8558313775058847832u }, { 11730495045007344109u,  6086206200396171886u },
+  { 14663118806259180136u, 12219443768922602761u }, { 18328898507823975170u, 15274304711153253452u },
+  { 11455561567389984481u, 14158126462898171311u }, { 14319451959237480602u,  3862600023340550427u },
+  { 17899314949046850752u, 14051622066030463842u }, { 11187071843154281720u,  8782263791269039901u },
+  { 13983839803942852150u, 10977829739086299876u }, { 17479799754928565188u,  4498915137003099037u },
+  { 10924874846830353242u, 12035193997481712706u }, { 13656093558537941553u,  5820620459997365075u },
+  { 17070116948172426941u, 11887461593424094248u }, { 10668823092607766838u,  9735506505103752857u },
+  { 13336028865759708548u,  2946011094524915263u }, { 16670036082199635685u,  3682513868156144079u },
+  { 10418772551374772303u,  4607414176811284001u }, { 13023465689218465379u,  1147581702586717097u },
+  { 16279332111523081723u, 15269535183515560084u }, { 10174582569701926077u,  7237616480483531100u },
+  { 12718228212127407596u, 13658706619031801779u }, { 15897785265159259495u, 17073383273789752224u },
+  {  9936115790724537184u, 17588393573759676996u }, { 12420144738405671481u,  3538747893490044629u },
+  { 15525180923007089351u,  9035120885289943691u }, {  9703238076879430844u, 12564479580947296663u },
+  { 12129047596099288555u, 15705599476184120828u }, { 15161309495124110694u, 15020313326802763131u },
+  {  9475818434452569184u,  4776009810824339053u }, { 11844773043065711480u,  5970012263530423816u },
+  { 14805966303832139350u,  7462515329413029771u }, {  9253728939895087094u,    52386062455755702u },
+  { 11567161174868858867u,  9288854614924470436u }, { 14458951468586073584u,  6999382250228200141u },
+  { 18073689335732591980u,  8749227812785250177u }, { 11296055834832869987u, 14691639419845557168u },
+  { 14120069793541087484u, 13752863256379558556u }, { 17650087241926359355u, 17191079070474448196u },
+  { 11031304526203974597u,  8438581409832836170u }, { 13789130657754968246u, 15159912780718433117u },
+  { 17236413322193710308u,  9726518939043265588u }, { 10772758326371068942u, 15302446373756816800u },
+  { 13465947907963836178u,  9904685930341245193u }, { 16832434884954795223u,  3157485376071780683u },
+  { 10520271803096747014u,  8890957387685944783u }, { 13150339753870933768u,  1890324697752655170u },
+  { 16437924692338667210u,  2362905872190818963u }, { 10273702932711667006u,  6088502188546649756u },
+  { 12842128665889583757u, 16833999772538088003u }, { 16052660832361979697u,  7207441660390446292u },
+  { 10032913020226237310u, 16033866083812498692u }, { 12541141275282796638u, 10818960567910847557u },
+  { 15676426594103495798u,  4300328673033783639u }, {  9797766621314684873u, 16522763475928278486u },
+  { 12247208276643356092u,  6818396289628184396u }, { 15309010345804195115u,  8522995362035230495u },
+  {  9568131466127621947u,  3021029092058325107u }, { 11960164332659527433u, 17611344420355070096u },
+  { 14950205415824409292u,  8179122470161673908u }, {  9343878384890255807u, 14335323580705822000u },
+  { 11679847981112819759u, 13307468457454889596u }, { 14599809976391024699u, 12022649553391224092u },
+  { 18249762470488780874u, 10416625923311642211u }, { 11406101544055488046u, 11122077220497164286u },
+  { 14257626930069360058u,  4679224488766679549u }, { 17822033662586700072u, 15072402647813125244u },
+  { 11138771039116687545u,  9420251654883203278u }, { 13923463798895859431u, 16387000587031392001u },
+  { 17404329748619824289u, 15872064715361852097u }, { 10877706092887390181u,  3002511419460075705u },
+  { 13597132616109237726u,  8364825292752482535u }, { 16996415770136547158u,  1232659579085827361u },
+  { 10622759856335341973u, 14605470292210805812u }, { 13278449820419177467u,  4421779809981343554u },
+  { 16598062275523971834u,   915538744049291538u }, { 10373788922202482396u,  5183897733458195115u },
+  { 12967236152753102995u,  6479872166822743894u }, { 16209045190941378744u,  3488154190101041964u },
+  { 10130653244338361715u,  2180096368813151227u }, { 12663316555422952143u, 16560178516298602746u },
+  { 15829145694278690179u, 16088537126945865529u }, {  9893216058924181362u,  7749492695127472003u },
+  { 12366520073655226703u,   463493832054564196u }, { 15458150092069033378u, 14414425345350368957u },
+  {  9661343807543145861u, 13620701859271368502u }, { 12076679759428932327u,  3190819268807046916u },
+  { 15095849699286165408u, 17823582141290972357u }, {  9434906062053853380u, 11139738838306857723u },
+  { 11793632577567316725u, 13924673547883572154u }, { 14742040721959145907u,  3570783879572301480u },
+  { 18427550902448932383u, 18298537904747540562u }, { 11517219314030582739u, 18354115218108294707u },
+  { 14396524142538228424u, 18330958004207980480u }, { 17995655178172785531u,  4466953431550423984u },
+  { 11247284486357990957u,   486002885505321038u }, { 14059105607947488696u,  5219189625309039202u },
+  { 17573882009934360870u,  6523987031636299002u }, { 10983676256208975543u, 17912549950054850588u },
+  { 13729595320261219429u, 17779001419141175331u }, { 17161994150326524287u,  8388693718644305452u },
+  { 10726246343954077679u, 12160462601793772764u }, { 13407807929942597099u, 10588892233814828051u },
+  { 16759759912428246374u,  8624429273841147159u }, { 10474849945267653984u,   778582277723329070u },
+  { 13093562431584567480u,   973227847154161338u }, { 16366953039480709350u,  1216534808942701673u },
+  { 10229345649675443343u, 14595392310871352257u }, { 12786682062094304179u, 13632554370161802418u },
+  { 15983352577617880224u, 12429006944274865118u }, {  9989595361011175140u,  7768129340171790699u },
+  { 12486994201263968925u,  9710161675214738374u }, { 15608742751579961156u, 16749388112445810871u },
+  {  9755464219737475723u,  1244995533423855986u }, { 12194330274671844653u, 15391302472061983695u },
+  { 15242912843339805817u,  5404070034795315907u }, {  9526820527087378635u, 14906758817815542202u },
+  { 11908525658859223294u, 14021762503842039848u }, { 14885657073574029118u,  8303831092947774002u },
+  {  9303535670983768199u,   578208414664970847u }, { 11629419588729710248u, 14557818573613377271u },
+  { 14536774485912137810u, 18197273217016721589u }, { 18170968107390172263u, 13523219484416126178u },
+  { 11356855067118857664u, 15369541205401160717u }, { 14196068833898572081u,   765182433041899281u },
+  { 17745086042373215101u,  5568164059729762005u }, { 11090678776483259438u,  5785945546544795205u },
+  { 13863348470604074297u, 16455803970035769814u }, { 17329185588255092872u,  6734696907262548556u },
+  { 10830740992659433045u,  4209185567039092847u }, { 13538426240824291306u,  9873167977226253963u },
+  { 16923032801030364133u,  3118087934678041646u }, { 10576895500643977583u,  4254647968387469981u },
+  { 13221119375804971979u,   706623942056949572u }, { 16526399219756214973u, 14718337982853350677u },
+  { 10328999512347634358u, 11504804248497038125u }, { 12911249390434542948u,  5157633273766521849u },
+  { 16139061738043178685u,  6447041592208152311u }, { 10086913586276986678u,  6335244004343789146u },
+  { 12608641982846233347u, 17142427042284512241u }, { 15760802478557791684u, 16816347784428252397u },
+  {  9850501549098619803u,  1286845328412881940u }, { 12313126936373274753u, 15443614715798266137u },
+  { 15391408670466593442u,  5469460339465668959u }, {  9619630419041620901u,  8030098730593431003u },
+  { 12024538023802026126u, 14649309431669176658u }, { 15030672529752532658u,  9088264752731695015u },
+  {  9394170331095332911u, 10291851488884697288u }, { 11742712913869166139u,  8253128342678483706u },
+  { 14678391142336457674u,  5704724409920716729u }, { 18347988927920572092u, 16354277549255671720u },
+  { 11467493079950357558u,   998051431430019017u }, { 14334366349937946947u, 10470936326142299579u },
+  { 17917957937422433684u,  8476984389250486570u }, { 11198723710889021052u, 14521487280136329914u },
+  { 13998404638611276315u, 18151859100170412392u }, { 17498005798264095394u, 18078137856785627587u },
+  { 10936253623915059621u, 15910522178918405146u }, { 13670317029893824527u,  6053094668365842720u },
+  { 17087896287367280659u,  2954682317029915496u }, { 10679935179604550411u, 17987577512639554849u },
+  { 13349918974505688014u, 17872785872372055657u }, { 16687398718132110018u, 13117610303610293764u },
+  { 10429624198832568761u, 12810192458183821506u }, { 13037030248540710952u,  2177682517447613171u },
+  { 16296287810675888690u,  2722103146809516464u }, { 10185179881672430431u,  6313000485183335694u },
+  { 12731474852090538039u,  3279564588051781713u }, { 15914343565113172548u, 17934513790346890853u },
+  {  9946464728195732843u,  1985699082112030975u }, { 12433080910244666053u, 16317181907922202431u },
+  { 15541351137805832567u,  6561419329620589327u }, {  9713344461128645354u, 11018416108653950185u },
+  { 12141680576410806693u,  4549648098962661924u }, { 15177100720513508366u, 10298746142130715309u },
+  {  9485687950320942729u,  1825030320404309164u }, { 11857109937901178411u,  6892973918932774359u },
+  { 14821387422376473014u,  4004531380238580045u }, {  9263367138985295633u, 16337890167931276240u },
+  { 11579208923731619542u,  6587304654631931588u }, { 14474011154664524427u, 17457502855144690293u },
+  { 18092513943330655534u, 17210192550503474962u }, { 11307821214581659709u,  6144684325637283947u },
+  { 14134776518227074636u, 12292541425473992838u }, { 17668470647783843295u, 15365676781842491048u },
+  { 11042794154864902059u, 16521077016292638761u }, { 13803492693581127574u, 16039660251938410547u },
+  { 17254365866976409468u, 10826203278068237376u }, { 10783978666860255917u, 15989749085647424168u },
+  { 13479973333575319897u,  6152128301777116498u }, { 16849966666969149871u, 12301846395648783526u },
+  { 10531229166855718669u, 14606183024921571560u }, { 13164036458569648337u,  4422670725869800738u },
+  { 16455045573212060421u, 10140024425764638826u }, { 10284403483257537763u,  8643358275316593218u },
+  { 12855504354071922204u,  6192511825718353619u }, { 16069380442589902755u,  7740639782147942024u },
+  { 10043362776618689222u,  2532056854628769813u }, { 12554203470773361527u, 12388443105140738074u },
+  { 15692754338466701909u, 10873867862998534689u }, {  9807971461541688693u,  9102010423587778132u },
+  { 12259964326927110866u, 15989199047912110569u }, { 15324955408658888583u, 10763126773035362404u },
+  {  9578097130411805364u, 13644483260788183358u }, { 11972621413014756705u, 17055604075985229198u },
+  { 14965776766268445882u,  7484447039699372786u }, {  9353610478917778676u,  9289465418239495895u },
+  { 11692013098647223345u, 11611831772799369869u }, { 14615016373309029182u,   679731660717048624u },
+  { 18268770466636286477u, 10073036612751086588u }, { 11417981541647679048u,  8601490892183123070u },
+  { 14272476927059598810u, 10751863615228903838u }, { 17840596158824498513u,  4216457482181353989u },
+  { 11150372599265311570u, 14164500972431816003u }, { 13937965749081639463u,  8482254178684994196u },
+  { 17422457186352049329u,  5991131704928854841u }, { 10889035741470030830u, 15273672361649004036u },
+  { 13611294676837538538u,  9868718415206479237u }, { 17014118346046923173u,  3112525982153323238u },
+  { 10633823966279326983u,  4251171748059520976u }, { 13292279957849158729u,   702278666647013315u },
+  { 16615349947311448411u,  5489534351736154548u }, { 10384593717069655257u,  1125115960621402641u },
+  { 12980742146337069071u,  6018080969204141205u }, { 16225927682921336339u,  2910915193077788602u },
+  { 10141204801825835211u, 17960223060169475540u }, { 12676506002282294014u, 17838592806784456521u },
+  { 15845632502852867518u, 13074868971625794844u }, {  9903520314283042199u,  3560107088838733873u },
+  { 12379400392853802748u, 18285191916330581054u }, { 15474250491067253436u,  4409745821703674701u },
+  {  9671406556917033397u, 11979463175419572496u }, { 12089258196146291747u,  1139270913992301908u },
+  { 15111572745182864683u, 15259146697772541097u }, {  9444732965739290427u,  7231123676894144234u },
+  { 11805916207174113034u,  4427218577690292388u }, { 14757395258967641292u, 14757395258967641293u },
+  {  9223372036854775808u,                    0u }, { 11529215046068469760u,                    0u },
+  { 14411518807585587200u,                    0u }, { 18014398509481984000u,                    0u },
+  { 11258999068426240000u,                    0u }, { 14073748835532800000u,                    0u },
+  { 17592186044416000000u,                    0u }, { 10995116277760000000u,                    0u },
+  { 13743895347200000000u,                    0u }, { 17179869184000000000u,                    0u },
+  { 10737418240000000000u,                    0u }, { 13421772800000000000u,                    0u },
+  { 16777216000000000000u,                    0u }, { 10485760000000000000u,                    0u },
+  { 13107200000000000000u,                    0u }, { 16384000000000000000u,                    0u },
+  { 10240000000000000000u,                    0u }, { 12800000000000000000u,                    0u },
+  { 16000000000000000000u,                    0u }, { 10000000000000000000u,                    0u },
+  { 12500000000000000000u,                    0u }, { 15625000000000000000u,                    0u },
+  {  9765625000000000000u,                    0u }, { 12207031250000000000u,                    0u },
+  { 15258789062500000000u,                    0u }, {  9536743164062500000u,                    0u },
+  { 11920928955078125000u,                    0u }, { 14901161193847656250u,                    0u },
+  {  9313225746154785156u,  4611686018427387904u }, { 11641532182693481445u,  5764607523034234880u },
+  { 14551915228366851806u, 11817445422220181504u }, { 18189894035458564758u,  5548434740920451072u },
+  { 11368683772161602973u, 17302829768357445632u }, { 14210854715202003717u,  7793479155164643328u },
+  { 17763568394002504646u, 14353534962383192064u }, { 11102230246251565404u,  4359273333062107136u },
+  { 13877787807814456755u,  5449091666327633920u }, { 17347234759768070944u,  2199678564482154496u },
+  { 10842021724855044340u,  1374799102801346560u }, { 13552527156068805425u,  1718498878501683200u },
+  { 16940658945086006781u,  6759809616554491904u }, { 10587911840678754238u,  6530724019560251392u },
+  { 13234889800848442797u, 17386777061305090048u }, { 16543612251060553497u,  7898413271349198848u },
+  { 10339757656912845935u, 16465723340661719040u }, { 12924697071141057419u, 15970468157399760896u },
+  { 16155871338926321774u, 15351399178322313216u }, { 10097419586828951109u,  4982938468024057856u },
+  { 12621774483536188886u, 10840359103457460224u }, { 15777218104420236108u,  4327076842467049472u },
+  {  9860761315262647567u, 11927795063396681728u }, { 12325951644078309459u, 10298057810818464256u },
+  { 15407439555097886824u,  8260886245095692416u }, {  9629649721936179265u,  5163053903184807760u },
+  { 12037062152420224081u, 11065503397408397604u }, { 15046327690525280101u, 18443565265187884909u },
+  {  9403954806578300063u, 13833071299956122020u }, { 11754943508222875079u, 12679653106517764621u },
+  { 14693679385278593849u, 11237880364719817872u }, { 18367099231598242312u,   212292400617608628u },
+  { 11479437019748901445u,   132682750386005392u }, { 14349296274686126806u,  4777539456409894645u },
+  { 17936620343357658507u, 15195296357367144114u }, { 11210387714598536567u,  7191217214140771119u },
+  { 14012984643248170709u,  4377335499248575995u }, { 17516230804060213386u, 10083355392488107898u },
+  { 10947644252537633366u, 10913783138732455340u }, { 13684555315672041708u,  4418856886560793367u },
+  { 17105694144590052135u,  5523571108200991709u }, { 10691058840368782584u, 10369760970266701674u },
+  { 13363823550460978230u, 12962201212833377092u }, { 16704779438076222788u,  6979379479186945558u },
+  { 10440487148797639242u, 13585484211346616781u }, { 13050608935997049053u,  7758483227328495169u },
+  { 16313261169996311316u, 14309790052588006865u }, { 10195788231247694572u, 18166990819722280098u },
+  { 12744735289059618216u,  4261994450943298507u }, { 15930919111324522770u,  5327493063679123134u },
+  {  9956824444577826731u,  7941369183226839863u }, { 12446030555722283414u,  5315025460606161924u },
+  { 15557538194652854267u, 15867153862612478214u }, {  9723461371658033917u,  7611128154919104931u },
+  { 12154326714572542396u, 14125596212076269068u }, { 15192908393215677995u, 17656995265095336336u },
+  {  9495567745759798747u,  8729779031470891258u }, { 11869459682199748434u,  6300537770911226168u },
+  { 14836824602749685542u, 17099044250493808518u }, {  9273015376718553464u,  6075216638131242420u },
+  { 11591269220898191830u,  7594020797664053025u }, { 14489086526122739788u,   269153960225290473u },
+  { 18111358157653424735u,   336442450281613091u }, { 11319598848533390459u,  7127805559067090038u },
+  { 14149498560666738074u,  4298070930406474644u }, { 17686873200833422592u, 14595960699862869113u },
+  { 11054295750520889120u,  9122475437414293195u }, { 13817869688151111400u, 11403094296767866494u },
+  { 17272337110188889250u, 14253867870959833118u }, { 10795210693868055781u, 13520353437777283602u },
+  { 13494013367335069727u,  3065383741939440791u }, { 16867516709168837158u, 17666787732706464701u },
+  { 10542197943230523224u,  6430056314514152534u }, { 13177747429038154030u,  8037570393142690668u },
+  { 16472184286297692538u,   823590954573587527u }, { 10295115178936057836u,  5126430365035880108u },
+  { 12868893973670072295u,  6408037956294850135u }, { 16086117467087590369u,  3398361426941174765u },
+  { 10053823416929743980u, 13653190937906703988u }, { 12567279271162179975u, 17066488672383379985u },
+  { 15709099088952724969u, 16721424822051837077u }, {  9818186930595453106u,  3533361486141316317u },
+  { 12272733663244316382u, 13640073894531421205u }, { 15340917079055395478u,  7826720331309500698u },
+  {  9588073174409622174u,   280014188641050032u }, { 11985091468012027717u,  9573389772656088348u },
+  { 14981364335015034646u, 16578423234247498339u }, {  9363352709384396654u,  5749828502977298558u },
+  { 11704190886730495817u, 16410657665576399005u }, { 14630238608413119772u,  6678264026688335045u },
+  { 18287798260516399715u,  8347830033360418806u }, { 11429873912822749822u,  2911550761636567802u },
+  { 14287342391028437277u, 12862810488900485560u }, { 17859177988785546597u,  2243455055843443238u },
+  { 11161986242990966623u,  3708002419115845976u }, { 13952482803738708279u,    23317005467419566u },
+  { 17440603504673385348u, 13864204312116438170u }, { 10900377190420865842u, 17888499731927549664u },
+  { 13625471488026082303u, 13137252628054661272u }, { 17031839360032602879u, 11809879766640938686u },
+  { 10644899600020376799u, 14298703881791668535u }, { 13306124500025470999u, 13261693833812197764u },
+  { 16632655625031838749u, 11965431273837859301u }, { 10395409765644899218u,  9784237555362356015u },
+  { 12994262207056124023u,  3006924907348169211u }, { 16242827758820155028u, 17593714189467375226u },
+  { 10151767349262596893u,  1772699331562333708u }, { 12689709186578246116u,  6827560182880305039u },
+  { 15862136483222807645u,  8534450228600381299u }, {  9913835302014254778u,  7639874402088932264u },
+  { 12392294127517818473u,   326470965756389522u }, { 15490367659397273091u,  5019774725622874806u },
+  {  9681479787123295682u,   831516194300602802u }, { 12101849733904119602u, 10262767279730529310u },
+  { 15127312167380149503u,  3605087062808385830u }, {  9454570104612593439u,  9170708441896323000u },
+  { 11818212630765741799u,  6851699533943015846u }, { 14772765788457177249u,  3952938399001381903u },
+  {  9232978617785735780u, 13999801545444333449u }, { 11541223272232169725u, 17499751931805416812u },
+  { 14426529090290212157u,  8039631859474607303u }, { 18033161362862765196u, 14661225842770647033u },
+  { 11270725851789228247u, 18386638188586430203u }, { 14088407314736535309u, 18371611717305649850u },
+  { 17610509143420669137u,  9129456591349898601u }, { 11006568214637918210u, 17235125415662156385u },
+  { 13758210268297397763u, 12320534732722919674u }, { 17197762835371747204u, 10788982397476261688u },
+  { 10748601772107342002u, 15966486035277439363u }, { 13435752215134177503u, 10734735507242023396u },
+  { 16794690268917721879u,  8806733365625141341u }, { 10496681418073576174u, 12421737381156795194u },
+  { 13120851772591970218u,  6303799689591218185u }, { 16401064715739962772u, 17103121648843798539u },
+  { 10250665447337476733u,  1466078993672598279u }, { 12813331809171845916u,  6444284760518135752u },
+  { 16016664761464807395u,  8055355950647669691u }, { 10010415475915504622u,  2728754459941099604u },
+  { 12513019344894380777u, 12634315111781150314u }, { 15641274181117975972u,  1957835834444274180u },
+  {  9775796363198734982u, 10447019433382447170u }, { 12219745453998418728u,  3835402254873283155u },
+  { 15274681817498023410u,  4794252818591603944u }, {  9546676135936264631u,  7608094030047140369u },
+  { 11933345169920330789u,  4898431519131537557u }, { 14916681462400413486u, 10734725417341809851u },
+  {  9322925914000258429u,  2097517367411243253u }, { 11653657392500323036u,  7233582727691441970u },
+  { 14567071740625403795u,  9041978409614302462u }, { 18208839675781754744u,  6690786993590490174u },
+  { 11380524797363596715u,  4181741870994056359u }, { 14225655996704495894u,   615491320315182544u },
+  { 17782069995880619867u,  9992736187248753989u }, { 11113793747425387417u,  3939617107816777291u },
+  { 13892242184281734271u,  9536207403198359517u }, { 17365302730352167839u,  7308573235570561493u },
+  { 10853314206470104899u, 11485387299872682789u }, { 13566642758087631124u,  9745048106413465582u },
+  { 16958303447609538905u, 12181310133016831978u }, { 10598939654755961816u,   695789805494438130u },
+  { 13248674568444952270u,   869737256868047663u }, { 16560843210556190337u, 10310543607939835386u },
+  { 10350527006597618960u, 17973304801030866876u }, { 12938158758247023701u,  4019886927579031980u },
+  { 16172698447808779626u,  9636544677901177879u }, { 10107936529880487266u, 10634526442115624078u },
+  { 12634920662350609083u,  4069786015789754290u }, { 15793650827938261354u,   475546501309804958u },
+  {  9871031767461413346u,  4908902581746016003u }, { 12338789709326766682u, 15359500264037295811u },
+  { 15423487136658458353u,  9976003293191843956u }, {  9639679460411536470u, 17764217104313372233u },
+  { 12049599325514420588u, 12981899343536939483u }, { 15061999156893025735u, 16227374179421174354u },
+  {  9413749473058141084u, 17059637889779315827u }, { 11767186841322676356u,  2877803288514593168u },
+  { 14708983551653345445u,  3597254110643241460u }, { 18386229439566681806u,  9108253656731439729u },
+  { 11491393399729176129u,  1080972517029761926u }, { 14364241749661470161u,  5962901664714590312u },
+  { 17955302187076837701u, 12065313099320625794u }, { 11222063866923023563u,  9846663696289085073u },
+  { 14027579833653779454u,  7696643601933968437u }, { 17534474792067224318u,   397432465562684739u },
+  { 10959046745042015198u, 14083453346258841674u }, { 13698808431302518998u,  8380944645968776284u },
+  { 17123510539128148748u,  1252808770606194547u }, { 10702194086955092967u, 10006377518483647400u },
+  { 13377742608693866209u,  7896285879677171346u }, { 16722178260867332761u, 14482043368023852087u },
+  { 10451361413042082976u,  2133748077373825698u }, { 13064201766302603720u,  2667185096717282123u },
+  { 16330252207878254650u,  3333981370896602653u }, { 10206407629923909156u,  6695424375237764562u },
+  { 12758009537404886445u,  8369280469047205703u }, { 15947511921756108056u, 15073286604736395033u },
+  {  9967194951097567535u,  9420804127960246895u }, { 12458993688871959419u,  7164319141522920715u },
+  { 15573742111089949274u,  4343712908476262990u }, {  9733588819431218296u,  7326506586225052273u },
+  { 12166986024289022870u,  9158133232781315341u }, { 15208732530361278588u,  2224294504121868368u },
+  {  9505457831475799117u, 10613556101930943538u }, { 11881822289344748896u, 17878631145841067327u },
+  { 14852277861680936121u,  3901544858591782542u }, {  9282673663550585075u, 13967680582688333849u },
+  { 11603342079438231344u, 12847914709933029407u }, { 14504177599297789180u, 16059893387416286759u },
+  { 18130221999122236476u,  1628122660560806833u }, { 11331388749451397797u, 10240948699705280078u },
+  { 14164235936814247246u, 17412871893058988002u }, { 17705294921017809058u, 12542717829468959195u },
+  { 11065809325636130661u, 12450884661845487401u }, { 13832261657045163327u,  1728547772024695539u },
+  { 17290327071306454158u, 15995742770313033136u }, { 10806454419566533849u,  5385653213018257806u },
+  { 13508068024458167311u, 11343752534700210161u }, { 16885085030572709139u,  9568004649947874797u },
+  { 10553178144107943212u,  3674159897003727796u }, { 13191472680134929015u,  4592699871254659745u },
+  { 16489340850168661269u,  1129188820640936778u }, { 10305838031355413293u,  3011586022114279438u },
+  { 12882297539194266616u,  8376168546070237202u }, { 16102871923992833270u, 10470210682587796502u },
+  { 10064294952495520794u,  1932195658189984910u }, { 12580368690619400992u, 11638616609592256945u },
+  { 15725460863274251240u, 14548270761990321182u }, {  9828413039546407025u,  9092669226243950738u },
+  { 12285516299433008781u, 15977522551232326327u }, { 15356895374291260977u,  6136845133758244197u },
+  {  9598059608932038110u, 15364743254667372383u }, { 11997574511165047638u,  9982557031479439671u },
+  { 14996968138956309548u,  3254824252494523781u }, {  9373105086847693467u, 11257637194663853171u },
+  { 11716381358559616834u,  9460360474902428559u }, { 14645476698199521043u,  2602078556773259891u },
+  { 18306845872749401303u, 17087656251248738576u }, { 11441778670468375814u, 17597314184671543466u },
+  { 14302223338085469768u, 12773270693984653525u }, { 17877779172606837210u, 15966588367480816906u },
+  { 11173611982879273256u, 14590803748102898470u }, { 13967014978599091570u, 18238504685128623088u },
+  { 17458768723248864463u, 13574758819556003052u }, { 10911730452030540289u, 15401753289863583763u },
+  { 13639663065038175362u,  5417133557047315992u }, { 17049578831297719202u, 15994788983163920798u },
+  { 10655986769561074501u, 14608429132904838403u }, { 13319983461951343127u,  4425478360848884291u },
+  { 16649979327439178909u,   920161932633717460u }, { 10406237079649486818u,  2880944217109767365u },
+  { 13007796349561858522u, 12824552308241985014u }, { 16259745436952323153u,  6807318348447705459u },
+  { 10162340898095201970u, 15783789013848285672u }, { 12702926122619002463u, 10506364230455581282u },
+  { 15878657653273753079u,  8521269269642088699u }, {  9924161033296095674u, 12243322321167387293u },
+  { 12405201291620119593u,  6080780864604458308u }, { 15506501614525149491u, 12212662099182960789u },
+  {  9691563509078218432u,  5327070802775656541u }, { 12114454386347773040u,  6658838503469570676u },
+  { 15143067982934716300u,  8323548129336963345u }, {  9464417489334197687u, 14425589617690377899u },
+  { 11830521861667747109u, 13420301003685584469u }, { 14788152327084683887u,  2940318199324816875u },
+  {  9242595204427927429u,  8755227902219092403u }, { 11553244005534909286u, 15555720896201253407u },
+  { 14441555006918636608u, 10221279083396790951u }, { 18051943758648295760u, 12776598854245988689u },
+  { 11282464849155184850u,  7985374283903742931u }, { 14103081061443981063u,   758345818024902856u },
+  { 17628851326804976328u, 14782990327813292282u }, { 11018032079253110205u,  9239368954883307676u },
+  { 13772540099066387756u, 16160897212031522499u }, { 17215675123832984696u,  1754377441329851508u },
+  { 10759796952395615435u,  1096485900831157192u }, { 13449746190494519293u, 15205665431321110202u },
+  { 16812182738118149117u,  5172023733869224041u }, { 10507614211323843198u,  5538357842881958977u },
+  { 13134517764154803997u, 16146319340457224530u }, { 16418147205193504997u,  6347841120289366950u },
+  { 10261342003245940623u,  6273243709394548296u }
+};
+
+// clang-format on
+
+// The Eisel-Lemire algorithm computes the _FloatingType nearest to _Decimal_mantissa * 10^_Decimal_exponent, for a
+// nonzero _Decimal_mantissa, from a 128-bit approximation of 5^_Decimal_exponent. It stores the bits of the result and
+// returns true, except in the rare cases where the approximation can't decide the rounding and in the cases where the
+// result overflows or underflows; callers fall back to an exact conversion for those.
+template <class _FloatingType>
+_NODISCARD bool _Eisel_lemire(uint64_t _Decimal_mantissa, const int32_t _Decimal_exponent,
+    typename _Floating_type_traits<_FloatingType>::_Uint_type& _Bits) noexcept {
+    using _Traits    = _Floating_type_traits<_FloatingType>;
+    using _Uint_type = typename _Traits::_Uint_type;
+
+    constexpr int32_t _Explicit_bits = _Traits::_Mantissa_bits - 1;
+
+    // A product can be exactly halfway between two representable values only for these decimal exponents:
+    constexpr int32_t _Min_round_to_even_exponent = _Traits::_Mantissa_bits == 53 ? -4 : -17;
+    constexpr int32_t _Max_round_to_even_exponent = _Traits::_Mantissa_bits == 53 ? 23 : 10;
+
+    if (_Decimal_exponent < _Eisel_lemire_min_power || _Decimal_exponent > _Eisel_lemire_max_power) {
+        return false;
+    }
+
+    const uint32_t _Leading_zeroes = 64 - _Bit_scan_reverse(_Decimal_mantissa);
+    _Decimal_mantissa <<= _Leading_zeroes;
+
+    const uint64_t* const _Power = _Eisel_lemire_pow5_128[_Decimal_exponent - _Eisel_lemire_min_power];
+    uint64_t _High;
+    uint64_t _Low = __ryu_umul128(_Decimal_mantissa, _Power[0], &_High);
+
+    // The low half of the power of five can matter only if it may carry into the bits that are kept:
+    constexpr uint64_t _Precision_mask = UINT64_MAX >> (_Explicit_bits + 3);
+    if ((_High & _Precision_mask) == _Precision_mask) {
+        uint64_t _Second_high;
+        (void) __ryu_umul128(_Decimal_mantissa, _Power[1], &_Second_high);
+        _Low += _Second_high;
+        _High += _Low < _Second_high;
+
+        if (_Low == UINT64_MAX && (_Decimal_exponent < -27 || _Decimal_exponent > 55)) {
+            return false; // the truncated power of five might be too inaccurate to round correctly
+        }
+    }
+
+    const uint32_t _Upper_bit = static_cast<uint32_t>(_High >> 63);
+    const uint32_t _Shift     = _Upper_bit + 64 - _Explicit_bits - 3;
+    uint64_t _Mantissa        = _High >> _Shift;
+
+    // ((217706 * q) >> 16) is floor(log2(10^q)) for q in [-342, 308]
+    int32_t _Binary_exponent = ((217706 * _Decimal_exponent) >> 16) + 63 + static_cast<int32_t>(_Upper_bit)
+                             - static_cast<int32_t>(_Leading_zeroes) + _Traits::_Exponent_bias;
+
+    if (_Binary_exponent <= 0) { // subnormal
+        if (-_Binary_exponent + 1 >= 64) {
+            return false; // underflow
+        }
+
+        _Mantissa >>= -_Binary_exponent + 1;
+        _Mantissa += _Mantissa & 1;
+        _Mantissa >>= 1;
+        if (_Mantissa == 0) {
+            return false; // underflow
+        }
+
+        // if rounding carried into the exponent field, this is the smallest normal value, as it should be
+        _Bits = static_cast<_Uint_type>(_Mantissa);
+        return true;
+    }
+
+    if (_Low <= 1 && _Decimal_exponent >= _Min_round_to_even_exponent
+        && _Decimal_exponent <= _Max_round_to_even_exponent && (_Mantissa & 3) == 1
+        && (_Mantissa << _Shift) == _High) {
+        _Mantissa &= ~uint64_t{1}; // exactly halfway, and the lower neighbor is even
+    }
+
+    _Mantissa += _Mantissa & 1;
+    _Mantissa >>= 1;
+    if (_Mantissa >= (uint64_t{2} << _Explicit_bits)) {
+        _Mantissa = uint64_t{1} << _Explicit_bits;
+        ++_Binary_exponent;
+    }
+
+    if (_Binary_exponent >= static_cast<int32_t>(_Traits::_Exponent_mask)) {
+        return false; // overflow
+    }
+
+    _Mantissa &= ~(uint64_t{1} << _Explicit_bits);
+    _Bits = static_cast<_Uint_type>(_Mantissa | (static_cast<uint64_t>(_Binary_exponent) << _Explicit_bits));
+    return true;
+}
+
+_STD_END
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // _XCHARCONV_TABLES_H
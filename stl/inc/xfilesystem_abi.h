@@ -41,7 +41,10 @@ enum class __std_win_error : unsigned long {
     _Directory_not_empty       = 145, // #define ERROR_DIR_NOT_EMPTY              145L
     _Already_exists            = 183, // #define ERROR_ALREADY_EXISTS             183L
     _Filename_exceeds_range    = 206, // #define ERROR_FILENAME_EXCED_RANGE       206L
+    _Wait_timeout              = 258, // #define WAIT_TIMEOUT                     258L
     _Directory_name_is_invalid = 267, // #define ERROR_DIRECTORY                  267L
+    _Notify_enum_dir           = 1022, // #define ERROR_NOTIFY_ENUM_DIR            1022L
+    _Request_aborted           = 1235, // #define ERROR_REQUEST_ABORTED            1235L
     _Max                       = ~0UL // sentinel not used by Win32
 };
 
@@ -229,6 +232,46 @@ enum class __std_fs_copy_options {
 
 _BITMASK_OPS(__std_fs_copy_options)
 
+enum class __std_fs_copy_file_flags : unsigned long {
+    _None         = 0,
+    _No_buffering = 0x00001000, // #define COPY_FILE_NO_BUFFERING           0x00001000
+};
+
+_BITMASK_OPS(__std_fs_copy_file_flags)
+
+enum class __std_fs_watch_filter : unsigned long { // FILE_NOTIFY_CHANGE_*
+    _None        = 0,
+    _File_name   = 0x0001, // FILE_NOTIFY_CHANGE_FILE_NAME
+    _Dir_name    = 0x0002, // FILE_NOTIFY_CHANGE_DIR_NAME
+    _Attributes  = 0x0004, // FILE_NOTIFY_CHANGE_ATTRIBUTES
+    _Size        = 0x0008, // FILE_NOTIFY_CHANGE_SIZE
+    _Last_write  = 0x0010, // FILE_NOTIFY_CHANGE_LAST_WRITE
+    _Last_access = 0x0020, // FILE_NOTIFY_CHANGE_LAST_ACCESS
+    _Creation    = 0x0040, // FILE_NOTIFY_CHANGE_CREATION
+    _Security    = 0x0100 // FILE_NOTIFY_CHANGE_SECURITY
+};
+
+_BITMASK_OPS(__std_fs_watch_filter)
+
+enum class __std_fs_change_action : unsigned long { // FILE_ACTION_*
+    _Added            = 1, // FILE_ACTION_ADDED
+    _Removed          = 2, // FILE_ACTION_REMOVED
+    _Modified         = 3, // FILE_ACTION_MODIFIED
+    _Renamed_old_name = 4, // FILE_ACTION_RENAMED_OLD_NAME
+    _Renamed_new_name = 5 // FILE_ACTION_RENAMED_NEW_NAME
+};
+
+struct __std_fs_change_record {
+    __std_fs_change_action _Action;
+    __std_fs_stats_flags _Available; // which of the fields below were reported with the change
+    __std_fs_file_attr _Attributes;
+    __std_fs_reparse_tag _Reparse_point_tag;
+    unsigned long long _File_size;
+    __std_fs_filetime _Last_write_time;
+    const wchar_t* _Name; // relative to the watched directory, not null-terminated
+    unsigned long _Name_length;
+};
+
 _EXTERN_C
 _NODISCARD __std_ulong_and_error __stdcall __std_fs_get_full_path_name(_In_z_ const wchar_t* _Source,
     _In_ unsigned long _Target_size, _Out_writes_z_(_Target_size) wchar_t* _Target) noexcept;
@@ -255,6 +298,15 @@ struct __std_fs_copy_file_result {
 _NODISCARD __std_fs_copy_file_result __stdcall __std_fs_copy_file(
     _In_z_ const wchar_t* _Source, _In_z_ const wchar_t* _Target, _In_ __std_fs_copy_options _Options) noexcept;
 
+// called after each chunk with the bytes copied so far and the size of the file; returning false cancels the copy,
+// which then fails with __std_win_error::_Request_aborted
+using __std_fs_copy_file_progress = bool(__stdcall*)(
+    unsigned long long _Copied, unsigned long long _Total, void* _Context) noexcept;
+
+_NODISCARD __std_fs_copy_file_result __stdcall __std_fs_copy_file_ex(_In_z_ const wchar_t* _Source,
+    _In_z_ const wchar_t* _Target, _In_ __std_fs_copy_options _Options, _In_ __std_fs_copy_file_flags _Flags,
+    _In_opt_ __std_fs_copy_file_progress _Progress, _Inout_opt_ void* _Context) noexcept;
+
 _NODISCARD __std_win_error __stdcall __std_fs_directory_iterator_open(_In_z_ const wchar_t* _Path_spec,
     _Inout_ __std_fs_dir_handle* _Handle, _Out_ __std_fs_find_data* _Results) noexcept;
 
@@ -328,15 +380,51 @@ struct __std_fs_remove_result {
     __std_win_error _Error;
 };
 
+struct __std_fs_remove_tree_result {
+    unsigned long long _Removed;
+    __std_win_error _Error;
+};
+
 _NODISCARD __std_fs_remove_result __stdcall __std_fs_remove(_In_z_ const wchar_t* _Target) noexcept;
 
+// returns __std_win_error::_Not_supported when the file system can't open files by ID; _Removed counts what was removed
+// before that, and the rest of the tree is left to be removed by name
+_NODISCARD __std_fs_remove_tree_result __stdcall __std_fs_remove_directory_tree(_In_z_ const wchar_t* _Target) noexcept;
+
 _NODISCARD __std_win_error __stdcall __std_fs_rename(
     _In_z_ const wchar_t* _Source, _In_z_ const wchar_t* _Target) noexcept;
 
 _NODISCARD __std_win_error __stdcall __std_fs_resize_file(_In_z_ const wchar_t* _Target, uintmax_t _New_size) noexcept;
 
+_NODISCARD __std_win_error __stdcall __std_fs_set_allocation_size(
+    _In_z_ const wchar_t* _Target, unsigned long long _Size) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_set_sparse(_In_z_ const wchar_t* _Target, bool _Sparse) noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_set_valid_data_length(
+    _In_z_ const wchar_t* _Target, unsigned long long _Length) noexcept;
+
 _NODISCARD __std_win_error __stdcall __std_fs_space(_In_z_ const wchar_t* _Target, _Out_ uintmax_t* _Available,
     _Out_ uintmax_t* _Total_bytes, _Out_ uintmax_t* _Free_bytes) noexcept;
+
+struct __std_fs_watch; // a directory handle with an outstanding change notification request
+
+_NODISCARD __std_win_error __stdcall __std_fs_watch_open(_Out_ __std_fs_watch** _Watch, _In_z_ const wchar_t* _Path,
+    _In_ __std_fs_watch_filter _Filter, _In_ bool _Recursive) noexcept;
+
+// waits up to _Timeout_ms for the next batch of changes, whose records __std_fs_watch_next_change then returns until
+// the next wait; returns _Wait_timeout, _Request_aborted after __std_fs_watch_cancel, or _Notify_enum_dir when changes
+// were lost and the directory must be rescanned
+_NODISCARD __std_win_error __stdcall __std_fs_watch_wait(
+    _Inout_ __std_fs_watch* _Watch, _In_ unsigned long _Timeout_ms) noexcept;
+
+_NODISCARD bool __stdcall __std_fs_watch_next_change(
+    _Inout_ __std_fs_watch* _Watch, _Out_ __std_fs_change_record* _Record) noexcept;
+
+// wakes one wait, or the next one to start; may be called from any thread
+void __stdcall __std_fs_watch_cancel(_Inout_ __std_fs_watch* _Watch) noexcept;
+
+void __stdcall __std_fs_watch_close(_In_opt_ __std_fs_watch* _Watch) noexcept;
 _END_EXTERN_C
 
 _STD_BEGIN
@@ -98,6 +98,13 @@ int __cdecl _Smtx_try_lock_shared(_Smtx_t*);
 void __cdecl _Smtx_unlock_exclusive(_Smtx_t*);
 void __cdecl _Smtx_unlock_shared(_Smtx_t*);
 
+// condition variable for shared mutexes locked exclusively
+// these declarations must be in sync with those in sharedmutex.cpp
+using _Cnd_srw_t = void*;
+int __cdecl _Cnd_srw_wait(_Cnd_srw_t*, _Smtx_t*, unsigned long); // returns 0 on timeout
+void __cdecl _Cnd_srw_signal(_Cnd_srw_t*);
+void __cdecl _Cnd_srw_broadcast(_Cnd_srw_t*);
+
 // condition variables
 _CRTIMP2_PURE int __cdecl _Cnd_init(_Cnd_t*);
 _CRTIMP2_PURE void __cdecl _Cnd_destroy(_Cnd_t);
@@ -34,6 +34,21 @@ _CRTIMP2_PURE long long __cdecl _Xtime_get_ticks();
 _CRTIMP2_PURE long long __cdecl _Query_perf_counter();
 _CRTIMP2_PURE long long __cdecl _Query_perf_frequency();
 
+// GetTickCount64(), in milliseconds
+_NODISCARD long long __stdcall __std_coarse_steady_clock_ticks() noexcept;
+
+// converts readings of the time stamp counter to nanoseconds on the scale of steady_clock::now():
+// _Nsec_base + (((reading - _Tsc_base) * _Multiplier) >> 32)
+struct __std_tsc_calibration {
+    unsigned long long _Tsc_base;
+    long long _Nsec_base;
+    unsigned long long _Multiplier;
+};
+
+// calibrates the time stamp counter against QueryPerformanceCounter for 10 ms on the first call; returns nullptr if
+// the processor has no invariant time stamp counter
+_NODISCARD const __std_tsc_calibration* __stdcall __std_tsc_calibrate() noexcept;
+
 _END_EXTERN_C
 
 #pragma pop_macro("new")
@@ -152,23 +152,43 @@ _STL_DISABLE_CLANG_WARNINGS
 #endif // _ALLOW_RUNTIME_LIBRARY_MISMATCH
 #endif // __cplusplus
 
+// _MSVC_STL_HARDENING enables the constant-time precondition checks of _CONTAINER_DEBUG_LEVEL (subscripts, front and
+// back, span and string_view bounds, optional access) at any _ITERATOR_DEBUG_LEVEL, without the iterator tracking of
+// _ITERATOR_DEBUG_LEVEL 2. Outside of _DEBUG builds a failed check ends the process with __fastfail. The checks don't
+// change the layout of any type, so hardened and unhardened translation units can be mixed.
+#ifndef _MSVC_STL_HARDENING
+#define _MSVC_STL_HARDENING 0
+#endif // _MSVC_STL_HARDENING
+
 #ifndef _CONTAINER_DEBUG_LEVEL
-#if _ITERATOR_DEBUG_LEVEL == 0
+#if _ITERATOR_DEBUG_LEVEL == 0 && !_MSVC_STL_HARDENING
 #define _CONTAINER_DEBUG_LEVEL 0
-#else // ^^^ _ITERATOR_DEBUG_LEVEL == 0 // _ITERATOR_DEBUG_LEVEL != 0 vvv
+#else // ^^^ _ITERATOR_DEBUG_LEVEL == 0 && !_MSVC_STL_HARDENING // _ITERATOR_DEBUG_LEVEL != 0 || _MSVC_STL_HARDENING vvv
 #define _CONTAINER_DEBUG_LEVEL 1
-#endif // _ITERATOR_DEBUG_LEVEL == 0
+#endif // _ITERATOR_DEBUG_LEVEL == 0 && !_MSVC_STL_HARDENING
 #endif // _CONTAINER_DEBUG_LEVEL
 
 #if _ITERATOR_DEBUG_LEVEL != 0 && _CONTAINER_DEBUG_LEVEL == 0
 #error _ITERATOR_DEBUG_LEVEL != 0 must imply _CONTAINER_DEBUG_LEVEL == 1.
 #endif // _ITERATOR_DEBUG_LEVEL != 0 && _CONTAINER_DEBUG_LEVEL == 0
 
+#if _MSVC_STL_HARDENING && _CONTAINER_DEBUG_LEVEL == 0
+#error _MSVC_STL_HARDENING must imply _CONTAINER_DEBUG_LEVEL == 1.
+#endif // _MSVC_STL_HARDENING && _CONTAINER_DEBUG_LEVEL == 0
+
+#if _MSVC_STL_HARDENING && !defined(_DEBUG) && !defined(_M_CEE)
+extern "C" __declspec(noreturn) void __fastfail(unsigned int);
+
+#define _STL_FAST_FAIL_INVALID_ARG 5 // FAST_FAIL_INVALID_ARG from <winnt.h>
+
+#define _STL_REPORT_ERROR(mesg) __fastfail(_STL_FAST_FAIL_INVALID_ARG)
+#else // ^^^ hardened release ^^^ // vvv other configurations vvv
 #define _STL_REPORT_ERROR(mesg)              \
     do {                                     \
         _RPTF0(_CRT_ASSERT, mesg);           \
         _CRT_SECURE_INVALID_PARAMETER(mesg); \
     } while (false)
+#endif // ^^^ other configurations ^^^
 
 #ifdef __clang__
 #define _STL_VERIFY(cond, mesg)                                                            \
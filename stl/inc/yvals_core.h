@@ -143,6 +143,7 @@
 //     (partially implemented)
 // P0356R5 bind_front()
 // P0357R3 Supporting Incomplete Types In reference_wrapper
+// P0401R6 Providing Size Feedback In The Allocator Interface
 // P0408R7 Efficient Access To basic_stringbuf's Buffer
 // P0415R1 constexpr For <complex> (Again)
 // P0439R0 enum class memory_order
@@ -163,6 +164,9 @@
 // P0608R3 Improving variant's Converting Constructor/Assignment
 // P0616R0 Using move() In <numeric>
 // P0631R8 <numbers> Math Constants
+// P0645R10 <format> Text Formatting
+//     (locale-specific formatting is not yet implemented; the width of a string is estimated as its number of code
+//     points)
 // P0646R1 list/forward_list remove()/remove_if()/unique() Return size_type
 // P0653R2 to_address()
 // P0655R1 visit<R>()
@@ -197,6 +201,8 @@
 // P1115R3 erase()/erase_if() Return size_type
 // P1123R0 Atomic Compare-And-Exchange With Padding Bits For atomic_ref
 // P1135R6 The C++20 Synchronization Library
+// P1206R7 Conversions From Ranges To Containers
+//     (ranges::to only; containers do not yet have from_range_t constructors)
 // P1207R4 Movability Of Single-Pass Iterators
 //     (partially implemented)
 // P1209R0 erase_if(), erase()
@@ -223,6 +229,7 @@
 // P1871R1 disable_sized_sentinel_for
 // P1872R0 span Should Have size_type, Not index_type
 // P1878R1 Constraining Readable Types
+// P1899R3 views::stride
 // P1907R2 ranges::ssize
 // P1956R1 <bit> has_single_bit(), bit_ceil(), bit_floor(), bit_width()
 // P1959R0 Removing weak_equality And strong_equality
@@ -233,11 +240,19 @@
 // P2091R0 Fixing Issues With Range Access CPOs
 // P2102R0 Making "Implicit Expression Variations" More Explicit
 // P2116R0 Removing tuple-Like Protocol Support From Fixed-Extent span
+// P2210R2 Superior String Splitting
+// P2216R3 std::format Improvements
+// P2442R1 Windowing Range Adaptors: views::chunk, views::slide
+//     (chunk_view over input-only ranges not yet implemented)
 // P????R? directory_entry::clear_cache()
 
 // _HAS_CXX20 indirectly controls:
 // P0619R4 Removing C++17-Deprecated Features
 
+// _HAS_CXX23 directly controls:
+// P0401R6 Providing Size Feedback In The Allocator Interface
+//     (geometric growth of vector, stdext::small_vector, and basic_string through allocate_at_least)
+
 // _HAS_CXX20 and _SILENCE_ALL_CXX20_DEPRECATION_WARNINGS control:
 // P0767R1 Deprecating is_pod
 // P1831R1 Deprecating volatile In The Standard Library
@@ -559,6 +574,15 @@
 #define _CONSTEXPR20 inline
 #endif // ^^^ inline (not constexpr) in C++17 and earlier ^^^
 
+// /std:c++latest sets _MSVC_LANG beyond the C++20 value, 202002L
+#ifndef _HAS_CXX23
+#if _HAS_CXX20 && defined(_MSVC_LANG) && _MSVC_LANG > 202002L
+#define _HAS_CXX23 1
+#else // ^^^ C++23 / C++20 and earlier vvv
+#define _HAS_CXX23 0
+#endif // ^^^ C++20 and earlier ^^^
+#endif // _HAS_CXX23
+
 // P0607R0 Inline Variables For The STL
 #if _HAS_CXX17
 #define _INLINE_VAR inline
@@ -594,6 +618,13 @@
 #define _HAS_FUNCTION_ALLOCATOR_SUPPORT (!_HAS_CXX17)
 #endif // _HAS_FUNCTION_ALLOCATOR_SUPPORT
 
+// P0919R3 Heterogeneous Lookup For Unordered Containers
+// P1690R1 Refining Heterogeneous Lookup For Unordered Containers
+// Defining this to 1 also enables transparent find(), count(), and equal_range() in C++14 and C++17 as an extension.
+#ifndef _HAS_HETEROGENEOUS_UNORDERED_LOOKUP
+#define _HAS_HETEROGENEOUS_UNORDERED_LOOKUP _HAS_CXX20
+#endif // _HAS_HETEROGENEOUS_UNORDERED_LOOKUP
+
 // The non-Standard std::tr1 namespace and TR1-only machinery
 #ifndef _HAS_TR1_NAMESPACE
 #define _HAS_TR1_NAMESPACE (!_HAS_CXX17)
@@ -637,12 +668,44 @@
     "Either use a Standard specialization or define _ENFORCE_FACET_SPECIALIZATIONS=0 " \
     "to suppress this diagnostic."
 
+// Lemire's multiply-shift reduction in uniform_int_distribution, shuffle, sample, and their ranges counterparts; off
+// by default, because it changes the values that a given seed produces
+#ifndef _USE_NEARLY_DIVISIONLESS_RANDOM_RANGES
+#define _USE_NEARLY_DIVISIONLESS_RANDOM_RANGES 0
+#endif // _USE_NEARLY_DIVISIONLESS_RANDOM_RANGES
+
 // To improve compiler throughput, use 'hidden friend' operators in <system_error> instead of non-members that are
 // depicted in the Standard.
 #ifndef _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS
 #define _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS 1
 #endif // _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS
 
+// Controls whether unordered containers with at least 512 buckets grow by splitting a few buckets per insertion
+// (linear hashing) instead of rehashing every element in the insertion that exceeds max_load_factor(). This bounds the
+// worst-case insertion latency of large containers. A partially split container can be read and modified by code built
+// either way, but not by code built with older STLs, so this must not be enabled for containers passed across such a
+// boundary.
+#ifndef _STL_INCREMENTAL_HASH_REHASH
+#define _STL_INCREMENTAL_HASH_REHASH 0
+#endif // _STL_INCREMENTAL_HASH_REHASH
+
+// Controls whether the nodes of map, multimap, set, and multiset with allocators that use raw pointers keep the
+// red-black color and the head node flag in the low bits of the parent link, instead of in two chars that alignment
+// pads to a pointer-sized word. This saves 8 bytes per node of set<uint64_t> or map<int, int> on 64-bit platforms. It
+// changes the layout of the nodes, so all code that shares such containers must be built the same way, which the linker
+// checks unless _ALLOW_COMPACT_TREE_NODES_MISMATCH is defined.
+#ifndef _STL_COMPACT_TREE_NODES
+#define _STL_COMPACT_TREE_NODES 0
+#endif // _STL_COMPACT_TREE_NODES
+
+// Controls whether to_chars() with chars_format::fixed or chars_format::scientific and a precision computes digits that
+// the shortest round-trip tables can't provide with big integer arithmetic, instead of with about 100 KB of tables.
+// This trades speed for binary size. Small precisions are usually satisfied by the shortest round-trip tables either
+// way.
+#ifndef _STL_CHARCONV_COMPACT_TABLES
+#define _STL_CHARCONV_COMPACT_TABLES 0
+#endif // _STL_CHARCONV_COMPACT_TABLES
+
 #ifdef __cpp_consteval
 #define _CONSTEVAL consteval
 #else // ^^^ supports consteval / no consteval vvv
@@ -1170,6 +1233,7 @@
 #define __cpp_lib_atomic_value_initialization 201911L
 
 #if _HAS_CXX20
+#define __cpp_lib_allocate_at_least             202106L
 #define __cpp_lib_assume_aligned                201811L
 #define __cpp_lib_atomic_flag_test              201907L
 #define __cpp_lib_atomic_float                  201711L
@@ -1217,6 +1281,11 @@
 #define __cpp_lib_destroying_delete            201806L
 #define __cpp_lib_endian                       201907L
 #define __cpp_lib_erase_if                     202002L
+
+#ifdef __cpp_lib_concepts
+#define __cpp_lib_format 202106L
+#endif // __cpp_lib_concepts
+
 #define __cpp_lib_generic_unordered_lookup     201811L
 #define __cpp_lib_int_pow2                     202002L
 #define __cpp_lib_integer_comparison_functions 202002L
@@ -1242,6 +1311,14 @@
 #define __cpp_lib_list_remove_return_type 201806L
 #define __cpp_lib_math_constants          201907L
 #define __cpp_lib_polymorphic_allocator   201902L
+
+#ifdef __cpp_lib_concepts
+#define __cpp_lib_ranges_chunk        202202L
+#define __cpp_lib_ranges_slide        202202L
+#define __cpp_lib_ranges_stride       202207L
+#define __cpp_lib_ranges_to_container 202202L
+#endif // __cpp_lib_concepts
+
 #define __cpp_lib_remove_cvref            201711L
 #define __cpp_lib_semaphore               201907L
 #define __cpp_lib_shift                   201806L
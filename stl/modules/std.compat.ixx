@@ -0,0 +1,9 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The named module std.compat: everything in std, plus the C library names in the global namespace, which the
+// header units of the <cmeow> headers re-exported by std already declare.
+
+export module std.compat;
+
+export import std;
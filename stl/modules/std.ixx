@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The named module std, made of the header units of the importable C++ library headers and of the <cmeow> headers.
+// Each header must be built as a header unit (/exportHeader) and passed with /headerUnit when compiling this file;
+// stl/CMakeLists.txt builds std.ifc this way for each runtime library option. Macros such as assert, errno and
+// offsetof aren't exported by a named module; include <cassert>, <cerrno> or <cstddef> for them.
+
+// The header units of the <cmeow> headers also declare the C library names in the global namespace, so they're
+// reachable after import std; as well. Portable code that wants them should import std.compat instead.
+
+export module std;
+
+// clang-format off
+export import <algorithm>;
+export import <any>;
+export import <array>;
+export import <atomic>;
+export import <barrier>;
+export import <bit>;
+export import <bitset>;
+export import <charconv>;
+export import <chrono>;
+export import <codecvt>;
+export import <compare>;
+export import <complex>;
+export import <concepts>;
+export import <condition_variable>;
+export import <coroutine>;
+export import <deque>;
+export import <exception>;
+export import <execution>;
+export import <filesystem>;
+export import <format>;
+export import <forward_list>;
+export import <fstream>;
+export import <functional>;
+export import <future>;
+export import <initializer_list>;
+export import <iomanip>;
+export import <ios>;
+export import <iosfwd>;
+export import <iostream>;
+export import <istream>;
+export import <iterator>;
+export import <latch>;
+export import <limits>;
+export import <list>;
+export import <locale>;
+export import <map>;
+export import <memory>;
+export import <memory_resource>;
+export import <mutex>;
+export import <new>;
+export import <numbers>;
+export import <numeric>;
+export import <optional>;
+export import <ostream>;
+export import <queue>;
+export import <random>;
+export import <ranges>;
+export import <ratio>;
+export import <regex>;
+export import <scoped_allocator>;
+export import <semaphore>;
+export import <set>;
+export import <shared_mutex>;
+export import <span>;
+export import <sstream>;
+export import <stack>;
+export import <stdexcept>;
+export import <stop_token>;
+export import <streambuf>;
+export import <string>;
+export import <string_view>;
+export import <strstream>;
+export import <syncstream>;
+export import <system_error>;
+export import <thread>;
+export import <tuple>;
+export import <type_traits>;
+export import <typeindex>;
+export import <typeinfo>;
+export import <unordered_map>;
+export import <unordered_set>;
+export import <utility>;
+export import <valarray>;
+export import <variant>;
+export import <vector>;
+export import <version>;
+
+export import <cctype>;
+export import <cerrno>;
+export import <cfenv>;
+export import <cfloat>;
+export import <cinttypes>;
+export import <climits>;
+export import <clocale>;
+export import <cmath>;
+export import <csetjmp>;
+export import <csignal>;
+export import <cstdarg>;
+export import <cstddef>;
+export import <cstdint>;
+export import <cstdio>;
+export import <cstdlib>;
+export import <cstring>;
+export import <ctime>;
+export import <cuchar>;
+export import <cwchar>;
+export import <cwctype>;
+// clang-format on
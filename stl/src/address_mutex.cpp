@@ -0,0 +1,302 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement stdext::address_mutex and stdext::address_condition_variable
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <xatomic_wait.h>
+#include <Windows.h>
+
+// clang-format on
+
+struct __std_address_mutex;
+
+namespace {
+    // lives on the stack of a thread waiting on an address_condition_variable
+    struct _Address_waiter {
+        _Address_waiter* _Next;
+        __std_address_mutex* _Mtx;
+        std::atomic<unsigned long> _Owns_mutex; // set when the waiter is woken, which hands it the locked mutex
+    };
+} // unnamed namespace
+
+// same layout as the declaration in <mutex>
+struct __std_address_mutex {
+    std::atomic<long> _State;
+    _Address_waiter* _Transferred_head;
+    _Address_waiter* _Transferred_tail;
+};
+
+// same layout as the declaration in <mutex>
+struct __std_address_condition_variable {
+    SRWLOCK _Lock;
+    _Address_waiter* _Head;
+    _Address_waiter* _Tail;
+};
+
+extern "C" {
+void __stdcall __std_address_mutex_lock_contended(__std_address_mutex* _Mtx) noexcept;
+void __stdcall __std_address_mutex_unlock_contended(__std_address_mutex* _Mtx) noexcept;
+} // extern "C"
+
+namespace {
+    // bits of __std_address_mutex::_State
+    constexpr long _Locked          = 1;
+    constexpr long _Contended       = 2; // threads may be waiting on _State itself
+    constexpr long _Transfer_locked = 4; // held while the list of transferred waiters is changed
+    constexpr long _Has_transferred = 8; // the list of transferred waiters isn't empty; implies _Locked
+
+    constexpr int _Spin_count = 64;
+
+    void _Backoff(int& _Spins) noexcept {
+        if (_Spins < _Spin_count) {
+            ++_Spins;
+            YieldProcessor();
+        } else {
+            (void) SwitchToThread();
+        }
+    }
+
+    void _Wait_for_mutex(_Address_waiter& _Self) noexcept {
+        unsigned long _Zero = 0;
+        while (_Self._Owns_mutex.load(std::memory_order_acquire) == 0) {
+            (void) __std_atomic_wait_direct(&_Self._Owns_mutex, &_Zero, sizeof(_Zero), _Atomic_wait_no_timeout);
+        }
+    }
+
+    // pre: the mutex is locked, and its transfer lock is held by this thread
+    void _Hand_off_first_transferred(__std_address_mutex& _Mtx) noexcept {
+        _Address_waiter* const _First = _Mtx._Transferred_head;
+        _Mtx._Transferred_head        = _First->_Next;
+        long _Remaining               = _Has_transferred;
+        if (!_Mtx._Transferred_head) {
+            _Mtx._Transferred_tail = nullptr;
+            _Remaining             = 0;
+        }
+
+        long _Old = _Mtx._State.load(std::memory_order_relaxed);
+        while (!_Mtx._State.compare_exchange_weak(_Old, (_Old & ~(_Transfer_locked | _Has_transferred)) | _Remaining,
+            std::memory_order_release, std::memory_order_relaxed)) {
+        }
+
+        // the mutex stays locked, now owned by _First; it may return from waiting as soon as this store is seen, so
+        // the notify may be for an address that is no longer in use, which is harmless
+        _First->_Owns_mutex.store(1, std::memory_order_release);
+        __std_atomic_notify_one_direct(&_First->_Owns_mutex);
+    }
+
+    // waiters taken from a condition variable wait for the mutex in a list that is handed the mutex as it is unlocked,
+    // rather than being woken to compete for it
+    void _Transfer(__std_address_mutex& _Mtx, _Address_waiter* const _First, _Address_waiter* const _Last) noexcept {
+        int _Spins = 0;
+        long _Old  = _Mtx._State.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((_Old & _Transfer_locked) != 0) {
+                _Backoff(_Spins);
+                _Old = _Mtx._State.load(std::memory_order_relaxed);
+            } else if (_Mtx._State.compare_exchange_weak(
+                           _Old, _Old | _Transfer_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        if (_Mtx._Transferred_tail) {
+            _Mtx._Transferred_tail->_Next = _First;
+        } else {
+            _Mtx._Transferred_head = _First;
+        }
+
+        _Mtx._Transferred_tail = _Last;
+
+        _Old = _Mtx._State.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((_Old & _Locked) != 0) {
+                // the owner hands the mutex to the first transferred waiter when unlocking it; that may already have
+                // happened without seeing the transferred waiters, in which case the mutex is locked for them below
+                if (_Mtx._State.compare_exchange_weak(_Old, (_Old | _Has_transferred) & ~_Transfer_locked,
+                        std::memory_order_release, std::memory_order_relaxed)) {
+                    return;
+                }
+            } else if (_Mtx._State.compare_exchange_weak(
+                           _Old, _Old | _Locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                _Hand_off_first_transferred(_Mtx);
+                return;
+            }
+        }
+    }
+
+    void _Lock(__std_address_mutex& _Mtx) noexcept {
+        long _Old = 0;
+        if (!_Mtx._State.compare_exchange_strong(_Old, _Locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            __std_address_mutex_lock_contended(&_Mtx);
+        }
+    }
+
+    void _Unlock(__std_address_mutex& _Mtx) noexcept {
+        long _Old = _Locked;
+        if (!_Mtx._State.compare_exchange_strong(_Old, 0, std::memory_order_release, std::memory_order_relaxed)) {
+            __std_address_mutex_unlock_contended(&_Mtx);
+        }
+    }
+
+    [[nodiscard]] bool _Remove_waiter(__std_address_condition_variable& _Cv, _Address_waiter& _Self) noexcept {
+        // pre: _Cv._Lock is held
+        _Address_waiter* _Prev = nullptr;
+        for (auto _Node = _Cv._Head; _Node; _Prev = _Node, _Node = _Node->_Next) {
+            if (_Node == &_Self) {
+                if (_Prev) {
+                    _Prev->_Next = _Self._Next;
+                } else {
+                    _Cv._Head = _Self._Next;
+                }
+
+                if (_Cv._Tail == &_Self) {
+                    _Cv._Tail = _Prev;
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // unnamed namespace
+
+extern "C" {
+void __stdcall __std_address_mutex_lock_contended(__std_address_mutex* const _Mtx) noexcept {
+    auto& _State = _Mtx->_State;
+    long _Old    = _State.load(std::memory_order_relaxed);
+    for (int _Spins = 0; _Spins < _Spin_count && (_Old & _Contended) == 0; ++_Spins) {
+        // spin briefly while the owner is running, but not once others have gone to sleep
+        if ((_Old & _Locked) == 0) {
+            if (_State.compare_exchange_weak(
+                    _Old, _Old | _Locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+        } else {
+            YieldProcessor();
+            _Old = _State.load(std::memory_order_relaxed);
+        }
+    }
+
+    for (;;) {
+        if ((_Old & _Locked) == 0) {
+            // other threads may still be waiting, so the unlock must wake one of them
+            if (_State.compare_exchange_weak(
+                    _Old, _Old | _Locked | _Contended, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+        } else if ((_Old & _Contended) == 0
+                   && !_State.compare_exchange_weak(
+                       _Old, _Old | _Contended, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            // _Old was reloaded, try again
+        } else {
+            _Old |= _Contended;
+            (void) __std_atomic_wait_direct(&_State, &_Old, sizeof(_Old), _Atomic_wait_no_timeout);
+            _Old = _State.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void __stdcall __std_address_mutex_unlock_contended(__std_address_mutex* const _Mtx) noexcept {
+    auto& _State = _Mtx->_State;
+    int _Spins   = 0;
+    long _Old    = _State.load(std::memory_order_relaxed);
+    for (;;) {
+        if ((_Old & _Has_transferred) != 0) {
+            if ((_Old & _Transfer_locked) != 0) {
+                _Backoff(_Spins);
+                _Old = _State.load(std::memory_order_relaxed);
+            } else if (_State.compare_exchange_weak(
+                           _Old, _Old | _Transfer_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                _Hand_off_first_transferred(*_Mtx);
+                return;
+            }
+        } else if (_State.compare_exchange_weak(
+                       _Old, _Old & ~(_Locked | _Contended), std::memory_order_release, std::memory_order_relaxed)) {
+            if ((_Old & _Contended) != 0) {
+                __std_atomic_notify_one_direct(&_State);
+            }
+
+            return;
+        }
+    }
+}
+
+[[nodiscard]] int __stdcall __std_address_condition_variable_wait(__std_address_condition_variable* const _Cv,
+    __std_address_mutex* const _Mtx, const unsigned long _Timeout) noexcept {
+    _Address_waiter _Self{nullptr, _Mtx, 0};
+    AcquireSRWLockExclusive(&_Cv->_Lock);
+    if (_Cv->_Tail) {
+        _Cv->_Tail->_Next = &_Self;
+    } else {
+        _Cv->_Head = &_Self;
+    }
+
+    _Cv->_Tail = &_Self;
+    ReleaseSRWLockExclusive(&_Cv->_Lock);
+
+    _Unlock(*_Mtx);
+
+    if (_Timeout != _Atomic_wait_no_timeout) {
+        const auto _Deadline = __std_atomic_wait_get_deadline(_Timeout);
+        unsigned long _Zero  = 0;
+        while (_Self._Owns_mutex.load(std::memory_order_acquire) == 0) {
+            const auto _Remaining = __std_atomic_wait_get_remaining_timeout(_Deadline);
+            if (_Remaining == 0) {
+                AcquireSRWLockExclusive(&_Cv->_Lock);
+                const bool _Removed = _Remove_waiter(*_Cv, _Self);
+                ReleaseSRWLockExclusive(&_Cv->_Lock);
+                if (_Removed) {
+                    _Lock(*_Mtx);
+                    return 0;
+                }
+
+                // a notify took this waiter already, and is about to hand it the mutex
+                break;
+            }
+
+            (void) __std_atomic_wait_direct(&_Self._Owns_mutex, &_Zero, sizeof(_Zero), _Remaining);
+        }
+    }
+
+    _Wait_for_mutex(_Self);
+    return 1;
+}
+
+void __stdcall __std_address_condition_variable_notify_one(__std_address_condition_variable* const _Cv) noexcept {
+    AcquireSRWLockExclusive(&_Cv->_Lock);
+    _Address_waiter* const _First = _Cv->_Head;
+    if (_First) {
+        _Cv->_Head = _First->_Next;
+        if (!_Cv->_Head) {
+            _Cv->_Tail = nullptr;
+        }
+
+        _First->_Next = nullptr;
+    }
+
+    ReleaseSRWLockExclusive(&_Cv->_Lock);
+
+    if (_First) {
+        _Transfer(*_First->_Mtx, _First, _First);
+    }
+}
+
+void __stdcall __std_address_condition_variable_notify_all(__std_address_condition_variable* const _Cv) noexcept {
+    AcquireSRWLockExclusive(&_Cv->_Lock);
+    _Address_waiter* const _First = _Cv->_Head;
+    _Address_waiter* const _Last  = _Cv->_Tail;
+    _Cv->_Head                    = nullptr;
+    _Cv->_Tail                    = nullptr;
+    ReleaseSRWLockExclusive(&_Cv->_Lock);
+
+    if (_First) {
+        // all waiters use the same mutex
+        _Transfer(*_First->_Mtx, _First, _Last);
+    }
+}
+} // extern "C"
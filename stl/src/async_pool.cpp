@@ -0,0 +1,201 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement stdext::async_pool
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <Windows.h>
+
+// clang-format on
+
+using __std_async_pool_callback = void(__stdcall*)(void* _Context) noexcept;
+
+// same layout as the declaration in <future>
+struct __std_async_pool_statistics {
+    unsigned int _Max_workers;
+    size_t _Queued;
+    size_t _Running;
+    unsigned long long _Completed;
+    unsigned long long _Total_queue_latency; // nanoseconds
+    unsigned long long _Max_queue_latency; // nanoseconds
+    unsigned long long _Total_run_time; // nanoseconds
+};
+
+struct __std_async_pool {
+    PTP_POOL _Pool = nullptr;
+    TP_CALLBACK_ENVIRON _Environment;
+    unsigned int _Max_workers = 0;
+    int _Priority             = THREAD_PRIORITY_NORMAL;
+    // one for the stdext::async_pool, plus one for each task not yet closed, so that the tasks may outlive it
+    std::atomic<long> _Refs{1};
+
+    // all of the statistics are updated with relaxed operations; they are only approximately consistent with
+    // each other while tasks are running
+    std::atomic<size_t> _Queued{0};
+    std::atomic<size_t> _Running{0};
+    std::atomic<unsigned long long> _Completed{0};
+    std::atomic<unsigned long long> _Total_queue_ticks{0};
+    std::atomic<unsigned long long> _Max_queue_ticks{0};
+    std::atomic<unsigned long long> _Total_run_ticks{0};
+};
+
+struct __std_async_pool_task {
+    __std_async_pool* _Pool;
+    PTP_WORK _Work;
+    __std_async_pool_callback _Callback;
+    void* _Context;
+    long long _Submitted; // performance counter ticks
+};
+
+namespace {
+    // the threads of a private threadpool only ever run callbacks of that pool, so the priority is set once
+    thread_local bool _Thread_priority_set = false;
+
+    [[nodiscard]] long long _Ticks() noexcept {
+        LARGE_INTEGER _Now;
+        QueryPerformanceCounter(&_Now);
+        return _Now.QuadPart;
+    }
+
+    [[nodiscard]] unsigned long long _Ticks_to_nanoseconds(const unsigned long long _Ticks_) noexcept {
+        LARGE_INTEGER _Freq;
+        QueryPerformanceFrequency(&_Freq);
+        const auto _Per_second = static_cast<unsigned long long>(_Freq.QuadPart);
+        // split into whole and partial seconds to avoid overflow, like steady_clock::now()
+        const auto _Whole = _Ticks_ / _Per_second;
+        const auto _Part  = _Ticks_ % _Per_second;
+        return _Whole * 1'000'000'000 + _Part * 1'000'000'000 / _Per_second;
+    }
+
+    void _Release_pool(__std_async_pool* const _Pool) noexcept {
+        if (_Pool->_Refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            DestroyThreadpoolEnvironment(&_Pool->_Environment);
+            CloseThreadpool(_Pool->_Pool);
+            delete _Pool;
+        }
+    }
+
+    void CALLBACK _Async_pool_callback(PTP_CALLBACK_INSTANCE, void* const _Context, PTP_WORK) noexcept {
+        const auto _Task       = static_cast<__std_async_pool_task*>(_Context);
+        const auto _Pool       = _Task->_Pool;
+        const long long _Start = _Ticks();
+        _Pool->_Queued.fetch_sub(1, std::memory_order_relaxed);
+        _Pool->_Running.fetch_add(1, std::memory_order_relaxed);
+
+        const auto _Queue_ticks = static_cast<unsigned long long>(_Start - _Task->_Submitted);
+        _Pool->_Total_queue_ticks.fetch_add(_Queue_ticks, std::memory_order_relaxed);
+        auto _Max = _Pool->_Max_queue_ticks.load(std::memory_order_relaxed);
+        while (_Max < _Queue_ticks
+               && !_Pool->_Max_queue_ticks.compare_exchange_weak(_Max, _Queue_ticks, std::memory_order_relaxed)) {
+        }
+
+        if (!_Thread_priority_set) {
+            _Thread_priority_set = true;
+            if (_Pool->_Priority != THREAD_PRIORITY_NORMAL) {
+                (void) SetThreadPriority(GetCurrentThread(), _Pool->_Priority);
+            }
+        }
+
+        _Task->_Callback(_Task->_Context);
+
+        _Pool->_Total_run_ticks.fetch_add(
+            static_cast<unsigned long long>(_Ticks() - _Start), std::memory_order_relaxed);
+        _Pool->_Running.fetch_sub(1, std::memory_order_relaxed);
+        _Pool->_Completed.fetch_add(1, std::memory_order_relaxed);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] __std_async_pool* __stdcall __std_async_pool_create(
+    unsigned int _Max_workers, const int _Priority) noexcept {
+    if (_Max_workers == 0) {
+        _Max_workers = std::thread::hardware_concurrency();
+        if (_Max_workers == 0) {
+            _Max_workers = 1;
+        }
+    }
+
+    if (_Priority < THREAD_PRIORITY_LOWEST || _Priority > THREAD_PRIORITY_HIGHEST) {
+        return nullptr;
+    }
+
+    const auto _Pool = new (std::nothrow) __std_async_pool;
+    if (!_Pool) {
+        return nullptr;
+    }
+
+    _Pool->_Pool = CreateThreadpool(nullptr);
+    if (!_Pool->_Pool) {
+        delete _Pool;
+        return nullptr;
+    }
+
+    // one thread is kept even while the pool is idle, so that a burst doesn't start by creating threads
+    SetThreadpoolThreadMaximum(_Pool->_Pool, _Max_workers);
+    if (!SetThreadpoolThreadMinimum(_Pool->_Pool, 1)) {
+        CloseThreadpool(_Pool->_Pool);
+        delete _Pool;
+        return nullptr;
+    }
+
+    InitializeThreadpoolEnvironment(&_Pool->_Environment);
+    SetThreadpoolCallbackPool(&_Pool->_Environment, _Pool->_Pool);
+    _Pool->_Max_workers = _Max_workers;
+    _Pool->_Priority    = _Priority;
+    return _Pool;
+}
+
+void __stdcall __std_async_pool_release(__std_async_pool* const _Pool) noexcept {
+    _Release_pool(_Pool);
+}
+
+[[nodiscard]] __std_async_pool_task* __stdcall __std_async_pool_submit(
+    __std_async_pool* const _Pool, const __std_async_pool_callback _Callback, void* const _Context) noexcept {
+    const auto _Task = new (std::nothrow) __std_async_pool_task{_Pool, nullptr, _Callback, _Context, 0};
+    if (!_Task) {
+        return nullptr;
+    }
+
+    _Task->_Work = CreateThreadpoolWork(&_Async_pool_callback, _Task, &_Pool->_Environment);
+    if (!_Task->_Work) {
+        delete _Task;
+        return nullptr;
+    }
+
+    _Pool->_Refs.fetch_add(1, std::memory_order_relaxed);
+    _Pool->_Queued.fetch_add(1, std::memory_order_relaxed);
+    _Task->_Submitted = _Ticks();
+    SubmitThreadpoolWork(_Task->_Work);
+    return _Task;
+}
+
+void __stdcall __std_async_pool_wait(__std_async_pool_task* const _Task) noexcept {
+    WaitForThreadpoolWorkCallbacks(_Task->_Work, FALSE);
+}
+
+void __stdcall __std_async_pool_close(__std_async_pool_task* const _Task) noexcept {
+    WaitForThreadpoolWorkCallbacks(_Task->_Work, FALSE);
+    CloseThreadpoolWork(_Task->_Work);
+    _Release_pool(_Task->_Pool);
+    delete _Task;
+}
+
+void __stdcall __std_async_pool_get_statistics(
+    const __std_async_pool* const _Pool, __std_async_pool_statistics* const _Statistics) noexcept {
+    constexpr auto _Relaxed           = std::memory_order_relaxed;
+    _Statistics->_Max_workers         = _Pool->_Max_workers;
+    _Statistics->_Queued              = _Pool->_Queued.load(_Relaxed);
+    _Statistics->_Running             = _Pool->_Running.load(_Relaxed);
+    _Statistics->_Completed           = _Pool->_Completed.load(_Relaxed);
+    _Statistics->_Total_queue_latency = _Ticks_to_nanoseconds(_Pool->_Total_queue_ticks.load(_Relaxed));
+    _Statistics->_Max_queue_latency   = _Ticks_to_nanoseconds(_Pool->_Max_queue_ticks.load(_Relaxed));
+    _Statistics->_Total_run_time      = _Ticks_to_nanoseconds(_Pool->_Total_run_ticks.load(_Relaxed));
+}
+
+} // extern "C"
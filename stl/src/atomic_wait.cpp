@@ -13,11 +13,15 @@
 
 // clang-format on
 
+#include "tracelogging.hpp"
+
 namespace {
 
-    constexpr size_t _Wait_table_size_power = 8;
-    constexpr size_t _Wait_table_size       = 1 << _Wait_table_size_power;
-    constexpr size_t _Wait_table_index_mask = _Wait_table_size - 1;
+    // The wait table grows with the number of processors, so that unrelated addresses waited on by many threads rarely
+    // share an entry and its lock; it is allocated on first use rather than always taking the largest size.
+    constexpr size_t _Min_wait_table_size_power        = 8;
+    constexpr size_t _Max_wait_table_size_power        = 14;
+    constexpr size_t _Wait_table_entries_per_processor = 64;
 
     struct _Wait_context {
         const void* _Storage; // Pointer to wait on
@@ -62,22 +66,109 @@ namespace {
     };
 
 
+    // Before blocking, a wait spins for a while, pausing between reads for exponentially longer. When threads hand off
+    // work to each other every few microseconds, the value usually changes within that time, which avoids the cost
+    // of sleeping and waking in the kernel. How long to spin is learned separately for each wait table entry: the
+    // budget moves toward twice the spinning that ended a wait, and shrinks whenever a wait blocks anyway.
+    constexpr long _Min_spin_rounds     = 2; // keep probing, so that an address whose waits get shorter recovers
+    constexpr long _Initial_spin_rounds = 12;
+    constexpr long _Max_spin_rounds     = 24;
+    constexpr int _Max_pauses_per_round = 64;
+
 #pragma warning(push)
 #pragma warning(disable : 4324) // structure was padded due to alignment specifier
     struct alignas(_STD hardware_destructive_interference_size) _Wait_table_entry {
         SRWLOCK _Lock                 = SRWLOCK_INIT;
         _Wait_context _Wait_list_head = {nullptr, &_Wait_list_head, &_Wait_list_head, CONDITION_VARIABLE_INIT};
+        _STD atomic<long> _Spin_rounds{_Initial_spin_rounds}; // the spin budget of the addresses sharing this entry
+        _STD atomic<unsigned long long> _Blocked_waits{0}; // waits that went to sleep
+        _STD atomic<unsigned long long> _Contended_locks{0}; // acquisitions of _Lock that found it already held
 
         constexpr _Wait_table_entry() noexcept = default;
     };
 #pragma warning(pop)
 
+    class _NODISCARD _Entry_lock_guard {
+    public:
+        explicit _Entry_lock_guard(_Wait_table_entry& _Entry_) noexcept : _Entry(&_Entry_) {
+            if (!TryAcquireSRWLockExclusive(&_Entry->_Lock)) {
+                _Entry->_Contended_locks.fetch_add(1, _STD memory_order_relaxed);
+                AcquireSRWLockExclusive(&_Entry->_Lock);
+            }
+        }
+
+        ~_Entry_lock_guard() {
+            ReleaseSRWLockExclusive(&_Entry->_Lock);
+        }
+
+        _Entry_lock_guard(const _Entry_lock_guard&) = delete;
+        _Entry_lock_guard& operator=(const _Entry_lock_guard&) = delete;
+
+    private:
+        _Wait_table_entry* _Entry;
+    };
+
+    [[nodiscard]] unsigned long _Processor_count() noexcept {
+        // the processors of the current processor group, which is what threads of this process usually run on
+        static const unsigned long _Result = [] {
+            SYSTEM_INFO _Info;
+            GetSystemInfo(&_Info);
+            return _Info.dwNumberOfProcessors;
+        }();
+        return _Result;
+    }
+
+    [[nodiscard]] size_t _Address_hash(const void* const _Storage, const size_t _Size_power) noexcept {
+        // Fibonacci hashing: the multiplication carries every bit of the address into the high bits, which select the
+        // entry, so addresses that differ only in their higher bits (like objects in a large array) spread out
+#ifdef _WIN64
+        constexpr size_t _Multiplier = 0x9E37'79B9'7F4A'7C15;
+#else // ^^^ defined(_WIN64) / !defined(_WIN64) vvv
+        constexpr size_t _Multiplier = 0x9E37'79B9;
+#endif // ^^^ !defined(_WIN64) ^^^
+        return (reinterpret_cast<_STD uintptr_t>(_Storage) * _Multiplier) >> (sizeof(size_t) * 8 - _Size_power);
+    }
+
+    struct _Wait_table {
+        _Wait_table_entry* _Entries;
+        size_t _Size_power;
+    };
+
+    [[nodiscard]] _Wait_table _Make_wait_table() noexcept {
+        size_t _Size_power = _Min_wait_table_size_power;
+        while (_Size_power < _Max_wait_table_size_power
+               && (size_t{1} << _Size_power) < _Processor_count() * _Wait_table_entries_per_processor) {
+            ++_Size_power;
+        }
+
+        if (_Size_power != _Min_wait_table_size_power) {
+            const size_t _Size      = size_t{1} << _Size_power;
+            constexpr size_t _Align = alignof(_Wait_table_entry);
+            // never freed, as waits may still happen while the process shuts down
+            void* const _Raw = HeapAlloc(GetProcessHeap(), 0, _Size * sizeof(_Wait_table_entry) + _Align - 1);
+            if (_Raw) {
+                const auto _Aligned = (reinterpret_cast<_STD uintptr_t>(_Raw) + _Align - 1) & ~(_Align - 1);
+                const auto _Entries = reinterpret_cast<_Wait_table_entry*>(_Aligned);
+                for (size_t _Idx = 0; _Idx != _Size; ++_Idx) {
+                    ::new (static_cast<void*>(_Entries + _Idx)) _Wait_table_entry;
+                }
+
+                return {_Entries, _Size_power};
+            }
+        }
+
+        static _Wait_table_entry _Fallback_table[size_t{1} << _Min_wait_table_size_power];
+        return {_Fallback_table, _Min_wait_table_size_power};
+    }
+
+    [[nodiscard]] const _Wait_table& _Get_wait_table() noexcept {
+        static const _Wait_table _Table = _Make_wait_table();
+        return _Table;
+    }
+
     [[nodiscard]] _Wait_table_entry& _Atomic_wait_table_entry(const void* const _Storage) noexcept {
-        static _Wait_table_entry wait_table[_Wait_table_size];
-        auto index = reinterpret_cast<_STD uintptr_t>(_Storage);
-        index ^= index >> (_Wait_table_size_power * 2);
-        index ^= index >> _Wait_table_size_power;
-        return wait_table[index & _Wait_table_index_mask];
+        const auto& _Table = _Get_wait_table();
+        return _Table._Entries[_Address_hash(_Storage, _Table._Size_power)];
     }
 
     void _Assume_timeout() noexcept {
@@ -182,8 +273,9 @@ namespace {
         const auto _Wake_by_address_all = _Wait_functions._Pfn_WakeByAddressAll.load(_STD memory_order_relaxed);
         _Wake_by_address_all(Address);
     }
+#endif // _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE
 
-    bool __stdcall _Atomic_wait_are_equal_direct_fallback(
+    bool __stdcall _Atomic_wait_are_equal_direct(
         const void* _Storage, void* _Comparand, size_t _Size, void*) noexcept {
         switch (_Size) {
         case 1:
@@ -199,7 +291,55 @@ namespace {
             _CSTD abort();
         }
     }
-#endif // _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE
+
+    [[nodiscard]] bool _Is_multiprocessor() noexcept {
+        return _Processor_count() > 1;
+    }
+
+    void _Adjust_spin_budget(_STD atomic<long>& _Budget, const long _Current, const long _Target) noexcept {
+        // the budget is only an estimate, so racing updates may be lost
+        long _New_budget = _Current + (_Target - _Current) / 8;
+        if (_New_budget == _Current && _Target != _Current) {
+            _New_budget += _Target > _Current ? 1 : -1;
+        }
+
+        if (_New_budget < _Min_spin_rounds) {
+            _New_budget = _Min_spin_rounds;
+        } else if (_New_budget > _Max_spin_rounds) {
+            _New_budget = _Max_spin_rounds;
+        }
+
+        _Budget.store(_New_budget, _STD memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool _Spin_until_changed(
+        const void* const _Storage, void* const _Comparand, const size_t _Size) noexcept {
+        // returns whether the value stopped matching the comparand while spinning
+        if (!_Is_multiprocessor()) { // the thread that would change the value can't run while this one spins
+            return false;
+        }
+
+        auto& _Budget      = _Atomic_wait_table_entry(_Storage)._Spin_rounds;
+        const long _Rounds = _Budget.load(_STD memory_order_relaxed);
+        int _Pauses        = 1;
+        for (long _Round = 0; _Round < _Rounds; ++_Round) {
+            for (int _Count = _Pauses; _Count != 0; --_Count) {
+                YieldProcessor(); // _mm_pause() or __yield()
+            }
+
+            if (_Pauses < _Max_pauses_per_round) {
+                _Pauses <<= 1;
+            }
+
+            if (!_Atomic_wait_are_equal_direct(_Storage, _Comparand, _Size, nullptr)) {
+                _Adjust_spin_budget(_Budget, _Rounds, 2 * (_Round + 1));
+                return true;
+            }
+        }
+
+        _Adjust_spin_budget(_Budget, _Rounds, 0);
+        return false;
+    }
 
     _NODISCARD unsigned char __std_atomic_compare_exchange_128_fallback(_Inout_bytecount_(16) long long* _Destination,
         _In_ long long _ExchangeHigh, _In_ long long _ExchangeLow,
@@ -218,25 +358,142 @@ namespace {
             return static_cast<unsigned char>(false);
         }
     }
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif // CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+
+    // WaitOnAddress only takes a timeout in milliseconds, which expires on a tick of the system timer. For a precise
+    // timeout, a high resolution waitable timer is set to it, and a thread pool wait on that timer wakes the waiting
+    // thread, which sees the wake as spurious and recomputes its timeout. The timers are kept for reuse; a timer that
+    // fires late only causes another spurious wake.
+    struct _Precise_timer {
+        HANDLE _Timer;
+        PTP_WAIT _Wait;
+        _STD atomic<const void*> _Storage{nullptr}; // the address to wake when the timer fires
+        _Precise_timer* _Next = nullptr; // in the list of unused timers
+    };
+
+    constexpr unsigned long long _Precise_wait_limit = 50 * 10'000; // 50 ms, in 100-nanosecond units
+
+    SRWLOCK _Precise_timer_lock           = SRWLOCK_INIT;
+    _Precise_timer* _Unused_precise_timers = nullptr; // guarded by _Precise_timer_lock
+    _STD atomic<bool> _Precise_timers_unavailable{false};
+
+    void CALLBACK _Precise_timer_callback(PTP_CALLBACK_INSTANCE, void* const _Context, PTP_WAIT, TP_WAIT_RESULT) {
+        const auto _Storage = static_cast<_Precise_timer*>(_Context)->_Storage.load(_STD memory_order_acquire);
+        if (_Storage) {
+            __std_atomic_notify_all_direct(_Storage);
+        }
+    }
+
+    [[nodiscard]] _Precise_timer* _Acquire_precise_timer() noexcept {
+        {
+            _SrwLock_guard _Guard{_Precise_timer_lock};
+            if (const auto _Timer = _Unused_precise_timers) {
+                _Unused_precise_timers = _Timer->_Next;
+                return _Timer;
+            }
+        }
+
+        if (_Precise_timers_unavailable.load(_STD memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        const HANDLE _Handle =
+            CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!_Handle) { // not supported before Windows 10, version 1803
+            _Precise_timers_unavailable.store(true, _STD memory_order_relaxed);
+            return nullptr;
+        }
+
+        const auto _Timer = new (_STD nothrow) _Precise_timer{_Handle, nullptr};
+        if (_Timer) {
+            _Timer->_Wait = CreateThreadpoolWait(&_Precise_timer_callback, _Timer, nullptr);
+            if (_Timer->_Wait) {
+                return _Timer;
+            }
+
+            delete _Timer;
+        }
+
+        CloseHandle(_Handle);
+        return nullptr;
+    }
+
+    void _Release_precise_timer(_Precise_timer* const _Timer) noexcept {
+        _SrwLock_guard _Guard{_Precise_timer_lock};
+        _Timer->_Next          = _Unused_precise_timers;
+        _Unused_precise_timers = _Timer;
+    }
+
+    [[nodiscard]] unsigned long _Precise_to_milliseconds(const unsigned long long _Timeout) noexcept {
+        constexpr unsigned long long _Ten_days = 864'000'000;
+        const unsigned long long _Result       = (_Timeout + 9'999) / 10'000; // round up
+        return static_cast<unsigned long>(_Result < _Ten_days ? _Result : _Ten_days);
+    }
 } // unnamed namespace
 
 
 _EXTERN_C
 int __stdcall __std_atomic_wait_direct(const void* const _Storage, void* const _Comparand, const size_t _Size,
     const unsigned long _Remaining_timeout) noexcept {
+    if (_Remaining_timeout != 0 && _Spin_until_changed(_Storage, _Comparand, _Size)) {
+        return TRUE; // the caller checks the value again, as after any wake
+    }
+
 #if _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE == 0
     if (_Acquire_wait_functions() < __std_atomic_api_level::__has_wait_on_address) {
         return __std_atomic_wait_indirect(
-            _Storage, _Comparand, _Size, nullptr, &_Atomic_wait_are_equal_direct_fallback, _Remaining_timeout);
+            _Storage, _Comparand, _Size, nullptr, &_Atomic_wait_are_equal_direct, _Remaining_timeout);
     }
 #endif // _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE == 0
 
+    _Atomic_wait_table_entry(_Storage)._Blocked_waits.fetch_add(1, _STD memory_order_relaxed);
+    _STL_TRACE("AtomicWaitBlock", _STL_TRACE_KEYWORD_ATOMIC_WAIT, _STL_TRACE_START,
+        TraceLoggingPointer(_Storage, "Address"), TraceLoggingUInt32(_Remaining_timeout, "TimeoutMs"));
     const auto _Result = __crtWaitOnAddress(
         const_cast<volatile void*>(_Storage), const_cast<void*>(_Comparand), _Size, _Remaining_timeout);
 
     if (!_Result) {
         _Assume_timeout();
     }
+    _STL_TRACE("AtomicWaitBlock", _STL_TRACE_KEYWORD_ATOMIC_WAIT, _STL_TRACE_STOP,
+        TraceLoggingPointer(_Storage, "Address"), TraceLoggingBool(!_Result, "TimedOut"));
+    return _Result;
+}
+
+int __stdcall __std_atomic_wait_direct_precise(const void* const _Storage, void* const _Comparand, const size_t _Size,
+    const unsigned long long _Remaining_timeout) noexcept {
+    if (_Remaining_timeout > _Precise_wait_limit) {
+        // far from the deadline, the system timer is precise enough to wait until shortly before it; the caller
+        // waits again for the rest
+        return __std_atomic_wait_direct(
+            _Storage, _Comparand, _Size, _Precise_to_milliseconds(_Remaining_timeout - _Precise_wait_limit / 2));
+    }
+
+    const auto _Timer = _Acquire_precise_timer();
+    if (!_Timer) {
+        return __std_atomic_wait_direct(_Storage, _Comparand, _Size, _Precise_to_milliseconds(_Remaining_timeout));
+    }
+
+    _Timer->_Storage.store(_Storage, _STD memory_order_release);
+    LARGE_INTEGER _Due_time;
+    _Due_time.QuadPart = -static_cast<long long>(_Remaining_timeout); // negative for a relative time
+    int _Result;
+    if (SetWaitableTimer(_Timer->_Timer, &_Due_time, 0, nullptr, nullptr, FALSE)) {
+        SetThreadpoolWait(_Timer->_Wait, _Timer->_Timer, nullptr);
+        // the timeout in milliseconds is only a backstop, which expires after the timer fires
+        _Result = __std_atomic_wait_direct(_Storage, _Comparand, _Size, _Precise_to_milliseconds(_Remaining_timeout));
+        SetThreadpoolWait(_Timer->_Wait, nullptr, nullptr);
+        WaitForThreadpoolWaitCallbacks(_Timer->_Wait, TRUE);
+        CancelWaitableTimer(_Timer->_Timer);
+    } else {
+        _Result = __std_atomic_wait_direct(_Storage, _Comparand, _Size, _Precise_to_milliseconds(_Remaining_timeout));
+    }
+
+    _Timer->_Storage.store(nullptr, _STD memory_order_relaxed);
+    _Release_precise_timer(_Timer);
     return _Result;
 }
 
@@ -248,6 +505,8 @@ void __stdcall __std_atomic_notify_one_direct(const void* const _Storage) noexce
     }
 #endif // _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE = 0
 
+    _STL_TRACE("AtomicWaitWake", _STL_TRACE_KEYWORD_ATOMIC_WAIT, TraceLoggingPointer(_Storage, "Address"),
+        TraceLoggingBool(false, "All"));
     __crtWakeByAddressSingle(const_cast<void*>(_Storage));
 }
 
@@ -259,12 +518,16 @@ void __stdcall __std_atomic_notify_all_direct(const void* const _Storage) noexce
     }
 #endif // _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE == 0
 
+    _STL_TRACE("AtomicWaitWake", _STL_TRACE_KEYWORD_ATOMIC_WAIT, TraceLoggingPointer(_Storage, "Address"),
+        TraceLoggingBool(true, "All"));
     __crtWakeByAddressAll(const_cast<void*>(_Storage));
 }
 
 void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noexcept {
+    _STL_TRACE("AtomicWaitWake", _STL_TRACE_KEYWORD_ATOMIC_WAIT, TraceLoggingPointer(_Storage, "Address"),
+        TraceLoggingBool(false, "All"));
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
-    _SrwLock_guard _Guard(_Entry._Lock);
+    _Entry_lock_guard _Guard(_Entry);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
     for (; _Context != &_Entry._Wait_list_head; _Context = _Context->_Next) {
         if (_Context->_Storage == _Storage) {
@@ -276,8 +539,10 @@ void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noex
 }
 
 void __stdcall __std_atomic_notify_all_indirect(const void* const _Storage) noexcept {
+    _STL_TRACE("AtomicWaitWake", _STL_TRACE_KEYWORD_ATOMIC_WAIT, TraceLoggingPointer(_Storage, "Address"),
+        TraceLoggingBool(true, "All"));
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
-    _SrwLock_guard _Guard(_Entry._Lock);
+    _Entry_lock_guard _Guard(_Entry);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
     for (; _Context != &_Entry._Wait_list_head; _Context = _Context->_Next) {
         if (_Context->_Storage == _Storage) {
@@ -291,18 +556,26 @@ int __stdcall __std_atomic_wait_indirect(const void* _Storage, void* _Comparand,
     _Atomic_wait_indirect_equal_callback_t _Are_equal, unsigned long _Remaining_timeout) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
 
-    _SrwLock_guard _Guard(_Entry._Lock);
+    _Entry_lock_guard _Guard(_Entry);
     _Guarded_wait_context _Context{_Storage, &_Entry._Wait_list_head};
     for (;;) {
         if (!_Are_equal(_Storage, _Comparand, _Size, _Param)) { // note: under lock to prevent lost wakes
             return TRUE;
         }
 
+        _Entry._Blocked_waits.fetch_add(1, _STD memory_order_relaxed);
+        _STL_TRACE("AtomicWaitBlock", _STL_TRACE_KEYWORD_ATOMIC_WAIT, _STL_TRACE_START,
+            TraceLoggingPointer(_Storage, "Address"), TraceLoggingUInt32(_Remaining_timeout, "TimeoutMs"));
         if (!SleepConditionVariableSRW(&_Context._Condition, &_Entry._Lock, _Remaining_timeout, 0)) {
             _Assume_timeout();
+            _STL_TRACE("AtomicWaitBlock", _STL_TRACE_KEYWORD_ATOMIC_WAIT, _STL_TRACE_STOP,
+                TraceLoggingPointer(_Storage, "Address"), TraceLoggingBool(true, "TimedOut"));
             return FALSE;
         }
 
+        _STL_TRACE("AtomicWaitBlock", _STL_TRACE_KEYWORD_ATOMIC_WAIT, _STL_TRACE_STOP,
+            TraceLoggingPointer(_Storage, "Address"), TraceLoggingBool(false, "TimedOut"));
+
         if (_Remaining_timeout != _Atomic_wait_no_timeout) {
             // spurious wake to recheck the clock
             return TRUE;
@@ -339,6 +612,19 @@ unsigned long __stdcall __std_atomic_wait_get_remaining_timeout(unsigned long lo
     return static_cast<unsigned long>(_Remaining);
 }
 
+void __stdcall __std_atomic_wait_get_statistics(__std_atomic_wait_statistics* const _Statistics) noexcept {
+    const auto& _Table            = _Get_wait_table();
+    const size_t _Size            = size_t{1} << _Table._Size_power;
+    _Statistics->_Blocked_waits   = 0;
+    _Statistics->_Contended_locks = 0;
+    _Statistics->_Table_size      = _Size;
+    for (size_t _Idx = 0; _Idx != _Size; ++_Idx) {
+        const auto& _Entry = _Table._Entries[_Idx];
+        _Statistics->_Blocked_waits += _Entry._Blocked_waits.load(_STD memory_order_relaxed);
+        _Statistics->_Contended_locks += _Entry._Contended_locks.load(_STD memory_order_relaxed);
+    }
+}
+
 __std_atomic_api_level __stdcall __std_atomic_set_api_level(__std_atomic_api_level _Requested_api_level) noexcept {
 #if _ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE
     (void) _Requested_api_level;
@@ -365,7 +651,6 @@ __std_atomic_api_level __stdcall __std_atomic_set_api_level(__std_atomic_api_lev
 _Smtx_t* __stdcall __std_atomic_get_mutex(const void* const _Key) noexcept {
     constexpr size_t _Table_size_power = 8;
     constexpr size_t _Table_size       = 1 << _Table_size_power;
-    constexpr size_t _Table_index_mask = _Table_size - 1;
 
     struct alignas(std::hardware_destructive_interference_size) _Table_entry {
         _Smtx_t _Mutex;
@@ -373,10 +658,7 @@ _Smtx_t* __stdcall __std_atomic_get_mutex(const void* const _Key) noexcept {
 
     static _Table_entry _Table[_Table_size]{};
 
-    auto _Index = reinterpret_cast<std::uintptr_t>(_Key);
-    _Index ^= _Index >> (_Table_size_power * 2);
-    _Index ^= _Index >> _Table_size_power;
-    return &_Table[_Index & _Table_index_mask]._Mutex;
+    return &_Table[_Address_hash(_Key, _Table_size_power)]._Mutex;
 }
 #pragma warning(pop)
 
@@ -9,6 +9,7 @@
 #include <xthreads.h>
 #include <xtimec.h>
 
+#include "precise_timer.hpp"
 #include "primitives.hpp"
 
 struct _Cnd_internal_imp_t { // condition variable implementation for ConcRT
@@ -25,6 +26,12 @@ struct _Cnd_internal_imp_t { // condition variable implementation for ConcRT
 static_assert(sizeof(_Cnd_internal_imp_t) <= _Cnd_internal_imp_size, "incorrect _Cnd_internal_imp_size");
 static_assert(alignof(_Cnd_internal_imp_t) <= _Cnd_internal_imp_alignment, "incorrect _Cnd_internal_imp_alignment");
 
+namespace {
+    void __cdecl _Wake_all_for_timeout(void* const cv) noexcept {
+        static_cast<Concurrency::details::stl_condition_variable_interface*>(cv)->notify_all();
+    }
+} // unnamed namespace
+
 void _Cnd_init_in_situ(const _Cnd_t cond) { // initialize condition variable in situ
     Concurrency::details::create_stl_condition_variable(cond->_get_cv());
 }
@@ -69,15 +76,43 @@ int _Cnd_timedwait(const _Cnd_t cond, const _Mtx_t mtx, const xtime* const targe
         cond->_get_cv()->wait(cs);
         _Mtx_reset_owner(mtx);
     } else { // target time specified, wait for it
-        xtime now;
-        xtime_get(&now, TIME_UTC);
+        const long long deadline = std::_Xtime_to_ticks(target);
+        long long remaining      = deadline - _Xtime_get_ticks();
+        bool notified            = false;
         _Mtx_clear_owner(mtx);
-        if (!cond->_get_cv()->wait_for(cs, _Xtime_diff_to_millis2(target, &now))) { // report timeout
-            xtime_get(&now, TIME_UTC);
-            if (_Xtime_diff_to_millis2(target, &now) == 0) {
+        if (remaining > std::_Precise_spin_limit) {
+            // a high resolution timer wakes all waiters shortly before the deadline, which they see as spurious
+            const auto cv           = cond->_get_cv();
+            const auto timer        = std::_Acquire_precise_timer();
+            const unsigned long ms  = std::_Ticks_to_milliseconds(remaining);
+            const long long timeout = remaining - std::_Precise_spin_limit;
+            if (timer && std::_Arm_precise_timer_callback(*timer, timeout, &_Wake_all_for_timeout, cv)) {
+                notified = cv->wait_for(cs, ms); // the timeout in milliseconds is only a backstop
+                if (std::_Disarm_precise_timer_callback(*timer)) {
+                    notified = false;
+                }
+            } else {
+                notified = cv->wait_for(cs, ms);
+            }
+
+            std::_Release_precise_timer(timer);
+            remaining = deadline - _Xtime_get_ticks();
+        }
+
+        if (!notified) {
+            if (remaining > 0 && remaining <= std::_Precise_spin_limit) {
+                // spin for the rest, without holding the mutex
+                cs->unlock();
+                std::_Spin_until_ticks(deadline);
+                cs->lock();
+                remaining = 0;
+            }
+
+            if (remaining <= 0) { // report timeout
                 res = _Thrd_timedout;
             }
         }
+
         _Mtx_reset_owner(mtx);
     }
     return res;
@@ -13,6 +13,7 @@
 #include <Windows.h>
 
 #include "awint.hpp"
+#include "precise_timer.hpp"
 
 namespace {
     using _Thrd_start_t = int (*)(void*);
@@ -70,12 +71,35 @@ int _Thrd_detach(_Thrd_t thr) { // tell OS to release thread's resources when it
 }
 
 void _Thrd_sleep(const xtime* xt) { // suspend thread until time xt
-    xtime now;
-    xtime_get(&now, TIME_UTC);
-    do { // sleep and check time
-        Sleep(_Xtime_diff_to_millis2(xt, &now));
-        xtime_get(&now, TIME_UTC);
-    } while (now.sec < xt->sec || now.sec == xt->sec && now.nsec < xt->nsec);
+    const long long target     = std::_Xtime_to_ticks(xt);
+    std::_Precise_timer* timer = nullptr;
+    bool timer_acquired        = false;
+    for (;;) { // sleep and check time
+        const long long remaining = target - _Xtime_get_ticks();
+        if (remaining <= 0) {
+            break;
+        }
+
+        if (remaining <= std::_Precise_spin_limit) {
+            std::_Spin_until_ticks(target);
+            break;
+        }
+
+        if (!timer_acquired) {
+            timer          = std::_Acquire_precise_timer();
+            timer_acquired = true;
+        }
+
+        // wake up shortly before the deadline, and spin for the rest
+        const long long timeout = remaining - std::_Precise_spin_limit;
+        if (timer && std::_Set_precise_timer(*timer, timeout)) {
+            WaitForSingleObject(timer->_Handle, INFINITE);
+        } else {
+            Sleep(std::_Ticks_to_milliseconds(timeout));
+        }
+    }
+
+    std::_Release_precise_timer(timer);
 }
 
 void _Thrd_yield() { // surrender remainder of timeslice
@@ -99,7 +123,22 @@ _Thrd_id_t _Thrd_id() { // return unique id for current thread
     return GetCurrentThreadId();
 }
 
-unsigned int _Thrd_hardware_concurrency() { // return number of processors
+unsigned int _Thrd_hardware_concurrency() { // return number of processors in all processor groups
+#if _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+    const DWORD count = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+#else // ^^^ _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7 / _STL_WIN32_WINNT < _WIN32_WINNT_WIN7 vvv
+    // processor groups were introduced in Windows 7
+    using PFNGETACTIVEPROCESSORCOUNT = DWORD(WINAPI*)(WORD);
+    const HMODULE kernel32           = GetModuleHandleW(L"kernel32.dll");
+    const auto pfGetActiveProcessorCount =
+        kernel32 ? reinterpret_cast<PFNGETACTIVEPROCESSORCOUNT>(GetProcAddress(kernel32, "GetActiveProcessorCount"))
+                 : nullptr;
+    const DWORD count = pfGetActiveProcessorCount ? pfGetActiveProcessorCount(ALL_PROCESSOR_GROUPS) : 0;
+#endif // ^^^ _STL_WIN32_WINNT < _WIN32_WINNT_WIN7 ^^^
+    if (count != 0) {
+        return count;
+    }
+
     SYSTEM_INFO info;
     GetNativeSystemInfo(&info);
     return info.dwNumberOfProcessors;
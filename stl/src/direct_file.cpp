@@ -0,0 +1,267 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// direct_file.cpp -- Win32 file I/O for stdext::basic_direct_filebuf and stdext::mapped_file
+
+// This must be as small as possible, because its contents are
+// injected into the msvcprt.lib and msvcprtd.lib import libraries.
+// Do not include or define anything else here.
+// In particular, basic_string must not be included here.
+
+#include <__msvc_direct_file_abi.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <xfilesystem_abi.h>
+
+#include <Windows.h>
+
+namespace {
+    // the ios_base::openmode bits, which can't be named here without including <xiosbase>
+    constexpr int _Mode_in        = 0x01;
+    constexpr int _Mode_out       = 0x02;
+    constexpr int _Mode_ate       = 0x04;
+    constexpr int _Mode_app       = 0x08;
+    constexpr int _Mode_trunc     = 0x10;
+    constexpr int _Mode_binary    = 0x20;
+    constexpr int _Mode_nocreate  = 0x40;
+    constexpr int _Mode_noreplace = 0x80;
+
+    // transfers are split so that each fits in the DWORD taken by ReadFile() and WriteFile()
+    constexpr size_t _Max_transfer = 0x4000'0000;
+
+    [[nodiscard]] HANDLE _Open(const wchar_t* const _File_name, int _Mode) noexcept {
+        // the valid combinations are those accepted by _Fiopen(); app implies out, and binary is assumed
+        if (_Mode & _Mode_app) {
+            _Mode |= _Mode_out;
+        }
+
+        const int _Flags = _Mode & ~(_Mode_ate | _Mode_binary | _Mode_nocreate | _Mode_noreplace);
+        unsigned long _Access;
+        unsigned long _Disposition;
+        switch (_Flags) {
+        case _Mode_in:
+            _Access      = GENERIC_READ;
+            _Disposition = OPEN_EXISTING;
+            break;
+        case _Mode_out:
+        case _Mode_out | _Mode_trunc:
+            _Access      = GENERIC_WRITE;
+            _Disposition = CREATE_ALWAYS;
+            break;
+        case _Mode_out | _Mode_app:
+            _Access      = FILE_GENERIC_WRITE & ~FILE_WRITE_DATA; // every write goes to the end of the file
+            _Disposition = OPEN_ALWAYS;
+            break;
+        case _Mode_in | _Mode_out:
+            _Access      = GENERIC_READ | GENERIC_WRITE;
+            _Disposition = OPEN_EXISTING;
+            break;
+        case _Mode_in | _Mode_out | _Mode_trunc:
+            _Access      = GENERIC_READ | GENERIC_WRITE;
+            _Disposition = CREATE_ALWAYS;
+            break;
+        case _Mode_in | _Mode_out | _Mode_app:
+            _Access      = GENERIC_READ | (FILE_GENERIC_WRITE & ~FILE_WRITE_DATA);
+            _Disposition = OPEN_ALWAYS;
+            break;
+        default:
+            return INVALID_HANDLE_VALUE;
+        }
+
+        if (_Mode & _Mode_nocreate) { // extension -- the file must exist
+            if (_Disposition == CREATE_ALWAYS) {
+                _Disposition = TRUNCATE_EXISTING;
+            } else {
+                _Disposition = OPEN_EXISTING;
+            }
+        } else if ((_Mode & _Mode_noreplace) && (_Mode & _Mode_out)) { // extension -- the file must not exist
+            _Disposition = CREATE_NEW;
+        }
+
+        const unsigned long _Attributes =
+            FILE_ATTRIBUTE_NORMAL | ((_Mode & _Mode_out) == 0 ? FILE_FLAG_SEQUENTIAL_SCAN : 0);
+#ifdef _CRT_APP
+        CREATEFILE2_EXTENDED_PARAMETERS _Create_file_parameters{};
+        _Create_file_parameters.dwSize           = sizeof(_Create_file_parameters);
+        _Create_file_parameters.dwFileAttributes = _Attributes & 0x0000FFFFU;
+        _Create_file_parameters.dwFileFlags      = _Attributes & 0xFFFF0000U;
+        const HANDLE _Handle = CreateFile2(
+            _File_name, _Access, FILE_SHARE_READ | FILE_SHARE_WRITE, _Disposition, &_Create_file_parameters);
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+        const HANDLE _Handle = CreateFileW(
+            _File_name, _Access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, _Disposition, _Attributes, nullptr);
+#endif // _CRT_APP
+        if (_Handle == INVALID_HANDLE_VALUE) {
+            return _Handle;
+        }
+
+        if (_Mode & _Mode_ate) {
+            LARGE_INTEGER _Zero{};
+            if (SetFilePointerEx(_Handle, _Zero, nullptr, FILE_END) == 0) {
+                CloseHandle(_Handle);
+                return INVALID_HANDLE_VALUE;
+            }
+        }
+
+        return _Handle;
+    }
+
+    [[nodiscard]] __std_direct_file_handle _To_direct_handle(const HANDLE _Handle) noexcept {
+        return static_cast<__std_direct_file_handle>(reinterpret_cast<intptr_t>(_Handle));
+    }
+
+    [[nodiscard]] __std_mapped_file_view _Map(const wchar_t* const _File_name) noexcept {
+        const HANDLE _File = _Open(_File_name, _Mode_in);
+        if (_File == INVALID_HANDLE_VALUE) {
+            return {nullptr, 0, false};
+        }
+
+        __std_mapped_file_view _Result{nullptr, 0, false};
+        LARGE_INTEGER _File_size;
+        if (GetFileSizeEx(_File, &_File_size) != 0
+            && static_cast<unsigned long long>(_File_size.QuadPart) <= SIZE_MAX) {
+            if (_File_size.QuadPart == 0) { // empty files can't be mapped
+                _Result._Success = true;
+            } else {
+#ifdef _CRT_APP
+                const HANDLE _Mapping = CreateFileMappingFromApp(_File, nullptr, PAGE_READONLY, 0, nullptr);
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+                const HANDLE _Mapping = CreateFileMappingW(_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+#endif // _CRT_APP
+                if (_Mapping) { // the view keeps the mapping alive after its handle is closed
+#ifdef _CRT_APP
+                    const void* const _View = MapViewOfFileFromApp(_Mapping, FILE_MAP_READ, 0, 0);
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+                    const void* const _View = MapViewOfFile(_Mapping, FILE_MAP_READ, 0, 0, 0);
+#endif // _CRT_APP
+                    if (_View) {
+                        _Result = {_View, static_cast<size_t>(_File_size.QuadPart), true};
+                    }
+
+                    CloseHandle(_Mapping);
+                }
+            }
+        }
+
+        CloseHandle(_File);
+        return _Result;
+    }
+
+    [[nodiscard]] wchar_t* _Widen_file_name(const char* const _File_name) noexcept {
+        // convert with the code page used for narrow file names by <filesystem>; free() the result
+        const __std_code_page _Code_page = __std_fs_code_page();
+        const auto _Len = __std_fs_convert_narrow_to_wide(_Code_page, _File_name, -1, nullptr, 0)._Len;
+        if (_Len == 0) {
+            return nullptr;
+        }
+
+        const auto _Wide_name = static_cast<wchar_t*>(_CSTD malloc(static_cast<size_t>(_Len) * sizeof(wchar_t)));
+        if (_Wide_name && __std_fs_convert_narrow_to_wide(_Code_page, _File_name, -1, _Wide_name, _Len)._Len == 0) {
+            _CSTD free(_Wide_name);
+            return nullptr;
+        }
+
+        return _Wide_name;
+    }
+} // unnamed namespace
+
+_EXTERN_C
+[[nodiscard]] __std_direct_file_handle __CLRCALL_PURE_OR_STDCALL __std_direct_file_open(
+    _In_z_ const wchar_t* const _File_name, const int _Mode) noexcept {
+    return _To_direct_handle(_Open(_File_name, _Mode));
+}
+
+[[nodiscard]] __std_direct_file_handle __CLRCALL_PURE_OR_STDCALL __std_direct_file_open_narrow(
+    _In_z_ const char* const _File_name, const int _Mode) noexcept {
+    const auto _Wide_name = _Widen_file_name(_File_name);
+    if (!_Wide_name) {
+        return __std_direct_file_handle::_Invalid;
+    }
+
+    const auto _Result = _To_direct_handle(_Open(_Wide_name, _Mode));
+    _CSTD free(_Wide_name);
+    return _Result;
+}
+
+[[nodiscard]] bool __CLRCALL_PURE_OR_STDCALL __std_direct_file_close(const __std_direct_file_handle _Handle) noexcept {
+    return CloseHandle(reinterpret_cast<HANDLE>(_Handle)) != 0;
+}
+
+[[nodiscard]] size_t __CLRCALL_PURE_OR_STDCALL __std_direct_file_read(const __std_direct_file_handle _Handle,
+    _Out_writes_bytes_to_(_Size, return) void* const _Buf, const size_t _Size) noexcept {
+    unsigned long _Read = 0;
+    const auto _Request = static_cast<unsigned long>(_Size < _Max_transfer ? _Size : _Max_transfer);
+    if (ReadFile(reinterpret_cast<HANDLE>(_Handle), _Buf, _Request, &_Read, nullptr) == 0) {
+        return 0; // including ERROR_BROKEN_PIPE, which is the end of a pipe
+    }
+
+    return _Read;
+}
+
+[[nodiscard]] bool __CLRCALL_PURE_OR_STDCALL __std_direct_file_write(const __std_direct_file_handle _Handle,
+    _In_reads_bytes_(_Size) const void* const _Buf, size_t _Size) noexcept {
+    auto _Next = static_cast<const char*>(_Buf);
+    while (_Size != 0) {
+        unsigned long _Written = 0;
+        const auto _Request    = static_cast<unsigned long>(_Size < _Max_transfer ? _Size : _Max_transfer);
+        if (WriteFile(reinterpret_cast<HANDLE>(_Handle), _Next, _Request, &_Written, nullptr) == 0 || _Written == 0) {
+            return false;
+        }
+
+        _Next += _Written;
+        _Size -= _Written;
+    }
+
+    return true;
+}
+
+[[nodiscard]] long long __CLRCALL_PURE_OR_STDCALL __std_direct_file_seek(
+    const __std_direct_file_handle _Handle, const long long _Offset, const int _Way) noexcept {
+    unsigned long _Method;
+    switch (_Way) {
+    case SEEK_SET:
+        _Method = FILE_BEGIN;
+        break;
+    case SEEK_CUR:
+        _Method = FILE_CURRENT;
+        break;
+    case SEEK_END:
+        _Method = FILE_END;
+        break;
+    default:
+        return -1;
+    }
+
+    LARGE_INTEGER _Distance;
+    _Distance.QuadPart = _Offset;
+    LARGE_INTEGER _New_position;
+    if (SetFilePointerEx(reinterpret_cast<HANDLE>(_Handle), _Distance, &_New_position, _Method) == 0) {
+        return -1;
+    }
+
+    return _New_position.QuadPart;
+}
+
+[[nodiscard]] __std_mapped_file_view __CLRCALL_PURE_OR_STDCALL __std_mapped_file_map(
+    _In_z_ const wchar_t* const _File_name) noexcept {
+    return _Map(_File_name);
+}
+
+[[nodiscard]] __std_mapped_file_view __CLRCALL_PURE_OR_STDCALL __std_mapped_file_map_narrow(
+    _In_z_ const char* const _File_name) noexcept {
+    const auto _Wide_name = _Widen_file_name(_File_name);
+    if (!_Wide_name) {
+        return {nullptr, 0, false};
+    }
+
+    const auto _Result = _Map(_Wide_name);
+    _CSTD free(_Wide_name);
+    return _Result;
+}
+
+void __CLRCALL_PURE_OR_STDCALL __std_mapped_file_unmap(const void* const _Data) noexcept {
+    if (_Data) {
+        UnmapViewOfFile(_Data);
+    }
+}
+_END_EXTERN_C
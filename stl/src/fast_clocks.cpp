@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement stdext::chrono::coarse_steady_clock and stdext::chrono::tsc_clock
+
+// clang-format off
+
+#include <intrin.h>
+#include <Windows.h>
+
+// clang-format on
+
+// same layout as the declaration in <xtimec.h>
+struct __std_tsc_calibration {
+    unsigned long long _Tsc_base;
+    long long _Nsec_base;
+    unsigned long long _Multiplier;
+};
+
+namespace {
+    constexpr long long _Nsec_per_sec = 1'000'000'000;
+
+    [[nodiscard]] long long _Qpc_to_nanoseconds(const long long _Ctr, const long long _Freq) noexcept {
+        // the same conversion as steady_clock::now(), so that tsc_clock shares its epoch
+        return (_Ctr / _Freq) * _Nsec_per_sec + (_Ctr % _Freq) * _Nsec_per_sec / _Freq;
+    }
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    [[nodiscard]] bool _Has_invariant_tsc() noexcept {
+        int _Regs[4];
+        __cpuid(_Regs, static_cast<int>(0x8000'0000U));
+        if (static_cast<unsigned int>(_Regs[0]) < 0x8000'0007U) {
+            return false;
+        }
+
+        __cpuid(_Regs, static_cast<int>(0x8000'0007U));
+        // EDX bit 8: the time stamp counter runs at a constant rate in all ACPI P-, C-, and T-states
+        return (_Regs[3] & (1 << 8)) != 0;
+    }
+
+    [[nodiscard]] bool _Calibrate(__std_tsc_calibration& _Result) noexcept {
+        if (!_Has_invariant_tsc()) {
+            return false;
+        }
+
+        LARGE_INTEGER _Freq;
+        LARGE_INTEGER _Qpc_first;
+        LARGE_INTEGER _Qpc_last;
+        QueryPerformanceFrequency(&_Freq); // always succeeds
+        QueryPerformanceCounter(&_Qpc_first);
+        const unsigned long long _Tsc_first = __rdtsc();
+
+        // spin for 10 ms, which bounds the error of the rate to about 10 microseconds per second
+        unsigned long long _Tsc_last;
+        do {
+            QueryPerformanceCounter(&_Qpc_last);
+            _Tsc_last = __rdtsc();
+        } while (_Qpc_last.QuadPart - _Qpc_first.QuadPart < _Freq.QuadPart / 100);
+
+        const double _Ticks = static_cast<double>(_Tsc_last - _Tsc_first);
+        const double _Nsecs = static_cast<double>(_Qpc_last.QuadPart - _Qpc_first.QuadPart)
+                            * static_cast<double>(_Nsec_per_sec) / static_cast<double>(_Freq.QuadPart);
+        if (_Ticks <= 0.0) {
+            return false;
+        }
+
+        _Result._Tsc_base   = _Tsc_last;
+        _Result._Nsec_base  = _Qpc_to_nanoseconds(_Qpc_last.QuadPart, _Freq.QuadPart);
+        _Result._Multiplier = static_cast<unsigned long long>(_Nsecs / _Ticks * 4294967296.0); // 2^32
+        return _Result._Multiplier != 0;
+    }
+#else // ^^^ x86 or x64 / other architectures vvv
+    [[nodiscard]] bool _Calibrate(__std_tsc_calibration&) noexcept {
+        return false;
+    }
+#endif // ^^^ other architectures ^^^
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] long long __stdcall __std_coarse_steady_clock_ticks() noexcept {
+    return static_cast<long long>(GetTickCount64());
+}
+
+[[nodiscard]] const __std_tsc_calibration* __stdcall __std_tsc_calibrate() noexcept {
+    static __std_tsc_calibration _Calibration;
+    static const bool _Usable = _Calibrate(_Calibration);
+    return _Usable ? &_Calibration : nullptr;
+}
+
+} // extern "C"
@@ -19,6 +19,8 @@
 #include <Windows.h>
 #include <winioctl.h>
 
+#include "tracelogging.hpp"
+
 // We have several switches that do not have case statements for every possible enum value.
 // Hence, disabling this warning.
 #pragma warning(disable : 4061) // enumerator '__std_win_error::_Success' in switch of enum
@@ -66,13 +68,57 @@ namespace {
         return __std_win_error{GetLastError()};
     }
 
+    struct _Copy_progress { // the caller's progress callback, passed to CopyFile2 or CopyFileExW as context
+        __std_fs_copy_file_progress _Callback;
+        void* _Context;
+    };
+
+#if defined(_CRT_APP)
+    COPYFILE2_MESSAGE_ACTION __stdcall _Copyfile2_progress_routine(
+        const COPYFILE2_MESSAGE* const _Message, void* const _Data) noexcept {
+        if (_Message->Type == COPYFILE2_CALLBACK_CHUNK_FINISHED) {
+            const auto& _Chunk    = _Message->Info.ChunkFinished;
+            const auto& _Progress = *static_cast<const _Copy_progress*>(_Data);
+            if (!_Progress._Callback(_Chunk.uliTotalBytesTransferred.QuadPart, _Chunk.uliTotalFileSize.QuadPart,
+                    _Progress._Context)) {
+                return COPYFILE2_PROGRESS_CANCEL;
+            }
+        }
+
+        return COPYFILE2_PROGRESS_CONTINUE;
+    }
+#else // ^^^ defined(_CRT_APP) ^^^ // vvv !defined(_CRT_APP) vvv
+    DWORD __stdcall _Copyfile_progress_routine(const LARGE_INTEGER _Total_file_size,
+        const LARGE_INTEGER _Total_bytes_transferred, LARGE_INTEGER, LARGE_INTEGER, DWORD, DWORD, HANDLE, HANDLE,
+        void* const _Data) noexcept {
+        const auto& _Progress = *static_cast<const _Copy_progress*>(_Data);
+        if (!_Progress._Callback(static_cast<unsigned long long>(_Total_bytes_transferred.QuadPart),
+                static_cast<unsigned long long>(_Total_file_size.QuadPart), _Progress._Context)) {
+            return PROGRESS_CANCEL;
+        }
+
+        return PROGRESS_CONTINUE;
+    }
+#endif // defined(_CRT_APP)
+
     // FUNCTION __vcp_CopyFile
-    [[nodiscard]] __std_fs_copy_file_result __stdcall __vcp_Copyfile(
-        const wchar_t* const _Source, const wchar_t* const _Target, const bool _Fail_if_exists) noexcept {
+    [[nodiscard]] __std_fs_copy_file_result __stdcall __vcp_Copyfile(const wchar_t* const _Source,
+        const wchar_t* const _Target, const bool _Fail_if_exists, const __std_fs_copy_file_flags _Flags,
+        _Copy_progress* const _Progress) noexcept {
+        // _Progress is null when the caller does not want progress reports
+        DWORD _Copy_flags = static_cast<DWORD>(_Flags);
+        if (_Fail_if_exists) {
+            _Copy_flags |= COPY_FILE_FAIL_IF_EXISTS;
+        }
+
 #if defined(_CRT_APP)
         COPYFILE2_EXTENDED_PARAMETERS _Params{};
         _Params.dwSize      = sizeof(_Params);
-        _Params.dwCopyFlags = _Fail_if_exists ? COPY_FILE_FAIL_IF_EXISTS : 0;
+        _Params.dwCopyFlags = _Copy_flags;
+        if (_Progress) {
+            _Params.pProgressRoutine  = _Copyfile2_progress_routine;
+            _Params.pvCallbackContext = _Progress;
+        }
 
         const HRESULT _Copy_result = CopyFile2(_Source, _Target, &_Params);
         if (SUCCEEDED(_Copy_result)) {
@@ -82,7 +128,8 @@ namespace {
         // take lower bits to undo HRESULT_FROM_WIN32
         return {false, __std_win_error{_Copy_result & 0x0000FFFFU}};
 #else // ^^^ defined(_CRT_APP) ^^^ // vvv !defined(_CRT_APP) vvv
-        if (CopyFileW(_Source, _Target, _Fail_if_exists)) {
+        if (CopyFileExW(_Source, _Target, _Progress ? _Copyfile_progress_routine : nullptr, _Progress, nullptr,
+                _Copy_flags)) {
             return {true, __std_win_error::_Success};
         }
 
@@ -129,7 +176,238 @@ namespace {
 
         return __std_win_error{GetLastError()};
     }
+
+    [[nodiscard]] __std_win_error __stdcall _Delete_by_handle(const HANDLE _Handle) noexcept {
+        // mark the file or directory open as _Handle, which has DELETE access, for deletion
+
+        // From newer Windows SDK than currently used to build vctools:
+        // #define FILE_DISPOSITION_FLAG_DELETE                     0x00000001
+        // #define FILE_DISPOSITION_FLAG_POSIX_SEMANTICS            0x00000002
+
+        // typedef struct _FILE_DISPOSITION_INFO_EX {
+        //     DWORD Flags;
+        // } FILE_DISPOSITION_INFO_EX, *PFILE_DISPOSITION_INFO_EX;
+
+        struct _File_disposition_info_ex {
+            DWORD _Flags;
+        };
+        _File_disposition_info_ex _Info_ex{0x3};
+
+        // FileDispositionInfoEx isn't documented in MSDN at the time of this writing, but is present
+        // in minwinbase.h as of at least 10.0.16299.0
+        constexpr auto _FileDispositionInfoExClass = static_cast<FILE_INFO_BY_HANDLE_CLASS>(21);
+        if (SetFileInformationByHandle(_Handle, _FileDispositionInfoExClass, &_Info_ex, sizeof(_Info_ex))) {
+            return __std_win_error::_Success;
+        }
+
+        const __std_win_error _Last_error{GetLastError()};
+        switch (_Last_error) {
+        case __std_win_error::_Invalid_parameter: // Older Windows versions
+        case __std_win_error::_Invalid_function: // Windows 10 1607
+        case __std_win_error::_Not_supported: // POSIX delete not supported by the file system
+            break; // try non-POSIX delete below
+        default:
+            return _Last_error;
+        }
+
+        FILE_DISPOSITION_INFO _Info{/* .Delete= */ TRUE};
+        if (SetFileInformationByHandle(_Handle, FileDispositionInfo, &_Info, sizeof(_Info))) {
+            return __std_win_error::_Success;
+        }
+
+        return __std_win_error{GetLastError()};
+    }
+
+#ifndef _CRT_APP
+    // FUNCTION _Remove_tree_by_handle
+    constexpr int _Remove_tree_retry_count        = 10;
+    constexpr DWORD _Remove_tree_buffer_size      = 64 * 1024;
+    constexpr DWORD _Remove_tree_share            = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+    constexpr DWORD _Remove_tree_open_flags       = FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OPEN_REPARSE_POINT;
+    constexpr DWORD _Remove_tree_directory_access = DELETE | FILE_LIST_DIRECTORY | SYNCHRONIZE;
+
+    [[nodiscard]] bool _Is_by_id_unsupported(const __std_win_error _Err) noexcept {
+        // test if _Err is how the file system reports that it can't enumerate or open files by ID
+        return _Err == __std_win_error::_Invalid_parameter || _Err == __std_win_error::_Invalid_function
+            || _Err == __std_win_error::_Not_supported;
+    }
+
+    [[nodiscard]] __std_win_error __stdcall _Remove_tree_by_handle(
+        HANDLE _Directory, unsigned long long* _Removed) noexcept;
+
+    [[nodiscard]] __std_win_error __stdcall _Remove_tree_entry(const HANDLE _Directory,
+        const FILE_ID_BOTH_DIR_INFO& _Entry, unsigned long long* const _Removed) noexcept {
+        // remove the child _Entry of _Directory, opening it by its file ID instead of by name
+        const auto _Name_length = _Entry.FileNameLength / sizeof(wchar_t);
+        if (_Entry.FileName[0] == L'.' && (_Name_length == 1 || (_Name_length == 2 && _Entry.FileName[1] == L'.'))) {
+            return __std_win_error::_Success;
+        }
+
+        if (_Entry.FileId.QuadPart == 0 || _Entry.FileId.QuadPart == -1) {
+            // no ID, or FILE_INVALID_FILE_ID for an ID that needs more than 64 bits
+            return __std_win_error::_Not_supported;
+        }
+
+        // reparse points are removed rather than followed
+        const bool _Is_directory = (_Entry.FileAttributes & (FILE_ATTRIBUTE_DIRECTORY | FILE_ATTRIBUTE_REPARSE_POINT))
+                                == FILE_ATTRIBUTE_DIRECTORY;
+        FILE_ID_DESCRIPTOR _Id{};
+        _Id.dwSize = sizeof(_Id);
+        _Id.Type   = FileIdType;
+        _Id.FileId = _Entry.FileId;
+        const DWORD _Access = _Is_directory ? _Remove_tree_directory_access : DELETE;
+        const _STD _Fs_file _Child(
+            OpenFileById(_Directory, &_Id, _Access, _Remove_tree_share, nullptr, _Remove_tree_open_flags));
+        if (_Child._Get() == INVALID_HANDLE_VALUE) {
+            const __std_win_error _Last_error{GetLastError()};
+            if (_Is_by_id_unsupported(_Last_error)) {
+                // also reported when the file was removed by someone else after the enumeration; the caller
+                // finishes by name either way
+                return __std_win_error::_Not_supported;
+            }
+
+            return _Translate_not_found_to_success(_Last_error);
+        }
+
+        if (_Is_directory) {
+            return _Remove_tree_by_handle(_Child._Get(), _Removed);
+        }
+
+        const auto _Last_error = _Delete_by_handle(_Child._Get());
+        if (_Last_error == __std_win_error::_Success) {
+            ++*_Removed;
+        }
+
+        return _Last_error;
+    }
+
+    [[nodiscard]] __std_win_error __stdcall _Remove_tree_by_handle(
+        const HANDLE _Directory, unsigned long long* const _Removed) noexcept {
+        // remove the contents of the directory open as _Directory, then the directory itself; the children are
+        // enumerated from the directory handle and opened by file ID, so no paths are built or parsed
+        __crt_unique_heap_ptr<unsigned char> _Buffer(_malloc_crt_t(unsigned char, _Remove_tree_buffer_size));
+        if (!_Buffer) {
+            return __std_win_error::_Not_enough_memory;
+        }
+
+        for (int _Retry = 1;; ++_Retry) {
+            auto _Info_class = FileIdBothDirectoryRestartInfo;
+            for (;;) {
+                if (!GetFileInformationByHandleEx(_Directory, _Info_class, _Buffer.get(), _Remove_tree_buffer_size)) {
+                    const __std_win_error _Last_error{GetLastError()};
+                    if (_Last_error == __std_win_error::_No_more_files) {
+                        break;
+                    }
+
+                    if (_Is_by_id_unsupported(_Last_error)) {
+                        return __std_win_error::_Not_supported;
+                    }
+
+                    return _Last_error;
+                }
+
+                _Info_class = FileIdBothDirectoryInfo;
+                auto _Entry = reinterpret_cast<const FILE_ID_BOTH_DIR_INFO*>(_Buffer.get());
+                for (;;) {
+                    const auto _Last_error = _Remove_tree_entry(_Directory, *_Entry, _Removed);
+                    if (_Last_error != __std_win_error::_Success) {
+                        return _Last_error;
+                    }
+
+                    if (_Entry->NextEntryOffset == 0) {
+                        break;
+                    }
+
+                    _Entry = reinterpret_cast<const FILE_ID_BOTH_DIR_INFO*>(
+                        reinterpret_cast<const unsigned char*>(_Entry) + _Entry->NextEntryOffset);
+                }
+            }
+
+            const auto _Last_error = _Delete_by_handle(_Directory);
+            if (_Last_error == __std_win_error::_Success) {
+                ++*_Removed;
+                return __std_win_error::_Success;
+            }
+
+            // retry up to _Remove_tree_retry_count for resilience against A/V tools, search indexers, backup tools,
+            // etc. holding handles to children, or children that were added while we enumerated
+            if (_Retry == _Remove_tree_retry_count
+                || (_Last_error != __std_win_error::_Directory_not_empty
+                    && _Last_error != __std_win_error::_Access_denied)) {
+                return _Last_error;
+            }
+        }
+    }
+#endif // _CRT_APP
+
+#ifndef _CRT_APP
+    // ReadDirectoryChangesExW and FILE_NOTIFY_EXTENDED_INFORMATION are available from Windows 10 version 1709 on, and
+    // are declared only when targeting it
+    struct _File_notify_extended_information { // typedef struct _FILE_NOTIFY_EXTENDED_INFORMATION {
+        DWORD _Next_entry_offset; //     DWORD NextEntryOffset;
+        DWORD _Action; //     DWORD Action;
+        LARGE_INTEGER _Creation_time; //     LARGE_INTEGER CreationTime;
+        LARGE_INTEGER _Last_modification_time; //     LARGE_INTEGER LastModificationTime;
+        LARGE_INTEGER _Last_change_time; //     LARGE_INTEGER LastChangeTime;
+        LARGE_INTEGER _Last_access_time; //     LARGE_INTEGER LastAccessTime;
+        LARGE_INTEGER _Allocated_length; //     LARGE_INTEGER AllocatedLength;
+        LARGE_INTEGER _File_size; //     LARGE_INTEGER FileSize;
+        DWORD _File_attributes; //     DWORD FileAttributes;
+        DWORD _Reparse_point_tag; //     union { DWORD ReparsePointTag; DWORD EaSize; };
+        LARGE_INTEGER _File_id; //     LARGE_INTEGER FileId;
+        LARGE_INTEGER _Parent_file_id; //     LARGE_INTEGER ParentFileId;
+        DWORD _File_name_length; //     DWORD FileNameLength;
+        WCHAR _File_name[1]; //     WCHAR FileName[1];
+    }; // } FILE_NOTIFY_EXTENDED_INFORMATION, *PFILE_NOTIFY_EXTENDED_INFORMATION;
+
+    constexpr int _Read_directory_notify_extended_information = 2; // ReadDirectoryNotifyExtendedInformation
+
+    using _Read_directory_changes_ex_t = BOOL(__stdcall*)(HANDLE, LPVOID, DWORD, BOOL, DWORD, LPDWORD, LPOVERLAPPED,
+        LPOVERLAPPED_COMPLETION_ROUTINE, int /* READ_DIRECTORY_NOTIFY_INFORMATION_CLASS */);
+
+    // the largest buffer ReadDirectoryChanges accepts for directories on network shares
+    constexpr DWORD _Watch_buffer_size = 64 * 1024;
+
+    constexpr ULONG_PTR _Watch_cancel_key = 1; // completion key of the packets __std_fs_watch_cancel posts
+#endif // _CRT_APP
+} // unnamed namespace
+
+#ifndef _CRT_APP
+struct __std_fs_watch {
+    HANDLE _Directory;
+    HANDLE _Port; // I/O completion port that receives the completed requests and the cancellations
+    _Read_directory_changes_ex_t _Read_ex; // null when only ReadDirectoryChangesW is available
+    DWORD _Filter;
+    BOOL _Recursive;
+    bool _Pending; // a request is filling _Buffers[_Filling]
+    unsigned char _Filling;
+    const unsigned char* _Next; // the next record of the batch returned by the last wait, or null
+    OVERLAPPED _Overlapped;
+    alignas(8) unsigned char _Buffers[2][_Watch_buffer_size]; // one is filled while the other is read
+};
+
+namespace {
+    [[nodiscard]] __std_win_error _Start_watch_request(__std_fs_watch& _Watch) noexcept {
+        _Watch._Overlapped  = {};
+        void* const _Buffer = _Watch._Buffers[_Watch._Filling];
+        BOOL _Started;
+        if (_Watch._Read_ex) {
+            _Started = _Watch._Read_ex(_Watch._Directory, _Buffer, _Watch_buffer_size, _Watch._Recursive,
+                _Watch._Filter, nullptr, &_Watch._Overlapped, nullptr, _Read_directory_notify_extended_information);
+        } else {
+            _Started = ReadDirectoryChangesW(_Watch._Directory, _Buffer, _Watch_buffer_size, _Watch._Recursive,
+                _Watch._Filter, nullptr, &_Watch._Overlapped, nullptr);
+        }
+
+        if (!_Started) {
+            return __std_win_error{GetLastError()};
+        }
+
+        _Watch._Pending = true;
+        return __std_win_error::_Success;
+    }
 } // unnamed namespace
+#endif // _CRT_APP
 
 _EXTERN_C
 
@@ -142,6 +420,7 @@ _EXTERN_C
 [[nodiscard]] __std_win_error __stdcall __std_fs_open_handle(_Out_ __std_fs_file_handle* const _Handle,
     _In_z_ const wchar_t* const _File_name, _In_ const __std_access_rights _Desired_access,
     _In_ const __std_fs_file_flags _Flags) noexcept { // calls CreateFile2 or CreateFileW
+    _STL_TRACE_FILESYSTEM_CALL("OpenHandle", _File_name);
     const HANDLE _Result = __vcp_CreateFile(_File_name, static_cast<unsigned long>(_Desired_access),
         FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
         static_cast<unsigned long>(_Flags), nullptr);
@@ -184,16 +463,20 @@ static_assert(alignof(WIN32_FIND_DATAW) == alignof(__std_fs_find_data));
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_directory_iterator_open(_In_z_ const wchar_t* const _Path_spec,
     _Inout_ __std_fs_dir_handle* const _Handle, _Out_ __std_fs_find_data* const _Results) noexcept {
+    _STL_TRACE_FILESYSTEM_CALL("DirectoryIteratorOpen", _Path_spec);
     __std_fs_directory_iterator_close(*_Handle);
-    *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(
-        FindFirstFileExW(_Path_spec, FindExInfoBasic, _Results, FindExSearchNameMatch, nullptr, 0))};
+    // FIND_FIRST_EX_LARGE_FETCH makes FindNextFileW hand out entries from a large buffer that is filled with
+    // one request to the file system, which matters most for directories on network shares.
+    *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(FindFirstFileExW(_Path_spec, FindExInfoBasic, _Results,
+        FindExSearchNameMatch, nullptr, 0x2 /* FIND_FIRST_EX_LARGE_FETCH */))};
     if (*_Handle != __std_fs_dir_handle::_Invalid) {
         return __std_win_error::_Success;
     }
 
 #if _STL_WIN32_WINNT < _WIN32_WINNT_WIN7
     // If the above call failed, we might be on pre Windows 7 / Windows Server 2008 R2, which doesn't support
-    // FindExInfoBasic; try again with FindExInfoStandard if we got an invalid parameter error.
+    // FindExInfoBasic or FIND_FIRST_EX_LARGE_FETCH; try again with FindExInfoStandard and no flags if we got an
+    // invalid parameter error.
     const __std_win_error _Last_error{GetLastError()};
     if (_Last_error != __std_win_error::_Not_supported && _Last_error != __std_win_error::_Invalid_parameter) {
         return _Last_error;
@@ -217,6 +500,7 @@ void __stdcall __std_fs_directory_iterator_close(_In_ const __std_fs_dir_handle
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_directory_iterator_advance(
     _In_ const __std_fs_dir_handle _Handle, _Out_ __std_fs_find_data* const _Results) noexcept {
+    _STL_TRACE_FILESYSTEM_CALL("DirectoryIteratorAdvance", nullptr);
     if (FindNextFileW(reinterpret_cast<HANDLE>(_Handle), reinterpret_cast<WIN32_FIND_DATAW*>(_Results))) {
         return __std_win_error::_Success;
     }
@@ -304,11 +588,23 @@ void __stdcall __std_fs_directory_iterator_close(_In_ const __std_fs_dir_handle
 }
 
 [[nodiscard]] __std_fs_copy_file_result __stdcall __std_fs_copy_file(_In_z_ const wchar_t* const _Source,
-    _In_z_ const wchar_t* const _Target, _In_ __std_fs_copy_options _Options) noexcept { // copy _Source to _Target
+    _In_z_ const wchar_t* const _Target, _In_ const __std_fs_copy_options _Options) noexcept {
+    // copy _Source to _Target
+    return __std_fs_copy_file_ex(_Source, _Target, _Options, __std_fs_copy_file_flags::_None, nullptr, nullptr);
+}
+
+[[nodiscard]] __std_fs_copy_file_result __stdcall __std_fs_copy_file_ex(_In_z_ const wchar_t* const _Source,
+    _In_z_ const wchar_t* const _Target, _In_ __std_fs_copy_options _Options,
+    _In_ const __std_fs_copy_file_flags _Flags, _In_opt_ const __std_fs_copy_file_progress _Progress_callback,
+    _Inout_opt_ void* const _Context) noexcept {
+    // copy _Source to _Target, with CopyFile2 or CopyFileExW _Flags, reporting progress to _Progress_callback
+    _STL_TRACE_FILESYSTEM_CALL("CopyFile", _Source);
+    _Copy_progress _Progress{_Progress_callback, _Context};
+    _Copy_progress* const _Progress_ptr = _Progress_callback ? &_Progress : nullptr;
     _Options &= __std_fs_copy_options::_Existing_mask;
     if (_Options != __std_fs_copy_options::_Overwrite_existing) {
         const __std_fs_copy_file_result _First_try_result =
-            __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ true);
+            __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ true, _Flags, _Progress_ptr);
         if (_First_try_result._Error != __std_win_error::_File_exists // successful copy or I/O error
             || _Options == __std_fs_copy_options::_None) { // caller requested fail if exists behavior
             return _First_try_result;
@@ -365,7 +661,7 @@ void __stdcall __std_fs_directory_iterator_close(_In_ const __std_fs_dir_handle
     // is_regular_file(from) is false => ERROR_ACCESS_DENIED
     // exists(to) is true and is_regular_file(to) is false => ERROR_ACCESS_DENIED
     // exists(to) is true and equivalent(from, to) is true => ERROR_SHARING_VIOLATION
-    return __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ false);
+    return __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ false, _Flags, _Progress_ptr);
 }
 
 _Success_(return == __std_win_error::_Success) __std_win_error
@@ -487,6 +783,7 @@ _Success_(return == __std_win_error::_Success) __std_win_error
 
 [[nodiscard]] __std_fs_remove_result __stdcall __std_fs_remove(_In_z_ const wchar_t* const _Target) noexcept {
     // remove _Target without caring whether _Target is a file or directory
+    _STL_TRACE_FILESYSTEM_CALL("Remove", _Target);
     __std_win_error _Last_error;
 
     constexpr auto _Flags = __std_fs_file_flags::_Backup_semantics | __std_fs_file_flags::_Open_reparse_point;
@@ -495,44 +792,29 @@ _Success_(return == __std_win_error::_Success) __std_win_error
         return {false, _Translate_not_found_to_success(_Last_error)};
     }
 
-    // From newer Windows SDK than currently used to build vctools:
-    // #define FILE_DISPOSITION_FLAG_DELETE                     0x00000001
-    // #define FILE_DISPOSITION_FLAG_POSIX_SEMANTICS            0x00000002
-
-    // typedef struct _FILE_DISPOSITION_INFO_EX {
-    //     DWORD Flags;
-    // } FILE_DISPOSITION_INFO_EX, *PFILE_DISPOSITION_INFO_EX;
-
-    struct _File_disposition_info_ex {
-        DWORD _Flags;
-    };
-    _File_disposition_info_ex _Info_ex{0x3};
-
-    // FileDispositionInfoEx isn't documented in MSDN at the time of this writing, but is present
-    // in minwinbase.h as of at least 10.0.16299.0
-    constexpr auto _FileDispositionInfoExClass = static_cast<FILE_INFO_BY_HANDLE_CLASS>(21);
-    if (SetFileInformationByHandle(_Handle._Get(), _FileDispositionInfoExClass, &_Info_ex, sizeof(_Info_ex))) {
-        return {true, __std_win_error::_Success};
-    }
-
-    _Last_error = __std_win_error{GetLastError()};
-    switch (_Last_error) {
-    case __std_win_error::_Invalid_parameter: // Older Windows versions
-    case __std_win_error::_Invalid_function: // Windows 10 1607
-    case __std_win_error::_Not_supported: // POSIX delete not supported by the file system
-        break; // try non-POSIX delete below
-    default:
-        return {false, _Last_error};
-    }
+    _Last_error = _Delete_by_handle(_Handle._Get());
+    return {_Last_error == __std_win_error::_Success, _Last_error};
+}
 
-    FILE_DISPOSITION_INFO _Info{/* .Delete= */ TRUE};
-    if (SetFileInformationByHandle(_Handle._Get(), FileDispositionInfo, &_Info, sizeof(_Info))) {
-        return {true, __std_win_error::_Success};
+[[nodiscard]] __std_fs_remove_tree_result __stdcall __std_fs_remove_directory_tree(
+    _In_z_ const wchar_t* const _Target) noexcept {
+    // remove _Target and everything below it, without following reparse points, opening the contents relative to
+    // their parent directories
+    _STL_TRACE_FILESYSTEM_CALL("RemoveDirectoryTree", _Target);
+#ifdef _CRT_APP
+    (void) _Target;
+    return {0, __std_win_error::_Not_supported}; // OpenFileById is not available
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    const _STD _Fs_file _Handle(__vcp_CreateFile(_Target, _Remove_tree_directory_access, _Remove_tree_share, nullptr,
+        OPEN_EXISTING, _Remove_tree_open_flags, nullptr));
+    if (_Handle._Get() == INVALID_HANDLE_VALUE) {
+        return {0, _Translate_not_found_to_success(__std_win_error{GetLastError()})};
     }
 
-    return {false, __std_win_error{GetLastError()}};
-
-#undef _SetFileInformationByHandle
+    unsigned long long _Removed = 0;
+    const auto _Last_error      = _Remove_tree_by_handle(_Handle._Get(), &_Removed);
+    return {_Removed, _Last_error};
+#endif // _CRT_APP
 }
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_change_permissions(
@@ -583,6 +865,7 @@ _Success_(return == __std_win_error::_Success) __std_win_error
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_rename(
     _In_z_ const wchar_t* const _Source, _In_z_ const wchar_t* const _Target) noexcept {
+    _STL_TRACE_FILESYSTEM_CALL("Rename", _Source);
     if (MoveFileExW(_Source, _Target, MOVEFILE_COPY_ALLOWED | MOVEFILE_REPLACE_EXISTING)) {
         return __std_win_error::_Success;
     }
@@ -592,6 +875,7 @@ _Success_(return == __std_win_error::_Success) __std_win_error
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_resize_file(
     _In_z_ const wchar_t* const _Target, const uintmax_t _New_size) noexcept {
+    _STL_TRACE_FILESYSTEM_CALL("ResizeFile", _Target);
     __std_win_error _Err;
     const _STD _Fs_file _Handle(_Target, __std_access_rights::_File_generic_write, __std_fs_file_flags::_None, &_Err);
     if (_Err != __std_win_error::_Success) {
@@ -607,12 +891,73 @@ _Success_(return == __std_win_error::_Success) __std_win_error
     return __std_win_error::_Success;
 }
 
+[[nodiscard]] __std_win_error __stdcall __std_fs_set_allocation_size(
+    _In_z_ const wchar_t* const _Target, const unsigned long long _Size) noexcept {
+    // reserve _Size bytes of disk space for _Target without changing its size
+    __std_win_error _Err;
+    const _STD _Fs_file _Handle(_Target, __std_access_rights::_File_generic_write, __std_fs_file_flags::_None, &_Err);
+    if (_Err != __std_win_error::_Success) {
+        return _Err;
+    }
+
+    FILE_ALLOCATION_INFO _Info;
+    _Info.AllocationSize.QuadPart = static_cast<LONGLONG>(_Size);
+    if (SetFileInformationByHandle(_Handle._Get(), FileAllocationInfo, &_Info, sizeof(_Info)) == 0) {
+        return __std_win_error{GetLastError()};
+    }
+
+    return __std_win_error::_Success;
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_set_sparse(
+    _In_z_ const wchar_t* const _Target, const bool _Sparse) noexcept {
+    // set or clear the sparse attribute of _Target
+    __std_win_error _Err;
+    const _STD _Fs_file _Handle(_Target, __std_access_rights::_File_generic_write, __std_fs_file_flags::_None, &_Err);
+    if (_Err != __std_win_error::_Success) {
+        return _Err;
+    }
+
+    FILE_SET_SPARSE_BUFFER _Buffer;
+    _Buffer.SetSparse = _Sparse;
+    DWORD _Returned;
+    if (DeviceIoControl(_Handle._Get(), FSCTL_SET_SPARSE, &_Buffer, sizeof(_Buffer), nullptr, 0, &_Returned, nullptr)
+        == 0) {
+        return __std_win_error{GetLastError()};
+    }
+
+    return __std_win_error::_Success;
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_set_valid_data_length(
+    _In_z_ const wchar_t* const _Target, const unsigned long long _Length) noexcept {
+    // mark the first _Length bytes of _Target as written, without writing them; requires SE_MANAGE_VOLUME_NAME
+#ifdef _CRT_APP
+    (void) _Target;
+    (void) _Length;
+    return __std_win_error::_Not_supported; // SetFileValidData is not available
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    __std_win_error _Err;
+    const _STD _Fs_file _Handle(_Target, __std_access_rights::_File_generic_write, __std_fs_file_flags::_None, &_Err);
+    if (_Err != __std_win_error::_Success) {
+        return _Err;
+    }
+
+    if (SetFileValidData(_Handle._Get(), static_cast<LONGLONG>(_Length)) == 0) {
+        return __std_win_error{GetLastError()};
+    }
+
+    return __std_win_error::_Success;
+#endif // _CRT_APP
+}
+
 [[nodiscard]] __std_win_error __stdcall __std_fs_space(_In_z_ const wchar_t* const _Target,
     _Out_ uintmax_t* const _Available, _Out_ uintmax_t* const _Total_bytes,
     _Out_ uintmax_t* const _Free_bytes) noexcept {
     // get capacity information for the volume on which the file _Target resides
     static_assert(sizeof(uintmax_t) == sizeof(ULARGE_INTEGER) && alignof(uintmax_t) == alignof(ULARGE_INTEGER),
         "Size and alignment must match for reinterpret_cast<PULARGE_INTEGER>");
+    _STL_TRACE_FILESYSTEM_CALL("Space", _Target);
     const auto _Available_c   = reinterpret_cast<PULARGE_INTEGER>(_Available);
     const auto _Total_bytes_c = reinterpret_cast<PULARGE_INTEGER>(_Total_bytes);
     const auto _Free_bytes_c  = reinterpret_cast<PULARGE_INTEGER>(_Free_bytes);
@@ -751,6 +1096,7 @@ struct alignas(long long) _Aligned_file_attrs {
     static_assert(sizeof(_File_attr_data) == sizeof(WIN32_FILE_ATTRIBUTE_DATA));
     static_assert(alignof(_File_attr_data) == alignof(WIN32_FILE_ATTRIBUTE_DATA));
     static_assert(alignof(_File_attr_data) == 4);
+    _STL_TRACE_FILESYSTEM_CALL("GetStats", _Path);
 
     const bool _Follow_symlinks = _Bitmask_includes(_Flags, __std_fs_stats_flags::_Follow_symlinks);
     _Flags &= ~__std_fs_stats_flags::_Follow_symlinks;
@@ -859,6 +1205,7 @@ struct alignas(long long) _Aligned_file_attrs {
 
 [[nodiscard]] __std_fs_create_directory_result __stdcall __std_fs_create_directory(
     _In_z_ const wchar_t* const _New_directory) noexcept {
+    _STL_TRACE_FILESYSTEM_CALL("CreateDirectory", _New_directory);
     if (CreateDirectoryW(_New_directory, nullptr)) {
         return {true, __std_win_error::_Success};
     }
@@ -919,4 +1266,202 @@ struct alignas(long long) _Aligned_file_attrs {
     return __std_win_error::_Success;
 }
 
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_watch_open(_Out_ __std_fs_watch** const _Watch,
+    _In_z_ const wchar_t* const _Path, _In_ const __std_fs_watch_filter _Filter, _In_ const bool _Recursive) noexcept {
+    // open _Path for change notifications, and request the first batch
+    _STL_TRACE_FILESYSTEM_CALL("WatchOpen", _Path);
+    *_Watch = nullptr;
+#ifdef _CRT_APP
+    (void) _Path;
+    (void) _Filter;
+    (void) _Recursive;
+    return __std_win_error::_Not_supported; // ReadDirectoryChangesW is not available
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    const auto _Result = static_cast<__std_fs_watch*>(_calloc_crt(1, sizeof(__std_fs_watch)));
+    if (!_Result) {
+        return __std_win_error::_Not_enough_memory;
+    }
+
+    _Result->_Directory = __vcp_CreateFile(_Path, FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (_Result->_Directory == INVALID_HANDLE_VALUE) {
+        const __std_win_error _Last_error{GetLastError()};
+        _free_crt(_Result);
+        return _Last_error;
+    }
+
+    _Result->_Port = CreateIoCompletionPort(_Result->_Directory, nullptr, 0, 1);
+    if (!_Result->_Port) {
+        const __std_win_error _Last_error{GetLastError()};
+        CloseHandle(_Result->_Directory);
+        _free_crt(_Result);
+        return _Last_error;
+    }
+
+    // with the extended information, each change reports the attributes, size, and times of the file, so that
+    // callers needn't ask the file system for them again
+    const HMODULE _Kernel32 = GetModuleHandleW(L"kernel32.dll");
+    if (_Kernel32) {
+        _Result->_Read_ex =
+            reinterpret_cast<_Read_directory_changes_ex_t>(GetProcAddress(_Kernel32, "ReadDirectoryChangesExW"));
+    }
+
+    _Result->_Filter    = static_cast<DWORD>(_Filter);
+    _Result->_Recursive = _Recursive;
+    auto _Last_error    = _Start_watch_request(*_Result);
+    if (_Last_error == __std_win_error::_Invalid_parameter && _Result->_Read_ex) {
+        // some file systems, such as those of network shares, don't provide the extended information
+        _Result->_Read_ex = nullptr;
+        _Last_error       = _Start_watch_request(*_Result);
+    }
+
+    if (_Last_error != __std_win_error::_Success) {
+        __std_fs_watch_close(_Result);
+        return _Last_error;
+    }
+
+    *_Watch = _Result;
+    return __std_win_error::_Success;
+#endif // _CRT_APP
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_watch_wait(
+    _Inout_ __std_fs_watch* const _Watch, _In_ const unsigned long _Timeout_ms) noexcept {
+#ifdef _CRT_APP
+    (void) _Watch;
+    (void) _Timeout_ms;
+    return __std_win_error::_Not_supported;
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    _Watch->_Next = nullptr;
+    if (!_Watch->_Pending) { // the request after the last batch couldn't be started; try again
+        const auto _Last_error = _Start_watch_request(*_Watch);
+        if (_Last_error != __std_win_error::_Success) {
+            return _Last_error;
+        }
+    }
+
+    DWORD _Bytes;
+    ULONG_PTR _Key;
+    OVERLAPPED* _Completed;
+    const BOOL _Succeeded = GetQueuedCompletionStatus(_Watch->_Port, &_Bytes, &_Key, &_Completed, _Timeout_ms);
+    if (!_Completed) {
+        if (_Succeeded) { // dequeued a packet posted by __std_fs_watch_cancel
+            return __std_win_error::_Request_aborted;
+        }
+
+        return __std_win_error{GetLastError()}; // WAIT_TIMEOUT
+    }
+
+    const __std_win_error _Request_error = _Succeeded ? __std_win_error::_Success : __std_win_error{GetLastError()};
+    const unsigned char _Filled          = _Watch->_Filling;
+    _Watch->_Pending                     = false;
+    _Watch->_Filling                     = static_cast<unsigned char>(_Filled ^ 1);
+
+    // request the next batch before this one is read, so that the system keeps recording changes meanwhile; a failure
+    // to do so is reported by the next wait
+    (void) _Start_watch_request(*_Watch);
+
+    if (_Request_error != __std_win_error::_Success) {
+        return _Request_error;
+    }
+
+    if (_Bytes == 0) { // the changes didn't fit in the buffer, and were discarded
+        return __std_win_error::_Notify_enum_dir;
+    }
+
+    _Watch->_Next = _Watch->_Buffers[_Filled];
+    return __std_win_error::_Success;
+#endif // _CRT_APP
+}
+
+[[nodiscard]] bool __stdcall __std_fs_watch_next_change(
+    _Inout_ __std_fs_watch* const _Watch, _Out_ __std_fs_change_record* const _Record) noexcept {
+#ifdef _CRT_APP
+    (void) _Watch;
+    (void) _Record;
+    return false;
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    const unsigned char* const _Current = _Watch->_Next;
+    if (!_Current) {
+        return false;
+    }
+
+    DWORD _Next_entry_offset;
+    if (_Watch->_Read_ex) {
+        const auto _Info            = reinterpret_cast<const _File_notify_extended_information*>(_Current);
+        _Next_entry_offset          = _Info->_Next_entry_offset;
+        _Record->_Action            = static_cast<__std_fs_change_action>(_Info->_Action);
+        _Record->_Attributes        = static_cast<__std_fs_file_attr>(_Info->_File_attributes);
+        _Record->_File_size         = static_cast<unsigned long long>(_Info->_File_size.QuadPart);
+        _Record->_Last_write_time   = {_Info->_Last_modification_time.LowPart,
+            static_cast<unsigned long>(_Info->_Last_modification_time.HighPart)};
+        _Record->_Reparse_point_tag = __std_fs_reparse_tag::_None;
+        if (_Info->_File_attributes & FILE_ATTRIBUTE_REPARSE_POINT) { // otherwise the field holds the EA size
+            _Record->_Reparse_point_tag = static_cast<__std_fs_reparse_tag>(_Info->_Reparse_point_tag);
+        }
+
+        // a removed file, or the old name of a renamed one, no longer has data to report
+        if (_Record->_Action == __std_fs_change_action::_Removed
+            || _Record->_Action == __std_fs_change_action::_Renamed_old_name) {
+            _Record->_Available = __std_fs_stats_flags::_None;
+        } else {
+            _Record->_Available = __std_fs_stats_flags::_Attributes | __std_fs_stats_flags::_Reparse_tag
+                                | __std_fs_stats_flags::_File_size | __std_fs_stats_flags::_Last_write_time;
+        }
+
+        _Record->_Name        = _Info->_File_name;
+        _Record->_Name_length = _Info->_File_name_length / sizeof(wchar_t);
+    } else {
+        const auto _Info            = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(_Current);
+        _Next_entry_offset          = _Info->NextEntryOffset;
+        _Record->_Action            = static_cast<__std_fs_change_action>(_Info->Action);
+        _Record->_Available         = __std_fs_stats_flags::_None;
+        _Record->_Attributes        = __std_fs_file_attr{};
+        _Record->_Reparse_point_tag = __std_fs_reparse_tag::_None;
+        _Record->_File_size         = 0;
+        _Record->_Last_write_time   = {};
+        _Record->_Name              = _Info->FileName;
+        _Record->_Name_length       = _Info->FileNameLength / sizeof(wchar_t);
+    }
+
+    _Watch->_Next = _Next_entry_offset == 0 ? nullptr : _Current + _Next_entry_offset;
+    return true;
+#endif // _CRT_APP
+}
+
+void __stdcall __std_fs_watch_cancel(_Inout_ __std_fs_watch* const _Watch) noexcept {
+#ifdef _CRT_APP
+    (void) _Watch;
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    (void) PostQueuedCompletionStatus(_Watch->_Port, 0, _Watch_cancel_key, nullptr);
+#endif // _CRT_APP
+}
+
+void __stdcall __std_fs_watch_close(_In_opt_ __std_fs_watch* const _Watch) noexcept {
+#ifdef _CRT_APP
+    (void) _Watch;
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    if (!_Watch) {
+        return;
+    }
+
+    if (_Watch->_Pending) {
+        // the system writes to the buffer until the request completes, so wait for its packet, which a request that
+        // had already completed has queued as well
+        (void) CancelIoEx(_Watch->_Directory, &_Watch->_Overlapped);
+        DWORD _Bytes;
+        ULONG_PTR _Key;
+        OVERLAPPED* _Completed;
+        do {
+            (void) GetQueuedCompletionStatus(_Watch->_Port, &_Bytes, &_Key, &_Completed, INFINITE);
+        } while (_Completed != &_Watch->_Overlapped);
+    }
+
+    CloseHandle(_Watch->_Directory);
+    CloseHandle(_Watch->_Port);
+    _free_crt(_Watch);
+#endif // _CRT_APP
+}
 _END_EXTERN_C
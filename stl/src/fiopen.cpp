@@ -4,8 +4,10 @@
 // _Fiopen(const char */const wchar_t *, ios_base::openmode)
 
 #include <fstream>
+#include <io.h>
 
 #include <Windows.h>
+#include <winioctl.h>
 
 _STD_BEGIN
 
@@ -44,9 +46,10 @@ FILE* _Xfiopen(const CharT* filename, ios_base::openmode mode, int prot) {
         0,
     };
 
-    FILE* fp                     = nullptr;
-    ios_base::openmode atendflag = mode & ios_base::ate;
-    ios_base::openmode norepflag = mode & ios_base::_Noreplace;
+    FILE* fp                      = nullptr;
+    ios_base::openmode atendflag  = mode & ios_base::ate;
+    ios_base::openmode norepflag  = mode & ios_base::_Noreplace;
+    ios_base::openmode sparseflag = mode & ios_base::_Sparse;
 
     if (mode & ios_base::_Nocreate) {
         mode |= ios_base::in; // file must exist
@@ -56,7 +59,7 @@ FILE* _Xfiopen(const CharT* filename, ios_base::openmode mode, int prot) {
         mode |= ios_base::out; // extension -- app implies out
     }
 
-    mode &= ~(ios_base::ate | ios_base::_Nocreate | ios_base::_Noreplace);
+    mode &= ~(ios_base::ate | ios_base::_Nocreate | ios_base::_Noreplace | ios_base::_Sparse);
 
     int n = 0;
     while (valid[n] != 0 && valid[n] != mode) { // look for a valid mode
@@ -81,6 +84,13 @@ FILE* _Xfiopen(const CharT* filename, ios_base::openmode mode, int prot) {
         return nullptr; // open failed
     }
 
+    if (sparseflag && (mode & ios_base::out)) { // extension -- only a hint, so failure is ignored
+        FILE_SET_SPARSE_BUFFER sparse_buffer = {TRUE};
+        DWORD returned;
+        (void) DeviceIoControl(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(fp))), FSCTL_SET_SPARSE,
+            &sparse_buffer, sizeof(sparse_buffer), nullptr, 0, &returned, nullptr);
+    }
+
     if (!atendflag || fseek(fp, 0, SEEK_END) == 0) {
         return fp; // no need to seek to end, or seek succeeded
     }
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement the continuations of futures used by stdext::then, stdext::when_all, and stdext::when_any
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <Windows.h>
+
+// clang-format on
+
+using __std_future_continuation = void(__stdcall*)(void* _Context) noexcept;
+
+// A node of a bucket's list while registered, and of the list returned by __std_future_take_continuations after.
+struct __std_future_continuations {
+    const void* _State;
+    __std_future_continuation _Continuation;
+    void* _Context;
+    __std_future_continuations* _Next;
+};
+
+namespace {
+    // Continuations are kept in a table keyed by the address of the associated state, rather than in the state itself,
+    // so that _Associated_state keeps its layout.
+    constexpr size_t _Bucket_count_power = 8;
+    constexpr size_t _Bucket_count       = size_t{1} << _Bucket_count_power;
+
+    struct _Continuation_bucket {
+        SRWLOCK _Lock                     = SRWLOCK_INIT;
+        __std_future_continuations* _Head = nullptr;
+    };
+
+    _Continuation_bucket _Buckets[_Bucket_count];
+
+    // the number of registered continuations, so that states without any are checked without taking a lock; its
+    // updates for a state are ordered by the state's mutex, which callers hold
+    std::atomic<size_t> _Registered{0};
+
+    [[nodiscard]] _Continuation_bucket& _Bucket_for(const void* const _State) noexcept {
+        const auto _Hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(_State) >> 4) * 0x9E37'79B9U;
+        return _Buckets[_Hash >> (32 - _Bucket_count_power)];
+    }
+
+    void _Run_now(__std_future_continuations* _Continuations) noexcept {
+        while (_Continuations) {
+            const auto _Next = _Continuations->_Next;
+            _Continuations->_Continuation(_Continuations->_Context);
+            delete _Continuations;
+            _Continuations = _Next;
+        }
+    }
+
+    void CALLBACK _Run_callback(PTP_CALLBACK_INSTANCE, void* const _Context) noexcept {
+        _Run_now(static_cast<__std_future_continuations*>(_Context));
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] int __stdcall __std_future_add_continuation(
+    const void* const _State, const __std_future_continuation _Continuation, void* const _Context) noexcept {
+    const auto _Node = new (std::nothrow) __std_future_continuations{_State, _Continuation, _Context, nullptr};
+    if (!_Node) {
+        return 0;
+    }
+
+    auto& _Bucket = _Bucket_for(_State);
+    _Registered.fetch_add(1, std::memory_order_relaxed);
+    AcquireSRWLockExclusive(&_Bucket._Lock);
+    _Node->_Next  = _Bucket._Head;
+    _Bucket._Head = _Node;
+    ReleaseSRWLockExclusive(&_Bucket._Lock);
+    return 1;
+}
+
+[[nodiscard]] __std_future_continuations* __stdcall __std_future_take_continuations(const void* const _State) noexcept {
+    if (_Registered.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+
+    auto& _Bucket = _Bucket_for(_State);
+    __std_future_continuations* _Result = nullptr;
+    size_t _Taken                       = 0;
+    AcquireSRWLockExclusive(&_Bucket._Lock);
+    for (auto _Link = &_Bucket._Head; *_Link;) {
+        const auto _Node = *_Link;
+        if (_Node->_State == _State) {
+            // the bucket's list is newest first, so prepending restores registration order
+            *_Link       = _Node->_Next;
+            _Node->_Next = _Result;
+            _Result      = _Node;
+            ++_Taken;
+        } else {
+            _Link = &_Node->_Next;
+        }
+    }
+
+    ReleaseSRWLockExclusive(&_Bucket._Lock);
+    if (_Taken != 0) {
+        _Registered.fetch_sub(_Taken, std::memory_order_relaxed);
+    }
+
+    return _Result;
+}
+
+void __stdcall __std_future_run_continuations(__std_future_continuations* const _Continuations) noexcept {
+    // the continuations run on the system threadpool rather than on the thread making the state ready, which might be
+    // the task of an async() call that they wait for
+    if (!TrySubmitThreadpoolCallback(&_Run_callback, _Continuations, nullptr)) {
+        _Run_now(_Continuations);
+    }
+}
+
+} // extern "C"
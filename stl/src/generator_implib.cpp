@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <yvals_core.h>
+
+#include <cstddef>
+#include <new>
+
+// This must be as small as possible, because its contents are
+// injected into the msvcprt.lib and msvcprtd.lib import libraries.
+// Do not include or define anything else here.
+// In particular, basic_string must not be included here.
+
+// Per-thread free lists of coroutine frames for experimental::recycling_frame_allocator, one per 64-byte size class up
+// to 1 KiB. This lives in the import library, rather than in <experimental/generator>, so that the header doesn't define
+// thread_local variables; the frames come from the user's module's operator new. Frames are only ever handed out again
+// at their rounded size, so a frame freed on a different thread than the one that allocated it simply migrates to the
+// freeing thread's cache.
+
+namespace {
+    constexpr size_t _Granularity       = 64;
+    constexpr size_t _Bucket_count      = 16;
+    constexpr size_t _Max_cached_frames = 32; // per size class
+
+    struct _Free_frame {
+        _Free_frame* _Next;
+    };
+
+    struct _Cache_state {
+        _Free_frame* _Heads[_Bucket_count];
+        size_t _Counts[_Bucket_count];
+        bool _Thread_exited; // frames freed after this thread's cache has been released are deallocated directly
+    };
+
+    // trivially destructible, so that it can still be used after _Release_at_thread_exit has run
+    thread_local _Cache_state _State{};
+
+    struct _Release_at_thread_exit {
+        _Release_at_thread_exit() = default;
+
+        _Release_at_thread_exit(const _Release_at_thread_exit&)            = delete;
+        _Release_at_thread_exit& operator=(const _Release_at_thread_exit&) = delete;
+
+        ~_Release_at_thread_exit() {
+            for (size_t _Bucket = 0; _Bucket < _Bucket_count; ++_Bucket) {
+                for (_Free_frame* _Ptr = _State._Heads[_Bucket]; _Ptr;) {
+                    _Free_frame* const _Next = _Ptr->_Next;
+                    ::operator delete(_Ptr, (_Bucket + 1) * _Granularity);
+                    _Ptr = _Next;
+                }
+            }
+
+            _State                = {};
+            _State._Thread_exited = true;
+        }
+    };
+
+    _NODISCARD size_t _Bucket_of(const size_t _Rounded_size) noexcept {
+        // returns _Bucket_count if frames of _Rounded_size bytes aren't cached
+        if (_Rounded_size == 0 || _Rounded_size % _Granularity != 0 || _Rounded_size > _Bucket_count * _Granularity) {
+            return _Bucket_count;
+        }
+
+        return _Rounded_size / _Granularity - 1;
+    }
+} // unnamed namespace
+
+_EXTERN_C
+_NODISCARD void* __stdcall __std_generator_frame_cache_take(const size_t _Rounded_size) noexcept {
+    // returns a cached frame of _Rounded_size bytes, or nullptr
+    const size_t _Bucket = _Bucket_of(_Rounded_size);
+    if (_Bucket == _Bucket_count) {
+        return nullptr;
+    }
+
+    _Free_frame* const _Ptr = _State._Heads[_Bucket];
+    if (_Ptr) {
+        _State._Heads[_Bucket] = _Ptr->_Next;
+        --_State._Counts[_Bucket];
+    }
+
+    return _Ptr;
+}
+
+_NODISCARD bool __stdcall __std_generator_frame_cache_put(void* const _Ptr, const size_t _Rounded_size) noexcept {
+    // keeps the frame [_Ptr, _Ptr + _Rounded_size) allocated by allocator<char> for reuse on this thread, if there's room
+    const size_t _Bucket = _Bucket_of(_Rounded_size);
+    if (_Bucket == _Bucket_count || _State._Thread_exited || _State._Counts[_Bucket] == _Max_cached_frames) {
+        return false;
+    }
+
+    static thread_local _Release_at_thread_exit _Guard;
+    (void) _Guard;
+    _State._Heads[_Bucket] = ::new (_Ptr) _Free_frame{_State._Heads[_Bucket]};
+    ++_State._Counts[_Bucket];
+    return true;
+}
+_END_EXTERN_C
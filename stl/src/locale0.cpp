@@ -74,6 +74,7 @@ _STD_END
 #if !STDCPP_IMPLIB || defined(_M_CEE_PURE)
 
 #include <cstdlib>
+#include <cstring>
 #include <locale>
 
 _EXTERN_C
@@ -199,16 +200,19 @@ void __CLRCALL_PURE_OR_CDECL _Locinfo::_Locinfo_ctor(
     const char* oldlocname = setlocale(LC_ALL, nullptr);
 
     pLocinfo->_Oldlocname = oldlocname == nullptr ? "" : oldlocname;
-    if (locname != nullptr) {
+    if (locname != nullptr && (oldlocname == nullptr || strcmp(locname, oldlocname) != 0)) {
         locname = setlocale(LC_ALL, locname);
-    }
+    } // else already in the named locale, as when lazy facets of the "C" locale are made; setting it again is costly
 
     pLocinfo->_Newlocname = locname == nullptr ? "*" : locname;
 }
 
 void __CLRCALL_PURE_OR_CDECL _Locinfo::_Locinfo_dtor(_Locinfo* pLocinfo) { // destroy a _Locinfo object, revert locale
     if (!pLocinfo->_Oldlocname._Empty()) {
-        setlocale(LC_ALL, pLocinfo->_Oldlocname._C_str());
+        const char* curlocname = setlocale(LC_ALL, nullptr);
+        if (curlocname == nullptr || strcmp(curlocname, pLocinfo->_Oldlocname._C_str()) != 0) {
+            setlocale(LC_ALL, pLocinfo->_Oldlocname._C_str());
+        }
     }
 }
 _STD_END
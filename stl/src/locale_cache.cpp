@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement the cache of named locale implementations
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// clang-format on
+
+namespace {
+    struct _Cached_locale {
+        void* _Impl; // a locale::_Locimp, which the cache holds a reference to
+        size_t _Hash;
+        char _Name[1]; // null-terminated
+    };
+
+    // Open addressing with linear probing. Entries are published once, never change, and are never freed, so lookups
+    // don't lock; a program uses few locale names, so the table is small.
+    constexpr size_t _Cache_size_power = 8;
+    constexpr size_t _Cache_size       = size_t{1} << _Cache_size_power;
+    constexpr size_t _Max_probes       = 8; // names that don't fit within this many entries aren't cached
+
+    std::atomic<_Cached_locale*> _Cache[_Cache_size]{};
+
+    [[nodiscard]] size_t _Name_hash(const char* _Name) noexcept {
+        // FNV-1a
+        size_t _Val = 2166136261U;
+        for (; *_Name != '\0'; ++_Name) {
+            _Val ^= static_cast<unsigned char>(*_Name);
+            _Val *= 16777619U;
+        }
+
+        return _Val;
+    }
+
+    [[nodiscard]] bool _Matches(const _Cached_locale& _Entry, const size_t _Hash, const char* const _Name) noexcept {
+        return _Entry._Hash == _Hash && _CSTD strcmp(_Entry._Name, _Name) == 0;
+    }
+} // unnamed namespace
+
+extern "C" {
+[[nodiscard]] void* __stdcall __std_locale_cache_find(const char* const _Name) noexcept {
+    const size_t _Hash = _Name_hash(_Name);
+    size_t _Idx        = _Hash & (_Cache_size - 1);
+    for (size_t _Probes = 0; _Probes != _Max_probes; ++_Probes, _Idx = (_Idx + 1) & (_Cache_size - 1)) {
+        const _Cached_locale* const _Entry = _Cache[_Idx].load(std::memory_order_acquire);
+        if (!_Entry) {
+            return nullptr;
+        }
+
+        if (_Matches(*_Entry, _Hash, _Name)) {
+            return _Entry->_Impl;
+        }
+    }
+
+    return nullptr;
+}
+
+[[nodiscard]] void* __stdcall __std_locale_cache_insert(const char* const _Name, void* const _Impl) noexcept {
+    const size_t _Hash         = _Name_hash(_Name);
+    const size_t _Length       = _CSTD strlen(_Name);
+    _Cached_locale* _New_entry = nullptr;
+    size_t _Idx                = _Hash & (_Cache_size - 1);
+    for (size_t _Probes = 0; _Probes != _Max_probes; ++_Probes, _Idx = (_Idx + 1) & (_Cache_size - 1)) {
+        _Cached_locale* _Entry = _Cache[_Idx].load(std::memory_order_acquire);
+        if (!_Entry) {
+            if (!_New_entry) {
+                _New_entry = static_cast<_Cached_locale*>(_CSTD malloc(sizeof(_Cached_locale) + _Length));
+                if (!_New_entry) {
+                    return nullptr;
+                }
+
+                _New_entry->_Impl = _Impl;
+                _New_entry->_Hash = _Hash;
+                _CSTD memcpy(_New_entry->_Name, _Name, _Length + 1);
+            }
+
+            if (_Cache[_Idx].compare_exchange_strong(
+                    _Entry, _New_entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return _Impl;
+            }
+
+            // another thread published an entry here first; _Entry is now that entry
+        }
+
+        if (_Matches(*_Entry, _Hash, _Name)) {
+            _CSTD free(_New_entry);
+            return _Entry->_Impl;
+        }
+    }
+
+    _CSTD free(_New_entry);
+    return nullptr;
+}
+} // extern "C"
@@ -1,14 +1,18 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <atomic>
 #include <internal_shared.h>
 #include <memory_resource>
 #include <system_error>
 
+#include <Windows.h>
+
 _STD_BEGIN
 namespace pmr {
 
     static memory_resource* _Default_resource{nullptr};
+    static thread_local memory_resource* _Thread_default_resource{nullptr}; // overrides _Default_resource
 
     extern "C" _CRT_SATELLITE_1 _Aligned_new_delete_resource_impl* __cdecl _Aligned_new_delete_resource() noexcept {
         return &const_cast<_Aligned_new_delete_resource_impl&>(
@@ -21,6 +25,10 @@ namespace pmr {
     }
 
     extern "C" _CRT_SATELLITE_1 memory_resource* __cdecl _Aligned_get_default_resource() noexcept {
+        if (_Thread_default_resource) {
+            return _Thread_default_resource;
+        }
+
         memory_resource* const _Temp = __crt_interlocked_read_pointer(&_Default_resource);
         if (_Temp) {
             return _Temp;
@@ -30,6 +38,10 @@ namespace pmr {
     }
 
     extern "C" _CRT_SATELLITE_1 memory_resource* __cdecl _Unaligned_get_default_resource() noexcept {
+        if (_Thread_default_resource) {
+            return _Thread_default_resource;
+        }
+
         memory_resource* const _Temp = __crt_interlocked_read_pointer(&_Default_resource);
         if (_Temp) {
             return _Temp;
@@ -58,6 +70,14 @@ namespace pmr {
         return _Unaligned_new_delete_resource();
     }
 
+    extern "C" _CRT_SATELLITE_1 memory_resource* __cdecl _Exchange_thread_default_resource(
+        memory_resource* const _Resource) noexcept {
+        // returns the previous override for this thread, or nullptr if there was none
+        memory_resource* const _Temp = _Thread_default_resource;
+        _Thread_default_resource     = _Resource;
+        return _Temp;
+    }
+
     // FUNCTION null_memory_resource
     extern "C" _CRT_SATELLITE_1 _NODISCARD memory_resource* __cdecl null_memory_resource() noexcept {
         class _Null_resource final : public _Identity_equal_resource {
@@ -70,5 +90,88 @@ namespace pmr {
         return &const_cast<_Null_resource&>(_Immortalize_memcpy_image<_Null_resource>());
     }
 
+    static atomic<size_t> _Pool_empty_chunk_limit{SIZE_MAX};
+
+    extern "C" _CRT_SATELLITE_1 size_t __cdecl _Get_pool_empty_chunk_limit() noexcept {
+        return _Pool_empty_chunk_limit.load(memory_order_relaxed);
+    }
+
+    extern "C" _CRT_SATELLITE_1 size_t __cdecl _Set_pool_empty_chunk_limit(const size_t _Bytes) noexcept {
+        return _Pool_empty_chunk_limit.exchange(_Bytes, memory_order_relaxed);
+    }
+
 } // namespace pmr
 _STD_END
+
+_STDEXT_BEGIN
+namespace pmr {
+    namespace {
+        void* _Allocate_pages(const size_t _Bytes, const size_t _Align) noexcept {
+            // reserve and commit ordinary pages aligned to _Align
+            SYSTEM_INFO _Info;
+            GetSystemInfo(&_Info);
+            if (_Align <= _Info.dwAllocationGranularity) { // every reservation is suitably aligned
+                return VirtualAlloc(nullptr, _Bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            }
+
+            if (_Bytes > SIZE_MAX - _Align) {
+                return nullptr;
+            }
+
+            // find an aligned address within a larger reservation, then reserve exactly that range; another
+            // thread may take the range in between, so retry a few times
+            for (int _Attempt = 0; _Attempt < 8; ++_Attempt) {
+                void* const _Probe = VirtualAlloc(nullptr, _Bytes + _Align, MEM_RESERVE, PAGE_NOACCESS);
+                if (!_Probe) {
+                    return nullptr;
+                }
+
+                const auto _Aligned = (reinterpret_cast<uintptr_t>(_Probe) + _Align - 1) & ~(_Align - 1);
+                VirtualFree(_Probe, 0, MEM_RELEASE);
+                void* const _Ptr =
+                    VirtualAlloc(reinterpret_cast<void*>(_Aligned), _Bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+                if (_Ptr) {
+                    return _Ptr;
+                }
+            }
+
+            return nullptr;
+        }
+    } // unnamed namespace
+
+    extern "C" _CRT_SATELLITE_1 size_t __cdecl _Large_page_resource_page_size() noexcept {
+        return GetLargePageMinimum();
+    }
+
+    extern "C" _CRT_SATELLITE_1 void* __cdecl _Large_page_resource_allocate(
+        size_t _Bytes, const size_t _Align, const large_page_mode _Mode) noexcept {
+        // returns nullptr on failure
+        if (_Bytes == 0) {
+            _Bytes = 1;
+        }
+
+        if (_Mode != large_page_mode::disabled) {
+            // large page allocations must be a multiple of the large page size, and are aligned to it
+            const size_t _Large_page_size = GetLargePageMinimum();
+            if (_Large_page_size != 0 && _Align <= _Large_page_size && _Bytes <= SIZE_MAX - (_Large_page_size - 1)) {
+                const size_t _Size = (_Bytes + _Large_page_size - 1) & ~(_Large_page_size - 1);
+                void* const _Ptr =
+                    VirtualAlloc(nullptr, _Size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+                if (_Ptr) {
+                    return _Ptr;
+                }
+            }
+
+            if (_Mode == large_page_mode::required) {
+                return nullptr;
+            }
+        }
+
+        return _Allocate_pages(_Bytes, _Align);
+    }
+
+    extern "C" _CRT_SATELLITE_1 void __cdecl _Large_page_resource_deallocate(void* const _Ptr) noexcept {
+        VirtualFree(_Ptr, 0, MEM_RELEASE);
+    }
+} // namespace pmr
+_STDEXT_END
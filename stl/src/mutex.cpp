@@ -11,6 +11,7 @@
 #include <xtimec.h>
 
 #include "primitives.hpp"
+#include "tracelogging.hpp"
 
 extern "C" _CRTIMP2_PURE void _Thrd_abort(const char* msg) { // abort on precondition failure
     fputs(msg, stderr);
@@ -87,10 +88,26 @@ void _Mtx_destroy(_Mtx_t mtx) { // destroy mutex
     }
 }
 
+static void mtx_lock_cs(_Mtx_t mtx) { // lock the critical section, tracing contention if a session is listening
+#ifdef _STL_TRACELOGGING
+    if (_STL_TRACE_ENABLED(_STL_TRACE_KEYWORD_MUTEX)) {
+        if (!mtx->_get_cs()->try_lock()) { // contended, e.g. a synchronized_pool_resource shared between threads
+            _STL_TRACE("MutexContended", _STL_TRACE_KEYWORD_MUTEX, _STL_TRACE_START, TraceLoggingPointer(mtx, "Mutex"));
+            mtx->_get_cs()->lock();
+            _STL_TRACE("MutexContended", _STL_TRACE_KEYWORD_MUTEX, _STL_TRACE_STOP, TraceLoggingPointer(mtx, "Mutex"));
+        }
+
+        return;
+    }
+#endif // _STL_TRACELOGGING
+
+    mtx->_get_cs()->lock();
+}
+
 static int mtx_do_lock(_Mtx_t mtx, const xtime* target) { // lock mutex
     if ((mtx->type & ~_Mtx_recursive) == _Mtx_plain) { // set the lock
         if (mtx->thread_id != static_cast<long>(GetCurrentThreadId())) { // not current thread, do lock
-            mtx->_get_cs()->lock();
+            mtx_lock_cs(mtx);
             mtx->thread_id = static_cast<long>(GetCurrentThreadId());
         }
         ++mtx->count;
@@ -100,7 +117,7 @@ static int mtx_do_lock(_Mtx_t mtx, const xtime* target) { // lock mutex
         int res = WAIT_TIMEOUT;
         if (target == nullptr) { // no target --> plain wait (i.e. infinite timeout)
             if (mtx->thread_id != static_cast<long>(GetCurrentThreadId())) {
-                mtx->_get_cs()->lock();
+                mtx_lock_cs(mtx);
             }
 
             res = WAIT_OBJECT_0;
@@ -4,9 +4,12 @@
 // support for <execution>
 
 #include <internal_shared.h>
+#include <new>
 #include <thread>
 #include <xatomic_wait.h>
 
+#include "tracelogging.hpp"
+
 namespace {
     unsigned char _Atomic_load_uchar(const volatile unsigned char* _Ptr) noexcept {
         // atomic load of unsigned char, copied from <atomic> except ARM and ARM64 bits
@@ -19,6 +22,375 @@ namespace {
 #endif
         return _Value;
     }
+
+    // the threadpool environment selected by stdext::parallel_algorithms_scope on this thread
+    thread_local PTP_CALLBACK_ENVIRON _Thread_callback_environ = nullptr;
+    thread_local unsigned int _Thread_max_concurrency          = 0; // 0 means no limit
+
+    // the chunking hints selected by stdext::parallel_algorithms_chunking_scope on this thread, 0 means no hint
+    thread_local size_t _Thread_min_chunk_size = 0;
+    thread_local size_t _Thread_chunk_count    = 0;
+
+    // whether stdext::parallel_algorithms_numa_scope selected the NUMA node pools on this thread
+    thread_local bool _Thread_numa_placement = false;
+
+    // the std::_Parallel_scratch_settings of the innermost stdext::parallel_algorithms_scratch_scope on this thread
+    thread_local void* _Thread_scratch = nullptr;
+
+    // the innermost std::task_group::_Membership on this thread
+    thread_local void* _Thread_task_group_membership = nullptr;
+
+    // the block cached for the temporaries of parallel algorithms on this thread, while a scope selects caching
+    struct _Scratch_cache {
+        void* _Block = nullptr;
+        size_t _Size = 0;
+        bool _In_use = false;
+
+        _Scratch_cache() = default;
+        _Scratch_cache(const _Scratch_cache&) = delete;
+        _Scratch_cache& operator=(const _Scratch_cache&) = delete;
+
+        ~_Scratch_cache() {
+            _Free();
+        }
+
+        void _Free() noexcept {
+            ::operator delete(_Block);
+            _Block = nullptr;
+            _Size  = 0;
+        }
+    };
+
+    thread_local _Scratch_cache _Thread_scratch_cache;
+
+    // Before Windows 11, the threads of a process run in a single processor group unless they are moved to others,
+    // so the process-wide threadpool can't use more than 64 logical processors. When there are several groups, work
+    // that isn't directed to a callback environment goes instead to a threadpool per group, whose threads move to
+    // their group when they first run a callback. The pools are created on first use and live as long as the process,
+    // like the process-wide threadpool.
+    struct _Affinitized_pool {
+        PTP_POOL _Pool;
+        TP_CALLBACK_ENVIRON _Environment;
+        GROUP_AFFINITY _Affinity;
+        unsigned int _Processors;
+        USHORT _Numa_node; // of a NUMA node pool
+    };
+
+    struct _Affinitized_pools {
+        _Affinitized_pool* _Pools = nullptr; // nullptr means that the process-wide threadpool is used
+        unsigned int _Count       = 0;
+        unsigned int _Processors  = 0; // in all pools
+    };
+
+    _Affinitized_pools _Processor_group_pools;
+    INIT_ONCE _Processor_group_pools_once = INIT_ONCE_STATIC_INIT;
+    bool _Several_numa_nodes              = false; // written with the group pools
+
+    using _Pfn_GetLogicalProcessorInformationEx = BOOL(WINAPI*)(
+        LOGICAL_PROCESSOR_RELATIONSHIP, PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX, PDWORD);
+    using _Pfn_SetThreadGroupAffinity = BOOL(WINAPI*)(HANDLE, const GROUP_AFFINITY*, PGROUP_AFFINITY);
+
+    _Pfn_SetThreadGroupAffinity _Set_thread_group_affinity = nullptr; // written before the pools are
+
+    // the pool whose group or node this threadpool thread was moved to
+    thread_local const _Affinitized_pool* _Thread_pool = nullptr;
+
+    [[nodiscard]] bool _Initialize_pool(
+        _Affinitized_pool& _Target, const GROUP_AFFINITY& _Affinity, const unsigned int _Processors) noexcept {
+        const PTP_POOL _Pool = CreateThreadpool(nullptr);
+        if (!_Pool) {
+            return false;
+        }
+
+        SetThreadpoolThreadMaximum(_Pool, _Processors);
+        _Target._Pool = _Pool;
+        InitializeThreadpoolEnvironment(&_Target._Environment);
+        SetThreadpoolCallbackPool(&_Target._Environment, _Pool);
+        _Target._Affinity   = _Affinity;
+        _Target._Processors = _Processors;
+        return true;
+    }
+
+    void _Destroy_pools(_Affinitized_pool* const _Pools, unsigned int _Created) noexcept {
+        while (_Created != 0) {
+            --_Created;
+            CloseThreadpool(_Pools[_Created]._Pool);
+        }
+
+        HeapFree(GetProcessHeap(), 0, _Pools);
+    }
+
+    BOOL CALLBACK _Create_processor_group_pools(PINIT_ONCE, PVOID, PVOID*) noexcept {
+        ULONG _Highest_numa_node = 0;
+        _Several_numa_nodes      = GetNumaHighestNodeNumber(&_Highest_numa_node) && _Highest_numa_node != 0;
+
+        // processor groups were introduced in Windows 7
+        const HMODULE _Kernel32 = GetModuleHandleW(L"kernel32.dll");
+        if (!_Kernel32) {
+            return TRUE;
+        }
+
+        const auto _Get_information = reinterpret_cast<_Pfn_GetLogicalProcessorInformationEx>(
+            GetProcAddress(_Kernel32, "GetLogicalProcessorInformationEx"));
+        const auto _Set_affinity =
+            reinterpret_cast<_Pfn_SetThreadGroupAffinity>(GetProcAddress(_Kernel32, "SetThreadGroupAffinity"));
+        if (!_Get_information || !_Set_affinity) {
+            return TRUE;
+        }
+
+        DWORD _Length = 0;
+        if (_Get_information(RelationGroup, nullptr, &_Length) || GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+            return TRUE;
+        }
+
+        const auto _Information =
+            static_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(HeapAlloc(GetProcessHeap(), 0, _Length));
+        if (!_Information) {
+            return TRUE;
+        }
+
+        const unsigned int _Count =
+            _Get_information(RelationGroup, _Information, &_Length) ? _Information->Group.ActiveGroupCount : 0u;
+        _Affinitized_pool* _Groups = nullptr;
+        if (_Count > 1) {
+            _Groups = static_cast<_Affinitized_pool*>(
+                HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, _Count * sizeof(_Affinitized_pool)));
+        }
+
+        if (!_Groups) {
+            HeapFree(GetProcessHeap(), 0, _Information);
+            return TRUE;
+        }
+
+        unsigned int _Created    = 0;
+        unsigned int _Processors = 0;
+        for (; _Created < _Count; ++_Created) {
+            const auto& _Info = _Information->Group.GroupInfo[_Created];
+            GROUP_AFFINITY _Affinity{};
+            _Affinity.Mask  = _Info.ActiveProcessorMask;
+            _Affinity.Group = static_cast<WORD>(_Created);
+            if (!_Initialize_pool(_Groups[_Created], _Affinity, _Info.ActiveProcessorCount)) {
+                break;
+            }
+
+            _Processors += _Info.ActiveProcessorCount;
+        }
+
+        HeapFree(GetProcessHeap(), 0, _Information);
+        if (_Created != _Count) {
+            // fall back to the process-wide threadpool
+            _Destroy_pools(_Groups, _Created);
+            return TRUE;
+        }
+
+        _Set_thread_group_affinity         = _Set_affinity;
+        _Processor_group_pools._Pools      = _Groups;
+        _Processor_group_pools._Count      = _Count;
+        _Processor_group_pools._Processors = _Processors;
+        return TRUE;
+    }
+
+    [[nodiscard]] const _Affinitized_pools& _Acquire_processor_group_pools() noexcept {
+        (void) InitOnceExecuteOnce(&_Processor_group_pools_once, &_Create_processor_group_pools, nullptr, nullptr);
+        return _Processor_group_pools;
+    }
+
+    // With stdext::parallel_algorithms_numa_scope, work that isn't directed to a callback environment goes instead to
+    // a threadpool per NUMA node with processors, whose threads move to the node's processors like those of the group
+    // pools, and <execution> gives each node a contiguous block of the chunks of for_each, transform, fill and so on.
+    // The node pools are created when the scope is first used, and only when there are several such nodes.
+    _Affinitized_pools _Numa_node_pools;
+    INIT_ONCE _Numa_node_pools_once = INIT_ONCE_STATIC_INIT;
+
+    using _Pfn_GetNumaNodeProcessorMaskEx  = BOOL(WINAPI*)(USHORT, PGROUP_AFFINITY);
+    using _Pfn_GetCurrentProcessorNumberEx = VOID(WINAPI*)(PPROCESSOR_NUMBER);
+    using _Pfn_GetNumaProcessorNodeEx      = BOOL(WINAPI*)(PPROCESSOR_NUMBER, PUSHORT);
+
+    // written before the node pools are
+    _Pfn_GetCurrentProcessorNumberEx _Get_current_processor_number = nullptr;
+    _Pfn_GetNumaProcessorNodeEx _Get_numa_processor_node           = nullptr;
+
+    BOOL CALLBACK _Create_numa_node_pools(PINIT_ONCE, PVOID, PVOID*) noexcept {
+        // the group pools are final once acquired, so _Set_thread_group_affinity is only written here if they don't
+        // exist and no callback reads it yet
+        (void) _Acquire_processor_group_pools();
+        ULONG _Highest = 0;
+        if (!_Several_numa_nodes || !GetNumaHighestNodeNumber(&_Highest)) {
+            return TRUE;
+        }
+
+        // the Ex functions were introduced in Windows 7
+        const HMODULE _Kernel32 = GetModuleHandleW(L"kernel32.dll");
+        if (!_Kernel32) {
+            return TRUE;
+        }
+
+        const auto _Get_mask =
+            reinterpret_cast<_Pfn_GetNumaNodeProcessorMaskEx>(GetProcAddress(_Kernel32, "GetNumaNodeProcessorMaskEx"));
+        const auto _Set_affinity =
+            reinterpret_cast<_Pfn_SetThreadGroupAffinity>(GetProcAddress(_Kernel32, "SetThreadGroupAffinity"));
+        const auto _Get_processor = reinterpret_cast<_Pfn_GetCurrentProcessorNumberEx>(
+            GetProcAddress(_Kernel32, "GetCurrentProcessorNumberEx"));
+        const auto _Get_node =
+            reinterpret_cast<_Pfn_GetNumaProcessorNodeEx>(GetProcAddress(_Kernel32, "GetNumaProcessorNodeEx"));
+        if (!_Get_mask || !_Set_affinity || !_Get_processor || !_Get_node) {
+            return TRUE;
+        }
+
+        const auto _Nodes = static_cast<_Affinitized_pool*>(
+            HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, (_Highest + 1) * sizeof(_Affinitized_pool)));
+        if (!_Nodes) {
+            return TRUE;
+        }
+
+        unsigned int _Created    = 0;
+        unsigned int _Processors = 0;
+        for (ULONG _Node = 0; _Node <= _Highest; ++_Node) {
+            GROUP_AFFINITY _Affinity{};
+            if (!_Get_mask(static_cast<USHORT>(_Node), &_Affinity) || _Affinity.Mask == 0) {
+                continue; // a node with only memory
+            }
+
+            unsigned int _Node_processors = 0;
+            for (KAFFINITY _Mask = _Affinity.Mask; _Mask != 0; _Mask &= _Mask - 1) {
+                ++_Node_processors;
+            }
+
+            if (!_Initialize_pool(_Nodes[_Created], _Affinity, _Node_processors)) {
+                _Destroy_pools(_Nodes, _Created);
+                return TRUE;
+            }
+
+            _Nodes[_Created]._Numa_node = static_cast<USHORT>(_Node);
+            ++_Created;
+            _Processors += _Node_processors;
+        }
+
+        if (_Created < 2) {
+            _Destroy_pools(_Nodes, _Created);
+            return TRUE;
+        }
+
+        if (!_Set_thread_group_affinity) {
+            _Set_thread_group_affinity = _Set_affinity;
+        }
+
+        _Get_current_processor_number = _Get_processor;
+        _Get_numa_processor_node      = _Get_node;
+        _Numa_node_pools._Pools       = _Nodes;
+        _Numa_node_pools._Count       = _Created;
+        _Numa_node_pools._Processors  = _Processors;
+        return TRUE;
+    }
+
+    [[nodiscard]] const _Affinitized_pools& _Acquire_numa_node_pools() noexcept {
+        (void) InitOnceExecuteOnce(&_Numa_node_pools_once, &_Create_numa_node_pools, nullptr, nullptr);
+        return _Numa_node_pools;
+    }
+
+    [[nodiscard]] const _Affinitized_pools* _Selected_numa_node_pools(
+        const PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
+        // the node pools that work created on this thread goes to, if any
+        if (!_Thread_numa_placement || _Callback_environ) {
+            return nullptr;
+        }
+
+        const auto& _Nodes = _Acquire_numa_node_pools();
+        return _Nodes._Pools ? &_Nodes : nullptr;
+    }
+
+    // When tracing, or when there are several processor groups or NUMA nodes, __std_create_threadpool_work hands out
+    // a _Parallel_work in place of the PTP_WORK, holding a PTP_WORK per processor group or NUMA node (or one for the
+    // selected callback environment), so that callbacks can be bracketed by ParallelChunk start and stop events and
+    // run in their group or node. <execution> treats the handle as opaque and only passes it back to the functions below; like every
+    // STL caller, it closes a work object only once none of its callbacks is pending (though possibly from inside the
+    // last one).
+    struct _Parallel_work;
+
+    struct _Pool_work {
+        _Parallel_work* _Owner;
+        const _Affinitized_pool* _Pool; // nullptr when submitting to a callback environment
+        PTP_WORK _Work;
+    };
+
+    struct _Parallel_work {
+        PTP_WORK_CALLBACK _Callback;
+        void* _Context;
+        volatile long _Next_pool; // rotates the submissions that don't divide evenly among the pools
+        unsigned int _Count;
+        unsigned int _Processors; // in all pools
+        _Pool_work _Works[1]; // actually _Count elements
+    };
+
+    [[nodiscard]] bool _Uses_parallel_work() noexcept {
+        // the answer doesn't change once the first work is created
+#ifdef _STL_TRACELOGGING
+        return true;
+#else // ^^^ _STL_TRACELOGGING / !_STL_TRACELOGGING vvv
+        const auto& _Groups = _Acquire_processor_group_pools();
+        return _Groups._Pools != nullptr || _Several_numa_nodes;
+#endif // ^^^ !_STL_TRACELOGGING ^^^
+    }
+
+    void CALLBACK _Parallel_work_callback(
+        const PTP_CALLBACK_INSTANCE _Instance, void* const _Context, PTP_WORK) noexcept {
+        const auto _Target = static_cast<const _Pool_work*>(_Context);
+        const auto _Pool   = _Target->_Pool;
+        if (_Pool && _Thread_pool != _Pool) {
+            // only threads of the pool itself get here, so they stay on its processors
+            (void) _Set_thread_group_affinity(GetCurrentThread(), &_Pool->_Affinity, nullptr);
+            _Thread_pool = _Pool;
+        }
+
+        const auto _Work = _Target->_Owner;
+        _STL_TRACE("ParallelChunk", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, _STL_TRACE_START,
+            TraceLoggingPointer(_Work, "Work"));
+        _Work->_Callback(_Instance, _Work->_Context, reinterpret_cast<PTP_WORK>(_Work));
+        // the callback may have closed the work, so only the address of _Work is used from here on
+        _STL_TRACE("ParallelChunk", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, _STL_TRACE_STOP,
+            TraceLoggingPointer(_Work, "Work"));
+    }
+
+    void _Close_pool_works(_Parallel_work* const _Work, const unsigned int _Created) noexcept {
+        for (unsigned int _Idx = 0; _Idx < _Created; ++_Idx) {
+            CloseThreadpoolWork(_Work->_Works[_Idx]._Work);
+        }
+
+        HeapFree(GetProcessHeap(), 0, _Work);
+    }
+
+    void _Submit_parallel_work(_Parallel_work* const _Work, const size_t _Submissions) noexcept {
+        // each pool gets a share of _Submissions proportional to its processors, and the rest are rotated
+        const unsigned int _Count = _Work->_Count;
+        if (_Count == 1) {
+            for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx) {
+                SubmitThreadpoolWork(_Work->_Works[0]._Work);
+            }
+
+            return;
+        }
+
+        const size_t _Processors = _Work->_Processors;
+        size_t _Assigned         = 0;
+        for (unsigned int _Idx = 0; _Idx < _Count; ++_Idx) {
+            _Assigned += _Submissions * _Work->_Works[_Idx]._Pool->_Processors / _Processors;
+        }
+
+        const size_t _Rest        = _Submissions - _Assigned; // < _Count
+        const unsigned int _First =
+            static_cast<unsigned int>(InterlockedExchangeAdd(&_Work->_Next_pool, static_cast<long>(_Rest))) % _Count;
+        for (unsigned int _Idx = 0; _Idx < _Count; ++_Idx) {
+            const auto& _Pool_work = _Work->_Works[_Idx];
+            size_t _Share          = _Submissions * _Pool_work._Pool->_Processors / _Processors;
+            if ((_Idx + _Count - _First) % _Count < _Rest) {
+                ++_Share;
+            }
+
+            for (size_t _Submitted = 0; _Submitted < _Share; ++_Submitted) {
+                SubmitThreadpoolWork(_Pool_work._Work);
+            }
+        }
+    }
 } // unnamed namespace
 
 extern "C" {
@@ -31,30 +403,243 @@ _NODISCARD unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcep
         __iso_volatile_store32(&_Cached_hw_concurrency, _Hw_concurrency);
     }
 
-    return static_cast<unsigned int>(_Hw_concurrency);
+    const auto _Result = static_cast<unsigned int>(_Hw_concurrency);
+    if (_Thread_max_concurrency != 0 && _Thread_max_concurrency < _Result) {
+        return _Thread_max_concurrency;
+    }
+
+    return _Result;
+}
+
+_NODISCARD PTP_CALLBACK_ENVIRON __stdcall __std_parallel_algorithms_exchange_callback_environ(
+    PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
+    const auto _Old          = _Thread_callback_environ;
+    _Thread_callback_environ = _Callback_environ;
+    return _Old;
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_exchange_max_concurrency(
+    const unsigned int _Max_concurrency) noexcept {
+    const auto _Old         = _Thread_max_concurrency;
+    _Thread_max_concurrency = _Max_concurrency;
+    return _Old;
+}
+
+_NODISCARD size_t __stdcall __std_parallel_algorithms_min_chunk_size() noexcept {
+    return _Thread_min_chunk_size;
+}
+
+_NODISCARD size_t __stdcall __std_parallel_algorithms_chunk_count() noexcept {
+    return _Thread_chunk_count;
+}
+
+_NODISCARD size_t __stdcall __std_parallel_algorithms_exchange_min_chunk_size(const size_t _Min_chunk_size) noexcept {
+    const auto _Old        = _Thread_min_chunk_size;
+    _Thread_min_chunk_size = _Min_chunk_size;
+    return _Old;
+}
+
+_NODISCARD size_t __stdcall __std_parallel_algorithms_exchange_chunk_count(const size_t _Chunk_count) noexcept {
+    const auto _Old     = _Thread_chunk_count;
+    _Thread_chunk_count = _Chunk_count;
+    return _Old;
+}
+
+_NODISCARD bool __stdcall __std_parallel_algorithms_exchange_numa_placement(const bool _Numa_placement) noexcept {
+    const auto _Old        = _Thread_numa_placement;
+    _Thread_numa_placement = _Numa_placement;
+    return _Old;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_scratch() noexcept {
+    return _Thread_scratch;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_exchange_scratch(void* const _Scratch) noexcept {
+    const auto _Old = _Thread_scratch;
+    _Thread_scratch = _Scratch;
+    return _Old;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_task_group_membership() noexcept {
+    return _Thread_task_group_membership;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_exchange_task_group_membership(void* const _Membership) noexcept {
+    const auto _Old               = _Thread_task_group_membership;
+    _Thread_task_group_membership = _Membership;
+    return _Old;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_acquire_cached_scratch(const size_t _Bytes) noexcept {
+    // get the cached block, grown to at least _Bytes, or nullptr if it's in use or can't grow
+    auto& _Cache = _Thread_scratch_cache;
+    if (_Cache._In_use) {
+        return nullptr;
+    }
+
+    if (_Cache._Size < _Bytes) {
+        _Cache._Free();
+        _Cache._Block = ::operator new(_Bytes, std::nothrow);
+        if (!_Cache._Block) {
+            return nullptr;
+        }
+
+        _Cache._Size = _Bytes;
+    }
+
+    _Cache._In_use = true;
+    return _Cache._Block;
+}
+
+_NODISCARD bool __stdcall __std_parallel_algorithms_release_cached_scratch(void* const _Block) noexcept {
+    // give back the cached block if _Block is it, and return whether it was
+    auto& _Cache = _Thread_scratch_cache;
+    if (!_Cache._In_use || _Block != _Cache._Block) {
+        return false;
+    }
+
+    _Cache._In_use = false;
+    return true;
+}
+
+void __stdcall __std_parallel_algorithms_trim_cached_scratch() noexcept {
+    auto& _Cache = _Thread_scratch_cache;
+    if (!_Cache._In_use) {
+        _Cache._Free();
+    }
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_numa_nodes() noexcept {
+    // the number of node pools that work created on this thread goes to, or 0 if it doesn't go to node pools
+    const auto _Nodes = _Selected_numa_node_pools(_Thread_callback_environ);
+    return _Nodes ? _Nodes->_Count : 0u;
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_numa_node_processors(const unsigned int _Node) noexcept {
+    // pre: _Node < __std_parallel_algorithms_numa_nodes()
+    return _Numa_node_pools._Pools[_Node]._Processors;
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_current_numa_node() noexcept {
+    // the index of the node pool of the processor running the calling thread, or 0 if it isn't known
+    const auto& _Nodes = _Acquire_numa_node_pools();
+    if (!_Nodes._Pools) {
+        return 0;
+    }
+
+    for (unsigned int _Idx = 0; _Idx < _Nodes._Count; ++_Idx) {
+        if (_Thread_pool == &_Nodes._Pools[_Idx]) {
+            return _Idx;
+        }
+    }
+
+    PROCESSOR_NUMBER _Processor;
+    _Get_current_processor_number(&_Processor);
+    USHORT _Node;
+    if (_Get_numa_processor_node(&_Processor, &_Node)) {
+        for (unsigned int _Idx = 0; _Idx < _Nodes._Count; ++_Idx) {
+            if (_Nodes._Pools[_Idx]._Numa_node == _Node) {
+                return _Idx;
+            }
+        }
+    }
+
+    return 0;
 }
 
 _NODISCARD PTP_WORK __stdcall __std_create_threadpool_work(
     PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
-    return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
+    if (!_Callback_environ) {
+        _Callback_environ = _Thread_callback_environ;
+    }
+
+    if (!_Uses_parallel_work()) {
+        return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
+    }
+
+    const _Affinitized_pools* _Pools = _Selected_numa_node_pools(_Callback_environ);
+    if (!_Pools && !_Callback_environ && _Acquire_processor_group_pools()._Pools) {
+        _Pools = &_Processor_group_pools;
+    }
+
+    const unsigned int _Count = _Pools ? _Pools->_Count : 1u;
+    const auto _Work          = static_cast<_Parallel_work*>(
+        HeapAlloc(GetProcessHeap(), 0, sizeof(_Parallel_work) + (_Count - 1) * sizeof(_Pool_work)));
+    if (!_Work) {
+        return nullptr;
+    }
+
+    _Work->_Callback   = _Callback;
+    _Work->_Context    = _Context;
+    _Work->_Next_pool  = 0;
+    _Work->_Count      = _Count;
+    _Work->_Processors = _Pools ? _Pools->_Processors : 0u;
+    for (unsigned int _Idx = 0; _Idx < _Count; ++_Idx) {
+        auto& _Target  = _Work->_Works[_Idx];
+        _Target._Owner = _Work;
+        _Target._Pool  = _Pools ? &_Pools->_Pools[_Idx] : nullptr;
+        _Target._Work  = CreateThreadpoolWork(
+            &_Parallel_work_callback, &_Target, _Target._Pool ? &_Target._Pool->_Environment : _Callback_environ);
+        if (!_Target._Work) {
+            _Close_pool_works(_Work, _Idx);
+            return nullptr;
+        }
+    }
+
+    return reinterpret_cast<PTP_WORK>(_Work);
 }
 
 void __stdcall __std_submit_threadpool_work(PTP_WORK _Work) noexcept {
-    SubmitThreadpoolWork(_Work);
+    _STL_TRACE("ParallelSubmit", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, TraceLoggingPointer(_Work, "Work"),
+        TraceLoggingUInt64(1, "Submissions"));
+    if (_Uses_parallel_work()) {
+        _Submit_parallel_work(reinterpret_cast<_Parallel_work*>(_Work), 1);
+    } else {
+        SubmitThreadpoolWork(_Work);
+    }
 }
 
-void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, const size_t _Submissions) noexcept {
-    for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx) {
-        SubmitThreadpoolWork(_Work);
+void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, size_t _Submissions) noexcept {
+    if (_Thread_max_concurrency != 0 && _Submissions >= _Thread_max_concurrency) {
+        // the calling thread also participates, so at most _Thread_max_concurrency - 1 callbacks are needed
+        _Submissions = _Thread_max_concurrency - 1;
+    }
+
+    _STL_TRACE("ParallelSubmit", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, TraceLoggingPointer(_Work, "Work"),
+        TraceLoggingUInt64(_Submissions, "Submissions"));
+    if (_Uses_parallel_work()) {
+        _Submit_parallel_work(reinterpret_cast<_Parallel_work*>(_Work), _Submissions);
+    } else {
+        for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx) {
+            SubmitThreadpoolWork(_Work);
+        }
     }
 }
 
 void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
-    CloseThreadpoolWork(_Work);
+    if (_Uses_parallel_work()) {
+        const auto _Parallel = reinterpret_cast<_Parallel_work*>(_Work);
+        _Close_pool_works(_Parallel, _Parallel->_Count);
+    } else {
+        CloseThreadpoolWork(_Work);
+    }
 }
 
 void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
-    WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
+    _STL_TRACE("ParallelWait", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, _STL_TRACE_START,
+        TraceLoggingPointer(_Work, "Work"));
+    if (_Uses_parallel_work()) {
+        const auto _Parallel = reinterpret_cast<_Parallel_work*>(_Work);
+        for (unsigned int _Idx = 0; _Idx < _Parallel->_Count; ++_Idx) {
+            WaitForThreadpoolWorkCallbacks(_Parallel->_Works[_Idx]._Work, _Cancel);
+        }
+    } else {
+        WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
+    }
+
+    _STL_TRACE("ParallelWait", _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS, _STL_TRACE_STOP,
+        TraceLoggingPointer(_Work, "Work"));
 }
 
 void __stdcall __std_execution_wait_on_uchar(const volatile unsigned char* _Address, unsigned char _Compare) noexcept {
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Internal definitions for sleeps and timed waits with high resolution timeouts.
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <xtimec.h>
+
+#include <Windows.h>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif // CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+
+_STD_BEGIN
+// Sleep and SleepConditionVariableSRW take timeouts in milliseconds, which expire on a tick of the system timer (every
+// 15.6 ms by default). Instead, sleeps and timed waits wait on a high resolution waitable timer (Windows 10, version
+// 1803 and later) set to shortly before the deadline, and spin for the rest, which is shorter than the timer's latency.
+inline constexpr long long _Precise_spin_limit = 1'000; // 100 us, in 100-nanosecond units
+
+using _Precise_timer_callback_t = void(__cdecl*)(void*) noexcept;
+
+struct _Precise_timer {
+    HANDLE _Handle;
+    PTP_WAIT _Wait                      = nullptr; // created on first use by _Arm_precise_timer_callback
+    _Precise_timer_callback_t _Callback = nullptr;
+    void* _Context                      = nullptr;
+    atomic<bool> _Fired{false};
+    _Precise_timer* _Next = nullptr; // in the list of unused timers
+};
+
+inline SRWLOCK _Precise_timer_lock           = SRWLOCK_INIT;
+inline _Precise_timer* _Unused_precise_timers = nullptr; // guarded by _Precise_timer_lock
+inline atomic<bool> _Precise_timers_unavailable{false};
+
+// returns nullptr if high resolution timers aren't available; the timers are kept for reuse, and never freed
+[[nodiscard]] inline _Precise_timer* _Acquire_precise_timer() noexcept {
+    AcquireSRWLockExclusive(&_Precise_timer_lock);
+    const auto _Unused = _Unused_precise_timers;
+    if (_Unused) {
+        _Unused_precise_timers = _Unused->_Next;
+    }
+
+    ReleaseSRWLockExclusive(&_Precise_timer_lock);
+    if (_Unused || _Precise_timers_unavailable.load(memory_order_relaxed)) {
+        return _Unused;
+    }
+
+    const HANDLE _Handle =
+        CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!_Handle) {
+        _Precise_timers_unavailable.store(true, memory_order_relaxed);
+        return nullptr;
+    }
+
+    const auto _Timer = new (nothrow) _Precise_timer{_Handle};
+    if (!_Timer) {
+        CloseHandle(_Handle);
+    }
+
+    return _Timer;
+}
+
+inline void _Release_precise_timer(_Precise_timer* const _Timer) noexcept {
+    if (_Timer) {
+        AcquireSRWLockExclusive(&_Precise_timer_lock);
+        _Timer->_Next          = _Unused_precise_timers;
+        _Unused_precise_timers = _Timer;
+        ReleaseSRWLockExclusive(&_Precise_timer_lock);
+    }
+}
+
+[[nodiscard]] inline bool _Set_precise_timer(_Precise_timer& _Timer, const long long _Timeout) noexcept {
+    // _Timeout is in 100-nanosecond units
+    LARGE_INTEGER _Due_time;
+    _Due_time.QuadPart = -_Timeout; // negative for a relative time
+    return SetWaitableTimer(_Timer._Handle, &_Due_time, 0, nullptr, nullptr, FALSE) != 0;
+}
+
+inline void CALLBACK _Precise_timer_callback(PTP_CALLBACK_INSTANCE, void* const _Context, PTP_WAIT, TP_WAIT_RESULT) {
+    const auto _Timer = static_cast<_Precise_timer*>(_Context);
+    _Timer->_Fired.store(true, memory_order_relaxed);
+    _Timer->_Callback(_Timer->_Context);
+}
+
+// calls _Callback(_Context) on a thread pool thread when _Timeout (in 100-nanosecond units) elapses, unless
+// _Disarm_precise_timer_callback is called first
+[[nodiscard]] inline bool _Arm_precise_timer_callback(_Precise_timer& _Timer, const long long _Timeout,
+    const _Precise_timer_callback_t _Callback, void* const _Context) noexcept {
+    if (!_Timer._Wait) {
+        _Timer._Wait = CreateThreadpoolWait(&_Precise_timer_callback, &_Timer, nullptr);
+        if (!_Timer._Wait) {
+            return false;
+        }
+    }
+
+    _Timer._Callback = _Callback;
+    _Timer._Context  = _Context;
+    _Timer._Fired.store(false, memory_order_relaxed);
+    if (!_Set_precise_timer(_Timer, _Timeout)) {
+        return false;
+    }
+
+    SetThreadpoolWait(_Timer._Wait, _Timer._Handle, nullptr);
+    return true;
+}
+
+// returns whether the callback was called; it has returned by the time this function does
+[[nodiscard]] inline bool _Disarm_precise_timer_callback(_Precise_timer& _Timer) noexcept {
+    SetThreadpoolWait(_Timer._Wait, nullptr, nullptr);
+    WaitForThreadpoolWaitCallbacks(_Timer._Wait, TRUE);
+    CancelWaitableTimer(_Timer._Handle);
+    return _Timer._Fired.load(memory_order_relaxed);
+}
+
+[[nodiscard]] inline long long _Xtime_to_ticks(const xtime* const _Xt) noexcept {
+    // in 100-nanosecond units since the epoch, like _Xtime_get_ticks; rounds up
+    return _Xt->sec * 10'000'000LL + (_Xt->nsec + 99) / 100;
+}
+
+[[nodiscard]] inline unsigned long _Ticks_to_milliseconds(const long long _Ticks) noexcept {
+    // rounds up, and limits the timeout to ten days
+    constexpr long long _Ten_days = 864'000'000;
+    const long long _Result       = (_Ticks + 9'999) / 10'000;
+    return static_cast<unsigned long>(_Result < _Ten_days ? _Result : _Ten_days);
+}
+
+inline void _Spin_until_ticks(const long long _Deadline) noexcept {
+    while (_Xtime_get_ticks() < _Deadline) {
+        YieldProcessor();
+    }
+}
+_STD_END
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement bulk and buffered random_device values
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <Windows.h>
+
+// clang-format on
+
+namespace {
+    using _Process_prng_t   = BOOL(WINAPI*)(PBYTE, SIZE_T);
+    using _Rtl_gen_random_t = BOOLEAN(WINAPI*)(PVOID, ULONG);
+
+    struct _Random_functions_table {
+        std::atomic<_Process_prng_t> _Pfn_ProcessPrng{nullptr};
+        std::atomic<_Rtl_gen_random_t> _Pfn_RtlGenRandom{nullptr};
+        std::atomic<bool> _Initialized{false};
+    };
+
+    _Random_functions_table _Random_functions;
+
+    void _Init_random_functions() noexcept {
+        // rand_s calls RtlGenRandom, which loads the module exporting ProcessPrng on Windows 10 and later; only look
+        // for modules that are already loaded, rather than loading any while the loader lock might be held
+        unsigned int _Ignored;
+        (void) rand_s(&_Ignored);
+
+        const HMODULE _Prng_module = GetModuleHandleW(L"bcryptprimitives.dll");
+        if (_Prng_module) {
+            _Random_functions._Pfn_ProcessPrng.store(
+                reinterpret_cast<_Process_prng_t>(GetProcAddress(_Prng_module, "ProcessPrng")),
+                std::memory_order_relaxed);
+        }
+
+        const HMODULE _Advapi_module = GetModuleHandleW(L"advapi32.dll");
+        if (_Advapi_module) {
+            _Random_functions._Pfn_RtlGenRandom.store(
+                reinterpret_cast<_Rtl_gen_random_t>(GetProcAddress(_Advapi_module, "SystemFunction036")),
+                std::memory_order_relaxed);
+        }
+
+        _Random_functions._Initialized.store(true, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool _Fill_random(unsigned char* _Buffer, size_t _Size) noexcept {
+        if (!_Random_functions._Initialized.load(std::memory_order_acquire)) {
+            _Init_random_functions(); // racing initializations store the same pointers
+        }
+
+        const auto _Process_prng = _Random_functions._Pfn_ProcessPrng.load(std::memory_order_relaxed);
+        if (_Process_prng) {
+            return _Process_prng(_Buffer, _Size) != FALSE; // documented to always succeed
+        }
+
+        const auto _Rtl_gen_random = _Random_functions._Pfn_RtlGenRandom.load(std::memory_order_relaxed);
+        if (_Rtl_gen_random) {
+            constexpr size_t _Max_chunk = 0x1000'0000; // takes a ULONG size
+            while (_Size != 0) {
+                const size_t _Chunk = _Size < _Max_chunk ? _Size : _Max_chunk;
+                if (!_Rtl_gen_random(_Buffer, static_cast<ULONG>(_Chunk))) {
+                    return false;
+                }
+
+                _Buffer += _Chunk;
+                _Size -= _Chunk;
+            }
+
+            return true;
+        }
+
+        while (_Size != 0) { // as _Random_device does, one value at a time
+            unsigned int _Value;
+            if (rand_s(&_Value) != 0) {
+                return false;
+            }
+
+            const size_t _Chunk = _Size < sizeof(_Value) ? _Size : sizeof(_Value);
+            std::memcpy(_Buffer, &_Value, _Chunk);
+            _Buffer += _Chunk;
+            _Size -= _Chunk;
+        }
+
+        return true;
+    }
+
+    // values taken from the buffer are erased, so it never holds values that were already handed out
+    struct _Random_buffer {
+        static constexpr size_t _Capacity = 64;
+
+        unsigned int _Values[_Capacity];
+        size_t _Next = _Capacity;
+
+        ~_Random_buffer() {
+            SecureZeroMemory(_Values, sizeof(_Values));
+        }
+    };
+
+    thread_local _Random_buffer _Thread_random_buffer;
+} // unnamed namespace
+
+extern "C" {
+[[nodiscard]] int __stdcall __std_random_device_fill(void* const _Buffer, const size_t _Size) noexcept {
+    return _Fill_random(static_cast<unsigned char*>(_Buffer), _Size);
+}
+
+[[nodiscard]] int __stdcall __std_random_device_buffered(unsigned int* const _Value) noexcept {
+    auto& _Buf = _Thread_random_buffer;
+    if (_Buf._Next == _Random_buffer::_Capacity) {
+        if (!_Fill_random(reinterpret_cast<unsigned char*>(_Buf._Values), sizeof(_Buf._Values))) {
+            return false;
+        }
+
+        _Buf._Next = 0;
+    }
+
+    unsigned int& _Slot = _Buf._Values[_Buf._Next++];
+    *_Value             = _Slot;
+    _Slot               = 0;
+    return true;
+}
+} // extern "C"
@@ -0,0 +1,395 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement stdext::hazard_pointer and stdext::rcu_domain
+
+// clang-format off
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <Windows.h>
+
+// clang-format on
+
+// same layout as the declaration in <memory>
+struct __std_reclaimable {
+    __std_reclaimable* _Next;
+    void(__stdcall* _Reclaim)(__std_reclaimable* _Node) noexcept;
+    const void* _Ptr;
+};
+
+// same layout as the declaration in <memory>
+struct __std_hazard_pointer_slot {
+    std::atomic<const void*> _Protected;
+};
+
+namespace {
+    // Readers publish what they use with plain stores and compiler barriers; before looking at what readers have
+    // published, reclaimers flush the write buffers of every processor, which serializes the readers' stores with
+    // their later loads as a full fence on each reader would.
+    void _Asymmetric_fence() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        FlushProcessWriteBuffers();
+    }
+
+    // retired objects, pushed by any thread and taken all at once by the reclaimer
+    struct _Retired_list {
+        std::atomic<__std_reclaimable*> _Head{nullptr};
+        std::atomic<size_t> _Count{0};
+        std::atomic<bool> _Scheduled{false};
+
+        // returns the new count
+        size_t _Push(__std_reclaimable* const _First, __std_reclaimable* const _Last, const size_t _Nodes) noexcept {
+            auto _Old = _Head.load(std::memory_order_relaxed);
+            do {
+                _Last->_Next = _Old;
+            } while (!_Head.compare_exchange_weak(_Old, _First, std::memory_order_release, std::memory_order_relaxed));
+
+            return _Count.fetch_add(_Nodes, std::memory_order_relaxed) + _Nodes;
+        }
+
+        [[nodiscard]] __std_reclaimable* _Take() noexcept {
+            return _Head.exchange(nullptr, std::memory_order_acquire);
+        }
+    };
+
+    void _Reclaim_all(__std_reclaimable* _Node) noexcept {
+        while (_Node) {
+            // the reclaim callback frees the node
+            const auto _Next = _Node->_Next;
+            _Node->_Reclaim(_Node);
+            _Node = _Next;
+        }
+    }
+
+    // runs _Callback on the system threadpool, at most once at a time for each list; returns false if it can't
+    [[nodiscard]] bool _Schedule(_Retired_list& _List, const PTP_SIMPLE_CALLBACK _Callback) noexcept {
+        if (_List._Scheduled.exchange(true, std::memory_order_acquire)) {
+            return true; // already scheduled; it will see what was just pushed
+        }
+
+        if (TrySubmitThreadpoolCallback(_Callback, nullptr, nullptr)) {
+            return true;
+        }
+
+        _List._Scheduled.store(false, std::memory_order_release);
+        return false;
+    }
+
+    // HAZARD POINTERS
+    struct _Hazard_record {
+        __std_hazard_pointer_slot _Slot; // must be first
+        std::atomic<bool> _In_use{true};
+        _Hazard_record* _Next = nullptr;
+    };
+
+    // records are never freed, so that the reclaimer can read them without synchronizing with their owners
+    std::atomic<_Hazard_record*> _Hazard_records{nullptr};
+    std::atomic<size_t> _Hazard_record_count{0};
+    _Retired_list _Hazard_retired;
+    SRWLOCK _Hazard_reclaim_lock = SRWLOCK_INIT;
+
+    // a thread that keeps making hazard pointers reuses the records it released without scanning for them
+    struct _Hazard_record_cache {
+        static constexpr size_t _Capacity = 8;
+
+        _Hazard_record* _Records[_Capacity];
+        size_t _Size = 0;
+
+        _Hazard_record_cache() = default;
+        _Hazard_record_cache(const _Hazard_record_cache&) = delete;
+        _Hazard_record_cache& operator=(const _Hazard_record_cache&) = delete;
+
+        ~_Hazard_record_cache() {
+            while (_Size != 0) {
+                _Records[--_Size]->_In_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local _Hazard_record_cache _Hazard_cache;
+
+    [[nodiscard]] size_t _Hazard_threshold() noexcept {
+        return (std::max)(size_t{1000}, 2 * _Hazard_record_count.load(std::memory_order_relaxed));
+    }
+
+    // a reclaimer that doesn't wait leaves the work to the one already running, which may be this thread when a
+    // deleter retires another object
+    void _Hazard_reclaim(const bool _Wait) noexcept {
+        if (_Wait) {
+            AcquireSRWLockExclusive(&_Hazard_reclaim_lock);
+        } else if (!TryAcquireSRWLockExclusive(&_Hazard_reclaim_lock)) {
+            return;
+        }
+
+        __std_reclaimable* _Node = _Hazard_retired._Take();
+        if (_Node) {
+            size_t _Taken = 0;
+            for (auto _Counted = _Node; _Counted; _Counted = _Counted->_Next) {
+                ++_Taken;
+            }
+
+            _Hazard_retired._Count.fetch_sub(_Taken, std::memory_order_relaxed);
+            _Asymmetric_fence();
+
+            std::vector<const void*> _Protected;
+            bool _Collected = true;
+            try {
+                _Protected.reserve(_Hazard_record_count.load(std::memory_order_relaxed));
+                for (auto _Record = _Hazard_records.load(std::memory_order_acquire); _Record;
+                     _Record      = _Record->_Next) {
+                    const auto _Ptr = _Record->_Slot._Protected.load(std::memory_order_acquire);
+                    if (_Ptr) {
+                        _Protected.push_back(_Ptr);
+                    }
+                }
+            } catch (const std::bad_alloc&) {
+                _Collected = false;
+            }
+
+            if (_Collected) {
+                std::sort(_Protected.begin(), _Protected.end());
+                __std_reclaimable* _Kept_first = nullptr;
+                __std_reclaimable* _Kept_last  = nullptr;
+                size_t _Kept                   = 0;
+                while (_Node) {
+                    const auto _Next = _Node->_Next;
+                    if (std::binary_search(_Protected.begin(), _Protected.end(), _Node->_Ptr)) {
+                        _Node->_Next = _Kept_first;
+                        _Kept_first  = _Node;
+                        if (!_Kept_last) {
+                            _Kept_last = _Node;
+                        }
+
+                        ++_Kept;
+                    } else {
+                        _Node->_Reclaim(_Node);
+                    }
+
+                    _Node = _Next;
+                }
+
+                if (_Kept_first) {
+                    (void) _Hazard_retired._Push(_Kept_first, _Kept_last, _Kept);
+                }
+            } else {
+                // try again at the next threshold
+                auto _Last = _Node;
+                while (_Last->_Next) {
+                    _Last = _Last->_Next;
+                }
+
+                (void) _Hazard_retired._Push(_Node, _Last, _Taken);
+            }
+        }
+
+        ReleaseSRWLockExclusive(&_Hazard_reclaim_lock);
+    }
+
+    void CALLBACK _Hazard_reclaim_callback(PTP_CALLBACK_INSTANCE, void*) noexcept {
+        _Hazard_retired._Scheduled.store(false, std::memory_order_release);
+        _Hazard_reclaim(true);
+    }
+
+    // RCU
+    struct _Rcu_reader {
+        // the epoch when the outermost read-side critical section began, or 0 outside of one
+        std::atomic<unsigned long long> _Epoch{0};
+        unsigned long _Nesting = 0;
+        std::atomic<bool> _In_use{true};
+        _Rcu_reader* _Next = nullptr;
+    };
+
+    std::atomic<unsigned long long> _Rcu_epoch{1};
+    // readers are never freed, so that rcu_synchronize can read them without synchronizing with their owners
+    std::atomic<_Rcu_reader*> _Rcu_readers{nullptr};
+    _Retired_list _Rcu_retired;
+    SRWLOCK _Rcu_reclaim_lock = SRWLOCK_INIT;
+    constexpr size_t _Rcu_threshold = 1000;
+
+    struct _Rcu_thread_reader {
+        _Rcu_reader* _Reader = nullptr;
+
+        _Rcu_thread_reader() = default;
+        _Rcu_thread_reader(const _Rcu_thread_reader&) = delete;
+        _Rcu_thread_reader& operator=(const _Rcu_thread_reader&) = delete;
+
+        ~_Rcu_thread_reader() {
+            if (_Reader) {
+                _Reader->_In_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local _Rcu_thread_reader _Rcu_this_thread;
+
+    [[nodiscard]] _Rcu_reader& _Rcu_get_reader() noexcept {
+        auto& _Reader = _Rcu_this_thread._Reader;
+        if (!_Reader) {
+            for (auto _Existing = _Rcu_readers.load(std::memory_order_acquire); _Existing;
+                 _Existing      = _Existing->_Next) {
+                bool _Expected = false;
+                if (!_Existing->_In_use.load(std::memory_order_relaxed)
+                    && _Existing->_In_use.compare_exchange_strong(_Expected, true, std::memory_order_acquire)) {
+                    _Reader = _Existing;
+                    return *_Reader;
+                }
+            }
+
+            // rcu_domain::lock() can't fail, so running out of memory for the first read-side critical section of a
+            // thread terminates
+            const auto _New = new _Rcu_reader;
+            auto _Head      = _Rcu_readers.load(std::memory_order_relaxed);
+            do {
+                _New->_Next = _Head;
+            } while (!_Rcu_readers.compare_exchange_weak(_Head, _New, std::memory_order_release));
+
+            _Reader = _New;
+        }
+
+        return *_Reader;
+    }
+
+    void _Rcu_wait_for_readers() noexcept {
+        const auto _Target = _Rcu_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+        _Asymmetric_fence();
+        for (auto _Reader = _Rcu_readers.load(std::memory_order_acquire); _Reader; _Reader = _Reader->_Next) {
+            for (unsigned int _Spins = 0;; ++_Spins) {
+                const auto _Epoch = _Reader->_Epoch.load(std::memory_order_acquire);
+                if (_Epoch == 0 || _Epoch >= _Target) {
+                    break;
+                }
+
+                // read-side critical sections are usually short
+                if (_Spins < 64) {
+                    YieldProcessor();
+                } else if (_Spins < 128) {
+                    (void) SwitchToThread();
+                } else {
+                    Sleep(1);
+                }
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    // see _Hazard_reclaim
+    void _Rcu_reclaim(const bool _Wait) noexcept {
+        if (_Wait) {
+            AcquireSRWLockExclusive(&_Rcu_reclaim_lock);
+        } else if (!TryAcquireSRWLockExclusive(&_Rcu_reclaim_lock)) {
+            return;
+        }
+
+        const auto _Node = _Rcu_retired._Take();
+        if (_Node) {
+            size_t _Taken = 0;
+            for (auto _Counted = _Node; _Counted; _Counted = _Counted->_Next) {
+                ++_Taken;
+            }
+
+            _Rcu_retired._Count.fetch_sub(_Taken, std::memory_order_relaxed);
+            _Rcu_wait_for_readers();
+            _Reclaim_all(_Node);
+        }
+
+        ReleaseSRWLockExclusive(&_Rcu_reclaim_lock);
+    }
+
+    void CALLBACK _Rcu_reclaim_callback(PTP_CALLBACK_INSTANCE, void*) noexcept {
+        _Rcu_retired._Scheduled.store(false, std::memory_order_release);
+        _Rcu_reclaim(true);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] __std_hazard_pointer_slot* __stdcall __std_hazard_pointer_acquire() noexcept {
+    auto& _Cache = _Hazard_cache;
+    if (_Cache._Size != 0) {
+        return &_Cache._Records[--_Cache._Size]->_Slot;
+    }
+
+    for (auto _Record = _Hazard_records.load(std::memory_order_acquire); _Record; _Record = _Record->_Next) {
+        bool _Expected = false;
+        if (!_Record->_In_use.load(std::memory_order_relaxed)
+            && _Record->_In_use.compare_exchange_strong(_Expected, true, std::memory_order_acquire)) {
+            return &_Record->_Slot;
+        }
+    }
+
+    const auto _New = new (std::nothrow) _Hazard_record;
+    if (!_New) {
+        return nullptr;
+    }
+
+    auto _Head = _Hazard_records.load(std::memory_order_relaxed);
+    do {
+        _New->_Next = _Head;
+    } while (!_Hazard_records.compare_exchange_weak(_Head, _New, std::memory_order_release));
+
+    _Hazard_record_count.fetch_add(1, std::memory_order_relaxed);
+    return &_New->_Slot;
+}
+
+void __stdcall __std_hazard_pointer_release(__std_hazard_pointer_slot* const _Slot) noexcept {
+    const auto _Record = reinterpret_cast<_Hazard_record*>(_Slot);
+    _Record->_Slot._Protected.store(nullptr, std::memory_order_release);
+    auto& _Cache = _Hazard_cache;
+    if (_Cache._Size != _Hazard_record_cache::_Capacity) {
+        _Cache._Records[_Cache._Size++] = _Record;
+    } else {
+        _Record->_In_use.store(false, std::memory_order_release);
+    }
+}
+
+void __stdcall __std_hazard_pointer_retire(__std_reclaimable* const _Node) noexcept {
+    if (_Hazard_retired._Push(_Node, _Node, 1) >= _Hazard_threshold()
+        && !_Schedule(_Hazard_retired, &_Hazard_reclaim_callback)) {
+        _Hazard_reclaim(false);
+    }
+}
+
+void __stdcall __std_hazard_pointer_clean_up() noexcept {
+    _Hazard_reclaim(true);
+}
+
+void __stdcall __std_rcu_read_lock() noexcept {
+    auto& _Reader = _Rcu_get_reader();
+    if (_Reader._Nesting++ == 0) {
+        _Reader._Epoch.store(_Rcu_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        // see _Asymmetric_fence
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+}
+
+void __stdcall __std_rcu_read_unlock() noexcept {
+    auto& _Reader = *_Rcu_this_thread._Reader;
+    if (--_Reader._Nesting == 0) {
+        _Reader._Epoch.store(0, std::memory_order_release);
+    }
+}
+
+void __stdcall __std_rcu_synchronize() noexcept {
+    _Rcu_wait_for_readers();
+}
+
+void __stdcall __std_rcu_retire(__std_reclaimable* const _Node) noexcept {
+    if (_Rcu_retired._Push(_Node, _Node, 1) >= _Rcu_threshold && !_Schedule(_Rcu_retired, &_Rcu_reclaim_callback)) {
+        // reclaiming here would wait forever for a read-side critical section of this thread
+        const auto _Reader = _Rcu_this_thread._Reader;
+        if (!_Reader || _Reader->_Nesting == 0) {
+            _Rcu_reclaim(false);
+        }
+    }
+}
+
+void __stdcall __std_rcu_barrier() noexcept {
+    _Rcu_reclaim(true);
+}
+
+} // extern "C"
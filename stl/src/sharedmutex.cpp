@@ -10,12 +10,17 @@
 
 // these declarations must be in sync with those in xthreads.h
 
-using _Smtx_t = void*;
+using _Smtx_t     = void*;
+using _Cnd_srw_t = void*;
 
 extern "C" {
 
 static_assert(sizeof(_Smtx_t) == sizeof(SRWLOCK), "_Smtx_t must be the same size as SRWLOCK.");
 static_assert(alignof(_Smtx_t) == alignof(SRWLOCK), "_Smtx_t must be the same alignment as SRWLOCK.");
+static_assert(sizeof(_Cnd_srw_t) == sizeof(CONDITION_VARIABLE),
+    "_Cnd_srw_t must be the same size as CONDITION_VARIABLE.");
+static_assert(alignof(_Cnd_srw_t) == alignof(CONDITION_VARIABLE),
+    "_Cnd_srw_t must be the same alignment as CONDITION_VARIABLE.");
 
 void __cdecl _Smtx_lock_exclusive(_Smtx_t* smtx) { // lock shared mutex exclusively
     AcquireSRWLockExclusive(reinterpret_cast<PSRWLOCK>(smtx));
@@ -40,4 +45,18 @@ void __cdecl _Smtx_unlock_exclusive(_Smtx_t* smtx) { // unlock exclusive shared
 void __cdecl _Smtx_unlock_shared(_Smtx_t* smtx) { // unlock non-exclusive shared mutex
     ReleaseSRWLockShared(reinterpret_cast<PSRWLOCK>(smtx));
 }
+
+int __cdecl _Cnd_srw_wait(_Cnd_srw_t* cnd, _Smtx_t* smtx, unsigned long timeout) {
+    // release exclusive shared mutex and wait for up to timeout milliseconds; returns 0 once timeout elapses
+    return SleepConditionVariableSRW(
+        reinterpret_cast<PCONDITION_VARIABLE>(cnd), reinterpret_cast<PSRWLOCK>(smtx), timeout, 0);
+}
+
+void __cdecl _Cnd_srw_signal(_Cnd_srw_t* cnd) { // wake one waiter
+    WakeConditionVariable(reinterpret_cast<PCONDITION_VARIABLE>(cnd));
+}
+
+void __cdecl _Cnd_srw_broadcast(_Cnd_srw_t* cnd) { // wake all waiters
+    WakeAllConditionVariable(reinterpret_cast<PCONDITION_VARIABLE>(cnd));
+}
 }
@@ -3,6 +3,7 @@
 
 #include <cerrno>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 #include <utility>
@@ -525,3 +526,394 @@ _CRT_SATELLITE_2 _NODISCARD float __stdcall __std_smf_hypot3f(
     return _Hypot3(_Dx, _Dy, _Dz);
 }
 _END_EXTERN_C
+
+namespace {
+    constexpr size_t _Batch_block_size = 64;
+
+    template <class _Ty, class _Func>
+    void _Boost_batch(const _Ty* const _First, _Ty* const _Dest, const size_t _Count, const _Func& _Fn) noexcept {
+        // evaluates _Fn element-wise inside a single exception frame; if Boost throws, the remaining elements are
+        // finished one at a time so that only the offending element becomes NaN
+        size_t _Idx = 0;
+        _TRY_BEGIN
+        for (; _Idx < _Count; ++_Idx) {
+            _Dest[_Idx] = _Fn(_First[_Idx]);
+        }
+
+        return;
+        _CATCH_ALL
+        _CATCH_END
+
+        for (; _Idx < _Count; ++_Idx) {
+            const _Ty _Val = _First[_Idx];
+            _Dest[_Idx]    = _Boost_call([&] { return _Fn(_Val); });
+        }
+    }
+
+    template <class _Ty>
+    void _Fill_nan(_Ty* const _Dest, const size_t _Count, const _Ty _Nan) noexcept {
+        for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+            _Dest[_Idx] = _Nan;
+        }
+    }
+
+    template <class _Ty, class _Init, class _Next, class _Domain>
+    void _Recurrence_batch(const unsigned int _Degree, const _Ty* _First, _Ty* _Dest, size_t _Count,
+        const _Init& _Init_fn, const _Next& _Next_fn, const _Domain& _In_domain) noexcept {
+        // evaluates the same three-term recurrence as Boost, but advances a whole block of arguments per step so
+        // that the inner loop has no loop-carried dependency and can be vectorized; float arguments are
+        // evaluated in double, as Boost's promote_float policy does
+        double _Px[_Batch_block_size];
+        double _Pprev[_Batch_block_size];
+        double _Pcur[_Batch_block_size];
+        while (_Count != 0) {
+            const size_t _Block = _Count < _Batch_block_size ? _Count : _Batch_block_size;
+            for (size_t _Idx = 0; _Idx < _Block; ++_Idx) {
+                _Px[_Idx]    = static_cast<double>(_First[_Idx]);
+                _Pprev[_Idx] = 1.0;
+                _Pcur[_Idx]  = _Init_fn(_Px[_Idx]);
+            }
+
+            for (unsigned int _Nx = 1; _Nx < _Degree; ++_Nx) {
+                for (size_t _Idx = 0; _Idx < _Block; ++_Idx) {
+                    const double _Pnext = _Next_fn(_Nx, _Px[_Idx], _Pcur[_Idx], _Pprev[_Idx]);
+                    _Pprev[_Idx]        = _Pcur[_Idx];
+                    _Pcur[_Idx]         = _Pnext;
+                }
+            }
+
+            for (size_t _Idx = 0; _Idx < _Block; ++_Idx) {
+                const double _Val = _Px[_Idx];
+                if (_STD isnan(_Val)) {
+                    _Dest[_Idx] = static_cast<_Ty>(_Val);
+                } else if (!_In_domain(_Val)) {
+                    errno       = EDOM;
+                    _Dest[_Idx] = _STD numeric_limits<_Ty>::quiet_NaN();
+                } else {
+                    _Dest[_Idx] = static_cast<_Ty>(_Degree == 0 ? 1.0 : _Pcur[_Idx]);
+                }
+            }
+
+            _First += _Block;
+            _Dest += _Block;
+            _Count -= _Block;
+        }
+    }
+
+    template <class _Ty>
+    void _Hermite_batch(
+        const unsigned int _Pn, const _Ty* const _First, _Ty* const _Dest, const size_t _Count) noexcept {
+        _Recurrence_batch(
+            _Pn, _First, _Dest, _Count, [](const double _Px) { return 2 * _Px; },
+            [](const unsigned int _Nx, const double _Px, const double _Hn, const double _Hnm1) {
+                return 2 * _Px * _Hn - 2 * _Nx * _Hnm1;
+            },
+            [](double) { return true; });
+    }
+
+    template <class _Ty>
+    void _Laguerre_batch(
+        const unsigned int _Pn, const _Ty* const _First, _Ty* const _Dest, const size_t _Count) noexcept {
+        _Recurrence_batch(
+            _Pn, _First, _Dest, _Count, [](const double _Px) { return 1 - _Px; },
+            [](const unsigned int _Nx, const double _Px, const double _Ln, const double _Lnm1) {
+                return ((2 * _Nx + 1 - _Px) * _Ln - _Nx * _Lnm1) / (_Nx + 1);
+            },
+            [](double) { return true; });
+    }
+
+    template <class _Ty>
+    void _Legendre_batch(
+        const unsigned int _Pl, const _Ty* const _First, _Ty* const _Dest, const size_t _Count) noexcept {
+        _Recurrence_batch(
+            _Pl, _First, _Dest, _Count, [](const double _Px) { return _Px; },
+            [](const unsigned int _Nx, const double _Px, const double _Pn, const double _Pnm1) {
+                return ((2 * _Nx + 1) * _Px * _Pn - _Nx * _Pnm1) / (_Nx + 1);
+            },
+            [](const double _Px) { return -1 <= _Px && _Px <= 1; });
+    }
+} // unnamed namespace
+
+_EXTERN_C
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_comp_ellint_1(
+    const double* const _Pk, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const double _Val) {
+        return static_cast<double>(::boost::math::ellint_1(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_comp_ellint_1f(
+    const float* const _Pk, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const float _Val) {
+        return static_cast<float>(::boost::math::ellint_1(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_comp_ellint_2(
+    const double* const _Pk, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::ellint_2(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_comp_ellint_2f(
+    const float* const _Pk, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::ellint_2(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_i(
+    const double _Pnu, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::cyl_bessel_i(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_if(
+    const float _Pnu, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::cyl_bessel_i(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_j(
+    const double _Pnu, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::cyl_bessel_j(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_jf(
+    const float _Pnu, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::cyl_bessel_j(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_k(
+    const double _Pnu, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::cyl_bessel_k(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_bessel_kf(
+    const float _Pnu, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::cyl_bessel_k(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_neumann(
+    const double _Pnu, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::cyl_neumann(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_cyl_neumannf(
+    const float _Pnu, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    if (_STD isnan(_Pnu)) {
+        _Fill_nan(_Out, _Count, _Pnu);
+        return;
+    }
+
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::cyl_neumann(_Pnu, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_expint(
+    const double* const _Pk, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::expint(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_expintf(
+    const float* const _Pk, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::expint(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_hermite(
+    const unsigned int _Pn, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    _Hermite_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_hermitef(
+    const unsigned int _Pn, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    _Hermite_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_laguerre(
+    const unsigned int _Pn, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    _Laguerre_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_laguerref(
+    const unsigned int _Pn, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    _Laguerre_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_legendre(
+    const unsigned int _Pn, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    _Legendre_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_legendref(
+    const unsigned int _Pn, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    _Legendre_batch(_Pn, _Px, _Out, _Count);
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_riemann_zeta(
+    const double* const _Pk, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::zeta(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_riemann_zetaf(
+    const float* const _Pk, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Pk, _Out, _Count, [](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::zeta(_Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_sph_bessel(
+    const unsigned int _Pn, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::sph_bessel(_Pn, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_sph_besself(
+    const unsigned int _Pn, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::sph_bessel(_Pn, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_sph_neumann(
+    const unsigned int _Pn, const double* const _Px, double* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Px, _Out, _Count, [=](const double _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<double>(::boost::math::sph_neumann(_Pn, _Val));
+    });
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_batch_sph_neumannf(
+    const unsigned int _Pn, const float* const _Px, float* const _Out, const size_t _Count) noexcept {
+    _Boost_batch(_Px, _Out, _Count, [=](const float _Val) {
+        if (_STD isnan(_Val)) {
+            return _Val;
+        }
+
+        return static_cast<float>(::boost::math::sph_neumann(_Pn, _Val));
+    });
+}
+_END_EXTERN_C
@@ -3,6 +3,10 @@
 
 // initialize syncstream mutex map
 
+// The map below never leaves this file, so it may use either tree node layout.
+#define _ALLOW_COMPACT_TREE_NODES_MISMATCH
+
+#include <cstdint>
 #include <functional>
 #include <internal_shared.h>
 #include <map>
@@ -47,13 +51,41 @@ namespace {
         void deallocate(_Ty* const _Ptr, size_t) noexcept {
             _free_crt(_Ptr);
         }
+
+        template <class _Other>
+        _NODISCARD constexpr bool operator==(const _Crt_allocator<_Other>&) const noexcept {
+            return true;
+        }
     };
 
     using _Map_alloc = _Crt_allocator<_STD pair<void* const, _Mutex_count_pair>>;
     using _Map_type  = _STD map<void*, _Mutex_count_pair, _STD less<void*>, _Map_alloc>;
 
-    _Map_type _Lookup_map;
-    _STD shared_mutex _Lookup_mutex;
+    // The map is split into stripes selected by the address of the wrapped stream buffer, so that creating and
+    // destroying syncbufs for different stream buffers doesn't serialize on a single lock.
+    constexpr size_t _Lookup_table_size_power = 4;
+    constexpr size_t _Lookup_table_size       = 1 << _Lookup_table_size_power;
+    constexpr size_t _Lookup_table_index_mask = _Lookup_table_size - 1;
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Lookup_table_entry {
+        _STD shared_mutex _Lookup_mutex;
+        _Map_type _Lookup_map;
+        // The last entry whose reference count dropped to zero, reused by the next new entry. A program that creates
+        // an osyncstream per line of output then doesn't allocate a map node (and a mutex) each time.
+        _Map_type::node_type _Spare;
+    };
+#pragma warning(pop)
+
+    _Lookup_table_entry _Lookup_table[_Lookup_table_size];
+
+    [[nodiscard]] _Lookup_table_entry& _Lookup_table_entry_for(void* const _Ptr) noexcept {
+        auto _Index = reinterpret_cast<_STD uintptr_t>(_Ptr);
+        _Index ^= _Index >> (_Lookup_table_size_power * 2);
+        _Index ^= _Index >> _Lookup_table_size_power;
+        return _Lookup_table[(_Index >> 4) & _Lookup_table_index_mask]; // the low bits vary little between objects
+    }
 } // unnamed namespace
 
 _EXTERN_C
@@ -62,8 +94,19 @@ _EXTERN_C
 // A flat C interface would return an opaque handle and would provide separate functions for locking and unlocking.
 _NODISCARD _STD shared_mutex* __stdcall __std_acquire_shared_mutex_for_instance(void* _Ptr) noexcept {
     try {
+        auto& [_Lookup_mutex, _Lookup_map, _Spare] = _Lookup_table_entry_for(_Ptr);
         _STD scoped_lock _Guard(_Lookup_mutex);
-        auto& [_Mutex, _Refs] = _Lookup_map.try_emplace(_Ptr).first->second;
+        auto _Instance_mutex_iter = _Lookup_map.find(_Ptr);
+        if (_Instance_mutex_iter == _Lookup_map.end()) {
+            if (_Spare) {
+                _Spare.key()         = _Ptr;
+                _Instance_mutex_iter = _Lookup_map.insert(_STD move(_Spare)).position;
+            } else {
+                _Instance_mutex_iter = _Lookup_map.try_emplace(_Ptr).first;
+            }
+        }
+
+        auto& [_Mutex, _Refs] = _Instance_mutex_iter->second;
         ++_Refs;
         return &_Mutex;
     } catch (...) {
@@ -72,12 +115,17 @@ _NODISCARD _STD shared_mutex* __stdcall __std_acquire_shared_mutex_for_instance(
 }
 
 void __stdcall __std_release_shared_mutex_for_instance(void* _Ptr) noexcept {
+    auto& [_Lookup_mutex, _Lookup_map, _Spare] = _Lookup_table_entry_for(_Ptr);
     _STD scoped_lock _Guard(_Lookup_mutex);
     const auto _Instance_mutex_iter = _Lookup_map.find(_Ptr);
     _ASSERT_EXPR(_Instance_mutex_iter != _Lookup_map.end(), "No mutex exists for given instance!");
     auto& _Refs = _Instance_mutex_iter->second._Ref_count;
     if (--_Refs == 0) {
-        _Lookup_map.erase(_Instance_mutex_iter);
+        if (_Spare) {
+            _Lookup_map.erase(_Instance_mutex_iter);
+        } else {
+            _Spare = _Lookup_map.extract(_Instance_mutex_iter);
+        }
     }
 }
 
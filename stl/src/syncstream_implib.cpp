@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <yvals_core.h>
+
+#include <cstddef>
+#include <new>
+
+// This must be as small as possible, because its contents are
+// injected into the msvcprt.lib and msvcprtd.lib import libraries.
+// Do not include or define anything else here.
+// In particular, basic_string must not be included here.
+
+// Keeps one emission buffer per thread for basic_syncbufs that use allocator<_Elem>. This lives in the import library,
+// rather than in <syncstream>, so that the header doesn't define thread_local variables, and it isn't in the satellite
+// DLL, because the buffers come from the user's module's operator new.
+
+namespace {
+    // below _Big_allocation_threshold, allocator<_Elem> allocates and deallocates with plain ::operator new/delete
+    constexpr size_t _Max_cached_bytes = 2048;
+
+    struct _Cache_state {
+        void* _Ptr;
+        size_t _Elem_size;
+        size_t _Count;
+        bool _Thread_exited; // a syncbuf destroyed after this thread's cache has been released deallocates directly
+    };
+
+    // trivially destructible, so that it can still be used after _Release_at_thread_exit has run
+    thread_local _Cache_state _State{};
+
+    struct _Release_at_thread_exit {
+        _Release_at_thread_exit() = default;
+
+        _Release_at_thread_exit(const _Release_at_thread_exit&)            = delete;
+        _Release_at_thread_exit& operator=(const _Release_at_thread_exit&) = delete;
+
+        ~_Release_at_thread_exit() {
+            if (_State._Ptr) {
+                ::operator delete(_State._Ptr, _State._Elem_size * _State._Count);
+            }
+
+            _State = {nullptr, 0, 0, true};
+        }
+    };
+} // unnamed namespace
+
+_EXTERN_C
+_NODISCARD void* __stdcall __std_syncbuf_cache_take(const size_t _Elem_size, size_t* const _Count) noexcept {
+    // returns this thread's cached buffer of _Elem_size-byte elements and stores its element count, or returns nullptr
+    if (!_State._Ptr || _State._Elem_size != _Elem_size) {
+        *_Count = 0;
+        return nullptr;
+    }
+
+    void* const _Ptr = _State._Ptr;
+    *_Count          = _State._Count;
+    _State._Ptr      = nullptr;
+    _State._Count    = 0;
+    return _Ptr;
+}
+
+_NODISCARD bool __stdcall __std_syncbuf_cache_put(
+    void* const _Ptr, const size_t _Elem_size, const size_t _Count) noexcept {
+    // keeps [_Ptr, _Ptr + _Count) allocated by allocator<_Elem> for the next syncbuf on this thread, if there's room
+    if (_State._Ptr || _State._Thread_exited || _Count > _Max_cached_bytes / _Elem_size) {
+        return false;
+    }
+
+    static thread_local _Release_at_thread_exit _Guard;
+    (void) _Guard;
+    _State._Ptr       = _Ptr;
+    _State._Elem_size = _Elem_size;
+    _State._Count     = _Count;
+    return true;
+}
+_END_EXTERN_C
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement the cache of system_category() messages
+
+// clang-format off
+
+#include <__msvc_system_error_abi.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <Windows.h>
+
+// clang-format on
+
+namespace {
+    struct _Cached_message {
+        unsigned long _Message_id;
+        size_t _Length; // 0 if the message couldn't be formatted
+        char _Str[1]; // _Length characters and a null terminator
+    };
+
+    // Open addressing with linear probing. Entries are published once, never change, and are never freed, so lookups
+    // don't lock, and the returned messages live as long as the process. Messages are in the language of the thread
+    // that formatted them first.
+    constexpr size_t _Cache_size_power = 10;
+    constexpr size_t _Cache_size       = size_t{1} << _Cache_size_power;
+    constexpr size_t _Max_probes       = 16; // messages that don't fit within this many entries aren't cached
+
+    std::atomic<_Cached_message*> _Cache[_Cache_size]{};
+
+    [[nodiscard]] size_t _Message_hash(const unsigned long _Message_id) noexcept {
+        // Fibonacci hashing, as Windows error codes and HRESULTs share their low bits
+        return static_cast<size_t>((_Message_id * 0x9E37'79B9UL) & 0xFFFF'FFFFUL) >> (32 - _Cache_size_power);
+    }
+
+    [[nodiscard]] _Cached_message* _Format_message(const unsigned long _Message_id) noexcept {
+        char* _Str           = nullptr;
+        const size_t _Length = __std_system_error_allocate_message(_Message_id, &_Str);
+        const auto _Result   = static_cast<_Cached_message*>(_CSTD malloc(sizeof(_Cached_message) + _Length));
+        if (_Result) {
+            _Result->_Message_id = _Message_id;
+            _Result->_Length     = _Length;
+            if (_Length != 0) {
+                _CSTD memcpy(_Result->_Str, _Str, _Length);
+            }
+
+            _Result->_Str[_Length] = '\0';
+        }
+
+        __std_system_error_deallocate_message(_Str);
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+[[nodiscard]] const char* __stdcall __std_system_error_cached_message(
+    const unsigned long _Message_id, size_t* const _Length) noexcept {
+    _Cached_message* _Formatted = nullptr;
+    size_t _Idx                 = _Message_hash(_Message_id);
+    for (size_t _Probes = 0; _Probes != _Max_probes; ++_Probes, _Idx = (_Idx + 1) & (_Cache_size - 1)) {
+        _Cached_message* _Entry = _Cache[_Idx].load(std::memory_order_acquire);
+        if (!_Entry) {
+            if (!_Formatted) {
+                _Formatted = _Format_message(_Message_id);
+                if (!_Formatted) {
+                    return nullptr;
+                }
+            }
+
+            if (_Cache[_Idx].compare_exchange_strong(
+                    _Entry, _Formatted, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                *_Length = _Formatted->_Length;
+                return _Formatted->_Str;
+            }
+
+            // another thread published an entry here first; _Entry is now that entry
+        }
+
+        if (_Entry->_Message_id == _Message_id) {
+            _CSTD free(_Formatted);
+            *_Length = _Entry->_Length;
+            return _Entry->_Str;
+        }
+    }
+
+    _CSTD free(_Formatted);
+    return nullptr;
+}
+} // extern "C"
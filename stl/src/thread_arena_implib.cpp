@@ -0,0 +1,19 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// This must be as small as possible, because its contents are
+// injected into the msvcprt.lib and msvcprtd.lib import libraries.
+
+// The arena behind stdext::thread_arena lives here, rather than in <memory_resource>, so that the header doesn't define
+// thread_local variables, and it isn't in the satellite DLL, because its buffers come from the user's module's
+// operator new.
+
+#include <memory_resource>
+
+_STDEXT_BEGIN
+extern "C" _NODISCARD pmr::monotonic_arena_resource* __stdcall __std_thread_arena() noexcept {
+    // buffers come from new_delete_resource(), because get_default_resource() may be the arena itself
+    static thread_local pmr::monotonic_arena_resource _Local{16 * 1024, _STD pmr::new_delete_resource()};
+    return &_Local;
+}
+_STDEXT_END
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// implement the I/O completion support of <experimental/task>
+
+// clang-format off
+
+#include <cstddef>
+#include <new>
+#include <Windows.h>
+
+// clang-format on
+
+// same layout as the declarations in <experimental/task>
+struct __std_threadpool_io_overlapped {
+    ULONG_PTR _Internal;
+    ULONG_PTR _Internal_high;
+    DWORD _Offset;
+    DWORD _Offset_high;
+    HANDLE _Event;
+};
+
+using __std_threadpool_io_callback = void(__stdcall*)(void* _Context) noexcept;
+
+struct __std_threadpool_io_operation {
+    __std_threadpool_io_overlapped _Overlapped; // must be first
+    __std_threadpool_io_callback _Callback;
+    void* _Context;
+    unsigned long _Error;
+    size_t _Bytes_transferred;
+};
+
+struct __std_threadpool_io {
+    HANDLE _File;
+    PTP_IO _Io;
+};
+
+static_assert(sizeof(__std_threadpool_io_overlapped) == sizeof(OVERLAPPED));
+static_assert(alignof(__std_threadpool_io_overlapped) == alignof(OVERLAPPED));
+
+namespace {
+    void CALLBACK _Io_completion_callback(PTP_CALLBACK_INSTANCE const _Instance, void*, void* const _Overlapped,
+        const ULONG _Io_result, const ULONG_PTR _Bytes_transferred, PTP_IO) noexcept {
+        // the resumed coroutine may destroy the threadpool_io, which waits for outstanding callbacks
+        DisassociateCurrentThreadFromCallback(_Instance);
+        const auto _Operation          = static_cast<__std_threadpool_io_operation*>(_Overlapped);
+        _Operation->_Error             = _Io_result;
+        _Operation->_Bytes_transferred = static_cast<size_t>(_Bytes_transferred);
+        _Operation->_Callback(_Operation->_Context);
+    }
+
+    void _Start_operation(__std_threadpool_io* const _Io, __std_threadpool_io_operation* const _Operation,
+        const unsigned long long _Offset) noexcept {
+        _Operation->_Overlapped              = {};
+        _Operation->_Overlapped._Offset      = static_cast<DWORD>(_Offset);
+        _Operation->_Overlapped._Offset_high = static_cast<DWORD>(_Offset >> 32);
+        _Operation->_Error                   = 0;
+        _Operation->_Bytes_transferred       = 0;
+        StartThreadpoolIo(_Io->_Io);
+    }
+
+    [[nodiscard]] unsigned long _Finish_start(__std_threadpool_io* const _Io, const BOOL _Succeeded) noexcept {
+        // without FILE_SKIP_COMPLETION_PORT_ON_SUCCESS, a completion is queued even if the call succeeds at once
+        if (!_Succeeded) {
+            const DWORD _Error = GetLastError();
+            if (_Error != ERROR_IO_PENDING) {
+                CancelThreadpoolIo(_Io->_Io);
+                return _Error;
+            }
+        }
+
+        return 0;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] __std_threadpool_io* __stdcall __std_threadpool_io_create(
+    void* const _File, PTP_CALLBACK_ENVIRON const _Callback_environ) noexcept {
+    const auto _Io = new (std::nothrow) __std_threadpool_io{static_cast<HANDLE>(_File), nullptr};
+    if (!_Io) {
+        return nullptr;
+    }
+
+    _Io->_Io = CreateThreadpoolIo(_Io->_File, &_Io_completion_callback, nullptr, _Callback_environ);
+    if (!_Io->_Io) {
+        delete _Io;
+        return nullptr;
+    }
+
+    return _Io;
+}
+
+void __stdcall __std_threadpool_io_close(__std_threadpool_io* const _Io) noexcept {
+    WaitForThreadpoolIoCallbacks(_Io->_Io, FALSE);
+    CloseThreadpoolIo(_Io->_Io);
+    delete _Io;
+}
+
+[[nodiscard]] unsigned long __stdcall __std_threadpool_io_read(__std_threadpool_io* const _Io,
+    __std_threadpool_io_operation* const _Operation, void* const _Buffer, const unsigned long _Size,
+    const unsigned long long _Offset) noexcept {
+    _Start_operation(_Io, _Operation, _Offset);
+    return _Finish_start(_Io, ReadFile(_Io->_File, _Buffer, _Size, nullptr,
+                                  reinterpret_cast<OVERLAPPED*>(&_Operation->_Overlapped)));
+}
+
+[[nodiscard]] unsigned long __stdcall __std_threadpool_io_write(__std_threadpool_io* const _Io,
+    __std_threadpool_io_operation* const _Operation, const void* const _Buffer, const unsigned long _Size,
+    const unsigned long long _Offset) noexcept {
+    _Start_operation(_Io, _Operation, _Offset);
+    return _Finish_start(_Io, WriteFile(_Io->_File, _Buffer, _Size, nullptr,
+                                  reinterpret_cast<OVERLAPPED*>(&_Operation->_Overlapped)));
+}
+
+} // extern "C"
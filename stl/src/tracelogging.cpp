@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// defines the TraceLogging provider used by tracelogging.hpp; empty unless _STL_TRACELOGGING is defined
+
+#include "tracelogging.hpp"
+
+#ifdef _STL_TRACELOGGING
+
+#pragma comment(lib, "advapi32") // TraceLoggingRegister and TraceLoggingWrite call EventRegister and EventWriteTransfer
+
+// {6692509f-eebb-5196-3812-a72ab995d7e1} is the ETW name hash of "Microsoft.CPP.STL", so sessions can also enable
+// the provider by name.
+TRACELOGGING_DEFINE_PROVIDER(__std_tracelogging_provider, "Microsoft.CPP.STL",
+    (0x6692509f, 0xeebb, 0x5196, 0x38, 0x12, 0xa7, 0x2a, 0xb9, 0x95, 0xd7, 0xe1));
+
+namespace {
+    // Each module that contains instrumented code (msvcp140.dll, the satellite DLLs, and programs that link the static
+    // library or code from the import library) links this file and registers the provider for its own lifetime.
+    // Events written before registration, or after unregistration, are discarded.
+    struct _Tracelogging_registration {
+        _Tracelogging_registration() noexcept {
+            (void) TraceLoggingRegister(__std_tracelogging_provider);
+        }
+
+        _Tracelogging_registration(const _Tracelogging_registration&) = delete;
+        _Tracelogging_registration& operator=(const _Tracelogging_registration&) = delete;
+
+        ~_Tracelogging_registration() noexcept {
+            TraceLoggingUnregister(__std_tracelogging_provider);
+        }
+    };
+} // unnamed namespace
+
+#pragma warning(disable : 4074)
+#pragma init_seg(compiler)
+static _Tracelogging_registration _Registration;
+
+#endif // _STL_TRACELOGGING
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Opt-in TraceLogging instrumentation of the separately compiled STL.
+//
+// When the STL is built with _STL_TRACELOGGING defined (the STL_TRACELOGGING CMake option), the macros below write
+// events to the "Microsoft.CPP.STL" provider, {6692509f-eebb-5196-3812-a72ab995d7e1}, which any ETW session can
+// enable (for example, "wpr -start" with a profile naming *Microsoft.CPP.STL). Each area has its own keyword, so that
+// a session can enable the areas it needs. Otherwise the macros expand to nothing and this header includes nothing.
+//
+// Events that bracket a blocking operation are written as a pair with the WINEVENT_OPCODE_START and
+// WINEVENT_OPCODE_STOP opcodes on the same thread, which WPA can show as regions.
+
+#pragma once
+
+#ifdef _STL_TRACELOGGING
+#include <Windows.h>
+// clang-format off
+#include <TraceLoggingProvider.h>
+#include <winmeta.h>
+// clang-format on
+
+TRACELOGGING_DECLARE_PROVIDER(__std_tracelogging_provider);
+
+#define _STL_TRACE_KEYWORD_PARALLEL_ALGORITHMS 0x1
+#define _STL_TRACE_KEYWORD_ATOMIC_WAIT         0x2
+#define _STL_TRACE_KEYWORD_MUTEX               0x4
+#define _STL_TRACE_KEYWORD_FILESYSTEM          0x8
+
+// _STL_TRACE(event name string literal, keyword, one or more TraceLogging field macros)
+#define _STL_TRACE(_Event_name, _Keyword, ...) \
+    TraceLoggingWrite(__std_tracelogging_provider, _Event_name, TraceLoggingKeyword(_Keyword), __VA_ARGS__)
+
+#define _STL_TRACE_START TraceLoggingOpcode(WINEVENT_OPCODE_START)
+#define _STL_TRACE_STOP  TraceLoggingOpcode(WINEVENT_OPCODE_STOP)
+
+// whether a session is listening to _Keyword, for instrumentation that costs something beyond writing the event
+#define _STL_TRACE_ENABLED(_Keyword) TraceLoggingProviderEnabled(__std_tracelogging_provider, 0, _Keyword)
+
+namespace {
+    class _Fs_trace_scope { // brackets a filesystem call with FilesystemCall start and stop events
+    public:
+        _Fs_trace_scope(const char* const _Operation, const wchar_t* const _Path) noexcept : _Operation(_Operation) {
+            _STL_TRACE("FilesystemCall", _STL_TRACE_KEYWORD_FILESYSTEM, _STL_TRACE_START,
+                TraceLoggingString(_Operation, "Operation"), TraceLoggingWideString(_Path, "Path"));
+        }
+
+        _Fs_trace_scope(const _Fs_trace_scope&) = delete;
+        _Fs_trace_scope& operator=(const _Fs_trace_scope&) = delete;
+
+        ~_Fs_trace_scope() noexcept {
+            _STL_TRACE("FilesystemCall", _STL_TRACE_KEYWORD_FILESYSTEM, _STL_TRACE_STOP,
+                TraceLoggingString(_Operation, "Operation"));
+        }
+
+    private:
+        const char* _Operation;
+    };
+} // unnamed namespace
+
+#define _STL_TRACE_FILESYSTEM_CALL(_Operation, _Path) const _Fs_trace_scope _Fs_trace_scope_guard(_Operation, _Path)
+#else // ^^^ _STL_TRACELOGGING / !_STL_TRACELOGGING vvv
+#define _STL_TRACE(_Event_name, _Keyword, ...)
+#define _STL_TRACE_ENABLED(_Keyword)                  false
+#define _STL_TRACE_FILESYSTEM_CALL(_Operation, _Path) static_cast<void>(0)
+#endif // ^^^ !_STL_TRACELOGGING ^^^
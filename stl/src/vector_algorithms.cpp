@@ -47,9 +47,72 @@ static void _Advance_bytes(const void*& _Target, ptrdiff_t _Offset) noexcept {
     _Target = static_cast<const unsigned char*>(_Target) + _Offset;
 }
 
+// __ISA_AVAILABLE_AVX512 is only reported when AVX512F, AVX512CD, AVX512BW, AVX512DQ, and AVX512VL are all present.
+template <size_t _Element_size>
+static __m512i _Reverse_avx512(const __m512i _Val) noexcept {
+    // reverse the elements of a 64-byte block
+    if constexpr (_Element_size == 1 || _Element_size == 2) {
+        // reverse the order of the 128-bit lanes, then the elements within each lane
+        const __m128i _Reverse_lane = _Element_size == 1
+                                        ? _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+                                        : _mm_set_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        return _mm512_shuffle_epi8(_mm512_shuffle_i64x2(_Val, _Val, 27), _mm512_broadcast_i32x4(_Reverse_lane));
+    } else if constexpr (_Element_size == 4) {
+        return _mm512_permutexvar_epi32(_mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _Val);
+    } else {
+        static_assert(_Element_size == 8);
+        return _mm512_permutexvar_epi64(_mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7), _Val);
+    }
+}
+
+template <size_t _Element_size>
+static void _Reverse_avx512_blocks(void*& _First, void*& _Last) noexcept {
+    // swap reversed 64-byte blocks from both ends while at least 128 bytes remain
+    if (_Byte_length(_First, _Last) >= 128 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left  = _mm512_loadu_si512(_First);
+            const __m512i _Right = _mm512_loadu_si512(_Last);
+            _mm512_storeu_si512(_First, _Reverse_avx512<_Element_size>(_Right));
+            _mm512_storeu_si512(_Last, _Reverse_avx512<_Element_size>(_Left));
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+}
+
+template <size_t _Element_size>
+static void _Reverse_copy_avx512_blocks(const void* _First, const void*& _Last, void*& _Dest) noexcept {
+    // copy reversed 64-byte blocks from the end of the source while at least 64 bytes remain
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const void* _Stop_at = _Dest;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            _mm512_storeu_si512(_Dest, _Reverse_avx512<_Element_size>(_mm512_loadu_si512(_Last)));
+            _Advance_bytes(_Dest, 64);
+        } while (_Dest != _Stop_at);
+    }
+}
+
 extern "C" {
 __declspec(noalias) void __cdecl __std_swap_ranges_trivially_swappable_noalias(
     void* _First1, void* _Last1, void* _First2) noexcept {
+    constexpr size_t _Mask_64 = ~((static_cast<size_t>(1) << 6) - 1);
+    if (_Byte_length(_First1, _Last1) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const void* _Stop_at = _First1;
+        _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & _Mask_64);
+        do {
+            const __m512i _Left  = _mm512_loadu_si512(_First1);
+            const __m512i _Right = _mm512_loadu_si512(_First2);
+            _mm512_storeu_si512(_First1, _Right);
+            _mm512_storeu_si512(_First2, _Left);
+            _Advance_bytes(_First1, 64);
+            _Advance_bytes(_First2, 64);
+        } while (_First1 != _Stop_at);
+    }
+
     constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
     if (_Byte_length(_First1, _Last1) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First1;
@@ -131,6 +194,8 @@ void* __cdecl __std_swap_ranges_trivially_swappable(void* _First1, void* _Last1,
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _First, void* _Last) noexcept {
+    _Reverse_avx512_blocks<1>(_First, _Last);
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_char_lanes_avx = _mm256_set_epi8( //
             0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
@@ -171,6 +236,8 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _First, void* _Last) noexcept {
+    _Reverse_avx512_blocks<2>(_First, _Last);
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_short_lanes_avx = _mm256_set_epi8( //
             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
@@ -209,6 +276,8 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _First, void* _Last) noexcept {
+    _Reverse_avx512_blocks<4>(_First, _Last);
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -247,6 +316,8 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _First, void* _Last) noexcept {
+    _Reverse_avx512_blocks<8>(_First, _Last);
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -286,6 +357,8 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _Firs
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_1(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    _Reverse_copy_avx512_blocks<1>(_First, _Last, _Dest);
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_char_lanes_avx = _mm256_set_epi8( //
             0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
@@ -320,6 +393,8 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_1(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_2(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    _Reverse_copy_avx512_blocks<2>(_First, _Last, _Dest);
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_short_lanes_avx = _mm256_set_epi8( //
             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
@@ -354,6 +429,8 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_2(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_4(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    _Reverse_copy_avx512_blocks<4>(_First, _Last, _Dest);
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _Dest;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
@@ -388,6 +465,8 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_4(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_8(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    _Reverse_copy_avx512_blocks<8>(_First, _Last, _Dest);
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _Dest;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
@@ -420,7 +499,3512 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_8(
         static_cast<unsigned long long*>(_Dest));
 }
 
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    const void* _Find_trivial_tail(const void* _First, const void* _Last, _Ty _Val) noexcept {
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        while (_Ptr != _Last && *_Ptr != _Val) {
+            ++_Ptr;
+        }
+        return _Ptr;
+    }
+
+    template <class _Ty>
+    size_t _Count_trivial_tail(const void* _First, const void* _Last, size_t _Current, _Ty _Val) noexcept {
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        for (; _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Val) {
+                ++_Current;
+            }
+        }
+        return _Current;
+    }
+
+    struct _Find_traits_1 {
+        static __m256i _Set_avx(const unsigned char _Val) noexcept {
+            return _mm256_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned char _Val) noexcept {
+            return _mm_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2);
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // ^^^ !_M_IX86 ^^^
+        }
+    };
+
+    struct _Find_traits_2 {
+        static __m256i _Set_avx(const unsigned short _Val) noexcept {
+            return _mm256_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned short _Val) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Find_traits_1::_Sse_available();
+        }
+    };
+
+    struct _Find_traits_4 {
+        static __m256i _Set_avx(const unsigned long _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned long _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+            return _Find_traits_1::_Sse_available();
+        }
+    };
+
+    struct _Find_traits_8 {
+        static __m256i _Set_avx(const unsigned long long _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned long long _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi64(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static bool _Sse_available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42);
+        }
+    };
+
+    template <class _Traits, class _Ty>
+    const void* _Find_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Size_bytes &= ~_Mask_32;
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Size_bytes >= 16 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, _Offset);
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        return _Find_trivial_tail(_First, _Last, _Val);
+    }
+
+    template <class _Traits, class _Ty>
+    size_t _Count_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        size_t _Result     = 0;
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        // Each matching element sets sizeof(_Ty) bits of the movemask, so _Result counts bytes until the tail.
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                _Result += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo)); // POPCNT, implied by AVX2
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Size_bytes &= ~_Mask_32;
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Size_bytes >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                _Result += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo)); // POPCNT, implied by SSE4.2
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        return _Count_trivial_tail(_First, _Last, _Result / sizeof(_Ty), _Val);
+    }
+
+    template <class _Ty>
+    const void* _Search_n_tail(
+        const void* const _First, const void* const _Last, size_t _Run, const size_t _Count, const _Ty _Val) noexcept {
+        // _Run is the number of elements equal to _Val just before _First
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        for (; _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr != _Val) {
+                _Run = 0;
+            } else if (++_Run == _Count) {
+                return _Ptr - (_Count - 1);
+            }
+        }
+
+        return _Last;
+    }
+
+    unsigned long _Starts_of_runs(unsigned long _Mask, const size_t _Length) noexcept {
+        // return a mask with bit i set when bits [i, i + _Length) of _Mask are all set, shifting by the length covered
+        // so far, so that it takes a logarithmic number of steps
+        for (size_t _Covered = 1; _Covered < _Length && _Mask != 0;) {
+            const size_t _Shift = _Covered < _Length - _Covered ? _Covered : _Length - _Covered;
+            _Mask &= _Mask >> _Shift;
+            _Covered += _Shift;
+        }
+
+        return _Mask;
+    }
+
+    template <unsigned long _Width>
+    const void* _Search_n_block(
+        const void* const _Block, const int _Movemask, const size_t _Needed, size_t& _Run) noexcept {
+        // _Movemask has a bit set for each matching byte of the _Width bytes at _Block, and _Run is the number of
+        // matching bytes just before them; return the start of the first run of _Needed matching bytes that ends in
+        // this block, or update _Run and return nullptr if there is none
+        constexpr unsigned long _Full = _Width == 32 ? 0xFFFF'FFFFUL : (1UL << _Width) - 1;
+        const auto _Bingo             = static_cast<unsigned long>(_Movemask);
+        unsigned long _Leading        = _Width;
+        if (_Bingo != _Full) {
+            _BitScanForward(&_Leading, ~_Bingo);
+        }
+
+        if (_Run + _Leading >= _Needed) {
+            return static_cast<const unsigned char*>(_Block) - _Run;
+        }
+
+        if (_Bingo == _Full) {
+            _Run += _Width;
+            return nullptr;
+        }
+
+        if (_Needed <= _Width) {
+            const unsigned long _Starts = _Starts_of_runs(_Bingo, _Needed);
+            if (_Starts != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Starts);
+                return static_cast<const unsigned char*>(_Block) + _Offset;
+            }
+        }
+
+        unsigned long _Last_mismatch;
+        _BitScanReverse(&_Last_mismatch, ~_Bingo & _Full);
+        _Run = _Width - 1 - _Last_mismatch;
+        return nullptr;
+    }
+
+    template <class _Traits, class _Ty>
+    const void* _Search_n_trivial(
+        const void* _First, const void* const _Last, const size_t _Count, const _Ty _Val) noexcept {
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+        if (_Count > _Size_bytes / sizeof(_Ty)) {
+            return _Last;
+        }
+
+        // Each matching element sets sizeof(_Ty) bits of the movemask, so runs are measured in bytes until the tail.
+        const size_t _Needed = _Count * sizeof(_Ty);
+        size_t _Run          = 0;
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                if (const void* const _Found = _Search_n_block<32>(_First, _Bingo, _Needed, _Run)) {
+                    return _Found;
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Size_bytes &= ~_Mask_32;
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Size_bytes >= 16 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                if (const void* const _Found = _Search_n_block<16>(_First, _Bingo, _Needed, _Run)) {
+                    return _Found;
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        return _Search_n_tail(_First, _Last, _Run / sizeof(_Ty), _Count, _Val);
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_find_trivial_1(const void* _First, const void* _Last, unsigned char _Val) noexcept {
+    return _Find_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_2(const void* _First, const void* _Last, unsigned short _Val) noexcept {
+    return _Find_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_4(const void* _First, const void* _Last, unsigned long _Val) noexcept {
+    return _Find_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_8(const void* _First, const void* _Last, unsigned long long _Val) noexcept {
+    return _Find_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_1(
+    const void* _First, const void* _Last, unsigned char _Val) noexcept {
+    return _Count_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_2(
+    const void* _First, const void* _Last, unsigned short _Val) noexcept {
+    return _Count_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_4(
+    const void* _First, const void* _Last, unsigned long _Val) noexcept {
+    return _Count_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_8(
+    const void* _First, const void* _Last, unsigned long long _Val) noexcept {
+    return _Count_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_search_n_1(
+    const void* _First, const void* _Last, size_t _Count, unsigned char _Val) noexcept {
+    return _Search_n_trivial<_Find_traits_1>(_First, _Last, _Count, _Val);
+}
+
+const void* __cdecl __std_search_n_2(
+    const void* _First, const void* _Last, size_t _Count, unsigned short _Val) noexcept {
+    return _Search_n_trivial<_Find_traits_2>(_First, _Last, _Count, _Val);
+}
+
+const void* __cdecl __std_search_n_4(
+    const void* _First, const void* _Last, size_t _Count, unsigned long _Val) noexcept {
+    return _Search_n_trivial<_Find_traits_4>(_First, _Last, _Count, _Val);
+}
+
+const void* __cdecl __std_search_n_8(
+    const void* _First, const void* _Last, size_t _Count, unsigned long long _Val) noexcept {
+    return _Search_n_trivial<_Find_traits_8>(_First, _Last, _Count, _Val);
+}
+
+struct _Min_max_element_t {
+    const void* _Min;
+    const void* _Max;
+};
+} // extern "C"
+
+namespace {
+    enum _Min_max_mode {
+        _Mode_min  = 1 << 0,
+        _Mode_max  = 1 << 1,
+        _Mode_both = _Mode_min | _Mode_max,
+    };
+
+    // Each trait describes one vector width for one element size. _Cmp_gt returns a mask in an integer vector, which
+    // is also used to select between block indices; _Idx is an unsigned type with the same width as the elements,
+    // so a single portion can't run for more blocks than _Idx can count.
+    struct _Minmax_traits_1_sse {
+        using _Vec                       = __m128i;
+        using _Idx_vec                   = __m128i;
+        using _Idx                       = unsigned char;
+        static constexpr size_t _Lanes   = 16;
+        static constexpr size_t _Portion = 0x100;
+
+        static bool _Available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42);
+        }
+        static __m128i _Load(const void* _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+        static __m128i _Sign_flip(const __m128i _Val) noexcept {
+            return _mm_xor_si128(_Val, _mm_set1_epi8(static_cast<char>(0x80)));
+        }
+        static __m128i _Cmp_gt(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi8(_Lhs, _Rhs);
+        }
+        static __m128i _Blend(const __m128i _Px1, const __m128i _Px2, const __m128i _Msk) noexcept {
+            return _mm_blendv_epi8(_Px1, _Px2, _Msk); // SSE4.1
+        }
+        static __m128i _Blend_idx(const __m128i _Px1, const __m128i _Px2, const __m128i _Msk) noexcept {
+            return _mm_blendv_epi8(_Px1, _Px2, _Msk);
+        }
+        static __m128i _Set_idx(const size_t _Ix) noexcept {
+            return _mm_set1_epi8(static_cast<char>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_2_sse : _Minmax_traits_1_sse {
+        using _Idx                       = unsigned short;
+        static constexpr size_t _Lanes   = 8;
+        static constexpr size_t _Portion = 0x10000;
+
+        static __m128i _Sign_flip(const __m128i _Val) noexcept {
+            return _mm_xor_si128(_Val, _mm_set1_epi16(static_cast<short>(0x8000)));
+        }
+        static __m128i _Cmp_gt(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi16(_Lhs, _Rhs);
+        }
+        static __m128i _Set_idx(const size_t _Ix) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_4_sse : _Minmax_traits_1_sse {
+        using _Idx                       = unsigned long;
+        static constexpr size_t _Lanes   = 4;
+        static constexpr size_t _Portion = 0xFFFF'FFFF;
+
+        static __m128i _Sign_flip(const __m128i _Val) noexcept {
+            return _mm_xor_si128(_Val, _mm_set1_epi32(static_cast<int>(0x8000'0000UL)));
+        }
+        static __m128i _Cmp_gt(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi32(_Lhs, _Rhs);
+        }
+        static __m128i _Set_idx(const size_t _Ix) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_8_sse : _Minmax_traits_1_sse {
+        using _Idx                       = unsigned long long;
+        static constexpr size_t _Lanes   = 2;
+        static constexpr size_t _Portion = static_cast<size_t>(-1);
+
+        static __m128i _Sign_flip(const __m128i _Val) noexcept {
+            return _mm_xor_si128(_Val, _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL)));
+        }
+        static __m128i _Cmp_gt(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi64(_Lhs, _Rhs); // SSE4.2
+        }
+        static __m128i _Set_idx(const size_t _Ix) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_f_sse : _Minmax_traits_4_sse {
+        using _Vec = __m128;
+
+        static __m128 _Load(const void* _Src) noexcept {
+            return _mm_loadu_ps(static_cast<const float*>(_Src));
+        }
+        static __m128i _Cmp_gt(const __m128 _Lhs, const __m128 _Rhs) noexcept {
+            return _mm_castps_si128(_mm_cmpgt_ps(_Lhs, _Rhs));
+        }
+        static __m128 _Blend(const __m128 _Px1, const __m128 _Px2, const __m128i _Msk) noexcept {
+            return _mm_blendv_ps(_Px1, _Px2, _mm_castsi128_ps(_Msk)); // SSE4.1
+        }
+    };
+
+    struct _Minmax_traits_d_sse : _Minmax_traits_8_sse {
+        using _Vec = __m128d;
+
+        static __m128d _Load(const void* _Src) noexcept {
+            return _mm_loadu_pd(static_cast<const double*>(_Src));
+        }
+        static __m128i _Cmp_gt(const __m128d _Lhs, const __m128d _Rhs) noexcept {
+            return _mm_castpd_si128(_mm_cmpgt_pd(_Lhs, _Rhs));
+        }
+        static __m128d _Blend(const __m128d _Px1, const __m128d _Px2, const __m128i _Msk) noexcept {
+            return _mm_blendv_pd(_Px1, _Px2, _mm_castsi128_pd(_Msk)); // SSE4.1
+        }
+    };
+
+    struct _Minmax_traits_1_avx {
+        using _Vec                       = __m256i;
+        using _Idx_vec                   = __m256i;
+        using _Idx                       = unsigned char;
+        static constexpr size_t _Lanes   = 32;
+        static constexpr size_t _Portion = 0x100;
+
+        static bool _Available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2);
+        }
+        static __m256i _Load(const void* _Src) noexcept {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+        }
+        static __m256i _Sign_flip(const __m256i _Val) noexcept {
+            return _mm256_xor_si256(_Val, _mm256_set1_epi8(static_cast<char>(0x80)));
+        }
+        static __m256i _Cmp_gt(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi8(_Lhs, _Rhs);
+        }
+        static __m256i _Blend(const __m256i _Px1, const __m256i _Px2, const __m256i _Msk) noexcept {
+            return _mm256_blendv_epi8(_Px1, _Px2, _Msk);
+        }
+        static __m256i _Blend_idx(const __m256i _Px1, const __m256i _Px2, const __m256i _Msk) noexcept {
+            return _mm256_blendv_epi8(_Px1, _Px2, _Msk);
+        }
+        static __m256i _Set_idx(const size_t _Ix) noexcept {
+            return _mm256_set1_epi8(static_cast<char>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_2_avx : _Minmax_traits_1_avx {
+        using _Idx                       = unsigned short;
+        static constexpr size_t _Lanes   = 16;
+        static constexpr size_t _Portion = 0x10000;
+
+        static __m256i _Sign_flip(const __m256i _Val) noexcept {
+            return _mm256_xor_si256(_Val, _mm256_set1_epi16(static_cast<short>(0x8000)));
+        }
+        static __m256i _Cmp_gt(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi16(_Lhs, _Rhs);
+        }
+        static __m256i _Set_idx(const size_t _Ix) noexcept {
+            return _mm256_set1_epi16(static_cast<short>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_4_avx : _Minmax_traits_1_avx {
+        using _Idx                       = unsigned long;
+        static constexpr size_t _Lanes   = 8;
+        static constexpr size_t _Portion = 0xFFFF'FFFF;
+
+        static __m256i _Sign_flip(const __m256i _Val) noexcept {
+            return _mm256_xor_si256(_Val, _mm256_set1_epi32(static_cast<int>(0x8000'0000UL)));
+        }
+        static __m256i _Cmp_gt(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi32(_Lhs, _Rhs);
+        }
+        static __m256i _Set_idx(const size_t _Ix) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_8_avx : _Minmax_traits_1_avx {
+        using _Idx                       = unsigned long long;
+        static constexpr size_t _Lanes   = 4;
+        static constexpr size_t _Portion = static_cast<size_t>(-1);
+
+        static __m256i _Sign_flip(const __m256i _Val) noexcept {
+            return _mm256_xor_si256(_Val, _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL)));
+        }
+        static __m256i _Cmp_gt(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi64(_Lhs, _Rhs);
+        }
+        static __m256i _Set_idx(const size_t _Ix) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Ix));
+        }
+        static void _Store_idx(_Idx* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+    };
+
+    struct _Minmax_traits_f_avx : _Minmax_traits_4_avx {
+        using _Vec = __m256;
+
+        static __m256 _Load(const void* _Src) noexcept {
+            return _mm256_loadu_ps(static_cast<const float*>(_Src));
+        }
+        static __m256i _Cmp_gt(const __m256 _Lhs, const __m256 _Rhs) noexcept {
+            return _mm256_castps_si256(_mm256_cmp_ps(_Lhs, _Rhs, _CMP_GT_OQ));
+        }
+        static __m256 _Blend(const __m256 _Px1, const __m256 _Px2, const __m256i _Msk) noexcept {
+            return _mm256_blendv_ps(_Px1, _Px2, _mm256_castsi256_ps(_Msk));
+        }
+    };
+
+    struct _Minmax_traits_d_avx : _Minmax_traits_8_avx {
+        using _Vec = __m256d;
+
+        static __m256d _Load(const void* _Src) noexcept {
+            return _mm256_loadu_pd(static_cast<const double*>(_Src));
+        }
+        static __m256i _Cmp_gt(const __m256d _Lhs, const __m256d _Rhs) noexcept {
+            return _mm256_castpd_si256(_mm256_cmp_pd(_Lhs, _Rhs, _CMP_GT_OQ));
+        }
+        static __m256d _Blend(const __m256d _Px1, const __m256d _Px2, const __m256i _Msk) noexcept {
+            return _mm256_blendv_pd(_Px1, _Px2, _mm256_castsi256_pd(_Msk));
+        }
+    };
+
+    // Merge the candidate at _Ptr into the current result. min_element and max_element want the first of several
+    // equivalent extremes; minmax_element wants the first smallest but the last largest element.
+    template <class _Ty>
+    void _Update_min(const void*& _Min, const _Ty* const _Ptr) noexcept {
+        const auto _Cur = static_cast<const _Ty*>(_Min);
+        if (*_Ptr < *_Cur || (!(*_Cur < *_Ptr) && _Ptr < _Cur)) {
+            _Min = _Ptr;
+        }
+    }
+
+    template <bool _Last_max, class _Ty>
+    void _Update_max(const void*& _Max, const _Ty* const _Ptr) noexcept {
+        const auto _Cur = static_cast<const _Ty*>(_Max);
+        if (*_Cur < *_Ptr || (!(*_Ptr < *_Cur) && (_Last_max ? _Ptr > _Cur : _Ptr < _Cur))) {
+            _Max = _Ptr;
+        }
+    }
+
+    template <_Min_max_mode _Mode, class _Ty>
+    _Min_max_element_t _Minmax_element_tail(
+        _Min_max_element_t _Res, const _Ty* _Ptr, const void* const _Last) noexcept {
+        for (; _Ptr != _Last; ++_Ptr) {
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                _Update_min(_Res._Min, _Ptr);
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                _Update_max<_Mode == _Mode_both>(_Res._Max, _Ptr);
+            }
+        }
+
+        return _Res;
+    }
+
+    template <_Min_max_mode _Mode, class _Traits, class _Ty>
+    _Min_max_element_t _Minmax_element(const void* const _First, const void* const _Last) noexcept {
+        _Min_max_element_t _Res = {_First, _First};
+        auto _Ptr               = static_cast<const _Ty*>(_First);
+        size_t _Blocks          = static_cast<size_t>(static_cast<const _Ty*>(_Last) - _Ptr) / _Traits::_Lanes;
+
+        // Each lane tracks its own extreme and the index of the block where it was found; the lanes are merged into
+        // _Res at the end of each portion, by reading the elements back from memory.
+        while (_Blocks != 0) {
+            const size_t _Portion = _Blocks < _Traits::_Portion ? _Blocks : _Traits::_Portion;
+
+            auto _Cur = _Traits::_Load(_Ptr);
+            if constexpr (static_cast<_Ty>(-1) > _Ty{0}) {
+                _Cur = _Traits::_Sign_flip(_Cur);
+            }
+
+            auto _Cur_min     = _Cur;
+            auto _Cur_max     = _Cur;
+            auto _Cur_min_idx = _Traits::_Set_idx(0);
+            auto _Cur_max_idx = _Cur_min_idx;
+
+            for (size_t _Ix = 1; _Ix != _Portion; ++_Ix) {
+                _Cur = _Traits::_Load(_Ptr + _Ix * _Traits::_Lanes);
+                if constexpr (static_cast<_Ty>(-1) > _Ty{0}) {
+                    _Cur = _Traits::_Sign_flip(_Cur);
+                }
+
+                const auto _Idx_vec = _Traits::_Set_idx(_Ix);
+
+                if constexpr ((_Mode & _Mode_min) != 0) {
+                    const auto _Is_less = _Traits::_Cmp_gt(_Cur_min, _Cur);
+                    _Cur_min            = _Traits::_Blend(_Cur_min, _Cur, _Is_less);
+                    _Cur_min_idx        = _Traits::_Blend_idx(_Cur_min_idx, _Idx_vec, _Is_less);
+                }
+
+                if constexpr (_Mode == _Mode_max) {
+                    const auto _Is_greater = _Traits::_Cmp_gt(_Cur, _Cur_max);
+                    _Cur_max               = _Traits::_Blend(_Cur_max, _Cur, _Is_greater);
+                    _Cur_max_idx           = _Traits::_Blend_idx(_Cur_max_idx, _Idx_vec, _Is_greater);
+                } else if constexpr (_Mode == _Mode_both) {
+                    const auto _Is_less = _Traits::_Cmp_gt(_Cur_max, _Cur);
+                    _Cur_max            = _Traits::_Blend(_Cur, _Cur_max, _Is_less);
+                    _Cur_max_idx        = _Traits::_Blend_idx(_Idx_vec, _Cur_max_idx, _Is_less);
+                }
+            }
+
+            typename _Traits::_Idx _Lane_idx[_Traits::_Lanes];
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                _Traits::_Store_idx(_Lane_idx, _Cur_min_idx);
+                for (size_t _Lane = 0; _Lane != _Traits::_Lanes; ++_Lane) {
+                    _Update_min(_Res._Min, _Ptr + static_cast<size_t>(_Lane_idx[_Lane]) * _Traits::_Lanes + _Lane);
+                }
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                _Traits::_Store_idx(_Lane_idx, _Cur_max_idx);
+                for (size_t _Lane = 0; _Lane != _Traits::_Lanes; ++_Lane) {
+                    _Update_max<_Mode == _Mode_both>(
+                        _Res._Max, _Ptr + static_cast<size_t>(_Lane_idx[_Lane]) * _Traits::_Lanes + _Lane);
+                }
+            }
+
+            _Ptr += _Portion * _Traits::_Lanes;
+            _Blocks -= _Portion;
+        }
+
+        return _Minmax_element_tail<_Mode>(_Res, _Ptr, _Last);
+    }
+
+    template <_Min_max_mode _Mode, class _Sse_traits, class _Avx_traits, class _Ty>
+    _Min_max_element_t _Minmax_element_dispatch(const void* const _First, const void* const _Last) noexcept {
+        const size_t _Size_bytes = _Byte_length(_First, _Last);
+        if (_Size_bytes >= 2 * 32 && _Avx_traits::_Available()) {
+            return _Minmax_element<_Mode, _Avx_traits, _Ty>(_First, _Last);
+        }
+
+        if (_Size_bytes >= 2 * 16 && _Sse_traits::_Available()) {
+            return _Minmax_element<_Mode, _Sse_traits, _Ty>(_First, _Last);
+        }
+
+        return _Minmax_element_tail<_Mode>({_First, _First}, static_cast<const _Ty*>(_First), _Last);
+    }
+
+    template <_Min_max_mode _Mode, class _Ty>
+    _Min_max_element_t _Minmax_element_int(const void* const _First, const void* const _Last) noexcept {
+        if constexpr (sizeof(_Ty) == 1) {
+            return _Minmax_element_dispatch<_Mode, _Minmax_traits_1_sse, _Minmax_traits_1_avx, _Ty>(_First, _Last);
+        } else if constexpr (sizeof(_Ty) == 2) {
+            return _Minmax_element_dispatch<_Mode, _Minmax_traits_2_sse, _Minmax_traits_2_avx, _Ty>(_First, _Last);
+        } else if constexpr (sizeof(_Ty) == 4) {
+            return _Minmax_element_dispatch<_Mode, _Minmax_traits_4_sse, _Minmax_traits_4_avx, _Ty>(_First, _Last);
+        } else {
+            return _Minmax_element_dispatch<_Mode, _Minmax_traits_8_sse, _Minmax_traits_8_avx, _Ty>(_First, _Last);
+        }
+    }
+
+    template <_Min_max_mode _Mode, class _Signed_ty, class _Unsigned_ty>
+    _Min_max_element_t _Minmax_element_int(
+        const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+        if (_Signed) {
+            return _Minmax_element_int<_Mode, _Signed_ty>(_First, _Last);
+        } else {
+            return _Minmax_element_int<_Mode, _Unsigned_ty>(_First, _Last);
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_min_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_min, signed char, unsigned char>(_First, _Last, _Signed)._Min;
+}
+
+const void* __cdecl __std_min_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_min, short, unsigned short>(_First, _Last, _Signed)._Min;
+}
+
+const void* __cdecl __std_min_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_min, long, unsigned long>(_First, _Last, _Signed)._Min;
+}
+
+const void* __cdecl __std_min_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_min, long long, unsigned long long>(_First, _Last, _Signed)._Min;
+}
+
+const void* __cdecl __std_min_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_min, _Minmax_traits_f_sse, _Minmax_traits_f_avx, float>(_First, _Last)
+        ._Min;
+}
+
+const void* __cdecl __std_min_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_min, _Minmax_traits_d_sse, _Minmax_traits_d_avx, double>(_First, _Last)
+        ._Min;
+}
+
+const void* __cdecl __std_max_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_max, signed char, unsigned char>(_First, _Last, _Signed)._Max;
+}
+
+const void* __cdecl __std_max_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_max, short, unsigned short>(_First, _Last, _Signed)._Max;
+}
+
+const void* __cdecl __std_max_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_max, long, unsigned long>(_First, _Last, _Signed)._Max;
+}
+
+const void* __cdecl __std_max_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_max, long long, unsigned long long>(_First, _Last, _Signed)._Max;
+}
+
+const void* __cdecl __std_max_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_max, _Minmax_traits_f_sse, _Minmax_traits_f_avx, float>(_First, _Last)
+        ._Max;
+}
+
+const void* __cdecl __std_max_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_max, _Minmax_traits_d_sse, _Minmax_traits_d_avx, double>(_First, _Last)
+        ._Max;
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_both, signed char, unsigned char>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_both, short, unsigned short>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_both, long, unsigned long>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Minmax_element_int<_Mode_both, long long, unsigned long long>(_First, _Last, _Signed);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_both, _Minmax_traits_f_sse, _Minmax_traits_f_avx, float>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_dispatch<_Mode_both, _Minmax_traits_d_sse, _Minmax_traits_d_avx, double>(_First, _Last);
+}
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    size_t _Mismatch_impl(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+        // Equality is bitwise, so bytes are compared regardless of the element size;
+        // the first differing byte is then mapped back to the index of the element containing it.
+        const auto _First1_ch    = static_cast<const unsigned char*>(_First1);
+        const auto _First2_ch    = static_cast<const unsigned char*>(_First2);
+        const size_t _Size_bytes = _Count * sizeof(_Ty);
+        size_t _Offset_bytes     = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const size_t _Stop_at = _Size_bytes & ~size_t{0x1F};
+            do {
+                const __m256i _Elem1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First1_ch + _Offset_bytes));
+                const __m256i _Elem2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First2_ch + _Offset_bytes));
+                const auto _Bingo =
+                    ~static_cast<unsigned long>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Elem1, _Elem2)));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Offset_bytes + _Offset) / sizeof(_Ty);
+                }
+
+                _Offset_bytes += 32;
+            } while (_Offset_bytes != _Stop_at);
+        }
+
+        if (_Size_bytes - _Offset_bytes >= 16
+#ifdef _M_IX86
+            && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2)
+#endif // _M_IX86
+        ) {
+            const size_t _Stop_at = _Size_bytes & ~size_t{0xF};
+            do {
+                const __m128i _Elem1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First1_ch + _Offset_bytes));
+                const __m128i _Elem2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First2_ch + _Offset_bytes));
+                const auto _Bingo =
+                    static_cast<unsigned long>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Elem1, _Elem2))) ^ 0xFFFF;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Offset_bytes + _Offset) / sizeof(_Ty);
+                }
+
+                _Offset_bytes += 16;
+            } while (_Offset_bytes != _Stop_at);
+        }
+
+        // _Offset_bytes is a multiple of 16, and therefore of sizeof(_Ty)
+        const auto _Elems1 = static_cast<const _Ty*>(_First1);
+        const auto _Elems2 = static_cast<const _Ty*>(_First2);
+        size_t _Result     = _Offset_bytes / sizeof(_Ty);
+        while (_Result != _Count && _Elems1[_Result] == _Elems2[_Result]) {
+            ++_Result;
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) size_t __cdecl __std_mismatch_1(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned char>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_2(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned short>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_4(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned long>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_8(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned long long>(_First1, _First2, _Count);
+}
+} // extern "C"
+
+namespace {
+    // Compress-store tables for remove and unique. A vector is split into 8 "units" of 1, 2, or 4 bytes,
+    // and a bit mask selects the units to keep. _Shuf lists the indices of the kept units, packed to the front,
+    // and _Size counts them. 8-byte elements are handled as pairs of 4-byte units.
+    struct _Remove_table_t {
+        unsigned char _Shuf[256][8];
+        unsigned char _Size[256];
+    };
+
+    constexpr _Remove_table_t _Make_remove_table() noexcept {
+        _Remove_table_t _Result{};
+        for (unsigned int _Keep = 0; _Keep != 256; ++_Keep) {
+            unsigned char _Count = 0;
+            for (unsigned char _Unit = 0; _Unit != 8; ++_Unit) {
+                if ((_Keep & (1u << _Unit)) != 0) {
+                    _Result._Shuf[_Keep][_Count] = _Unit;
+                    ++_Count;
+                }
+            }
+
+            _Result._Size[_Keep] = _Count;
+        }
+
+        return _Result;
+    }
+
+    constexpr _Remove_table_t _Remove_table = _Make_remove_table();
+
+    __m128i _Remove_shuffle_units_1(const unsigned int _Keep) noexcept {
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Remove_table._Shuf[_Keep]));
+    }
+
+    __m128i _Remove_shuffle_units_2(const unsigned int _Keep) noexcept {
+        // expand each unit index k to the byte indices 2k, 2k + 1
+        __m128i _Shuf = _Remove_shuffle_units_1(_Keep);
+        _Shuf         = _mm_unpacklo_epi8(_Shuf, _Shuf);
+        _Shuf         = _mm_add_epi8(_Shuf, _Shuf);
+        return _mm_add_epi8(_Shuf, _mm_set1_epi16(0x0100));
+    }
+
+    __m128i _Remove_shuffle_units_4(const unsigned int _Keep) noexcept {
+        // expand each unit index k to the byte indices 4k, 4k + 1, 4k + 2, 4k + 3
+        __m128i _Shuf = _Remove_shuffle_units_1(_Keep);
+        _Shuf         = _mm_unpacklo_epi8(_Shuf, _Shuf);
+        _Shuf         = _mm_unpacklo_epi16(_Shuf, _Shuf);
+        _Shuf         = _mm_add_epi8(_Shuf, _Shuf);
+        _Shuf         = _mm_add_epi8(_Shuf, _Shuf);
+        return _mm_add_epi8(_Shuf, _mm_set1_epi32(0x03020100));
+    }
+
+    // The _Store_kept functions write a whole vector at _Dest, so they may clobber up to one vector's worth of
+    // bytes past the kept elements. This is safe in place, because _Dest never passes the data already loaded.
+    struct _Remove_traits_sse_1 {
+        using _Ty  = unsigned char;
+        using _Vec = __m128i;
+
+        static constexpr size_t _Step = 16;
+
+        static bool _Available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42); // pshufb is SSSE3
+        }
+
+        static __m128i _Load(const void* const _Src) noexcept {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        }
+
+        static __m128i _Set(const _Ty _Val) noexcept {
+            return _mm_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m128i _Shift_in(const __m128i _Data, const _Ty _Prev) noexcept {
+            // each element's predecessor, with _Prev preceding the first one
+            return _mm_alignr_epi8(_Data, _Set(_Prev), 15);
+        }
+
+        static unsigned int _Keep_mask(const __m128i _Data, const __m128i _Other) noexcept {
+            return ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data, _Other))) & 0xFFFF;
+        }
+
+        static void* _Store_kept(void* _Dest, const __m128i _Data, const unsigned int _Keep) noexcept {
+            // 16 units don't fit in the table, so compress each half separately
+            const unsigned int _Keep_lo = _Keep & 0xFF;
+            const unsigned int _Keep_hi = _Keep >> 8;
+            const __m128i _Shuf_lo      = _Remove_shuffle_units_1(_Keep_lo);
+            const __m128i _Shuf_hi      = _mm_add_epi8(_Remove_shuffle_units_1(_Keep_hi), _mm_set1_epi8(8));
+            _mm_storel_epi64(static_cast<__m128i*>(_Dest), _mm_shuffle_epi8(_Data, _Shuf_lo));
+            _Advance_bytes(_Dest, _Remove_table._Size[_Keep_lo]);
+            _mm_storel_epi64(static_cast<__m128i*>(_Dest), _mm_shuffle_epi8(_Data, _Shuf_hi));
+            _Advance_bytes(_Dest, _Remove_table._Size[_Keep_hi]);
+            return _Dest;
+        }
+    };
+
+    struct _Remove_traits_sse_2 : _Remove_traits_sse_1 {
+        using _Ty = unsigned short;
+
+        static __m128i _Set(const _Ty _Val) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m128i _Shift_in(const __m128i _Data, const _Ty _Prev) noexcept {
+            return _mm_alignr_epi8(_Data, _Set(_Prev), 14);
+        }
+
+        static unsigned int _Keep_mask(const __m128i _Data, const __m128i _Other) noexcept {
+            const __m128i _Eq = _mm_packs_epi16(_mm_cmpeq_epi16(_Data, _Other), _mm_setzero_si128());
+            return ~static_cast<unsigned int>(_mm_movemask_epi8(_Eq)) & 0xFF;
+        }
+
+        static void* _Store_kept(void* _Dest, const __m128i _Data, const unsigned int _Keep) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _mm_shuffle_epi8(_Data, _Remove_shuffle_units_2(_Keep)));
+            _Advance_bytes(_Dest, _Remove_table._Size[_Keep] * 2);
+            return _Dest;
+        }
+    };
+
+    struct _Remove_traits_sse_4 : _Remove_traits_sse_1 {
+        using _Ty = unsigned long;
+
+        static __m128i _Set(const _Ty _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Shift_in(const __m128i _Data, const _Ty _Prev) noexcept {
+            return _mm_alignr_epi8(_Data, _Set(_Prev), 12);
+        }
 
+        static unsigned int _Keep_mask(const __m128i _Data, const __m128i _Other) noexcept {
+            const __m128i _Eq = _mm_cmpeq_epi32(_Data, _Other);
+            return ~static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_Eq))) & 0xF;
+        }
+
+        static void* _Store_kept(void* _Dest, const __m128i _Data, const unsigned int _Keep) noexcept {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _mm_shuffle_epi8(_Data, _Remove_shuffle_units_4(_Keep)));
+            _Advance_bytes(_Dest, _Remove_table._Size[_Keep] * 4);
+            return _Dest;
+        }
+    };
+
+    struct _Remove_traits_sse_8 : _Remove_traits_sse_4 {
+        using _Ty = unsigned long long;
+
+        static __m128i _Set(const _Ty _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Shift_in(const __m128i _Data, const _Ty _Prev) noexcept {
+            return _mm_alignr_epi8(_Data, _Set(_Prev), 8);
+        }
+
+        static unsigned int _Keep_mask(const __m128i _Data, const __m128i _Other) noexcept {
+            // one bit per 4-byte unit, set in pairs
+            const __m128i _Eq = _mm_cmpeq_epi64(_Data, _Other); // SSE4.1
+            return ~static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_Eq))) & 0xF;
+        }
+    };
+
+    struct _Remove_traits_avx_4 {
+        using _Ty  = unsigned long;
+        using _Vec = __m256i;
+
+        static constexpr size_t _Step = 32;
+
+        static bool _Available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2);
+        }
+
+        static __m256i _Load(const void* const _Src) noexcept {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+        }
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Shift_in(const __m256i _Data, const _Ty _Prev) noexcept {
+            const __m256i _Rotated = _mm256_permutevar8x32_epi32(_Data, _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 7));
+            return _mm256_blend_epi32(_Rotated, _Set(_Prev), 0x01);
+        }
+
+        static unsigned int _Keep_mask(const __m256i _Data, const __m256i _Other) noexcept {
+            const __m256i _Eq = _mm256_cmpeq_epi32(_Data, _Other);
+            return ~static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Eq))) & 0xFF;
+        }
+
+        static void* _Store_kept(void* _Dest, const __m256i _Data, const unsigned int _Keep) noexcept {
+            const __m256i _Shuf = _mm256_cvtepu8_epi32(_Remove_shuffle_units_1(_Keep));
+            _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _mm256_permutevar8x32_epi32(_Data, _Shuf));
+            _Advance_bytes(_Dest, _Remove_table._Size[_Keep] * 4);
+            return _Dest;
+        }
+    };
+
+    struct _Remove_traits_avx_8 : _Remove_traits_avx_4 {
+        using _Ty = unsigned long long;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Shift_in(const __m256i _Data, const _Ty _Prev) noexcept {
+            const __m256i _Rotated = _mm256_permutevar8x32_epi32(_Data, _mm256_set_epi32(5, 4, 3, 2, 1, 0, 7, 6));
+            return _mm256_blend_epi32(_Rotated, _Set(_Prev), 0x03);
+        }
+
+        static unsigned int _Keep_mask(const __m256i _Data, const __m256i _Other) noexcept {
+            // one bit per 4-byte unit, set in pairs
+            const __m256i _Eq = _mm256_cmpeq_epi64(_Data, _Other);
+            return ~static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Eq))) & 0xFF;
+        }
+    };
+
+    template <class _Traits>
+    void _Remove_blocks(
+        const void*& _First, const void* const _Last, void*& _Dest, const typename _Traits::_Ty _Val) noexcept {
+        // compress whole vectors of [_First, _Last) not equal to _Val into [_Dest, ...)
+        const size_t _Size_bytes = _Byte_length(_First, _Last);
+        if (_Size_bytes >= _Traits::_Step && _Traits::_Available()) {
+            const auto _Comparand = _Traits::_Set(_Val);
+            const void* _Stop_at  = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~(_Traits::_Step - 1));
+            do {
+                const auto _Data = _Traits::_Load(_First);
+                _Dest            = _Traits::_Store_kept(_Dest, _Data, _Traits::_Keep_mask(_Data, _Comparand));
+                _Advance_bytes(_First, _Traits::_Step);
+            } while (_First != _Stop_at);
+        }
+    }
+
+    template <class _Traits>
+    void _Unique_blocks(
+        const void*& _First, const void* const _Last, void*& _Dest, typename _Traits::_Ty& _Prev) noexcept {
+        // compress whole vectors of [_First, _Last) not equal to their predecessors into [_Dest, ...);
+        // _Prev is the element before _First
+        using _Ty                = typename _Traits::_Ty;
+        const size_t _Size_bytes = _Byte_length(_First, _Last);
+        if (_Size_bytes >= _Traits::_Step && _Traits::_Available()) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~(_Traits::_Step - 1));
+            do {
+                const auto _Data          = _Traits::_Load(_First);
+                const unsigned int _Keep = _Traits::_Keep_mask(_Data, _Traits::_Shift_in(_Data, _Prev));
+                // read the last element before the store can overwrite it
+                _Prev = static_cast<const _Ty*>(_First)[_Traits::_Step / sizeof(_Ty) - 1];
+                _Dest = _Traits::_Store_kept(_Dest, _Data, _Keep);
+                _Advance_bytes(_First, _Traits::_Step);
+            } while (_First != _Stop_at);
+        }
+    }
+
+    void* _Copy_bytes(void* _Dest, const void* _Src, size_t _Size_bytes) noexcept {
+        // only used after the SSE kernels, so SSE2 is known to be available
+        for (; _Size_bytes >= 16; _Size_bytes -= 16) {
+            _mm_storeu_si128(static_cast<__m128i*>(_Dest), _mm_loadu_si128(static_cast<const __m128i*>(_Src)));
+            _Advance_bytes(_Dest, 16);
+            _Advance_bytes(_Src, 16);
+        }
+
+        auto _Dest_ch = static_cast<unsigned char*>(_Dest);
+        auto _Src_ch  = static_cast<const unsigned char*>(_Src);
+        for (; _Size_bytes != 0; --_Size_bytes) {
+            *_Dest_ch++ = *_Src_ch++;
+        }
+
+        return _Dest_ch;
+    }
+
+    template <class _Traits>
+    void _Remove_copy_blocks(
+        const void*& _First, const void* const _Last, void*& _Dest, const typename _Traits::_Ty _Val) noexcept {
+        // The destination may end right after the last kept element, so whole vectors can't be stored there.
+        // Instead, compress chunks into a local buffer and copy the kept bytes out.
+        constexpr size_t _Chunk_size = 512;
+        if (!_Traits::_Available()) {
+            return;
+        }
+
+        alignas(32) unsigned char _Buffer[_Chunk_size];
+        while (_Byte_length(_First, _Last) >= _Traits::_Step) {
+            const size_t _Remaining = _Byte_length(_First, _Last);
+            const void* _Chunk_last = _First;
+            _Advance_bytes(_Chunk_last, _Remaining < _Chunk_size ? _Remaining : _Chunk_size);
+            void* _Buffer_dest = _Buffer;
+            _Remove_blocks<_Traits>(_First, _Chunk_last, _Buffer_dest, _Val);
+            _Dest = _Copy_bytes(_Dest, _Buffer, _Byte_length(_Buffer, _Buffer_dest));
+        }
+    }
+
+    template <class _Ty>
+    void* _Remove_tail(const void* const _First, const void* const _Last, void* const _Dest, const _Ty _Val) noexcept {
+        auto _Dest_ptr = static_cast<_Ty*>(_Dest);
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr != _Val) {
+                *_Dest_ptr = *_Ptr;
+                ++_Dest_ptr;
+            }
+        }
+
+        return _Dest_ptr;
+    }
+
+    template <class _Ty>
+    void* _Unique_tail(const void* const _First, const void* const _Last, void* const _Dest, _Ty _Prev) noexcept {
+        auto _Dest_ptr = static_cast<_Ty*>(_Dest);
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            const _Ty _Val = *_Ptr;
+            if (_Val != _Prev) {
+                *_Dest_ptr = _Val;
+                ++_Dest_ptr;
+                _Prev = _Val;
+            }
+        }
+
+        return _Dest_ptr;
+    }
+
+    // The _Traits are tried from the widest to the narrowest vector, then the tail is handled one element at a time.
+    template <class _Ty, class... _Traits>
+    void* _Remove_impl(void* const _First, void* const _Last, const _Ty _Val) noexcept {
+        const void* _Src = _First;
+        void* _Dest      = _First;
+        (_Remove_blocks<_Traits>(_Src, _Last, _Dest, _Val), ...);
+        return _Remove_tail(_Src, _Last, _Dest, _Val);
+    }
+
+    template <class _Ty, class... _Traits>
+    void* _Remove_copy_impl(const void* _First, const void* const _Last, void* _Dest, const _Ty _Val) noexcept {
+        (_Remove_copy_blocks<_Traits>(_First, _Last, _Dest, _Val), ...);
+        return _Remove_tail(_First, _Last, _Dest, _Val);
+    }
+
+    template <class _Ty, class... _Traits>
+    void* _Unique_impl(void* const _First, void* const _Last) noexcept {
+        if (_First == _Last) {
+            return _Last;
+        }
+
+        _Ty _Prev        = *static_cast<const _Ty*>(_First);
+        const void* _Src = static_cast<const _Ty*>(_First) + 1;
+        void* _Dest      = static_cast<_Ty*>(_First) + 1;
+        (_Unique_blocks<_Traits>(_Src, _Last, _Dest, _Prev), ...);
+        return _Unique_tail(_Src, _Last, _Dest, _Prev);
+    }
+} // unnamed namespace
+
+extern "C" {
+void* __cdecl __std_remove_1(void* const _First, void* const _Last, const unsigned char _Val) noexcept {
+    return _Remove_impl<unsigned char, _Remove_traits_sse_1>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_remove_2(void* const _First, void* const _Last, const unsigned short _Val) noexcept {
+    return _Remove_impl<unsigned short, _Remove_traits_sse_2>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_remove_4(void* const _First, void* const _Last, const unsigned long _Val) noexcept {
+    return _Remove_impl<unsigned long, _Remove_traits_avx_4, _Remove_traits_sse_4>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_remove_8(void* const _First, void* const _Last, const unsigned long long _Val) noexcept {
+    return _Remove_impl<unsigned long long, _Remove_traits_avx_8, _Remove_traits_sse_8>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_remove_copy_1(
+    const void* const _First, const void* const _Last, void* const _Dest, const unsigned char _Val) noexcept {
+    return _Remove_copy_impl<unsigned char, _Remove_traits_sse_1>(_First, _Last, _Dest, _Val);
+}
+
+void* __cdecl __std_remove_copy_2(
+    const void* const _First, const void* const _Last, void* const _Dest, const unsigned short _Val) noexcept {
+    return _Remove_copy_impl<unsigned short, _Remove_traits_sse_2>(_First, _Last, _Dest, _Val);
+}
+
+void* __cdecl __std_remove_copy_4(
+    const void* const _First, const void* const _Last, void* const _Dest, const unsigned long _Val) noexcept {
+    return _Remove_copy_impl<unsigned long, _Remove_traits_avx_4, _Remove_traits_sse_4>(_First, _Last, _Dest, _Val);
+}
+
+void* __cdecl __std_remove_copy_8(
+    const void* const _First, const void* const _Last, void* const _Dest, const unsigned long long _Val) noexcept {
+    return _Remove_copy_impl<unsigned long long, _Remove_traits_avx_8, _Remove_traits_sse_8>(
+        _First, _Last, _Dest, _Val);
+}
+
+void* __cdecl __std_unique_1(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<unsigned char, _Remove_traits_sse_1>(_First, _Last);
+}
+
+void* __cdecl __std_unique_2(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<unsigned short, _Remove_traits_sse_2>(_First, _Last);
+}
+
+void* __cdecl __std_unique_4(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<unsigned long, _Remove_traits_avx_4, _Remove_traits_sse_4>(_First, _Last);
+}
+
+void* __cdecl __std_unique_8(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<unsigned long long, _Remove_traits_avx_8, _Remove_traits_sse_8>(_First, _Last);
+}
+} // extern "C"
+
+namespace {
+    template <class _Traits, class _Ty>
+    void _Fill_impl(void* _First, const size_t _Count, const _Ty _Val) noexcept {
+        // Unaligned stores are made at multiples of the vector size from _First, and the last one ends at _Last,
+        // so each store puts every element's bytes in their own place, and overlapping stores write equal values.
+        const size_t _Size_bytes = _Count * sizeof(_Ty);
+        void* _Last              = _First;
+        _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Size_bytes));
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Data = _Traits::_Set_avx(_Val);
+            do {
+                _mm256_storeu_si256(static_cast<__m256i*>(_First), _Data);
+                _Advance_bytes(_First, 32);
+            } while (_Byte_length(_First, _Last) >= 32);
+
+            if (_First != _Last) {
+                _Advance_bytes(_Last, -32);
+                _mm256_storeu_si256(static_cast<__m256i*>(_Last), _Data);
+            }
+
+            return;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            const __m128i _Data = _Traits::_Set_sse(_Val);
+            do {
+                _mm_storeu_si128(static_cast<__m128i*>(_First), _Data);
+                _Advance_bytes(_First, 16);
+            } while (_Byte_length(_First, _Last) >= 16);
+
+            if (_First != _Last) {
+                _Advance_bytes(_Last, -16);
+                _mm_storeu_si128(static_cast<__m128i*>(_Last), _Data);
+            }
+
+            return;
+        }
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            *_Ptr = _Val;
+        }
+    }
+
+    template <class _Ty>
+    void _Replace_tail(void* const _First, void* const _Last, const _Ty _Old_val, const _Ty _New_val) noexcept {
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Old_val) {
+                *_Ptr = _New_val;
+            }
+        }
+    }
+
+    // Elements that don't match must not be stored to, even with their own values, as other threads may access them.
+    // So AVX2 replaces 4- and 8-byte elements with masked stores, and otherwise a vector only locates the matches.
+    struct _Replace_traits_avx_4 {
+        static void _Store(void* const _Dest, const __m256i _Mask, const __m256i _Replacement) noexcept {
+            _mm256_maskstore_epi32(static_cast<int*>(_Dest), _Mask, _Replacement);
+        }
+    };
+
+    struct _Replace_traits_avx_8 {
+        static void _Store(void* const _Dest, const __m256i _Mask, const __m256i _Replacement) noexcept {
+            _mm256_maskstore_epi64(static_cast<long long*>(_Dest), _Mask, _Replacement);
+        }
+    };
+
+    template <class _Find_traits, class _Store_traits, class _Ty>
+    void _Replace_impl(void* _First, void* const _Last, const _Ty _Old_val, const _Ty _New_val) noexcept {
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand   = _Find_traits::_Set_avx(_Old_val);
+            const __m256i _Replacement = _Find_traits::_Set_avx(_New_val);
+            const void* _Stop_at       = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const __m256i _Mask = _Find_traits::_Cmp_avx(_Data, _Comparand);
+                if constexpr (sizeof(_Ty) >= 4) {
+                    _Store_traits::_Store(_First, _Mask, _Replacement);
+                } else if (!_mm256_testz_si256(_Mask, _Mask)) {
+                    void* _Block_last = _First;
+                    _Advance_bytes(_Block_last, 32);
+                    _Replace_tail(_First, _Block_last, _Old_val, _New_val);
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits::_Sse_available()) {
+            const __m128i _Comparand = _Find_traits::_Set_sse(_Old_val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                if (_mm_movemask_epi8(_Find_traits::_Cmp_sse(_Data, _Comparand)) != 0) {
+                    void* _Block_last = _First;
+                    _Advance_bytes(_Block_last, 16);
+                    _Replace_tail(_First, _Block_last, _Old_val, _New_val);
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        _Replace_tail(_First, _Last, _Old_val, _New_val);
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_fill_2(
+    void* const _First, const size_t _Count, const unsigned short _Val) noexcept {
+    _Fill_impl<_Find_traits_2>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_fill_4(
+    void* const _First, const size_t _Count, const unsigned long _Val) noexcept {
+    _Fill_impl<_Find_traits_4>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_fill_8(
+    void* const _First, const size_t _Count, const unsigned long long _Val) noexcept {
+    _Fill_impl<_Find_traits_8>(_First, _Count, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_1(
+    void* const _First, void* const _Last, const unsigned char _Old_val, const unsigned char _New_val) noexcept {
+    _Replace_impl<_Find_traits_1, void>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_2(
+    void* const _First, void* const _Last, const unsigned short _Old_val, const unsigned short _New_val) noexcept {
+    _Replace_impl<_Find_traits_2, void>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_4(
+    void* const _First, void* const _Last, const unsigned long _Old_val, const unsigned long _New_val) noexcept {
+    _Replace_impl<_Find_traits_4, _Replace_traits_avx_4>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_8(void* const _First, void* const _Last,
+    const unsigned long long _Old_val, const unsigned long long _New_val) noexcept {
+    _Replace_impl<_Find_traits_8, _Replace_traits_avx_8>(_First, _Last, _Old_val, _New_val);
+}
+} // extern "C"
+
+namespace {
+    // Looks up 1-byte characters in a bitmap of the needle. The bitmap is split into a table for 0x00-0x7F and
+    // one for 0x80-0xFF; each is indexed by the low nibble with pshufb and has a bit for each high nibble (mod 8).
+    class _Find_of_bitmap_1 {
+    public:
+        using _Ty = unsigned char;
+
+        _Find_of_bitmap_1(const void* const _Needle, const size_t _Needle_length) noexcept {
+            alignas(16) unsigned char _Low_table[16]  = {};
+            alignas(16) unsigned char _High_table[16] = {};
+
+            const auto _Needle_chars = static_cast<const unsigned char*>(_Needle);
+            for (size_t _Ix = 0; _Ix != _Needle_length; ++_Ix) {
+                const unsigned char _Ch = _Needle_chars[_Ix];
+                const auto _Bit         = static_cast<unsigned char>(1U << ((_Ch >> 4) & 7));
+                _Scalar[_Ch]            = true;
+                if (_Ch < 0x80) {
+                    _Low_table[_Ch & 0xF] |= _Bit;
+                } else {
+                    _High_table[_Ch & 0xF] |= _Bit;
+                }
+            }
+
+            _Low  = _mm_load_si128(reinterpret_cast<const __m128i*>(_Low_table));
+            _High = _mm_load_si128(reinterpret_cast<const __m128i*>(_High_table));
+        }
+
+        static bool _Sse_available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42); // for pshufb
+        }
+
+        __m256i _Match_avx(const __m256i _Data) const noexcept {
+            // pshufb gives zero for indices with the top bit set, so each table only answers for its own half
+            const __m256i _Low_avx  = _mm256_broadcastsi128_si256(_Low);
+            const __m256i _High_avx = _mm256_broadcastsi128_si256(_High);
+            const __m256i _Bits     = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, //
+                1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            const __m256i _Row      = _mm256_or_si256(_mm256_shuffle_epi8(_Low_avx, _Data),
+                _mm256_shuffle_epi8(_High_avx, _mm256_xor_si256(_Data, _mm256_set1_epi8(-128))));
+            const __m256i _Column =
+                _mm256_shuffle_epi8(_Bits, _mm256_and_si256(_mm256_srli_epi16(_Data, 4), _mm256_set1_epi8(0xF)));
+            return _mm256_cmpeq_epi8(_mm256_and_si256(_Row, _Column), _Column);
+        }
+
+        __m128i _Match_sse(const __m128i _Data) const noexcept {
+            const __m128i _Bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            const __m128i _Row  = _mm_or_si128(
+                _mm_shuffle_epi8(_Low, _Data), _mm_shuffle_epi8(_High, _mm_xor_si128(_Data, _mm_set1_epi8(-128))));
+            const __m128i _Column =
+                _mm_shuffle_epi8(_Bits, _mm_and_si128(_mm_srli_epi16(_Data, 4), _mm_set1_epi8(0xF)));
+            return _mm_cmpeq_epi8(_mm_and_si128(_Row, _Column), _Column);
+        }
+
+        bool _Match_scalar(const unsigned char _Ch) const noexcept {
+            return _Scalar[_Ch];
+        }
+
+    private:
+        __m128i _Low;
+        __m128i _High;
+        bool _Scalar[256] = {};
+    };
+
+    // Compares wider characters with each needle character in turn, so the cost is linear in the needle length.
+    template <class _Find_traits, class _Elem>
+    class _Find_of_needle {
+    public:
+        using _Ty = _Elem;
+
+        _Find_of_needle(const void* const _Needle, const size_t _Needle_length) noexcept
+            : _First(static_cast<const _Ty*>(_Needle)), _Last(_First + _Needle_length) {}
+
+        static bool _Sse_available() noexcept {
+            return _Find_traits_1::_Sse_available();
+        }
+
+        __m256i _Match_avx(const __m256i _Data) const noexcept {
+            __m256i _Result = _mm256_setzero_si256();
+            for (auto _Ptr = _First; _Ptr != _Last; ++_Ptr) {
+                _Result = _mm256_or_si256(_Result, _Find_traits::_Cmp_avx(_Data, _Find_traits::_Set_avx(*_Ptr)));
+            }
+
+            return _Result;
+        }
+
+        __m128i _Match_sse(const __m128i _Data) const noexcept {
+            __m128i _Result = _mm_setzero_si128();
+            for (auto _Ptr = _First; _Ptr != _Last; ++_Ptr) {
+                _Result = _mm_or_si128(_Result, _Find_traits::_Cmp_sse(_Data, _Find_traits::_Set_sse(*_Ptr)));
+            }
+
+            return _Result;
+        }
+
+        bool _Match_scalar(const _Ty _Ch) const noexcept {
+            for (auto _Ptr = _First; _Ptr != _Last; ++_Ptr) {
+                if (*_Ptr == _Ch) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        const _Ty* _First;
+        const _Ty* _Last;
+    };
+
+    template <bool _Negate, class _Matcher>
+    size_t _Find_first_of_pos(
+        const void* const _Haystack, const size_t _Haystack_length, const _Matcher& _Match) noexcept {
+        // find the position of the first character that is in the needle (not in the needle, when _Negate)
+        using _Ty          = typename _Matcher::_Ty;
+        const void* _First = _Haystack;
+        size_t _Size_bytes = _Haystack_length * sizeof(_Ty);
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                unsigned long _Bingo = static_cast<unsigned long>(_mm256_movemask_epi8(_Match._Match_avx(_Data)));
+                if constexpr (_Negate) {
+                    _Bingo = ~_Bingo;
+                }
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Byte_length(_Haystack, _First) + _Offset) / sizeof(_Ty);
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Matcher::_Sse_available()) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                unsigned long _Bingo = static_cast<unsigned long>(_mm_movemask_epi8(_Match._Match_sse(_Data)));
+                if constexpr (_Negate) {
+                    _Bingo ^= 0xFFFF;
+                }
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Byte_length(_Haystack, _First) + _Offset) / sizeof(_Ty);
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        const auto _Last = static_cast<const _Ty*>(_Haystack) + _Haystack_length;
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (_Match._Match_scalar(*_Ptr) != _Negate) {
+                return static_cast<size_t>(_Ptr - static_cast<const _Ty*>(_Haystack));
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+
+    template <bool _Negate, class _Matcher>
+    size_t _Find_last_of_pos(
+        const void* const _Haystack, const size_t _Haystack_length, const _Matcher& _Match) noexcept {
+        // find the position of the last character that is in the needle (not in the needle, when _Negate)
+        using _Ty          = typename _Matcher::_Ty;
+        const void* _Last  = static_cast<const _Ty*>(_Haystack) + _Haystack_length;
+        size_t _Size_bytes = _Haystack_length * sizeof(_Ty);
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _Last;
+            _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Size_bytes & ~size_t{0x1F}));
+            do {
+                _Advance_bytes(_Last, -32);
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_Last));
+                unsigned long _Bingo = static_cast<unsigned long>(_mm256_movemask_epi8(_Match._Match_avx(_Data)));
+                if constexpr (_Negate) {
+                    _Bingo = ~_Bingo;
+                }
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, _Bingo);
+                    return (_Byte_length(_Haystack, _Last) + _Offset) / sizeof(_Ty);
+                }
+            } while (_Last != _Stop_at);
+
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Matcher::_Sse_available()) {
+            const void* _Stop_at = _Last;
+            _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Size_bytes & ~size_t{0xF}));
+            do {
+                _Advance_bytes(_Last, -16);
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Last));
+                unsigned long _Bingo = static_cast<unsigned long>(_mm_movemask_epi8(_Match._Match_sse(_Data)));
+                if constexpr (_Negate) {
+                    _Bingo ^= 0xFFFF;
+                }
+
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, _Bingo);
+                    return (_Byte_length(_Haystack, _Last) + _Offset) / sizeof(_Ty);
+                }
+            } while (_Last != _Stop_at);
+        }
+
+        const auto _First = static_cast<const _Ty*>(_Haystack);
+        for (auto _Ptr = static_cast<const _Ty*>(_Last); _Ptr != _First;) {
+            --_Ptr;
+            if (_Match._Match_scalar(*_Ptr) != _Negate) {
+                return static_cast<size_t>(_Ptr - _First);
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) size_t __cdecl __std_find_first_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<false>(_Haystack, _Haystack_length, _Find_of_bitmap_1{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_first_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<false>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_2, unsigned short>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_first_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<false>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_4, unsigned long>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<false>(_Haystack, _Haystack_length, _Find_of_bitmap_1{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<false>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_2, unsigned short>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<false>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_4, unsigned long>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_first_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<true>(_Haystack, _Haystack_length, _Find_of_bitmap_1{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_first_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<true>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_2, unsigned short>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_first_not_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_first_of_pos<true>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_4, unsigned long>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_not_of_trivial_pos_1(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<true>(_Haystack, _Haystack_length, _Find_of_bitmap_1{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_not_of_trivial_pos_2(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<true>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_2, unsigned short>{_Needle, _Needle_length});
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_not_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_last_of_pos<true>(
+        _Haystack, _Haystack_length, _Find_of_needle<_Find_traits_4, unsigned long>{_Needle, _Needle_length});
+}
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    size_t _Search_prefix_length(const _Ty* const _First1, const _Ty* const _First2, const size_t _Count) noexcept {
+        // return the length of the common prefix of [_First1, _First1 + _Count) and [_First2, _First2 + _Count)
+        size_t _Ix = 0;
+        while (_Ix != _Count && _First1[_Ix] == _First2[_Ix]) {
+            ++_Ix;
+        }
+
+        return _Ix;
+    }
+
+    template <bool _Reversed, class _Ty>
+    ptrdiff_t _Two_way_maximal_suffix(
+        const _Ty* const _Needle, const ptrdiff_t _Needle_length, ptrdiff_t& _Period) noexcept {
+        // return the position before the maximal suffix of the needle for the (reversed, when _Reversed) element order
+        ptrdiff_t _Suffix = -1;
+        ptrdiff_t _Ix     = 0;
+        ptrdiff_t _Offset = 1;
+        _Period           = 1;
+        while (_Ix + _Offset < _Needle_length) {
+            const _Ty _Left  = _Needle[_Ix + _Offset];
+            const _Ty _Right = _Needle[_Suffix + _Offset];
+            if (_Reversed ? _Right < _Left : _Left < _Right) {
+                _Ix += _Offset;
+                _Offset = 1;
+                _Period = _Ix - _Suffix;
+            } else if (_Left == _Right) {
+                if (_Offset == _Period) {
+                    _Ix += _Period;
+                    _Offset = 1;
+                } else {
+                    ++_Offset;
+                }
+            } else {
+                _Suffix = _Ix;
+                _Ix     = _Suffix + 1;
+                _Offset = 1;
+                _Period = 1;
+            }
+        }
+
+        return _Suffix;
+    }
+
+    template <class _Ty>
+    size_t _Search_two_way(const _Ty* const _Haystack, const size_t _Haystack_length, const _Ty* const _Needle,
+        const size_t _Needle_length) noexcept {
+        // Crochemore-Perrin Two-Way search, linear in the haystack length even for repetitive inputs;
+        // requires 0 < _Needle_length <= _Haystack_length
+        const auto _Length = static_cast<ptrdiff_t>(_Needle_length);
+        const auto _Last   = static_cast<ptrdiff_t>(_Haystack_length - _Needle_length);
+
+        ptrdiff_t _Period;
+        ptrdiff_t _Period_reversed;
+        const ptrdiff_t _Suffix          = _Two_way_maximal_suffix<false>(_Needle, _Length, _Period);
+        const ptrdiff_t _Suffix_reversed = _Two_way_maximal_suffix<true>(_Needle, _Length, _Period_reversed);
+
+        // the critical factorization splits the needle into [0, _Split] and (_Split, _Length)
+        ptrdiff_t _Split = _Suffix;
+        if (_Suffix_reversed > _Suffix) {
+            _Split  = _Suffix_reversed;
+            _Period = _Period_reversed;
+        }
+
+        if (_Split + 1 <= _Length - _Period
+            && _Search_prefix_length(_Needle, _Needle + _Period, static_cast<size_t>(_Split + 1))
+                   == static_cast<size_t>(_Split + 1)) {
+            // the needle is periodic, so remember how much of the previous match is known to match again
+            ptrdiff_t _Memory = -1;
+            for (ptrdiff_t _Pos = 0; _Pos <= _Last;) {
+                ptrdiff_t _Ix = (_Split > _Memory ? _Split : _Memory) + 1;
+                while (_Ix < _Length && _Needle[_Ix] == _Haystack[_Pos + _Ix]) {
+                    ++_Ix;
+                }
+
+                if (_Ix < _Length) {
+                    _Pos += _Ix - _Split;
+                    _Memory = -1;
+                    continue;
+                }
+
+                _Ix = _Split;
+                while (_Ix > _Memory && _Needle[_Ix] == _Haystack[_Pos + _Ix]) {
+                    --_Ix;
+                }
+
+                if (_Ix <= _Memory) {
+                    return static_cast<size_t>(_Pos);
+                }
+
+                _Pos += _Period;
+                _Memory = _Length - _Period - 1;
+            }
+        } else {
+            const ptrdiff_t _Left_part  = _Split + 1;
+            const ptrdiff_t _Right_part = _Length - _Split - 1;
+            const ptrdiff_t _Shift      = (_Left_part > _Right_part ? _Left_part : _Right_part) + 1;
+            for (ptrdiff_t _Pos = 0; _Pos <= _Last;) {
+                ptrdiff_t _Ix = _Split + 1;
+                while (_Ix < _Length && _Needle[_Ix] == _Haystack[_Pos + _Ix]) {
+                    ++_Ix;
+                }
+
+                if (_Ix < _Length) {
+                    _Pos += _Ix - _Split;
+                    continue;
+                }
+
+                _Ix = _Split;
+                while (_Ix >= 0 && _Needle[_Ix] == _Haystack[_Pos + _Ix]) {
+                    --_Ix;
+                }
+
+                if (_Ix < 0) {
+                    return static_cast<size_t>(_Pos);
+                }
+
+                _Pos += _Shift;
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+
+    template <class _Ty>
+    constexpr unsigned long _Search_element_bits = sizeof(_Ty) == 1 ? 0xFFFF'FFFFUL
+                                                 : sizeof(_Ty) == 2 ? 0x5555'5555UL
+                                                 : sizeof(_Ty) == 4 ? 0x1111'1111UL
+                                                                    : 0x0101'0101UL;
+
+    template <class _Traits, class _Ty>
+    size_t _Search_impl(const void* const _Haystack, const size_t _Haystack_length, const void* const _Needle,
+        const size_t _Needle_length) noexcept {
+        // Candidates are positions where both the first and the last element of the needle match, found by comparing
+        // two overlapping loads of the haystack at once. Verifying candidates degrades on repetitive inputs, so once
+        // that takes more comparisons than positions scanned, the rest is left to the Two-Way algorithm.
+        if (_Needle_length == 0) {
+            return 0;
+        }
+
+        if (_Needle_length > _Haystack_length) {
+            return static_cast<size_t>(-1);
+        }
+
+        const auto _Hay        = static_cast<const _Ty*>(_Haystack);
+        const auto _Ndl        = static_cast<const _Ty*>(_Needle);
+        const size_t _Tail     = _Needle_length - 1;
+        const size_t _Possible = _Haystack_length - _Tail; // number of positions where the needle could start
+        size_t _Work           = 0;
+        size_t _Pos            = 0;
+
+        const auto _Verify = [&](const size_t _Candidate, size_t& _Result) noexcept {
+            // returns whether the search is over, either by a match or by switching to Two-Way
+            const size_t _Matched = _Search_prefix_length(_Hay + _Candidate, _Ndl, _Tail);
+            if (_Matched == _Tail) {
+                _Result = _Candidate;
+                return true;
+            }
+
+            _Work += _Matched + 1;
+            if (_Work > _Candidate + 4096) {
+                _Result = _Search_two_way(_Hay + _Candidate, _Haystack_length - _Candidate, _Ndl, _Needle_length);
+                if (_Result != static_cast<size_t>(-1)) {
+                    _Result += _Candidate;
+                }
+
+                return true;
+            }
+
+            return false;
+        };
+
+        size_t _Result = static_cast<size_t>(-1);
+        constexpr size_t _Avx_step = 32 / sizeof(_Ty);
+        if (_Possible >= _Avx_step && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _First_ch = _Traits::_Set_avx(_Ndl[0]);
+            const __m256i _Last_ch  = _Traits::_Set_avx(_Ndl[_Tail]);
+            for (; _Possible - _Pos >= _Avx_step; _Pos += _Avx_step) {
+                const __m256i _Data_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos));
+                const __m256i _Data_last  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos + _Tail));
+                const __m256i _Both       = _mm256_and_si256(
+                    _Traits::_Cmp_avx(_Data_first, _First_ch), _Traits::_Cmp_avx(_Data_last, _Last_ch));
+                unsigned long _Bingo =
+                    static_cast<unsigned long>(_mm256_movemask_epi8(_Both)) & _Search_element_bits<_Ty>;
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    if (_Verify(_Pos + _Offset / sizeof(_Ty), _Result)) {
+                        return _Result;
+                    }
+
+                    _Bingo &= _Bingo - 1;
+                }
+            }
+        }
+
+        constexpr size_t _Sse_step = 16 / sizeof(_Ty);
+        if (_Possible - _Pos >= _Sse_step && _Traits::_Sse_available()) {
+            const __m128i _First_ch = _Traits::_Set_sse(_Ndl[0]);
+            const __m128i _Last_ch  = _Traits::_Set_sse(_Ndl[_Tail]);
+            for (; _Possible - _Pos >= _Sse_step; _Pos += _Sse_step) {
+                const __m128i _Data_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos));
+                const __m128i _Data_last  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos + _Tail));
+                const __m128i _Both =
+                    _mm_and_si128(_Traits::_Cmp_sse(_Data_first, _First_ch), _Traits::_Cmp_sse(_Data_last, _Last_ch));
+                unsigned long _Bingo = static_cast<unsigned long>(_mm_movemask_epi8(_Both)) & _Search_element_bits<_Ty>;
+                while (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    if (_Verify(_Pos + _Offset / sizeof(_Ty), _Result)) {
+                        return _Result;
+                    }
+
+                    _Bingo &= _Bingo - 1;
+                }
+            }
+        }
+
+        for (; _Pos != _Possible; ++_Pos) {
+            if (_Hay[_Pos] == _Ndl[0] && _Hay[_Pos + _Tail] == _Ndl[_Tail] && _Verify(_Pos, _Result)) {
+                return _Result;
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) size_t __cdecl __std_search_1(const void* const _Haystack, const size_t _Haystack_length,
+    const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Search_impl<_Find_traits_1, unsigned char>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __cdecl __std_search_2(const void* const _Haystack, const size_t _Haystack_length,
+    const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Search_impl<_Find_traits_2, unsigned short>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __cdecl __std_search_4(const void* const _Haystack, const size_t _Haystack_length,
+    const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Search_impl<_Find_traits_4, unsigned long>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __cdecl __std_search_8(const void* const _Haystack, const size_t _Haystack_length,
+    const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Search_impl<_Find_traits_8, unsigned long long>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+} // extern "C"
+
+namespace {
+    // The lane keys and arithmetic must match _Fast_hash_stripes in <xhash> exactly.
+    constexpr unsigned long long _Fast_hash_key_0 = 0x9E3779B97F4A7C15ULL;
+    constexpr unsigned long long _Fast_hash_key_1 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr unsigned long long _Fast_hash_key_2 = 0x165667B19E3779F9ULL;
+    constexpr unsigned long long _Fast_hash_key_3 = 0xD6E8FEB86659FD93ULL;
+    constexpr unsigned long long _Fast_hash_step  = 0x632BE59BD9B4E019ULL;
+
+    unsigned long long _Fast_hash_lane(
+        const unsigned long long _Lane, const void* const _Data_ptr, const unsigned long long _Key) noexcept {
+        // x86 and x64 are little-endian and allow unaligned loads
+        const unsigned long long _Data  = *static_cast<const unsigned long long*>(_Data_ptr);
+        const unsigned long long _Keyed = _Data ^ _Key;
+        return _Lane + _Data + (_Keyed & 0xFFFFFFFFULL) * (_Keyed >> 32);
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_fast_hash_stripes(
+    unsigned long long* const _Lanes, const void* _First, size_t _Stripes) noexcept {
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Step = _mm256_set1_epi64x(static_cast<long long>(_Fast_hash_step));
+        __m256i _Keys       = _mm256_set_epi64x(static_cast<long long>(_Fast_hash_key_3),
+            static_cast<long long>(_Fast_hash_key_2), static_cast<long long>(_Fast_hash_key_1),
+            static_cast<long long>(_Fast_hash_key_0));
+        __m256i _Acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Lanes));
+        for (; _Stripes != 0; --_Stripes) {
+            const __m256i _Data  = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            const __m256i _Keyed = _mm256_xor_si256(_Data, _Keys);
+            // multiplies the low and high 32 bits of each keyed lane
+            const __m256i _Product = _mm256_mul_epu32(_Keyed, _mm256_srli_epi64(_Keyed, 32));
+            _Acc                   = _mm256_add_epi64(_Acc, _mm256_add_epi64(_Data, _Product));
+            _Keys                  = _mm256_add_epi64(_Keys, _Step);
+            _Advance_bytes(_First, 32);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Acc);
+        return;
+    }
+
+    for (unsigned long long _Offset = 0; _Stripes != 0; --_Stripes, _Offset += _Fast_hash_step) {
+        const auto _Bytes = static_cast<const unsigned char*>(_First);
+        _Lanes[0]         = _Fast_hash_lane(_Lanes[0], _Bytes, _Fast_hash_key_0 + _Offset);
+        _Lanes[1]         = _Fast_hash_lane(_Lanes[1], _Bytes + 8, _Fast_hash_key_1 + _Offset);
+        _Lanes[2]         = _Fast_hash_lane(_Lanes[2], _Bytes + 16, _Fast_hash_key_2 + _Offset);
+        _Lanes[3]         = _Fast_hash_lane(_Lanes[3], _Bytes + 24, _Fast_hash_key_3 + _Offset);
+        _Advance_bytes(_First, 32);
+    }
+}
+} // extern "C"
+
+namespace {
+    bool _Use_sse2() noexcept {
+#ifdef _M_IX86
+        return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        return true;
+#endif // ^^^ !_M_IX86 ^^^
+    }
+
+    template <class _Ty>
+    size_t _Widen_ascii_tail(
+        const unsigned char* const _Src, const size_t _Count, _Ty* const _Dest, size_t _Done) noexcept {
+        for (; _Done != _Count && _Src[_Done] < 0x80u; ++_Done) {
+            _Dest[_Done] = _Src[_Done];
+        }
+
+        return _Done;
+    }
+
+    template <class _Ty>
+    size_t _Narrow_ascii_tail(const _Ty* const _Src, const size_t _Count, char* const _Dest, size_t _Done) noexcept {
+        for (; _Done != _Count && _Src[_Done] < 0x80u; ++_Done) {
+            _Dest[_Done] = static_cast<char>(_Src[_Done]);
+        }
+
+        return _Done;
+    }
+} // unnamed namespace
+
+extern "C" {
+// Each block of 16 elements is tested for a non-ASCII element at once; the block that has one is finished one element
+// at a time, so that exactly the ASCII prefix is converted.
+__declspec(noalias) size_t __cdecl __std_widen_ascii_prefix_2(
+    const char* const _First, const size_t _Count, void* const _Dest) noexcept {
+    const auto _Src = reinterpret_cast<const unsigned char*>(_First);
+    const auto _Out = static_cast<unsigned short*>(_Dest);
+    size_t _Done    = 0;
+    if (_Use_sse2()) {
+        const __m128i _Zero = _mm_setzero_si128();
+        for (; _Count - _Done >= 16; _Done += 16) {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done));
+            if (_mm_movemask_epi8(_Data) != 0) {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done), _mm_unpacklo_epi8(_Data, _Zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done + 8), _mm_unpackhi_epi8(_Data, _Zero));
+        }
+    }
+
+    return _Widen_ascii_tail(_Src, _Count, _Out, _Done);
+}
+
+__declspec(noalias) size_t __cdecl __std_widen_ascii_prefix_4(
+    const char* const _First, const size_t _Count, void* const _Dest) noexcept {
+    const auto _Src = reinterpret_cast<const unsigned char*>(_First);
+    const auto _Out = static_cast<unsigned int*>(_Dest);
+    size_t _Done    = 0;
+    if (_Use_sse2()) {
+        const __m128i _Zero = _mm_setzero_si128();
+        for (; _Count - _Done >= 16; _Done += 16) {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done));
+            if (_mm_movemask_epi8(_Data) != 0) {
+                break;
+            }
+
+            const __m128i _Low  = _mm_unpacklo_epi8(_Data, _Zero);
+            const __m128i _High = _mm_unpackhi_epi8(_Data, _Zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done), _mm_unpacklo_epi16(_Low, _Zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done + 4), _mm_unpackhi_epi16(_Low, _Zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done + 8), _mm_unpacklo_epi16(_High, _Zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Done + 12), _mm_unpackhi_epi16(_High, _Zero));
+        }
+    }
+
+    return _Widen_ascii_tail(_Src, _Count, _Out, _Done);
+}
+
+__declspec(noalias) size_t __cdecl __std_narrow_ascii_prefix_2(
+    const void* const _First, const size_t _Count, char* const _Dest) noexcept {
+    const auto _Src = static_cast<const unsigned short*>(_First);
+    size_t _Done    = 0;
+    if (_Use_sse2()) {
+        const __m128i _Non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        for (; _Count - _Done >= 16; _Done += 16) {
+            const __m128i _Low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done));
+            const __m128i _High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done + 8));
+            const __m128i _Bits = _mm_and_si128(_mm_or_si128(_Low, _High), _Non_ascii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_Bits, _mm_setzero_si128())) != 0xFFFF) {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Done), _mm_packus_epi16(_Low, _High));
+        }
+    }
+
+    return _Narrow_ascii_tail(_Src, _Count, _Dest, _Done);
+}
+
+__declspec(noalias) size_t __cdecl __std_narrow_ascii_prefix_4(
+    const void* const _First, const size_t _Count, char* const _Dest) noexcept {
+    const auto _Src = static_cast<const unsigned int*>(_First);
+    size_t _Done    = 0;
+    if (_Use_sse2()) {
+        const __m128i _Non_ascii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+        for (; _Count - _Done >= 16; _Done += 16) {
+            const __m128i _Data0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done));
+            const __m128i _Data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done + 4));
+            const __m128i _Data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done + 8));
+            const __m128i _Data3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done + 12));
+            const __m128i _Bits  = _mm_and_si128(
+                _mm_or_si128(_mm_or_si128(_Data0, _Data1), _mm_or_si128(_Data2, _Data3)), _Non_ascii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_Bits, _mm_setzero_si128())) != 0xFFFF) {
+                break;
+            }
+
+            // every element is below 0x80, so neither pack saturates
+            const __m128i _Low  = _mm_packs_epi32(_Data0, _Data1);
+            const __m128i _High = _mm_packs_epi32(_Data2, _Data3);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Done), _mm_packus_epi16(_Low, _High));
+        }
+    }
+
+    return _Narrow_ascii_tail(_Src, _Count, _Dest, _Done);
+}
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    struct _Mersenne_twist_traits;
+
+    template <>
+    struct _Mersenne_twist_traits<unsigned long> {
+        static __m128i _Set_sse(const unsigned long _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Neg_sse(const __m128i _Val) noexcept {
+            return _mm_sub_epi32(_mm_setzero_si128(), _Val);
+        }
+
+        static __m128i _Shr1_sse(const __m128i _Val) noexcept {
+            return _mm_srli_epi32(_Val, 1);
+        }
+
+        static __m256i _Set_avx(const unsigned long _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Neg_avx(const __m256i _Val) noexcept {
+            return _mm256_sub_epi32(_mm256_setzero_si256(), _Val);
+        }
+
+        static __m256i _Shr1_avx(const __m256i _Val) noexcept {
+            return _mm256_srli_epi32(_Val, 1);
+        }
+    };
+
+    template <>
+    struct _Mersenne_twist_traits<unsigned long long> {
+        static __m128i _Set_sse(const unsigned long long _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Neg_sse(const __m128i _Val) noexcept {
+            return _mm_sub_epi64(_mm_setzero_si128(), _Val);
+        }
+
+        static __m128i _Shr1_sse(const __m128i _Val) noexcept {
+            return _mm_srli_epi64(_Val, 1);
+        }
+
+        static __m256i _Set_avx(const unsigned long long _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Neg_avx(const __m256i _Val) noexcept {
+            return _mm256_sub_epi64(_mm256_setzero_si256(), _Val);
+        }
+
+        static __m256i _Shr1_avx(const __m256i _Val) noexcept {
+            return _mm256_srli_epi64(_Val, 1);
+        }
+    };
+
+    // The recurrence must match mersenne_twister::_Refill_lower and _Refill_upper in <random> exactly.
+    template <class _Ty>
+    void _Mersenne_twist_impl(_Ty* const _Dest, const _Ty* const _Src, const _Ty* const _Feedback, const size_t _Count,
+        const _Ty _Matrix, const _Ty _Upper_mask) noexcept {
+        using _Traits = _Mersenne_twist_traits<_Ty>;
+        size_t _Done  = 0;
+
+        // Blocks are computed in ascending order, and each block is stored before the next one is loaded, so inputs
+        // may be outputs of earlier blocks; the caller guarantees that they are at least 8 elements behind.
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            constexpr size_t _Lanes = 32 / sizeof(_Ty);
+            const __m256i _Upper    = _Traits::_Set_avx(_Upper_mask);
+            const __m256i _Mat      = _Traits::_Set_avx(_Matrix);
+            const __m256i _One      = _Traits::_Set_avx(1);
+            for (; _Count - _Done >= _Lanes; _Done += _Lanes) {
+                const __m256i _First  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Done));
+                const __m256i _Second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Done + 1));
+                const __m256i _Back   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Feedback + _Done));
+                const __m256i _Tmp    =
+                    _mm256_or_si256(_mm256_and_si256(_First, _Upper), _mm256_andnot_si256(_Upper, _Second));
+                const __m256i _Odd    = _mm256_and_si256(_Traits::_Neg_avx(_mm256_and_si256(_Tmp, _One)), _Mat);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Done),
+                    _mm256_xor_si256(_mm256_xor_si256(_Traits::_Shr1_avx(_Tmp), _Odd), _Back));
+            }
+        } else if (_Use_sse2()) {
+            constexpr size_t _Lanes = 16 / sizeof(_Ty);
+            const __m128i _Upper    = _Traits::_Set_sse(_Upper_mask);
+            const __m128i _Mat      = _Traits::_Set_sse(_Matrix);
+            const __m128i _One      = _Traits::_Set_sse(1);
+            for (; _Count - _Done >= _Lanes; _Done += _Lanes) {
+                const __m128i _First  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done));
+                const __m128i _Second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Done + 1));
+                const __m128i _Back   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Feedback + _Done));
+                const __m128i _Tmp    = _mm_or_si128(_mm_and_si128(_First, _Upper), _mm_andnot_si128(_Upper, _Second));
+                const __m128i _Odd    = _mm_and_si128(_Traits::_Neg_sse(_mm_and_si128(_Tmp, _One)), _Mat);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Done),
+                    _mm_xor_si128(_mm_xor_si128(_Traits::_Shr1_sse(_Tmp), _Odd), _Back));
+            }
+        }
+
+        for (; _Done != _Count; ++_Done) {
+            const _Ty _Tmp = (_Src[_Done] & _Upper_mask) | (_Src[_Done + 1] & ~_Upper_mask);
+            _Dest[_Done]   = (_Tmp >> 1) ^ (_Tmp & 1 ? _Matrix : 0) ^ _Feedback[_Done];
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_mersenne_twist_4(void* const _Dest, const void* const _Src,
+    const void* const _Feedback, const size_t _Count, const unsigned long _Matrix,
+    const unsigned long _Upper_mask) noexcept {
+    _Mersenne_twist_impl(static_cast<unsigned long*>(_Dest), static_cast<const unsigned long*>(_Src),
+        static_cast<const unsigned long*>(_Feedback), _Count, _Matrix, _Upper_mask);
+}
+
+__declspec(noalias) void __cdecl __std_mersenne_twist_8(void* const _Dest, const void* const _Src,
+    const void* const _Feedback, const size_t _Count, const unsigned long long _Matrix,
+    const unsigned long long _Upper_mask) noexcept {
+    _Mersenne_twist_impl(static_cast<unsigned long long*>(_Dest), static_cast<const unsigned long long*>(_Src),
+        static_cast<const unsigned long long*>(_Feedback), _Count, _Matrix, _Upper_mask);
+}
+} // extern "C"
+
+namespace {
+    unsigned int _Reverse_bits_16(unsigned int _Val) noexcept {
+        _Val = ((_Val >> 1) & 0x5555U) | ((_Val & 0x5555U) << 1);
+        _Val = ((_Val >> 2) & 0x3333U) | ((_Val & 0x3333U) << 2);
+        _Val = ((_Val >> 4) & 0x0F0FU) | ((_Val & 0x0F0FU) << 4);
+        return ((_Val >> 8) & 0x00FFU) | ((_Val & 0x00FFU) << 8);
+    }
+
+    template <class _Elem>
+    void _Bitset_to_string_impl(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits, const _Elem _Elem0,
+        const _Elem _Elem1) noexcept {
+        // bit _Ix goes to _Dest[_Size_bits - 1 - _Ix]; each block of bits is written as one vector
+        const auto _Bytes = static_cast<const unsigned char*>(_Src);
+        size_t _Ix        = 0;
+        if (_Use_sse2()) {
+            if constexpr (sizeof(_Elem) == 1) {
+                const __m128i _Px0       = _mm_set1_epi8(_Elem0);
+                const __m128i _Pxd       = _mm_set1_epi8(static_cast<char>(_Elem0 ^ _Elem1));
+                const __m128i _Bit_masks = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+                for (; _Size_bits - _Ix >= 16; _Ix += 16) {
+                    // spread the higher byte over lanes 0-7 and the lower byte over lanes 8-15
+                    const unsigned int _Two_bytes =
+                        (static_cast<unsigned int>(_Bytes[_Ix / 8]) << 8) | _Bytes[_Ix / 8 + 1];
+                    __m128i _Data = _mm_cvtsi32_si128(static_cast<int>(_Two_bytes));
+                    _Data         = _mm_unpacklo_epi8(_Data, _Data);
+                    _Data         = _mm_unpacklo_epi16(_Data, _Data);
+                    _Data         = _mm_unpacklo_epi32(_Data, _Data);
+                    const __m128i _Set = _mm_cmpeq_epi8(_mm_and_si128(_Data, _Bit_masks), _Bit_masks);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + (_Size_bits - _Ix - 16)),
+                        _mm_xor_si128(_Px0, _mm_and_si128(_Set, _Pxd)));
+                }
+            } else {
+                static_assert(sizeof(_Elem) == 2);
+                const __m128i _Px0       = _mm_set1_epi16(static_cast<short>(_Elem0));
+                const __m128i _Pxd       = _mm_set1_epi16(static_cast<short>(_Elem0 ^ _Elem1));
+                const __m128i _Bit_masks = _mm_set_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+                for (; _Size_bits - _Ix >= 8; _Ix += 8) {
+                    const __m128i _Data = _mm_set1_epi16(static_cast<short>(_Bytes[_Ix / 8]));
+                    const __m128i _Set  = _mm_cmpeq_epi16(_mm_and_si128(_Data, _Bit_masks), _Bit_masks);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + (_Size_bits - _Ix - 8)),
+                        _mm_xor_si128(_Px0, _mm_and_si128(_Set, _Pxd)));
+                }
+            }
+        }
+
+        for (; _Ix != _Size_bits; ++_Ix) {
+            _Dest[_Size_bits - 1 - _Ix] = ((_Bytes[_Ix / 8] >> (_Ix % 8)) & 1) != 0 ? _Elem1 : _Elem0;
+        }
+    }
+
+    template <class _Elem>
+    bool _Bitset_from_string_impl(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes,
+        const size_t _Size_bits, size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // _Src[_Size_chars - 1 - _Ix] goes to bit _Ix; each block of characters is compared as one vector
+        if (_Size_chars > _Size_bits) {
+            for (size_t _Ix = _Size_bits; _Ix != _Size_chars; ++_Ix) {
+                if (_Src[_Ix] != _Elem0 && _Src[_Ix] != _Elem1) {
+                    return false;
+                }
+            }
+
+            _Size_chars = _Size_bits;
+        }
+
+        const auto _Bytes = static_cast<unsigned char*>(_Dest);
+        for (size_t _Ix = 0; _Ix != _Size_bytes; ++_Ix) {
+            _Bytes[_Ix] = 0;
+        }
+
+        size_t _Ix = 0;
+        if (_Use_sse2()) {
+            if constexpr (sizeof(_Elem) == 1) {
+                const __m128i _Px0 = _mm_set1_epi8(_Elem0);
+                const __m128i _Px1 = _mm_set1_epi8(_Elem1);
+                for (; _Size_chars - _Ix >= 16; _Ix += 16) {
+                    const __m128i _Data =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + (_Size_chars - _Ix - 16)));
+                    const auto _Ones  = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data, _Px1)));
+                    const auto _Zeros = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Data, _Px0)));
+                    if ((_Ones | _Zeros) != 0xFFFFU) {
+                        return false;
+                    }
+
+                    // lane _Lx holds bit _Ix + 15 - _Lx
+                    const unsigned int _Bits = _Reverse_bits_16(_Ones);
+                    _Bytes[_Ix / 8]          = static_cast<unsigned char>(_Bits);
+                    _Bytes[_Ix / 8 + 1]      = static_cast<unsigned char>(_Bits >> 8);
+                }
+            } else {
+                static_assert(sizeof(_Elem) == 2);
+                const __m128i _Px0 = _mm_set1_epi16(static_cast<short>(_Elem0));
+                const __m128i _Px1 = _mm_set1_epi16(static_cast<short>(_Elem1));
+                for (; _Size_chars - _Ix >= 8; _Ix += 8) {
+                    const __m128i _Data =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + (_Size_chars - _Ix - 8)));
+                    const __m128i _Ones  = _mm_cmpeq_epi16(_Data, _Px1);
+                    const __m128i _Zeros = _mm_cmpeq_epi16(_Data, _Px0);
+                    if (_mm_movemask_epi8(_mm_or_si128(_Ones, _Zeros)) != 0xFFFF) {
+                        return false;
+                    }
+
+                    // lane _Lx holds bit _Ix + 7 - _Lx
+                    const auto _Lanes = static_cast<unsigned int>(
+                        _mm_movemask_epi8(_mm_packs_epi16(_Ones, _mm_setzero_si128())));
+                    _Bytes[_Ix / 8] = static_cast<unsigned char>(_Reverse_bits_16(_Lanes) >> 8);
+                }
+            }
+        }
+
+        for (; _Ix != _Size_chars; ++_Ix) {
+            const _Elem _Ch = _Src[_Size_chars - 1 - _Ix];
+            if (_Ch == _Elem1) {
+                _Bytes[_Ix / 8] |= static_cast<unsigned char>(1U << (_Ix % 8));
+            } else if (_Ch != _Elem0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_bitset_to_string_1(
+    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
+    _Bitset_to_string_impl(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) void __cdecl __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
+    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
+    _Bitset_to_string_impl(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __cdecl __std_bitset_from_string_1(void* const _Dest, const char* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const char _Elem0,
+    const char _Elem1) noexcept {
+    return _Bitset_from_string_impl(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __cdecl __std_bitset_from_string_2(void* const _Dest, const wchar_t* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const wchar_t _Elem0,
+    const wchar_t _Elem1) noexcept {
+    return _Bitset_from_string_impl(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+} // extern "C"
+
+namespace {
+    struct _Bitwise_and {
+        static unsigned long long _Scalar(const unsigned long long _Left, const unsigned long long _Right) noexcept {
+            return _Left & _Right;
+        }
+
+        static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_and_si128(_Left, _Right);
+        }
+
+        static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_and_si256(_Left, _Right);
+        }
+    };
+
+    struct _Bitwise_or {
+        static unsigned long long _Scalar(const unsigned long long _Left, const unsigned long long _Right) noexcept {
+            return _Left | _Right;
+        }
+
+        static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_or_si128(_Left, _Right);
+        }
+
+        static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_or_si256(_Left, _Right);
+        }
+    };
+
+    struct _Bitwise_xor {
+        static unsigned long long _Scalar(const unsigned long long _Left, const unsigned long long _Right) noexcept {
+            return _Left ^ _Right;
+        }
+
+        static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_xor_si128(_Left, _Right);
+        }
+
+        static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_xor_si256(_Left, _Right);
+        }
+    };
+
+    struct _Bitwise_andnot { // _Left & ~_Right
+        static unsigned long long _Scalar(const unsigned long long _Left, const unsigned long long _Right) noexcept {
+            return _Left & ~_Right;
+        }
+
+        static __m128i _Sse(const __m128i _Left, const __m128i _Right) noexcept {
+            return _mm_andnot_si128(_Right, _Left);
+        }
+
+        static __m256i _Avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_andnot_si256(_Right, _Left);
+        }
+    };
+
+    template <class _Op>
+    void _Bitwise_impl(void* const _Dest, const void* const _Src, const size_t _Count) noexcept {
+        // _Dest[_Ix] = _Op(_Dest[_Ix], _Src[_Ix]); _Dest and _Src may be the same array, but may not overlap otherwise
+        const auto _Dest_words = static_cast<unsigned long long*>(_Dest);
+        const auto _Src_words  = static_cast<const unsigned long long*>(_Src);
+        size_t _Ix             = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            for (; _Count - _Ix >= 4; _Ix += 4) {
+                const __m256i _Left  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Dest_words + _Ix));
+                const __m256i _Right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src_words + _Ix));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest_words + _Ix), _Op::_Avx(_Left, _Right));
+            }
+        } else if (_Use_sse2()) {
+            for (; _Count - _Ix >= 2; _Ix += 2) {
+                const __m128i _Left  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Dest_words + _Ix));
+                const __m128i _Right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src_words + _Ix));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest_words + _Ix), _Op::_Sse(_Left, _Right));
+            }
+        }
+
+        for (; _Ix != _Count; ++_Ix) {
+            _Dest_words[_Ix] = _Op::_Scalar(_Dest_words[_Ix], _Src_words[_Ix]);
+        }
+    }
+
+    size_t _Popcount_word(unsigned long long _Val) noexcept {
+        // see <limits>: _Popcount_fallback
+        _Val -= (_Val >> 1) & 0x5555'5555'5555'5555ULL;
+        _Val = (_Val & 0x3333'3333'3333'3333ULL) + ((_Val >> 2) & 0x3333'3333'3333'3333ULL);
+        _Val = (_Val + (_Val >> 4)) & 0x0F0F'0F0F'0F0F'0F0FULL;
+        return static_cast<size_t>((_Val * 0x0101'0101'0101'0101ULL) >> 56);
+    }
+
+    size_t _Popcount_impl(const unsigned long long* const _Src, const size_t _Count) noexcept {
+        size_t _Result = 0;
+        size_t _Ix     = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            // count the bits of each nibble by table lookup, then sum the bytes of each 64-bit lane with vpsadbw
+            const __m256i _Table       = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, //
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i _Nibble_mask = _mm256_set1_epi8(0x0F);
+            __m256i _Sums              = _mm256_setzero_si256();
+            for (; _Count - _Ix >= 4; _Ix += 4) {
+                const __m256i _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Ix));
+                const __m256i _Low  = _mm256_shuffle_epi8(_Table, _mm256_and_si256(_Data, _Nibble_mask));
+                const __m256i _High =
+                    _mm256_shuffle_epi8(_Table, _mm256_and_si256(_mm256_srli_epi16(_Data, 4), _Nibble_mask));
+                _Sums = _mm256_add_epi64(_Sums, _mm256_sad_epu8(_mm256_add_epi8(_Low, _High), _mm256_setzero_si256()));
+            }
+
+            const __m128i _Sums_128 = _mm_add_epi64(_mm256_castsi256_si128(_Sums), _mm256_extracti128_si256(_Sums, 1));
+            unsigned long long _Lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Lanes), _Sums_128);
+            _Result = static_cast<size_t>(_Lanes[0] + _Lanes[1]);
+        }
+
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+            for (; _Ix != _Count; ++_Ix) {
+#ifdef _M_IX86
+                _Result += __popcnt(static_cast<unsigned int>(_Src[_Ix]))
+                         + __popcnt(static_cast<unsigned int>(_Src[_Ix] >> 32));
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+                _Result += static_cast<size_t>(__popcnt64(_Src[_Ix]));
+#endif // ^^^ !_M_IX86 ^^^
+            }
+        } else {
+            for (; _Ix != _Count; ++_Ix) {
+                _Result += _Popcount_word(_Src[_Ix]);
+            }
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_bitwise_and_8(
+    void* const _Dest, const void* const _Src, const size_t _Count) noexcept {
+    _Bitwise_impl<_Bitwise_and>(_Dest, _Src, _Count);
+}
+
+__declspec(noalias) void __cdecl __std_bitwise_or_8(
+    void* const _Dest, const void* const _Src, const size_t _Count) noexcept {
+    _Bitwise_impl<_Bitwise_or>(_Dest, _Src, _Count);
+}
+
+__declspec(noalias) void __cdecl __std_bitwise_xor_8(
+    void* const _Dest, const void* const _Src, const size_t _Count) noexcept {
+    _Bitwise_impl<_Bitwise_xor>(_Dest, _Src, _Count);
+}
+
+__declspec(noalias) void __cdecl __std_bitwise_andnot_8(
+    void* const _Dest, const void* const _Src, const size_t _Count) noexcept {
+    _Bitwise_impl<_Bitwise_andnot>(_Dest, _Src, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_popcount_8(const void* const _Src, const size_t _Count) noexcept {
+    return _Popcount_impl(static_cast<const unsigned long long*>(_Src), _Count);
+}
+} // extern "C"
+
+namespace {
+    // The complex kernels compute each product and sum exactly as complex<_Ty>::operator*= and operator+= do, so their
+    // results match the scalar operators bit for bit: (a + bi)(c + di) = (ac - bd) + (bc + ad)i.
+    __m128d _Complex_mul_sse2(const __m128d _Left, const __m128d _Right) noexcept { // one complex<double>
+        const __m128d _Real_right = _mm_unpacklo_pd(_Right, _Right); // c c
+        const __m128d _Imag_right = _mm_unpackhi_pd(_Right, _Right); // d d
+        const __m128d _Swapped    = _mm_shuffle_pd(_Left, _Left, 1); // b a
+        const __m128d _Negate_re  = _mm_set_pd(0.0, -0.0);
+        return _mm_add_pd(_mm_mul_pd(_Left, _Real_right), _mm_xor_pd(_mm_mul_pd(_Swapped, _Imag_right), _Negate_re));
+    }
+
+    __m256d _Complex_mul_avx(const __m256d _Left, const __m256d _Right) noexcept { // two complex<double>
+        const __m256d _Real_right = _mm256_movedup_pd(_Right);
+        const __m256d _Imag_right = _mm256_permute_pd(_Right, 0xF);
+        const __m256d _Swapped    = _mm256_permute_pd(_Left, 0x5);
+        return _mm256_addsub_pd(_mm256_mul_pd(_Left, _Real_right), _mm256_mul_pd(_Swapped, _Imag_right));
+    }
+
+    __m128 _Complex_mul_sse2(const __m128 _Left, const __m128 _Right) noexcept { // two complex<float>
+        const __m128 _Real_right = _mm_shuffle_ps(_Right, _Right, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 _Imag_right = _mm_shuffle_ps(_Right, _Right, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 _Swapped    = _mm_shuffle_ps(_Left, _Left, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 _Negate_re  = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+        return _mm_add_ps(_mm_mul_ps(_Left, _Real_right), _mm_xor_ps(_mm_mul_ps(_Swapped, _Imag_right), _Negate_re));
+    }
+
+    __m256 _Complex_mul_avx(const __m256 _Left, const __m256 _Right) noexcept { // four complex<float>
+        const __m256 _Real_right = _mm256_moveldup_ps(_Right);
+        const __m256 _Imag_right = _mm256_movehdup_ps(_Right);
+        const __m256 _Swapped    = _mm256_permute_ps(_Left, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm256_addsub_ps(_mm256_mul_ps(_Left, _Real_right), _mm256_mul_ps(_Swapped, _Imag_right));
+    }
+
+    template <class _Ty>
+    void _Complex_mul_scalar(
+        const _Ty* const _Left, const _Ty* const _Right, _Ty* const _Dest, const bool _Accumulate) noexcept {
+        _Ty _Re = _Left[0] * _Right[0] - _Left[1] * _Right[1];
+        _Ty _Im = _Left[0] * _Right[1] + _Left[1] * _Right[0];
+        if (_Accumulate) {
+            _Re = _Dest[0] + _Re;
+            _Im = _Dest[1] + _Im;
+        }
+
+        _Dest[0] = _Re;
+        _Dest[1] = _Im;
+    }
+
+    template <bool _Accumulate>
+    void _Complex_multiply_8(const double* const _First1, const double* const _First2, double* const _Dest,
+        const size_t _Count) noexcept { // _Count complex<double>, stored as 2 * _Count doubles
+        size_t _Ix = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            for (; _Count - _Ix >= 2; _Ix += 2) {
+                __m256d _Product =
+                    _Complex_mul_avx(_mm256_loadu_pd(_First1 + 2 * _Ix), _mm256_loadu_pd(_First2 + 2 * _Ix));
+                if constexpr (_Accumulate) {
+                    _Product = _mm256_add_pd(_mm256_loadu_pd(_Dest + 2 * _Ix), _Product);
+                }
+
+                _mm256_storeu_pd(_Dest + 2 * _Ix, _Product);
+            }
+        } else if (_Use_sse2()) {
+            for (; _Ix != _Count; ++_Ix) {
+                __m128d _Product = _Complex_mul_sse2(_mm_loadu_pd(_First1 + 2 * _Ix), _mm_loadu_pd(_First2 + 2 * _Ix));
+                if constexpr (_Accumulate) {
+                    _Product = _mm_add_pd(_mm_loadu_pd(_Dest + 2 * _Ix), _Product);
+                }
+
+                _mm_storeu_pd(_Dest + 2 * _Ix, _Product);
+            }
+        }
+
+        for (; _Ix != _Count; ++_Ix) {
+            _Complex_mul_scalar(_First1 + 2 * _Ix, _First2 + 2 * _Ix, _Dest + 2 * _Ix, _Accumulate);
+        }
+    }
+
+    template <bool _Accumulate>
+    void _Complex_multiply_4(const float* const _First1, const float* const _First2, float* const _Dest,
+        const size_t _Count) noexcept { // _Count complex<float>, stored as 2 * _Count floats
+        size_t _Ix = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            for (; _Count - _Ix >= 4; _Ix += 4) {
+                __m256 _Product =
+                    _Complex_mul_avx(_mm256_loadu_ps(_First1 + 2 * _Ix), _mm256_loadu_ps(_First2 + 2 * _Ix));
+                if constexpr (_Accumulate) {
+                    _Product = _mm256_add_ps(_mm256_loadu_ps(_Dest + 2 * _Ix), _Product);
+                }
+
+                _mm256_storeu_ps(_Dest + 2 * _Ix, _Product);
+            }
+        } else if (_Use_sse2()) {
+            for (; _Count - _Ix >= 2; _Ix += 2) {
+                __m128 _Product = _Complex_mul_sse2(_mm_loadu_ps(_First1 + 2 * _Ix), _mm_loadu_ps(_First2 + 2 * _Ix));
+                if constexpr (_Accumulate) {
+                    _Product = _mm_add_ps(_mm_loadu_ps(_Dest + 2 * _Ix), _Product);
+                }
+
+                _mm_storeu_ps(_Dest + 2 * _Ix, _Product);
+            }
+        }
+
+        for (; _Ix != _Count; ++_Ix) {
+            _Complex_mul_scalar(_First1 + 2 * _Ix, _First2 + 2 * _Ix, _Dest + 2 * _Ix, _Accumulate);
+        }
+    }
+
+    // The magnitude kernels compute sqrt(re * re + im * im) in double, which can't overflow or lose precision to
+    // underflow for float components, nor for double components whose larger magnitude is in [2^-500, 2^500] or zero.
+    // _Complex_abs_scalar handles everything else, scaling by the larger magnitude as hypot does.
+    constexpr double _Abs_safe_low  = 0x1p-500;
+    constexpr double _Abs_safe_high = 0x1p+500;
+    constexpr double _Dbl_max       = 1.7976931348623158e+308;
+
+    double _Complex_abs_scalar(const double _Re, const double _Im) noexcept {
+        const double _Re_abs = _Re < 0 ? -_Re : _Re;
+        const double _Im_abs = _Im < 0 ? -_Im : _Im;
+        if (_Re_abs > _Dbl_max) {
+            return _Re_abs; // infinite, even if _Im is NaN
+        }
+
+        if (_Im_abs > _Dbl_max) {
+            return _Im_abs;
+        }
+
+        if (!(_Re_abs <= _Dbl_max && _Im_abs <= _Dbl_max)) {
+            return _Re + _Im; // NaN
+        }
+
+        const double _Big   = _Re_abs < _Im_abs ? _Im_abs : _Re_abs;
+        const double _Small = _Re_abs < _Im_abs ? _Re_abs : _Im_abs;
+        if (_Big == 0 || (_Abs_safe_low <= _Big && _Big <= _Abs_safe_high)) {
+            return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(_Re * _Re + _Im * _Im)));
+        }
+
+        const double _Ratio = _Small / _Big;
+        return _Big * _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(1.0 + _Ratio * _Ratio)));
+    }
+
+    void _Complex_abs_8(const double* const _First, double* const _Dest, const size_t _Count) noexcept {
+        size_t _Ix = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256d _Sign = _mm256_set1_pd(-0.0);
+            const __m256d _Low  = _mm256_set1_pd(_Abs_safe_low);
+            const __m256d _High = _mm256_set1_pd(_Abs_safe_high);
+            for (; _Count - _Ix >= 4; _Ix += 4) {
+                const __m256d _Data0 = _mm256_loadu_pd(_First + 2 * _Ix);
+                const __m256d _Data1 = _mm256_loadu_pd(_First + 2 * _Ix + 4);
+                // the lanes are the elements 0, 2, 1, 3
+                const __m256d _Re  = _mm256_unpacklo_pd(_Data0, _Data1);
+                const __m256d _Im  = _mm256_unpackhi_pd(_Data0, _Data1);
+                const __m256d _Big = _mm256_max_pd(_mm256_andnot_pd(_Sign, _Re), _mm256_andnot_pd(_Sign, _Im));
+                const __m256d _In_range =
+                    _mm256_and_pd(_mm256_cmp_pd(_Low, _Big, _CMP_LE_OQ), _mm256_cmp_pd(_Big, _High, _CMP_LE_OQ));
+                const __m256d _Safe = _mm256_or_pd(_In_range, _mm256_cmp_pd(_Big, _mm256_setzero_pd(), _CMP_EQ_OQ));
+                if (_mm256_movemask_pd(_Safe) != 0xF) {
+                    for (size_t _Jx = _Ix; _Jx != _Ix + 4; ++_Jx) {
+                        _Dest[_Jx] = _Complex_abs_scalar(_First[2 * _Jx], _First[2 * _Jx + 1]);
+                    }
+
+                    continue;
+                }
+
+                const __m256d _Sum = _mm256_add_pd(_mm256_mul_pd(_Re, _Re), _mm256_mul_pd(_Im, _Im));
+                _mm256_storeu_pd(_Dest + _Ix, _mm256_permute4x64_pd(_mm256_sqrt_pd(_Sum), _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+        } else if (_Use_sse2()) {
+            const __m128d _Sign = _mm_set1_pd(-0.0);
+            const __m128d _Low  = _mm_set1_pd(_Abs_safe_low);
+            const __m128d _High = _mm_set1_pd(_Abs_safe_high);
+            for (; _Count - _Ix >= 2; _Ix += 2) {
+                const __m128d _Data0 = _mm_loadu_pd(_First + 2 * _Ix);
+                const __m128d _Data1 = _mm_loadu_pd(_First + 2 * _Ix + 2);
+                const __m128d _Re    = _mm_unpacklo_pd(_Data0, _Data1);
+                const __m128d _Im    = _mm_unpackhi_pd(_Data0, _Data1);
+                const __m128d _Big   = _mm_max_pd(_mm_andnot_pd(_Sign, _Re), _mm_andnot_pd(_Sign, _Im));
+                const __m128d _Safe  = _mm_or_pd(_mm_and_pd(_mm_cmple_pd(_Low, _Big), _mm_cmple_pd(_Big, _High)),
+                    _mm_cmpeq_pd(_Big, _mm_setzero_pd()));
+                if (_mm_movemask_pd(_Safe) != 0x3) {
+                    _Dest[_Ix]     = _Complex_abs_scalar(_First[2 * _Ix], _First[2 * _Ix + 1]);
+                    _Dest[_Ix + 1] = _Complex_abs_scalar(_First[2 * _Ix + 2], _First[2 * _Ix + 3]);
+                    continue;
+                }
+
+                const __m128d _Sum = _mm_add_pd(_mm_mul_pd(_Re, _Re), _mm_mul_pd(_Im, _Im));
+                _mm_storeu_pd(_Dest + _Ix, _mm_sqrt_pd(_Sum));
+            }
+        }
+
+        for (; _Ix != _Count; ++_Ix) {
+            _Dest[_Ix] = _Complex_abs_scalar(_First[2 * _Ix], _First[2 * _Ix + 1]);
+        }
+    }
+
+    void _Complex_abs_4(const float* const _First, float* const _Dest, const size_t _Count) noexcept {
+        size_t _Ix = 0;
+        if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            for (; _Count - _Ix >= 4; _Ix += 4) {
+                // the lanes are the elements 0, 2, 1, 3
+                const __m256 _Data   = _mm256_loadu_ps(_First + 2 * _Ix);
+                const __m256d _Lo    = _mm256_cvtps_pd(_mm256_castps256_ps128(_Data));
+                const __m256d _Hi    = _mm256_cvtps_pd(_mm256_extractf128_ps(_Data, 1));
+                const __m256d _Re    = _mm256_unpacklo_pd(_Lo, _Hi);
+                const __m256d _Im    = _mm256_unpackhi_pd(_Lo, _Hi);
+                const __m256d _Root  = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(_Re, _Re), _mm256_mul_pd(_Im, _Im)));
+                const __m128 _Result = _mm256_cvtpd_ps(_Root);
+                if (_mm_movemask_ps(_mm_cmpunord_ps(_Result, _Result)) != 0) { // NaN components
+                    for (size_t _Jx = _Ix; _Jx != _Ix + 4; ++_Jx) {
+                        _Dest[_Jx] = static_cast<float>(_Complex_abs_scalar(_First[2 * _Jx], _First[2 * _Jx + 1]));
+                    }
+
+                    continue;
+                }
+
+                _mm_storeu_ps(_Dest + _Ix, _mm_shuffle_ps(_Result, _Result, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+        } else if (_Use_sse2()) {
+            for (; _Count - _Ix >= 2; _Ix += 2) {
+                const __m128 _Data   = _mm_loadu_ps(_First + 2 * _Ix);
+                const __m128d _Lo    = _mm_cvtps_pd(_Data);
+                const __m128d _Hi    = _mm_cvtps_pd(_mm_movehl_ps(_Data, _Data));
+                const __m128d _Re    = _mm_unpacklo_pd(_Lo, _Hi);
+                const __m128d _Im    = _mm_unpackhi_pd(_Lo, _Hi);
+                const __m128d _Root  = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(_Re, _Re), _mm_mul_pd(_Im, _Im)));
+                const __m128 _Result = _mm_cvtpd_ps(_Root);
+                if ((_mm_movemask_ps(_mm_cmpunord_ps(_Result, _Result)) & 0x3) != 0) { // NaN components
+                    _Dest[_Ix]     = static_cast<float>(_Complex_abs_scalar(_First[2 * _Ix], _First[2 * _Ix + 1]));
+                    _Dest[_Ix + 1] = static_cast<float>(_Complex_abs_scalar(_First[2 * _Ix + 2], _First[2 * _Ix + 3]));
+                    continue;
+                }
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(_Dest + _Ix), _mm_castps_si128(_Result));
+            }
+        }
+
+        for (; _Ix != _Count; ++_Ix) {
+            _Dest[_Ix] = static_cast<float>(_Complex_abs_scalar(_First[2 * _Ix], _First[2 * _Ix + 1]));
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_complex_multiply_4(
+    const void* const _First1, const void* const _First2, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_multiply_4<false>(
+        static_cast<const float*>(_First1), static_cast<const float*>(_First2), static_cast<float*>(_Dest), _Count);
+}
+
+__declspec(noalias) void __cdecl __std_complex_multiply_8(
+    const void* const _First1, const void* const _First2, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_multiply_8<false>(
+        static_cast<const double*>(_First1), static_cast<const double*>(_First2), static_cast<double*>(_Dest), _Count);
+}
+
+__declspec(noalias) void __cdecl __std_complex_multiply_accumulate_4(
+    const void* const _First1, const void* const _First2, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_multiply_4<true>(
+        static_cast<const float*>(_First1), static_cast<const float*>(_First2), static_cast<float*>(_Dest), _Count);
+}
+
+__declspec(noalias) void __cdecl __std_complex_multiply_accumulate_8(
+    const void* const _First1, const void* const _First2, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_multiply_8<true>(
+        static_cast<const double*>(_First1), static_cast<const double*>(_First2), static_cast<double*>(_Dest), _Count);
+}
+
+__declspec(noalias) void __cdecl __std_complex_abs_4(
+    const void* const _First, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_abs_4(static_cast<const float*>(_First), static_cast<float*>(_Dest), _Count);
+}
+
+__declspec(noalias) void __cdecl __std_complex_abs_8(
+    const void* const _First, void* const _Dest, const size_t _Count) noexcept {
+    _Complex_abs_8(static_cast<const double*>(_First), static_cast<double*>(_Dest), _Count);
+}
+} // extern "C"
+
+namespace {
+    unsigned long long _Sum_epi64(const __m128i _Val) noexcept {
+        // sum of the two 64-bit lanes
+        unsigned long long _Result;
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&_Result), _mm_add_epi64(_Val, _mm_unpackhi_epi64(_Val, _Val)));
+        return _Result;
+    }
+
+    unsigned long long _Sum_epi64(const __m256i _Val) noexcept {
+        return _Sum_epi64(_mm_add_epi64(_mm256_castsi256_si128(_Val), _mm256_extracti128_si256(_Val, 1)));
+    }
+
+    template <bool _Signed>
+    __m128i _Add_widened_epi32(const __m128i _Acc, const __m128i _Val) noexcept {
+        // add the 32-bit lanes of _Val, sign- or zero-extended, to the 64-bit lanes of _Acc
+        const __m128i _High = _Signed ? _mm_srai_epi32(_Val, 31) : _mm_setzero_si128();
+        return _mm_add_epi64(_Acc, _mm_add_epi64(_mm_unpacklo_epi32(_Val, _High), _mm_unpackhi_epi32(_Val, _High)));
+    }
+
+    template <bool _Signed>
+    __m256i _Add_widened_epi32(const __m256i _Acc, const __m256i _Val) noexcept {
+        const __m256i _High = _Signed ? _mm256_srai_epi32(_Val, 31) : _mm256_setzero_si256();
+        return _mm256_add_epi64(
+            _Acc, _mm256_add_epi64(_mm256_unpacklo_epi32(_Val, _High), _mm256_unpackhi_epi32(_Val, _High)));
+    }
+
+    __m128i _Mullo_epi64(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        // low 64 bits of the products of the 64-bit lanes, from 32x32->64 multiplications
+        const __m128i _Cross = _mm_add_epi64(
+            _mm_mul_epu32(_mm_srli_epi64(_Lhs, 32), _Rhs), _mm_mul_epu32(_Lhs, _mm_srli_epi64(_Rhs, 32)));
+        return _mm_add_epi64(_mm_mul_epu32(_Lhs, _Rhs), _mm_slli_epi64(_Cross, 32));
+    }
+
+    __m256i _Mullo_epi64(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        const __m256i _Cross = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(_Lhs, 32), _Rhs), _mm256_mul_epu32(_Lhs, _mm256_srli_epi64(_Rhs, 32)));
+        return _mm256_add_epi64(_mm256_mul_epu32(_Lhs, _Rhs), _mm256_slli_epi64(_Cross, 32));
+    }
+
+    // The sums are computed modulo 2^64 from elements sign-extended when _Ty is signed and zero-extended otherwise,
+    // which is what the caller needs to produce the sum modulo 2^N of any N-bit integer type with N <= 64.
+    template <class _Ty>
+    unsigned long long _Accumulate_tail(
+        const void* const _First, const void* const _Last, unsigned long long _Sum) noexcept {
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            _Sum += static_cast<unsigned long long>(*_Ptr);
+        }
+
+        return _Sum;
+    }
+
+    template <class _Ty>
+    unsigned long long _Accumulate_1(const void* _First, const void* const _Last) noexcept {
+        // psadbw sums unsigned bytes into 64-bit lanes; signed bytes are biased by 0x80 first, and the bias is removed
+        // from the result
+        constexpr bool _Signed  = static_cast<_Ty>(-1) < 0;
+        constexpr char _Bias    = _Signed ? static_cast<char>(0x80) : 0;
+        size_t _Size_bytes      = _Byte_length(_First, _Last);
+        unsigned long long _Sum = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Bias_vec = _mm256_set1_epi8(_Bias);
+            __m256i _Acc            = _mm256_setzero_si256();
+            const void* _Stop_at    = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                const __m256i _Data =
+                    _mm256_xor_si256(_mm256_loadu_si256(static_cast<const __m256i*>(_First)), _Bias_vec);
+                _Acc = _mm256_add_epi64(_Acc, _mm256_sad_epu8(_Data, _mm256_setzero_si256()));
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Sum = _Sum_epi64(_Acc);
+            if constexpr (_Signed) {
+                _Sum -= 0x80 * static_cast<unsigned long long>(_Size_bytes & ~size_t{0x1F});
+            }
+
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            const __m128i _Bias_vec = _mm_set1_epi8(_Bias);
+            __m128i _Acc            = _mm_setzero_si128();
+            const void* _Stop_at    = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                const __m128i _Data = _mm_xor_si128(_mm_loadu_si128(static_cast<const __m128i*>(_First)), _Bias_vec);
+                _Acc                = _mm_add_epi64(_Acc, _mm_sad_epu8(_Data, _mm_setzero_si128()));
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+            if constexpr (_Signed) {
+                _Sum -= 0x80 * static_cast<unsigned long long>(_Size_bytes & ~size_t{0xF});
+            }
+        }
+
+        return _Accumulate_tail<_Ty>(_First, _Last, _Sum);
+    }
+
+    template <class _Ty>
+    unsigned long long _Accumulate_2(const void* _First, const void* const _Last) noexcept {
+        // pmaddwd sums pairs of signed elements into 32-bit lanes, which are widened after each block of 2^14 vectors
+        // so that they can't overflow; unsigned elements are biased by 0x8000 first, and the bias is added back
+        constexpr bool _Signed        = static_cast<_Ty>(-1) < 0;
+        constexpr short _Bias         = _Signed ? 0 : static_cast<short>(0x8000);
+        constexpr size_t _Block_count = size_t{1} << 14;
+        size_t _Size_bytes            = _Byte_length(_First, _Last);
+        unsigned long long _Sum       = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Bias_vec = _mm256_set1_epi16(_Bias);
+            const __m256i _Ones     = _mm256_set1_epi16(1);
+            __m256i _Acc            = _mm256_setzero_si256();
+            const void* _Stop_at    = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                const void* _Block_stop = _Stop_at;
+                if (_Byte_length(_First, _Stop_at) > _Block_count * 32) {
+                    _Block_stop = _First;
+                    _Advance_bytes(_Block_stop, _Block_count * 32);
+                }
+
+                __m256i _Acc_32 = _mm256_setzero_si256();
+                do {
+                    const __m256i _Data =
+                        _mm256_xor_si256(_mm256_loadu_si256(static_cast<const __m256i*>(_First)), _Bias_vec);
+                    _Acc_32 = _mm256_add_epi32(_Acc_32, _mm256_madd_epi16(_Data, _Ones));
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Block_stop);
+
+                _Acc = _Add_widened_epi32<true>(_Acc, _Acc_32);
+            } while (_First != _Stop_at);
+
+            _Sum = _Sum_epi64(_Acc);
+            if constexpr (!_Signed) {
+                _Sum += 0x8000 * static_cast<unsigned long long>((_Size_bytes & ~size_t{0x1F}) / 2);
+            }
+
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            // at most one 16-byte vector remains after the AVX2 loop, and otherwise the whole range is done in blocks
+            const __m128i _Bias_vec = _mm_set1_epi16(_Bias);
+            const __m128i _Ones     = _mm_set1_epi16(1);
+            __m128i _Acc            = _mm_setzero_si128();
+            const void* _Stop_at    = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                const void* _Block_stop = _Stop_at;
+                if (_Byte_length(_First, _Stop_at) > _Block_count * 16) {
+                    _Block_stop = _First;
+                    _Advance_bytes(_Block_stop, _Block_count * 16);
+                }
+
+                __m128i _Acc_32 = _mm_setzero_si128();
+                do {
+                    const __m128i _Data =
+                        _mm_xor_si128(_mm_loadu_si128(static_cast<const __m128i*>(_First)), _Bias_vec);
+                    _Acc_32 = _mm_add_epi32(_Acc_32, _mm_madd_epi16(_Data, _Ones));
+                    _Advance_bytes(_First, 16);
+                } while (_First != _Block_stop);
+
+                _Acc = _Add_widened_epi32<true>(_Acc, _Acc_32);
+            } while (_First != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+            if constexpr (!_Signed) {
+                _Sum += 0x8000 * static_cast<unsigned long long>((_Size_bytes & ~size_t{0xF}) / 2);
+            }
+        }
+
+        return _Accumulate_tail<_Ty>(_First, _Last, _Sum);
+    }
+
+    template <class _Ty>
+    unsigned long long _Accumulate_4(const void* _First, const void* const _Last) noexcept {
+        constexpr bool _Signed  = static_cast<_Ty>(-1) < 0;
+        size_t _Size_bytes      = _Byte_length(_First, _Last);
+        unsigned long long _Sum = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            __m256i _Acc         = _mm256_setzero_si256();
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                _Acc = _Add_widened_epi32<_Signed>(_Acc, _mm256_loadu_si256(static_cast<const __m256i*>(_First)));
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Sum = _Sum_epi64(_Acc);
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            __m128i _Acc         = _mm_setzero_si128();
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                _Acc = _Add_widened_epi32<_Signed>(_Acc, _mm_loadu_si128(static_cast<const __m128i*>(_First)));
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+        }
+
+        return _Accumulate_tail<_Ty>(_First, _Last, _Sum);
+    }
+
+    unsigned long long _Accumulate_8(const void* _First, const void* const _Last) noexcept {
+        // two accumulators, so that consecutive additions don't wait for each other
+        size_t _Size_bytes      = _Byte_length(_First, _Last);
+        unsigned long long _Sum = 0;
+
+        if (_Size_bytes >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            __m256i _Acc0        = _mm256_setzero_si256();
+            __m256i _Acc1        = _mm256_setzero_si256();
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x3F});
+            do {
+                _Acc0 = _mm256_add_epi64(_Acc0, _mm256_loadu_si256(static_cast<const __m256i*>(_First)));
+                _Acc1 = _mm256_add_epi64(_Acc1, _mm256_loadu_si256(static_cast<const __m256i*>(_First) + 1));
+                _Advance_bytes(_First, 64);
+            } while (_First != _Stop_at);
+
+            _Sum = _Sum_epi64(_mm256_add_epi64(_Acc0, _Acc1));
+            _Size_bytes &= 0x3F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            __m128i _Acc         = _mm_setzero_si128();
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                _Acc = _mm_add_epi64(_Acc, _mm_loadu_si128(static_cast<const __m128i*>(_First)));
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+        }
+
+        return _Accumulate_tail<unsigned long long>(_First, _Last, _Sum);
+    }
+
+    template <class _Ty>
+    unsigned long long _Inner_product_4(const void* _First1, const void* const _Last1, const void* _First2) noexcept {
+        // the products are truncated to 32 bits, like those of the promoted 4-byte elements, before being widened
+        constexpr bool _Signed  = static_cast<_Ty>(-1) < 0;
+        size_t _Size_bytes      = _Byte_length(_First1, _Last1);
+        unsigned long long _Sum = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            __m256i _Acc         = _mm256_setzero_si256();
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                const __m256i _Product = _mm256_mullo_epi32(_mm256_loadu_si256(static_cast<const __m256i*>(_First1)),
+                    _mm256_loadu_si256(static_cast<const __m256i*>(_First2)));
+                _Acc                   = _Add_widened_epi32<_Signed>(_Acc, _Product);
+                _Advance_bytes(_First1, 32);
+                _Advance_bytes(_First2, 32);
+            } while (_First1 != _Stop_at);
+
+            _Sum = _Sum_epi64(_Acc);
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) { // pmulld is SSE4.1
+            __m128i _Acc         = _mm_setzero_si128();
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                const __m128i _Product = _mm_mullo_epi32(_mm_loadu_si128(static_cast<const __m128i*>(_First1)),
+                    _mm_loadu_si128(static_cast<const __m128i*>(_First2)));
+                _Acc                   = _Add_widened_epi32<_Signed>(_Acc, _Product);
+                _Advance_bytes(_First1, 16);
+                _Advance_bytes(_First2, 16);
+            } while (_First1 != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+        }
+
+        auto _Ptr2 = static_cast<const _Ty*>(_First2);
+        for (auto _Ptr1 = static_cast<const _Ty*>(_First1); _Ptr1 != _Last1; ++_Ptr1, (void) ++_Ptr2) {
+            const auto _Product =
+                static_cast<_Ty>(static_cast<unsigned long>(*_Ptr1) * static_cast<unsigned long>(*_Ptr2));
+            _Sum += static_cast<unsigned long long>(_Product);
+        }
+
+        return _Sum;
+    }
+
+    unsigned long long _Inner_product_8(const void* _First1, const void* const _Last1, const void* _First2) noexcept {
+        size_t _Size_bytes      = _Byte_length(_First1, _Last1);
+        unsigned long long _Sum = 0;
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            __m256i _Acc         = _mm256_setzero_si256();
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                _Acc = _mm256_add_epi64(_Acc, _Mullo_epi64(_mm256_loadu_si256(static_cast<const __m256i*>(_First1)),
+                                                  _mm256_loadu_si256(static_cast<const __m256i*>(_First2))));
+                _Advance_bytes(_First1, 32);
+                _Advance_bytes(_First2, 32);
+            } while (_First1 != _Stop_at);
+
+            _Sum = _Sum_epi64(_Acc);
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            __m128i _Acc         = _mm_setzero_si128();
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                _Acc = _mm_add_epi64(_Acc, _Mullo_epi64(_mm_loadu_si128(static_cast<const __m128i*>(_First1)),
+                                               _mm_loadu_si128(static_cast<const __m128i*>(_First2))));
+                _Advance_bytes(_First1, 16);
+                _Advance_bytes(_First2, 16);
+            } while (_First1 != _Stop_at);
+
+            _Sum += _Sum_epi64(_Acc);
+        }
+
+        auto _Ptr2 = static_cast<const unsigned long long*>(_First2);
+        for (auto _Ptr1 = static_cast<const unsigned long long*>(_First1); _Ptr1 != _Last1; ++_Ptr1, (void) ++_Ptr2) {
+            _Sum += *_Ptr1 * *_Ptr2;
+        }
+
+        return _Sum;
+    }
+
+    struct _Numeric_traits_1 {
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi8(_Lhs, _Rhs);
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi8(_Lhs, _Rhs);
+        }
+
+        static __m256i _Ramp_avx() noexcept { // 0, 1, 2, ... in the lanes from the lowest
+            return _mm256_set_epi8(31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+                10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        }
+
+        static __m128i _Ramp_sse() noexcept {
+            return _mm_set_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        }
+    };
+
+    struct _Numeric_traits_2 {
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi16(_Lhs, _Rhs);
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi16(_Lhs, _Rhs);
+        }
+
+        static __m256i _Ramp_avx() noexcept {
+            return _mm256_set_epi16(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        }
+
+        static __m128i _Ramp_sse() noexcept {
+            return _mm_set_epi16(7, 6, 5, 4, 3, 2, 1, 0);
+        }
+    };
+
+    struct _Numeric_traits_4 {
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Ramp_avx() noexcept {
+            return _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        }
+
+        static __m128i _Ramp_sse() noexcept {
+            return _mm_set_epi32(3, 2, 1, 0);
+        }
+    };
+
+    struct _Numeric_traits_8 {
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi64(_Lhs, _Rhs);
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi64(_Lhs, _Rhs);
+        }
+
+        static __m256i _Ramp_avx() noexcept {
+            return _mm256_set_epi64x(3, 2, 1, 0);
+        }
+
+        static __m128i _Ramp_sse() noexcept {
+            return _mm_set_epi64x(1, 0);
+        }
+    };
+
+    template <class _Find_traits, class _Traits, class _Ty>
+    void _Iota_impl(void* _First, void* const _Last, _Ty _Val) noexcept {
+        // stores _Val, _Val + 1, ... modulo 2^N, continuing each vector from the previous one
+        size_t _Size_bytes = _Byte_length(_First, _Last);
+
+        if (_Size_bytes >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Step  = _Find_traits::_Set_avx(static_cast<_Ty>(32 / sizeof(_Ty)));
+            __m256i _Data        = _Traits::_Add_avx(_Find_traits::_Set_avx(_Val), _Traits::_Ramp_avx());
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0x1F});
+            do {
+                _mm256_storeu_si256(static_cast<__m256i*>(_First), _Data);
+                _Data = _Traits::_Add_avx(_Data, _Step);
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+
+            _Val = static_cast<_Ty>(_Val + (_Size_bytes & ~size_t{0x1F}) / sizeof(_Ty));
+            _Size_bytes &= 0x1F;
+        }
+
+        if (_Size_bytes >= 16 && _Find_traits_1::_Sse_available()) {
+            const __m128i _Step  = _Find_traits::_Set_sse(static_cast<_Ty>(16 / sizeof(_Ty)));
+            __m128i _Data        = _Traits::_Add_sse(_Find_traits::_Set_sse(_Val), _Traits::_Ramp_sse());
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~size_t{0xF});
+            do {
+                _mm_storeu_si128(static_cast<__m128i*>(_First), _Data);
+                _Data = _Traits::_Add_sse(_Data, _Step);
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+
+            _Val = static_cast<_Ty>(_Val + (_Size_bytes & ~size_t{0xF}) / sizeof(_Ty));
+        }
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            *_Ptr = _Val;
+            _Val  = static_cast<_Ty>(_Val + 1);
+        }
+    }
+
+    template <class _Traits, class _Ty>
+    void _Adjacent_difference_impl(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+        // works from the back, so that each difference is stored only after every load of the elements at and after it;
+        // this allows _Dest == _First
+        const auto _Src     = static_cast<const _Ty*>(_First);
+        const auto _Out     = static_cast<_Ty*>(_Dest);
+        const size_t _Count = static_cast<size_t>(static_cast<const _Ty*>(_Last) - _Src);
+        if (_Count == 0) {
+            return;
+        }
+
+        size_t _Idx = _Count; // the differences at [_Idx, _Count) are done
+        if (_Count > 32 / sizeof(_Ty) && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            constexpr size_t _Lanes = 32 / sizeof(_Ty);
+            do {
+                _Idx -= _Lanes;
+                const __m256i _Cur  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Idx));
+                const __m256i _Prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Idx - 1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out + _Idx), _Traits::_Sub_avx(_Cur, _Prev));
+            } while (_Idx > _Lanes);
+        }
+
+        if (_Idx > 16 / sizeof(_Ty) && _Find_traits_1::_Sse_available()) {
+            constexpr size_t _Lanes = 16 / sizeof(_Ty);
+            do {
+                _Idx -= _Lanes;
+                const __m128i _Cur  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Idx));
+                const __m128i _Prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Idx - 1));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Idx), _Traits::_Sub_sse(_Cur, _Prev));
+            } while (_Idx > _Lanes);
+        }
+
+        for (; _Idx > 1; --_Idx) {
+            _Out[_Idx - 1] = static_cast<_Ty>(_Src[_Idx - 1] - _Src[_Idx - 2]);
+        }
+
+        _Out[0] = _Src[0];
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) unsigned long long __cdecl __std_accumulate_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Signed ? _Accumulate_1<signed char>(_First, _Last) : _Accumulate_1<unsigned char>(_First, _Last);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_accumulate_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Signed ? _Accumulate_2<short>(_First, _Last) : _Accumulate_2<unsigned short>(_First, _Last);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_accumulate_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Signed ? _Accumulate_4<long>(_First, _Last) : _Accumulate_4<unsigned long>(_First, _Last);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_accumulate_8(
+    const void* const _First, const void* const _Last) noexcept {
+    return _Accumulate_8(_First, _Last);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_inner_product_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const bool _Signed) noexcept {
+    return _Signed ? _Inner_product_4<long>(_First1, _Last1, _First2)
+                   : _Inner_product_4<unsigned long>(_First1, _Last1, _First2);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_inner_product_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    return _Inner_product_8(_First1, _Last1, _First2);
+}
+
+__declspec(noalias) void __cdecl __std_iota_1(
+    void* const _First, void* const _Last, const unsigned char _Val) noexcept {
+    _Iota_impl<_Find_traits_1, _Numeric_traits_1>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_iota_2(
+    void* const _First, void* const _Last, const unsigned short _Val) noexcept {
+    _Iota_impl<_Find_traits_2, _Numeric_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_iota_4(
+    void* const _First, void* const _Last, const unsigned long _Val) noexcept {
+    _Iota_impl<_Find_traits_4, _Numeric_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_iota_8(
+    void* const _First, void* const _Last, const unsigned long long _Val) noexcept {
+    _Iota_impl<_Find_traits_8, _Numeric_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_adjacent_difference_1(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Adjacent_difference_impl<_Numeric_traits_1, unsigned char>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __cdecl __std_adjacent_difference_2(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Adjacent_difference_impl<_Numeric_traits_2, unsigned short>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __cdecl __std_adjacent_difference_4(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Adjacent_difference_impl<_Numeric_traits_4, unsigned long>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __cdecl __std_adjacent_difference_8(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Adjacent_difference_impl<_Numeric_traits_8, unsigned long long>(_First, _Last, _Dest);
+}
 } // extern "C"
 
 #endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
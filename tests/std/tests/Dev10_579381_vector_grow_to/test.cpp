@@ -7,6 +7,14 @@
 
 using namespace std;
 
+bool grown_to(const vector<int>& v, const size_t expected) {
+#if _HAS_CXX23 // geometric growth, plus any elements that allocate_at_least fits into the rest of the heap block
+    return v.capacity() >= expected && (v.capacity() - expected) * sizeof(int) < __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else // ^^^ _HAS_CXX23 / !_HAS_CXX23 vvv
+    return v.capacity() == expected;
+#endif // ^^^ !_HAS_CXX23 ^^^
+}
+
 int main() {
     {
         vector<int> v(1000, 1729);
@@ -17,7 +25,7 @@ int main() {
         v.resize(1003);
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -29,7 +37,7 @@ int main() {
         v.resize(8000);
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
     }
 
     {
@@ -41,7 +49,7 @@ int main() {
         v.push_back(47);
 
         assert(v.size() == 1001);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -55,7 +63,7 @@ int main() {
         v.insert(v.end(), l.begin(), l.end());
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -69,7 +77,7 @@ int main() {
         v.insert(v.end(), l.begin(), l.end());
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
     }
 
     {
@@ -81,7 +89,7 @@ int main() {
         v.insert(v.end(), 3, 47);
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -93,6 +101,6 @@ int main() {
         v.insert(v.end(), 7000, 47);
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
     }
 }
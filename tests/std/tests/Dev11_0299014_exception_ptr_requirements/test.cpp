@@ -14,6 +14,22 @@ exception_ptr rvalue() {
 
 void observe(const exception_ptr&) {}
 
+int live_counted = 0;
+
+struct counted {
+    counted() noexcept {
+        ++live_counted;
+    }
+
+    counted(const counted&) noexcept {
+        ++live_counted;
+    }
+
+    ~counted() {
+        --live_counted;
+    }
+};
+
 int main() {
     {
         exception_ptr ep1; // DefaultConstructible
@@ -169,6 +185,47 @@ int main() {
         assert(b == BB);
     }
 
+    {
+        // copies share the exception object, which is destroyed with the last of them
+        exception_ptr a = make_exception_ptr(counted{});
+        assert(live_counted == 1);
+
+        exception_ptr b = a;
+        exception_ptr c;
+        c = b;
+        assert(live_counted == 1);
+        assert(a == b && b == c);
+
+        exception_ptr d = static_cast<exception_ptr&&>(c);
+        assert(!c);
+        assert(d == a);
+
+        c = static_cast<exception_ptr&&>(d);
+        assert(!d);
+        assert(c == a);
+
+        exception_ptr& self = a;
+        a                   = self;
+        a                   = static_cast<exception_ptr&&>(self);
+        assert(a == c);
+
+        a = nullptr;
+        b = exception_ptr{};
+        assert(live_counted == 1);
+        c = d;
+        assert(live_counted == 0);
+
+        try {
+            rethrow_exception(make_exception_ptr(counted{}));
+        } catch (const counted&) {
+            assert(live_counted >= 1);
+            exception_ptr current = current_exception();
+            assert(current);
+        }
+
+        assert(live_counted == 0);
+    }
+
     {
         // Also test DevDiv-1210471 "std::rethrow_exception is not [[noreturn]]".
 
@@ -0,0 +1,207 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes large enough to take the parallel path, with odd element counts and offsets so that the
+// page-aligned chunk boundaries don't line up with the static partition
+const size_t largeSizes[] = {(1U << 18) + 7, (1U << 20) + 4093};
+
+template <template <class...> class Container>
+void test_case_copy_parallel(const size_t testSize) {
+    Container<unsigned int> input(testSize);
+    iota(input.begin(), input.end(), 0U);
+    const vector<unsigned int> expected(input.begin(), input.end());
+
+    vector<unsigned int> dest(testSize + 1);
+    assert(copy(par, input.begin(), input.end(), dest.begin() + 1) == dest.end());
+    assert(equal(dest.begin() + 1, dest.end(), expected.begin(), expected.end()));
+
+    fill(dest.begin(), dest.end(), 0U);
+    assert(copy_n(par, input.begin(), testSize, dest.begin()) == dest.end() - 1);
+    assert(equal(dest.begin(), dest.end() - 1, expected.begin(), expected.end()));
+    assert(dest.back() == 0U);
+
+    fill(dest.begin(), dest.end(), 0U);
+    assert(move(par, input.begin(), input.end(), dest.begin()) == dest.end() - 1);
+    assert(equal(dest.begin(), dest.end() - 1, expected.begin(), expected.end()));
+
+    assert(fill_n(par, dest.begin(), testSize, 42U) == dest.end() - 1);
+    assert(count(dest.begin(), dest.end() - 1, 42U) == static_cast<ptrdiff_t>(testSize));
+    fill(par, dest.begin(), dest.end(), 7U);
+    assert(count(dest.begin(), dest.end(), 7U) == static_cast<ptrdiff_t>(testSize + 1));
+}
+
+void test_case_large_trivial() {
+    for (const size_t testSize : largeSizes) {
+        vector<unsigned char> bytesIn(testSize);
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            bytesIn[idx] = static_cast<unsigned char>(idx * 31);
+        }
+
+        vector<unsigned char> bytesOut(testSize + 3);
+        assert(copy(par, bytesIn.begin(), bytesIn.end(), bytesOut.begin() + 3) == bytesOut.end());
+        assert(equal(bytesIn.begin(), bytesIn.end(), bytesOut.begin() + 3));
+
+        vector<long long> input(testSize);
+        iota(input.begin(), input.end(), 0LL);
+        vector<long long> dest(testSize + 1, -1);
+        assert(copy(par, input.cbegin(), input.cend(), dest.data() + 1) == dest.data() + dest.size());
+        assert(dest[0] == -1);
+        assert(equal(input.begin(), input.end(), dest.begin() + 1));
+
+        assert(copy_n(par, input.data(), testSize, dest.begin()) == dest.end() - 1);
+        assert(equal(input.begin(), input.end(), dest.begin()));
+
+        fill(par, dest.begin(), dest.end(), 0LL);
+        assert(all_of(dest.begin(), dest.end(), [](long long x) { return x == 0; }));
+        fill(par, dest.data() + 1, dest.data() + dest.size(), 5LL);
+        assert(dest[0] == 0);
+        assert(all_of(dest.begin() + 1, dest.end(), [](long long x) { return x == 5; }));
+        assert(fill_n(par, dest.begin(), testSize, -3LL) == dest.end() - 1);
+        assert(count(dest.begin(), dest.end(), -3LL) == static_cast<ptrdiff_t>(testSize));
+        assert(dest.back() == 5);
+
+        assert(swap_ranges(par, input.begin(), input.end(), dest.begin()) == dest.end() - 1);
+        assert(all_of(input.begin(), input.end(), [](long long x) { return x == -3; }));
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            assert(dest[idx] == static_cast<long long>(idx));
+        }
+
+        atomic<long long> calls{0};
+        generate(par, input.begin(), input.end(), [&calls] { return ++calls; });
+        assert(calls.load() == static_cast<long long>(testSize));
+        sort(input.begin(), input.end());
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            assert(input[idx] == static_cast<long long>(idx + 1));
+        }
+
+        assert(generate_n(par, dest.begin(), testSize, [] { return 9LL; }) == dest.end() - 1);
+        assert(count(dest.begin(), dest.end(), 9LL) == static_cast<ptrdiff_t>(testSize));
+    }
+}
+
+void test_case_large_nontrivial() {
+    for (const size_t testSize : largeSizes) {
+        vector<string> input(testSize / 16);
+        for (size_t idx = 0; idx < input.size(); ++idx) {
+            input[idx] = to_string(idx);
+        }
+
+        vector<string> dest(input.size());
+        assert(copy(par, input.begin(), input.end(), dest.begin()) == dest.end());
+        assert(dest == input);
+
+        vector<string> moved(input.size());
+        assert(move(par, dest.begin(), dest.end(), moved.begin()) == moved.end());
+        assert(moved == input);
+
+        fill(par, dest.begin(), dest.end(), string("x"));
+        assert(all_of(dest.begin(), dest.end(), [](const string& s) { return s == "x"; }));
+    }
+}
+
+template <class T>
+struct raw_buffer {
+    explicit raw_buffer(const size_t n) : storage(allocator<T>{}.allocate(n)), size(n) {}
+    raw_buffer(const raw_buffer&) = delete;
+    raw_buffer& operator=(const raw_buffer&) = delete;
+    ~raw_buffer() {
+        allocator<T>{}.deallocate(storage, size);
+    }
+
+    T* begin() const {
+        return storage;
+    }
+
+    T* end() const {
+        return storage + size;
+    }
+
+    T* storage;
+    size_t size;
+};
+
+void test_case_uninitialized() {
+    for (const size_t testSize : largeSizes) {
+        vector<int> input(testSize);
+        iota(input.begin(), input.end(), 0);
+
+        {
+            raw_buffer<int> buf(testSize);
+            assert(uninitialized_copy(par, input.begin(), input.end(), buf.begin()) == buf.end());
+            assert(equal(input.begin(), input.end(), buf.begin()));
+            assert(uninitialized_copy_n(par, input.begin(), testSize, buf.begin()) == buf.end());
+            assert(equal(input.begin(), input.end(), buf.begin()));
+            assert(uninitialized_move(par, input.begin(), input.end(), buf.begin()) == buf.end());
+            assert(equal(input.begin(), input.end(), buf.begin()));
+            const auto movedN = uninitialized_move_n(par, input.begin(), testSize, buf.begin());
+            assert(movedN.first == input.end());
+            assert(movedN.second == buf.end());
+            uninitialized_fill(par, buf.begin(), buf.end(), 17);
+            assert(all_of(buf.begin(), buf.end(), [](int x) { return x == 17; }));
+            assert(uninitialized_fill_n(par, buf.begin() + 1, testSize - 1, 4) == buf.end());
+            assert(buf.begin()[0] == 17);
+            assert(all_of(buf.begin() + 1, buf.end(), [](int x) { return x == 4; }));
+            uninitialized_value_construct(par, buf.begin(), buf.end());
+            assert(all_of(buf.begin(), buf.end(), [](int x) { return x == 0; }));
+            uninitialized_fill(par, buf.begin(), buf.end(), 1);
+            assert(uninitialized_value_construct_n(par, buf.begin(), testSize) == buf.end());
+            assert(all_of(buf.begin(), buf.end(), [](int x) { return x == 0; }));
+            uninitialized_default_construct(par, buf.begin(), buf.end());
+            assert(uninitialized_default_construct_n(par, buf.begin(), testSize) == buf.end());
+        }
+
+        {
+            const size_t stringCount = testSize / 16;
+            vector<string> strings(stringCount);
+            for (size_t idx = 0; idx < stringCount; ++idx) {
+                strings[idx] = to_string(idx);
+            }
+
+            raw_buffer<string> buf(stringCount);
+            assert(uninitialized_copy(par, strings.begin(), strings.end(), buf.begin()) == buf.end());
+            assert(equal(strings.begin(), strings.end(), buf.begin()));
+            destroy(buf.begin(), buf.end());
+
+            uninitialized_value_construct(par, buf.begin(), buf.end());
+            assert(all_of(buf.begin(), buf.end(), [](const string& s) { return s.empty(); }));
+            destroy(buf.begin(), buf.end());
+
+            uninitialized_default_construct_n(par, buf.begin(), stringCount);
+            assert(all_of(buf.begin(), buf.end(), [](const string& s) { return s.empty(); }));
+            destroy(buf.begin(), buf.end());
+
+            uninitialized_fill_n(par, buf.begin(), stringCount, string("abc"));
+            assert(all_of(buf.begin(), buf.end(), [](const string& s) { return s == "abc"; }));
+            destroy(buf.begin(), buf.end());
+        }
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_copy_parallel<vector>);
+    parallel_test_case(test_case_copy_parallel<deque>);
+    parallel_test_case(test_case_copy_parallel<list>);
+    parallel_test_case(test_case_copy_parallel<forward_list>);
+    test_case_large_trivial();
+    test_case_large_nontrivial();
+    test_case_uninitialized();
+}
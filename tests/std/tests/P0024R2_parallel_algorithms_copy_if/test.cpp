@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <template <class...> class Container>
+void test_case_copy_if_parallel(const size_t testSize, mt19937& gen) {
+    // keep none, about 1 in 3, about 2 in 3, and all of the elements
+    for (const unsigned int keepThreshold : {0U, 1U, 2U, 3U}) {
+        const auto keep = [keepThreshold](unsigned int x) { return x % 3 < keepThreshold; };
+        Container<unsigned int> input(testSize);
+        generate(input.begin(), input.end(), ref(gen));
+
+        vector<unsigned int> expected;
+        vector<unsigned int> expectedFalse;
+        partition_copy(input.begin(), input.end(), back_inserter(expected), back_inserter(expectedFalse), keep);
+
+        vector<unsigned int> dest(testSize);
+        const auto destEnd = copy_if(par, input.begin(), input.end(), dest.begin(), keep);
+        assert(equal(dest.begin(), destEnd, expected.begin(), expected.end()));
+
+        vector<unsigned int> destTrue(testSize);
+        deque<unsigned int> destFalse(testSize);
+        const auto results =
+            partition_copy(par, input.begin(), input.end(), destTrue.begin(), destFalse.begin(), keep);
+        assert(equal(destTrue.begin(), results.first, expected.begin(), expected.end()));
+        assert(equal(destFalse.begin(), results.second, expectedFalse.begin(), expectedFalse.end()));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_parallel<vector>, gen);
+    parallel_test_case(test_case_copy_if_parallel<deque>, gen);
+    parallel_test_case(test_case_copy_if_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_parallel<forward_list>, gen);
+}
@@ -206,6 +206,49 @@ void test_case_inclusive_scan_init_writes_intermediate_type() {
     inclusive_scan(par, begin(input), end(input), output, typesBop{}, intermediateType{0});
 }
 
+// x -> a * x + b (mod 2^32); composition is associative but not commutative, and affine is trivially copyable
+struct affine {
+    unsigned int a;
+    unsigned int b;
+
+    friend bool operator==(const affine& lhs, const affine& rhs) {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+struct compose {
+    affine operator()(const affine& first, const affine& second) const {
+        return {second.a * first.a, second.a * first.b + second.b};
+    }
+};
+
+void test_case_inclusive_scan_parallel_large(mt19937& gen) {
+    // large enough to be split into many cache-sized chunks
+    for (const size_t testSize : {size_t{100'003}, size_t{1'000'003}}) {
+        vector<affine> s(testSize);
+        for (auto& x : s) {
+            x = {static_cast<unsigned int>(gen() | 1U), static_cast<unsigned int>(gen())};
+        }
+
+        vector<affine> expected(testSize);
+        inclusive_scan(s.begin(), s.end(), expected.begin(), compose{});
+        vector<affine> d(testSize);
+        assert(d.end() == inclusive_scan(par, s.begin(), s.end(), d.begin(), compose{}));
+        assert(d == expected);
+
+        inclusive_scan(par, s.begin(), s.end(), s.begin(), compose{}); // in place
+        assert(s == expected);
+
+        vector<unsigned int> u(testSize);
+        generate(u.begin(), u.end(), ref(gen));
+        vector<unsigned int> uExpected(testSize);
+        inclusive_scan(u.begin(), u.end(), uExpected.begin());
+        vector<unsigned int> uActual(testSize);
+        inclusive_scan(par, u.begin(), u.end(), uActual.begin());
+        assert(uActual == uExpected);
+    }
+}
+
 int main() {
     mt19937 gen(1729);
 
@@ -217,4 +260,5 @@ int main() {
     parallel_test_case(test_case_inclusive_scan_bop_init_parallel_associative);
     parallel_test_case(test_case_inclusive_scan_bop_init_parallel_associative_in_place);
     test_case_inclusive_scan_init_writes_intermediate_type();
+    test_case_inclusive_scan_parallel_large(gen);
 }
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class Container1, class Container2, class... Pred>
+void check_lex(const Container1& left, const Container2& right, const Pred&... pred) {
+    assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end(), pred...)
+           == lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(), pred...));
+    assert(lexicographical_compare(par, right.begin(), right.end(), left.begin(), left.end(), pred...)
+           == lexicographical_compare(right.begin(), right.end(), left.begin(), left.end(), pred...));
+}
+
+template <class Container>
+void test_case_lexicographical_compare_parallel(const size_t testSize) {
+    Container left(testSize, 'a');
+    Container right(testSize, 'a');
+    check_lex(left, right);
+    check_lex(left, right, greater<>{});
+    assert(!lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+
+    // one range is a prefix of the other
+    Container longer(testSize + 1, 'a');
+    check_lex(left, longer);
+    assert(lexicographical_compare(par, left.begin(), left.end(), longer.begin(), longer.end()));
+    assert(!lexicographical_compare(par, longer.begin(), longer.end(), left.begin(), left.end()));
+
+    // a difference at each position; the earliest difference decides, even when later ones disagree
+    auto leftIt = left.begin();
+    for (size_t idx = 0; idx < testSize; ++idx, ++leftIt) {
+        *leftIt = 'b';
+        check_lex(left, right);
+        check_lex(left, right, greater<>{});
+        assert(!lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+        *leftIt = 'a';
+
+        if (idx % 7 == 0) {
+            *leftIt = 'Z';
+            auto laterIt = leftIt;
+            if (++laterIt != left.end()) {
+                *laterIt = 'z';
+            }
+
+            assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+            check_lex(left, right);
+            *leftIt = 'a';
+            if (laterIt != left.end()) {
+                *laterIt = 'a';
+            }
+        }
+    }
+}
+
+struct case_insensitive_less {
+    bool operator()(const char lhs, const char rhs) const {
+        return (lhs | 0x20) < (rhs | 0x20);
+    }
+};
+
+void test_case_predicate_equivalence(const size_t testSize) {
+    // equivalent but unequal elements must not end the comparison early
+    const case_insensitive_less pred{};
+    string lower(testSize, 'q');
+    string upper(testSize, 'Q');
+    check_lex(lower, upper, pred);
+    assert(!lexicographical_compare(par, lower.begin(), lower.end(), upper.begin(), upper.end(), pred));
+    if (testSize != 0) {
+        upper.back() = 'R';
+        assert(lexicographical_compare(par, lower.begin(), lower.end(), upper.begin(), upper.end(), pred));
+    }
+}
+
+void test_case_large_bytes() {
+    // big enough for every worker to get chunks, with differences near either end
+    const size_t testSize = 1'000'003;
+    vector<unsigned char> left(testSize, 0x55);
+    vector<unsigned char> right(testSize, 0x55);
+    for (const size_t idx : {size_t{0}, size_t{1}, testSize / 2, testSize - 2, testSize - 1}) {
+        right[idx] = 0x56;
+        assert(lexicographical_compare(par, left.begin(), left.end(), right.begin(), right.end()));
+        assert(!lexicographical_compare(par, right.begin(), right.end(), left.begin(), left.end()));
+        assert(mismatch(par, left.begin(), left.end(), right.begin(), right.end()).first == left.begin() + idx);
+        right[idx] = 0x55;
+    }
+
+    vector<int> leftInts(testSize, -1);
+    vector<int> rightInts(testSize, -1);
+    rightInts[testSize / 3] = 1;
+    assert(lexicographical_compare(par, leftInts.begin(), leftInts.end(), rightInts.begin(), rightInts.end()));
+    assert(!lexicographical_compare(
+        par, leftInts.begin(), leftInts.end(), rightInts.begin(), rightInts.end(), greater<>{}));
+}
+
+int main() {
+    parallel_test_case(test_case_lexicographical_compare_parallel<vector<char>>);
+    parallel_test_case(test_case_lexicographical_compare_parallel<list<char>>);
+    parallel_test_case(test_case_lexicographical_compare_parallel<forward_list<char>>);
+    parallel_test_case(test_case_predicate_equivalence);
+    test_case_large_bytes();
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// elements are (key, origin) pairs compared by key only, so that the tests can observe stability
+using elem = pair<size_t, size_t>;
+
+struct key_less {
+    bool operator()(const elem& lhs, const elem& rhs) const {
+        return lhs.first < rhs.first;
+    }
+};
+
+template <template <class...> class Container>
+void test_case_merge_parallel(const size_t testSize) {
+    // split testSize elements between the two inputs in several ways, with heavily repeated keys
+    for (const size_t keys : {size_t{1}, size_t{3}, testSize + 1}) {
+        for (const size_t size1 : {size_t{0}, testSize / 3, testSize / 2, testSize}) {
+            const size_t size2 = testSize - size1;
+            Container<elem> input1;
+            Container<elem> input2;
+            for (size_t i = 0; i < size1; ++i) {
+                input1.emplace_back(i * keys / (size1 + 1), i);
+            }
+
+            for (size_t i = 0; i < size2; ++i) {
+                input2.emplace_back(i * keys / (size2 + 1), size1 + i);
+            }
+
+            vector<elem> expected(testSize);
+            merge(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin(), key_less{});
+
+            Container<elem> actual(testSize);
+            assert(merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin(), key_less{})
+                   == actual.end());
+            assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+
+            Container<elem> inplace(input1.begin(), input1.end());
+            inplace.insert(inplace.end(), input2.begin(), input2.end());
+            inplace_merge(par, inplace.begin(), next(inplace.begin(), static_cast<ptrdiff_t>(size1)), inplace.end(),
+                key_less{});
+            assert(equal(inplace.begin(), inplace.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    // default comparison
+    vector<size_t> evens;
+    vector<size_t> odds;
+    for (size_t i = 0; i < testSize; ++i) {
+        (i % 2 == 0 ? evens : odds).push_back(i);
+    }
+
+    Container<size_t> merged(testSize);
+    assert(merge(par, evens.begin(), evens.end(), odds.begin(), odds.end(), merged.begin()) == merged.end());
+    assert(is_sorted(merged.begin(), merged.end()));
+
+    Container<size_t> inplace(evens.begin(), evens.end());
+    inplace.insert(inplace.end(), odds.begin(), odds.end());
+    inplace_merge(par, inplace.begin(), next(inplace.begin(), static_cast<ptrdiff_t>(evens.size())), inplace.end());
+    assert(equal(inplace.begin(), inplace.end(), merged.begin(), merged.end()));
+}
+
+void test_case_merge_forward_list(const size_t testSize) {
+    forward_list<size_t> input1;
+    forward_list<size_t> input2;
+    for (size_t i = testSize; i-- > 0;) {
+        (i % 3 == 0 ? input1 : input2).push_front(i);
+    }
+
+    forward_list<size_t> merged(testSize);
+    assert(merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), merged.begin()) == merged.end());
+    size_t expected = 0;
+    for (const auto& val : merged) {
+        assert(val == expected);
+        ++expected;
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_merge_parallel<vector>);
+    parallel_test_case(test_case_merge_parallel<deque>);
+    parallel_test_case(test_case_merge_parallel<list>);
+    parallel_test_case(test_case_merge_forward_list);
+}
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class Container>
+void assert_same_as_serial(const Container& c) {
+    assert(min_element(par, c.begin(), c.end()) == min_element(c.begin(), c.end()));
+    assert(min_element(par, c.begin(), c.end(), greater()) == min_element(c.begin(), c.end(), greater()));
+    assert(max_element(par, c.begin(), c.end()) == max_element(c.begin(), c.end()));
+    assert(max_element(par, c.begin(), c.end(), greater()) == max_element(c.begin(), c.end(), greater()));
+    assert(minmax_element(par, c.begin(), c.end()) == minmax_element(c.begin(), c.end()));
+    assert(minmax_element(par, c.begin(), c.end(), greater()) == minmax_element(c.begin(), c.end(), greater()));
+}
+
+template <template <class...> class Container>
+void test_case_min_max_element_parallel(const size_t testSize) {
+    // all equal; the first element is the smallest and largest, but minmax_element picks the last largest
+    Container<size_t> c(testSize, 0UL);
+    assert(min_element(par, c.begin(), c.end()) == c.begin());
+    assert(max_element(par, c.begin(), c.end()) == c.begin());
+    const auto allEqual = minmax_element(par, c.begin(), c.end());
+    assert(allEqual.first == c.begin());
+    if (testSize == 0) {
+        assert(allEqual.second == c.end());
+        return;
+    }
+
+    auto last = c.begin();
+    for (size_t i = 1; i < testSize; ++i) {
+        ++last;
+    }
+
+    assert(allEqual.second == last);
+
+    // [0,...,0,1,0,...,0] and [1,...,1,0,1,...,1], with the odd element placed at each index
+    for (auto& elem : c) {
+        elem = 1;
+        assert_same_as_serial(c);
+        elem = 0;
+    }
+
+    fill(c.begin(), c.end(), 1UL);
+    for (auto& elem : c) {
+        elem = 0;
+        assert_same_as_serial(c);
+        elem = 1;
+    }
+
+    // increasing and decreasing lists
+    iota(c.begin(), c.end(), 0UL);
+    assert(min_element(par, c.begin(), c.end()) == c.begin());
+    assert(max_element(par, c.begin(), c.end()) == last);
+    assert(minmax_element(par, c.begin(), c.end()) == make_pair(c.begin(), last));
+    assert_same_as_serial(c);
+
+    size_t val = testSize;
+    for (auto& elem : c) {
+        elem = val--;
+    }
+
+    assert(min_element(par, c.begin(), c.end()) == last);
+    assert(max_element(par, c.begin(), c.end()) == c.begin());
+    assert(minmax_element(par, c.begin(), c.end()) == make_pair(last, c.begin()));
+    assert_same_as_serial(c);
+
+    // repeating values, so that equivalent smallest and largest elements land in several chunks
+    size_t i = 0;
+    for (auto& elem : c) {
+        elem = i++ % 3;
+    }
+
+    assert_same_as_serial(c);
+}
+
+int main() {
+    parallel_test_case(test_case_min_max_element_parallel<vector>);
+    parallel_test_case(test_case_min_max_element_parallel<forward_list>);
+    parallel_test_case(test_case_min_max_element_parallel<list>);
+    parallel_test_case(test_case_min_max_element_parallel<deque>);
+}
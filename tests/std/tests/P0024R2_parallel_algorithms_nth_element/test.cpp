@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+void check_nth_element(const vector<size_t>& input, const size_t nth) {
+    vector<size_t> sorted(input);
+    sort(sorted.begin(), sorted.end());
+
+    vector<size_t> c(input);
+    nth_element(par, c.begin(), c.begin() + static_cast<ptrdiff_t>(nth), c.end());
+    if (nth == c.size()) {
+        assert(c == input);
+        return;
+    }
+
+    assert(c[nth] == sorted[nth]);
+    assert(all_of(c.begin(), c.begin() + static_cast<ptrdiff_t>(nth), [&](size_t x) { return x <= c[nth]; }));
+    assert(all_of(c.begin() + static_cast<ptrdiff_t>(nth), c.end(), [&](size_t x) { return x >= c[nth]; }));
+
+    c = input;
+    nth_element(par, c.begin(), c.begin() + static_cast<ptrdiff_t>(nth), c.end(), greater());
+    assert(c[nth] == sorted[sorted.size() - nth - 1]);
+}
+
+void check_partial_sort(const vector<size_t>& input, const size_t mid) {
+    vector<size_t> sorted(input);
+    sort(sorted.begin(), sorted.end());
+    const auto sortedMid = sorted.begin() + static_cast<ptrdiff_t>(mid);
+
+    vector<size_t> c(input);
+    partial_sort(par, c.begin(), c.begin() + static_cast<ptrdiff_t>(mid), c.end());
+    assert(equal(c.begin(), c.begin() + static_cast<ptrdiff_t>(mid), sorted.begin(), sortedMid));
+
+    vector<size_t> dest(mid);
+    assert(partial_sort_copy(par, input.begin(), input.end(), dest.begin(), dest.end()) == dest.end());
+    assert(equal(dest.begin(), dest.end(), sorted.begin(), sortedMid));
+
+    dest.assign(input.size() + 1, 0);
+    const auto destLast = partial_sort_copy(par, input.begin(), input.end(), dest.begin(), dest.end(), greater());
+    assert(destLast == dest.begin() + static_cast<ptrdiff_t>(input.size()));
+    assert(equal(dest.begin(), destLast, sorted.rbegin(), sorted.rend()));
+}
+
+void test_case_nth_element_parallel(const size_t testSize) {
+    vector<size_t> input(testSize);
+    iota(input.rbegin(), input.rend(), size_t{0});
+    for (size_t nth = 0; nth <= testSize; ++nth) {
+        check_nth_element(input, nth);
+        check_partial_sort(input, nth);
+    }
+}
+
+void test_large_inputs(mt19937& gen) {
+    // large enough that nth_element takes several parallel partitioning steps
+    constexpr size_t largeSize = 100'000;
+    for (const size_t distinctValues : {size_t{1}, size_t{2}, size_t{10}, largeSize}) {
+        uniform_int_distribution<size_t> dist(0, distinctValues - 1);
+        vector<size_t> input(largeSize);
+        for (auto& elem : input) {
+            elem = dist(gen);
+        }
+
+        for (const size_t nth : {size_t{0}, size_t{1}, largeSize / 100, largeSize / 2, largeSize * 99 / 100,
+                 largeSize - 1, largeSize}) {
+            check_nth_element(input, nth);
+        }
+
+        check_partial_sort(input, 0);
+        check_partial_sort(input, largeSize / 10);
+        check_partial_sort(input, largeSize);
+
+        sort(input.begin(), input.end());
+        check_nth_element(input, largeSize / 3);
+        reverse(input.begin(), input.end());
+        check_nth_element(input, largeSize / 3);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_nth_element_parallel);
+    test_large_inputs(gen);
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes large enough to take the parallel path, with odd element counts so that the two halves of a reversal and the
+// two parts of a rotation have different lengths
+const size_t largeSizes[] = {(1U << 18) + 7, (1U << 20) + 4093};
+
+template <template <class...> class Container>
+void test_case_reverse_parallel(const size_t testSize) {
+    Container<unsigned int> c(testSize);
+    iota(c.begin(), c.end(), 0U);
+    vector<unsigned int> expected(c.begin(), c.end());
+
+    vector<unsigned int> dest(testSize + 1);
+    assert(reverse_copy(par, c.begin(), c.end(), dest.begin()) == dest.end() - 1);
+    reverse(expected.begin(), expected.end());
+    assert(equal(dest.begin(), dest.end() - 1, expected.begin(), expected.end()));
+
+    reverse(par, c.begin(), c.end());
+    assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+}
+
+template <template <class...> class Container>
+void test_case_rotate_parallel(const size_t testSize) {
+    for (size_t midOffset = 0; midOffset <= testSize; ++midOffset) {
+        Container<unsigned int> c(testSize);
+        iota(c.begin(), c.end(), 0U);
+        vector<unsigned int> expected(c.begin(), c.end());
+        rotate(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(midOffset), expected.end());
+
+        const auto mid = next(c.begin(), static_cast<ptrdiff_t>(midOffset));
+        vector<unsigned int> dest(testSize);
+        assert(rotate_copy(par, c.begin(), mid, c.end(), dest.begin()) == dest.end());
+        assert(dest == expected);
+
+        const auto result = rotate(par, c.begin(), mid, c.end());
+        assert(distance(c.begin(), result) == static_cast<ptrdiff_t>(testSize - midOffset));
+        assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+    }
+}
+
+void test_case_large() {
+    for (const size_t testSize : largeSizes) {
+        vector<long long> input(testSize);
+        iota(input.begin(), input.end(), 0LL);
+
+        vector<long long> dest(testSize + 1, -1);
+        assert(reverse_copy(par, input.begin(), input.end(), dest.data() + 1) == dest.data() + dest.size());
+        assert(dest[0] == -1);
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            assert(dest[idx + 1] == static_cast<long long>(testSize - 1 - idx));
+        }
+
+        vector<long long> c = input;
+        reverse(par, c.begin(), c.end());
+        assert(equal(c.begin(), c.end(), dest.begin() + 1));
+        reverse(par, c.data() + 1, c.data() + c.size());
+        assert(c[0] == static_cast<long long>(testSize - 1));
+        for (size_t idx = 1; idx < testSize; ++idx) {
+            assert(c[idx] == static_cast<long long>(idx - 1));
+        }
+
+        for (const size_t midOffset : {size_t{1}, testSize / 3, testSize / 2, testSize - 1}) {
+            vector<long long> expected = input;
+            rotate(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(midOffset), expected.end());
+
+            assert(rotate_copy(par, input.begin(), input.begin() + static_cast<ptrdiff_t>(midOffset), input.end(),
+                       dest.begin())
+                   == dest.end() - 1);
+            assert(equal(expected.begin(), expected.end(), dest.begin()));
+
+            c                 = input;
+            const auto result = rotate(par, c.begin(), c.begin() + static_cast<ptrdiff_t>(midOffset), c.end());
+            assert(result == c.end() - static_cast<ptrdiff_t>(midOffset));
+            assert(c == expected);
+        }
+
+        vector<string> strings(testSize / 16);
+        for (size_t idx = 0; idx < strings.size(); ++idx) {
+            strings[idx] = to_string(idx);
+        }
+
+        vector<string> expectedStrings(strings.rbegin(), strings.rend());
+        vector<string> reversedStrings(strings.size());
+        assert(reverse_copy(par, strings.begin(), strings.end(), reversedStrings.begin()) == reversedStrings.end());
+        assert(reversedStrings == expectedStrings);
+        reverse(par, strings.begin(), strings.end());
+        assert(strings == expectedStrings);
+
+        rotate(expectedStrings.begin(), expectedStrings.begin() + 5, expectedStrings.end());
+        assert(rotate(par, strings.begin(), strings.begin() + 5, strings.end()) == strings.end() - 5);
+        assert(strings == expectedStrings);
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_reverse_parallel<vector>);
+    parallel_test_case(test_case_reverse_parallel<deque>);
+    parallel_test_case(test_case_reverse_parallel<list>);
+    parallel_test_case(test_case_rotate_parallel<vector>);
+    parallel_test_case(test_case_rotate_parallel<deque>);
+    parallel_test_case(test_case_rotate_parallel<list>);
+    parallel_test_case(test_case_rotate_parallel<forward_list>);
+    test_case_large();
+}
@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+const size_t testSize = 1'000'000;
+
+size_t count_threads_used(vector<unsigned int>& v) {
+    mutex mtx;
+    set<thread::id> ids;
+    for_each(par, v.begin(), v.end(), [&](unsigned int& x) {
+        x *= 2;
+        if ((x & 0x3FEU) == 0) {
+            lock_guard<mutex> lck(mtx);
+            ids.insert(this_thread::get_id());
+        }
+    });
+
+    return ids.size();
+}
+
+void test_max_concurrency_one() {
+    vector<unsigned int> v(testSize);
+    iota(v.begin(), v.end(), 0U);
+    {
+        const stdext::parallel_algorithms_scope scope{nullptr, 1};
+        assert(count_threads_used(v) == 1);
+        sort(par, v.begin(), v.end(), greater<>{});
+    }
+
+    assert(is_sorted(v.begin(), v.end(), greater<>{}));
+    assert(v.front() == (testSize - 1) * 2);
+    assert(v.back() == 0);
+}
+
+void test_nested_scopes() {
+    vector<unsigned int> v(testSize);
+    iota(v.begin(), v.end(), 0U);
+    {
+        // the calling thread plus at most one thread from the process-wide threadpool
+        const stdext::parallel_algorithms_scope scope{nullptr, 2};
+        assert(count_threads_used(v) <= 2);
+        {
+            const stdext::parallel_algorithms_scope inner{nullptr, 1};
+            reverse(v.begin(), v.end());
+            sort(par, v.begin(), v.end());
+            assert(count_threads_used(v) == 1);
+        }
+
+        assert(count_threads_used(v) <= 2);
+    }
+
+    assert(is_sorted(v.begin(), v.end()));
+    assert(v.front() == 0);
+    assert(v.back() == (testSize - 1) * 8);
+}
+
+void test_chunking_hints() {
+    struct chunking_hint {
+        size_t minChunkSize;
+        size_t chunkCount;
+    };
+
+    const chunking_hint hints[] = {{0, 1}, {0, 3}, {0, 7777}, {0, testSize * 2}, {1000, 0}, {testSize, 0}, {7, 5}};
+    vector<unsigned int> input(testSize);
+    iota(input.begin(), input.end(), 0U);
+    vector<unsigned int> expected(testSize);
+    inclusive_scan(input.begin(), input.end(), expected.begin());
+
+    for (const auto& hint : hints) {
+        const stdext::parallel_algorithms_chunking_scope scope{hint.minChunkSize, hint.chunkCount};
+        vector<unsigned int> actual(testSize);
+        inclusive_scan(par, input.begin(), input.end(), actual.begin());
+        assert(actual == expected);
+
+        assert(count_if(par, input.begin(), input.end(), [](unsigned int x) { return x % 3 == 0; })
+               == static_cast<ptrdiff_t>((testSize + 2) / 3));
+
+        transform(par, input.begin(), input.end(), actual.begin(), [](unsigned int x) { return x + 1; });
+        assert(actual.front() == 1);
+        assert(actual.back() == testSize);
+        assert(is_sorted(par, actual.begin(), actual.end()));
+        assert(find(par, actual.begin(), actual.end(), 12345U) == actual.begin() + 12344);
+    }
+}
+
+void test_numa_placement() {
+    // on machines with one NUMA node the scope changes nothing; with several, the results must not change either
+    const stdext::parallel_algorithms_numa_scope scope;
+    vector<unsigned int> v(testSize * 4);
+    fill(par, v.begin(), v.end(), 1U);
+    assert(count(v.begin(), v.end(), 1U) == static_cast<ptrdiff_t>(v.size()));
+
+    vector<unsigned int> w(v.size());
+    transform(par, v.begin(), v.end(), w.begin(), [](unsigned int x) { return x + 2; });
+    assert(count(w.begin(), w.end(), 3U) == static_cast<ptrdiff_t>(w.size()));
+
+    iota(v.begin(), v.end(), 0U);
+    for_each(par, v.begin(), v.end(), [](unsigned int& x) { x *= 3; });
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(v[i] == i * 3);
+    }
+
+    copy(par, v.begin(), v.end(), w.begin());
+    assert(w == v);
+
+    // the algorithms that depend on the order of their chunks don't use the placement
+    inclusive_scan(par, w.begin(), w.end(), w.begin());
+    assert(w.back() == static_cast<unsigned int>(3 * (v.size() - 1) * v.size() / 2));
+
+    {
+        const stdext::parallel_algorithms_numa_scope inner{false};
+        const stdext::parallel_algorithms_scope serial{nullptr, 1};
+        assert(count_threads_used(v) == 1);
+    }
+}
+
+struct counting_resource : pmr::memory_resource {
+    size_t allocations = 0;
+    size_t outstanding = 0;
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        ++allocations;
+        ++outstanding;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) override {
+        --outstanding;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+vector<pair<unsigned int, unsigned int>> get_stable_sort_input() {
+    vector<pair<unsigned int, unsigned int>> v(testSize);
+    for (unsigned int i = 0; i < testSize; ++i) {
+        v[i] = {i % 1000, i};
+    }
+
+    reverse(v.begin(), v.end());
+    return v;
+}
+
+bool is_stably_sorted(const vector<pair<unsigned int, unsigned int>>& v) {
+    return is_sorted(v.begin(), v.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second);
+    });
+}
+
+const auto less_first = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+
+void test_scratch_storage() {
+    {
+        counting_resource resource;
+        {
+            const stdext::parallel_algorithms_scratch_scope scope{&resource};
+            auto v = get_stable_sort_input();
+            stable_sort(par, v.begin(), v.end(), less_first);
+            assert(is_stably_sorted(v));
+
+            vector<unsigned int> w(testSize);
+            iota(w.begin(), w.begin() + testSize / 2, 0U);
+            iota(w.begin() + testSize / 2, w.end(), 0U);
+            inplace_merge(par, w.begin(), w.begin() + testSize / 2, w.end());
+            assert(is_sorted(w.begin(), w.end()));
+
+            vector<unsigned int> odds(testSize / 2);
+            iota(odds.begin(), odds.end(), 0U);
+            for (auto& x : odds) {
+                x = x * 2 + 1;
+            }
+
+            vector<unsigned int> all(testSize);
+            iota(all.begin(), all.end(), 0U);
+            const auto last = set_difference(par, all.begin(), all.end(), odds.begin(), odds.end(), w.begin());
+            assert(last - w.begin() == static_cast<ptrdiff_t>(testSize / 2));
+            assert(w[12345] == 24690U);
+        }
+
+        assert(resource.allocations != 0);
+        assert(resource.outstanding == 0);
+    }
+
+    {
+        // the caller's buffer is used when it's large enough, and nested scopes select their own
+        auto v = get_stable_sort_input();
+        vector<unsigned char> buffer(v.size() * sizeof(v[0]), static_cast<unsigned char>(0xCD));
+        {
+            const stdext::parallel_algorithms_scratch_scope scope{buffer.data(), buffer.size()};
+            stable_sort(par, v.begin(), v.end(), less_first);
+            {
+                const stdext::parallel_algorithms_scratch_scope inner{buffer.data(), 10};
+                auto u = get_stable_sort_input();
+                stable_sort(par, u.begin(), u.end(), less_first);
+                assert(u == v);
+            }
+        }
+
+        assert(is_stably_sorted(v));
+        assert(count(buffer.begin(), buffer.end(), static_cast<unsigned char>(0xCD))
+               != static_cast<ptrdiff_t>(buffer.size()));
+    }
+
+    {
+        // the cached block is reused from call to call
+        const stdext::parallel_algorithms_scratch_scope scope;
+        for (int i = 0; i < 3; ++i) {
+            auto v = get_stable_sort_input();
+            stable_sort(par, v.begin(), v.end(), less_first);
+            assert(is_stably_sorted(v));
+            vector<unsigned int> w(testSize);
+            iota(w.rbegin(), w.rend(), 0U);
+            sort(par, w.begin(), w.end());
+            assert(is_sorted(w.begin(), w.end()));
+        }
+    }
+}
+
+int main() {
+    test_max_concurrency_one();
+    test_nested_scopes();
+    test_chunking_hints();
+    test_numa_placement();
+    test_scratch_storage();
+}
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// elements are ordered by key only, so that the tests observe which range each output element was copied from
+using element = pair<unsigned int, unsigned int>;
+
+struct key_less {
+    bool operator()(const element& lhs, const element& rhs) const {
+        return lhs.first < rhs.first;
+    }
+};
+
+struct key_greater {
+    bool operator()(const element& lhs, const element& rhs) const {
+        return lhs.first > rhs.first;
+    }
+};
+
+template <class Pr>
+vector<element> make_sorted_input(const size_t testSize, const unsigned int keyRange, const unsigned int source,
+    mt19937& gen, const Pr pred) {
+    vector<element> result(testSize);
+    for (auto& elem : result) {
+        elem = {static_cast<unsigned int>(gen() % keyRange), source};
+    }
+
+    sort(result.begin(), result.end(), pred);
+    return result;
+}
+
+template <class Pr>
+void check_set_operations(const vector<element>& range1, const vector<element>& range2, const Pr pred) {
+    vector<element> expected(range1.size() + range2.size());
+    vector<element> actual(range1.size() + range2.size());
+
+    auto expectedEnd = set_union(range1.begin(), range1.end(), range2.begin(), range2.end(), expected.begin(), pred);
+    auto actualEnd = set_union(par, range1.begin(), range1.end(), range2.begin(), range2.end(), actual.begin(), pred);
+    assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+    expectedEnd =
+        set_symmetric_difference(range1.begin(), range1.end(), range2.begin(), range2.end(), expected.begin(), pred);
+    actualEnd = set_symmetric_difference(
+        par, range1.begin(), range1.end(), range2.begin(), range2.end(), actual.begin(), pred);
+    assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+    assert(includes(par, range1.begin(), range1.end(), range2.begin(), range2.end(), pred)
+           == includes(range1.begin(), range1.end(), range2.begin(), range2.end(), pred));
+    assert(includes(par, range2.begin(), range2.end(), range1.begin(), range1.end(), pred)
+           == includes(range2.begin(), range2.end(), range1.begin(), range1.end(), pred));
+}
+
+void test_case_set_union_parallel(const size_t testSize, mt19937& gen) {
+    // many duplicates, a few duplicates, and mostly unique keys
+    for (const unsigned int keyRange : {3U, static_cast<unsigned int>(testSize / 4 + 1), 0xFFFF'FFFFU}) {
+        for (const size_t otherSize : {size_t{0}, size_t{1}, testSize / 3, testSize, testSize * 2}) {
+            check_set_operations(make_sorted_input(testSize, keyRange, 1, gen, key_less{}),
+                make_sorted_input(otherSize, keyRange, 2, gen, key_less{}), key_less{});
+            check_set_operations(make_sorted_input(testSize, keyRange, 1, gen, key_greater{}),
+                make_sorted_input(otherSize, keyRange, 2, gen, key_greater{}), key_greater{});
+        }
+    }
+
+    // disjoint ranges on either side of each other
+    vector<element> low(testSize);
+    vector<element> high(testSize);
+    for (unsigned int idx = 0; idx < testSize; ++idx) {
+        low[idx]  = {idx, 1};
+        high[idx] = {static_cast<unsigned int>(idx + testSize), 2};
+    }
+
+    check_set_operations(low, high, key_less{});
+    check_set_operations(high, low, key_less{});
+
+    // every other element, which includes must accept in one direction only
+    vector<element> evens;
+    for (unsigned int idx = 0; idx < testSize; idx += 2) {
+        evens.emplace_back(idx, 2);
+    }
+
+    check_set_operations(low, evens, key_less{});
+    assert(includes(par, low.begin(), low.end(), evens.begin(), evens.end(), key_less{}));
+    if (testSize >= 2) {
+        assert(!includes(par, evens.begin(), evens.end(), low.begin(), low.end(), key_less{}));
+
+        // a single missing element at the end must be found
+        vector<element> missingLast(low);
+        missingLast.back().first = static_cast<unsigned int>(testSize * 2);
+        assert(!includes(par, low.begin(), low.end(), missingLast.begin(), missingLast.end(), key_less{}));
+    }
+
+    // includes counts duplicates
+    vector<unsigned int> ones(testSize, 1U);
+    vector<unsigned int> moreOnes(testSize + 1, 1U);
+    assert(includes(par, moreOnes.begin(), moreOnes.end(), ones.begin(), ones.end()));
+    assert(!includes(par, ones.begin(), ones.end(), moreOnes.begin(), moreOnes.end()));
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_set_union_parallel, gen);
+}
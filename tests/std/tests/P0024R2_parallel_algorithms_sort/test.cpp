@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <assert.h>
 #include <execution>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -35,9 +37,60 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+template <class T, class Pred = less<>>
+void test_case_sort_parallel_radix(const vector<T>& input, Pred pred = {}) {
+    // large enough to use the radix sort for arithmetic types ordered by less
+    vector<T> expected = input;
+    sort(expected.begin(), expected.end(), pred);
+    vector<T> actual = input;
+    sort(par, actual.begin(), actual.end(), pred);
+    assert(actual == expected);
+}
+
+template <class T, class Dist>
+void test_case_sort_parallel_radix_dist(mt19937& gen, Dist dist) {
+    vector<T> input(300'007);
+    generate(input.begin(), input.end(), [&] { return static_cast<T>(dist(gen)); });
+    test_case_sort_parallel_radix(input);
+    test_case_sort_parallel_radix(input, less<T>{});
+    test_case_sort_parallel_radix(input, greater<>{}); // not radix sorted
+}
+
+void test_case_sort_parallel_radix_all(mt19937& gen) {
+    test_case_sort_parallel_radix_dist<unsigned char>(gen, uniform_int_distribution<int>(0, 255));
+    test_case_sort_parallel_radix_dist<signed char>(gen, uniform_int_distribution<int>(-128, 127));
+    test_case_sort_parallel_radix_dist<short>(gen, uniform_int_distribution<int>(-32768, 32767));
+    test_case_sort_parallel_radix_dist<int>(gen, uniform_int_distribution<int>(-1000, 1000));
+    test_case_sort_parallel_radix_dist<unsigned int>(gen, uniform_int_distribution<unsigned int>());
+    test_case_sort_parallel_radix_dist<long long>(gen, uniform_int_distribution<long long>());
+    test_case_sort_parallel_radix_dist<unsigned long long>(gen, uniform_int_distribution<unsigned long long>());
+    test_case_sort_parallel_radix_dist<float>(gen, normal_distribution<float>(0.0f, 100.0f));
+    test_case_sort_parallel_radix_dist<double>(gen, normal_distribution<double>(0.0, 1e9));
+
+    // all the same digit in the low bytes, to exercise skipped passes ending with the data in the temporary buffer
+    vector<unsigned int> shifted(200'000);
+    iota(shifted.begin(), shifted.end(), 0U);
+    for (auto& x : shifted) {
+        x = (x % 7) << 8;
+    }
+    test_case_sort_parallel_radix(shifted);
+
+    vector<double> special(100'000, 1.0);
+    special[3]     = numeric_limits<double>::infinity();
+    special[5]     = -0.0;
+    special[7]     = 0.0;
+    special[11]    = -numeric_limits<double>::infinity();
+    special[13]    = numeric_limits<double>::lowest();
+    special[17]    = numeric_limits<double>::denorm_min();
+    special[19]    = -numeric_limits<double>::denorm_min();
+    special.back() = -1.0;
+    test_case_sort_parallel_radix(special);
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+    test_case_sort_parallel_radix_all(gen);
 }
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <execution>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const size_t largeSizes[] = {(1U << 16) + 7, (1U << 20) + 4093};
+
+const auto isMultipleOf3 = [](const unsigned int x) { return x % 3 == 0; };
+
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize) {
+    mt19937 gen(1729);
+    Container<unsigned int> c(testSize);
+    for (auto& x : c) {
+        x = static_cast<unsigned int>(gen() % 100);
+    }
+
+    vector<unsigned int> expected(c.begin(), c.end());
+    const auto expectedMid = stable_partition(expected.begin(), expected.end(), isMultipleOf3);
+    const auto mid         = stable_partition(par, c.begin(), c.end(), isMultipleOf3);
+    assert(distance(c.begin(), mid) == expectedMid - expected.begin());
+    assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+}
+
+void test_case_large() {
+    mt19937 gen(4321);
+    for (const size_t testSize : largeSizes) {
+        // equal keys tagged with their original position show that the relative order is kept on both sides
+        vector<pair<unsigned int, size_t>> tagged(testSize);
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            tagged[idx] = {static_cast<unsigned int>(gen() % 8), idx};
+        }
+
+        const auto isEven      = [](const pair<unsigned int, size_t>& p) { return p.first % 2 == 0; };
+        auto expected          = tagged;
+        const auto expectedMid = stable_partition(expected.begin(), expected.end(), isEven);
+        const auto mid         = stable_partition(par, tagged.begin(), tagged.end(), isEven);
+        assert(mid - tagged.begin() == expectedMid - expected.begin());
+        assert(tagged == expected);
+
+        // all true and all false
+        vector<unsigned int> ones(testSize, 1U);
+        assert(stable_partition(par, ones.begin(), ones.end(), [](unsigned int x) { return x == 1; }) == ones.end());
+        assert(stable_partition(par, ones.begin(), ones.end(), [](unsigned int x) { return x == 0; }) == ones.begin());
+        assert(all_of(ones.begin(), ones.end(), [](unsigned int x) { return x == 1; }));
+
+        // elements whose moves must run constructors and destructors
+        vector<string> strings(testSize / 16);
+        for (size_t idx = 0; idx < strings.size(); ++idx) {
+            strings[idx] = to_string(idx);
+        }
+
+        const auto endsIn7     = [](const string& s) { return s.back() == '7'; };
+        auto expectedStrings   = strings;
+        const auto expectedEnd = stable_partition(expectedStrings.begin(), expectedStrings.end(), endsIn7);
+        const auto stringsEnd  = stable_partition(par, strings.begin(), strings.end(), endsIn7);
+        assert(stringsEnd - strings.begin() == expectedEnd - expectedStrings.begin());
+        assert(strings == expectedStrings);
+
+        vector<unique_ptr<int>> ptrs(testSize / 16);
+        for (size_t idx = 0; idx < ptrs.size(); ++idx) {
+            ptrs[idx] = make_unique<int>(static_cast<int>(idx));
+        }
+
+        const auto ptrsMid = stable_partition(par, ptrs.begin(), ptrs.end(), [](const unique_ptr<int>& p) {
+            return *p % 2 != 0;
+        });
+        assert(ptrsMid - ptrs.begin() == static_cast<ptrdiff_t>(ptrs.size() / 2));
+        for (size_t idx = 0; idx < ptrs.size(); ++idx) {
+            const size_t half = ptrs.size() / 2;
+            assert(*ptrs[idx] == static_cast<int>(idx < half ? 2 * idx + 1 : 2 * (idx - half)));
+        }
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_stable_partition_parallel<vector>);
+    parallel_test_case(test_case_stable_partition_parallel<deque>);
+    parallel_test_case(test_case_stable_partition_parallel<list>);
+    test_case_large();
+}
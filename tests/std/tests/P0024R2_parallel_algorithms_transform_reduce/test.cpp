@@ -69,6 +69,39 @@ void test_case_transform_reduce(const size_t testSize, mt19937& gen) {
     assert(correct == transform_reduce(par, b, e, 42U, plus<>{}, times_ten));
 }
 
+// the unsequenced policies reduce arithmetic types with several partial results, whatever the operations
+template <class ExPo>
+void test_case_transform_reduce_unsequenced(const size_t testSize, ExPo&& exec) {
+    vector<double> x(testSize);
+    vector<double> y(testSize);
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        x[idx] = static_cast<double>(idx % 7);
+        y[idx] = static_cast<double>(idx % 5) - 2.0;
+    }
+
+    double dot       = 0.5;
+    double squares   = 0.25;
+    double largest   = -1.0;
+    unsigned int sum = 42U;
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        dot += x[idx] * y[idx];
+        squares += y[idx] * y[idx];
+        largest = (max) (largest, x[idx] - y[idx]);
+        sum += static_cast<unsigned int>(x[idx]) * 10;
+    }
+
+    const auto times = [](double a, double b) { return a * b; };
+    const auto add   = [](double a, double b) { return a + b; };
+    const auto maxed = [](double a, double b) { return (max) (a, b); };
+    assert(dot == transform_reduce(exec, x.begin(), x.end(), y.begin(), 0.5));
+    assert(dot == transform_reduce(exec, x.begin(), x.end(), y.begin(), 0.5, add, times));
+    assert(squares == transform_reduce(exec, y.begin(), y.end(), 0.25, add, [](double a) { return a * a; }));
+    assert(largest == transform_reduce(exec, x.begin(), x.end(), y.begin(), -1.0, maxed, minus<>{}));
+    assert(sum
+           == transform_reduce(exec, x.begin(), x.end(), 42U, add_a_different_way,
+               [](double a) { return static_cast<unsigned int>(a) * 10; }));
+}
+
 vector<unique_ptr<vector<unsigned int>>> get_move_only_test_data(const size_t testSize) {
     vector<unique_ptr<vector<unsigned int>>> testData;
     testData.reserve(testSize);
@@ -148,6 +181,10 @@ int main() {
     mt19937 gen(1729);
     parallel_test_case(test_case_transform_reduce_binary, gen);
     parallel_test_case(test_case_transform_reduce, gen);
+    parallel_test_case([](const size_t testSize) { test_case_transform_reduce_unsequenced(testSize, par_unseq); });
+#if _HAS_CXX20
+    parallel_test_case([](const size_t testSize) { test_case_transform_reduce_unsequenced(testSize, unseq); });
+#endif // _HAS_CXX20
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
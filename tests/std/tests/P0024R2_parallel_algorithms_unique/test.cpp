@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// compares only the high bits, so the tests can observe which element of each run is kept
+const auto same_run = [](unsigned int lhs, unsigned int rhs) { return (lhs >> 8) == (rhs >> 8); };
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int distinctRuns : {1U, 2U, 16U, 1000000U}) {
+        uniform_int_distribution<unsigned int> dist(0, distinctRuns * 256 - 1);
+        vector<unsigned int> input(testSize);
+        for (auto& elem : input) {
+            elem = dist(gen);
+        }
+
+        sort(input.begin(), input.end(), [](unsigned int lhs, unsigned int rhs) { return (lhs >> 8) < (rhs >> 8); });
+
+        vector<unsigned int> expected(input);
+        expected.erase(unique(expected.begin(), expected.end(), same_run), expected.end());
+
+        Container<unsigned int> tested(input.begin(), input.end());
+        const auto newEnd = unique(par, tested.begin(), tested.end(), same_run);
+        assert(equal(tested.begin(), newEnd, expected.begin(), expected.end()));
+
+        vector<unsigned int> dest(testSize);
+        Container<unsigned int> source(input.begin(), input.end());
+        const auto destEnd = unique_copy(par, source.begin(), source.end(), dest.begin(), same_run);
+        assert(equal(dest.begin(), destEnd, expected.begin(), expected.end()));
+
+        // default comparison
+        expected = input;
+        expected.erase(unique(expected.begin(), expected.end()), expected.end());
+        tested.assign(input.begin(), input.end());
+        assert(equal(tested.begin(), unique(par, tested.begin(), tested.end()), expected.begin(), expected.end()));
+        assert(equal(dest.begin(), unique_copy(par, source.begin(), source.end(), dest.begin()), expected.begin(),
+            expected.end()));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+    parallel_test_case(test_case_unique_parallel<deque>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+}
@@ -61,7 +61,12 @@ void test_syncbuf_member_functions(string_buffer<typename Alloc::value_type>* bu
     assert(aSyncbuf.get_wrapped() == buf);
     assert(aSyncbuf.get_allocator() == alloc);
     assert(aSyncbuf.Test_get_data_size() == 0);
-    assert(aSyncbuf.Test_get_buffer_size() == Min_syncbuf_size);
+    if constexpr (is_same_v<Alloc, allocator<value_type>>) {
+        // buffers obtained from allocator<value_type> are reused by later syncbufs on the same thread
+        assert(aSyncbuf.Test_get_buffer_size() >= Min_syncbuf_size);
+    } else {
+        assert(aSyncbuf.Test_get_buffer_size() == Min_syncbuf_size);
+    }
 
     // check emit post-conditions with no input
     if (buf) {
@@ -357,6 +362,75 @@ void test_osyncstream(string_buffer<typename Alloc::value_type>* buf = nullptr)
     }
 }
 
+size_t live_counting_elements = 0;
+
+template <class Ty>
+class counting_allocator {
+public:
+    using value_type = Ty;
+
+    counting_allocator() = default;
+
+    template <class Other>
+    constexpr counting_allocator(const counting_allocator<Other>&) noexcept {}
+
+    [[nodiscard]] Ty* allocate(const size_t n) {
+        live_counting_elements += n;
+        return allocator<Ty>{}.allocate(n);
+    }
+
+    void deallocate(Ty* const ptr, const size_t n) noexcept {
+        assert(live_counting_elements >= n);
+        live_counting_elements -= n;
+        allocator<Ty>{}.deallocate(ptr, n);
+    }
+
+    template <class Other>
+    [[nodiscard]] bool operator==(const counting_allocator<Other>&) const noexcept {
+        return true;
+    }
+};
+
+void test_syncbuf_growth_releases_buffers(string_buffer<char>* buf) {
+    {
+        basic_osyncstream<char, char_traits<char>, counting_allocator<char>> oss{buf};
+        for (int i = 0; i < 1000; ++i) {
+            oss << "Growing the buffer one line at a time\n";
+        }
+    }
+
+    assert(live_counting_elements == 0);
+    assert(buf->str.size() == 1000 * 38);
+    buf->str.clear();
+}
+
+void test_syncbuf_buffer_reuse(string_buffer<char>* buf) {
+    // implementation detail: a syncbuf using allocator<char> keeps its buffer for the next syncbuf on the same thread
+    using Syncbuf = test_syncbuf<char, char_traits<char>, allocator<char>>;
+
+    const char* first_buffer;
+    size_t first_size;
+    {
+        Syncbuf aSyncbuf{buf};
+        ostream os{&aSyncbuf};
+        os << "A string holds more than 32 characters";
+        first_buffer = aSyncbuf.pbase();
+        first_size   = aSyncbuf.Test_get_buffer_size();
+    }
+
+    {
+        Syncbuf aSyncbuf{buf};
+        assert(aSyncbuf.pbase() == first_buffer);
+        assert(aSyncbuf.Test_get_buffer_size() == first_size);
+        assert(aSyncbuf.Test_get_data_size() == 0);
+        ostream os{&aSyncbuf};
+        os << "Reused\n";
+    }
+
+    assert(buf->str == "A string holds more than 32 charactersReused\n");
+    buf->str.clear();
+}
+
 int main() {
     string_buffer<char> char_buffer{};
     string_buffer<char, true> no_sync_char_buffer{};
@@ -382,4 +456,7 @@ int main() {
 
     test_osyncstream<allocator<char>>(&char_buffer);
     test_osyncstream<small_size_allocator<char>>(&char_buffer);
+
+    test_syncbuf_growth_releases_buffers(&char_buffer);
+    test_syncbuf_buffer_reuse(&char_buffer);
 }
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <deque>
@@ -24,6 +25,10 @@
 #include <unordered_set>
 #include <vector>
 
+#ifndef _M_CEE
+#include <thread>
+#endif // _M_CEE
+
 #pragma warning(disable : 6326) // Potential comparison of a constant with another constant.
 #pragma warning(disable : 28251) // Inconsistent annotation for 'new': this instance has no annotations.
 
@@ -1136,6 +1141,84 @@ namespace {
                     rr.allocations_ = std::move(allocations);
                 }
             } // namespace do_deallocate
+
+            namespace arena {
+                void test_rewind() {
+                    // Verify that rewinding reuses the buffers obtained from upstream after the checkpoint.
+                    recording_resource rr;
+                    stdext::pmr::monotonic_arena_resource mar{&rr};
+                    (void) mar.allocate(64, 8);
+                    auto const point   = mar.checkpoint();
+                    void* const second = mar.allocate(64, 8);
+                    for (auto i = 0_zu; i < 1000; ++i) {
+                        (void) mar.allocate(100, 16);
+                    }
+                    auto const before = rr.allocations_;
+                    CHECK(before.size() > 1);
+
+                    for (int round = 0; round < 3; ++round) {
+                        mar.rewind(point);
+                        CHECK(mar.allocate(64, 8) == second);
+                        for (auto i = 0_zu; i < 1000; ++i) {
+                            (void) mar.allocate(100, 16);
+                        }
+                        CHECK(rr.allocations_ == before);
+                    }
+
+                    // a request larger than any retained buffer returns the retained buffers that are too small
+                    mar.rewind(point);
+                    (void) mar.allocate(1_zu << 20, 8);
+                    CHECK(rr.allocations_.size() == 2);
+                    CHECK(rr.allocations_[0] == before[0]);
+
+                    mar.release();
+                    CHECK(rr.allocations_.empty());
+                }
+
+                void test_retain() {
+                    // Verify that release() keeps buffers for reuse in retain mode, and trim() returns them.
+                    alignas(16) unsigned char buffer[256];
+                    recording_resource rr;
+                    stdext::pmr::monotonic_arena_resource mar{buffer, sizeof(buffer), &rr};
+                    CHECK(!mar.retains_buffers_on_release());
+                    mar.retain_buffers_on_release(true);
+                    CHECK(mar.retains_buffers_on_release());
+
+                    auto const fill = [&mar] {
+                        for (auto i = 0_zu; i < 1000; ++i) {
+                            (void) mar.allocate(1 + i % 200, 1_zu << (i % 5));
+                        }
+                    };
+
+                    fill();
+                    auto const before = rr.allocations_;
+                    CHECK(!before.empty());
+                    for (int round = 0; round < 3; ++round) {
+                        mar.release();
+                        CHECK(rr.allocations_ == before);
+                        CHECK(mar.allocate(16, 16) == buffer);
+                        mar.release();
+                        fill();
+                        CHECK(rr.allocations_ == before);
+                    }
+
+                    mar.release();
+                    mar.trim();
+                    CHECK(rr.allocations_.empty());
+                    CHECK(mar.allocate(16, 16) == buffer);
+
+                    fill();
+                    mar.retain_buffers_on_release(false);
+                    mar.release();
+                    CHECK(rr.allocations_.empty());
+                    CHECK(mar.allocate(16, 16) == buffer);
+                }
+
+                void test() {
+                    test_rewind();
+                    test_retain();
+                }
+            } // namespace arena
         } // namespace mem
     } // namespace monotonic
 
@@ -1206,6 +1289,11 @@ namespace {
                     std::pmr::synchronized_pool_resource upr{{0_zu, 64_zu}, &rr};
                     lambda(&upr);
                 }
+                {
+                    recording_resource rr;
+                    stdext::pmr::concurrent_pool_resource upr{{0_zu, 64_zu}, &rr};
+                    lambda(&upr);
+                }
 #endif // _M_CEE
             }
 
@@ -1289,11 +1377,76 @@ namespace {
                 analyze_geometric_growth(sizes.data(), sizes.size());
             }
 
+#ifndef _M_CEE
+            void test_concurrent_allocation() {
+                // allocate blocks on several threads and deallocate them on others
+                static constexpr auto n_threads = 8_zu;
+                static constexpr auto n_allocs  = 4096_zu;
+
+                struct block {
+                    unsigned char* ptr;
+                    std::size_t size;
+                    std::size_t align;
+                };
+
+                recording_resource rr;
+                {
+                    stdext::pmr::concurrent_pool_resource cpr{{0_zu, 512_zu}, &rr};
+                    std::vector<std::vector<block>> blocks(n_threads);
+                    std::vector<std::thread> threads;
+
+                    for (auto t = 0_zu; t < n_threads; ++t) {
+                        threads.emplace_back([&cpr, &blocks, t] {
+                            auto& mine      = blocks[t];
+                            const auto fill = static_cast<unsigned char>(t + 1);
+                            for (auto i = 0_zu; i < n_allocs; ++i) {
+                                const auto size  = 1 + (i * 37 + t) % 1500;
+                                const auto align = 1_zu << (i % 7);
+                                const auto ptr   = static_cast<unsigned char*>(cpr.allocate(size, align));
+                                CHECK(reinterpret_cast<std::uintptr_t>(ptr) % align == 0);
+                                std::fill_n(ptr, size, fill);
+                                mine.push_back({ptr, size, align});
+                                if (i % 3 == 0) { // return some blocks to this thread's cache right away
+                                    const auto& b = mine[mine.size() / 2];
+                                    CHECK(std::all_of(b.ptr, b.ptr + b.size, [fill](auto c) { return c == fill; }));
+                                    cpr.deallocate(b.ptr, b.size, b.align);
+                                    mine.erase(mine.begin() + static_cast<std::ptrdiff_t>(mine.size() / 2));
+                                }
+                            }
+                        });
+                    }
+
+                    for (auto& th : threads) {
+                        th.join();
+                    }
+                    threads.clear();
+
+                    for (auto t = 0_zu; t < n_threads; ++t) {
+                        threads.emplace_back([&cpr, &blocks, t] {
+                            const auto fill = static_cast<unsigned char>(n_threads - t);
+                            for (const auto& b : blocks[n_threads - 1 - t]) {
+                                CHECK(std::all_of(b.ptr, b.ptr + b.size, [fill](auto c) { return c == fill; }));
+                                cpr.deallocate(b.ptr, b.size, b.align);
+                            }
+                        });
+                    }
+
+                    for (auto& th : threads) {
+                        th.join();
+                    }
+                }
+                CHECK(rr.allocations_.empty());
+            }
+#endif // _M_CEE
+
             void test() {
                 test_light_allocation();
                 test_medium_allocation();
                 test_heavy_allocation();
                 test_growth();
+#ifndef _M_CEE
+                test_concurrent_allocation();
+#endif // _M_CEE
             }
         } // namespace allocate_deallocate
 
@@ -1316,6 +1469,25 @@ namespace {
                 if constexpr (idl != 0) {
                     CHECK(rr.allocations_.front().size == 2 * sizeof(void*));
                 }
+
+#ifndef _M_CEE
+                {
+                    // release also discards blocks held in the per-thread caches
+                    stdext::pmr::concurrent_pool_resource cpr{{0_zu, sizeof(void*) << 8}, &rr};
+                    for (auto shift : {0, 2, 4, 8, 10, 12}) {
+                        auto const size = sizeof(void*) << shift;
+                        for (auto i = 0_zu; i < 100; ++i) {
+                            void* const ptr = cpr.allocate(size, alignof(void*));
+                            if (i % 2 == 0) {
+                                cpr.deallocate(ptr, size, alignof(void*));
+                            }
+                        }
+                    }
+                    cpr.release();
+                    CHECK(rr.allocations_.size() == 2 * idl);
+                }
+                CHECK(rr.allocations_.size() == idl);
+#endif // _M_CEE
             }
         } // namespace release
 
@@ -1410,11 +1582,242 @@ namespace {
                 test_is_equal<std::pmr::unsynchronized_pool_resource>();
 #ifndef _M_CEE
                 test_is_equal<std::pmr::synchronized_pool_resource>();
+                test_is_equal<stdext::pmr::concurrent_pool_resource>();
 #endif // _M_CEE
             }
         } // namespace is_equal
     } // namespace pool
 
+    namespace statistics {
+        // In the current ABI, pool resources make a single two-pointer allocation for the container proxy
+        constexpr auto proxy_bytes = static_cast<size_t>(_ITERATOR_DEBUG_LEVEL != 0) * 2 * sizeof(void*);
+
+        template <class PoolResource>
+        void test_pool() {
+            stdext::pmr::statistics_resource sr;
+            CHECK(sr.upstream_resource() == std::pmr::get_default_resource());
+            {
+                PoolResource upr{{0_zu, 1024_zu}, &sr};
+                auto s = stdext::pmr::get_statistics(upr);
+                CHECK(s.bytes_in_use == 0);
+                CHECK(s.pool_count == 0);
+
+                std::vector<void*> pointers;
+                for (auto i = 0_zu; i < 100; ++i) {
+                    pointers.push_back(upr.allocate(24, 8));
+                }
+                void* const big = upr.allocate(5000, 16);
+
+                stdext::pmr::pool_block_statistics pools[2];
+                s = stdext::pmr::get_statistics(upr, pools, 2);
+                CHECK(s.pool_count == 1);
+                CHECK(pools[0].block_size == 32);
+                CHECK(pools[0].blocks_in_use == 100);
+                CHECK(pools[0].blocks_reserved >= 100);
+                CHECK(pools[0].chunks != 0);
+                CHECK(pools[0].next_chunk_blocks != 0);
+                CHECK(s.oversized_allocations == 1);
+                CHECK(s.oversized_bytes > 5000);
+                CHECK(s.bytes_in_use == 100 * 32 + s.oversized_bytes);
+                CHECK(s.bytes_reserved + proxy_bytes == sr.bytes_in_use());
+
+                upr.deallocate(big, 5000, 16);
+                for (auto ptr : pointers) {
+                    upr.deallocate(ptr, 24, 8);
+                }
+
+                s = stdext::pmr::get_statistics(upr);
+                CHECK(s.bytes_in_use == 0);
+                CHECK(s.oversized_allocations == 0);
+                CHECK(s.bytes_reserved + proxy_bytes == sr.bytes_in_use());
+                CHECK(sr.peak_bytes_in_use() >= sr.bytes_in_use());
+            }
+            CHECK(sr.bytes_in_use() == 0);
+            CHECK(sr.allocations() == sr.deallocations());
+        }
+
+        void test_monotonic() {
+            stdext::pmr::statistics_resource sr;
+            {
+                stdext::pmr::monotonic_arena_resource mar{&sr};
+                mar.retain_buffers_on_release(true);
+                for (auto i = 0_zu; i < 1000; ++i) {
+                    (void) mar.allocate(100, 8);
+                }
+
+                auto const before = stdext::pmr::get_statistics(mar);
+                CHECK(before.buffers > 1);
+                CHECK(before.bytes_reserved == sr.bytes_in_use());
+                CHECK(before.bytes_available < before.bytes_reserved);
+                CHECK(before.next_buffer_size != 0);
+                CHECK(before.retained_buffers == 0);
+
+                mar.release();
+                auto const after = stdext::pmr::get_statistics(mar);
+                CHECK(after.buffers == before.buffers);
+                CHECK(after.bytes_reserved == before.bytes_reserved);
+                CHECK(after.retained_buffers == before.buffers);
+                CHECK(after.retained_bytes == before.bytes_reserved);
+
+                std::pmr::monotonic_buffer_resource& mbr = mar;
+                CHECK(stdext::pmr::get_statistics(mbr).buffers == 0);
+
+                CHECK(sr.peak_bytes_in_use() == sr.bytes_in_use());
+                CHECK(sr.largest_allocation() != 0);
+                mar.trim();
+                CHECK(sr.bytes_in_use() == 0);
+                CHECK(sr.peak_bytes_in_use() == before.bytes_reserved);
+                sr.reset_peak();
+                CHECK(sr.peak_bytes_in_use() == 0);
+                CHECK(sr.largest_allocation() == 0);
+            }
+            CHECK(sr.allocations() == sr.deallocations());
+        }
+
+        void test() {
+            test_pool<std::pmr::unsynchronized_pool_resource>();
+#ifndef _M_CEE
+            test_pool<std::pmr::synchronized_pool_resource>();
+#endif // _M_CEE
+            test_monotonic();
+        }
+    } // namespace statistics
+
+    namespace trim {
+        template <class PoolResource>
+        void test_pool() {
+            stdext::pmr::statistics_resource sr;
+            PoolResource upr{&sr};
+            std::vector<void*> pointers;
+            for (auto i = 0_zu; i < 10'000; ++i) {
+                pointers.push_back(upr.allocate(24, 8));
+            }
+            for (auto ptr : pointers) {
+                upr.deallocate(ptr, 24, 8);
+            }
+
+            // one empty chunk is retained for reuse...
+            stdext::pmr::pool_block_statistics pool;
+            auto s = stdext::pmr::get_statistics(upr, &pool, 1);
+            CHECK(s.pool_count == 1);
+            CHECK(pool.chunks == 1);
+            CHECK(pool.blocks_in_use == 0);
+
+            // ...until trimmed
+            auto const retained = sr.bytes_in_use();
+            auto const released = stdext::pmr::trim(upr);
+            CHECK(released == retained - sr.bytes_in_use());
+            s = stdext::pmr::get_statistics(upr, &pool, 1);
+            CHECK(pool.chunks == 0);
+            CHECK(s.bytes_reserved + statistics::proxy_bytes == sr.bytes_in_use());
+            CHECK(stdext::pmr::trim(upr) == 0);
+
+            // growth restarts from the smallest chunk size
+            sr.reset_peak();
+            upr.deallocate(upr.allocate(24, 8), 24, 8);
+            CHECK(sr.largest_allocation() < 1024);
+        }
+
+        void test_empty_chunk_limit() {
+            CHECK(stdext::pmr::get_pool_empty_chunk_limit() == SIZE_MAX);
+            stdext::pmr::statistics_resource sr;
+            std::pmr::unsynchronized_pool_resource upr{&sr};
+            auto const chunks_after_cycle = [&upr] {
+                std::vector<void*> pointers;
+                for (auto i = 0_zu; i < 1'000; ++i) {
+                    pointers.push_back(upr.allocate(24, 8));
+                }
+                for (auto ptr : pointers) {
+                    upr.deallocate(ptr, 24, 8);
+                }
+                stdext::pmr::pool_block_statistics pool;
+                (void) stdext::pmr::get_statistics(upr, &pool, 1);
+                return pool.chunks;
+            };
+
+            CHECK(chunks_after_cycle() == 1); // an empty chunk is retained
+            CHECK(stdext::pmr::set_pool_empty_chunk_limit(0) == SIZE_MAX);
+            (void) stdext::pmr::trim(upr);
+            CHECK(chunks_after_cycle() == 0); // every chunk is returned as soon as it empties
+            CHECK(stdext::pmr::set_pool_empty_chunk_limit(SIZE_MAX) == 0);
+        }
+
+#ifndef _M_CEE
+        void test_concurrent() {
+            stdext::pmr::statistics_resource sr;
+            stdext::pmr::concurrent_pool_resource cpr{&sr};
+            std::vector<void*> pointers;
+            for (auto i = 0_zu; i < 10'000; ++i) {
+                pointers.push_back(cpr.allocate(24, 8));
+            }
+            for (auto ptr : pointers) {
+                cpr.deallocate(ptr, 24, 8);
+            }
+
+            auto const retained = sr.bytes_in_use();
+            auto const released = cpr.trim();
+            CHECK(released == retained - sr.bytes_in_use());
+            CHECK(sr.bytes_in_use() < 1024); // only bookkeeping remains
+            cpr.deallocate(cpr.allocate(24, 8), 24, 8);
+        }
+#endif // _M_CEE
+
+        void test() {
+            test_pool<std::pmr::unsynchronized_pool_resource>();
+#ifndef _M_CEE
+            test_pool<std::pmr::synchronized_pool_resource>();
+            test_concurrent();
+#endif // _M_CEE
+            test_empty_chunk_limit();
+        }
+    } // namespace trim
+
+    namespace large_page {
+        void test_allocation(std::pmr::memory_resource& lpr, std::size_t const bytes, std::size_t const align) {
+            auto const ptr = static_cast<unsigned char*>(lpr.allocate(bytes, align));
+            CHECK(reinterpret_cast<std::uintptr_t>(ptr) % align == 0);
+            std::fill_n(ptr, bytes, static_cast<unsigned char>(0xCD));
+            CHECK(ptr[0] == 0xCD);
+            CHECK(ptr[bytes - 1] == 0xCD);
+            lpr.deallocate(ptr, bytes, align);
+        }
+
+        void test() {
+            for (auto mode : {stdext::pmr::large_page_mode::preferred, stdext::pmr::large_page_mode::disabled}) {
+                stdext::pmr::large_page_resource lpr{mode};
+                CHECK(lpr.mode() == mode);
+                CHECK(lpr == lpr);
+                test_allocation(lpr, 1, 1);
+                test_allocation(lpr, 100, 16);
+                test_allocation(lpr, 3 << 20, 64);
+                test_allocation(lpr, 1 << 20, 1 << 20); // more strictly aligned than the allocation granularity
+                test_allocation(lpr, 1 << 16, 1 << 22);
+
+                // as an upstream resource
+                std::pmr::monotonic_buffer_resource mbr{&lpr};
+                std::pmr::unsynchronized_pool_resource upr{&lpr};
+                std::pmr::vector<int> v1{&mbr};
+                std::pmr::vector<int> v2{&upr};
+                for (int i = 0; i < 100'000; ++i) {
+                    v1.push_back(i);
+                    v2.push_back(i);
+                }
+                CHECK(v1 == v2);
+            }
+
+            // large pages typically require a privilege that the test is not expected to hold
+            stdext::pmr::large_page_resource lpr{stdext::pmr::large_page_mode::required};
+            auto const page_size = stdext::pmr::large_page_resource::large_page_size();
+            try {
+                void* const ptr = lpr.allocate(100, 8);
+                CHECK(page_size != 0);
+                CHECK(reinterpret_cast<std::uintptr_t>(ptr) % page_size == 0);
+                lpr.deallocate(ptr, 100, 8);
+            } catch (std::bad_alloc&) {
+            }
+        }
+    } // namespace large_page
+
     namespace containers {
         template <class T>
         void pmr_container_test() {
@@ -1483,6 +1886,7 @@ int main() {
     monotonic::mem::release::test();
     monotonic::mem::do_allocate::test();
     monotonic::mem::do_deallocate::test();
+    monotonic::mem::arena::test();
 
     pool::release::test();
     pool::upstream_resource::test();
@@ -1490,5 +1894,9 @@ int main() {
     pool::is_equal::test();
     pool::allocate_deallocate::test();
 
+    statistics::test();
+    trim::test();
+    large_page::test();
+
     containers::test();
 }
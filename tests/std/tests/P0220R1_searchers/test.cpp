@@ -437,6 +437,52 @@ void test_case_randomized_cases() {
     }
 }
 
+template <class Char>
+void test_case_randomized_wide_cases(mt19937& mt) {
+    // characters from several "pages" of 256 code units, including surrogates and the largest code unit
+    const uint16_t alphabet[] = {u'a', u'b', 0x00E9, 0x0100, 0x0430, 0x0431, 0x4E2D, 0xD83C, 0xDFC8, 0xFFFF};
+    uniform_int_distribution<size_t> characters(0, size(alphabet) - 1);
+    uniform_int_distribution<size_t> needle_length(1, 12);
+    uniform_int_distribution<size_t> haystack_length(1, 200);
+
+    vector<Char> needle;
+    vector<Char> haystack;
+    for (int n = 0; n < 100; ++n) {
+        needle.resize(needle_length(mt));
+        for (auto& ch : needle) {
+            ch = static_cast<Char>(alphabet[characters(mt) % (n % 2 == 0 ? 3 : size(alphabet))]);
+        }
+
+        const default_searcher ds{needle.cbegin(), needle.cend()};
+        const boyer_moore_searcher bms{needle.cbegin(), needle.cend()};
+        const boyer_moore_horspool_searcher bmhs{needle.cbegin(), needle.cend()};
+        for (int h = 0; h < 50; ++h) {
+            haystack.resize(haystack_length(mt));
+            for (auto& ch : haystack) {
+                ch = static_cast<Char>(alphabet[characters(mt)]);
+            }
+
+            // make a match likely
+            if (h % 2 == 0 && needle.size() <= haystack.size()) {
+                copy(needle.begin(), needle.end(), haystack.end() - static_cast<ptrdiff_t>(needle.size()));
+            }
+
+            const auto correct = ds(haystack.cbegin(), haystack.cend());
+            assert(bms(haystack.cbegin(), haystack.cend()) == correct);
+            assert(bmhs(haystack.cbegin(), haystack.cend()) == correct);
+        }
+    }
+}
+
+void test_case_randomized_wide_cases() {
+    mt19937 mt;
+    initialize_randomness(mt);
+    test_case_randomized_wide_cases<char16_t>(mt);
+    test_case_randomized_wide_cases<wchar_t>(mt);
+    test_case_randomized_wide_cases<uint16_t>(mt);
+    test_case_randomized_wide_cases<short>(mt);
+}
+
 int main() {
     test_boyer_moore_table2_construction();
 
@@ -464,4 +510,5 @@ int main() {
     test_case_BM_unicode32<boyer_moore_horspool_searcher>();
 
     test_case_randomized_cases();
+    test_case_randomized_wide_cases();
 }
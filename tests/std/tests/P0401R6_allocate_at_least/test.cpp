@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+static_assert(is_aggregate_v<allocation_result<int*>>);
+static_assert(is_same_v<decltype(allocation_result<int*>::ptr), int*>);
+static_assert(is_same_v<decltype(allocation_result<int*>::count), size_t>);
+
+static_assert(is_same_v<decltype(allocator<int>{}.allocate_at_least(size_t{1})), allocation_result<int*>>);
+static_assert(is_same_v<decltype(allocate_at_least(declval<allocator<int>&>(), size_t{1})), allocation_result<int*>>);
+
+template <class T>
+void test_std_allocator() {
+    allocator<T> al;
+    for (size_t n = 0; n < 20'000; n += n / 8 + 1) {
+        const auto [ptr, count] = al.allocate_at_least(n);
+        assert(count >= n);
+        assert(count * sizeof(T) - n * sizeof(T) < __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+        assert((ptr == nullptr) == (count == 0));
+        uninitialized_value_construct_n(ptr, count); // all of it is usable
+        destroy_n(ptr, count);
+        al.deallocate(ptr, count);
+    }
+
+    const auto [ptr, count] = allocate_at_least(al, 5);
+    assert(count >= 5);
+    al.deallocate(ptr, count);
+}
+
+struct alignas(64) overaligned {
+    char c;
+};
+
+// counts the outstanding Tracked elements, and hands out Extra more than requested when Extra != 0
+template <class T, class Tracked, size_t Extra>
+struct tracking_allocator {
+    using value_type = T;
+
+    size_t* outstanding;
+
+    explicit tracking_allocator(size_t* const p) noexcept : outstanding{p} {}
+    template <class U>
+    tracking_allocator(const tracking_allocator<U, Tracked, Extra>& other) noexcept : outstanding{other.outstanding} {}
+
+    template <class U>
+    struct rebind {
+        using other = tracking_allocator<U, Tracked, Extra>;
+    };
+
+    T* allocate(const size_t n) {
+        if constexpr (is_same_v<T, Tracked>) {
+            *outstanding += n;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    template <size_t E = Extra, enable_if_t<E != 0, int> = 0>
+    allocation_result<T*> allocate_at_least(const size_t n) {
+        return {allocate(n + Extra), n + Extra};
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        if constexpr (is_same_v<T, Tracked>) {
+            assert(*outstanding >= n);
+            *outstanding -= n;
+        }
+
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const tracking_allocator<U, Tracked, Extra>& other) const noexcept {
+        return outstanding == other.outstanding;
+    }
+};
+
+void test_custom_allocators() {
+    size_t outstanding = 0;
+    {
+        tracking_allocator<int, int, 0> al{&outstanding};
+        const auto [ptr, count] = allocate_at_least(al, 10); // no member, so exactly what was asked for
+        assert(count == 10 && outstanding == 10);
+        al.deallocate(ptr, count);
+    }
+    {
+        tracking_allocator<int, int, 7> al{&outstanding};
+        const auto [ptr, count] = allocate_at_least(al, 10); // uses the member
+        assert(count == 17 && outstanding == 17);
+        al.deallocate(ptr, count);
+    }
+    assert(outstanding == 0);
+
+    {
+        using alloc_t = tracking_allocator<int, int, 7>;
+        vector<int, alloc_t> v{alloc_t{&outstanding}};
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+            assert(v.capacity() == outstanding); // the extra elements become capacity, and are deallocated as such
+        }
+        v.insert(v.begin(), 500, -1);
+        assert(v.capacity() == outstanding);
+        v.resize(4000);
+        assert(v.capacity() == outstanding);
+        assert(v.size() == 4000 && v[0] == -1 && v[500] == 0 && v[1499] == 999 && v[1500] == 0);
+    }
+    assert(outstanding == 0);
+
+    {
+        using alloc_t = tracking_allocator<char, char, 7>;
+        basic_string<char, char_traits<char>, alloc_t> s{alloc_t{&outstanding}};
+        for (int i = 0; i < 1000; ++i) {
+            s.push_back('x');
+            assert(outstanding == 0 || s.capacity() + 1 == outstanding); // the null terminator isn't capacity
+        }
+        s.append(5000, 'y');
+        assert(s.capacity() + 1 == outstanding);
+        assert(s.size() == 6000 && s[999] == 'x' && s[1000] == 'y');
+    }
+    assert(outstanding == 0);
+}
+
+void test_containers() { // the extra capacity from std::allocator is used like any other
+    vector<int> v;
+    for (int i = 0; i < 100'000; ++i) {
+        v.push_back(i);
+    }
+    v.insert(v.begin() + 1, 1000, -1);
+    assert(v.size() == 101'000 && v[0] == 0 && v[1000] == -1 && v[1001] == 1 && v.back() == 99'999);
+
+    string s;
+    for (int i = 0; i < 100'000; ++i) {
+        s.push_back(static_cast<char>('a' + i % 26));
+    }
+    assert(s.size() == 100'000 && s[26] == 'a' && s.back() == static_cast<char>('a' + 99'999 % 26));
+}
+
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+constexpr bool test_constexpr() {
+    allocator<int> al;
+    const auto [ptr, count] = al.allocate_at_least(100);
+    assert(count >= 100);
+    for (size_t i = 0; i < count; ++i) {
+        construct_at(ptr + i, static_cast<int>(i));
+    }
+    destroy_n(ptr, count);
+    al.deallocate(ptr, count);
+    return true;
+}
+static_assert(test_constexpr());
+#endif // __cpp_lib_constexpr_dynamic_alloc
+
+int main() {
+    test_std_allocator<char>();
+    test_std_allocator<int>();
+    test_std_allocator<long double>();
+    test_std_allocator<overaligned>();
+    test_custom_allocators();
+    test_containers();
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+    assert(test_constexpr());
+#endif // __cpp_lib_constexpr_dynamic_alloc
+}
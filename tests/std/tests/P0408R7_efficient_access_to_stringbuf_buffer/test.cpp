@@ -265,6 +265,38 @@ void test_init_buf_ptrs() {
     test_init_buf_ptrs_in(buf5);
 }
 
+// Moving the buffer out reuses it when there's room for a null terminator past the characters, and copies it otherwise.
+void test_move_out_buffer() {
+    // (all of these are too long for the small string buffer, which would copy them regardless)
+    for (const size_t size : {size_t{31}, size_t{32}, size_t{33}, size_t{64}, size_t{1000}}) {
+        const string expected(size, 'x');
+        test_stringbuf buf{ios_base::out};
+        for (const char ch : expected) {
+            buf.sputc(ch);
+        }
+
+        const char* const data = buf.pbase();
+        const bool has_room    = buf.pptr() != buf.epptr();
+        const string moved     = move(buf).str();
+        assert(moved == expected);
+        assert(moved.c_str()[moved.size()] == '\0');
+        assert((moved.data() == data) == has_room);
+        assert(buf.view().empty());
+    }
+
+    {
+        // adopted from a string whose size() == capacity(), so the put area is full
+        string init(large_string);
+        init.resize(init.capacity(), 'y');
+        const string expected = init;
+        test_stringbuf buf{move(init), ios_base::out | ios_base::ate};
+        assert(buf.pptr() == buf.epptr());
+        const string moved = move(buf).str();
+        assert(moved == expected);
+        assert(moved.c_str()[moved.size()] == '\0');
+    }
+}
+
 int main(int argc, char* argv[]) {
     std_testing::death_test_executive exec([] {
         run_test<test_rvalue>();
@@ -279,6 +311,7 @@ int main(int argc, char* argv[]) {
         test_iterator_increment_zero(large_string);
 
         test_init_buf_ptrs();
+        test_move_out_buffer();
     });
 
 #if _ITERATOR_DEBUG_LEVEL > 0
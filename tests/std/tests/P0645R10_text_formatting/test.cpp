@@ -0,0 +1,342 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+template <class... Args>
+bool throws_format_error(const string_view fmt, Args&&... args) {
+    try {
+        (void) vformat(fmt, make_format_args(args...));
+    } catch (const format_error&) {
+        return true;
+    }
+
+    return false;
+}
+
+void test_literal_text() {
+    assert(format("") == "");
+    assert(format("meow") == "meow");
+    assert(format("{{}}") == "{}");
+    assert(format("a{{b}}c{}d", 1) == "a{b}c1d");
+    assert(format("{}{}{}", 1, 2, 3) == "123");
+    assert(format("{1}{0}{1}", 'a', 'b') == "bab");
+}
+
+void test_integers() {
+    assert(format("{}", 0) == "0");
+    assert(format("{}", -42) == "-42");
+    assert(format("{}", numeric_limits<long long>::min()) == "-9223372036854775808");
+    assert(format("{}", numeric_limits<unsigned long long>::max()) == "18446744073709551615");
+    assert(format("{}", static_cast<signed char>(-5)) == "-5");
+    assert(format("{}", static_cast<unsigned short>(65535)) == "65535");
+
+    assert(format("{:d}", 42) == "42");
+    assert(format("{:b}", 5) == "101");
+    assert(format("{:#b}", 5) == "0b101");
+    assert(format("{:#B}", 5) == "0B101");
+    assert(format("{:o}", 8) == "10");
+    assert(format("{:#o}", 8) == "010");
+    assert(format("{:#o}", 0) == "0");
+    assert(format("{:x}", 255) == "ff");
+    assert(format("{:X}", 255) == "FF");
+    assert(format("{:#x}", 255) == "0xff");
+    assert(format("{:#X}", 255) == "0XFF");
+    assert(format("{:c}", 65) == "A");
+
+    assert(format("{:+}", 1) == "+1");
+    assert(format("{:-}", 1) == "1");
+    assert(format("{: }", 1) == " 1");
+    assert(format("{: }", -1) == "-1");
+
+    assert(format("{:6}", 42) == "    42");
+    assert(format("{:<6}", 42) == "42    ");
+    assert(format("{:^6}", 42) == "  42  ");
+    assert(format("{:^7}", 42) == "  42   ");
+    assert(format("{:*>6}", 42) == "****42");
+    assert(format("{:06}", -42) == "-00042");
+    assert(format("{:#06x}", 42) == "0x002a");
+    assert(format("{:<06}", 42) == "42    "); // the '0' option is ignored with an explicit alignment
+    assert(format("{:1}", 12345) == "12345");
+}
+
+void test_bool_and_char() {
+    assert(format("{}", true) == "true");
+    assert(format("{}", false) == "false");
+    assert(format("{:s}", true) == "true");
+    assert(format("{:d}", true) == "1");
+    assert(format("{:#x}", false) == "0x0");
+    assert(format("{:>6}", true) == "  true");
+    assert(format("{:6}", false) == "false ");
+
+    assert(format("{}", 'x') == "x");
+    assert(format("{:3}", 'x') == "x  ");
+    assert(format("{:>3}", 'x') == "  x");
+    assert(format("{:d}", 'A') == "65");
+    assert(format("{:#x}", 'A') == "0x41");
+}
+
+void test_floating_point() {
+    // shortest round-trip representation by default
+    assert(format("{}", 0.0) == "0");
+    assert(format("{}", -0.0) == "-0");
+    assert(format("{}", 0.1) == "0.1");
+    assert(format("{}", 1.5f) == "1.5");
+    assert(format("{}", 1e100) == "1e+100");
+    assert(format("{}", 123456789.0) == "123456789");
+    assert(format("{}", numeric_limits<double>::max()) == "1.7976931348623157e+308");
+    assert(format("{}", numeric_limits<double>::denorm_min()) == "5e-324");
+
+    assert(format("{:.3}", 3.14159) == "3.14");
+    assert(format("{:f}", 3.5) == "3.500000");
+    assert(format("{:.2f}", 3.14159) == "3.14");
+    assert(format("{:.0f}", 2.5) == "2");
+    assert(format("{:F}", 1.0) == "1.000000");
+    assert(format("{:e}", 1234.5) == "1.234500e+03");
+    assert(format("{:.2E}", 1234.5) == "1.23E+03");
+    assert(format("{:g}", 1234.5) == "1234.5");
+    assert(format("{:g}", 1e-10) == "1e-10");
+    assert(format("{:G}", 1e-10) == "1E-10");
+    assert(format("{:a}", 1.0) == "1p+0");
+    assert(format("{:A}", 3.0) == "1.8P+1");
+    assert(format("{:.3a}", 1.0) == "1.000p+0");
+
+    assert(format("{:#}", 1.0) == "1.");
+    assert(format("{:#.0f}", 1.0) == "1.");
+    assert(format("{:#.0e}", 1.0) == "1.e+00");
+    assert(format("{:#g}", 1.0) == "1.00000");
+    assert(format("{:#g}", 0.0) == "0.00000");
+    assert(format("{:#g}", 1.5e10) == "1.50000e+10");
+    assert(format("{:#.3g}", 0.0001) == "0.000100");
+
+    assert(format("{:+}", 1.5) == "+1.5");
+    assert(format("{: }", 1.5) == " 1.5");
+    assert(format("{:8.2f}", -1.5) == "   -1.50");
+    assert(format("{:<8.2f}", -1.5) == "-1.50   ");
+    assert(format("{:08.2f}", -1.5) == "-0001.50");
+    assert(format("{:+08}", 1.5) == "+00001.5");
+
+    constexpr double inf = numeric_limits<double>::infinity();
+    constexpr double nan = numeric_limits<double>::quiet_NaN();
+    assert(format("{}", inf) == "inf");
+    assert(format("{}", -inf) == "-inf");
+    assert(format("{:+}", inf) == "+inf");
+    assert(format("{:F}", inf) == "INF");
+    assert(format("{}", nan) == "nan");
+    assert(format("{:E}", nan) == "NAN");
+    assert(format("{:06}", inf) == "   inf"); // no zero padding for infinity and NaN
+
+    // large outputs exceed the stack buffers
+    assert(format("{:f}", 1e300).size() == 301 + 7);
+    assert(format("{:.1000f}", 1.0) == "1." + string(1000, '0'));
+    assert(format("{:.600e}", 1.0) == "1." + string(600, '0') + "e+00");
+    assert(format("{:#.700g}", 1.0) == "1." + string(699, '0'));
+}
+
+void test_strings() {
+    const char* const c_str = "meow";
+    char array[]            = "purr";
+    const string str        = "hiss";
+
+    assert(format("{}", c_str) == "meow");
+    assert(format("{}", array) == "purr");
+    assert(format("{}", str) == "hiss");
+    assert(format("{}", string_view{"abc"}) == "abc");
+    assert(format("{:s}", "lit") == "lit");
+
+    assert(format("{:6}", "abc") == "abc   ");
+    assert(format("{:>6}", "abc") == "   abc");
+    assert(format("{:^6}", "abc") == " abc  ");
+    assert(format("{:-^7}", "abc") == "--abc--");
+    assert(format("{:.2}", "abc") == "ab");
+    assert(format("{:.5}", "abc") == "abc");
+    assert(format("{:>5.2}", "abc") == "   ab");
+
+    // UTF-8 fill characters, width and precision are counted in code points
+    assert(format("{:\xC3\xA9^5}", 'x') == "\xC3\xA9\xC3\xA9x\xC3\xA9\xC3\xA9");
+    assert(format("{:4}", "\xC3\xA9t\xC3\xA9") == "\xC3\xA9t\xC3\xA9 ");
+    assert(format("{:.1}", "\xC3\xA9t\xC3\xA9") == "\xC3\xA9");
+
+    const string long_str(1000, 'x');
+    assert(format("{}", long_str) == long_str);
+    assert(format("{}{}", long_str, long_str) == long_str + long_str);
+}
+
+void test_pointers() {
+    assert(format("{}", nullptr) == "0x0");
+    const void* const ptr = reinterpret_cast<const void*>(static_cast<uintptr_t>(0x1234));
+    assert(format("{}", ptr) == "0x1234");
+    assert(format("{:p}", ptr) == "0x1234");
+    assert(format("{:8}", ptr) == "  0x1234");
+    assert(format("{:<8}", ptr) == "0x1234  ");
+}
+
+void test_dynamic_specs() {
+    assert(format("{:{}}", 42, 5) == "   42");
+    assert(format("{:>{}.{}}", "abcdef", 6, 3) == "   abc");
+    assert(format("{0:{1}.{2}f}", 3.14159, 8, 2) == "    3.14");
+    assert(format("{:{}}", "x", 3u) == "x  ");
+}
+
+void test_output_destinations() {
+    string str = "prefix:";
+    format_to(back_inserter(str), "{}-{}", 1, "two");
+    assert(str == "prefix:1-two");
+
+    vector<char> vec;
+    format_to(back_inserter(vec), "{:>300}", 'v');
+    assert(vec.size() == 300 && vec.back() == 'v' && vec.front() == ' ');
+
+    char buffer[64] = {};
+    char* const end = format_to(buffer, "{} {}", 42, 1.5);
+    assert(string_view(buffer, static_cast<size_t>(end - buffer)) == "42 1.5");
+
+    list<char> lst;
+    format_to(back_inserter(lst), "{:x<500}", "a");
+    assert(lst.size() == 500 && lst.front() == 'a' && lst.back() == 'x');
+
+    char small[4] = {'#', '#', '#', '#'};
+    const auto res = format_to_n(small, 3, "{}", 123456);
+    assert(res.out == small + 3);
+    assert(res.size == 6);
+    assert(string_view(small, 4) == "123#");
+
+    const auto res_long = format_to_n(small, 2, "{:1000}", 'z');
+    assert(res_long.out == small + 2);
+    assert(res_long.size == 1000);
+    assert(string_view(small, 2) == "z ");
+
+    string truncated;
+    const auto res_it = format_to_n(back_inserter(truncated), 600, "{:>1000}", 'q');
+    assert(res_it.size == 1000);
+    assert(truncated == string(600, ' '));
+
+    const auto res_none = format_to_n(small, -1, "{}", 1);
+    assert(res_none.out == small && res_none.size == 1);
+
+    assert(formatted_size("{}", 12345) == 5);
+    assert(formatted_size("{:>2000}", 'c') == 2000);
+}
+
+void test_wide() {
+    assert(format(L"{}", 42) == L"42");
+    assert(format(L"{}", L'w') == L"w");
+    assert(format(L"{}", 'n') == L"n");
+    assert(format(L"{:>6}", L"abc") == L"   abc");
+    assert(format(L"{:*^7.2f}", 1.5) == L"*1.50**");
+    assert(format(L"{:#x}", 255) == L"0xff");
+    assert(format(L"{}", true) == L"true");
+    assert(format(L"{}", wstring{L"wide"}) == L"wide");
+    assert(formatted_size(L"{}", 1.25) == 4);
+
+    wchar_t buffer[16] = {};
+    wchar_t* const end = format_to(buffer, L"{}{}", 1, L'2');
+    assert(wstring_view(buffer, static_cast<size_t>(end - buffer)) == L"12");
+}
+
+struct point {
+    int x;
+    int y;
+};
+
+template <>
+struct std::formatter<point> : formatter<int> {
+    template <class FormatContext>
+    auto format(const point& p, FormatContext& ctx) const {
+        auto out = ctx.out();
+        *out++   = '(';
+        ctx.advance_to(out);
+        out    = formatter<int>::format(p.x, ctx);
+        *out++ = ',';
+        ctx.advance_to(out);
+        out    = formatter<int>::format(p.y, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
+
+struct label {
+    string_view text;
+};
+
+template <>
+struct std::formatter<label> {
+    constexpr auto parse(format_parse_context& ctx) {
+        return ctx.begin();
+    }
+
+    template <class FormatContext>
+    auto format(const label& l, FormatContext& ctx) const {
+        return format_to(ctx.out(), "[{}]", l.text);
+    }
+};
+
+void test_user_defined_formatters() {
+    assert(format("{}", point{1, -2}) == "(1,-2)");
+    assert(format("{:03}", point{1, 2}) == "(001,002)");
+    assert(format("{:x} and {}", point{10, 11}, 12) == "(a,b) and 12");
+    assert(format("{} {}", label{"meow"}, label{"purr"}) == "[meow] [purr]");
+    static_assert(!is_default_constructible_v<formatter<label, wchar_t>>);
+    static_assert(!is_default_constructible_v<formatter<vector<int>>>);
+}
+
+void test_runtime_errors() {
+    assert(throws_format_error("{", 1));
+    assert(throws_format_error("}", 1));
+    assert(throws_format_error("{0", 1));
+    assert(throws_format_error("{}"));
+    assert(throws_format_error("{1}", 1));
+    assert(throws_format_error("{}{0}", 1));
+    assert(throws_format_error("{0}{}", 1));
+    assert(throws_format_error("{:d}", "str"));
+    assert(throws_format_error("{:.2}", 1));
+    assert(throws_format_error("{:+}", "str"));
+    assert(throws_format_error("{:L}", 1));
+    assert(throws_format_error("{:{}}", 1, "width"));
+    assert(throws_format_error("{:{}}", 1, -1));
+    assert(throws_format_error("{:c}", 1000));
+    assert(throws_format_error("{:99999999999}", 1));
+    assert(throws_format_error("{:{<5}", 1));
+    assert(!throws_format_error("{:}", 1));
+}
+
+void test_format_args() {
+    int i    = 7;
+    double d = 0.5;
+    string s = "str";
+    auto store = make_format_args(i, d, s);
+    const format_args args{store};
+    assert(args.get(0));
+    assert(args.get(2));
+    assert(!args.get(3));
+    assert(visit_format_arg([](auto v) { return is_same_v<decltype(v), int>; }, args.get(0)));
+    assert(visit_format_arg([](auto v) { return is_same_v<decltype(v), string_view>; }, args.get(2)));
+    assert(visit_format_arg([](auto v) { return is_same_v<decltype(v), monostate>; }, args.get(3)));
+    assert(vformat("{} {} {}", args) == "7 0.5 str");
+}
+
+int main() {
+    test_literal_text();
+    test_integers();
+    test_bool_and_char();
+    test_floating_point();
+    test_strings();
+    test_pointers();
+    test_dynamic_specs();
+    test_output_destinations();
+    test_wide();
+    test_user_defined_formatters();
+    test_runtime_errors();
+    test_format_args();
+}
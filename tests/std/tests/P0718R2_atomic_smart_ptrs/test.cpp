@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <memory>
 #include <thread>
+#include <utility>
+#include <vector>
 #ifdef _DEBUG
 #include <crtdbg.h>
 #endif // _DEBUG
@@ -222,12 +224,142 @@ void ensure_nonmember_calls_compile() {
     }
 }
 
+void test_use_count() {
+    // loads give back whatever they borrowed, so only real owners are counted
+    shared_ptr<int> sp = make_shared<int>(42);
+    atomic<shared_ptr<int>> asp(sp);
+    assert(sp.use_count() == 2);
+    {
+        shared_ptr<int> loaded = asp.load();
+        assert(loaded == sp);
+        assert(sp.use_count() == 3);
+    }
+    assert(sp.use_count() == 2);
+
+    shared_ptr<int> expected = sp;
+    assert(asp.compare_exchange_strong(expected, shared_ptr<int>{}));
+    assert(sp.use_count() == 2); // sp and expected
+    expected.reset();
+    assert(asp.compare_exchange_strong(expected, sp));
+    assert(sp.use_count() == 2);
+    assert(asp.exchange(nullptr) == sp);
+    assert(sp.use_count() == 1);
+
+    atomic<weak_ptr<int>> awp(sp);
+    assert(sp.use_count() == 1);
+    assert(awp.load().lock() == sp);
+    sp.reset();
+    assert(awp.load().expired());
+}
+
+void test_aliasing() {
+    // the stored pointer and the control block are compared and replaced together
+    auto owner = make_shared<pair<int, int>>(1, 2);
+    shared_ptr<int> first(owner, &owner->first);
+    shared_ptr<int> second(owner, &owner->second);
+    atomic<shared_ptr<int>> asp(first);
+
+    shared_ptr<int> expected = second;
+    assert(!asp.compare_exchange_strong(expected, second));
+    assert(expected == first);
+    assert(asp.compare_exchange_strong(expected, second));
+    assert(*asp.load() == 2);
+
+    shared_ptr<int> unowned(shared_ptr<int>{}, &owner->first);
+    asp.store(unowned);
+    assert(asp.load().get() == &owner->first);
+    assert(asp.load().use_count() == 0);
+    assert(owner.use_count() == 4); // owner, first, second, and expected
+}
+
+struct snapshot {
+    explicit snapshot(const int value_) noexcept : value(value_), copy(value_) {
+        ++live_snapshots;
+    }
+
+    snapshot(const snapshot&) = delete;
+    snapshot& operator=(const snapshot&) = delete;
+
+    ~snapshot() {
+        assert(value == copy);
+        value = -1;
+        --live_snapshots;
+    }
+
+    int value;
+    int copy;
+
+    static atomic<int> live_snapshots;
+};
+
+atomic<int> snapshot::live_snapshots{0};
+
+void test_publish_snapshots() {
+    // readers race with a writer that keeps replacing, and so releasing, the only other owner of each snapshot
+    constexpr int snapshots = 20'000;
+    {
+        atomic<shared_ptr<const snapshot>> current(make_shared<const snapshot>(0));
+        atomic<bool> done{false};
+        vector<thread> readers;
+        for (int i = 0; i < 4; ++i) {
+            readers.emplace_back([&] {
+                int last = 0;
+                while (!done.load()) {
+                    const shared_ptr<const snapshot> seen = current.load();
+                    assert(seen->value == seen->copy);
+                    assert(seen->value >= last);
+                    last = seen->value;
+
+                    weak_ptr<const snapshot> observer = seen;
+                    assert(!observer.expired());
+                }
+            });
+        }
+
+        for (int i = 1; i <= snapshots; ++i) {
+            if (i % 2 == 0) {
+                current.store(make_shared<const snapshot>(i));
+            } else {
+                shared_ptr<const snapshot> expected = current.load();
+                while (!current.compare_exchange_weak(expected, make_shared<const snapshot>(i))) {
+                }
+            }
+        }
+
+        done.store(true);
+        for (auto& reader : readers) {
+            reader.join();
+        }
+
+        assert(current.load()->value == snapshots);
+    }
+
+    assert(snapshot::live_snapshots.load() == 0);
+}
+
 int main() {
     // These values for is_always_lock_free are not required by the standard, but they are true for our implementation.
+#ifdef _WIN64
+    // loads and stores are lock-free wherever 16-byte atomics are
+    struct two_pointers {
+        void* first;
+        void* second;
+    };
+
+    static_assert(atomic<shared_ptr<int>>::is_always_lock_free == atomic<two_pointers>::is_always_lock_free);
+    static_assert(atomic<weak_ptr<int>>::is_always_lock_free == atomic<two_pointers>::is_always_lock_free);
+    assert(atomic_sptr.is_lock_free() == atomic<two_pointers>{}.is_lock_free());
+    assert(atomic_wptr.is_lock_free() == atomic<two_pointers>{}.is_lock_free());
+#else // ^^^ defined(_WIN64) / !defined(_WIN64) vvv
     static_assert(atomic<shared_ptr<int>>::is_always_lock_free == false);
     static_assert(atomic<weak_ptr<int>>::is_always_lock_free == false);
     assert(atomic_sptr.is_lock_free() == false);
     assert(atomic_wptr.is_lock_free() == false);
+#endif // ^^^ !defined(_WIN64) ^^^
+
+    test_use_count();
+    test_aliasing();
+    test_publish_snapshots();
 
     run_test(test_shared_ptr_load_store);
     run_test(test_shared_ptr_exchange);
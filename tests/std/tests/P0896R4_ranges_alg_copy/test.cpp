@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <concepts>
 #include <ranges>
@@ -48,7 +49,33 @@ struct instantiator {
     }
 };
 
+constexpr bool test_view_pipelines() {
+    // filter_view, transform_view and take_view drive copy with a single internal loop; the results must match those
+    // of iterating with their iterators
+    int input[]        = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto is_even       = [](int x) { return x % 2 == 0; };
+    auto square        = [](int x) { return x * x; };
+    auto evens_squared = input | views::filter(is_even) | views::transform(square);
+
+    int output[5] = {};
+    auto result   = ranges::copy(evens_squared, output);
+    assert(result.in == evens_squared.end());
+    assert(result.out == ranges::end(output));
+    assert(ranges::equal(output, array{4, 16, 36, 64, 100}));
+
+    int taken_output[3] = {};
+    auto first_three    = evens_squared | views::take(3);
+    auto taken_result   = ranges::copy(first_three, taken_output);
+    assert(taken_result.in == first_three.end());
+    assert(taken_result.out == ranges::end(taken_output));
+    assert(ranges::equal(taken_output, array{4, 16, 36}));
+    return true;
+}
+
 int main() {
     STATIC_ASSERT((test_in_write<instantiator, int const, int>(), true));
     test_in_write<instantiator, int const, int>();
+
+    STATIC_ASSERT(test_view_pipelines());
+    test_view_pipelines();
 }
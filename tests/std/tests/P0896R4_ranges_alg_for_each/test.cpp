@@ -61,7 +61,41 @@ struct instantiator {
     }
 };
 
+constexpr bool test_view_pipelines() {
+    // filter_view, transform_view and take_view drive for_each with a single internal loop; the results must match
+    // those of iterating with their iterators
+    int input[]        = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto is_even       = [](int x) { return x % 2 == 0; };
+    auto square        = [](int x) { return x * x; };
+    auto evens_squared = input | views::filter(is_even) | views::transform(square);
+
+    int sum     = 0;
+    auto result = ranges::for_each(evens_squared, [&sum](int x) { sum += x; });
+    assert(sum == 220);
+    assert(result.in == evens_squared.end());
+
+    sum               = 0;
+    auto first_three  = evens_squared | views::take(3);
+    auto taken_result = ranges::for_each(first_three, [&sum](int x) { sum += x; }, [](int x) { return -x; });
+    assert(sum == -56);
+    assert(taken_result.in == first_three.end());
+    assert(taken_result.in.count() == 0);
+
+    // a take_view longer than its underlying range ends with that range
+    auto capped = input | views::filter(is_even) | views::take(10);
+    sum         = 0;
+    assert(ranges::for_each(capped, [&sum](int x) { sum += x; }).in == capped.end());
+    assert(sum == 30);
+
+    STATIC_ASSERT(same_as<decltype(ranges::for_each(input | views::filter(is_even), identity{})),
+        ranges::for_each_result<ranges::dangling, identity>>);
+    return true;
+}
+
 int main() {
     STATIC_ASSERT((test_in<instantiator, P>(), true));
     test_in<instantiator, P>();
+
+    STATIC_ASSERT(test_view_pipelines());
+    test_view_pipelines();
 }
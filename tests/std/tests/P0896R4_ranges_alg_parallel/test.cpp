@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <execution>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+struct keyed {
+    int key;
+    int payload;
+};
+
+template <class ExPo>
+void test_policy(const ExPo& exec) {
+    constexpr int count = 100'000;
+
+    vector<keyed> v(count);
+    for (int i = 0; i < count; ++i) {
+        v[static_cast<size_t>(i)] = {count - 1 - i, i};
+    }
+
+    { // projections are applied before the predicate
+        const same_as<vector<keyed>::iterator> auto found =
+            ranges::find_if(exec, v, [](int k) { return k == 7; }, &keyed::key);
+        assert(found->payload == count - 8);
+        assert(ranges::find_if_not(exec, v.begin(), v.end(), [](int k) { return k > 0; }, &keyed::key) == v.end() - 1);
+        assert(ranges::find(exec, v, 42, &keyed::key)->payload == count - 43);
+        assert(ranges::count(exec, v, 42, &keyed::key) == 1);
+        assert(ranges::count_if(exec, v, [](int k) { return k % 2 == 0; }, &keyed::key) == count / 2);
+        assert(ranges::all_of(exec, v, [](int k) { return k >= 0; }, &keyed::key));
+        assert(ranges::any_of(exec, v.begin(), v.end(), [](int k) { return k == 0; }, &keyed::key));
+        assert(ranges::none_of(exec, v, [](int k) { return k < 0; }, &keyed::key));
+    }
+
+    { // for_each and for_each_n return the end of the input
+        atomic<long long> sum{0};
+        const same_as<vector<keyed>::iterator> auto last =
+            ranges::for_each(exec, v, [&](int k) { sum += k; }, &keyed::key);
+        assert(last == v.end());
+        assert(sum == static_cast<long long>(count) * (count - 1) / 2);
+
+        const auto mid = ranges::for_each_n(exec, v.begin(), count / 2, [](keyed& e) { e.payload = -1; });
+        assert(mid == v.begin() + count / 2);
+        assert(v.front().payload == -1 && v.back().payload == count - 1);
+    }
+
+    { // transform, fill, and sort
+        vector<int> keys(count);
+        const auto result = ranges::transform(exec, v, keys.begin(), [](int k) { return k * 2; }, &keyed::key);
+        assert(result.in == v.end());
+        assert(result.out == keys.end());
+        assert(keys.front() == 2 * (count - 1));
+
+        assert(ranges::sort(exec, v, ranges::less{}, &keyed::key) == v.end());
+        assert(ranges::is_sorted(v, ranges::less{}, &keyed::key));
+        assert(ranges::sort(exec, keys.begin(), keys.end(), ranges::greater{}) == keys.end());
+        assert(ranges::is_sorted(keys, ranges::greater{}));
+
+        assert(ranges::fill(exec, keys, 5) == keys.end());
+        assert(ranges::count(keys, 5) == count);
+    }
+
+    { // non-C++17 iterators fall back to the serial algorithms
+        const auto io = views::iota(0, 1000);
+        assert(ranges::count_if(exec, io, [](int i) { return i < 10; }) == 10);
+        assert(*ranges::find(exec, io.begin(), io.end(), 500) == 500);
+    }
+}
+
+int main() {
+    test_policy(seq);
+    test_policy(par);
+    test_policy(par_unseq);
+#if _HAS_CXX20
+    test_policy(unseq);
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range_algorithm_support.hpp>
+using namespace std;
+
+template <class Rng>
+concept CanViewJoin = requires(Rng&& r) {
+    views::join(static_cast<Rng&&>(r));
+};
+
+constexpr bool test_glvalue_inner() {
+    int storage[]      = {0, 1, 2, 3, 4, 5};
+    span<int> nested[] = {{storage, 2}, {}, {storage + 2, 1}, {}, {}, {storage + 3, 3}, {}};
+    constexpr int expected[] = {0, 1, 2, 3, 4, 5};
+
+    auto joined = views::join(nested);
+    using R     = decltype(joined);
+    STATIC_ASSERT(same_as<R, ranges::join_view<ranges::ref_view<span<int>[7]>>>);
+    STATIC_ASSERT(ranges::bidirectional_range<R>);
+    STATIC_ASSERT(ranges::common_range<R>);
+    STATIC_ASSERT(!ranges::random_access_range<R>);
+    STATIC_ASSERT(!ranges::sized_range<R>);
+    STATIC_ASSERT(same_as<ranges::range_reference_t<R>, int&>);
+    STATIC_ASSERT(same_as<ranges::range_reference_t<const R>, int&>);
+    STATIC_ASSERT(same_as<iterator_traits<ranges::iterator_t<R>>::iterator_category, bidirectional_iterator_tag>);
+
+    assert(ranges::equal(joined, expected));
+    assert(ranges::equal(as_const(joined), expected));
+    assert(ranges::equal(nested | views::join | views::reverse, expected | views::reverse));
+
+    auto it = ranges::next(joined.begin(), 3);
+    assert(*it == 3);
+    --it;
+    assert(*it == 2);
+    --it;
+    assert(*it == 1);
+
+    // iter_swap and iter_move reach through to the inner elements
+    ranges::iter_swap(joined.begin(), ranges::next(joined.begin(), 5));
+    assert(storage[0] == 5 && storage[5] == 0);
+    assert(ranges::iter_move(joined.begin()) == 5);
+
+    span<int> empty_nested[] = {{}, {}};
+    assert(ranges::empty(views::join(empty_nested)));
+    return true;
+}
+
+constexpr bool test_prvalue_inner() {
+    // the inner ranges are prvalues, so the view stores the current one and is only an input range
+    int arr[]   = {1, 2, 3};
+    auto joined = arr | views::transform([](int i) { return views::single(i * 10); }) | views::join;
+    using R     = decltype(joined);
+    STATIC_ASSERT(ranges::input_range<R>);
+    STATIC_ASSERT(!ranges::forward_range<R>);
+    STATIC_ASSERT(!ranges::range<const R>);
+    STATIC_ASSERT(!CanViewJoin<const R&>);
+
+    constexpr int expected[] = {10, 20, 30};
+    assert(ranges::equal(joined, expected));
+    return true;
+}
+
+void test_containers() {
+    vector<vector<int>> nested{{0, 1}, {}, {2}};
+    auto joined = views::join(nested);
+    ranges::iterator_t<const decltype(joined)> ci = joined.begin(); // iterators convert to their const counterparts
+    assert(*ci == 0);
+    assert(ranges::distance(joined) == 3);
+
+    // join over non-common inner ranges; the sentinel compares only the outer iterators
+    const string_view words[] = {"hello", "", ", ", "world"};
+    string joined_words;
+    for (const char c : words | views::join) {
+        joined_words.push_back(c);
+    }
+    assert(joined_words == "hello, world");
+
+    forward_list<list<char>> lists{{'a', 'b'}, {}, {'c'}};
+    auto fwd = views::join(lists);
+    STATIC_ASSERT(ranges::forward_range<decltype(fwd)>);
+    STATIC_ASSERT(!ranges::bidirectional_range<decltype(fwd)>);
+    assert(ranges::equal(fwd, "abc"sv));
+}
+
+int main() {
+    test_glvalue_inner();
+    STATIC_ASSERT(test_glvalue_inner());
+    test_prvalue_inner();
+    STATIC_ASSERT(test_prvalue_inner());
+    test_containers();
+}
@@ -129,5 +129,9 @@ int main() {
     assert(s.capacity() == 1007);
     s.reserve(1008); // increase capacity geometrically
     assert(s.size() == 3);
+#if _HAS_CXX23 // allocate_at_least fills the rest of the heap block
+    assert(s.capacity() >= 1510 && s.capacity() - 1510 < __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+#else // ^^^ _HAS_CXX23 / !_HAS_CXX23 vvv
     assert(s.capacity() == 1510);
+#endif // ^^^ !_HAS_CXX23 ^^^
 }
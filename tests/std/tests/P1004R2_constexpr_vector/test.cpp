@@ -613,6 +613,14 @@ _CONSTEXPR20_CONTAINER bool test_iterators() {
     return true;
 }
 
+_CONSTEXPR20_CONTAINER bool grown_to(const vector<int>& v, const size_t expected) {
+#if _HAS_CXX23 // geometric growth, plus any elements that allocate_at_least fits into the rest of the heap block
+    return v.capacity() >= expected && (v.capacity() - expected) * sizeof(int) < __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else // ^^^ _HAS_CXX23 / !_HAS_CXX23 vvv
+    return v.capacity() == expected;
+#endif // ^^^ !_HAS_CXX23 ^^^
+}
+
 _CONSTEXPR20_CONTAINER bool test_growth() {
 #if defined(__EDG__) \
     || _ITERATOR_DEBUG_LEVEL != 2 // || defined(MSVC_INTERNAL_TESTING) // TRANSITION, VSO-1270433, VSO-1275530
@@ -625,7 +633,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.resize(1003);
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -637,7 +645,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.resize(8000);
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
     }
 
     {
@@ -649,7 +657,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.push_back(47);
 
         assert(v.size() == 1001);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
     }
 
     {
@@ -664,7 +672,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.insert(v.end(), l.begin(), l.end());
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
 #endif // !defined(__EDG__) || _ITERATOR_DEBUG_LEVEL != 2
     }
 
@@ -680,7 +688,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.insert(v.end(), l.begin(), l.end());
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
 #endif // !defined(__EDG__) || _ITERATOR_DEBUG_LEVEL != 2
     }
 
@@ -694,7 +702,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.insert(v.end(), 3, 47);
 
         assert(v.size() == 1003);
-        assert(v.capacity() == 1500);
+        assert(grown_to(v, 1500));
 #endif // __EDG__
     }
 
@@ -708,7 +716,7 @@ _CONSTEXPR20_CONTAINER bool test_growth() {
         v.insert(v.end(), 7000, 47);
 
         assert(v.size() == 8000);
-        assert(v.capacity() == 8000);
+        assert(grown_to(v, 8000));
 #endif // __EDG__
     }
 #endif // defined(__EDG__) || _ITERATOR_DEBUG_LEVEL != 2 || defined(MSVC_INTERNAL_TESTING)
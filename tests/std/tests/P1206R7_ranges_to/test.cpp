@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    static inline int allocations = 0;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+void test_explicit_container() {
+    const vector<int> v{1, 2, 3, 4};
+
+    same_as<vector<int>> auto copied = ranges::to<vector<int>>(v);
+    assert(copied == v);
+
+    same_as<list<int>> auto linked = ranges::to<list<int>>(v);
+    assert(ranges::equal(linked, v));
+
+    same_as<vector<long>> auto widened = v | ranges::to<vector<long>>();
+    assert(ranges::equal(widened, v));
+
+    // non-common, sized, random-access source
+    same_as<vector<int>> auto prefix = ranges::to<vector<int>>(views::counted(v.begin(), 3));
+    assert(prefix.size() == 3);
+    assert(prefix.back() == 3);
+
+    same_as<string> auto str = ranges::to<string>(string_view{"hello"} | views::take(4));
+    assert(str == "hell");
+
+    same_as<map<int, int>> auto squares =
+        v | views::transform([](int i) { return pair{i, i * i}; }) | ranges::to<map<int, int>>();
+    assert(squares.size() == 4);
+    assert(squares.at(3) == 9);
+}
+
+void test_deduced_container() {
+    const vector<int> v{4, 1, 3, 1};
+
+    same_as<vector<int>> auto doubled = v | views::transform([](int i) { return i * 2; }) | ranges::to<vector>();
+    assert(doubled == (vector<int>{8, 2, 6, 2}));
+
+    same_as<set<int>> auto unique = ranges::to<set>(v);
+    assert(unique.size() == 3);
+
+    same_as<deque<int>> auto iota = ranges::to<deque>(views::iota(0, 5));
+    assert(iota.size() == 5);
+    assert(iota.back() == 4);
+
+    same_as<vector<int>> auto reversed = v | views::reverse | ranges::to<vector>();
+    assert(reversed.front() == 1);
+    assert(reversed.back() == 4);
+}
+
+void test_nested_ranges() {
+    const vector<vector<int>> vv{{1, 2}, {3}, {}};
+
+    same_as<list<list<int>>> auto nested = ranges::to<list<list<int>>>(vv);
+    assert(nested.size() == 3);
+    assert(nested.front().size() == 2);
+    assert(nested.back().empty());
+}
+
+void test_reservation() {
+    using counted_vector = vector<int, counting_allocator<int>>;
+
+    // sized sources allocate exactly once, even when their iterators are only C++17 input iterators
+    counting_allocator<int>::allocations = 0;
+    const auto squares = views::iota(0, 1000) | views::transform([](int i) { return i * i; });
+    const auto vec     = ranges::to<counted_vector>(squares);
+    assert(vec.size() == 1000);
+    assert(vec.back() == 999 * 999);
+    assert(counting_allocator<int>::allocations == 1);
+
+    const vector<int> contiguous(1000, 7);
+    counting_allocator<int>::allocations = 0;
+    const auto copied = contiguous | ranges::to<counted_vector>(counting_allocator<int>{});
+    assert(copied.size() == 1000);
+    assert(counting_allocator<int>::allocations == 1);
+}
+
+int main() {
+    test_explicit_container();
+    test_deduced_container();
+    test_nested_ranges();
+    test_reservation();
+}
@@ -29,7 +29,7 @@ import <deque>;
 import <exception>;
 import <execution>;
 import <filesystem>;
-// import <format>;
+import <format>;
 import <forward_list>;
 import <fstream>;
 import <functional>;
@@ -294,7 +294,11 @@ int main() {
 
     {
         puts("Testing <format>.");
-        puts("(TRANSITION, not yet implemented.)");
+        assert(format("{} {:>5} {:.2f}", 42, "abc", 3.14159) == "42   abc 3.14");
+        char buf[8]{};
+        const auto result = format_to_n(buf, 4, "{:x}", 0xc0ffee);
+        assert(result.size == 6);
+        assert(string_view(buf, 4) == "c0ff");
     }
 
     {
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <forward_list>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range_algorithm_support.hpp>
+using namespace std;
+
+template <class Rng, class Delim>
+concept CanViewSplit = requires(Rng&& r, Delim&& d) {
+    views::split(static_cast<Rng&&>(r), static_cast<Delim&&>(d));
+};
+
+template <ranges::range Rng, ranges::range Expected>
+constexpr bool equal_pieces(Rng&& pieces, const Expected& expected) {
+    auto it = ranges::begin(expected);
+    for (auto&& piece : pieces) {
+        if (it == ranges::end(expected) || !ranges::equal(piece, *it)) {
+            return false;
+        }
+        ++it;
+    }
+    return it == ranges::end(expected);
+}
+
+constexpr bool test_string_view() {
+    constexpr string_view text       = "the  quick brown fox ";
+    constexpr string_view expected[] = {"the", "", "quick", "brown", "fox", ""};
+
+    auto pieces = text | views::split(' ');
+    using R     = decltype(pieces);
+    STATIC_ASSERT(same_as<R, ranges::split_view<string_view, ranges::single_view<char>>>);
+    STATIC_ASSERT(ranges::forward_range<R>);
+    STATIC_ASSERT(ranges::common_range<R>);
+    STATIC_ASSERT(!ranges::range<const R>);
+    STATIC_ASSERT(same_as<ranges::range_value_t<R>, ranges::subrange<string_view::iterator>>);
+    assert(equal_pieces(pieces, expected));
+
+    // the cached first piece survives repeated calls to begin
+    assert(ranges::equal(*pieces.begin(), *pieces.begin()));
+
+    // multi-element pattern
+    constexpr string_view csv            = "a, b,, c";
+    constexpr string_view csv_expected[] = {"a", "b,", "c"};
+    assert(equal_pieces(views::split(csv, ", "sv), csv_expected));
+
+    // a pattern that never matches yields the whole range, and an empty range yields nothing
+    constexpr string_view whole[] = {"abc"};
+    assert(equal_pieces(views::split("abc"sv, "xyz"sv), whole));
+    assert(ranges::empty(views::split(string_view{}, ' ')));
+
+    // an empty pattern splits between elements
+    constexpr string_view letters[] = {"a", "b", "c"};
+    assert(equal_pieces(views::split("abc"sv, string_view{}), letters));
+    return true;
+}
+
+constexpr bool test_non_char() {
+    int arr[]                  = {1, 0, 2, 3, 0, 0, 4};
+    span<const int> expected[] = {{arr, 1}, {arr + 2, 2}, {}, {arr + 6, 1}};
+    assert(equal_pieces(arr | views::split(0), expected));
+
+    // wider integral elements take the same vectorized search
+    long wide[]                      = {1, 0, 2};
+    span<const long> wide_expected[] = {{wide, 1}, {wide + 2, 1}};
+    assert(equal_pieces(views::split(wide, 0L), wide_expected));
+    return true;
+}
+
+void test_forward_list() {
+    forward_list<char> chars{'x', '-', 'y', '-'};
+    const vector<string> expected{"x", "y", ""};
+    auto pieces = chars | views::split('-');
+    STATIC_ASSERT(ranges::forward_range<decltype(pieces)>);
+    assert(equal_pieces(pieces, expected));
+
+    STATIC_ASSERT(!CanViewSplit<test::range<input_iterator_tag, char>&, char>);
+}
+
+int main() {
+    test_string_view();
+    STATIC_ASSERT(test_string_view());
+    test_non_char();
+    STATIC_ASSERT(test_non_char());
+    test_forward_list();
+}
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <range_algorithm_support.hpp>
+using namespace std;
+
+template <class Rng>
+concept CanViewChunk = requires(Rng&& r) {
+    views::chunk(static_cast<Rng&&>(r), 2);
+};
+
+template <class Rng>
+concept CanViewSlide = requires(Rng&& r) {
+    views::slide(static_cast<Rng&&>(r), 2);
+};
+
+constexpr bool test_chunk() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6};
+
+    // chunks of a contiguous range are spans
+    auto chunks = views::chunk(arr, 3);
+    using R     = decltype(chunks);
+    STATIC_ASSERT(same_as<R, ranges::chunk_view<ranges::ref_view<int[7]>>>);
+    STATIC_ASSERT(same_as<ranges::range_value_t<R>, span<int>>);
+    STATIC_ASSERT(ranges::random_access_range<R>);
+    STATIC_ASSERT(ranges::sized_range<R>);
+    STATIC_ASSERT(ranges::common_range<R>);
+    assert(chunks.size() == 3);
+    assert(ranges::equal(chunks[0], span{arr, 3}));
+    assert(ranges::equal(chunks[2], span{arr + 6, 1}));
+    assert(chunks.end() - chunks.begin() == 3);
+    assert(ranges::equal(*ranges::prev(chunks.end()), span{arr + 6, 1}));
+    assert(ranges::equal(*(chunks.end() - 2), span{arr + 3, 3}));
+
+    auto it = chunks.begin();
+    it += 2;
+    assert(it[0].size() == 1);
+    it -= 2;
+    assert(it == chunks.begin());
+    assert(ranges::next(it, 3) == chunks.end());
+
+    for (const span<int> chunk : arr | views::chunk(2)) {
+        chunk[0] = -chunk[0];
+    }
+    assert(arr[0] == 0 && arr[2] == -2 && arr[6] == -6);
+
+    // evenly divided ranges have no partial last chunk
+    assert(ranges::distance(views::chunk(arr, 7)) == 1);
+    assert(ranges::distance(views::chunk(arr, 100)) == 1);
+    assert(ranges::empty(views::chunk(span<int>{}, 2)));
+
+    STATIC_ASSERT(!CanViewChunk<test::range<input_iterator_tag, int>&>);
+    return true;
+}
+
+constexpr bool test_stride() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto strided = arr | views::stride(3);
+    using R      = decltype(strided);
+    STATIC_ASSERT(same_as<R, ranges::stride_view<ranges::ref_view<int[8]>>>);
+    STATIC_ASSERT(ranges::random_access_range<R>);
+    STATIC_ASSERT(ranges::common_range<R>);
+    STATIC_ASSERT(same_as<ranges::range_reference_t<R>, int&>);
+    assert(strided.size() == 3);
+    assert(strided.stride() == 3);
+
+    constexpr int expected[] = {0, 3, 6};
+    assert(ranges::equal(strided, expected));
+    assert(ranges::equal(strided | views::reverse, expected | views::reverse));
+    assert(strided[1] == 3);
+    assert(strided.end() - strided.begin() == 3);
+    return true;
+}
+
+constexpr bool test_slide() {
+    int arr[] = {0, 1, 2, 3, 4};
+
+    // windows of a contiguous range are spans
+    auto windows = views::slide(arr, 3);
+    using R      = decltype(windows);
+    STATIC_ASSERT(same_as<ranges::range_value_t<R>, span<int>>);
+    STATIC_ASSERT(ranges::random_access_range<R>);
+    STATIC_ASSERT(ranges::random_access_range<const R>);
+    assert(windows.size() == 3);
+    assert(ranges::equal(windows[0], span{arr, 3}));
+    assert(ranges::equal(windows[2], span{arr + 2, 3}));
+    assert(windows.end() - windows.begin() == 3);
+    assert(ranges::empty(views::slide(arr, 6)));
+    assert(views::slide(arr, 5).size() == 1);
+    return true;
+}
+
+void test_non_random_access() {
+    constexpr int expected[] = {0, 1, 2, 3, 4};
+
+    list<int> lst{0, 1, 2, 3, 4};
+    auto list_chunks = lst | views::chunk(2);
+    STATIC_ASSERT(same_as<ranges::range_value_t<decltype(list_chunks)>, ranges::subrange<list<int>::iterator>>);
+    STATIC_ASSERT(ranges::bidirectional_range<decltype(list_chunks)>);
+    assert(ranges::distance(list_chunks) == 3);
+    assert(ranges::equal(*ranges::prev(list_chunks.end()), span{expected + 4, 1}));
+    assert(ranges::equal(*ranges::prev(list_chunks.end(), 2), span{expected + 2, 2}));
+
+    // non-sized ranges cache the end of the first window
+    auto list_windows = lst | views::slide(2);
+    STATIC_ASSERT(ranges::bidirectional_range<decltype(list_windows)>);
+    STATIC_ASSERT(ranges::common_range<decltype(list_windows)>);
+    STATIC_ASSERT(!CanViewSlide<const decltype(list_windows)&>);
+    assert(ranges::distance(list_windows) == 4);
+    assert(ranges::equal(*ranges::prev(list_windows.end()), span{expected + 3, 2}));
+
+    forward_list<int> fl{0, 1, 2, 3, 4};
+    auto fwd_windows = fl | views::slide(2);
+    STATIC_ASSERT(!ranges::common_range<decltype(fwd_windows)>);
+    assert(ranges::distance(fwd_windows) == 4);
+    assert(ranges::empty(views::slide(fl, 6)));
+
+    auto fwd_strided = views::stride(fl, 2);
+    STATIC_ASSERT(ranges::forward_range<decltype(fwd_strided)>);
+    constexpr int strided_expected[] = {0, 2, 4};
+    assert(ranges::equal(fwd_strided, strided_expected));
+}
+
+int main() {
+    test_chunk();
+    STATIC_ASSERT(test_chunk());
+    test_stride();
+    STATIC_ASSERT(test_stride());
+    test_slide();
+    STATIC_ASSERT(test_slide());
+    test_non_random_access();
+}
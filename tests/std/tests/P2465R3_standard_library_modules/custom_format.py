@@ -0,0 +1,56 @@
+# Copyright (c) Microsoft Corporation.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import re
+
+from stl.test.format import STLTestFormat, TestStep
+from stl.test.tests import TestType
+
+
+class CustomTestFormat(STLTestFormat):
+    def getBuildSteps(self, test, litConfig, shared):
+        outputDir, outputBase = test.getTempPaths()
+        sourcePath = test.getSourcePath()
+        modulesDir = os.path.join(os.path.dirname(litConfig.cxx_headers), 'modules')
+        stdModulePath = os.path.join(modulesDir, 'std.ixx')
+        stdCompatModulePath = os.path.join(modulesDir, 'std.compat.ixx')
+
+        with open(stdModulePath) as stdModule:
+            stlHeaders = re.findall(r'^export import <([^>]+)>;$', stdModule.read(), re.MULTILINE)
+
+        exportHeaderOptions = ['/exportHeader', '/Fo', '/MP']
+        headerUnitOptions = []
+        objects = []
+        for header in stlHeaders:
+            headerAbsolutePath = os.path.join(litConfig.cxx_headers, header)
+
+            exportHeaderOptions.append(headerAbsolutePath)
+
+            headerUnitOptions.append('/headerUnit')
+            headerUnitOptions.append('{0}={1}.ifc'.format(headerAbsolutePath, header))
+
+            objects.append(os.path.join(outputDir, header + '.obj'))
+
+        cmd = [test.cxx, *test.flags, *test.compileFlags, *exportHeaderOptions]
+        yield TestStep(cmd, shared.execDir, shared.env, False)
+
+        cmd = [test.cxx, '/c', stdModulePath, *test.flags, *test.compileFlags, *headerUnitOptions]
+        yield TestStep(cmd, shared.execDir, shared.env, False)
+
+        cmd = [test.cxx, '/c', stdCompatModulePath, *test.flags, *test.compileFlags, *headerUnitOptions,
+               '/reference', 'std=std.ifc']
+        yield TestStep(cmd, shared.execDir, shared.env, False)
+
+        moduleOptions = [*headerUnitOptions, '/reference', 'std=std.ifc', '/reference', 'std.compat=std.compat.ifc']
+        objects.append(os.path.join(outputDir, 'std.obj'))
+        objects.append(os.path.join(outputDir, 'std.compat.obj'))
+
+        if TestType.COMPILE in test.testType:
+            cmd = [test.cxx, '/c', sourcePath, *test.flags, *test.compileFlags, *moduleOptions]
+        elif TestType.RUN in test.testType:
+            shared.execFile = outputBase + '.exe'
+            cmd = [test.cxx, sourcePath, *test.flags, *test.compileFlags, *moduleOptions, *objects,
+                   '/Fe' + shared.execFile, '/link', *test.linkFlags]
+
+        yield TestStep(cmd, shared.execDir, shared.env, False)
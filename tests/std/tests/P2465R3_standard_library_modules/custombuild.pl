@@ -0,0 +1,34 @@
+# Copyright (c) Microsoft Corporation.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+use Run;
+
+sub CustomBuildHook()
+{
+    my $cwd = Run::GetCWDName();
+    my $stl_include_dir = $ENV{STL_INCLUDE_DIR};
+    my $stl_modules_dir = "$stl_include_dir/../modules";
+
+    open(my $std_module, "<", "$stl_modules_dir/std.ixx") or die "Cannot open std.ixx: $!";
+    my @stl_headers = map { /^export import <([^>]+)>;\s*$/ ? ($1) : () } <$std_module>;
+    close($std_module);
+
+    my $export_header_options = "/exportHeader /Fo /MP";
+    my $header_unit_options = "";
+    my $objects = "";
+
+    foreach (@stl_headers) {
+        $export_header_options .= " $stl_include_dir/$_";
+
+        $header_unit_options .= " /headerUnit";
+        $header_unit_options .= " $stl_include_dir/$_=$_.ifc";
+        $objects .= " $_.obj";
+    }
+
+    Run::ExecuteCL("$export_header_options");
+    Run::ExecuteCL("/c $stl_modules_dir/std.ixx $header_unit_options");
+    Run::ExecuteCL("/c $stl_modules_dir/std.compat.ixx $header_unit_options /reference std=std.ifc");
+    Run::ExecuteCL("test.cpp /Fe$cwd.exe $header_unit_options /reference std=std.ifc"
+        . " /reference std.compat=std.compat.ifc $objects std.obj std.compat.obj");
+}
+1
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The named modules std and std.compat export the whole Standard Library; std.compat also provides the C library
+// names in the global namespace. Macros aren't exported, so assert comes from <assert.h>.
+
+import std;
+import std.compat;
+
+#include <assert.h>
+#include <force_include.hpp>
+
+int main() {
+    {
+        std::vector<int> v{3, 1, 2};
+        std::ranges::sort(v);
+        assert((v == std::vector<int>{1, 2, 3}));
+        assert(std::accumulate(v.begin(), v.end(), 0) == 6);
+    }
+
+    {
+        std::map<std::string, int> m{{"koshka", 1}, {"cat", 2}};
+        assert(m.at("cat") == 2);
+        std::unordered_set<std::string_view> s{"meow", "purr"};
+        assert(s.contains("purr"));
+    }
+
+    {
+        std::ostringstream os;
+        os << std::format("{}-{:04}", 555, 123);
+        assert(os.str() == "555-0123");
+        assert(std::regex_match(os.str(), std::regex{R"(\d{3}-\d{4})"}));
+    }
+
+    {
+        constexpr std::optional<int> o{1729};
+        static_assert(*o == 1729);
+        std::variant<int, double> var{7.5};
+        assert(std::get<double>(var) == 7.5);
+        const auto p          = std::make_unique<int>();
+        const std::string str = "42";
+        assert(std::from_chars(str.data(), str.data() + str.size(), *p).ec == std::errc{});
+        assert(*p == 42);
+    }
+
+    {
+        std::atomic<int> atom{0};
+        std::jthread t{[&] { atom.fetch_add(1); }};
+        t.join();
+        assert(atom.load() == 1);
+        static_assert(std::chrono::seconds{std::chrono::minutes{3}}.count() == 180);
+    }
+
+    {
+        // the C library, in namespace std and, through std.compat, in the global namespace
+        assert(std::strlen("meow") == 4 && ::strlen("meow") == 4);
+        assert(std::abs(-3) == 3 && ::abs(-3) == 3);
+        std::size_t n   = sizeof(int);
+        ::size_t n2     = n;
+        std::uint32_t u = static_cast<std::uint32_t>(n2);
+        assert(u == sizeof(int));
+        assert(std::isdigit('7') && ::isdigit('7'));
+    }
+}
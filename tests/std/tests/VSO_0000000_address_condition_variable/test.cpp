@@ -0,0 +1,246 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+stdext::address_mutex global_mutex; // constant initialized, so usable during dynamic initialization
+stdext::address_condition_variable global_cv;
+
+void test_mutual_exclusion() {
+    stdext::address_mutex m;
+    size_t count = 0;
+    vector<thread> threads;
+    for (size_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < 20'000; ++i) {
+                lock_guard<stdext::address_mutex> guard(m);
+                ++count;
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(count == 8 * 20'000);
+}
+
+void test_try_lock() {
+    stdext::address_mutex m;
+    assert(m.try_lock());
+    thread([&] { assert(!m.try_lock()); }).join();
+    m.unlock();
+
+    unique_lock<stdext::address_mutex> lck(m, try_to_lock);
+    assert(lck.owns_lock());
+    lck.unlock();
+
+    lock(m, global_mutex);
+    m.unlock();
+    global_mutex.unlock();
+
+    assert(m.native_handle() != nullptr);
+}
+
+void test_producer_consumer() {
+    stdext::address_mutex m;
+    stdext::address_condition_variable cv;
+    vector<int> queue;
+    bool done = false;
+    int sum   = 0;
+
+    thread consumer([&] {
+        unique_lock<stdext::address_mutex> lck(m);
+        for (;;) {
+            cv.wait(lck, [&] { return done || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+
+            sum += queue.back();
+            queue.pop_back();
+        }
+    });
+
+    // notify while holding the mutex, which hands the mutex to the consumer when it is unlocked, and after unlocking it
+    for (int i = 1; i <= 1'000; ++i) {
+        unique_lock<stdext::address_mutex> lck(m);
+        queue.push_back(i);
+        if (i % 2 == 0) {
+            cv.notify_one();
+        } else {
+            lck.unlock();
+            cv.notify_one();
+        }
+    }
+
+    {
+        lock_guard<stdext::address_mutex> guard(m);
+        done = true;
+        cv.notify_all();
+    }
+
+    consumer.join();
+    assert(sum == 1'000 * 1'001 / 2);
+}
+
+void test_notify_all_hands_off_one_by_one() {
+    constexpr int waiters = 8;
+    stdext::address_mutex m;
+    stdext::address_condition_variable cv;
+    int waiting = 0;
+    int woken   = 0;
+    bool go     = false;
+    bool inside = false;
+
+    vector<thread> threads;
+    for (int i = 0; i < waiters; ++i) {
+        threads.emplace_back([&] {
+            unique_lock<stdext::address_mutex> lck(m);
+            ++waiting;
+            global_cv.notify_one();
+            cv.wait(lck, [&] { return go; });
+            assert(lck.owns_lock());
+            assert(!inside);
+            inside = true;
+            ++woken;
+            this_thread::yield();
+            inside = false;
+            lck.unlock();
+            lck.lock();
+        });
+    }
+
+    {
+        unique_lock<stdext::address_mutex> lck(global_mutex);
+        for (;;) {
+            {
+                lock_guard<stdext::address_mutex> guard(m);
+                if (waiting == waiters) {
+                    break;
+                }
+            }
+
+            (void) global_cv.wait_for(lck, milliseconds{1});
+        }
+    }
+
+    {
+        lock_guard<stdext::address_mutex> guard(m);
+        go = true;
+        cv.notify_all();
+        assert(woken == 0); // the waiters can't run until the mutex is unlocked
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(woken == waiters);
+}
+
+void test_timeouts() {
+    stdext::address_mutex m;
+    stdext::address_condition_variable cv;
+    unique_lock<stdext::address_mutex> lck(m);
+
+    const auto start = steady_clock::now();
+    assert(cv.wait_for(lck, milliseconds{50}) == cv_status::timeout);
+    assert(steady_clock::now() - start >= milliseconds{50});
+    assert(lck.owns_lock());
+    thread([&] { assert(!m.try_lock()); }).join();
+
+    assert(cv.wait_for(lck, milliseconds{-1}) == cv_status::timeout);
+    assert(cv.wait_until(lck, steady_clock::now() - seconds{1}) == cv_status::timeout);
+    assert(!cv.wait_for(lck, microseconds{300}, [] { return false; }));
+    assert(cv.wait_for(lck, hours{1}, [] { return true; }));
+    assert(!cv.wait_until(lck, system_clock::now() + milliseconds{10}, [] { return false; }));
+
+    bool ready = false;
+    thread notifier([&] {
+        this_thread::sleep_for(milliseconds{20});
+        lock_guard<stdext::address_mutex> guard(m);
+        ready = true;
+        cv.notify_all();
+    });
+
+    assert(cv.wait_for(lck, hours{1}, [&] { return ready; }));
+    lck.unlock();
+    notifier.join();
+}
+
+void test_timeouts_racing_notifies() {
+    // waiters that time out as they are notified must neither lose the mutex nor leave themselves in the queue
+    stdext::address_mutex m;
+    stdext::address_condition_variable cv;
+    int tokens  = 0;
+    int taken   = 0;
+    bool done   = false;
+    int running = 4;
+
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            unique_lock<stdext::address_mutex> lck(m);
+            while (!done) {
+                if (cv.wait_for(lck, microseconds{500}, [&] { return tokens != 0; })) {
+                    --tokens;
+                    ++taken;
+                }
+            }
+
+            --running;
+        });
+    }
+
+    for (int i = 0; i < 2'000; ++i) {
+        lock_guard<stdext::address_mutex> guard(m);
+        ++tokens;
+        if (i % 3 == 0) {
+            cv.notify_all();
+        } else {
+            cv.notify_one();
+        }
+    }
+
+    for (;;) {
+        lock_guard<stdext::address_mutex> guard(m);
+        if (tokens == 0) {
+            done = true;
+            break;
+        }
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(taken == 2'000 && running == 0);
+}
+
+void test_condition_variable_any() {
+    stdext::address_mutex m;
+    condition_variable_any cv;
+    unique_lock<stdext::address_mutex> lck(m);
+    assert(!cv.wait_for(lck, milliseconds{1}, [] { return false; }));
+}
+
+int main() {
+    test_mutual_exclusion();
+    test_try_lock();
+    test_producer_consumer();
+    test_notify_all_hands_off_one_by_one();
+    test_timeouts();
+    test_timeouts_racing_notifies();
+    test_condition_variable_any();
+}
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+int add(const int a, const int b) {
+    return a + b;
+}
+
+void test_results() {
+    stdext::async_pool pool{2};
+    auto sum = stdext::async(pool, add, 2, 3);
+    assert(sum.get() == 5);
+
+    auto text = stdext::async(pool, [](const string& s) { return s + s; }, string{"ab"});
+    assert(text.get() == "abab");
+
+    int value = 0;
+    auto ref  = stdext::async(pool, [&value]() -> int& { return value; });
+    assert(&ref.get() == &value);
+
+    bool ran  = false;
+    auto none = stdext::async(pool, [&ran] { ran = true; });
+    none.get();
+    assert(ran);
+
+    auto moved = stdext::async(pool, [](unique_ptr<int> p) { return *p; }, make_unique<int>(42));
+    assert(moved.get() == 42);
+
+    auto thrower = stdext::async(pool, []() -> int { throw runtime_error("task"); });
+    bool caught  = false;
+    try {
+        (void) thrower.get();
+    } catch (const runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    auto shared = stdext::async(pool, add, 1, 1).share();
+    assert(shared.get() == 2 && shared.get() == 2);
+
+    auto waited = stdext::async(pool, add, 4, 4);
+    waited.wait();
+    assert(waited.wait_for(seconds::zero()) == future_status::ready);
+    assert(waited.get() == 8);
+}
+
+void test_bounded_concurrency() {
+    constexpr unsigned int max_workers = 2;
+    stdext::async_pool pool{max_workers};
+    atomic<int> running{0};
+    atomic<int> max_running{0};
+    vector<future<void>> tasks;
+    for (int i = 0; i < 16; ++i) {
+        tasks.push_back(stdext::async(pool, [&] {
+            const int now = running.fetch_add(1) + 1;
+            int seen      = max_running.load();
+            while (seen < now && !max_running.compare_exchange_weak(seen, now)) {
+            }
+
+            this_thread::sleep_for(milliseconds{5});
+            running.fetch_sub(1);
+        }));
+    }
+
+    for (auto& task : tasks) {
+        task.get();
+    }
+
+    assert(max_running.load() >= 1);
+    assert(max_running.load() <= static_cast<int>(max_workers));
+
+    const auto stats = pool.statistics();
+    assert(stats.max_workers == max_workers);
+    assert(stats.queued == 0);
+    assert(stats.running == 0);
+    assert(stats.completed == 16);
+    // with 16 tasks on 2 threads, some tasks waited in the queue for others
+    assert(stats.total_queue_latency > nanoseconds::zero());
+    assert(stats.max_queue_latency > nanoseconds::zero());
+    assert(stats.max_queue_latency <= stats.total_queue_latency);
+    assert(stats.total_run_time >= milliseconds{5} * 16);
+}
+
+void test_queue_depth() {
+    stdext::async_pool pool{1};
+    promise<void> release;
+    auto gate    = release.get_future().share();
+    auto blocker = stdext::async(pool, [gate] { gate.wait(); });
+    vector<future<int>> queued;
+    for (int i = 0; i < 4; ++i) {
+        queued.push_back(stdext::async(pool, add, i, 0));
+    }
+
+    // the one thread is busy with blocker, so the other tasks are counted as queued until it is released
+    for (auto stats = pool.statistics(); stats.running == 0; stats = pool.statistics()) {
+        this_thread::yield();
+    }
+
+    const auto stats = pool.statistics();
+    assert(stats.running == 1);
+    assert(stats.queued == 4);
+    assert(stats.completed == 0);
+
+    release.set_value();
+    blocker.get();
+    for (int i = 0; i < 4; ++i) {
+        assert(queued[static_cast<size_t>(i)].get() == i);
+    }
+
+    assert(pool.statistics().completed == 5);
+}
+
+void test_pool_destroyed_first() {
+    future<int> result;
+    atomic<bool> go{false};
+    {
+        stdext::async_pool pool{1, stdext::async_pool_priority::below_normal};
+        result = stdext::async(pool, [&go] {
+            while (!go.load()) {
+                this_thread::yield();
+            }
+
+            return 1729;
+        });
+    }
+
+    go.store(true);
+    assert(result.get() == 1729);
+}
+
+void test_priorities() {
+    for (const auto priority : {stdext::async_pool_priority::lowest, stdext::async_pool_priority::below_normal,
+             stdext::async_pool_priority::normal, stdext::async_pool_priority::above_normal,
+             stdext::async_pool_priority::highest}) {
+        stdext::async_pool pool{0, priority};
+        assert(pool.statistics().max_workers >= 1);
+        assert(stdext::async(pool, add, 20, 22).get() == 42);
+    }
+}
+
+void test_future_destructor_waits() {
+    stdext::async_pool pool{1};
+    atomic<bool> done{false};
+    {
+        auto task = stdext::async(pool, [&done] {
+            this_thread::sleep_for(milliseconds{20});
+            done.store(true);
+        });
+    }
+
+    assert(done.load());
+}
+
+int main() {
+    test_results();
+    test_bounded_concurrency();
+    test_queue_depth();
+    test_pool_destroyed_first();
+    test_priorities();
+    test_future_destructor_waits();
+}
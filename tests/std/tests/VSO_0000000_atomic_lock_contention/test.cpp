@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct triple {
+    long long first;
+    long long second;
+    long long third;
+};
+
+// oversubscribed, so that the holder of the spinlock is often preempted and the other threads block waiting for it
+const size_t thread_count = (thread::hardware_concurrency() == 0 ? 4 : thread::hardware_concurrency()) * 4;
+
+constexpr int iterations = 5'000;
+
+void test_read_modify_write() {
+    atomic<triple> value{triple{0, 0, 0}};
+    assert(!value.is_lock_free());
+
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < iterations; ++i) {
+                triple expected = value.load();
+                triple desired;
+                do {
+                    assert(expected.second == expected.first * 2 && expected.third == expected.first * 3);
+                    desired = {expected.first + 1, expected.second + 2, expected.third + 3};
+                } while (!value.compare_exchange_weak(expected, desired));
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    const long long total = static_cast<long long>(thread_count) * iterations;
+    const triple result   = value.load();
+    assert(result.first == total && result.second == total * 2 && result.third == total * 3);
+}
+
+void test_exchange() {
+    atomic<triple> value{triple{-1, -1, -1}};
+    vector<long long> seen(thread_count * iterations + 1);
+
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < iterations; ++i) {
+                const long long id  = static_cast<long long>(t * iterations + i);
+                const triple result = value.exchange(triple{id, id, id});
+                assert(result.first == result.second && result.second == result.third);
+                if (result.first >= 0) {
+                    seen[static_cast<size_t>(result.first)] = 1;
+                }
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    // every value was taken out exactly once, but the last one stored
+    const triple last = value.load();
+    seen[static_cast<size_t>(last.first)] = 1;
+    for (size_t i = 0; i < thread_count * iterations; ++i) {
+        assert(seen[i] == 1);
+    }
+}
+
+#if _HAS_CXX20
+void test_wait_and_notify() {
+    // waiting on a non-lock-free atomic compares under its spinlock, while other threads contend for it
+    atomic<triple> value{triple{0, 0, 0}};
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < iterations / 10; ++i) {
+                triple expected = value.load();
+                while (!value.compare_exchange_weak(
+                    expected, triple{expected.first + 1, expected.second, expected.third})) {
+                }
+
+                value.notify_all();
+            }
+        });
+    }
+
+    const long long total = static_cast<long long>(thread_count) * (iterations / 10);
+    for (;;) {
+        const triple current = value.load();
+        if (current.first == total) {
+            break;
+        }
+
+        value.wait(current);
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+void test_atomic_ref() {
+    triple values[4]{};
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            atomic_ref<triple> ref{values[t % 4]};
+            for (int i = 0; i < iterations; ++i) {
+                triple expected = ref.load();
+                while (!ref.compare_exchange_weak(
+                    expected, triple{expected.first + 1, expected.second + 1, expected.third + 1})) {
+                }
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    long long total = 0;
+    for (const auto& value : values) {
+        assert(value.first == value.second && value.second == value.third);
+        total += value.first;
+    }
+
+    assert(total == static_cast<long long>(thread_count) * iterations);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_read_modify_write();
+    test_exchange();
+#if _HAS_CXX20
+    test_wait_and_notify();
+    test_atomic_ref();
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstddef>
+#include <latch>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Waits spin briefly before blocking; these hand off between threads both faster and slower than the spinning lasts,
+// so that waits end both while spinning and after blocking, and no wake may be lost either way.
+
+void test_atomic_ping_pong(const chrono::microseconds delay) {
+    atomic<int> turn{0};
+    constexpr int rounds = 2'000;
+    thread other([&] {
+        for (int i = 1; i < rounds; i += 2) {
+            turn.wait(i - 1);
+            assert(turn.load() == i);
+            if (delay.count() != 0) {
+                this_thread::sleep_for(delay);
+            }
+
+            turn.store(i + 1);
+            turn.notify_one();
+        }
+    });
+
+    for (int i = 0; i < rounds; i += 2) {
+        turn.store(i + 1);
+        turn.notify_one();
+        turn.wait(i + 1);
+        assert(turn.load() == i + 2);
+    }
+
+    other.join();
+}
+
+void test_semaphore_pipeline() {
+    counting_semaphore<> items{0};
+    binary_semaphore space{1};
+    int slot            = 0;
+    long long sum       = 0;
+    constexpr int count = 10'000;
+    thread consumer([&] {
+        for (int i = 0; i < count; ++i) {
+            items.acquire();
+            sum += slot;
+            space.release();
+        }
+    });
+
+    for (int i = 1; i <= count; ++i) {
+        space.acquire();
+        slot = i;
+        items.release();
+    }
+
+    consumer.join();
+    assert(sum == static_cast<long long>(count) * (count + 1) / 2);
+    assert(!items.try_acquire_for(chrono::milliseconds{1}));
+}
+
+void test_latch_and_barrier() {
+    constexpr ptrdiff_t threads = 4;
+    for (int round = 0; round < 100; ++round) {
+        latch done{threads};
+        vector<thread> workers;
+        for (ptrdiff_t i = 0; i < threads; ++i) {
+            workers.emplace_back([&] { done.arrive_and_wait(); });
+        }
+
+        done.wait();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    atomic<int> phases{0};
+    barrier sync{threads, [&]() noexcept { phases.fetch_add(1, memory_order_relaxed); }};
+    vector<thread> workers;
+    for (ptrdiff_t i = 0; i < threads; ++i) {
+        workers.emplace_back([&] {
+            for (int phase = 0; phase < 1'000; ++phase) {
+                sync.arrive_and_wait();
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    assert(phases.load() == 1'000);
+}
+
+int main() {
+    test_atomic_ping_pong(chrono::microseconds{0});
+    test_atomic_ping_pong(chrono::microseconds{200});
+    test_semaphore_pipeline();
+    test_latch_and_barrier();
+}
@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Objects of this size can't be waited on with WaitOnAddress, so their waits always go through the wait table.
+struct big {
+    int value;
+    int padding[5];
+};
+
+void assert_monotonic(const stdext::atomic_wait_statistics& before, const stdext::atomic_wait_statistics& after) {
+    assert(after.blocked_waits >= before.blocked_waits);
+    assert(after.contended_locks >= before.contended_locks);
+    assert(after.table_size == before.table_size);
+}
+
+void test_table_size() {
+    const auto stats = stdext::get_atomic_wait_statistics();
+    assert(stats.table_size >= 256);
+    assert((stats.table_size & (stats.table_size - 1)) == 0);
+}
+
+void test_many_indirect_waiters() {
+    // consecutive objects only differ in the bits above the lowest few, which must still spread over the table
+    constexpr size_t count = 64;
+    vector<atomic<big>> flags(count);
+    for (auto& flag : flags) {
+        flag.store(big{0, {}});
+    }
+
+    const auto before = stdext::get_atomic_wait_statistics();
+
+    atomic<size_t> started{0};
+    vector<thread> waiters;
+    for (size_t i = 0; i < count; ++i) {
+        waiters.emplace_back([&flags, &started, i] {
+            ++started;
+            flags[i].wait(big{0, {}});
+            assert(flags[i].load().value == 1);
+        });
+    }
+
+    while (started.load() != count) {
+        this_thread::yield();
+    }
+
+    this_thread::sleep_for(chrono::milliseconds(100)); // let the waiters go to sleep
+    for (auto& flag : flags) {
+        flag.store(big{1, {}});
+        flag.notify_all();
+    }
+
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+
+    const auto after = stdext::get_atomic_wait_statistics();
+    assert_monotonic(before, after);
+    assert(after.blocked_waits > before.blocked_waits); // at least one waiter was asleep when notified
+}
+
+void test_notify_one_per_address() {
+    // waiters on addresses sharing an entry must not take each other's notify_one
+    constexpr int rounds = 200;
+    atomic<big> first{big{0, {}}};
+    atomic<big> second{big{0, {}}};
+    thread first_waiter([&] {
+        for (int i = 0; i < rounds; ++i) {
+            first.wait(big{i, {}});
+        }
+    });
+
+    thread second_waiter([&] {
+        for (int i = 0; i < rounds; ++i) {
+            second.wait(big{i, {}});
+        }
+    });
+
+    for (int i = 1; i <= rounds; ++i) {
+        first.store(big{i, {}});
+        first.notify_one();
+        second.store(big{i, {}});
+        second.notify_one();
+    }
+
+    first_waiter.join();
+    second_waiter.join();
+}
+
+int main() {
+    test_table_size();
+    test_many_indirect_waiters();
+    test_notify_one_per_address();
+
+    const auto before = stdext::get_atomic_wait_statistics();
+    test_many_indirect_waiters();
+    assert_monotonic(before, stdext::get_atomic_wait_statistics());
+}
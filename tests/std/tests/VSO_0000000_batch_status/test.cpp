@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_batch_status";
+
+void create_file(const path& p, const size_t size) {
+    ofstream f(p, ios::binary);
+    f << string(size, 'x');
+}
+
+vector<path> make_tree() {
+    // a directory with enough entries to be enumerated, and another with too few
+    remove_all(base);
+    create_directories(base / L"many" / L"subdir");
+    create_directories(base / L"few");
+    vector<path> paths;
+    for (size_t i = 0; i < 20; ++i) {
+        const path p = base / L"many" / (L"file" + to_wstring(i) + L".txt");
+        create_file(p, i * 10);
+        paths.push_back(p);
+    }
+
+    create_file(base / L"few" / L"alone.txt", 5);
+    paths.push_back(base / L"many" / L"subdir");
+    paths.push_back(base / L"many" / L"missing.txt");
+    paths.push_back(base / L"MANY" / L"FILE3.TXT"); // not spelled as stored
+    paths.push_back(base / L"many" / L"file4.txt"); // duplicates are fine
+    paths.push_back(base / L"few" / L"alone.txt");
+    paths.push_back(base / L"few" / L"absent.txt");
+    paths.push_back(base / L"missing_dir" / L"x");
+    paths.push_back(base / L"many" / L".");
+    paths.push_back(path{});
+    return paths;
+}
+
+void test_directory_entries(const vector<path>& paths) {
+    vector<error_code> ecs;
+    const auto entries = stdext::filesystem::batch_directory_entries(paths, ecs);
+    assert(entries.size() == paths.size());
+    assert(ecs.size() == paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        error_code ec;
+        const directory_entry expected(paths[i], ec);
+        assert(entries[i].path() == paths[i]);
+        assert(ecs[i] == ec);
+        assert(entries[i].exists() == expected.exists());
+        if (expected.exists()) {
+            assert(entries[i].is_directory() == expected.is_directory());
+            if (expected.is_regular_file()) {
+                assert(entries[i].file_size() == expected.file_size());
+                assert(entries[i].last_write_time() == expected.last_write_time());
+            }
+        }
+    }
+
+    assert(stdext::filesystem::batch_directory_entries(paths).size() == paths.size());
+    assert(stdext::filesystem::batch_directory_entries(vector<path>{}, ecs).empty());
+    assert(ecs.empty());
+}
+
+void test_status(const vector<path>& paths) {
+    vector<error_code> ecs;
+    const auto statuses         = stdext::filesystem::batch_status(paths, ecs);
+    const auto symlink_statuses = stdext::filesystem::batch_symlink_status(paths);
+    assert(statuses.size() == paths.size() && symlink_statuses.size() == paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        error_code ec;
+        assert(statuses[i].type() == status(paths[i], ec).type());
+        assert(ecs[i] == ec);
+        assert(statuses[i].permissions() == status(paths[i]).permissions());
+        assert(symlink_statuses[i].type() == symlink_status(paths[i]).type());
+    }
+
+    // missing files aren't failures; paths[21] is many/missing.txt
+    assert(stdext::filesystem::batch_status(paths)[21].type() == file_type::not_found);
+}
+
+void test_space(const vector<path>& paths) {
+    vector<path> existing;
+    for (const auto& p : paths) {
+        if (exists(p)) {
+            existing.push_back(p);
+        }
+    }
+
+    const auto expected = space(base);
+    const auto results  = stdext::filesystem::batch_space(existing);
+    assert(results.size() == existing.size());
+    for (const auto& info : results) {
+        assert(info.capacity == expected.capacity);
+    }
+
+    vector<error_code> ecs;
+    const auto with_missing = stdext::filesystem::batch_space(paths, ecs);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        error_code ec;
+        (void) space(paths[i], ec);
+        assert(static_cast<bool>(ecs[i]) == static_cast<bool>(ec));
+        if (!ec) {
+            assert(with_missing[i].capacity == expected.capacity);
+        }
+    }
+
+    bool threw = false;
+    try {
+        (void) stdext::filesystem::batch_space(paths);
+    } catch (const filesystem_error&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+int main() {
+    const auto paths = make_tree();
+    test_directory_entries(paths);
+    test_status(paths);
+    test_space(paths);
+    remove_all(base);
+}
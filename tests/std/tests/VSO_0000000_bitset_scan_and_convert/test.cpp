@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <bitset>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+template <size_t N>
+void test_count_and_find(const vector<size_t>& positions) {
+    bitset<N> b;
+    assert(b.count() == 0);
+    assert(b._Find_first() == N);
+
+    for (const auto& pos : positions) {
+        b.set(pos);
+    }
+
+    assert(b.count() == positions.size());
+
+    vector<size_t> found;
+    for (size_t pos = b._Find_first(); pos != N; pos = b._Find_next(pos)) {
+        found.push_back(pos);
+    }
+
+    assert(found == positions);
+    assert(b._Find_next(N) == N);
+    assert(b._Find_next(N + 100) == N);
+
+    b.set();
+    assert(b.count() == N);
+    for (size_t pos = 0; pos + 1 < N; ++pos) {
+        assert(b._Find_next(pos) == pos + 1);
+    }
+}
+
+template <size_t N, class Elem>
+void test_round_trip(const Elem zero, const Elem one) {
+    using Str = basic_string<Elem>;
+
+    bitset<N> b;
+    for (size_t pos = 0; pos < N; pos += 3) {
+        b.set(pos);
+    }
+
+    b.set(N - 1);
+
+    const Str str = b.template to_string<Elem>(zero, one);
+    assert(str.size() == N);
+    for (size_t idx = 0; idx < N; ++idx) {
+        assert(str[idx] == (b[N - 1 - idx] ? one : zero));
+    }
+
+    assert(bitset<N>(str, 0, Str::npos, zero, one) == b);
+    assert(bitset<N>(str.c_str(), Str::npos, zero, one) == b);
+
+    // a longer string uses only its first N characters, but all of them must be valid
+    const Str longer = str + Str(37, one);
+    assert(bitset<N>(longer, 0, Str::npos, zero, one) == b);
+
+    // a shorter string fills the low bits
+    const Str shorter = str.substr(N / 2);
+    bitset<N> low     = b;
+    low <<= N / 2;
+    low >>= N / 2;
+    assert(bitset<N>(shorter, 0, Str::npos, zero, one) == low);
+
+    for (const size_t bad_pos : {size_t{0}, N / 2, N - 1, N + 5}) {
+        Str bad      = longer;
+        bad[bad_pos] = static_cast<Elem>('?');
+        try {
+            (void) bitset<N>(bad, 0, Str::npos, zero, one);
+            assert(false);
+        } catch (const invalid_argument&) {
+        }
+    }
+}
+
+int main() {
+    test_count_and_find<1>({0});
+    test_count_and_find<32>({0, 5, 31});
+    test_count_and_find<33>({1, 32});
+    test_count_and_find<64>({0, 63});
+    test_count_and_find<65>({0, 31, 32, 63, 64});
+    test_count_and_find<1000>({3, 64, 65, 128, 500, 511, 512, 999});
+    test_count_and_find<1'000'000>({0, 17, 4096, 65'535, 999'999});
+
+    test_round_trip<1>('0', '1');
+    test_round_trip<7>('0', '1');
+    test_round_trip<16>('a', 'b');
+    test_round_trip<33>('0', '1');
+    test_round_trip<100>('-', 'X');
+    test_round_trip<1000>('0', '1');
+    test_round_trip<7, wchar_t>(L'0', L'1');
+    test_round_trip<8, wchar_t>(L'0', L'1');
+    test_round_trip<1000, wchar_t>(L'.', L'#');
+    test_round_trip<100, char16_t>(u'0', u'1');
+    test_round_trip<100, char32_t>(U'0', U'1');
+
+    assert(bitset<0>().to_string().empty());
+    assert(bitset<0>("").count() == 0);
+    assert(bitset<0>()._Find_first() == 0);
+}
@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// lower_bound, upper_bound, equal_range and binary_search select halves without branching for pointers to arithmetic
+// types and the standard comparisons; they must agree with a linear scan for every size and every probe
+
+template <class T, class Val, class Pred>
+void check_searches(const vector<T>& v, const Val& val, Pred pred) {
+    const auto first = v.data();
+    const auto last  = v.data() + v.size();
+
+    auto lower = first;
+    while (lower != last && pred(*lower, val)) {
+        ++lower;
+    }
+
+    auto upper = lower;
+    while (upper != last && !pred(val, *upper)) {
+        ++upper;
+    }
+
+    assert(lower_bound(first, last, val, pred) == lower);
+    assert(upper_bound(first, last, val, pred) == upper);
+    assert(equal_range(first, last, val, pred) == make_pair(lower, upper));
+    assert(binary_search(first, last, val, pred) == (lower != upper));
+
+    // wrapped and unwrapped iterators take the same path
+    assert(lower_bound(v.begin(), v.end(), val, pred) - v.begin() == lower - first);
+    assert(upper_bound(v.begin(), v.end(), val, pred) - v.begin() == upper - first);
+
+#ifdef __cpp_lib_concepts
+    if constexpr (is_same_v<Pred, less<>>) {
+        assert(ranges::lower_bound(v, val) - v.begin() == lower - first);
+        assert(ranges::upper_bound(v, val) - v.begin() == upper - first);
+        assert(ranges::equal_range(v, val).size() == static_cast<size_t>(upper - lower));
+        assert(ranges::binary_search(v, val) == (lower != upper));
+    }
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_type(mt19937& gen) {
+    for (size_t n = 0; n < 70; ++n) {
+        vector<T> v(n);
+        for (auto& e : v) {
+            e = static_cast<T>(gen() % 20);
+        }
+
+        sort(v.begin(), v.end());
+        for (int probe = -1; probe <= 21; ++probe) {
+            check_searches(v, static_cast<T>(probe), less<>{});
+            check_searches(v, static_cast<T>(probe), less<T>{});
+        }
+
+        sort(v.begin(), v.end(), greater<>{});
+        for (int probe = -1; probe <= 21; ++probe) {
+            check_searches(v, static_cast<T>(probe), greater<>{});
+            check_searches(v, static_cast<T>(probe), greater<T>{});
+        }
+    }
+}
+
+void test_mixed_types() {
+    // the value searched for may have a different type than the elements
+    const vector<int> v{1, 2, 2, 4, 7, 7, 7, 9};
+    check_searches(v, 2.5, less<>{});
+    check_searches(v, 7.0, less<>{});
+    check_searches(v, -1.5, less<>{});
+    check_searches(v, 10LL, less<>{});
+}
+
+void test_large() {
+    mt19937 gen(1729);
+    vector<unsigned int> v(100'000);
+    for (auto& e : v) {
+        e = static_cast<unsigned int>(gen());
+    }
+
+    sort(v.begin(), v.end());
+    for (size_t i = 0; i < v.size(); i += 97) {
+        assert(*lower_bound(v.begin(), v.end(), v[i]) == v[i]);
+        assert(binary_search(v.cbegin(), v.cend(), v[i]));
+        const auto range = equal_range(v.cbegin(), v.cend(), v[i]);
+        assert(range.first != range.second && *range.first == v[i]);
+    }
+
+    for (int i = 0; i < 1'000; ++i) {
+        const auto val = static_cast<unsigned int>(gen());
+        check_searches(v, val, less<>{});
+    }
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    const int arr[] = {1, 3, 3, 5, 8};
+    assert(lower_bound(begin(arr), end(arr), 3) == arr + 1);
+    assert(upper_bound(begin(arr), end(arr), 3) == arr + 3);
+    assert(equal_range(begin(arr), end(arr), 4) == make_pair(arr + 3, arr + 3));
+    assert(binary_search(begin(arr), end(arr), 8));
+    assert(!binary_search(begin(arr), end(arr), 9));
+    assert(ranges::lower_bound(arr, 5) == arr + 3);
+    return true;
+}
+
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    mt19937 gen(42);
+    test_type<char>(gen);
+    test_type<signed char>(gen);
+    test_type<unsigned char>(gen);
+    test_type<short>(gen);
+    test_type<unsigned short>(gen);
+    test_type<int>(gen);
+    test_type<unsigned int>(gen);
+    test_type<long long>(gen);
+    test_type<unsigned long long>(gen);
+    test_type<float>(gen);
+    test_type<double>(gen);
+    test_type<long double>(gen);
+    test_mixed_types();
+    test_large();
+#if _HAS_CXX20
+    assert(test_constexpr());
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,305 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Btree, class Reference>
+bool same_elements(const Btree& c, const Reference& ref) {
+    return c.size() == ref.size() && equal(c.begin(), c.end(), ref.begin(), ref.end())
+        && equal(c.rbegin(), c.rend(), ref.rbegin(), ref.rend())
+        && static_cast<size_t>(distance(c.begin(), c.end())) == ref.size();
+}
+
+struct big_value { // three of these fill a node, so that the trees are as deep as possible
+    big_value() = default;
+    explicit big_value(int val) : id(val) {}
+
+    int id = 0;
+    char padding[100]{};
+
+    friend bool operator==(const big_value& left, const big_value& right) {
+        return left.id == right.id;
+    }
+};
+
+template <class Btree, class Reference, class MakeValue>
+void test_random_operations(const int key_range, const int operations, MakeValue make_value) {
+    Btree c;
+    Reference ref;
+    mt19937 gen{1729};
+    for (int i = 0; i < operations; ++i) {
+        const int key = static_cast<int>(gen() % static_cast<unsigned int>(key_range));
+        switch (gen() % 6) {
+        case 0:
+        case 1:
+        case 2:
+            c.insert(make_value(key, i));
+            ref.insert(make_value(key, i));
+            break;
+        case 3:
+            assert(c.erase(key) == ref.erase(key));
+            break;
+        case 4:
+            { // erase returns the element after the erased one
+                auto it           = c.lower_bound(key);
+                auto ref_it       = ref.lower_bound(key);
+                const bool at_end = ref_it == ref.end();
+                assert((it == c.end()) == at_end);
+                if (!at_end) {
+                    it     = c.erase(it);
+                    ref_it = ref.erase(ref_it);
+                    assert((it == c.end()) == (ref_it == ref.end()));
+                    if (ref_it != ref.end()) {
+                        assert(*it == *ref_it);
+                    }
+                }
+            }
+            break;
+        default:
+            {
+                const auto found = c.find(key);
+                assert((found == c.end()) == (ref.find(key) == ref.end()));
+                assert(c.count(key) == ref.count(key));
+                assert(c.contains(key) == (ref.count(key) != 0));
+                const auto [first, last] = c.equal_range(key);
+                assert(static_cast<size_t>(distance(first, last)) == ref.count(key));
+                assert(c.upper_bound(key) == last);
+            }
+            break;
+        }
+
+        if (i % 512 == 0) {
+            assert(same_elements(c, ref));
+        }
+    }
+
+    assert(same_elements(c, ref));
+
+    // erase ranges from the middle, then everything
+    auto first = c.begin();
+    auto last  = c.begin();
+    advance(first, c.size() / 4);
+    advance(last, c.size() / 2);
+    auto ref_first = ref.begin();
+    auto ref_last  = ref.begin();
+    advance(ref_first, ref.size() / 4);
+    advance(ref_last, ref.size() / 2);
+    const auto after = c.erase(first, last);
+    ref.erase(ref_first, ref_last);
+    assert(same_elements(c, ref));
+    assert(after == c.end() || *after == *ref_last);
+
+    while (!c.empty()) {
+        c.erase(prev(c.end()));
+    }
+
+    assert(c.begin() == c.end());
+}
+
+void test_random() {
+    const auto make_pair_value = [](int key, int val) { return pair<const int, int>(key, val); };
+    const auto make_key        = [](int key, int) { return key; };
+    const auto make_big_pair   = [](int key, int val) { return pair<const int, big_value>(key, big_value{val}); };
+
+    test_random_operations<stdext::btree_map<int, int>, map<int, int>>(5'000, 60'000, make_pair_value);
+    test_random_operations<stdext::btree_multimap<int, int>, multimap<int, int>>(500, 60'000, make_pair_value);
+    test_random_operations<stdext::btree_set<int>, set<int>>(5'000, 60'000, make_key);
+    test_random_operations<stdext::btree_multiset<int>, multiset<int>>(50, 60'000, make_key);
+    test_random_operations<stdext::btree_map<int, big_value>, map<int, big_value>>(2'000, 30'000, make_big_pair);
+    test_random_operations<stdext::btree_multimap<int, big_value>, multimap<int, big_value>>(
+        200, 30'000, make_big_pair);
+}
+
+void test_bulk_loading() {
+    // sorted input is appended, with duplicates and out of order elements mixed in
+    vector<int> sorted_keys;
+    for (int i = 0; i < 20'000; ++i) {
+        sorted_keys.push_back(i / 3);
+    }
+
+    const stdext::btree_set<int> unique_keys(sorted_keys.begin(), sorted_keys.end());
+    const set<int> ref_unique(sorted_keys.begin(), sorted_keys.end());
+    assert(same_elements(unique_keys, ref_unique));
+
+    const stdext::btree_multiset<int> all_keys(stdext::sorted_equivalent, sorted_keys.begin(), sorted_keys.end());
+    assert(same_elements(all_keys, sorted_keys));
+
+    for (size_t size = 0; size < 200; ++size) {
+        stdext::btree_set<int> c(stdext::sorted_unique, ref_unique.begin(), next(ref_unique.begin(), size));
+        assert(same_elements(c, set<int>(ref_unique.begin(), next(ref_unique.begin(), size))));
+
+        // erasing from a bulk loaded tree keeps it balanced
+        set<int> ref(c.begin(), c.end());
+        for (size_t i = 0; i < size; i += 3) {
+            c.erase(static_cast<int>(i));
+            ref.erase(static_cast<int>(i));
+        }
+
+        assert(same_elements(c, ref));
+    }
+
+    stdext::btree_multimap<int, int> mm;
+    vector<pair<const int, int>> batch;
+    multimap<int, int> ref;
+    for (int i = 0; i < 3'000; ++i) {
+        batch.emplace_back(i % 7 == 0 ? i / 2 : i, i);
+    }
+
+    mm.insert(batch.begin(), batch.end());
+    ref.insert(batch.begin(), batch.end());
+    assert(same_elements(mm, ref));
+    mm.insert(batch.begin(), batch.end());
+    ref.insert(batch.begin(), batch.end());
+    assert(same_elements(mm, ref));
+
+    stdext::btree_map<int, int> m{{5, 0}, {1, 1}, {3, 2}, {1, 3}};
+    assert(same_elements(m, (map<int, int>{{1, 1}, {3, 2}, {5, 0}})));
+    m.insert({{7, 4}, {2, 5}, {7, 6}});
+    assert(same_elements(m, (map<int, int>{{1, 1}, {2, 5}, {3, 2}, {5, 0}, {7, 4}})));
+}
+
+void test_map_members() {
+    stdext::btree_map<string, int> m;
+    m["b"] = 2;
+    m["a"] = 1;
+    ++m["a"];
+    assert(m.at("a") == 2);
+    bool threw = false;
+    try {
+        (void) m.at("z");
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+
+    assert(threw);
+
+    string key = "c";
+    const auto [where, inserted] = m.try_emplace(move(key), 3);
+    assert(inserted && where->first == "c" && where->second == 3);
+    key = "c";
+    assert(!m.try_emplace(move(key), 4).second);
+    assert(key == "c"); // not moved from when the key exists
+    assert(m.insert_or_assign("c", 5).second == false && m["c"] == 5);
+    assert(m.insert_or_assign(m.end(), "d", 6)->second == 6);
+    assert(m.emplace("d", 7).second == false);
+    assert(m.emplace(piecewise_construct, forward_as_tuple("e"), forward_as_tuple(8)).second);
+    assert(m.insert(pair<const char*, int>("f", 9)).second);
+    assert(m.size() == 6);
+    assert(m.value_comp()(*m.begin(), *next(m.begin())));
+
+    // elements may be inserted from elements of the same container
+    stdext::btree_multimap<string, string> mm;
+    for (int i = 0; i < 100; ++i) {
+        mm.emplace(to_string(i % 10), to_string(i));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        const auto& front = *mm.begin();
+        mm.emplace(front.second, front.first);
+    }
+
+    // equivalent keys keep their insertion order
+    const auto [first, last] = mm.equal_range("3");
+    assert(distance(first, last) == 10);
+    int expected = 3;
+    for (auto it = first; it != last; ++it, expected += 10) {
+        assert(it->second == to_string(expected));
+    }
+}
+
+void test_transparent_lookup() {
+    stdext::btree_map<string, int, less<>> m;
+    for (int i = 0; i < 1'000; ++i) {
+        m.emplace(to_string(i), i);
+    }
+
+    const string_view key = "500";
+    assert(m.find(key)->second == 500);
+    assert(m.count(key) == 1);
+    assert(m.contains(string_view{"999"}));
+    assert(!m.contains(string_view{"1000"}));
+    assert(m.lower_bound(string_view{"5"})->first == "5");
+    assert(m.upper_bound(string_view{"5"})->first == "50");
+    assert(distance(m.equal_range(key).first, m.equal_range(key).second) == 1);
+
+    const stdext::btree_set<string, less<>> s{"x", "y"};
+    assert(s.find("y") != s.end() && s.find("z") == s.end());
+}
+
+void test_copy_move_compare() {
+    stdext::btree_map<int, string> m;
+    for (int i = 0; i < 500; ++i) {
+        m.emplace(i * 3 % 500, to_string(i));
+    }
+
+    auto copied = m;
+    assert(copied == m && !(copied != m) && !(copied < m) && copied <= m && copied >= m);
+    copied.erase(prev(copied.end()));
+    assert(copied < m && m > copied && copied != m);
+
+    auto moved = move(copied);
+    assert(copied.empty() && moved.size() == 499);
+    copied = m;
+    assert(copied == m);
+    copied = move(moved);
+    assert(copied.size() == 499 && moved.empty());
+    swap(copied, moved);
+    assert(copied.empty() && moved.size() == 499);
+    copied.swap(moved);
+    copied = {{1, "one"}};
+    assert(copied.size() == 1 && copied.begin()->second == "one");
+    copied.clear();
+    assert(copied.empty() && copied.begin() == copied.end());
+
+    stdext::btree_set<int> s{1, 2, 3};
+    assert(*s.insert(s.end(), 0) == 0);
+    assert(*s.cbegin() == 0 && *s.crbegin() == 3);
+    assert(s.key_comp()(1, 2) && s.value_comp()(1, 2));
+}
+
+void test_pmr() {
+    pmr::monotonic_buffer_resource resource;
+    stdext::pmr::btree_map<int, pmr::string> m{&resource};
+    for (int i = 0; i < 1'000; ++i) {
+        m.try_emplace(i, static_cast<size_t>(i % 40), 'a');
+    }
+
+    assert(m.get_allocator().resource() == &resource);
+    assert(m[39].size() == 39 && m[39].get_allocator().resource() == &resource);
+
+    // unequal allocators move the elements one by one
+    pmr::monotonic_buffer_resource other_resource;
+    stdext::pmr::btree_map<int, pmr::string> other(move(m), &other_resource);
+    assert(other.size() == 1'000 && m.empty());
+    assert(other[39].size() == 39 && other[39].get_allocator().resource() == &other_resource);
+
+    stdext::pmr::btree_multiset<int> s{&resource};
+    s.insert({3, 1, 3});
+    assert(s.count(3) == 2);
+    stdext::pmr::btree_set<int> unique{&resource};
+    stdext::pmr::btree_multimap<int, int> multi{&resource};
+}
+
+int main() {
+    test_random();
+    test_bulk_loading();
+    test_map_members();
+    test_transparent_lookup();
+    test_copy_move_compare();
+    test_pmr();
+}
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// call_once checks for completed initialization with INIT_ONCE_CHECK_ONLY before beginning it
+
+void test_states() {
+    once_flag flag;
+    assert(!_Once_flag_completed(flag));
+
+    // a throwing call leaves the flag as it was
+    bool threw = false;
+    try {
+        call_once(flag, [] { throw runtime_error("not yet"); });
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+
+    assert(threw);
+    assert(!_Once_flag_completed(flag));
+
+    int calls = 0;
+    call_once(flag, [&] { ++calls; });
+    assert(calls == 1);
+    assert(_Once_flag_completed(flag));
+
+    for (int i = 0; i < 1'000; ++i) {
+        call_once(flag, [&] { ++calls; });
+    }
+
+    assert(calls == 1);
+}
+
+struct singleton {
+    int value = 42;
+};
+
+once_flag singleton_flag;
+singleton* singleton_ptr = nullptr;
+
+singleton& get_singleton() {
+    call_once(singleton_flag, [] { singleton_ptr = new singleton; });
+    return *singleton_ptr;
+}
+
+void test_publication() {
+    // every thread sees the initialized object, whether it ran the initialization, waited for it, or took the fast path
+    atomic<int> sum{0};
+    vector<thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&] {
+            int local = 0;
+            for (int i = 0; i < 10'000; ++i) {
+                local += get_singleton().value;
+            }
+
+            sum += local;
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(sum == 8 * 10'000 * 42);
+    delete singleton_ptr;
+}
+
+int main() {
+    test_states();
+    test_publication();
+}
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <locale>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// In the "C" locale collate<char> and collate<wchar_t> compare and transform without calling into the CRT;
+// the results must be those of a lexicographical comparison of the code units, as unsigned values.
+template <class Elem>
+int sign_of_compare(const basic_string<Elem>& left, const basic_string<Elem>& right) {
+    const auto& fac = use_facet<collate<Elem>>(locale::classic());
+    return fac.compare(left.data(), left.data() + left.size(), right.data(), right.data() + right.size());
+}
+
+template <class Elem>
+void test_compare() {
+    using str = basic_string<Elem>;
+    const Elem abc[]  = {'a', 'b', 'c'};
+    const Elem abd[]  = {'a', 'b', 'd'};
+    const Elem ab0[]  = {'a', 'b', '\0', 'c'};
+    const Elem high[] = {static_cast<Elem>(0xE9)}; // above every ASCII value when compared unsigned
+
+    assert(sign_of_compare(str(), str()) == 0);
+    assert(sign_of_compare(str(), str(abc, 1)) == -1);
+    assert(sign_of_compare(str(abc, 1), str()) == +1);
+    assert(sign_of_compare(str(abc, 3), str(abc, 3)) == 0);
+    assert(sign_of_compare(str(abc, 3), str(abd, 3)) == -1);
+    assert(sign_of_compare(str(abd, 3), str(abc, 3)) == +1);
+    assert(sign_of_compare(str(abc, 2), str(abc, 3)) == -1);
+    assert(sign_of_compare(str(abc, 3), str(abc, 2)) == +1);
+
+    // embedded nulls are ordinary elements
+    assert(sign_of_compare(str(ab0, 4), str(ab0, 3)) == +1);
+    assert(sign_of_compare(str(ab0, 4), str(abc, 3)) == -1);
+
+    assert(sign_of_compare(str(high, 1), str(abc, 3)) == +1);
+    assert(sign_of_compare(str(abc, 3), str(high, 1)) == -1);
+}
+
+template <class Elem>
+void test_transform() {
+    using str         = basic_string<Elem>;
+    const auto& fac   = use_facet<collate<Elem>>(locale::classic());
+    const Elem text[] = {'z', 'y', '\0', 'x', static_cast<Elem>(0xE9)};
+    for (size_t len = 0; len <= 5; ++len) {
+        const str original(text, len);
+        assert(fac.transform(original.data(), original.data() + original.size()) == original);
+    }
+}
+
+void test_locale_as_comparator() {
+    vector<string> words    = {"pear", "Apple", "apple", "\xE9t\xE9", "", "banana", "app"};
+    vector<string> expected = words;
+    sort(words.begin(), words.end(), locale::classic());
+    sort(expected.begin(), expected.end(), [](const string& left, const string& right) {
+        return lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(),
+            [](const char x, const char y) { return static_cast<unsigned char>(x) < static_cast<unsigned char>(y); });
+    });
+    assert(words == expected);
+}
+
+void test_named_locale() {
+    // other locales still collate through the CRT; only check that they agree with themselves
+    try {
+        const locale loc("");
+        const auto& fac = use_facet<collate<char>>(loc);
+        const string a  = "alpha";
+        const string b  = "beta";
+        assert(fac.compare(a.data(), a.data() + a.size(), a.data(), a.data() + a.size()) == 0);
+        const int ab = fac.compare(a.data(), a.data() + a.size(), b.data(), b.data() + b.size());
+        const int ba = fac.compare(b.data(), b.data() + b.size(), a.data(), a.data() + a.size());
+        assert(ab == -ba && ab != 0);
+    } catch (const runtime_error&) {
+        // no such locale
+    }
+}
+
+int main() {
+    test_compare<char>();
+    test_compare<wchar_t>();
+    test_transform<char>();
+    test_transform<wchar_t>();
+    test_locale_as_comparator();
+    test_named_locale();
+}
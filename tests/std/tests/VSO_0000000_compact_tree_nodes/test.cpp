@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+size_t largest_allocation = 0;
+
+template <class T>
+struct size_recording_allocator {
+    using value_type = T;
+
+    size_recording_allocator() = default;
+
+    template <class U>
+    size_recording_allocator(const size_recording_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        largest_allocation = (max)(largest_allocation, sizeof(T));
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const size_recording_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const size_recording_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+template <class T>
+struct standard_node {
+    void* links[3];
+    char color;
+    char isnil;
+    T value;
+};
+
+template <class T>
+struct compact_node { // the color and head flag are in the low bits of a link
+    void* links[3];
+    T value;
+};
+
+template <class T>
+constexpr size_t expected_node_size = sizeof(conditional_t<_STL_COMPACT_TREE_NODES, compact_node<T>, standard_node<T>>);
+
+void test_node_size() {
+    static_assert(sizeof(void*) != 8 || sizeof(compact_node<uint64_t>) + 8 == sizeof(standard_node<uint64_t>),
+        "compact nodes should save a word on 64-bit platforms");
+    {
+        set<uint64_t, less<uint64_t>, size_recording_allocator<uint64_t>> s{1, 2, 3};
+        assert(largest_allocation == expected_node_size<uint64_t>);
+    }
+
+    largest_allocation = 0;
+    {
+        map<int, int, less<int>, size_recording_allocator<pair<const int, int>>> m{{1, 1}};
+        assert(largest_allocation == expected_node_size<pair<const int, int>>);
+    }
+}
+
+void test_random_operations() {
+    // colors are recolored and swapped, and links relinked, as the tree is rebalanced
+    map<int, string> m;
+    multiset<int> ms;
+    mt19937 gen{1729};
+    for (int i = 0; i < 50'000; ++i) {
+        const int key = static_cast<int>(gen() % 2'000);
+        if (gen() % 3 != 0) {
+            m.emplace(key, to_string(key));
+            ms.insert(key);
+        } else {
+            const bool erased = m.erase(key) != 0;
+            const auto where  = ms.find(key);
+            assert(erased == (where != ms.end()));
+            if (erased) {
+                ms.erase(where);
+            }
+        }
+    }
+
+    assert(m.size() == set<int>(ms.begin(), ms.end()).size());
+    int prev = -1;
+    for (const auto& [key, val] : m) {
+        assert(key > prev && val == to_string(key));
+        prev = key;
+    }
+
+    assert(is_sorted(ms.begin(), ms.end()));
+    assert(is_sorted(ms.rbegin(), ms.rend(), greater<>{}));
+
+    // copies keep the colors of the source's nodes
+    auto copied = m;
+    assert(copied == m);
+    copied.erase(copied.begin(), next(copied.begin(), static_cast<ptrdiff_t>(copied.size() / 2)));
+    copied.insert(m.begin(), m.end());
+    assert(copied == m);
+
+    multiset<int> moved(move(ms));
+    assert(ms.empty() && ms.begin() == ms.end());
+    ms.swap(moved);
+    assert(moved.empty() && !ms.empty());
+
+#if _HAS_CXX17
+    // nodes move between containers through node handles
+    map<int, string> other;
+    while (!m.empty()) {
+        auto node = m.extract(m.begin());
+        other.insert(move(node));
+    }
+
+    assert(other == copied);
+    m.merge(other);
+    assert(other.empty() && m == copied);
+#endif // _HAS_CXX17
+}
+
+int main() {
+    test_node_size();
+    test_random_operations();
+}
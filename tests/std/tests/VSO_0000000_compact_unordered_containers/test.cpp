@@ -0,0 +1,443 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// deliberately poor hash functions, so that buckets get long and neighboring buckets are both full and empty
+struct identity_hash {
+    size_t operator()(const int val) const noexcept {
+        return static_cast<size_t>(val);
+    }
+};
+
+struct clustered_hash {
+    size_t operator()(const int val) const noexcept {
+        return static_cast<size_t>(val & 3);
+    }
+};
+
+int hash_calls_before_throw = -1;
+
+struct throwing_hash {
+    size_t operator()(const int val) const {
+        if (hash_calls_before_throw >= 0 && hash_calls_before_throw-- == 0) {
+            throw runtime_error("hash");
+        }
+
+        return hash<int>{}(val);
+    }
+};
+
+size_t allocated_bytes = 0;
+
+template <class T>
+struct tracking_allocator {
+    using value_type = T;
+
+    explicit tracking_allocator(int id_) noexcept : id(id_) {}
+
+    template <class U>
+    tracking_allocator(const tracking_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        allocated_bytes += n * sizeof(T);
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocated_bytes -= n * sizeof(T);
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const tracking_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const tracking_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+
+    int id;
+};
+
+template <class Map, class Reference>
+bool same_contents(const Map& m, const Reference& ref) {
+    if (m.size() != ref.size() || static_cast<size_t>(distance(m.begin(), m.end())) != ref.size()) {
+        return false;
+    }
+
+    for (const auto& [key, val] : ref) {
+        const auto where = m.find(key);
+        if (where == m.end() || where->second != val) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void test_map_basics() {
+    stdext::compact_unordered_map<string, int> m;
+    assert(m.empty());
+    assert(m.bucket_count() == 0);
+    assert(m.begin() == m.end());
+    assert(m.find("missing") == m.end());
+    assert(m.erase("missing") == 0);
+    assert(m.max_load_factor() == 1.0f);
+
+    assert(m.emplace("one", 1).second);
+    assert(!m.emplace("one", 100).second);
+    assert(m.insert({"two", 2}).second);
+    assert(m.try_emplace("three", 3).second);
+    assert(!m.try_emplace("three", 300).second);
+    assert(m["three"] == 3);
+    m["four"] = 4;
+    assert(!m.insert_or_assign("four", 44).second);
+    assert(m.insert_or_assign("five", 5).second);
+    assert(m.size() == 5);
+    assert(m.at("four") == 44);
+    assert(m.count("five") == 1);
+    assert(m.contains("two"));
+    assert(!m.contains("six"));
+
+    bool threw = false;
+    try {
+        (void) m.at("six");
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    const auto range = m.equal_range("two");
+    assert(range.first != m.end() && range.first->second == 2);
+    assert(distance(range.first, range.second) == 1);
+
+    assert(m.erase("two") == 1);
+    assert(!m.contains("two"));
+    const auto next = m.erase(m.find("one"));
+    assert(m.size() == 3);
+    assert(distance(next, m.end()) <= 3);
+
+    // the bucket count is a power of 2
+    const auto buckets = m.bucket_count();
+    assert(buckets != 0 && (buckets & (buckets - 1)) == 0);
+    assert(m.load_factor() <= m.max_load_factor());
+
+    m.clear();
+    assert(m.empty() && m.begin() == m.end());
+    assert(m.bucket_count() == buckets);
+    assert(m.emplace("again", 6).second);
+    assert(m.size() == 1 && m.at("again") == 6);
+    m.erase(m.begin(), m.end());
+    assert(m.empty());
+    m.rehash(0);
+    assert(m.bucket_count() == 0);
+}
+
+template <class Hasher>
+void test_against_unordered_map(const unsigned int seed, const float max_load) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> keys(0, 2000);
+    stdext::compact_unordered_map<int, int, Hasher> m;
+    m.max_load_factor(max_load);
+    unordered_map<int, int> ref;
+    for (int step = 0; step < 20'000; ++step) {
+        const int key = keys(gen);
+        switch (gen() % 5) {
+        case 0:
+        case 1:
+            assert(m.emplace(key, step).second == ref.emplace(key, step).second);
+            break;
+        case 2:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        case 3:
+            if (const auto where = m.find(key); where != m.end()) {
+                ref.erase(key);
+                m.erase(where);
+            }
+            break;
+        default:
+            assert(m.contains(key) == (ref.count(key) != 0));
+            break;
+        }
+
+        assert(m.load_factor() <= m.max_load_factor());
+        if (step % 5'000 == 0) {
+            assert(same_contents(m, ref));
+        }
+    }
+
+    assert(same_contents(m, ref));
+
+    // erase while iterating
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 3 == 0) {
+            ref.erase(it->first);
+            it = m.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    assert(same_contents(m, ref));
+
+    m.rehash(0);
+    assert(same_contents(m, ref));
+    m.reserve(m.size() * 2);
+    assert(same_contents(m, ref));
+    m.rehash(m.bucket_count() * 4);
+    assert(same_contents(m, ref));
+
+    // erase a range from the middle
+    auto first = m.begin();
+    advance(first, static_cast<ptrdiff_t>(m.size() / 3));
+    auto last = first;
+    advance(last, static_cast<ptrdiff_t>(m.size() / 3));
+    for (auto it = first; it != last; ++it) {
+        ref.erase(it->first);
+    }
+
+    assert(m.erase(first, last) == last);
+    assert(same_contents(m, ref));
+}
+
+void test_max_load_factor() {
+    // a load factor above 1 keeps fewer buckets; references stay valid as the buckets change
+    stdext::compact_unordered_map<int, int> m;
+    m.max_load_factor(4.0f);
+    assert(m.max_load_factor() == 4.0f);
+    m.try_emplace(0, 0);
+    const int* const first = &m.at(0);
+    for (int i = 1; i < 4'096; ++i) {
+        m.try_emplace(i, i);
+    }
+
+    assert(first == &m.at(0));
+    assert(m.bucket_count() <= 1'024);
+    assert(m.load_factor() <= 4.0f);
+
+    m.max_load_factor(0.5f);
+    m.rehash(0);
+    assert(m.bucket_count() >= 8'192);
+    assert(first == &m.at(0));
+    for (int i = 0; i < 4'096; ++i) {
+        assert(m.at(i) == i);
+    }
+}
+
+void test_reserve() {
+    for (size_t n = 0; n < 200; ++n) {
+        stdext::compact_unordered_set<size_t> s;
+        s.reserve(n);
+        const auto buckets = s.bucket_count();
+        for (size_t i = 0; i < n; ++i) {
+            s.insert(i);
+        }
+
+        assert(s.size() == n);
+        assert(s.bucket_count() == buckets);
+    }
+}
+
+void test_memory_footprint() {
+    // one pointer per element and one per bucket, plus the node before the first element at the end of the buckets
+    struct expected_node {
+        void* next;
+        pair<const int, int> value;
+    };
+
+    using alloc_t = tracking_allocator<pair<const int, int>>;
+
+    allocated_bytes = 0;
+    {
+        stdext::compact_unordered_map<int, int, hash<int>, equal_to<int>, alloc_t> m(alloc_t{1});
+        m.max_load_factor(2.0f);
+        for (int i = 0; i < 1'000; ++i) {
+            m.try_emplace(i, i);
+        }
+
+        assert(m.bucket_count() == 512);
+        assert(allocated_bytes == 1'000 * sizeof(expected_node) + (512 + 1) * sizeof(void*));
+    }
+
+    assert(allocated_bytes == 0);
+}
+
+void test_set() {
+    stdext::compact_unordered_set<string> s{"cat", "dog", "cat", "bird"};
+    assert(s.size() == 3);
+    assert(s.count("cat") == 1);
+    assert(!s.insert("dog").second);
+    assert(s.emplace(3, 'x').second);
+    assert(s.contains("xxx"));
+
+    const string fish = "fish";
+    assert(s.insert(fish).second);
+    assert(s.erase("cat") == 1);
+
+    stdext::compact_unordered_set<string> other{"dog", "bird", "xxx", "fish"};
+    assert(s == other);
+    other.insert("cat");
+    assert(s != other);
+}
+
+void test_copy_move_swap() {
+    stdext::compact_unordered_map<int, string> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, to_string(i));
+    }
+
+    for (int i = 0; i < 100; i += 2) {
+        m.erase(i);
+    }
+
+    auto copy = m;
+    assert(copy == m);
+    assert(copy.bucket_count() == m.bucket_count());
+
+    auto moved = move(copy);
+    assert(moved == m);
+    assert(copy.empty()); // implementation assumption; the source is left empty
+
+    stdext::compact_unordered_map<int, string> small{{1, "one"}};
+    small.swap(moved);
+    assert(small == m);
+    assert(moved.size() == 1 && moved.at(1) == "one");
+
+    // the moved and swapped tables are still usable
+    for (int i = 100; i < 200; ++i) {
+        small.try_emplace(i, to_string(i));
+        moved.try_emplace(i, to_string(i));
+    }
+
+    assert(small.size() == 150 && moved.size() == 101);
+
+    moved = small;
+    assert(moved == small);
+    small = {{2, "two"}};
+    assert(small.size() == 1 && small[2] == "two");
+    moved = move(small);
+    assert(moved.size() == 1 && moved[2] == "two");
+}
+
+void test_move_only() {
+    stdext::compact_unordered_map<int, unique_ptr<int>> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, make_unique<int>(i));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        assert(*m.at(i) == i);
+    }
+
+    auto moved = move(m);
+    assert(moved.size() == 100);
+}
+
+void test_self_referencing_insert() {
+    // rehashing only relinks nodes, so the arguments of an insertion may refer to elements
+    stdext::compact_unordered_map<int, string> m;
+    m.try_emplace(0, string(100, 'a'));
+    for (int i = 1; i < 200; ++i) {
+        m.try_emplace(i, m.at(i - 1));
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        assert(m.at(i) == string(100, 'a'));
+    }
+}
+
+void test_throwing_hash() {
+    // each hash call of an insertion in turn throws, including those of a rehash, which hashes every element before
+    // relinking any; the table is left intact
+    stdext::compact_unordered_set<int, throwing_hash> s;
+    int throws = 0;
+    for (int i = 0; i < 200; ++i) {
+        for (int calls = 0;; ++calls) {
+            const auto before       = s;
+            const auto buckets      = s.bucket_count();
+            hash_calls_before_throw = calls;
+            try {
+                s.insert(i);
+                hash_calls_before_throw = -1;
+                break;
+            } catch (const runtime_error&) {
+                hash_calls_before_throw = -1;
+                ++throws;
+                assert(s == before);
+                assert(s.bucket_count() == buckets);
+            }
+        }
+    }
+
+    assert(s.size() == 200);
+    assert(throws > 200);
+}
+
+void test_unequal_allocators() {
+    using alloc_t = tracking_allocator<pair<const int, string>>;
+    stdext::compact_unordered_map<int, string, hash<int>, equal_to<int>, alloc_t> m(alloc_t{1});
+    for (int i = 0; i < 50; ++i) {
+        m.try_emplace(i, to_string(i));
+    }
+
+    decltype(m) other(move(m), alloc_t{2});
+    assert(other.get_allocator().id == 2);
+    assert(other.size() == 50);
+    assert(m.empty());
+    for (int i = 0; i < 50; ++i) {
+        assert(other.at(i) == to_string(i));
+    }
+
+    decltype(m) third(alloc_t{3});
+    third = move(other);
+    assert(third.get_allocator().id == 3);
+    assert(third.size() == 50 && third.at(42) == "42");
+}
+
+void test_pmr() {
+    pmr::monotonic_buffer_resource mr;
+    stdext::pmr::compact_unordered_map<int, pmr::string> m(&mr);
+    m.try_emplace(1, "a string long enough to need an allocation from the resource");
+    assert(m.get_allocator().resource() == &mr);
+    assert(m.at(1).get_allocator().resource() == &mr);
+
+    stdext::pmr::compact_unordered_set<int> s(&mr);
+    s.insert(1);
+    assert(s.contains(1));
+}
+
+int main() {
+    test_map_basics();
+    test_against_unordered_map<hash<int>>(1729, 1.0f);
+    test_against_unordered_map<identity_hash>(1234, 1.0f);
+    test_against_unordered_map<clustered_hash>(42, 1.0f);
+    test_against_unordered_map<hash<int>>(7, 8.0f);
+    test_against_unordered_map<identity_hash>(99, 0.25f);
+    test_max_load_factor();
+    test_reserve();
+    test_memory_footprint();
+    test_set();
+    test_copy_move_swap();
+    test_move_only();
+    test_self_referencing_insert();
+    test_throwing_hash();
+    test_unequal_allocators();
+    test_pmr();
+}
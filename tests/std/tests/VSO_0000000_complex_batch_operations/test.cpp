@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <list>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+bool same_value(const T actual, const T expected) {
+    return actual == expected || (isnan(actual) && isnan(expected));
+}
+
+template <class T>
+bool close_to(const T actual, const T expected) {
+    if (isnan(expected)) {
+        return isnan(actual);
+    }
+
+    if (isinf(expected)) {
+        return actual == expected;
+    }
+
+    return abs(actual - expected) <= 2 * numeric_limits<T>::epsilon() * abs(expected)
+        || abs(actual - expected) <= numeric_limits<T>::min();
+}
+
+template <class T>
+bool close_to(const complex<T>& actual, const complex<T>& expected) {
+    return close_to(actual.real(), expected.real()) && close_to(actual.imag(), expected.imag());
+}
+
+template <class T>
+vector<complex<T>> make_values(const size_t n, const int seed) {
+    vector<complex<T>> values;
+    for (size_t i = 0; i < n; ++i) {
+        const auto k = static_cast<int>(i) * 37 + seed;
+        values.emplace_back(static_cast<T>(k % 19 - 9) / 4, static_cast<T>(k % 23 - 11) / 3);
+    }
+
+    return values;
+}
+
+template <class T>
+void test_multiply(const size_t n) {
+    const auto a = make_values<T>(n, 1);
+    const auto b = make_values<T>(n, 5);
+    vector<complex<T>> product(n);
+    assert(stdext::complex_multiply(a.begin(), a.end(), b.begin(), product.begin()) == product.end());
+
+    auto acc = make_values<T>(n, 11);
+    const auto original_acc = acc;
+    assert(stdext::complex_multiply_accumulate(a.begin(), a.end(), b.begin(), acc.begin()) == acc.end());
+
+    for (size_t i = 0; i < n; ++i) {
+        const complex<T> expected = a[i] * b[i];
+        assert(same_value(product[i].real(), expected.real()));
+        assert(same_value(product[i].imag(), expected.imag()));
+
+        complex<T> expected_acc = original_acc[i];
+        expected_acc += a[i] * b[i];
+        assert(same_value(acc[i].real(), expected_acc.real()));
+        assert(same_value(acc[i].imag(), expected_acc.imag()));
+    }
+
+    // non-contiguous ranges take the element-by-element path
+    const list<complex<T>> a_list(a.begin(), a.end());
+    vector<complex<T>> product_from_list(n);
+    stdext::complex_multiply(a_list.begin(), a_list.end(), b.begin(), product_from_list.begin());
+    assert(product_from_list == product);
+
+    // the destination may be one of the sources
+    auto in_place = a;
+    stdext::complex_multiply(in_place.begin(), in_place.end(), b.begin(), in_place.begin());
+    assert(in_place == product);
+}
+
+template <class T>
+void test_abs_arg_exp(const size_t n) {
+    constexpr T inf = numeric_limits<T>::infinity();
+    constexpr T nan = numeric_limits<T>::quiet_NaN();
+
+    auto values = make_values<T>(n, 3);
+    const complex<T> specials[] = {{0, 0}, {-0.0f, 0}, {inf, 1}, {1, -inf}, {inf, nan}, {nan, 2}, {1000, 1},
+        {-1000, 3}, {numeric_limits<T>::max(), numeric_limits<T>::max()},
+        {numeric_limits<T>::denorm_min(), numeric_limits<T>::min()}};
+    for (size_t i = 0; i < n; i += 7) {
+        values[i] = specials[i / 7 % size(specials)];
+    }
+
+    vector<T> magnitudes(n);
+    vector<T> angles(n);
+    vector<complex<T>> exponentials(n);
+    assert(stdext::complex_abs(values.begin(), values.end(), magnitudes.begin()) == magnitudes.end());
+    assert(stdext::complex_arg(values.begin(), values.end(), angles.begin()) == angles.end());
+    assert(stdext::complex_exp(values.begin(), values.end(), exponentials.begin()) == exponentials.end());
+
+    for (size_t i = 0; i < n; ++i) {
+        assert(close_to(magnitudes[i], abs(values[i])));
+        assert(same_value(angles[i], arg(values[i])));
+        assert(close_to(exponentials[i], exp(values[i])));
+    }
+
+    auto in_place = values;
+    stdext::complex_exp(in_place.begin(), in_place.end(), in_place.begin());
+    for (size_t i = 0; i < n; ++i) {
+        assert(close_to(in_place[i], exponentials[i]));
+    }
+}
+
+template <class T>
+void test_all() {
+    for (const size_t n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 63, 64, 65, 200}) {
+        test_multiply<T>(n);
+        test_abs_arg_exp<T>(n);
+    }
+}
+
+int main() {
+    test_all<float>();
+    test_all<double>();
+    test_all<long double>();
+
+    const complex<double> big(1e300, 1e300);
+    double magnitude = 0;
+    stdext::complex_abs(&big, &big + 1, &magnitude);
+    assert(close_to(magnitude, abs(big)));
+}
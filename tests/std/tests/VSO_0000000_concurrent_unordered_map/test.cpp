@@ -0,0 +1,250 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// sends every key to the same stripe and bucket
+struct collide_hash {
+    size_t operator()(const int) const noexcept {
+        return 0;
+    }
+};
+
+int value_of(const stdext::concurrent_unordered_map<int, int>& m, const int key) {
+    int result = -1;
+    m.cvisit(key, [&](const pair<const int, int>& elem) { result = elem.second; });
+    return result;
+}
+
+void test_single_threaded() {
+    stdext::concurrent_unordered_map<int, int> m;
+    assert(m.empty());
+    assert(m.size() == 0);
+    assert(m.bucket_count() == 0);
+
+    assert(m.insert({1, 10}));
+    assert(!m.insert({1, 11}));
+    assert(m.emplace(2, 20));
+    assert(!m.emplace(2, 21));
+    assert(m.try_emplace(3, 30));
+    assert(!m.try_emplace(3, 31));
+    assert(m.emplace(piecewise_construct, forward_as_tuple(4), forward_as_tuple(40)));
+    assert(!m.emplace(piecewise_construct, forward_as_tuple(4), forward_as_tuple(41)));
+    assert(m.insert_or_assign(5, 50));
+    assert(!m.insert_or_assign(5, 51));
+    assert(m.size() == 5);
+    assert(!m.empty());
+
+    assert(value_of(m, 1) == 10);
+    assert(value_of(m, 2) == 20);
+    assert(value_of(m, 3) == 30);
+    assert(value_of(m, 4) == 40);
+    assert(value_of(m, 5) == 51);
+    assert(value_of(m, 6) == -1);
+    assert(m.contains(1));
+    assert(!m.contains(6));
+    assert(m.count(2) == 1);
+    assert(m.count(6) == 0);
+
+    assert(m.visit(1, [](pair<const int, int>& elem) { elem.second += 5; }));
+    assert(!m.visit(6, [](pair<const int, int>&) { assert(false); }));
+    assert(value_of(m, 1) == 15);
+
+    int sum = 0;
+    assert(m.cvisit_all([&](const pair<const int, int>& elem) { sum += elem.second; }) == 5);
+    assert(sum == 15 + 20 + 30 + 40 + 51);
+    assert(m.visit_all([](pair<const int, int>& elem) { elem.second = elem.first; }) == 5);
+    assert(value_of(m, 4) == 4);
+
+    assert(m.erase(3) == 1);
+    assert(m.erase(3) == 0);
+    assert(m.erase_if(4, [](const pair<const int, int>& elem) { return elem.second != 4; }) == 0);
+    assert(m.erase_if(4, [](const pair<const int, int>& elem) { return elem.second == 4; }) == 1);
+    assert(m.erase_if([](const pair<const int, int>& elem) { return elem.first % 2 != 0; }) == 2);
+    assert(m.size() == 1);
+    assert(value_of(m, 2) == 2);
+
+    m.clear();
+    assert(m.empty());
+    assert(m.insert({7, 70}));
+    assert(value_of(m, 7) == 70);
+
+    const vector<pair<int, int>> values{{1, 1}, {2, 4}, {3, 9}, {2, 5}};
+    stdext::concurrent_unordered_map<int, int> from_range(values.begin(), values.end());
+    assert(from_range.size() == 3);
+    assert(value_of(from_range, 2) == 4);
+
+    stdext::concurrent_unordered_map<int, int> from_list{{1, 1}, {2, 4}};
+    assert(from_list.size() == 2);
+    from_list.insert({{3, 9}, {4, 16}});
+    assert(from_list.size() == 4);
+}
+
+void test_growth() {
+    stdext::concurrent_unordered_map<int, int> m;
+    m.reserve(1000);
+    const size_t reserved = m.bucket_count();
+    assert(reserved >= 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(m.emplace(i, i * 2));
+    }
+
+    assert(m.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(value_of(m, i) == i * 2);
+    }
+
+    for (int i = 1000; i < 20000; ++i) {
+        assert(m.emplace(i, i * 2));
+    }
+
+    assert(m.bucket_count() >= m.size());
+    for (int i = 0; i < 20000; i += 7) {
+        assert(value_of(m, i) == i * 2);
+    }
+
+    m.rehash(100000);
+    assert(m.bucket_count() >= 100000);
+    assert(m.size() == 20000);
+    for (int i = 0; i < 20000; i += 3) {
+        assert(value_of(m, i) == i * 2);
+    }
+
+    stdext::concurrent_unordered_map<int, int, collide_hash> collide;
+    for (int i = 0; i < 300; ++i) {
+        assert(collide.emplace(i, i));
+    }
+
+    for (int i = 0; i < 300; i += 2) {
+        assert(collide.erase(i) == 1);
+    }
+
+    assert(collide.size() == 150);
+    for (int i = 0; i < 300; ++i) {
+        assert(collide.contains(i) == (i % 2 != 0));
+    }
+}
+
+void test_copy_move_swap() {
+    stdext::concurrent_unordered_map<int, string> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, to_string(i));
+    }
+
+    stdext::concurrent_unordered_map<int, string> copied(m);
+    assert(copied.size() == 100);
+    stdext::concurrent_unordered_map<int, string> moved(move(copied));
+    assert(moved.size() == 100);
+    assert(copied.empty()); // intentional use after move
+
+    stdext::concurrent_unordered_map<int, string> assigned;
+    assigned.emplace(1000, "x");
+    assigned = m;
+    assert(assigned.size() == 100);
+    assert(!assigned.contains(1000));
+    assigned = move(moved);
+    assert(assigned.size() == 100);
+
+    stdext::concurrent_unordered_map<int, string> other{{-1, "minus one"}};
+    swap(assigned, other);
+    assert(assigned.size() == 1);
+    assert(other.size() == 100);
+    string found;
+    assert(other.cvisit(42, [&](const pair<const int, string>& elem) { found = elem.second; }));
+    assert(found == "42");
+
+    // moving between unequal allocators moves the elements one by one
+    pmr::monotonic_buffer_resource first_resource;
+    pmr::monotonic_buffer_resource second_resource;
+    stdext::pmr::concurrent_unordered_map<int, pmr::string> first(&first_resource);
+    for (int i = 0; i < 100; ++i) {
+        first.try_emplace(i, "a string long enough to allocate from its resource");
+    }
+
+    stdext::pmr::concurrent_unordered_map<int, pmr::string> second(move(first), &second_resource);
+    assert(second.size() == 100);
+    assert(second.get_allocator().resource() == &second_resource);
+    second.cvisit(5, [&](const pair<const int, pmr::string>& elem) {
+        assert(elem.second.get_allocator().resource() == &second_resource);
+    });
+}
+
+void test_concurrent() {
+    constexpr int thread_count = 8;
+    constexpr int per_thread   = 5000;
+    stdext::concurrent_unordered_map<int, int> m;
+    atomic<int> inserted{0};
+    atomic<int> erased{0};
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                // every key is inserted by two threads (again, if one erases it before the other gets there), and bumped
+                // and looked up by all of them
+                const int key = (t / 2) * per_thread + i;
+                if (m.try_emplace(key, 0)) {
+                    ++inserted;
+                }
+
+                m.visit(key, [](pair<const int, int>& elem) { ++elem.second; });
+                const int other = (i * 7919) % (thread_count / 2 * per_thread);
+                m.cvisit(other, [&](const pair<const int, int>& elem) { assert(elem.first == other); });
+                if (i % 10 == 9 && m.erase(key - 5) == 1) {
+                    ++erased;
+                }
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(inserted.load() >= thread_count / 2 * per_thread);
+    assert(m.size() == static_cast<size_t>(inserted.load() - erased.load()));
+
+    // concurrent insert_or_assign and erase_if against a sweep of the whole table
+    threads.clear();
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                if (t == 0 && i % 1000 == 0) {
+                    (void) m.erase_if([](const pair<const int, int>& elem) { return elem.second < 0; });
+                } else {
+                    m.insert_or_assign(t * per_thread + i, t);
+                }
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    size_t counted = 0;
+    m.cvisit_all([&](const pair<const int, int>& elem) {
+        assert(elem.second >= 0);
+        ++counted;
+    });
+    assert(counted == m.size());
+}
+
+int main() {
+    test_single_threaded();
+    test_growth();
+    test_copy_move_swap();
+    test_concurrent();
+}
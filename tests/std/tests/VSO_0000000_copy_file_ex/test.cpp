@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_copy_file_ex";
+
+string contents_of(const path& p) {
+    ifstream in{p, ios::binary};
+    return string{istreambuf_iterator<char>{in}, istreambuf_iterator<char>{}};
+}
+
+void write_file(const path& p, const string& text) {
+    ofstream{p, ios::binary} << text;
+}
+
+string big_text() {
+    string result;
+    for (size_t i = 0; i < 4 * 1024 * 1024; ++i) {
+        result.push_back(static_cast<char>('a' + i % 23));
+    }
+
+    return result;
+}
+
+void test_copy_file_ex(const string& text) {
+    const path from = base / L"from";
+    const path to   = base / L"to";
+    write_file(from, text);
+
+    error_code ec;
+    assert(stdext::filesystem::copy_file_ex(
+        from, to, copy_options::none, stdext::filesystem::copy_file_flags::no_buffering, ec));
+    assert(!ec);
+    assert(contents_of(to) == text);
+
+    // the options mean the same as they do for copy_file
+    assert(!stdext::filesystem::copy_file_ex(
+        from, to, copy_options::none, stdext::filesystem::copy_file_flags::none, ec));
+    assert(ec == errc::file_exists);
+    assert(!stdext::filesystem::copy_file_ex(
+        from, to, copy_options::skip_existing, stdext::filesystem::copy_file_flags::none, ec));
+    assert(!ec);
+
+    write_file(from, "shorter");
+    assert(stdext::filesystem::copy_file_ex(from, to, copy_options::overwrite_existing));
+    assert(contents_of(to) == "shorter");
+
+    bool threw = false;
+    try {
+        (void) stdext::filesystem::copy_file_ex(base / L"missing", to);
+    } catch (const filesystem_error& err) {
+        threw = true;
+        assert(err.path1() == base / L"missing");
+        assert(err.path2() == to);
+    }
+    assert(threw);
+}
+
+void test_progress(const string& text) {
+    const path from = base / L"progress_from";
+    const path to   = base / L"progress_to";
+    write_file(from, text);
+
+    uintmax_t last = 0;
+    size_t calls   = 0;
+    error_code ec;
+    const auto progress = [&](const uintmax_t copied, const uintmax_t total) {
+        assert(total == text.size());
+        assert(copied >= last && copied <= total);
+        last = copied;
+        ++calls;
+        return true;
+    };
+
+    assert(stdext::filesystem::copy_file_ex(
+        from, to, copy_options::none, stdext::filesystem::copy_file_flags::none, progress, ec));
+    assert(!ec);
+    assert(calls != 0);
+    assert(last == text.size());
+    assert(contents_of(to) == text);
+}
+
+void test_cancel(const string& text) {
+    const path from = base / L"cancel_from";
+    const path to   = base / L"cancel_to";
+    write_file(from, text);
+
+    // returning false from the callback stops the copy and removes the partially written target
+    error_code ec;
+    assert(!stdext::filesystem::copy_file_ex(from, to, copy_options::none, stdext::filesystem::copy_file_flags::none,
+        [](uintmax_t, uintmax_t) { return false; }, ec));
+    assert(ec == errc::operation_canceled);
+    assert(!exists(to));
+
+    // an exception thrown by the callback cancels the copy, then propagates to the caller
+    bool threw = false;
+    try {
+        const auto throwing = [](uintmax_t, uintmax_t) -> bool { throw runtime_error("stop"); };
+        (void) stdext::filesystem::copy_file_ex(
+            from, to, copy_options::none, stdext::filesystem::copy_file_flags::none, throwing, ec);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(!exists(to));
+}
+
+void create_tree(const path& root) {
+    assert(create_directory(root));
+    for (int i = 0; i < 8; ++i) {
+        const path dir = root / to_wstring(i);
+        assert(create_directory(dir));
+        for (int j = 0; j < i; ++j) {
+            const path subdir = dir / (L"sub" + to_wstring(j));
+            assert(create_directory(subdir));
+            for (int k = 0; k < j; ++k) {
+                write_file(subdir / (L"file" + to_wstring(k)), string(static_cast<size_t>(k * 100), 'x'));
+            }
+        }
+
+        write_file(dir / L"top", to_string(i));
+    }
+}
+
+void assert_same_tree(const path& left, const path& right) {
+    size_t entries = 0;
+    for (const auto& entry : recursive_directory_iterator(left)) {
+        const path other = right / entry.path().lexically_relative(left);
+        assert(entry.is_directory() == is_directory(other));
+        if (entry.is_regular_file()) {
+            assert(contents_of(entry.path()) == contents_of(other));
+        }
+
+        ++entries;
+    }
+
+    for (const auto& entry : recursive_directory_iterator(right)) {
+        (void) entry;
+        --entries;
+    }
+
+    assert(entries == 0);
+}
+
+void test_parallel_copy() {
+    const path from = base / L"tree";
+    const path to   = base / L"tree_copy";
+    create_tree(from);
+
+    error_code ec;
+    stdext::filesystem::parallel_copy(
+        from, to, copy_options::none, stdext::filesystem::copy_file_flags::no_buffering, ec);
+    assert(!ec);
+    assert_same_tree(from, to);
+
+    // copying again reports the existing files, as copy does
+    stdext::filesystem::parallel_copy(from, to, copy_options::none, stdext::filesystem::copy_file_flags::none, ec);
+    assert(ec == errc::file_exists);
+    stdext::filesystem::parallel_copy(from, to, copy_options::skip_existing);
+    assert_same_tree(from, to);
+
+    // directories_only copies the structure without the files
+    const path dirs = base / L"tree_dirs";
+    stdext::filesystem::parallel_copy(from, dirs, copy_options::directories_only);
+    for (const auto& entry : recursive_directory_iterator(dirs)) {
+        assert(entry.is_directory());
+    }
+
+    // copying a directory onto itself is an error rather than unbounded recursion
+    stdext::filesystem::parallel_copy(from, from, copy_options::none, stdext::filesystem::copy_file_flags::none, ec);
+    assert(ec == errc::file_exists);
+
+    // nondirectories are copied as copy would
+    stdext::filesystem::parallel_copy(from / L"0" / L"top", base / L"single");
+    assert(contents_of(base / L"single") == "0");
+
+    bool threw = false;
+    try {
+        stdext::filesystem::parallel_copy(base / L"missing", base / L"nowhere");
+    } catch (const filesystem_error& err) {
+        threw = true;
+        assert(err.path1() == base / L"missing");
+        assert(err.code() == errc::no_such_file_or_directory);
+    }
+    assert(threw);
+
+    // run serially on the calling thread
+    {
+        stdext::parallel_algorithms_scope serial{nullptr, 1};
+        const path serial_copy = base / L"tree_serial";
+        stdext::filesystem::parallel_copy(from, serial_copy);
+        assert_same_tree(from, serial_copy);
+    }
+}
+
+int main() {
+    remove_all(base);
+    assert(create_directory(base));
+    const auto text = big_text();
+    test_copy_file_ex(text);
+    test_progress(text);
+    test_cancel(text);
+    test_parallel_copy();
+    remove_all(base);
+}
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <locale>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+// In the "C" locale the range overloads of ctype<char>::tolower and toupper work on several characters at once;
+// they must agree with the single-character overloads for every byte, wherever it falls in the range.
+string all_bytes_from(const size_t start, const size_t len) {
+    string result;
+    for (size_t i = 0; i < len; ++i) {
+        result.push_back(static_cast<char>((start + i) & 0xFF));
+    }
+
+    return result;
+}
+
+void test_against_single(const ctype<char>& fac) {
+    for (size_t len = 0; len < 40; ++len) {
+        for (size_t start = 0; start < 256; start += (len < 10 ? 1 : 9)) {
+            const string original = all_bytes_from(start, len);
+            string lower          = original;
+            string upper          = original;
+            assert(fac.tolower(&lower[0], lower.data() + lower.size()) == lower.data() + lower.size());
+            assert(fac.toupper(&upper[0], upper.data() + upper.size()) == upper.data() + upper.size());
+            for (size_t i = 0; i < len; ++i) {
+                assert(lower[i] == fac.tolower(original[i]));
+                assert(upper[i] == fac.toupper(original[i]));
+            }
+        }
+    }
+
+    // all 256 bytes in one range, so that every byte also occupies every position in a word
+    for (size_t start = 0; start < 16; ++start) {
+        const string original = all_bytes_from(start, 256 + 16);
+        string lower          = original;
+        (void) fac.tolower(&lower[0], lower.data() + lower.size());
+        for (size_t i = 0; i < original.size(); ++i) {
+            assert(lower[i] == fac.tolower(original[i]));
+        }
+    }
+}
+
+void test_classic() {
+    const auto& fac = use_facet<ctype<char>>(locale::classic());
+    string header   = "Content-Type: TEXT/HTML; charset=UTF-8 [@`{]";
+    (void) fac.tolower(&header[0], header.data() + header.size());
+    assert(header == "content-type: text/html; charset=utf-8 [@`{]");
+    (void) fac.toupper(&header[0], header.data() + header.size());
+    assert(header == "CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 [@`{]");
+
+    // bytes outside ASCII are left alone
+    string high = "\xC0\xC1\xDA\xE1\xFA\xFF";
+    (void) fac.tolower(&high[0], high.data() + high.size());
+    assert(high == "\xC0\xC1\xDA\xE1\xFA\xFF");
+    (void) fac.toupper(&high[0], high.data() + high.size());
+    assert(high == "\xC0\xC1\xDA\xE1\xFA\xFF");
+
+    // an empty range
+    char c = 'A';
+    assert(fac.tolower(&c, &c) == &c && c == 'A');
+
+    test_against_single(fac);
+}
+
+int main() {
+    test_classic();
+
+    // other locales take the per-character path, which must still match
+    try {
+        test_against_single(use_facet<ctype<char>>(locale("")));
+    } catch (const runtime_error&) {
+        // no such locale
+    }
+}
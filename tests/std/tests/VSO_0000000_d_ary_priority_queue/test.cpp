@@ -0,0 +1,157 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Queue, class Reference>
+void assert_same_pops(Queue& q, Reference& ref) {
+    assert(q.size() == ref.size());
+    while (!ref.empty()) {
+        assert(!q.empty());
+        assert(q.top() == ref.top());
+        q.pop();
+        ref.pop();
+    }
+
+    assert(q.empty());
+}
+
+template <size_t Arity, class Container = vector<int>, class Pr = less<int>>
+void test_against_priority_queue(const unsigned int seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> vals(0, 500);
+    stdext::d_ary_priority_queue<int, Container, Pr, Arity> q;
+    priority_queue<int, vector<int>, Pr> ref;
+    static_assert(decltype(q)::arity == Arity, "arity should be exposed");
+
+    for (int step = 0; step < 20'000; ++step) {
+        if (gen() % 3 != 0 || ref.empty()) {
+            const int val = vals(gen);
+            q.push(val);
+            ref.push(val);
+        } else {
+            assert(q.top() == ref.top());
+            q.pop();
+            ref.pop();
+        }
+
+        assert(q.size() == ref.size());
+    }
+
+    assert_same_pops(q, ref);
+
+    // build heaps of every small size, which covers nodes with fewer than Arity children
+    for (int n = 0; n < 100; ++n) {
+        vector<int> v(static_cast<size_t>(n));
+        for (auto& val : v) {
+            val = vals(gen);
+        }
+
+        stdext::d_ary_priority_queue<int, Container, Pr, Arity> built(v.begin(), v.end());
+        priority_queue<int, vector<int>, Pr> built_ref(v.begin(), v.end());
+        assert_same_pops(built, built_ref);
+    }
+}
+
+void test_constructors() {
+    const vector<int> v{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+    stdext::d_ary_priority_queue<int> from_range(v.begin(), v.end());
+    assert(from_range.top() == 9);
+
+    stdext::d_ary_priority_queue<int, vector<int>, greater<int>> from_pred(v.begin(), v.end(), greater<int>{});
+    assert(from_pred.top() == 1);
+
+    stdext::d_ary_priority_queue<int> from_copy(less<int>{}, v);
+    assert(from_copy.size() == v.size() && from_copy.top() == 9);
+
+    vector<int> moved = v;
+    stdext::d_ary_priority_queue<int, vector<int>, less<int>, 3> from_move(less<int>{}, move(moved));
+    vector<int> popped;
+    while (!from_move.empty()) {
+        popped.push_back(from_move.top());
+        from_move.pop();
+    }
+
+    vector<int> expected = v;
+    sort(expected.begin(), expected.end(), greater<int>{});
+    assert(popped == expected);
+
+    stdext::d_ary_priority_queue<int> from_alloc(allocator<int>{});
+    assert(from_alloc.empty());
+    stdext::d_ary_priority_queue<int> from_pred_alloc(less<int>{}, allocator<int>{});
+    assert(from_pred_alloc.empty());
+
+    static_assert(uses_allocator_v<stdext::d_ary_priority_queue<int>, allocator<int>>, "should use allocator");
+    static_assert(!uses_allocator_v<stdext::d_ary_priority_queue<int>, int>, "should not use allocator");
+}
+
+void test_move_only() {
+    stdext::d_ary_priority_queue<unique_ptr<int>, vector<unique_ptr<int>>,
+        bool (*)(const unique_ptr<int>&, const unique_ptr<int>&)>
+        q([](const unique_ptr<int>& left, const unique_ptr<int>& right) { return *left < *right; });
+    for (int i = 0; i < 100; ++i) {
+        q.push(make_unique<int>((i * 37) % 100));
+    }
+
+    q.emplace(new int(1000));
+    assert(*q.top() == 1000);
+    q.pop();
+    for (int i = 99; i >= 0; --i) {
+        assert(*q.top() == i);
+        q.pop();
+    }
+
+    assert(q.empty());
+}
+
+void test_strings_and_swap() {
+    stdext::d_ary_priority_queue<string> q;
+    q.push("banana");
+    q.push("cherry");
+    q.emplace(3, 'a');
+    const string apple = "apple";
+    q.push(apple);
+
+    stdext::d_ary_priority_queue<string> other;
+    other.push("zebra");
+
+    swap(q, other);
+    assert(q.size() == 1 && q.top() == "zebra");
+    assert(other.size() == 4);
+    other.swap(q);
+    assert(q.top() == "cherry");
+    q.pop();
+    assert(q.top() == "banana");
+    q.pop();
+    assert(q.top() == "apple");
+    q.pop();
+    assert(q.top() == "aaa");
+    q.pop();
+    assert(q.empty());
+}
+
+int main() {
+    test_against_priority_queue<2>(1729);
+    test_against_priority_queue<3>(1234);
+    test_against_priority_queue<4>(42);
+    test_against_priority_queue<8>(7);
+    test_against_priority_queue<4, deque<int>>(99);
+    test_against_priority_queue<4, vector<int>, greater<int>>(2024);
+    test_constructors();
+    test_move_only();
+    test_strings_and_swap();
+}
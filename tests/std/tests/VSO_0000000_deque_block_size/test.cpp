@@ -0,0 +1,211 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// records the size of every allocation of Elem, which for deque is the number of elements per block
+vector<size_t> block_allocations;
+
+template <class T, class Elem = T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U, Elem>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if constexpr (is_same_v<T, Elem>) {
+            block_allocations.push_back(n);
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U, Elem>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U, Elem>&) const noexcept {
+        return false;
+    }
+};
+
+struct triple {
+    long long a;
+    long long b;
+    long long c;
+};
+
+struct big {
+    char data[5000];
+};
+
+template <class T, size_t BlockBytes>
+void assert_elements_per_block(const size_t expected) {
+    block_allocations.clear();
+    stdext::deque<T, counting_allocator<T>, BlockBytes> d(1000);
+    assert(!block_allocations.empty());
+    for (const auto n : block_allocations) {
+        assert(n == expected);
+    }
+}
+
+void test_block_sizes() {
+    assert_elements_per_block<char, 4096>(4096);
+    assert_elements_per_block<int, 4096>(1024);
+    assert_elements_per_block<int, 100>(16); // rounded down to a power of 2
+    assert_elements_per_block<triple, 4096>(128);
+    assert_elements_per_block<big, 1024>(1); // at least one element
+
+    // the default block sizes are unchanged
+    block_allocations.clear();
+    deque<int, counting_allocator<int>> d(100);
+    for (const auto n : block_allocations) {
+        assert(n == 4);
+    }
+}
+
+template <class Deque>
+void test_against_std_deque() {
+    Deque d;
+    deque<int> ref;
+    for (int i = 0; i < 5'000; ++i) {
+        switch (i % 7) {
+        case 0:
+        case 1:
+        case 2:
+            d.push_back(i);
+            ref.push_back(i);
+            break;
+        case 3:
+        case 4:
+            d.push_front(i);
+            ref.push_front(i);
+            break;
+        case 5:
+            d.pop_front();
+            ref.pop_front();
+            break;
+        default:
+            d.insert(d.begin() + static_cast<ptrdiff_t>(d.size() / 3), 3, i);
+            ref.insert(ref.begin() + static_cast<ptrdiff_t>(ref.size() / 3), 3, i);
+            break;
+        }
+    }
+
+    assert(equal(d.begin(), d.end(), ref.begin(), ref.end()));
+    d.erase(d.begin() + 10, d.begin() + 500);
+    ref.erase(ref.begin() + 10, ref.begin() + 500);
+    d.shrink_to_fit();
+    assert(equal(d.begin(), d.end(), ref.begin(), ref.end()));
+    assert(equal(d.rbegin(), d.rend(), ref.rbegin(), ref.rend()));
+
+    Deque copy(d);
+    assert(copy == d);
+    copy.pop_back();
+    assert(copy < d);
+    copy.swap(d);
+    assert(copy > d);
+}
+
+template <class Deque>
+void test_segmented_algorithms() {
+    // ranges that start and end in the middle of blocks, or span none, one, or many block boundaries
+    for (size_t first = 0; first < 40; first += 3) {
+        for (size_t last = first; last < 200; last += 7) {
+            Deque d;
+            for (int i = 0; i < 250; ++i) {
+                d.push_back(i);
+            }
+
+            for (int i = 1; i <= 5; ++i) {
+                d.push_front(-i); // so the first element isn't at the start of a block
+            }
+
+            const auto b = d.begin() + static_cast<ptrdiff_t>(first);
+            const auto e = d.begin() + static_cast<ptrdiff_t>(last);
+
+            vector<int> expected(b, e);
+            vector<int> copied(last - first);
+            assert(copy(b, e, copied.begin()) == copied.end());
+            assert(copied == expected);
+
+            const auto& cd = d;
+            vector<int> const_copied(last - first);
+            copy(cd.begin() + static_cast<ptrdiff_t>(first), cd.begin() + static_cast<ptrdiff_t>(last),
+                const_copied.begin());
+            assert(const_copied == expected);
+
+            long long sum = 0;
+            for_each(b, e, [&sum](const int x) { sum += x; });
+            assert(sum == accumulate(expected.begin(), expected.end(), 0LL));
+
+            for_each(b, e, [](int& x) { x *= 2; });
+            fill(d.begin(), b, 7);
+            for (size_t i = 0; i < d.size(); ++i) {
+                if (i < first) {
+                    assert(d[i] == 7);
+                } else if (i < last) {
+                    assert(d[i] == expected[i - first] * 2);
+                }
+            }
+        }
+    }
+}
+
+void test_non_trivial_elements() {
+    stdext::deque<string, allocator<string>, 256> d(100, "a string long enough to be allocated on the heap");
+    fill(d.begin() + 3, d.end() - 3, "short");
+    assert(count(d.begin(), d.end(), "short") == 94);
+
+    vector<string> v(d.size());
+    copy(d.begin(), d.end(), v.begin());
+    assert(equal(v.begin(), v.end(), d.begin(), d.end()));
+
+    size_t chars = 0;
+    for_each(d.cbegin(), d.cend(), [&chars](const string& s) { chars += s.size(); });
+    assert(chars == 6 * 48 + 94 * 5);
+}
+
+void test_allocator() {
+    using alloc_t = stdext::deque_block_allocator<allocator<int>, 512>;
+    stdext::deque<int, allocator<int>, 512> d{1, 2, 3};
+    static_assert(is_same_v<decltype(d.get_allocator()), alloc_t>);
+    const alloc_t a = allocator<int>{};
+    const stdext::deque_block_allocator<allocator<long>, 512> other(a);
+    assert(a == other);
+    assert(!(a != other));
+    assert(d.get_allocator() == a);
+
+    deque<int, alloc_t> same_type(d.begin(), d.end(), a);
+    assert(same_type == d);
+}
+
+int main() {
+    test_block_sizes();
+    test_against_std_deque<deque<int>>();
+    test_against_std_deque<stdext::deque<int>>();
+    test_against_std_deque<stdext::deque<int, allocator<int>, 64>>();
+    test_segmented_algorithms<deque<int>>();
+    test_segmented_algorithms<stdext::deque<int, allocator<int>, 64>>();
+    test_segmented_algorithms<stdext::deque<int>>();
+    test_non_trivial_elements();
+    test_allocator();
+}
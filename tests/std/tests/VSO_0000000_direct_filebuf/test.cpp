@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+const char* const file_name = "direct_filebuf.dat";
+
+string read_file() {
+    ifstream f(file_name, ios::binary);
+    return string(istreambuf_iterator<char>(f), istreambuf_iterator<char>());
+}
+
+void test_formatted_output() {
+    stdext::direct_filebuf fb(64);
+    assert(!fb.is_open());
+    assert(fb.open(file_name, ios::out | ios::binary));
+    assert(fb.is_open());
+    assert(!fb.open(file_name, ios::out)); // already open
+
+    ostream os(&fb);
+    ostringstream ref;
+    mt19937 gen(1729);
+    for (int i = 0; i < 20'000; ++i) {
+        if (gen() % 5 == 0) {
+            const string str(gen() % 300, static_cast<char>('a' + i % 26));
+            os << str;
+            ref << str;
+        } else {
+            os << i << ' ' << 0.5 * i << '\n';
+            ref << i << ' ' << 0.5 * i << '\n';
+        }
+    }
+
+    assert(os.flush().good());
+    assert(os.tellp() == static_cast<streamoff>(ref.str().size()));
+    assert(fb.close());
+    assert(!fb.close());
+    assert(read_file() == ref.str());
+
+    // \n isn't translated, even without ios::binary
+    assert(fb.open(string(file_name), ios::out));
+    os << "a\nb";
+    assert(fb.close());
+    assert(read_file() == "a\nb");
+
+    // app writes at the end
+    assert(fb.open(file_name, ios::app));
+    os << 'c';
+    assert(fb.close());
+    assert(read_file() == "a\nbc");
+}
+
+void test_formatted_input() {
+    {
+        ofstream out(file_name, ios::binary);
+        for (int i = 0; i < 10'000; ++i) {
+            out << i << ' ' << i * 0.25 << '\n';
+        }
+    }
+
+    stdext::direct_filebuf fb(100);
+    assert(fb.open(file_name, ios::in));
+    istream is(&fb);
+    for (int i = 0; i < 10'000; ++i) {
+        int ival    = -1;
+        double dval    = -1.0;
+        is >> ival >> dval;
+        assert(is.good());
+        assert(ival == i);
+        assert(dval == i * 0.25);
+    }
+
+    int ival = 0;
+    is >> ival;
+    assert(is.fail() && is.eof());
+}
+
+void test_against_model(const size_t buffer_size, const unsigned int seed) {
+    // a random mix of reads, writes, and seeks must have the same effect as on a string
+    string model;
+    size_t pos = 0;
+    {
+        stdext::direct_filebuf fb(buffer_size);
+        assert(fb.open(file_name, ios::in | ios::out | ios::trunc | ios::binary));
+        mt19937 gen(seed);
+        for (int step = 0; step < 20'000; ++step) {
+            switch (gen() % 6) {
+            case 0:
+                { // write, sometimes more than the buffer holds
+                    const string str(gen() % 5 == 0 ? gen() % 3000 : gen() % 40, static_cast<char>('A' + step % 26));
+                    assert(fb.sputn(str.data(), static_cast<streamsize>(str.size()))
+                           == static_cast<streamsize>(str.size()));
+                    if (model.size() < pos + str.size()) {
+                        model.resize(pos + str.size());
+                    }
+
+                    model.replace(pos, str.size(), str);
+                    pos += str.size();
+                    break;
+                }
+            case 1:
+                { // read, sometimes more than the buffer holds
+                    const size_t count = gen() % 5 == 0 ? gen() % 3000 : gen() % 50;
+                    string got(count, '\0');
+                    const auto read     = static_cast<size_t>(fb.sgetn(&got[0], static_cast<streamsize>(count)));
+                    const size_t expect = pos < model.size() ? min(count, model.size() - pos) : 0;
+                    assert(read == expect);
+                    assert(got.compare(0, read, model, pos, read) == 0);
+                    pos += read;
+                    break;
+                }
+            case 2:
+                {
+                    const size_t new_pos = gen() % (model.size() + 1);
+                    assert(fb.pubseekpos(static_cast<streamoff>(new_pos)) == static_cast<streamoff>(new_pos));
+                    pos = new_pos;
+                    break;
+                }
+            case 3:
+                assert(fb.pubseekoff(0, ios::cur) == static_cast<streamoff>(pos));
+                break;
+            case 4:
+                {
+                    const int ch = fb.sgetc();
+                    if (pos < model.size()) {
+                        assert(ch == static_cast<unsigned char>(model[pos]));
+                    } else {
+                        assert(ch == EOF);
+                    }
+
+                    if (ch != EOF && gen() % 2 == 0) {
+                        assert(fb.sbumpc() == ch);
+                    } else {
+                        assert(fb.sputc('#') == '#');
+                        if (pos == model.size()) {
+                            model.push_back('#');
+                        } else {
+                            model[pos] = '#';
+                        }
+                    }
+
+                    ++pos;
+                    break;
+                }
+            default:
+                {
+                    const auto offset  = static_cast<long long>(gen() % 21) - 10;
+                    const auto new_pos = static_cast<long long>(pos) + offset;
+                    if (new_pos >= 0 && new_pos <= static_cast<long long>(model.size())) {
+                        assert(fb.pubseekoff(offset, ios::cur) == new_pos);
+                        pos = static_cast<size_t>(new_pos);
+                    }
+
+                    break;
+                }
+            }
+        }
+    }
+
+    assert(read_file() == model);
+}
+
+void test_wide_and_move() {
+    {
+        ofstream out(file_name, ios::binary);
+        const wchar_t wide[] = {L'a', L'b', L'c'};
+        out.write(reinterpret_cast<const char*>(wide), sizeof(wide));
+        out.put('!'); // an incomplete element at the end is never read
+    }
+
+    stdext::wdirect_filebuf fb(2 * sizeof(wchar_t));
+    assert(fb.open(file_name, ios::in));
+    wchar_t got[10];
+    assert(fb.sgetn(got, 10) == 3);
+    assert(got[0] == L'a' && got[1] == L'b' && got[2] == L'c');
+    assert(fb.sgetc() == WEOF);
+
+    stdext::wdirect_filebuf moved(move(fb));
+    assert(!fb.is_open());
+    assert(moved.is_open());
+    assert(moved.pubseekpos(1) == 1);
+    assert(moved.sgetc() == L'b');
+
+    fb = move(moved);
+    assert(fb.is_open() && !moved.is_open());
+    assert(fb.sbumpc() == L'b');
+    swap(fb, moved);
+    assert(moved.sgetc() == L'c');
+}
+
+void test_open_failures() {
+    stdext::direct_filebuf fb;
+    assert(remove(file_name) == 0);
+    assert(!fb.open(file_name, ios::in));
+    assert(!fb.open(file_name, ios::in | ios::out));
+    assert(!fb.open(file_name, ios::in | ios::trunc)); // invalid combination
+    assert(!fb.is_open());
+    assert(fb.sgetc() == EOF);
+    assert(fb.sputc('x') == EOF);
+    assert(fb.pubseekoff(0, ios::cur) == -1);
+
+    assert(fb.open(file_name, ios::out | ios::_Noreplace));
+    assert(fb.close());
+    assert(!fb.open(file_name, ios::out | ios::_Noreplace));
+    assert(fb.open(L"direct_filebuf.dat", ios::in | ios::ate));
+    assert(fb.pubseekoff(0, ios::cur) == 0);
+}
+
+int main() {
+    test_formatted_output();
+    test_formatted_input();
+    for (const size_t buffer_size : {size_t{1}, size_t{16}, size_t{1000}}) {
+        test_against_model(buffer_size, static_cast<unsigned int>(buffer_size));
+    }
+
+    test_wide_and_move();
+    test_open_failures();
+    assert(remove(file_name) == 0);
+}
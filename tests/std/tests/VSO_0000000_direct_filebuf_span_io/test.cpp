@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <ios>
+#include <iterator>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const char* const file_name = "direct_filebuf_span_io.dat";
+
+vector<byte> pattern(const size_t size, const size_t seed) {
+    vector<byte> result(size);
+    for (size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<byte>((i * 31 + seed) % 251);
+    }
+
+    return result;
+}
+
+vector<byte> read_file() {
+    ifstream f(file_name, ios::binary);
+    const string str{istreambuf_iterator<char>(f), istreambuf_iterator<char>()};
+    vector<byte> result(str.size());
+    for (size_t i = 0; i < str.size(); ++i) {
+        result[i] = static_cast<byte>(str[i]);
+    }
+
+    return result;
+}
+
+void write_file(const vector<byte>& data) {
+    stdext::direct_filebuf fb(4096);
+    assert(fb.open(file_name, ios::out | ios::binary));
+    assert(fb.write_from(data));
+    assert(fb.close());
+}
+
+void test_write_from() {
+    // small writes go through the buffer, large ones straight to the file, and they stay in order
+    const vector<byte> data = pattern(100'000, 1);
+    stdext::direct_filebuf fb(1000);
+    assert(fb.open(file_name, ios::out | ios::binary));
+    const span<const byte> all{data};
+    const size_t sizes[] = {1, 999, 1000, 5, 3000, 0, 17, 40'000};
+    size_t offset        = 0;
+    for (size_t i = 0; offset < data.size(); ++i) {
+        const size_t count = min(sizes[i % size(sizes)], data.size() - offset);
+        assert(fb.write_from(all.subspan(offset, count)));
+        offset += count;
+    }
+
+    assert(fb.pubseekoff(0, ios::cur) == static_cast<streamoff>(data.size()));
+    assert(fb.close());
+    assert(read_file() == data);
+    assert(!fb.write_from(all.first(1))); // not open
+}
+
+void test_read_into() {
+    const vector<byte> data = pattern(100'000, 2);
+    write_file(data);
+
+    stdext::direct_filebuf fb(1000);
+    assert(fb.open(file_name, ios::in | ios::binary));
+    vector<byte> result(data.size());
+    const span<byte> all{result};
+    const size_t sizes[] = {1, 999, 1000, 5, 3000, 17, 40'000};
+    size_t offset        = 0;
+    for (size_t i = 0; offset < data.size(); ++i) {
+        const size_t count = min(sizes[i % size(sizes)], data.size() - offset);
+        assert(fb.read_into(all.subspan(offset, count)) == count);
+        offset += count;
+    }
+
+    assert(result == data);
+    byte extra[10];
+    assert(fb.read_into(extra) == 0);
+    assert(fb.close());
+}
+
+void test_mixed_with_stream_functions() {
+    const vector<byte> data = pattern(10'000, 3);
+    write_file(data);
+
+    // a direct read after sgetc() gives the rest of the buffer back to the file first
+    stdext::direct_filebuf fb(256);
+    assert(fb.open(file_name, ios::in | ios::binary));
+    assert(fb.sgetc() == static_cast<int>(data[0]));
+    assert(fb.sbumpc() == static_cast<int>(data[0]));
+    vector<byte> result(5'000);
+    assert(fb.read_into(result) == result.size());
+    assert(equal(result.begin(), result.end(), data.begin() + 1));
+    assert(fb.sgetc() == static_cast<int>(data[5'001]));
+    assert(fb.pubseekoff(0, ios::cur) == 5'001);
+    assert(fb.pubseekpos(9'990) == 9'990);
+    assert(fb.read_into(result) == 10);
+    assert(equal(result.begin(), result.begin() + 10, data.begin() + 9'990));
+    assert(fb.close());
+}
+
+void test_wide_elements() {
+    // a byte count that isn't a whole number of elements bypasses the buffer
+    const vector<byte> data = pattern(1'000, 4);
+    stdext::wdirect_filebuf fb(64);
+    assert(fb.open(file_name, ios::out | ios::binary));
+    assert(fb.write_from(span{data}.first(6)));
+    assert(fb.write_from(span{data}.subspan(6, 3)));
+    assert(fb.write_from(span{data}.subspan(9)));
+    assert(fb.close());
+    assert(read_file() == data);
+
+    assert(fb.open(file_name, ios::in | ios::binary));
+    vector<byte> result(data.size());
+    assert(fb.read_into(span{result}.first(4)) == 4);
+    assert(fb.read_into(span{result}.subspan(4, 1)) == 1);
+    assert(fb.read_into(span{result}.subspan(5)) == data.size() - 5);
+    assert(fb.close());
+    assert(result == data);
+}
+
+void test_read_into_async() {
+    // double-buffered reading of fixed-size records
+    constexpr size_t block  = 8'192;
+    const vector<byte> data = pattern(block * 10 + 123, 5);
+    write_file(data);
+
+    stdext::direct_filebuf fb(4'096);
+    assert(fb.open(file_name, ios::in | ios::binary));
+    vector<byte> buffers[2]{vector<byte>(block), vector<byte>(block)};
+    vector<byte> result;
+    size_t current         = 0;
+    future<size_t> pending = stdext::read_into_async(fb, buffers[current]);
+    for (;;) {
+        const size_t read = pending.get();
+        if (read == 0) {
+            break;
+        }
+
+        pending = stdext::read_into_async(fb, buffers[1 - current]);
+        const auto first = buffers[current].begin();
+        result.insert(result.end(), first, first + static_cast<ptrdiff_t>(read));
+        current = 1 - current;
+    }
+
+    assert(result == data);
+    assert(fb.close());
+}
+
+int main() {
+    test_write_from();
+    test_read_into();
+    test_mixed_with_stream_functions();
+    test_wide_elements();
+    test_read_into_async();
+    remove(file_name);
+}
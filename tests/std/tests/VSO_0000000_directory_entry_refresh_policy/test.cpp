@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+using stdext::filesystem::refresh_policy;
+
+const path base = L"test_directory_entry_refresh_policy";
+
+const error_code would_block = make_error_code(errc::operation_would_block);
+
+void test_enumerated_entries() {
+    size_t files       = 0;
+    size_t directories = 0;
+    for (const auto& entry : directory_iterator(base)) {
+        error_code ec;
+        // the enumeration data answers these without asking the file system again
+        const auto type = stdext::filesystem::status(entry, refresh_policy::never, ec).type();
+        assert(!ec);
+        assert(type == status(entry.path()).type());
+        assert(stdext::filesystem::symlink_status(entry, refresh_policy::never, ec).type() == type);
+        assert(!ec);
+
+        if (type == file_type::regular) {
+            ++files;
+            assert(stdext::filesystem::file_size(entry, refresh_policy::never, ec) == file_size(entry.path()));
+            assert(!ec);
+        } else {
+            assert(type == file_type::directory);
+            ++directories;
+        }
+
+        assert(stdext::filesystem::last_write_time(entry, refresh_policy::never, ec) == last_write_time(entry.path()));
+        assert(!ec);
+
+        // the link count is not part of the enumeration data
+        assert(stdext::filesystem::hard_link_count(entry, refresh_policy::never, ec) == static_cast<uintmax_t>(-1));
+        assert(ec == would_block);
+        assert(stdext::filesystem::hard_link_count(entry, refresh_policy::as_needed, ec) == hard_link_count(entry));
+        assert(!ec);
+    }
+
+    assert(files == 3);
+    assert(directories == 1);
+}
+
+void test_refreshed_entry() {
+    // constructing from a path or calling refresh() caches everything
+    directory_entry entry{base / L"file1"};
+    error_code ec;
+    assert(stdext::filesystem::hard_link_count(entry, refresh_policy::never, ec) == 1);
+    assert(!ec);
+    assert(stdext::filesystem::file_size(entry, refresh_policy::never, ec) == 1);
+    assert(!ec);
+
+#if _HAS_CXX20
+    entry.clear_cache();
+    assert(stdext::filesystem::file_size(entry, refresh_policy::never, ec) == static_cast<uintmax_t>(-1));
+    assert(ec == would_block);
+    assert(stdext::filesystem::status(entry, refresh_policy::never, ec).type() == file_type::none);
+    assert(ec == would_block);
+    assert(stdext::filesystem::status(entry, refresh_policy::as_needed, ec).type() == file_type::regular);
+    assert(!ec);
+    entry.refresh();
+    assert(stdext::filesystem::file_size(entry, refresh_policy::never, ec) == 1);
+    assert(!ec);
+#endif // _HAS_CXX20
+}
+
+void test_missing_file() {
+    const directory_entry entry{base / L"missing"};
+    error_code ec;
+    assert(stdext::filesystem::status(entry, refresh_policy::as_needed, ec).type() == file_type::not_found);
+    assert(stdext::filesystem::file_size(entry, refresh_policy::as_needed, ec) == static_cast<uintmax_t>(-1));
+    assert(ec && ec != would_block);
+}
+
+int main() {
+    remove_all(base);
+    assert(create_directory(base));
+    for (int i = 0; i < 3; ++i) {
+        ofstream{base / (L"file" + to_wstring(i))} << string(static_cast<size_t>(i), 'x');
+    }
+    assert(create_directory(base / L"dir"));
+
+    test_enumerated_entries();
+    test_refreshed_entry();
+    test_missing_file();
+    remove_all(base);
+}
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+// Directory iteration fetches entries from the file system in large batches; every entry must still be visited
+// exactly once, including in directories with many more entries than fit in one batch.
+constexpr size_t file_count   = 3'000;
+constexpr size_t subdir_count = 20;
+
+const path base = L"test_directory_iterator_many_entries";
+
+wstring file_name(const size_t i) {
+    // long names, so that fewer entries fit in each batch
+    return L"file_with_a_fairly_long_name_to_fill_the_fetch_buffer_quickly_" + to_wstring(i) + L".txt";
+}
+
+void create_tree() {
+    remove_all(base);
+    assert(create_directory(base));
+    for (size_t i = 0; i < file_count; ++i) {
+        ofstream{base / file_name(i)};
+    }
+
+    for (size_t i = 0; i < subdir_count; ++i) {
+        const path subdir = base / (L"subdir_" + to_wstring(i));
+        assert(create_directory(subdir));
+        for (size_t j = 0; j <= i; ++j) {
+            ofstream{subdir / file_name(j)};
+        }
+    }
+}
+
+void test_directory_iterator() {
+    set<wstring> seen;
+    size_t directories = 0;
+    for (const auto& entry : directory_iterator(base)) {
+        assert(seen.insert(entry.path().filename().wstring()).second);
+        if (entry.is_directory()) {
+            ++directories;
+        } else {
+            assert(entry.is_regular_file());
+            assert(entry.file_size() == 0);
+        }
+    }
+
+    assert(seen.size() == file_count + subdir_count);
+    assert(directories == subdir_count);
+    for (size_t i = 0; i < file_count; ++i) {
+        assert(seen.count(file_name(i)) == 1);
+    }
+}
+
+void test_recursive_directory_iterator() {
+    size_t files       = 0;
+    size_t directories = 0;
+    error_code ec;
+    for (recursive_directory_iterator it(base, ec), last; it != last; it.increment(ec)) {
+        assert(!ec);
+        if (it->is_directory()) {
+            ++directories;
+        } else {
+            ++files;
+        }
+    }
+
+    assert(!ec);
+    assert(directories == subdir_count);
+    assert(files == file_count + subdir_count * (subdir_count + 1) / 2);
+}
+
+int main() {
+    create_tree();
+    test_directory_iterator();
+    test_recursive_directory_iterator();
+    assert(remove_all(base) == 1 + file_count + subdir_count + subdir_count * (subdir_count + 1) / 2);
+}
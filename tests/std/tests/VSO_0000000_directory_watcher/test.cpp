@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono_literals;
+using namespace std::filesystem;
+using stdext::filesystem::change_kind;
+using stdext::filesystem::directory_watcher;
+using stdext::filesystem::watch_status;
+
+const path base = L"test_directory_watcher";
+
+void create_file(const path& p, const size_t size) {
+    ofstream f(p, ios::binary);
+    f << string(size, 'x');
+}
+
+bool contains(const vector<stdext::filesystem::change_event>& events, const change_kind kind, const path& p) {
+    return any_of(
+        events.begin(), events.end(), [&](const auto& event) { return event.kind == kind && event.entry.path() == p; });
+}
+
+void wait_for(directory_watcher& watcher, vector<stdext::filesystem::change_event>& seen, const change_kind kind,
+    const path& p) {
+    // changes may arrive over several batches
+    vector<stdext::filesystem::change_event> events;
+    while (!contains(seen, kind, p)) {
+        const auto status = watcher.wait(events, 10s);
+        assert(status == watch_status::changes || status == watch_status::overflow);
+        seen.insert(seen.end(), events.begin(), events.end());
+    }
+}
+
+void test_changes() {
+    directory_watcher watcher{base};
+    assert(watcher.is_open() && watcher.directory() == base);
+
+    vector<stdext::filesystem::change_event> seen;
+    create_file(base / L"meow.txt", 10);
+    wait_for(watcher, seen, change_kind::added, base / L"meow.txt");
+
+    // the tree below the directory is watched too
+    create_directory(base / L"sub");
+    create_file(base / L"sub" / L"purr.txt", 20);
+    wait_for(watcher, seen, change_kind::added, base / L"sub" / L"purr.txt");
+
+    rename(base / L"meow.txt", base / L"hiss.txt");
+    wait_for(watcher, seen, change_kind::renamed_from, base / L"meow.txt");
+    wait_for(watcher, seen, change_kind::renamed_to, base / L"hiss.txt");
+
+    remove(base / L"hiss.txt");
+    wait_for(watcher, seen, change_kind::removed, base / L"hiss.txt");
+
+    // entries of names that still exist may have cached what the system reported with the change
+    for (const auto& event : seen) {
+        error_code ec;
+        const auto status =
+            stdext::filesystem::symlink_status(event.entry, stdext::filesystem::refresh_policy::never, ec);
+        if (event.kind == change_kind::removed || event.kind == change_kind::renamed_from) {
+            assert(ec == errc::operation_would_block);
+        } else if (!ec && event.entry.path().filename() == L"purr.txt") {
+            assert(status.type() == file_type::regular);
+        }
+    }
+
+    // nothing more happened, so the next wait times out
+    vector<stdext::filesystem::change_event> events;
+    while (watcher.wait(events, 0ms) == watch_status::changes) {
+    }
+
+    assert(watcher.wait(events, 50ms) == watch_status::timeout);
+    assert(events.empty());
+}
+
+void test_filter() {
+    // a watcher for directory names alone doesn't report files
+    directory_watcher watcher{base, stdext::filesystem::watch_filter::dir_name, false};
+    vector<stdext::filesystem::change_event> seen;
+    create_file(base / L"ignored.txt", 1);
+    create_directory(base / L"noticed");
+    wait_for(watcher, seen, change_kind::added, base / L"noticed");
+    assert(!contains(seen, change_kind::added, base / L"ignored.txt"));
+}
+
+void test_cancel() {
+    directory_watcher watcher{base};
+    vector<stdext::filesystem::change_event> events;
+
+    // a cancel before the wait ends the next one
+    watcher.cancel();
+    assert(watcher.wait(events, 10s) == watch_status::canceled);
+
+    thread canceler([&] {
+        this_thread::sleep_for(50ms);
+        watcher.cancel();
+    });
+
+    assert(watcher.wait(events) == watch_status::canceled);
+    canceler.join();
+
+    directory_watcher moved = move(watcher);
+    assert(moved.is_open() && !watcher.is_open());
+    moved.close();
+    assert(!moved.is_open());
+
+    error_code ec;
+    assert(moved.wait(events, 0ms, ec) == watch_status::canceled);
+    assert(ec == errc::bad_file_descriptor);
+}
+
+void test_errors() {
+    error_code ec;
+    directory_watcher watcher{base / L"missing", directory_watcher::default_filter, true, ec};
+    assert(ec && !watcher.is_open());
+
+    try {
+        directory_watcher throwing{base / L"missing"};
+        assert(false);
+    } catch (const filesystem_error& e) {
+        assert(e.path1() == base / L"missing");
+    }
+}
+
+int main() {
+    remove_all(base);
+    create_directory(base);
+
+    test_changes();
+    test_filter();
+    test_cancel();
+    test_errors();
+
+    remove_all(base);
+}
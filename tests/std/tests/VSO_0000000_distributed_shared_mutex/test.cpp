@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+stdext::distributed_shared_mutex global_mutex; // constant initialized, so usable during dynamic initialization
+
+void test_readers_and_writers() {
+    // writers keep the two halves equal; readers must never see them differ
+    stdext::distributed_shared_mutex m;
+    size_t first  = 0;
+    size_t second = 0;
+    atomic<bool> done{false};
+    vector<thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&] {
+            size_t last = 0;
+            while (!done.load()) {
+                shared_lock<stdext::distributed_shared_mutex> lck(m);
+                assert(first == second);
+                assert(first >= last);
+                last = first;
+            }
+        });
+    }
+
+    vector<thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 5'000; ++i) {
+                lock_guard<stdext::distributed_shared_mutex> lck(m);
+                ++first;
+                ++second;
+            }
+        });
+    }
+
+    for (auto& th : writers) {
+        th.join();
+    }
+
+    done.store(true);
+    for (auto& th : readers) {
+        th.join();
+    }
+
+    assert(first == 10'000 && second == 10'000);
+}
+
+void test_concurrent_readers() {
+    // all readers must be able to hold the lock at the same time
+    constexpr int count = 16;
+    stdext::distributed_shared_mutex m;
+    atomic<int> inside{0};
+    vector<thread> readers;
+    for (int t = 0; t < count; ++t) {
+        readers.emplace_back([&] {
+            shared_lock<stdext::distributed_shared_mutex> lck(m);
+            ++inside;
+            while (inside.load() != count) {
+                this_thread::yield();
+            }
+        });
+    }
+
+    for (auto& th : readers) {
+        th.join();
+    }
+}
+
+void test_try_lock() {
+    stdext::distributed_shared_mutex m;
+    assert(m.try_lock());
+    thread([&] {
+        assert(!m.try_lock());
+        assert(!m.try_lock_shared());
+    }).join();
+    m.unlock();
+
+    assert(m.try_lock_shared());
+    assert(m.try_lock_shared()); // shared ownership may be taken more than once
+    thread([&] {
+        assert(!m.try_lock());
+        assert(m.try_lock_shared());
+        m.unlock_shared();
+    }).join();
+    m.unlock_shared();
+    m.unlock_shared();
+
+    unique_lock<stdext::distributed_shared_mutex> lck(m, try_to_lock);
+    assert(lck.owns_lock());
+    lck.unlock();
+
+    lock(m, global_mutex);
+    m.unlock();
+    global_mutex.unlock();
+}
+
+void test_writer_waits_for_reader() {
+    stdext::distributed_shared_mutex m;
+    atomic<bool> written{false};
+    m.lock_shared();
+    thread writer([&] {
+        lock_guard<stdext::distributed_shared_mutex> lck(m);
+        written.store(true);
+    });
+
+    this_thread::sleep_for(milliseconds(50));
+    assert(!written.load());
+    m.unlock_shared();
+    writer.join();
+    assert(written.load());
+}
+
+void test_condition_variable_any() {
+    stdext::distributed_shared_mutex m;
+    condition_variable_any cv;
+    int stage = 0;
+    thread waiter([&] {
+        shared_lock<stdext::distributed_shared_mutex> lck(m);
+        cv.wait(lck, [&] { return stage == 1; });
+        lck.unlock();
+
+        unique_lock<stdext::distributed_shared_mutex> exclusive(m);
+        stage = 2;
+        cv.notify_all();
+    });
+
+    {
+        lock_guard<stdext::distributed_shared_mutex> lck(m);
+        stage = 1;
+    }
+    cv.notify_all();
+
+    {
+        unique_lock<stdext::distributed_shared_mutex> lck(m);
+        assert(cv.wait_for(lck, seconds(60), [&] { return stage == 2; }));
+    }
+
+    waiter.join();
+}
+
+int main() {
+    test_readers_and_writers();
+    test_concurrent_readers();
+    test_try_lock();
+    test_writer_waits_for_reader();
+    test_condition_variable_any();
+}
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::dynamic_bitset;
+
+// a deterministic pattern that isn't periodic in 64 bits
+bool pattern(const size_t seed, const size_t pos) {
+    return ((pos * 2654435761u + seed) >> 7) % 3 == 0;
+}
+
+template <class Pred>
+void check_bits(const dynamic_bitset<>& d, const size_t n, Pred pred) {
+    assert(d.size() == n);
+    size_t ones = 0;
+    for (size_t pos = 0; pos < n; ++pos) {
+        assert(d[pos] == pred(pos));
+        ones += pred(pos);
+    }
+
+    assert(d.count() == ones);
+    assert(d.any() == (ones != 0));
+    assert(d.none() == (ones == 0));
+    assert(d.all() == (ones == n));
+
+    size_t found = d.find_first();
+    for (size_t pos = 0; pos < n; ++pos) {
+        if (pred(pos)) {
+            assert(found == pos);
+            found = d.find_next(found);
+        }
+    }
+
+    assert(found == dynamic_bitset<>::npos);
+}
+
+void test_dynamic_bitset(const size_t n) {
+    dynamic_bitset<> a(n);
+    dynamic_bitset<> b(n);
+    for (size_t pos = 0; pos < n; ++pos) {
+        a[pos] = pattern(1, pos);
+        b.set(pos, pattern(2, pos));
+    }
+
+    check_bits(a, n, [](size_t pos) { return pattern(1, pos); });
+    check_bits(a & b, n, [](size_t pos) { return pattern(1, pos) && pattern(2, pos); });
+    check_bits(a | b, n, [](size_t pos) { return pattern(1, pos) || pattern(2, pos); });
+    check_bits(a ^ b, n, [](size_t pos) { return pattern(1, pos) != pattern(2, pos); });
+    check_bits(a - b, n, [](size_t pos) { return pattern(1, pos) && !pattern(2, pos); });
+    check_bits(~a, n, [](size_t pos) { return !pattern(1, pos); });
+
+    dynamic_bitset<> ones(n, true);
+    check_bits(ones, n, [](size_t) { return true; });
+    check_bits(dynamic_bitset<>(ones).reset(), n, [](size_t) { return false; });
+    check_bits(dynamic_bitset<>(n).set(), n, [](size_t) { return true; });
+    check_bits(dynamic_bitset<>(a).flip(), n, [](size_t pos) { return !pattern(1, pos); });
+
+    // growing with true fills the rest of the old last word too
+    dynamic_bitset<> grown = a;
+    grown.resize(n + 70, true);
+    check_bits(grown, n + 70, [n](size_t pos) { return pos >= n || pattern(1, pos); });
+    grown.resize(n / 2);
+    check_bits(grown, n / 2, [](size_t pos) { return pattern(1, pos); });
+
+    dynamic_bitset<> pushed;
+    for (size_t pos = 0; pos < n; ++pos) {
+        pushed.push_back(pattern(1, pos));
+    }
+
+    assert(pushed == a);
+    assert(pushed.num_blocks() == (n + 63) / 64);
+
+    dynamic_bitset<> moved = move(pushed);
+    assert(moved == a);
+    assert(pushed.empty());
+    assert(pushed.num_blocks() == 0);
+
+    swap(moved, b);
+    assert(b == a);
+
+    try {
+        (void) a.test(n);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+}
+
+void test_vector_bool(const size_t n) {
+    vector<bool> v(n);
+    for (size_t pos = 0; pos < n; ++pos) {
+        v[pos] = pattern(3, pos);
+    }
+
+    for (size_t first = 0; first < n && first < 140; first += 13) {
+        for (size_t last = first; last <= n; last += (last < first + 140 ? 1 : 61)) {
+            const auto b = v.begin() + static_cast<ptrdiff_t>(first);
+            const auto e = v.begin() + static_cast<ptrdiff_t>(last);
+
+            ptrdiff_t expected_ones = 0;
+            for (auto it = b; it != e; ++it) {
+                expected_ones += *it;
+            }
+
+            assert(count(b, e, true) == expected_ones);
+            assert(count(b, e, false) == (e - b) - expected_ones);
+            assert(count(v.cbegin() + (b - v.begin()), v.cbegin() + (e - v.begin()), 1) == expected_ones);
+            assert(count(b, e, 2) == 0);
+
+            for (const bool val : {false, true}) {
+                auto expected = b;
+                while (expected != e && *expected != val) {
+                    ++expected;
+                }
+
+                assert(find(b, e, val) == expected);
+            }
+
+            assert(find(b, e, 2) == e);
+        }
+    }
+}
+
+int main() {
+    for (const size_t n : {0, 1, 2, 31, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000, 4099}) {
+        test_dynamic_bitset(n);
+        test_vector_bool(n);
+    }
+
+    dynamic_bitset<> sparse(10000);
+    sparse.set(0).set(4095).set(9999);
+    assert(sparse.find_first() == 0);
+    assert(sparse.find_next(0) == 4095);
+    assert(sparse.find_next(4095) == 9999);
+    assert(sparse.find_next(9999) == dynamic_bitset<>::npos);
+    assert(sparse.count() == 3);
+}
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <version> // TRANSITION, P0912R5 Library Support For Coroutines
+#if defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L // TRANSITION, P0912R5 Library Support For Coroutines
+
+#include <assert.h>
+#include <experimental/task>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <Windows.h>
+
+using namespace std;
+using experimental::io_result;
+using experimental::sync_wait;
+using experimental::task;
+using experimental::threadpool_io;
+using experimental::threadpool_scheduler;
+
+task<int> constant(const int value) {
+    co_return value;
+}
+
+task<int> add_constants(const int a, const int b) {
+    const int x = co_await constant(a);
+    const int y = co_await constant(b);
+    co_return x + y;
+}
+
+task<long long> count_down(const int n) {
+    // each level completes synchronously; symmetric transfer keeps the stack from growing with n
+    if (n == 0) {
+        co_return 0;
+    }
+
+    co_return 1 + co_await count_down(n - 1);
+}
+
+task<unique_ptr<string>> make_string() {
+    co_return make_unique<string>("meow");
+}
+
+int global_value = 42;
+
+task<int&> global_ref() {
+    co_return global_value;
+}
+
+task<void> set_flag(bool& flag) {
+    flag = true;
+    co_return;
+}
+
+task<int> thrower() {
+    throw runtime_error{"thrower"};
+    co_return 0;
+}
+
+task<bool> catches() {
+    try {
+        (void) co_await thrower();
+    } catch (const runtime_error&) {
+        co_return true;
+    }
+
+    co_return false;
+}
+
+void test_task() {
+    assert(sync_wait(constant(5)) == 5);
+    assert(sync_wait(add_constants(3, 4)) == 7);
+    assert(sync_wait(count_down(100'000)) == 100'000);
+    assert(*sync_wait(make_string()) == "meow");
+    assert(&sync_wait(global_ref()) == &global_value);
+
+    bool flag = false;
+    auto pending = set_flag(flag);
+    assert(!pending.is_ready());
+    assert(!flag);
+    sync_wait(move(pending));
+    assert(flag);
+
+    assert(sync_wait(catches()));
+    bool caught = false;
+    try {
+        (void) sync_wait(thrower());
+    } catch (const runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    // a task that is never awaited never runs
+    bool never = false;
+    { auto unused = set_flag(never); }
+    assert(!never);
+}
+
+task<thread::id> resume_on_threadpool(threadpool_scheduler scheduler) {
+    co_await scheduler.schedule();
+    co_return this_thread::get_id();
+}
+
+task<int> fan_out(threadpool_scheduler scheduler) {
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        co_await scheduler.schedule();
+        sum += co_await constant(i);
+    }
+
+    co_return sum;
+}
+
+void test_scheduler() {
+    const threadpool_scheduler scheduler;
+    assert(sync_wait(resume_on_threadpool(scheduler)) != this_thread::get_id());
+    assert(sync_wait(fan_out(scheduler)) == 4950);
+}
+
+task<bool> copy_through_file(threadpool_io& io) {
+    const char message[] = "hello, completion port";
+    const io_result written = co_await io.write(message, sizeof(message), 16);
+    if (written.error || written.bytes_transferred != sizeof(message)) {
+        co_return false;
+    }
+
+    char buffer[sizeof(message)]{};
+    const io_result read = co_await io.read(buffer, sizeof(buffer), 16);
+    if (read.error || read.bytes_transferred != sizeof(message)) {
+        co_return false;
+    }
+
+    co_return string{buffer} == message;
+}
+
+task<io_result> read_past_end(threadpool_io& io) {
+    char buffer[16];
+    co_return co_await io.read(buffer, sizeof(buffer), 1'000'000);
+}
+
+void test_io() {
+    const HANDLE file = CreateFileW(L"test_experimental_task.tmp", GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE | FILE_FLAG_OVERLAPPED, nullptr);
+    assert(file != INVALID_HANDLE_VALUE);
+    {
+        threadpool_io io{file};
+        assert(sync_wait(copy_through_file(io)));
+        const io_result eof = sync_wait(read_past_end(io));
+        assert(eof.bytes_transferred == 0);
+        assert(eof.error.value() == ERROR_HANDLE_EOF);
+    }
+    CloseHandle(file);
+}
+
+int main() {
+    test_task();
+    test_scheduler();
+    test_io();
+}
+
+#else // ^^^ test <experimental/task> ^^^ / vvv don't test <experimental/task> vvv
+int main() {}
+#endif // TRANSITION, P0912R5 Library Support For Coroutines
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <chrono>
+#include <ratio>
+#include <thread>
+#include <type_traits>
+
+using namespace std;
+using namespace std::chrono;
+
+static_assert(stdext::chrono::coarse_steady_clock::is_steady);
+static_assert(is_same_v<stdext::chrono::coarse_steady_clock::duration, milliseconds>);
+static_assert(stdext::chrono::tsc_clock::is_steady);
+static_assert(is_same_v<stdext::chrono::tsc_clock::duration, nanoseconds>);
+static_assert(is_same_v<stdext::chrono::tsc_clock::period, nano>);
+
+template <class Clock>
+void test_monotonic() {
+    auto prev = Clock::now();
+    for (int i = 0; i < 100'000; ++i) {
+        const auto next = Clock::now();
+        assert(next >= prev);
+        prev = next;
+    }
+}
+
+void test_steady_clock_scale() {
+    // the fast paths for 10 MHz and 24 MHz must agree with the general conversion
+    const auto before = steady_clock::now();
+    this_thread::sleep_for(50ms);
+    const auto after = steady_clock::now();
+    assert(after - before >= 40ms);
+    assert(after - before < 10s);
+}
+
+void test_tsc_clock_tracks_steady_clock() {
+    // tsc_clock shares the epoch and rate of steady_clock
+    for (int i = 0; i < 5; ++i) {
+        const auto steady_before = steady_clock::now().time_since_epoch();
+        const auto tsc           = stdext::chrono::tsc_clock::now().time_since_epoch();
+        const auto steady_after  = steady_clock::now().time_since_epoch();
+        assert(tsc >= steady_before - 50ms);
+        assert(tsc <= steady_after + 50ms);
+        this_thread::sleep_for(20ms);
+    }
+
+    const auto steady_start = steady_clock::now();
+    const auto tsc_start    = stdext::chrono::tsc_clock::now();
+    this_thread::sleep_for(200ms);
+    const auto tsc_elapsed    = stdext::chrono::tsc_clock::now() - tsc_start;
+    const auto steady_elapsed = steady_clock::now() - steady_start;
+    assert(tsc_elapsed - steady_elapsed < 10ms);
+    assert(steady_elapsed - tsc_elapsed < 10ms);
+}
+
+void test_coarse_steady_clock_advances() {
+    const auto start = stdext::chrono::coarse_steady_clock::now();
+    this_thread::sleep_for(100ms);
+    const auto elapsed = stdext::chrono::coarse_steady_clock::now() - start;
+    assert(elapsed >= 60ms);
+    assert(elapsed < 10s);
+}
+
+int main() {
+    test_monotonic<steady_clock>();
+    test_monotonic<stdext::chrono::coarse_steady_clock>();
+    test_monotonic<stdext::chrono::tsc_clock>();
+    test_steady_clock_scale();
+    test_tsc_clock_tracks_steady_clock();
+    test_coarse_steady_clock_advances();
+}
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if _HAS_CXX17
+#include <string_view>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+void test_alignment_independence() {
+    // the result depends only on the bytes, not on where they are stored
+    vector<unsigned char> buffer(2'000 + 16);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<unsigned char>(i * 131 + 7);
+    }
+
+    for (size_t length = 0; length < 1'100; length += (length < 80 ? 1 : 37)) {
+        const size_t expected = stdext::fast_hash::hash_bytes(buffer.data() + 8, length);
+        for (size_t offset = 0; offset < 16; ++offset) {
+            vector<unsigned char> copy(buffer.begin() + 8, buffer.begin() + 8 + static_cast<ptrdiff_t>(length));
+            copy.insert(copy.begin(), offset, 0);
+            assert(stdext::fast_hash::hash_bytes(copy.data() + offset, length) == expected);
+        }
+    }
+}
+
+void test_single_bit_changes() {
+    // every single-bit change to an input produces a distinct hash, for lengths taking each code path
+    for (const size_t length : {1u, 3u, 4u, 7u, 8u, 15u, 16u, 17u, 31u, 32u, 33u, 64u, 100u, 255u, 256u, 257u, 700u}) {
+        const string base(length, 'q');
+        unordered_set<size_t> hashes{stdext::fast_hash{}(base)};
+        for (size_t bit = 0; bit < length * 8; ++bit) {
+            string changed = base;
+            changed[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+            assert(hashes.insert(stdext::fast_hash{}(changed)).second);
+        }
+    }
+}
+
+void test_lengths_distinguished() {
+    // inputs that differ only in length hash differently, including all-zero inputs
+    unordered_set<size_t> hashes;
+    for (size_t length = 0; length < 600; ++length) {
+        assert(hashes.insert(stdext::fast_hash{}(string(length, '\0'))).second);
+    }
+}
+
+void test_string_types() {
+    const string narrow = "a key that is a little longer than thirty-two bytes";
+    assert(stdext::fast_hash{}(narrow) == stdext::fast_hash::hash_bytes(narrow.data(), narrow.size()));
+
+    const wstring wide = L"wide";
+    assert(stdext::fast_hash{}(wide) == stdext::fast_hash::hash_bytes(wide.data(), wide.size() * sizeof(wchar_t)));
+
+#if _HAS_CXX17
+    assert(stdext::fast_hash{}(string_view{narrow}) == stdext::fast_hash{}(narrow));
+    assert(stdext::fast_hash{}(wstring_view{wide}) == stdext::fast_hash{}(wide));
+#endif // _HAS_CXX17
+}
+
+void test_unordered_map() {
+    unordered_map<string, int, stdext::fast_hash> m;
+    for (int i = 0; i < 10'000; ++i) {
+        m.emplace(string(static_cast<size_t>(i % 300), 'x') + to_string(i), i);
+    }
+
+    assert(m.size() == 10'000);
+    for (int i = 0; i < 10'000; i += 7) {
+        assert(m.at(string(static_cast<size_t>(i % 300), 'x') + to_string(i)) == i);
+    }
+
+#if _HAS_CXX20
+    unordered_map<string, int, stdext::fast_hash, equal_to<>> transparent{{"key", 1}};
+    assert(transparent.find(string_view{"key"}) != transparent.end());
+    assert(transparent.contains(string_view{"key"}));
+#endif // _HAS_CXX20
+}
+
+int main() {
+    test_alignment_independence();
+    test_single_bit_changes();
+    test_lengths_distinguished();
+    test_string_types();
+    test_unordered_map();
+}
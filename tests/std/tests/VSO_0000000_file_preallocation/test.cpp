@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_file_preallocation";
+
+string contents_of(const path& p) {
+    ifstream in{p, ios::binary};
+    return string{istreambuf_iterator<char>{in}, istreambuf_iterator<char>{}};
+}
+
+void test_preallocate() {
+    const path journal = base / L"journal";
+    ofstream out{journal, ios::binary};
+    assert(out);
+
+    // the reservation is made through another handle while the stream keeps the file open
+    error_code ec;
+    stdext::filesystem::preallocate(journal, 1 << 20, ec);
+    assert(!ec);
+    assert(file_size(journal) == 0);
+
+    const string record(4096, 'r');
+    for (int i = 0; i < 64; ++i) {
+        out << record;
+    }
+
+    out.close();
+    assert(file_size(journal) == 64 * record.size());
+    assert(contents_of(journal) == string(64 * record.size(), 'r'));
+
+    stdext::filesystem::preallocate(base / L"missing", 1 << 20, ec);
+    assert(ec == errc::no_such_file_or_directory);
+
+    bool threw = false;
+    try {
+        stdext::filesystem::preallocate(base / L"missing", 1 << 20);
+    } catch (const filesystem_error& err) {
+        threw = true;
+        assert(err.path1() == base / L"missing");
+    }
+    assert(threw);
+}
+
+void test_sparse() {
+    const path sparse = base / L"sparse";
+    {
+        ofstream out{sparse, ios::binary | ios_base::_Sparse};
+        assert(out);
+        out << "start";
+        out.seekp(1 << 20);
+        out << "end";
+    }
+
+    assert(file_size(sparse) == (1 << 20) + 3);
+    const auto text = contents_of(sparse);
+    assert(text.substr(0, 5) == "start");
+    assert(text.substr(5, 100) == string(100, '\0'));
+    assert(text.substr(1 << 20) == "end");
+
+    error_code ec;
+    stdext::filesystem::set_sparse(sparse, false, ec);
+    assert(!ec);
+    stdext::filesystem::set_sparse(sparse);
+    assert(contents_of(sparse) == text);
+
+    // the hint is ignored for input, and does not disturb the other modes
+    {
+        ifstream in{sparse, ios::binary | ios_base::_Sparse};
+        assert(in);
+        string word;
+        in >> word;
+        assert(word == "start");
+    }
+
+    {
+        fstream io{sparse, ios::in | ios::out | ios::app | ios_base::_Sparse};
+        assert(io);
+        io << "more";
+    }
+
+    assert(contents_of(sparse) == text + "more");
+}
+
+void test_valid_data_length() {
+    const path file = base / L"valid_data";
+    {
+        ofstream out{file, ios::binary};
+        assert(out);
+    }
+
+    resize_file(file, 1 << 16);
+    error_code ec;
+    stdext::filesystem::set_valid_data_length(file, 1 << 16, ec);
+    // without SE_MANAGE_VOLUME_NAME this fails with ERROR_PRIVILEGE_NOT_HELD
+    assert(!ec || (ec.category() == system_category() && ec.value() == 1314));
+    assert(file_size(file) == 1 << 16);
+}
+
+int main() {
+    remove_all(base);
+    create_directory(base);
+    test_preallocate();
+    test_sparse();
+    test_valid_data_length();
+    remove_all(base);
+}
@@ -0,0 +1,345 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// deliberately poor hash functions, so that groups fill up and probe sequences get long
+struct identity_hash {
+    size_t operator()(const int val) const noexcept {
+        return static_cast<size_t>(val);
+    }
+};
+
+struct clustered_hash {
+    size_t operator()(const int val) const noexcept {
+        return static_cast<size_t>(val & 3);
+    }
+};
+
+int hash_calls_before_throw = -1;
+
+struct throwing_hash {
+    size_t operator()(const int val) const {
+        if (hash_calls_before_throw >= 0 && hash_calls_before_throw-- == 0) {
+            throw runtime_error("hash");
+        }
+
+        return hash<int>{}(val);
+    }
+};
+
+template <class T>
+struct tracking_allocator {
+    using value_type = T;
+
+    explicit tracking_allocator(int id_) noexcept : id(id_) {}
+
+    template <class U>
+    tracking_allocator(const tracking_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const tracking_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const tracking_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+
+    int id;
+};
+
+template <class Map, class Reference>
+bool same_contents(const Map& m, const Reference& ref) {
+    if (m.size() != ref.size() || static_cast<size_t>(distance(m.begin(), m.end())) != ref.size()) {
+        return false;
+    }
+
+    for (const auto& [key, val] : ref) {
+        const auto where = m.find(key);
+        if (where == m.end() || where->second != val) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void test_map_basics() {
+    stdext::flat_hash_map<string, int> m;
+    assert(m.empty());
+    assert(m.bucket_count() == 0);
+    assert(m.begin() == m.end());
+    assert(m.find("missing") == m.end());
+    assert(m.erase("missing") == 0);
+
+    assert(m.emplace("one", 1).second);
+    assert(!m.emplace("one", 100).second);
+    assert(m.insert({"two", 2}).second);
+    assert(m.try_emplace("three", 3).second);
+    assert(!m.try_emplace("three", 300).second);
+    assert(m["three"] == 3);
+    m["four"] = 4;
+    assert(!m.insert_or_assign("four", 44).second);
+    assert(m.insert_or_assign("five", 5).second);
+    assert(m.size() == 5);
+    assert(m.at("four") == 44);
+    assert(m.count("five") == 1);
+    assert(m.contains("two"));
+    assert(!m.contains("six"));
+
+    bool threw = false;
+    try {
+        (void) m.at("six");
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    const auto range = m.equal_range("two");
+    assert(range.first != m.end() && range.first->second == 2);
+    assert(distance(range.first, range.second) == 1);
+
+    assert(m.erase("two") == 1);
+    assert(!m.contains("two"));
+    const auto next = m.erase(m.find("one"));
+    assert(m.size() == 3);
+    assert(distance(next, m.end()) <= 3);
+
+    // the table's capacity is a power of 2 minus 1
+    const auto buckets = m.bucket_count();
+    assert(buckets != 0 && ((buckets + 1) & buckets) == 0);
+    assert(m.load_factor() <= m.max_load_factor());
+
+    m.clear();
+    assert(m.empty() && m.begin() == m.end());
+    assert(m.bucket_count() == buckets);
+    m.rehash(0);
+    assert(m.bucket_count() == 0);
+}
+
+template <class Hasher>
+void test_against_unordered_map(const unsigned int seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> keys(0, 2000);
+    stdext::flat_hash_map<int, int, Hasher> m;
+    unordered_map<int, int> ref;
+    for (int step = 0; step < 20'000; ++step) {
+        const int key = keys(gen);
+        switch (gen() % 4) {
+        case 0:
+        case 1:
+            assert(m.emplace(key, step).second == ref.emplace(key, step).second);
+            break;
+        case 2:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        default:
+            assert(m.contains(key) == (ref.count(key) != 0));
+            break;
+        }
+
+        if (step % 5'000 == 0) {
+            assert(same_contents(m, ref));
+        }
+    }
+
+    assert(same_contents(m, ref));
+
+    // erase while iterating
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 3 == 0) {
+            ref.erase(it->first);
+            it = m.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    assert(same_contents(m, ref));
+
+    m.rehash(0);
+    assert(same_contents(m, ref));
+    m.reserve(m.size() * 2);
+    assert(same_contents(m, ref));
+}
+
+void test_reserve() {
+    for (size_t n = 0; n < 200; ++n) {
+        stdext::flat_hash_set<size_t> s;
+        s.reserve(n);
+        const auto buckets = s.bucket_count();
+        for (size_t i = 0; i < n; ++i) {
+            s.insert(i);
+        }
+
+        assert(s.size() == n);
+        assert(s.bucket_count() == buckets);
+    }
+}
+
+void test_set() {
+    stdext::flat_hash_set<string> s{"cat", "dog", "cat", "bird"};
+    assert(s.size() == 3);
+    assert(s.count("cat") == 1);
+    assert(!s.insert("dog").second);
+    assert(s.emplace(3, 'x').second);
+    assert(s.contains("xxx"));
+
+    const string fish = "fish";
+    assert(s.insert(fish).second);
+    assert(s.erase("cat") == 1);
+
+    stdext::flat_hash_set<string> other{"dog", "bird", "xxx", "fish"};
+    assert(s == other);
+    other.insert("cat");
+    assert(s != other);
+}
+
+void test_copy_move_swap() {
+    stdext::flat_hash_map<int, string> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, to_string(i));
+    }
+
+    for (int i = 0; i < 100; i += 2) {
+        m.erase(i);
+    }
+
+    auto copy = m;
+    assert(copy == m);
+    assert(copy.bucket_count() == m.bucket_count());
+
+    auto moved = move(copy);
+    assert(moved == m);
+    assert(copy.empty()); // implementation assumption; the source is left empty
+
+    stdext::flat_hash_map<int, string> small{{1, "one"}};
+    small.swap(moved);
+    assert(small == m);
+    assert(moved.size() == 1 && moved.at(1) == "one");
+
+    moved = small;
+    assert(moved == m);
+    small = {{2, "two"}};
+    assert(small.size() == 1 && small[2] == "two");
+    moved = move(small);
+    assert(moved.size() == 1 && moved[2] == "two");
+}
+
+void test_move_only() {
+    stdext::flat_hash_map<int, unique_ptr<int>> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, make_unique<int>(i));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        assert(*m.at(i) == i);
+    }
+
+    auto moved = move(m);
+    assert(moved.size() == 100);
+}
+
+void test_self_referencing_insert() {
+    // the new element is constructed before the old elements are moved, so its arguments may refer to them
+    stdext::flat_hash_map<int, string> m;
+    m.try_emplace(0, string(100, 'a'));
+    for (int i = 1; i < 200; ++i) {
+        m.try_emplace(i, m.at(i - 1));
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        assert(m.at(i) == string(100, 'a'));
+    }
+}
+
+void test_throwing_hash() {
+    // hashing happens before anything is moved, so a throwing hash function leaves the table intact
+    stdext::flat_hash_set<int, throwing_hash> s;
+    bool threw = false;
+    for (int i = 0; i < 1000 && !threw; ++i) {
+        const auto before  = s;
+        const auto buckets = s.bucket_count();
+        hash_calls_before_throw = 2; // the insertion's own hash succeeds, rehashing the old elements throws
+        try {
+            s.insert(i);
+        } catch (const runtime_error&) {
+            threw = true;
+            assert(s == before);
+            assert(s.bucket_count() == buckets);
+        }
+        hash_calls_before_throw = -1;
+    }
+
+    assert(threw);
+}
+
+void test_unequal_allocators() {
+    using alloc_t = tracking_allocator<pair<const int, string>>;
+    stdext::flat_hash_map<int, string, hash<int>, equal_to<int>, alloc_t> m(alloc_t{1});
+    for (int i = 0; i < 50; ++i) {
+        m.try_emplace(i, to_string(i));
+    }
+
+    decltype(m) other(move(m), alloc_t{2});
+    assert(other.get_allocator().id == 2);
+    assert(other.size() == 50);
+    assert(m.empty());
+    for (int i = 0; i < 50; ++i) {
+        assert(other.at(i) == to_string(i));
+    }
+
+    decltype(m) third(alloc_t{3});
+    third = move(other);
+    assert(third.get_allocator().id == 3);
+    assert(third.size() == 50 && third.at(42) == "42");
+}
+
+void test_pmr() {
+    pmr::monotonic_buffer_resource mr;
+    stdext::pmr::flat_hash_map<int, pmr::string> m(&mr);
+    m.try_emplace(1, "a string long enough to need an allocation from the resource");
+    assert(m.get_allocator().resource() == &mr);
+    assert(m.at(1).get_allocator().resource() == &mr);
+
+    stdext::pmr::flat_hash_set<int> s(&mr);
+    s.insert(1);
+    assert(s.contains(1));
+}
+
+int main() {
+    test_map_basics();
+    test_against_unordered_map<hash<int>>(1729);
+    test_against_unordered_map<identity_hash>(1234);
+    test_against_unordered_map<clustered_hash>(42);
+    test_reserve();
+    test_set();
+    test_copy_move_swap();
+    test_move_only();
+    test_self_referencing_insert();
+    test_throwing_hash();
+    test_unequal_allocators();
+    test_pmr();
+}
@@ -0,0 +1,347 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+int compares_before_throw = -1;
+
+struct throwing_less {
+    bool operator()(const int left, const int right) const {
+        if (compares_before_throw >= 0 && compares_before_throw-- == 0) {
+            throw runtime_error("compare");
+        }
+
+        return left < right;
+    }
+};
+
+struct move_only {
+    explicit move_only(int val_) : val(val_) {}
+    move_only(move_only&&)            = default;
+    move_only& operator=(move_only&&) = default;
+
+    int val;
+};
+
+template <class Flat, class Reference>
+bool same_keys(const Flat& c, const Reference& ref) {
+    return c.size() == ref.size() && equal(c.begin(), c.end(), ref.begin(), ref.end());
+}
+
+template <class Flat, class Reference>
+bool same_elements(const Flat& c, const Reference& ref) {
+    if (c.size() != ref.size() || c.keys().size() != c.values().size()) {
+        return false;
+    }
+
+    auto it = c.begin();
+    for (const auto& [key, val] : ref) {
+        if ((*it).first != key || it->second != val) {
+            return false;
+        }
+
+        ++it;
+    }
+
+    return it == c.end();
+}
+
+void test_set_basics() {
+    stdext::flat_set<int> s{5, 3, 9, 3, 1};
+    assert(s.size() == 4);
+    assert(same_keys(s, vector<int>{1, 3, 5, 9}));
+
+    assert(s.insert(4).second);
+    assert(!s.insert(4).second);
+    assert(*s.emplace(7).first == 7);
+    assert(*s.insert(s.end(), 10) == 10); // correct hint
+    assert(*s.insert(s.begin(), 8) == 8); // wrong hint
+    assert(*s.emplace_hint(s.begin(), 3) == 3); // equivalent element
+    assert(same_keys(s, vector<int>{1, 3, 4, 5, 7, 8, 9, 10}));
+
+    assert(s.contains(5) && !s.contains(6));
+    assert(s.count(7) == 1 && s.count(6) == 0);
+    assert(*s.find(8) == 8 && s.find(2) == s.end());
+    assert(*s.lower_bound(6) == 7 && *s.upper_bound(7) == 8 && s.lower_bound(11) == s.end());
+    const auto range = s.equal_range(4);
+    assert(range.first == s.find(4) && range.second == s.find(5));
+
+    assert(s.erase(4) == 1 && s.erase(4) == 0);
+    assert(*s.erase(s.find(5)) == 7);
+    s.erase(s.begin(), s.begin() + 2);
+    assert(same_keys(s, vector<int>{7, 8, 9, 10}));
+    assert(*s.rbegin() == 10);
+
+    s = {2, 1, 2};
+    assert(same_keys(s, vector<int>{1, 2}));
+    s.clear();
+    assert(s.empty() && s.begin() == s.end());
+}
+
+void test_multiset_basics() {
+    stdext::flat_multiset<int> s{5, 3, 9, 3, 1};
+    assert(same_keys(s, vector<int>{1, 3, 3, 5, 9}));
+    s.insert(3);
+    s.emplace_hint(s.begin(), 9); // wrong hint
+    assert(s.count(3) == 3 && s.count(9) == 2);
+    const auto range = s.equal_range(3);
+    assert(range.first - s.begin() == 1 && range.second - s.begin() == 4);
+    assert(s.erase(3) == 3);
+    assert(same_keys(s, vector<int>{1, 5, 9, 9}));
+}
+
+template <class Flat, class Reference>
+void test_set_against(const unsigned int seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> keys(0, 500);
+    Flat s;
+    Reference ref;
+    for (int step = 0; step < 3'000; ++step) {
+        const int key = keys(gen);
+        switch (gen() % 5) {
+        case 0:
+            s.insert(key);
+            ref.insert(key);
+            break;
+        case 1:
+            assert(s.erase(key) == ref.erase(key));
+            break;
+        case 2:
+            { // a batch of random keys, one of sorted keys, and one of sorted runs
+                vector<int> batch;
+                for (int i = 0; i < 20; ++i) {
+                    batch.push_back(keys(gen));
+                }
+
+                if (step % 3 == 1) {
+                    sort(batch.begin(), batch.end());
+                } else if (step % 3 == 2) {
+                    sort(batch.begin(), batch.begin() + 10);
+                    sort(batch.begin() + 10, batch.end());
+                }
+
+                s.insert(batch.begin(), batch.end());
+                ref.insert(batch.begin(), batch.end());
+                break;
+            }
+        default:
+            assert(s.count(key) == ref.count(key));
+            assert(static_cast<size_t>(s.lower_bound(key) - s.begin())
+                   == static_cast<size_t>(distance(ref.begin(), ref.lower_bound(key))));
+            break;
+        }
+
+        assert(same_keys(s, ref));
+    }
+}
+
+void test_map_basics() {
+    stdext::flat_map<string, int> m;
+    assert(m.empty() && m.find("missing") == m.end());
+
+    assert(m.emplace("one", 1).second);
+    assert(!m.emplace("one", 100).second);
+    assert(m.insert({"two", 2}).second);
+    assert(m.try_emplace("three", 3).second);
+    assert(!m.try_emplace("three", 300).second);
+    assert(m["three"] == 3);
+    m["four"] = 4;
+    assert(!m.insert_or_assign("four", 44).second);
+    assert(m.insert_or_assign("five", 5).second);
+    assert(m.size() == 5);
+    assert(m.at("four") == 44);
+    assert(m.count("five") == 1 && m.contains("two") && !m.contains("six"));
+
+    bool threw = false;
+    try {
+        (void) m.at("six");
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    assert(same_elements(m, map<string, int>{{"five", 5}, {"four", 44}, {"one", 1}, {"three", 3}, {"two", 2}}));
+    assert((m.keys() == vector<string>{"five", "four", "one", "three", "two"}));
+    assert((m.values() == vector<int>{5, 44, 1, 3, 2}));
+
+    // iterators are random-access over both containers, and let the mapped values be modified
+    auto it = m.begin() + 2;
+    assert(it->first == "one" && (it - m.begin()) == 2 && m.begin() < it);
+    it->second = 11;
+    (*(it + 1)).second = 33;
+    assert(m.begin()[2].second == 11 && m.at("three") == 33);
+    decltype(m)::const_iterator cit = it;
+    assert(cit == it && cit->second == 11);
+
+    assert(m.erase("one") == 1 && m.erase("one") == 0);
+    const auto next = m.erase(m.find("four"));
+    assert(next->first == "three");
+    assert(m.size() == 3 && m.keys().size() == 3 && m.values().size() == 3);
+
+    const auto& cm = m;
+    assert(cm.find("two")->second == 2 && cm.lower_bound("t")->first == "three");
+    assert(cm.upper_bound("three")->first == "two");
+}
+
+void test_multimap_order() {
+    // equivalent keys stay in insertion order, including through bulk insertion
+    stdext::flat_multimap<int, int> m;
+    vector<pair<int, int>> ref;
+    for (int i = 0; i < 200; ++i) {
+        const int key = (i * 37) % 10;
+        if (i % 2 == 0) {
+            m.emplace(key, i);
+        } else {
+            vector<pair<int, int>> batch = {{key, i}, {(key + 3) % 10, i}};
+            m.insert(batch.begin(), batch.end());
+            ref.emplace_back((key + 3) % 10, i);
+        }
+
+        ref.emplace(ref.end() - (i % 2), key, i);
+    }
+
+    stable_sort(ref.begin(), ref.end(), [](const auto& left, const auto& right) { return left.first < right.first; });
+    assert(m.size() == ref.size());
+    assert(equal(m.begin(), m.end(), ref.begin(), ref.end(),
+        [](const auto& left, const auto& right) { return left.first == right.first && left.second == right.second; }));
+    const auto threes = count_if(ref.begin(), ref.end(), [](const auto& val) { return val.first == 3; });
+    assert(m.count(3) == static_cast<size_t>(threes));
+}
+
+void test_sorted_construction() {
+    vector<int> keys{1, 2, 4, 8};
+    vector<string> vals{"a", "b", "d", "h"};
+    stdext::flat_map<int, string> m(stdext::sorted_unique, keys, vals);
+    assert(m.at(4) == "d");
+
+    stdext::flat_map<int, string> unsorted(vector<int>{3, 1, 3, 2}, vector<string>{"c", "a", "cc", "b"});
+    assert(same_elements(unsorted, map<int, string>{{1, "a"}, {2, "b"}, {3, "c"}}));
+
+    stdext::flat_multiset<int> ms(stdext::sorted_equivalent, {1, 1, 2, 3, 3});
+    assert(ms.count(1) == 2 && ms.count(3) == 2);
+
+    auto conts = move(m).extract();
+    assert(m.empty());
+    assert(conts.keys == keys && conts.values == vals);
+    conts.keys.push_back(16);
+    conts.values.push_back("p");
+    m.replace(move(conts.keys), move(conts.values));
+    assert(m.size() == 5 && m.at(16) == "p");
+
+    stdext::flat_set<int> s(stdext::sorted_unique, keys.begin(), keys.end());
+    auto keys_back = move(s).extract();
+    assert(keys_back == keys && s.empty());
+    s.replace(move(keys_back));
+    assert(same_keys(s, keys));
+}
+
+void test_transparent() {
+    stdext::flat_set<string, less<>> s{"cat", "dog", "bird"};
+    const string_view dog = "dog";
+    assert(s.find(dog) != s.end() && s.contains(dog) && s.count(dog) == 1);
+    assert(*s.lower_bound(string_view{"c"}) == "cat");
+
+    stdext::flat_map<string, int, less<>> m{{"cat", 1}, {"dog", 2}};
+    assert(m.find(dog)->second == 2);
+    assert(m.equal_range(string_view{"cow"}).first == m.find(dog));
+}
+
+void test_other_containers() {
+    stdext::flat_set<int, greater<int>, deque<int>> s{1, 5, 3};
+    assert(same_keys(s, vector<int>{5, 3, 1}));
+    s.insert(4);
+    assert(*(s.begin() + 1) == 4);
+
+    stdext::flat_map<int, move_only> m;
+    m.try_emplace(2, 20);
+    m.try_emplace(1, 10);
+    m.emplace(3, move_only{30});
+    assert(m.at(1).val == 10 && m.at(2).val == 20 && m.at(3).val == 30);
+    auto moved = move(m);
+    assert(moved.size() == 3 && moved.begin()->second.val == 10);
+}
+
+void test_throwing_compare() {
+    // a comparator that throws while a bulk insertion is merged leaves the container empty, not unsorted
+    stdext::flat_set<int, throwing_less> s;
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i * 2);
+    }
+
+    vector<int> batch{7, 3, 5, 1};
+    compares_before_throw = 5;
+    bool threw            = false;
+    try {
+        s.insert(batch.begin(), batch.end());
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+    compares_before_throw = -1;
+
+    assert(threw);
+    assert(s.empty());
+    s.insert(batch.begin(), batch.end());
+    assert(same_keys(s, vector<int>{1, 3, 5, 7}));
+
+    stdext::flat_map<int, int, throwing_less> m{{1, 1}, {3, 3}};
+    compares_before_throw = 0;
+    threw                 = false;
+    try {
+        m.emplace(2, 2);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+    compares_before_throw = -1;
+
+    assert(threw);
+    assert(m.size() == 2 && m.keys().size() == m.values().size());
+}
+
+void test_comparisons_and_swap() {
+    stdext::flat_map<int, int> a{{1, 1}, {2, 2}};
+    stdext::flat_map<int, int> b{{1, 1}, {2, 3}};
+    assert(a != b && a < b && b > a && a <= b && !(a >= b));
+    b[2] = 2;
+    assert(a == b);
+
+    stdext::flat_set<int> x{1, 2, 3};
+    stdext::flat_set<int> y{4};
+    swap(x, y);
+    assert(same_keys(x, vector<int>{4}) && same_keys(y, vector<int>{1, 2, 3}));
+    assert(y < x);
+
+    stdext::flat_multimap<int, int> mm{{1, 1}, {1, 2}};
+    auto copy = mm;
+    assert(copy == mm);
+    copy.swap(mm);
+    assert(copy == mm);
+}
+
+int main() {
+    test_set_basics();
+    test_multiset_basics();
+    test_set_against<stdext::flat_set<int>, set<int>>(1729);
+    test_set_against<stdext::flat_multiset<int>, multiset<int>>(42);
+    test_map_basics();
+    test_multimap_order();
+    test_sorted_construction();
+    test_transparent();
+    test_other_containers();
+    test_throwing_compare();
+    test_comparisons_and_swap();
+}
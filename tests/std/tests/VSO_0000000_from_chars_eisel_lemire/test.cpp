@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+using namespace std;
+
+template <class F>
+bool same_bits(const F lhs, const F rhs) {
+    return memcmp(&lhs, &rhs, sizeof(F)) == 0;
+}
+
+template <class F>
+void assert_parses(const string& str, const F expected, const errc expected_ec = errc{}) {
+    F value              = F{42};
+    const auto [ptr, ec] = from_chars(str.data(), str.data() + str.size(), value);
+    assert(ptr == str.data() + str.size());
+    assert(ec == expected_ec);
+    assert(same_bits(value, expected));
+}
+
+void test_double_cases() {
+    // exact halfway cases round to even
+    assert_parses("9007199254740993", 0x1p53);
+    assert_parses("9007199254740995", 0x1.0000000000002p53);
+    assert_parses("9007199254740993.0000000000000000000001", 0x1.0000000000001p53);
+    assert_parses("1e23", 0x1.52d02c7e14af6p76);
+    assert_parses("0.1", 0x1.999999999999ap-4);
+    assert_parses("-2.5", -2.5);
+
+    // more than 19 significant digits
+    assert_parses("123456789012345678901234567890", 0x1.8ee90ff6c373ep96);
+    assert_parses("0.30000000000000000000000000000000001", 0x1.3333333333333p-2);
+
+    // the exact midpoint between 0 and the smallest subnormal value, which needs hundreds of digits to tell apart
+    const string half_of_min_subnormal =
+        "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996"
+        "1898982823477228588654633283551779698981993873980053909390631503565951557022639229085839244910518443"
+        "5931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927"
+        "8343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378"
+        "5739345073633900796776193057750674017632467360096895134053553745851666113422376667860416215968046191"
+        "4467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668"
+        "2350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854"
+        "51396213837722826145437693412532098591327667236328125";
+    assert_parses(half_of_min_subnormal + "e-324", 0.0, errc::result_out_of_range);
+    assert_parses(half_of_min_subnormal + "000000000000000000000000000001e-324", 0x0.0000000000001p-1022);
+
+    // subnormals, and rounding up to the smallest normal value
+    assert_parses("4.9406564584124654e-324", 0x0.0000000000001p-1022);
+    assert_parses("2.2250738585072009e-308", 0x0.fffffffffffffp-1022);
+    assert_parses("2.2250738585072011e-308", 0x0.fffffffffffffp-1022);
+    assert_parses("2.2250738585072012e-308", 0x1p-1022);
+
+    // the top of the range
+    assert_parses("1.7976931348623157e308", 0x1.fffffffffffffp1023);
+    assert_parses("1.7976931348623158e308", 0x1.fffffffffffffp1023);
+
+    // overflow and underflow are still reported
+    assert_parses("1.7976931348623159e308", numeric_limits<double>::infinity(), errc::result_out_of_range);
+    assert_parses("-1e400", -numeric_limits<double>::infinity(), errc::result_out_of_range);
+    assert_parses("2e-324", 0.0, errc::result_out_of_range);
+    assert_parses("-1e-400", -0.0, errc::result_out_of_range);
+    assert_parses("2.4703282292062327e-324", 0.0, errc::result_out_of_range);
+    assert_parses("2.4703282292062328e-324", 0x0.0000000000001p-1022);
+}
+
+void test_float_cases() {
+    assert_parses("16777217", 0x1p24f);
+    assert_parses("16777219", 0x1.000004p24f);
+    assert_parses("0.1", 0x1.99999ap-4f);
+    assert_parses("1.00000005960464477550", 0x1.000002p0f);
+    assert_parses("1.0000000596046447755", 0x1.000002p0f);
+    assert_parses("1.00000005960464477539", 0x1p0f);
+    assert_parses("3.4028235e38", 0x1.fffffep127f);
+    assert_parses("3.40282356e38", 0x1.fffffep127f);
+    assert_parses("3.4028236e38", numeric_limits<float>::infinity(), errc::result_out_of_range);
+    assert_parses("3.5e38", numeric_limits<float>::infinity(), errc::result_out_of_range);
+    assert_parses("1.4e-45", 0x0.000002p-126f);
+    assert_parses("1.17549435e-38", 0x1p-126f);
+    assert_parses("7e-46", 0.0f, errc::result_out_of_range);
+    assert_parses("7.1e-46", 0x0.000002p-126f);
+}
+
+template <class F, class U>
+void test_round_trip(mt19937_64& gen) {
+    char buf[64];
+    for (int rep = 0; rep < 100'000; ++rep) {
+        const U bits = static_cast<U>(gen());
+        F value;
+        memcpy(&value, &bits, sizeof(F));
+        if (value != value || value - value != 0) {
+            continue; // NaN or infinity
+        }
+
+        const auto shortest = to_chars(buf, end(buf), value);
+        assert_parses(string(buf, shortest.ptr), value);
+
+        const auto precise = to_chars(buf, end(buf), value, chars_format::scientific, numeric_limits<F>::max_digits10);
+        assert_parses(string(buf, precise.ptr), value);
+
+        const auto fixed = to_chars(buf, end(buf), value, chars_format::general, 30);
+        assert_parses(string(buf, fixed.ptr), value);
+    }
+}
+
+void test_num_get() {
+    // num_get and from_chars agree, including on the inputs that it leaves to strtod
+    const char* const inputs[] = {"0.1", "-2.5e-3", "+7", "1e23", "123456789012345678901234567890",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "0x1.8p1"};
+    for (const auto input : inputs) {
+        istringstream stream(input);
+        stream.imbue(locale::classic());
+        double value = 42.0;
+        stream >> value;
+        assert(!stream.fail());
+
+        const char* const first = input + (*input == '+');
+        double expected;
+        if (strcmp(input, "0x1.8p1") == 0) {
+            expected = 0.0; // hexadecimal floats aren't recognized by num_get::do_get()
+        } else {
+            (void) from_chars(first, first + strlen(first), expected);
+        }
+
+        assert(same_bits(value, expected));
+
+        istringstream float_stream(input);
+        float float_value = 42.0f;
+        float_stream >> float_value;
+        assert(!float_stream.fail());
+        float float_expected = 0.0f;
+        if (strcmp(input, "0x1.8p1") != 0) {
+            (void) from_chars(first, first + strlen(first), float_expected);
+        }
+
+        assert(same_bits(float_value, float_expected));
+    }
+
+    istringstream out_of_range("1e400");
+    double value = 42.0;
+    out_of_range >> value;
+    assert(out_of_range.fail());
+}
+
+int main() {
+    test_double_cases();
+    test_float_cases();
+    mt19937_64 gen(1729);
+    test_round_trip<double, uint64_t>(gen);
+    test_round_trip<float, uint32_t>(gen);
+    test_num_get();
+}
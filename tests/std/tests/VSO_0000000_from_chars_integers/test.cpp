@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+using namespace std;
+
+// digit at a time, the way from_chars parsed integers before it took 8 digits at a time
+template <class T>
+from_chars_result reference_from_chars(const char* const first, const char* const last, T& result, const int base) {
+    using U             = make_unsigned_t<T>;
+    const char* next    = first;
+    const bool negative = is_signed_v<T> && next != last && *next == '-';
+    next += negative;
+    const U bound = is_signed_v<T> ? static_cast<U>(static_cast<U>(numeric_limits<T>::max()) + negative)
+                                   : numeric_limits<U>::max();
+    U value            = 0;
+    bool overflowed    = false;
+    const char* digits = next;
+    for (; next != last; ++next) {
+        int digit;
+        if (*next >= '0' && *next <= '9') {
+            digit = *next - '0';
+        } else if (*next >= 'a' && *next <= 'z') {
+            digit = *next - 'a' + 10;
+        } else if (*next >= 'A' && *next <= 'Z') {
+            digit = *next - 'A' + 10;
+        } else {
+            break;
+        }
+
+        if (digit >= base) {
+            break;
+        }
+
+        if (value > (bound - digit) / base) {
+            overflowed = true;
+        } else {
+            value = static_cast<U>(value * base + digit);
+        }
+    }
+
+    if (next == digits) {
+        return {first, errc::invalid_argument};
+    }
+
+    if (overflowed) {
+        return {next, errc::result_out_of_range};
+    }
+
+    result = static_cast<T>(negative ? static_cast<U>(0 - value) : value);
+    return {next, errc{}};
+}
+
+template <class T>
+void assert_matches_reference(const string& str, const int base) {
+    T actual                   = 42;
+    T expected                 = 42;
+    const auto actual_result   = from_chars(str.data(), str.data() + str.size(), actual, base);
+    const auto expected_result = reference_from_chars(str.data(), str.data() + str.size(), expected, base);
+    assert(actual_result.ptr == expected_result.ptr);
+    assert(actual_result.ec == expected_result.ec);
+    assert(actual == expected);
+}
+
+void assert_all_types(const string& str) {
+    for (const int base : {10, 16, 8, 36}) {
+        assert_matches_reference<int>(str, base);
+        assert_matches_reference<unsigned int>(str, base);
+        assert_matches_reference<long>(str, base);
+        assert_matches_reference<unsigned long>(str, base);
+        assert_matches_reference<long long>(str, base);
+        assert_matches_reference<unsigned long long>(str, base);
+        assert_matches_reference<short>(str, base);
+        assert_matches_reference<unsigned char>(str, base);
+    }
+}
+
+void test_boundaries() {
+    // runs of 8 digits that straddle the limits of each type, and digits that stop inside a run of 8
+    const char* const cases[] = {"12345678", "1234567", "123456789", "00000000000000000000000000000000000042",
+        "4294967295", "4294967296", "2147483647", "2147483648", "-2147483648", "-2147483649", "18446744073709551615",
+        "18446744073709551616", "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+        "-9223372036854775809", "99999999999999999999", "ffffffff", "FFFFFFFF", "100000000", "7fffffff", "80000000",
+        "-80000000", "ffffffffffffffff", "10000000000000000", "7FFFFFFFFFFFFFFF", "-8000000000000000",
+        "-8000000000000001", "deadBEEFcafef00d", "1234567x", "abcdefg1", "0123456789abcdef:", "12345678/",
+        "1234567:", "@ABCDEFG", "`abcdefg", "12345678\x80", "-", "", "-12345678901234567890"};
+    for (const auto str : cases) {
+        assert_all_types(str);
+    }
+
+    // every byte value in each position of a run of 8
+    for (int pos = 0; pos < 8; ++pos) {
+        for (int ch = 0; ch < 256; ++ch) {
+            string str = "12345678abcdef012";
+            str[static_cast<size_t>(pos)] = static_cast<char>(ch);
+            assert_all_types(str);
+        }
+    }
+}
+
+void test_random(mt19937& gen) {
+    const char alphabet[] = "0123456789abcdefABCDEFgG-+ :/@`";
+    for (int rep = 0; rep < 100'000; ++rep) {
+        string str;
+        if (gen() % 4 == 0) {
+            str.push_back('-');
+        }
+
+        str.append(gen() % 12, '0');
+        const auto len     = gen() % 30;
+        const auto letters = gen() % 3 == 0 ? size_t{10} : gen() % 2 == 0 ? size_t{22} : sizeof(alphabet) - 1;
+        for (size_t idx = 0; idx < len; ++idx) {
+            str.push_back(alphabet[gen() % letters]);
+        }
+
+        assert_all_types(str);
+    }
+}
+
+void test_delimited() {
+    const string csv = "12,345,-6,99999999999,7";
+    int ints[8]{};
+    auto result = stdext::from_chars_delimited(csv.data(), csv.data() + csv.size(), ints, 8, ',');
+    assert(result.count == 3);
+    assert(ints[0] == 12 && ints[1] == 345 && ints[2] == -6);
+    assert(result.ec == errc::result_out_of_range);
+    assert(result.ptr == csv.data() + 21);
+
+    long long longs[8]{};
+    result = stdext::from_chars_delimited(csv.data(), csv.data() + csv.size(), longs, 8, ',');
+    assert(result.count == 5 && result.ec == errc{});
+    assert(longs[3] == 99999999999 && longs[4] == 7);
+    assert(result.ptr == csv.data() + csv.size());
+
+    // stops when full, without consuming the delimiter
+    result = stdext::from_chars_delimited(csv.data(), csv.data() + csv.size(), longs, 2, ',');
+    assert(result.count == 2 && result.ec == errc{});
+    assert(result.ptr == csv.data() + 6);
+
+    // stops at anything that isn't the delimiter
+    const string spaced = "1;2 3";
+    result = stdext::from_chars_delimited(spaced.data(), spaced.data() + spaced.size(), longs, 8, ';');
+    assert(result.count == 2 && result.ec == errc{});
+    assert(result.ptr == spaced.data() + 3);
+
+    // a value that fails to parse after a delimiter is reported
+    const string bad = "1;2;x";
+    result = stdext::from_chars_delimited(bad.data(), bad.data() + bad.size(), longs, 8, ';');
+    assert(result.count == 2 && result.ec == errc::invalid_argument);
+    assert(result.ptr == bad.data() + 4);
+
+    const string hex = "ff|DEADBEEF|0";
+    unsigned int words[3]{};
+    result = stdext::from_chars_delimited(hex.data(), hex.data() + hex.size(), words, 3, '|', 16);
+    assert(result.count == 3 && result.ec == errc{});
+    assert(words[0] == 0xFF && words[1] == 0xDEADBEEF && words[2] == 0);
+
+    result = stdext::from_chars_delimited(hex.data(), hex.data(), words, 3, '|');
+    assert(result.count == 0 && result.ec == errc::invalid_argument);
+}
+
+int main() {
+    mt19937 gen(1729);
+    test_boundaries();
+    test_random(gen);
+    test_delimited();
+}
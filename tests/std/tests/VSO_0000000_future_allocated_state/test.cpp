@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+#if _HAS_CXX17
+#include <memory_resource>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+// promise(allocator_arg, a), packaged_task(allocator_arg, a, f), and stdext::async(allocator_arg, a, ...) allocate
+// the shared state and its deleter together, with a single allocation from a.
+
+size_t allocations   = 0;
+size_t deallocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(int) noexcept {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        ++deallocations;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+const counting_allocator<int> alloc{0};
+
+void reset_counts() {
+    allocations   = 0;
+    deallocations = 0;
+}
+
+void test_promise() {
+    reset_counts();
+    {
+        promise<string> p(allocator_arg, alloc);
+        future<string> f = p.get_future();
+        p.set_value("meow");
+        assert(f.get() == "meow");
+        assert(allocations == 1);
+    }
+    assert(deallocations == 1);
+
+    reset_counts();
+    {
+        promise<void> p(allocator_arg, alloc);
+        shared_future<void> f = p.get_future().share();
+        p.set_exception(make_exception_ptr(42));
+        try {
+            f.get();
+            assert(false);
+        } catch (const int i) {
+            assert(i == 42);
+        }
+    }
+    assert(allocations == 1 && deallocations == 1);
+
+    reset_counts();
+    {
+        promise<int&> p(allocator_arg, alloc); // abandoned
+        future<int&> f = p.get_future();
+        promise<int&>{move(p)};
+        try {
+            (void) f.get();
+            assert(false);
+        } catch (const future_error& e) {
+            assert(e.code() == future_errc::broken_promise);
+        }
+    }
+    assert(allocations == 1 && deallocations == 1);
+}
+
+#if _HAS_FUNCTION_ALLOCATOR_SUPPORT
+void test_packaged_task() {
+    reset_counts();
+    {
+        packaged_task<int(int)> pt(allocator_arg, alloc, [](const int i) { return i * 2; });
+        future<int> f = pt.get_future();
+        pt(21);
+        assert(f.get() == 42);
+        assert(allocations == 1); // the lambda fits in function's small buffer
+    }
+    assert(deallocations == 1);
+}
+#endif // _HAS_FUNCTION_ALLOCATOR_SUPPORT
+
+void test_async() {
+    for (const auto policy : {launch::async, launch::deferred, launch::async | launch::deferred}) {
+        reset_counts();
+        {
+            auto f = stdext::async(allocator_arg, alloc, policy, [](const int a, const int b) { return a + b; }, 2, 3);
+            assert(f.get() == 5);
+            assert(allocations == 1);
+        }
+        assert(deallocations == 1);
+    }
+
+    reset_counts();
+    {
+        auto f = stdext::async(allocator_arg, alloc, launch::async, [] { throw 1729; });
+        try {
+            f.get();
+            assert(false);
+        } catch (const int i) {
+            assert(i == 1729);
+        }
+    }
+    assert(allocations == 1 && deallocations == 1);
+
+    reset_counts();
+    {
+        stdext::async_pool pool{2};
+        auto f = stdext::async(allocator_arg, alloc, pool, [](const string& s) { return s + s; }, string{"ab"});
+        assert(f.get() == "abab");
+        assert(allocations == 1);
+    }
+    assert(deallocations == 1);
+}
+
+#if _HAS_CXX17
+void test_pooled_allocator() {
+    {
+        promise<int> p(allocator_arg, stdext::pooled_allocator<int>{});
+        future<int> f = p.get_future();
+        thread t{[&p] { p.set_value(1729); }};
+        assert(f.get() == 1729);
+        t.join();
+    }
+
+    {
+        auto f = stdext::async(allocator_arg, stdext::pooled_allocator<int>{}, launch::async, [] { return 42; });
+        assert(f.get() == 42);
+    }
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_promise();
+#if _HAS_FUNCTION_ALLOCATOR_SUPPORT
+    test_packaged_task();
+#endif // _HAS_FUNCTION_ALLOCATOR_SUPPORT
+    test_async();
+#if _HAS_CXX17
+    test_pooled_allocator();
+#endif // _HAS_CXX17
+}
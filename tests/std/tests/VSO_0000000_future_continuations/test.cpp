@@ -0,0 +1,375 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+template <class Future>
+bool is_ready(const Future& f) {
+    return f.wait_for(seconds::zero()) == future_status::ready;
+}
+
+void test_then_promise() {
+    promise<int> p;
+    auto f = p.get_future();
+    auto g = stdext::then(move(f), [](future<int> x) { return x.get() * 2; });
+    assert(!f.valid());
+    assert(g.valid());
+    assert(!is_ready(g));
+
+    p.set_value(21);
+    assert(g.get() == 42);
+}
+
+void test_then_ready() {
+    promise<string> p;
+    p.set_value("ready");
+    auto g = stdext::then(p.get_future(), [](future<string> x) { return x.get() + "!"; });
+    assert(is_ready(g)); // called immediately
+    assert(g.get() == "ready!");
+}
+
+void test_then_chain() {
+    promise<int> p;
+    auto f = stdext::then(p.get_future(), [](future<int> x) { return x.get() + 1; });
+    auto g = stdext::then(move(f), [](future<int> x) { return to_string(x.get()); });
+    auto h = stdext::then(move(g), [](future<string> x) { return x.get().size(); });
+    p.set_value(99);
+    assert(h.get() == 3);
+}
+
+void test_then_void_and_reference() {
+    promise<void> p;
+    int value = 0;
+    auto f    = stdext::then(p.get_future(), [&value](future<void> x) -> int& {
+        x.get();
+        value = 5;
+        return value;
+    });
+    p.set_value();
+    assert(&f.get() == &value);
+    assert(value == 5);
+
+    promise<int> q;
+    auto g = stdext::then(q.get_future(), [](future<int> x) { (void) x.get(); });
+    q.set_value(1);
+    g.get();
+}
+
+void test_then_exceptions() {
+    promise<int> p;
+    auto f = stdext::then(p.get_future(), [](future<int> x) {
+        try {
+            (void) x.get();
+        } catch (const runtime_error&) {
+            return string{"caught"};
+        }
+
+        return string{"not caught"};
+    });
+    p.set_exception(make_exception_ptr(runtime_error("producer")));
+    assert(f.get() == "caught");
+
+    // exceptions thrown by the continuation itself are stored in the result
+    promise<int> q;
+    auto g = stdext::then(q.get_future(), [](future<int>) -> int { throw logic_error("continuation"); });
+    q.set_value(0);
+    bool threw = false;
+    try {
+        (void) g.get();
+    } catch (const logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // an abandoned promise makes the future ready with broken_promise
+    future<bool> broken;
+    {
+        promise<int> r;
+        broken = stdext::then(r.get_future(), [](future<int> x) {
+            try {
+                (void) x.get();
+            } catch (const future_error& e) {
+                return e.code() == future_errc::broken_promise;
+            }
+            return false;
+        });
+    }
+    assert(broken.get());
+
+    bool invalid = false;
+    try {
+        (void) stdext::then(future<int>{}, [](future<int>) {});
+    } catch (const future_error& e) {
+        invalid = e.code() == future_errc::no_state;
+    }
+    assert(invalid);
+}
+
+void test_then_move_only_continuation() {
+    promise<int> p;
+    auto ptr = make_unique<int>(10);
+    auto f   = stdext::then(p.get_future(), [ptr = move(ptr)](future<int> x) { return *ptr + x.get(); });
+    p.set_value(5);
+    assert(f.get() == 15);
+}
+
+void test_then_deferred() {
+    bool ran = false;
+    auto f   = async(launch::deferred, [&ran] {
+        ran = true;
+        return 3;
+    });
+    auto g   = stdext::then(move(f), [](future<int> x) { return x.get() + 1; });
+    assert(g.wait_for(seconds::zero()) == future_status::deferred);
+    assert(!ran);
+    assert(g.get() == 4);
+    assert(ran);
+}
+
+void test_then_async() {
+    auto f = async(launch::async, [] {
+        this_thread::sleep_for(milliseconds{10});
+        return 7;
+    });
+    auto g = stdext::then(move(f), [](future<int> x) { return x.get() * 6; });
+    assert(g.get() == 42);
+
+    stdext::async_pool pool{1};
+    auto h = stdext::then(stdext::async(pool, [] { return 1; }), [](future<int> x) { return x.get() + 1; });
+    assert(h.get() == 2);
+}
+
+void test_then_shared_future() {
+    promise<int> p;
+    const auto s = p.get_future().share();
+    auto a       = stdext::then(s, [](shared_future<int> x) { return x.get() + 1; });
+    auto b       = stdext::then(s, [](shared_future<int> x) { return x.get() + 2; });
+    assert(s.valid());
+    p.set_value(10);
+    assert(a.get() == 11);
+    assert(b.get() == 12);
+    assert(s.get() == 10);
+}
+
+void test_then_at_thread_exit() {
+    promise<int> p;
+    auto f = stdext::then(p.get_future(), [](future<int> x) { return x.get(); });
+    thread t{[&p] { p.set_value_at_thread_exit(8); }};
+    t.join();
+    assert(f.get() == 8);
+
+    promise<int> q;
+    atomic<bool> set{false};
+    thread u{[&q, &set] {
+        q.set_value_at_thread_exit(9);
+        set.store(true);
+        this_thread::sleep_for(milliseconds{10});
+    }};
+    while (!set.load()) {
+        this_thread::yield();
+    }
+
+    auto g = stdext::then(q.get_future(), [](future<int> x) { return x.get(); });
+    u.join();
+    assert(g.get() == 9);
+}
+
+void test_many_pending_continuations() {
+    // no thread waits for any of these
+    constexpr size_t count = 1000;
+    vector<promise<size_t>> promises(count);
+    vector<future<size_t>> results;
+    for (auto& p : promises) {
+        results.push_back(stdext::then(p.get_future(), [](future<size_t> x) { return x.get() + 1; }));
+    }
+
+    for (const auto& r : results) {
+        assert(!is_ready(r));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        promises[i].set_value(i);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        assert(results[i].get() == i + 1);
+    }
+}
+
+void test_when_all_range() {
+    vector<promise<int>> promises(5);
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto all = stdext::when_all(futures.begin(), futures.end());
+    for (const auto& f : futures) {
+        assert(!f.valid()); // moved from
+    }
+
+    for (size_t i = promises.size(); i-- > 1;) {
+        promises[i].set_value(static_cast<int>(i));
+        assert(!is_ready(all));
+    }
+
+    promises[0].set_value(0);
+    auto done = all.get();
+    assert(done.size() == 5);
+    for (size_t i = 0; i < done.size(); ++i) {
+        assert(is_ready(done[i]));
+        assert(done[i].get() == static_cast<int>(i));
+    }
+
+    vector<future<int>> none;
+    auto empty = stdext::when_all(none.begin(), none.end());
+    assert(is_ready(empty));
+    assert(empty.get().empty());
+
+    // shared_futures are copied rather than moved
+    promise<int> p;
+    vector<shared_future<int>> shared{p.get_future().share()};
+    auto all_shared = stdext::when_all(shared.begin(), shared.end());
+    assert(shared[0].valid());
+    p.set_value(1);
+    assert(all_shared.get()[0].get() == 1);
+}
+
+void test_when_all_variadic() {
+    promise<int> p1;
+    promise<string> p2;
+    promise<void> p3;
+    auto all = stdext::when_all(p1.get_future(), p2.get_future().share(), p3.get_future());
+    p2.set_value("two");
+    p3.set_value();
+    assert(!is_ready(all));
+    p1.set_value(1);
+
+    auto done = all.get();
+    assert(get<0>(done).get() == 1);
+    assert(get<1>(done).get() == "two");
+    get<2>(done).get();
+
+    auto nothing = stdext::when_all();
+    assert(is_ready(nothing));
+    nothing.get();
+
+    // when_all can be continued
+    promise<int> a;
+    promise<int> b;
+    auto sum = stdext::then(stdext::when_all(a.get_future(), b.get_future()),
+        [](future<tuple<future<int>, future<int>>> x) {
+            auto t = x.get();
+            return get<0>(t).get() + get<1>(t).get();
+        });
+    a.set_value(40);
+    b.set_value(2);
+    assert(sum.get() == 42);
+}
+
+void test_when_any_range() {
+    vector<promise<int>> promises(4);
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto any = stdext::when_any(futures.begin(), futures.end());
+    assert(!is_ready(any));
+    promises[2].set_value(22);
+    auto result = any.get();
+    assert(result.index == 2);
+    assert(result.futures.size() == 4);
+    assert(result.futures[2].get() == 22);
+    assert(!is_ready(result.futures[0]));
+
+    // the others can still be made ready afterwards
+    promises[0].set_value(0);
+    promises[1].set_value(1);
+    promises[3].set_value(3);
+    assert(result.futures[3].get() == 3);
+
+    vector<future<int>> none;
+    auto empty = stdext::when_any(none.begin(), none.end());
+    assert(is_ready(empty));
+    const auto empty_result = empty.get();
+    assert(empty_result.index == static_cast<size_t>(-1));
+    assert(empty_result.futures.empty());
+}
+
+void test_when_any_variadic() {
+    promise<int> p1;
+    promise<string> p2;
+    auto any = stdext::when_any(p1.get_future(), p2.get_future());
+    p2.set_value("second");
+    auto result = any.get();
+    assert(result.index == 1);
+    assert(get<1>(result.futures).get() == "second");
+    p1.set_value(1);
+    assert(get<0>(result.futures).get() == 1);
+
+    promise<int> ready;
+    ready.set_value(5);
+    promise<int> pending;
+    auto first_ready = stdext::when_any(pending.get_future(), ready.get_future());
+    assert(is_ready(first_ready));
+    assert(first_ready.get().index == 1);
+    pending.set_value(0);
+}
+
+void test_concurrent_producers() {
+    constexpr int count = 64;
+    vector<promise<int>> promises(count);
+    vector<future<int>> futures;
+    for (auto& p : promises) {
+        futures.push_back(p.get_future());
+    }
+
+    auto all = stdext::when_all(futures.begin(), futures.end());
+    vector<thread> producers;
+    for (int i = 0; i < count; ++i) {
+        producers.emplace_back([&promises, i] { promises[static_cast<size_t>(i)].set_value(i); });
+    }
+
+    auto done = all.get();
+    for (int i = 0; i < count; ++i) {
+        assert(done[static_cast<size_t>(i)].get() == i);
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+}
+
+int main() {
+    test_then_promise();
+    test_then_ready();
+    test_then_chain();
+    test_then_void_and_reference();
+    test_then_exceptions();
+    test_then_move_only_continuation();
+    test_then_deferred();
+    test_then_async();
+    test_then_shared_future();
+    test_then_at_thread_exit();
+    test_many_pending_continuations();
+    test_when_all_range();
+    test_when_all_variadic();
+    test_when_any_range();
+    test_when_any_variadic();
+    test_concurrent_producers();
+}
@@ -0,0 +1,206 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <version> // TRANSITION, P0912R5 Library Support For Coroutines
+#if defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L // TRANSITION, P0912R5 Library Support For Coroutines
+
+#include <assert.h>
+#include <cstddef>
+#include <experimental/generator>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using experimental::elements_of;
+using experimental::generator;
+using experimental::recycling_frame_allocator;
+
+size_t live_bytes = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    int id;
+
+    explicit counting_allocator(const int i) : id(i) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        live_bytes += n * sizeof(T);
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        live_bytes -= n * sizeof(T);
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const {
+        return id == other.id;
+    }
+};
+
+template <class Gen>
+vector<int> collect(Gen&& gen) {
+    vector<int> result;
+    for (const int x : gen) {
+        result.push_back(x);
+    }
+
+    return result;
+}
+
+generator<int> iota(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+generator<int, counting_allocator<char>> counted(allocator_arg_t, counting_allocator<char>, const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+generator<int, pmr::polymorphic_allocator<char>> doubled(
+    allocator_arg_t, pmr::polymorphic_allocator<char>, const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i * 2;
+    }
+}
+
+generator<int, recycling_frame_allocator<char>> recycled(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+struct offset_source {
+    int base;
+
+    generator<int, counting_allocator<char>> values(allocator_arg_t, counting_allocator<char>, const int n) const {
+        for (int i = 0; i < n; ++i) {
+            co_yield base + i;
+        }
+    }
+};
+
+void test_allocators() {
+    {
+        auto gen = counted(allocator_arg, counting_allocator<char>{3}, 4);
+        assert(live_bytes != 0);
+        assert((collect(gen) == vector<int>{0, 1, 2, 3}));
+    }
+    assert(live_bytes == 0);
+
+    const offset_source source{10};
+    assert((collect(source.values(allocator_arg, counting_allocator<char>{1}, 3)) == vector<int>{10, 11, 12}));
+    assert(live_bytes == 0);
+
+    pmr::monotonic_buffer_resource resource;
+    assert((collect(doubled(allocator_arg, &resource, 3)) == vector<int>{0, 2, 4}));
+
+    int sum = 0;
+    for (int i = 0; i < 1000; ++i) {
+        for (const int x : recycled(3)) {
+            sum += x;
+        }
+    }
+    assert(sum == 3000);
+
+    // frames created on one thread may be destroyed on another
+    auto moved_away = recycled(2);
+    thread t{[&moved_away] {
+        assert((collect(moved_away) == vector<int>{0, 1}));
+        moved_away = {};
+        assert((collect(recycled(4)) == vector<int>{0, 1, 2, 3}));
+    }};
+    t.join();
+}
+
+generator<int> tree(const int depth) {
+    if (depth == 0) {
+        co_yield 1;
+        co_return;
+    }
+
+    co_yield elements_of{tree(depth - 1)};
+    co_yield depth;
+    co_yield elements_of{tree(depth - 1)};
+}
+
+generator<int> mixed() {
+    co_yield 0;
+    vector<int> v{1, 2, 3};
+    co_yield elements_of{move(v)};
+    list<short> l{4, 5};
+    co_yield elements_of{l};
+    co_yield elements_of{generator<int>{}};
+    co_yield elements_of{recycled(2)};
+    auto lvalue_gen = iota(3);
+    co_yield elements_of{lvalue_gen};
+    co_yield 99;
+}
+
+generator<int> thrower() {
+    co_yield 1;
+    throw runtime_error{"thrower"};
+}
+
+generator<int> catcher() {
+    bool caught = false;
+    try {
+        co_yield elements_of{thrower()};
+    } catch (const runtime_error&) {
+        caught = true;
+    }
+
+    if (caught) {
+        co_yield -1;
+    }
+}
+
+void test_nested() {
+    assert((collect(tree(2)) == vector<int>{1, 1, 1, 2, 1, 1, 1}));
+    assert(collect(tree(12)).size() == 8191);
+    assert((collect(mixed()) == vector<int>{0, 1, 2, 3, 4, 5, 0, 1, 0, 1, 2, 99}));
+    assert((collect(catcher()) == vector<int>{1, -1}));
+
+    bool caught = false;
+    try {
+        (void) collect(thrower());
+    } catch (const runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    {
+        // destroying a generator suspended inside a nested one destroys the whole chain
+        auto gen = tree(3);
+        auto it  = gen.begin();
+        ++it;
+        assert(*it == 1);
+    }
+
+    auto a = iota(3);
+    a      = iota(4);
+    assert(collect(a).size() == 4);
+}
+
+int main() {
+    test_allocators();
+    test_nested();
+}
+
+#else // ^^^ test <experimental/generator> ^^^ / vvv don't test <experimental/generator> vvv
+int main() {}
+#endif // TRANSITION, P0912R5 Library Support For Coroutines
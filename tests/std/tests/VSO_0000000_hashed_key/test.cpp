@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+
+int hash_calls = 0;
+
+struct counting_hash {
+    size_t operator()(const string& str) const {
+        ++hash_calls;
+        return hash<string>{}(str);
+    }
+};
+
+using string_key = stdext::hashed_key<string, counting_hash>;
+
+void test_hash_computed_once() {
+    unordered_map<string_key, int> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace(to_string(i), i);
+    }
+
+    assert(hash_calls == 1000);
+
+    // rehashing uses the stored hash codes
+    m.rehash(m.bucket_count() * 16);
+    m.max_load_factor(0.25f);
+    m.insert({"one more", -1});
+    assert(hash_calls == 1001);
+
+    // lookups hash the probe key only
+    assert(m.at("42") == 42);
+    assert(hash_calls == 1002);
+    assert(m.count(string_key("missing")) == 0);
+    assert(hash_calls == 1003);
+
+    m["42"] = 4242;
+    assert(m.at(string_key("42")) == 4242);
+
+    auto copy = m;
+    assert(copy == m);
+    assert(hash_calls == 1005);
+}
+
+void test_key_access_and_equality() {
+    const string_key a("key");
+    const string_key b(string("key"), counting_hash{});
+    const string_key c("other");
+    assert(a.key() == "key");
+    assert(a.hash_code() == hash<string>{}("key"));
+    assert(hash<string_key>{}(a) == a.hash_code());
+    assert(a == b);
+    assert(!(a != b));
+    assert(a != c);
+
+    string_key copied = a;
+    assert(copied == a);
+    string_key moved = move(copied);
+    assert(moved == a);
+}
+
+void test_set() {
+    unordered_set<stdext::hashed_key<int>> s{1, 2, 3, 2};
+    assert(s.size() == 3);
+    assert(s.count(2) == 1);
+    assert(s.erase(3) == 1);
+    assert(s.find(3) == s.end());
+
+    unordered_multiset<stdext::hashed_key<string>> ms{"a", "b", "a"};
+    assert(ms.count("a") == 2);
+}
+
+int main() {
+    test_hash_computed_once();
+    test_key_access_and_equality();
+    test_set();
+}
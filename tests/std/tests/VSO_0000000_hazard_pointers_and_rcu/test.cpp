@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+atomic<int> live{0};
+
+struct hazard_node;
+
+struct counting_delete {
+    int* count = nullptr;
+
+    void operator()(hazard_node* ptr) noexcept;
+};
+
+struct hazard_node : stdext::hazard_pointer_obj_base<hazard_node, counting_delete> {
+    int value;
+    bool alive = true;
+
+    explicit hazard_node(const int v) noexcept : value(v) {
+        ++live;
+    }
+
+    ~hazard_node() {
+        alive = false;
+        --live;
+    }
+};
+
+void counting_delete::operator()(hazard_node* const ptr) noexcept {
+    if (count) {
+        ++*count;
+    }
+
+    delete ptr;
+}
+
+struct plain_hazard_node : stdext::hazard_pointer_obj_base<plain_hazard_node> {
+    int value = 0;
+};
+
+struct rcu_node : stdext::rcu_obj_base<rcu_node> {
+    int value;
+    bool alive = true;
+
+    explicit rcu_node(const int v) noexcept : value(v) {
+        ++live;
+    }
+
+    ~rcu_node() {
+        alive = false;
+        --live;
+    }
+};
+
+void test_hazard_pointer_basics() {
+    stdext::hazard_pointer empty_hp;
+    assert(empty_hp.empty());
+
+    stdext::hazard_pointer hp = stdext::make_hazard_pointer();
+    assert(!hp.empty());
+
+    swap(hp, empty_hp);
+    assert(hp.empty());
+    assert(!empty_hp.empty());
+
+    hp = move(empty_hp);
+    assert(!hp.empty());
+    assert(empty_hp.empty());
+
+    stdext::hazard_pointer moved{move(hp)};
+    assert(!moved.empty());
+    assert(hp.empty());
+
+    // many at once, and reused after they are destroyed
+    vector<stdext::hazard_pointer> many;
+    for (int i = 0; i < 100; ++i) {
+        many.push_back(stdext::make_hazard_pointer());
+    }
+
+    many.clear();
+    for (int i = 0; i < 100; ++i) {
+        many.push_back(stdext::make_hazard_pointer());
+    }
+}
+
+void test_hazard_pointer_protection() {
+    atomic<hazard_node*> src{new hazard_node{1}};
+    stdext::hazard_pointer hp = stdext::make_hazard_pointer();
+    hazard_node* const protected_ptr = hp.protect(src);
+    assert(protected_ptr->value == 1);
+
+    // a protected object outlives its retirement
+    src.store(new hazard_node{2});
+    int deleted = 0;
+    protected_ptr->retire();
+    stdext::hazard_pointer_clean_up();
+    assert(protected_ptr->alive);
+    assert(protected_ptr->value == 1);
+    assert(live == 2);
+
+    hp.reset_protection();
+    stdext::hazard_pointer_clean_up();
+    assert(live == 1);
+
+    // try_protect fails when the source has changed
+    hazard_node* expected = src.load();
+    assert(hp.try_protect(expected, src));
+    assert(expected->value == 2);
+    hazard_node* stale = nullptr;
+    assert(!hp.try_protect(stale, src));
+    assert(stale == src.load());
+
+    hp.reset_protection(expected);
+    src.load()->retire(counting_delete{&deleted});
+    src.store(nullptr);
+    stdext::hazard_pointer_clean_up();
+    assert(deleted == 0);
+    hp.reset_protection(nullptr);
+    stdext::hazard_pointer_clean_up();
+    assert(deleted == 1);
+    assert(live == 0);
+
+    // objects retired without ever being protected
+    for (int i = 0; i < 5000; ++i) {
+        (new plain_hazard_node)->retire();
+    }
+
+    stdext::hazard_pointer_clean_up();
+}
+
+void test_hazard_pointer_threads() {
+    constexpr int readers = 4;
+    constexpr int updates = 20000;
+    atomic<hazard_node*> src{new hazard_node{0}};
+    atomic<bool> done{false};
+    atomic<int> started{0};
+
+    vector<thread> threads;
+    for (int i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            stdext::hazard_pointer hp = stdext::make_hazard_pointer();
+            int last                  = 0;
+            ++started;
+            while (!done.load()) {
+                hazard_node* const ptr = hp.protect(src);
+                assert(ptr->alive);
+                assert(ptr->value >= last);
+                last = ptr->value;
+                hp.reset_protection();
+            }
+        });
+    }
+
+    while (started.load() != readers) {
+        this_thread::yield();
+    }
+
+    for (int i = 1; i <= updates; ++i) {
+        src.exchange(new hazard_node{i})->retire();
+        if (i % 100 == 0) {
+            this_thread::yield();
+        }
+    }
+
+    done.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    src.exchange(nullptr)->retire();
+    stdext::hazard_pointer_clean_up();
+    assert(live == 0);
+}
+
+void test_rcu_basics() {
+    stdext::rcu_domain& domain = stdext::rcu_default_domain();
+    assert(&domain == &stdext::rcu_default_domain());
+
+    // critical sections nest
+    domain.lock();
+    assert(domain.try_lock());
+    domain.unlock();
+    domain.unlock();
+
+    {
+        scoped_lock lock{domain};
+    }
+
+    stdext::rcu_synchronize();
+    stdext::rcu_synchronize(domain);
+
+    // retiring within a read-side critical section is allowed
+    {
+        scoped_lock lock{domain};
+        (new rcu_node{1})->retire();
+        stdext::rcu_retire(new rcu_node{2});
+    }
+
+    stdext::rcu_barrier();
+    assert(live == 0);
+
+    int deleted = 0;
+    auto* node  = new rcu_node{3};
+    stdext::rcu_retire(node, [&deleted](rcu_node* const ptr) noexcept {
+        ++deleted;
+        delete ptr;
+    });
+    stdext::rcu_barrier(domain);
+    assert(deleted == 1);
+    assert(live == 0);
+}
+
+void test_rcu_allocators() {
+    using alloc_type = allocator<rcu_node>;
+    alloc_type al;
+    rcu_node* const ptr = al.allocate(1);
+    allocator_traits<alloc_type>::construct(al, ptr, 4);
+    stdext::rcu_retire(ptr, stdext::allocator_delete<alloc_type>{al});
+
+    pmr::monotonic_buffer_resource resource;
+    using pmr_type = pmr::polymorphic_allocator<rcu_node>;
+    pmr_type pmr_al{&resource};
+    rcu_node* const pmr_ptr = pmr_al.allocate(1);
+    pmr_al.construct(pmr_ptr, 5);
+    stdext::rcu_retire(pmr_ptr, stdext::allocator_delete<pmr_type>{pmr_al});
+    stdext::rcu_barrier();
+    assert(live == 0);
+}
+
+void test_rcu_threads() {
+    constexpr int readers = 4;
+    constexpr int updates = 20000;
+    atomic<rcu_node*> src{new rcu_node{0}};
+    atomic<bool> done{false};
+    atomic<int> started{0};
+
+    vector<thread> threads;
+    for (int i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            int last = 0;
+            ++started;
+            while (!done.load()) {
+                scoped_lock lock{stdext::rcu_default_domain()};
+                rcu_node* const ptr = src.load(memory_order_acquire);
+                assert(ptr->alive);
+                assert(ptr->value >= last);
+                last = ptr->value;
+            }
+        });
+    }
+
+    while (started.load() != readers) {
+        this_thread::yield();
+    }
+
+    for (int i = 1; i <= updates; ++i) {
+        rcu_node* const old = src.exchange(new rcu_node{i});
+        if (i % 100 == 0) {
+            stdext::rcu_synchronize();
+            delete old;
+            this_thread::yield();
+        } else {
+            old->retire();
+        }
+    }
+
+    done.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    src.exchange(nullptr)->retire();
+    stdext::rcu_barrier();
+    assert(live == 0);
+}
+
+int main() {
+    test_hazard_pointer_basics();
+    test_hazard_pointer_protection();
+    test_hazard_pointer_threads();
+    test_rcu_basics();
+    test_rcu_allocators();
+    test_rcu_threads();
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+using namespace std;
+
+// _HAS_HETEROGENEOUS_UNORDERED_LOOKUP=1 provides the C++20 transparent lookup overloads in C++17 too
+
+bool g_prohibit_allocations = false;
+
+void* operator new(const size_t size) {
+    assert(!g_prohibit_allocations);
+    if (void* const p = malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+
+    throw bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* const ptr, size_t) noexcept {
+    free(ptr);
+}
+
+struct transparent_string_hash {
+    using is_transparent = void;
+    size_t operator()(const string_view target) const noexcept {
+        return hash<string_view>{}(target);
+    }
+};
+
+const string_view long_key = "a key long enough that converting it to std::string would allocate";
+
+template <class Container>
+void test_container(const size_t expected_count) {
+    Container c;
+    for (size_t i = 0; i < expected_count; ++i) {
+        c.emplace(string{long_key});
+        c.emplace(string{"another key that is also too long for the small string buffer"});
+    }
+
+    g_prohibit_allocations = true;
+    assert(c.find(long_key) != c.end());
+    assert(c.find(string_view{"missing key that is also too long for the small string buffer"}) == c.end());
+    assert(c.count(long_key) == expected_count);
+    const auto range = c.equal_range(long_key);
+    assert(static_cast<size_t>(distance(range.first, range.second)) == expected_count);
+    assert(*range.first == long_key);
+    g_prohibit_allocations = false;
+}
+
+int main() {
+    test_container<unordered_set<string, transparent_string_hash, equal_to<>>>(1);
+    test_container<unordered_multiset<string, transparent_string_hash, equal_to<>>>(3);
+}
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Queue, class Pr>
+void assert_matches(Queue& q, const map<size_t, int>& live, Pr pred) {
+    assert(q.size() == live.size());
+    assert(q.empty() == live.empty());
+    auto best = live.begin();
+    for (auto it = live.begin(); it != live.end(); ++it) {
+        assert(q.contains(it->first));
+        assert(q.value(it->first) == it->second);
+        if (pred(best->second, it->second)) {
+            best = it;
+        }
+    }
+
+    if (!live.empty()) {
+        assert(q.top() == best->second);
+        assert(q.value(q.top_handle()) == q.top());
+    }
+}
+
+template <size_t Arity, class Pr>
+void test_against_map(const unsigned int seed) {
+    mt19937 gen(seed);
+    uniform_int_distribution<int> vals(0, 500);
+    stdext::indexed_priority_queue<int, Pr, Arity> q;
+    static_assert(decltype(q)::arity == Arity, "arity should be exposed");
+    map<size_t, int> live; // handle -> value
+    size_t max_handle = 0;
+
+    for (int step = 0; step < 5'000; ++step) {
+        const auto pick = [&] { return next(live.begin(), static_cast<ptrdiff_t>(gen() % live.size())); };
+        switch (live.empty() ? 0 : gen() % 6) {
+        case 0:
+        case 1:
+            {
+                const int val       = vals(gen);
+                const size_t handle = q.push(val);
+                assert(live.count(handle) == 0);
+                max_handle = handle > max_handle ? handle : max_handle;
+                live.emplace(handle, val);
+                break;
+            }
+        case 2:
+            {
+                const size_t handle = q.top_handle();
+                q.pop();
+                live.erase(handle);
+                assert(!q.contains(handle));
+                break;
+            }
+        case 3:
+            {
+                const auto it = pick();
+                q.erase(it->first);
+                assert(!q.contains(it->first));
+                live.erase(it);
+                break;
+            }
+        case 4:
+            {
+                const auto it = pick();
+                it->second   = vals(gen);
+                q.update(it->first, it->second);
+                break;
+            }
+        default:
+            {
+                const auto it   = pick();
+                const int delta = vals(gen) % 50;
+                it->second      = Pr{}(0, 1) ? it->second + delta : it->second - delta; // towards the top
+                q.decrease_key(it->first, it->second);
+                break;
+            }
+        }
+
+        assert_matches(q, live, Pr{});
+    }
+
+    // handles of popped and erased elements are reused, so the handles stay dense
+    assert(max_handle < 500);
+    while (!q.empty()) {
+        q.pop();
+    }
+
+    for (size_t i = 0; i <= max_handle; ++i) {
+        assert(!q.contains(i));
+    }
+
+    for (size_t i = 0; i <= max_handle; ++i) {
+        assert(q.push(0) <= max_handle);
+    }
+}
+
+void test_dijkstra() {
+    // shortest paths with one heap entry per vertex, lowered with decrease_key instead of pushing duplicates
+    const vector<vector<pair<size_t, int>>> graph{
+        {{1, 7}, {2, 9}, {5, 14}}, {{0, 7}, {2, 10}, {3, 15}}, {{0, 9}, {1, 10}, {3, 11}, {5, 2}},
+        {{1, 15}, {2, 11}, {4, 6}}, {{3, 6}, {5, 9}}, {{0, 14}, {2, 2}, {4, 9}}};
+    const int unreached = numeric_limits<int>::max();
+
+    stdext::indexed_priority_queue<int, greater<int>> q;
+    vector<int> dist(graph.size(), unreached);
+    vector<size_t> handles(graph.size());
+    vector<size_t> vertices; // handle -> vertex
+    vector<bool> done(graph.size());
+    dist[0]    = 0;
+    handles[0] = q.push(0);
+    vertices.push_back(0);
+    size_t max_size = 0;
+    while (!q.empty()) {
+        max_size       = q.size() > max_size ? q.size() : max_size;
+        const size_t u = vertices[q.top_handle()];
+        q.pop();
+        done[u] = true;
+        for (const auto& edge : graph[u]) {
+            const size_t v = edge.first;
+            const int alt  = dist[u] + edge.second;
+            if (done[v] || alt >= dist[v]) {
+                continue;
+            }
+
+            if (dist[v] == unreached) {
+                handles[v] = q.push(alt);
+                if (handles[v] == vertices.size()) {
+                    vertices.push_back(v);
+                } else {
+                    vertices[handles[v]] = v;
+                }
+            } else {
+                q.decrease_key(handles[v], alt);
+            }
+
+            dist[v] = alt;
+        }
+    }
+
+    assert((dist == vector<int>{0, 7, 9, 20, 20, 11}));
+    assert(max_size <= graph.size());
+}
+
+void test_strings_and_emplace() {
+    stdext::indexed_priority_queue<string> q;
+    const size_t meow = q.emplace(3, 'm');
+    const size_t purr = q.push("purr");
+    assert(q.top() == "purr");
+    q.update(meow, "zzz");
+    assert(q.top_handle() == meow);
+    q.erase(meow);
+    assert(q.top() == "purr" && q.size() == 1);
+    q.clear();
+    assert(q.empty() && !q.contains(purr));
+}
+
+void test_swap_and_allocator() {
+    allocator<int> al;
+    stdext::indexed_priority_queue<int> a(al);
+    stdext::indexed_priority_queue<int> b(less<int>{}, al);
+    assert(a.get_allocator() == al);
+    a.reserve(10);
+    const size_t h = a.push(5);
+    b.push(1);
+    b.push(2);
+    swap(a, b);
+    assert(a.size() == 2 && a.top() == 2);
+    assert(b.size() == 1 && b.contains(h) && b.value(h) == 5);
+    a.swap(b);
+    assert(a.top() == 5 && b.top() == 2);
+}
+
+int main() {
+    test_against_map<2, less<int>>(1729);
+    test_against_map<3, greater<int>>(1234);
+    test_against_map<4, less<int>>(42);
+    test_against_map<8, greater<int>>(7);
+    test_dijkstra();
+    test_strings_and_emplace();
+    test_swap_and_allocator();
+}
@@ -0,0 +1,335 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+// serves a string a few characters at a time, so that fields straddle the end of the read buffer
+class chunked_buf : public streambuf {
+public:
+    chunked_buf(const string& str, const size_t chunk) : data(str), chunk_size(chunk) {}
+
+protected:
+    int_type underflow() override {
+        if (pos == data.size()) {
+            return traits_type::eof();
+        }
+
+        const size_t count = min(chunk_size, data.size() - pos);
+        char* const first  = &data[pos];
+        setg(first, first, first + count);
+        pos += count;
+        return traits_type::to_int_type(*first);
+    }
+
+private:
+    string data;
+    size_t chunk_size;
+    size_t pos = 0;
+};
+
+// accepts at most limit characters, without a write buffer
+class limited_buf : public streambuf {
+public:
+    explicit limited_buf(const size_t limit_) : limit(limit_) {}
+
+    string written;
+
+protected:
+    int_type overflow(const int_type ch) override {
+        if (traits_type::eq_int_type(ch, traits_type::eof()) || written.size() == limit) {
+            return traits_type::eof();
+        }
+
+        written.push_back(traits_type::to_char_type(ch));
+        return ch;
+    }
+
+private:
+    size_t limit;
+};
+
+struct comma_punct : numpunct<char> {
+protected:
+    char do_decimal_point() const override {
+        return ',';
+    }
+};
+
+template <class T>
+void check_get(const string& str, const T expected_val, const ios_base::iostate expected_state,
+    const streamoff expected_pos = -1) {
+    for (const size_t chunk : {size_t{1}, size_t{3}, size_t{1000}}) {
+        chunked_buf buf(str, chunk);
+        istream is(&buf);
+        T val{};
+        is >> val;
+        if (val != expected_val || is.rdstate() != expected_state) {
+            fprintf(stderr, "\"%s\" (chunk %zu): state %d\n", str.c_str(), chunk, static_cast<int>(is.rdstate()));
+            assert(false);
+        }
+
+        if (expected_pos >= 0) {
+            is.clear();
+            assert(is.tellg() == -1 || is.tellg() == expected_pos); // chunked_buf doesn't support seeking
+            string rest;
+            getline(is, rest);
+            assert(rest == str.substr(static_cast<size_t>(expected_pos)));
+        }
+    }
+
+    istringstream iss(str);
+    T val{};
+    iss >> val;
+    assert(val == expected_val);
+    assert(iss.rdstate() == expected_state);
+}
+
+void test_get_integers() {
+    const auto good = ios_base::goodbit;
+    const auto fail = ios_base::failbit;
+    const auto eof  = ios_base::eofbit;
+
+    check_get<int>("123 ", 123, good, 3);
+    check_get<int>("123", 123, eof);
+    check_get<int>("+123x", 123, good, 4);
+    check_get<int>("-123x", -123, good, 4);
+    check_get<int>("  42,", 42, good, 4);
+    check_get<int>("+-5 ", 0, fail);
+    check_get<int>("- 5 ", 0, fail);
+    check_get<int>("x ", 0, fail);
+    check_get<int>("2147483647 ", numeric_limits<int>::max(), good, 10);
+    check_get<int>("-2147483648 ", numeric_limits<int>::min(), good, 11);
+    check_get<int>("2147483648 ", numeric_limits<int>::max(), fail);
+    check_get<int>("-2147483649 ", numeric_limits<int>::min(), fail);
+    check_get<long long>("9223372036854775807 ", numeric_limits<long long>::max(), good, 19);
+    check_get<long long>("99999999999999999999 ", numeric_limits<long long>::max(), fail);
+    check_get<unsigned long long>("18446744073709551615 ", numeric_limits<unsigned long long>::max(), good, 20);
+    check_get<unsigned long long>("18446744073709551616 ", numeric_limits<unsigned long long>::max(), fail);
+    check_get<unsigned int>("-5 ", numeric_limits<unsigned int>::max() - 4, good, 2);
+    check_get<unsigned short>("65535 ", 65535, good, 5);
+    check_get<unsigned short>("65536 ", 65535, fail);
+    check_get<long>("0777 ", 777, good, 4);
+
+    istringstream hex_stream("ff 0x10 17 ");
+    unsigned int hex_val = 0;
+    hex_stream >> hex >> hex_val;
+    assert(hex_val == 0xff);
+    hex_stream >> hex_val;
+    assert(hex_val == 0x10);
+    hex_stream >> oct >> hex_val;
+    assert(hex_val == 017);
+    assert(hex_stream.good());
+
+    istringstream any_base("0x1f 010 ");
+    any_base.setf(ios_base::fmtflags{}, ios_base::basefield);
+    any_base >> hex_val;
+    assert(hex_val == 0x1f);
+    any_base >> hex_val;
+    assert(hex_val == 010);
+
+    mt19937_64 gen(1729);
+    string many;
+    for (int i = 0; i < 10'000; ++i) {
+        many += to_string(static_cast<long long>(gen())) + ' ';
+    }
+
+    for (const size_t chunk : {size_t{7}, size_t{4096}}) {
+        gen.seed(1729);
+        chunked_buf buf(many, chunk);
+        istream is(&buf);
+        for (int i = 0; i < 10'000; ++i) {
+            long long val = 0;
+            is >> val;
+            assert(is.good());
+            assert(val == static_cast<long long>(gen()));
+        }
+    }
+}
+
+void test_get_floating() {
+    const auto good = ios_base::goodbit;
+    const auto fail = ios_base::failbit;
+    const auto eof  = ios_base::eofbit;
+
+    check_get<double>("1.5 ", 1.5, good, 3);
+    check_get<double>("1.5", 1.5, eof);
+    check_get<double>("-.25x", -0.25, good, 4);
+    check_get<double>("+2. ", 2.0, good, 3);
+    check_get<double>("1e3 ", 1000.0, good, 3);
+    check_get<double>("1.5E+3x", 1500.0, good, 6);
+    check_get<double>("1e ", 0.0, fail);
+    check_get<double>("1e+ ", 0.0, fail);
+    check_get<double>(". ", 0.0, fail);
+    check_get<double>("+-1 ", 0.0, fail);
+    check_get<double>("0.1 ", 0.1, good, 3);
+    check_get<double>("1e400 ", 0.0, fail); // implementation assumption; an overflowing value is replaced by 0
+    check_get<float>("3.4028235e38 ", numeric_limits<float>::max(), good, 12);
+    check_get<float>("0.1f", 0.1f, good, 3);
+
+    istringstream comma_stream("1,5 2.5 ");
+    comma_stream.imbue(locale(locale::classic(), new comma_punct));
+    double val = 0.0;
+    comma_stream >> val;
+    assert(val == 1.5);
+    comma_stream >> val;
+    assert(val == 2.0);
+
+    mt19937_64 gen(42);
+    uniform_real_distribution<double> dist(-1e6, 1e6);
+    string many;
+    for (int i = 0; i < 10'000; ++i) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.17g ", dist(gen));
+        many += buf;
+    }
+
+    for (const size_t chunk : {size_t{5}, size_t{4096}}) {
+        gen.seed(42);
+        dist.reset();
+        chunked_buf buf(many, chunk);
+        istream is(&buf);
+        for (int i = 0; i < 10'000; ++i) {
+            is >> val;
+            assert(is.good());
+            assert(val == dist(gen));
+        }
+    }
+}
+
+template <class T, class Manip>
+string put_to_string(const T val, Manip manip) {
+    ostringstream oss;
+    manip(oss);
+    oss << val;
+    assert(oss.good());
+    return oss.str();
+}
+
+string printf_to_string(const char* const fmt, const int precision, const double val) {
+    char buf[1024];
+    snprintf(buf, sizeof(buf), fmt, precision, val);
+    return buf;
+}
+
+void test_put() {
+    const auto none = [](ostream&) {};
+    assert(put_to_string(0, none) == "0");
+    assert(put_to_string(-123, none) == "-123");
+    assert(put_to_string(numeric_limits<long long>::min(), none) == "-9223372036854775808");
+    assert(put_to_string(numeric_limits<unsigned long long>::max(), none) == "18446744073709551615");
+    assert(put_to_string(255, [](ostream& os) { os << hex; }) == "ff");
+    assert(put_to_string(8, [](ostream& os) { os << oct << showbase; }) == "010");
+    assert(put_to_string(42, [](ostream& os) { os << showpos; }) == "+42");
+    assert(put_to_string(42, [](ostream& os) { os << setw(5); }) == "   42");
+    assert(put_to_string(-42, [](ostream& os) { os << setw(5) << internal << setfill('0'); }) == "-0042");
+    assert(put_to_string(1234567, [](ostream& os) { os.imbue(locale(locale::classic(), new comma_punct)); })
+           == "1234567");
+
+    assert(put_to_string(0.1, none) == "0.1");
+    assert(put_to_string(-0.0, none) == "-0");
+    assert(put_to_string(1e100, none) == "1e+100");
+    assert(put_to_string(1.5, [](ostream& os) { os << showpoint; }) == "1.50000");
+    assert(put_to_string(1e100, [](ostream& os) { os << uppercase; }) == "1E+100");
+    assert(put_to_string(1.5, [](ostream& os) { os << setw(6); }) == "   1.5");
+    assert(put_to_string(1.5, [](ostream& os) { os.imbue(locale(locale::classic(), new comma_punct)); }) == "1,5");
+    assert(put_to_string(1.5L, none) == "1.5");
+
+    mt19937_64 gen(1234);
+    for (int i = 0; i < 10'000; ++i) {
+        double val;
+        do {
+            const auto bits = gen();
+            static_assert(sizeof(bits) == sizeof(val), "unexpected double size");
+            memcpy(&val, &bits, sizeof(val));
+        } while (!isfinite(val));
+
+        const int precision = static_cast<int>(gen() % 20);
+        const auto with     = [precision](ios_base& (*fmt)(ios_base&)) {
+            return [precision, fmt](ostream& os) { os << fmt << setprecision(precision); };
+        };
+        assert(put_to_string(val, with(defaultfloat)) == printf_to_string("%.*g", precision, val));
+        assert(put_to_string(val, with(scientific)) == printf_to_string("%.*e", precision, val));
+        if (fabs(val) < 1e30) {
+            assert(put_to_string(val, with(fixed)) == printf_to_string("%.*f", precision, val));
+        }
+    }
+
+    // a stream buffer that runs out of room makes the stream bad
+    limited_buf small(3);
+    ostream os(&small);
+    os << 12;
+    assert(os.good());
+    os << 345;
+    assert(os.bad());
+    assert(small.written == "123");
+    os.clear();
+    os << 6.5;
+    assert(os.bad());
+}
+
+template <class T>
+void check_put_integer(const T val, const char* const length) {
+    // each integral do_put() overload must agree with the sprintf-based path for the flags that the fast path takes
+    // and for the ones that it leaves alone
+    const auto expected = [&](const char* const flags, const char conversion) {
+        char fmt[16];
+        snprintf(fmt, sizeof(fmt), "%%%s%s%c", flags, length, conversion);
+        char buf[64];
+        snprintf(buf, sizeof(buf), fmt, val);
+        return string(buf);
+    };
+
+    const char conversion = is_signed_v<T> ? 'd' : 'u';
+    assert(put_to_string(val, [](ostream&) {}) == expected("", conversion));
+    assert(put_to_string(val, [](ostream& os) { os << showpos; }) == expected("+", conversion));
+    assert(put_to_string(val, [](ostream& os) { os << setw(24); }) == expected("24", conversion));
+    assert(put_to_string(val, [](ostream& os) { os << hex; }) == expected("", 'x'));
+}
+
+void test_put_all_overloads() {
+    check_put_integer(-1234567890L, "l");
+    check_put_integer(4000000000UL, "l");
+    check_put_integer(numeric_limits<long long>::min(), "ll");
+    check_put_integer(-1234567890123LL, "ll");
+    check_put_integer(numeric_limits<unsigned long long>::max(), "ll");
+    check_put_integer(1234567890123ULL, "ll");
+
+    for (const long double val : {1.5L, -0.1L, 1e100L, 123456.789L}) {
+        const auto expected = [val](const char* const fmt, const int precision) {
+            char buf[1024];
+            snprintf(buf, sizeof(buf), fmt, precision, val);
+            return string(buf);
+        };
+
+        assert(put_to_string(val, [](ostream&) {}) == expected("%.*Lg", 6));
+        assert(put_to_string(val, [](ostream& os) { os << showpos; }) == expected("%+.*Lg", 6));
+        assert(put_to_string(val, [](ostream& os) { os << setw(24); }) == expected("%24.*Lg", 6));
+        assert(put_to_string(val, [](ostream& os) { os << hex; }) == expected("%.*Lg", 6));
+        assert(put_to_string(val, [](ostream& os) { os << hexfloat; }) == expected("%.*La", -1));
+        assert(put_to_string(val, [](ostream& os) { os << fixed << setprecision(3); }) == expected("%.*Lf", 3));
+        assert(put_to_string(val, [](ostream& os) { os << scientific << setprecision(9); }) == expected("%.*Le", 9));
+    }
+}
+
+int main() {
+    test_get_integers();
+    test_get_floating();
+    test_put();
+    test_put_all_overloads();
+}
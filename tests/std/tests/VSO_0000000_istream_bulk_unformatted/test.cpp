@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+using namespace std;
+
+// The unformatted input functions scan the read buffer of the stream buffer at once; these stream buffers exercise
+// read buffers that end in every possible place, and no read buffer at all.
+class chunked_buf : public streambuf {
+public:
+    chunked_buf(const string& str, const size_t chunk) : data(str), chunk_size(chunk) {}
+
+protected:
+    int_type underflow() override {
+        if (gptr() != nullptr && gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        if (pos == data.size()) {
+            return traits_type::eof();
+        }
+
+        if (chunk_size == 0) { // unbuffered
+            return traits_type::to_int_type(data[pos]);
+        }
+
+        const size_t count = data.size() - pos < chunk_size ? data.size() - pos : chunk_size;
+        char* const first  = &data[pos];
+        pos += count;
+        setg(first, first, first + count);
+        return traits_type::to_int_type(*first);
+    }
+
+    int_type uflow() override {
+        if (chunk_size != 0) {
+            return streambuf::uflow();
+        }
+
+        if (pos == data.size()) {
+            return traits_type::eof();
+        }
+
+        return traits_type::to_int_type(data[pos++]);
+    }
+
+private:
+    string data;
+    size_t chunk_size;
+    size_t pos = 0;
+};
+
+string rest_of(istream& is) {
+    is.clear();
+    string result;
+    for (int ch; (ch = is.rdbuf()->sbumpc()) != char_traits<char>::eof();) {
+        result.push_back(static_cast<char>(ch));
+    }
+
+    return result;
+}
+
+const string text = "first line\nsecond\n\nthird line, which is longer than the others\nno newline";
+
+void test_std_getline(istream& is) {
+    string line;
+    assert(getline(is, line) && line == "first line");
+    assert(getline(is, line) && line == "second");
+    assert(getline(is, line) && line.empty());
+    assert(getline(is, line) && line == "third line, which is longer than the others");
+    assert(getline(is, line) && line == "no newline");
+    assert(is.eof() && !is.fail());
+    assert(!getline(is, line));
+
+    is.clear();
+}
+
+void test_member_getline(istream& is) {
+    char buf[12];
+    assert(is.getline(buf, sizeof(buf)) && string(buf) == "first line");
+    assert(is.gcount() == 11); // the delimiter counts
+    assert(is.getline(buf, sizeof(buf)) && string(buf) == "second");
+    assert(is.getline(buf, sizeof(buf)) && string(buf).empty());
+    assert(is.gcount() == 1);
+
+    // 11 characters fit; the twelfth is not a delimiter, so the extraction fails
+    assert(!is.getline(buf, sizeof(buf)));
+    assert(string(buf) == "third line,");
+    assert(is.gcount() == 11);
+    assert(rest_of(is) == " which is longer than the others\nno newline");
+}
+
+void test_member_getline_exact_fit(istream& is) {
+    // "first line" has 10 characters; with room for exactly 10 the delimiter is still consumed
+    char buf[11];
+    assert(is.getline(buf, sizeof(buf)) && string(buf) == "first line");
+    assert(is.gcount() == 11);
+    assert(rest_of(is) == text.substr(11));
+}
+
+void test_member_getline_eof(istream& is) {
+    char buf[200];
+    assert(is.getline(buf, sizeof(buf), '!'));
+    assert(is.eof());
+    assert(string(buf) == text);
+    assert(is.gcount() == static_cast<streamsize>(text.size()));
+}
+
+void test_member_get(istream& is) {
+    char buf[8];
+    assert(is.get(buf, sizeof(buf)) && string(buf) == "first l");
+    assert(is.gcount() == 7);
+    assert(is.get(buf, sizeof(buf)) && string(buf) == "ine");
+    assert(is.gcount() == 3);
+    assert(is.peek() == '\n'); // the delimiter is left in the stream
+    assert(!is.get(buf, sizeof(buf)));
+    assert(string(buf).empty());
+    assert(rest_of(is) == text.substr(10));
+}
+
+void test_ignore(istream& is) {
+    assert(is.ignore(3));
+    assert(is.gcount() == 3);
+    assert(is.ignore(100, '\n'));
+    assert(is.gcount() == 8);
+    assert(is.get() == 's');
+    assert(is.ignore(2, '\n'));
+    assert(is.gcount() == 2);
+    assert(is.ignore(numeric_limits<streamsize>::max(), '\n'));
+    assert(is.gcount() == 4);
+    assert(is.ignore(numeric_limits<streamsize>::max(), ','));
+    assert(is.gcount() == 12);
+    assert(is.get() == ' ');
+
+    // a delimiter that no character converts to never stops ignore
+    assert(is.ignore(numeric_limits<streamsize>::max(), -56));
+    assert(is.eof());
+    assert(is.gcount() == static_cast<streamsize>(text.size() - 31));
+}
+
+void test_ignore_high_delimiter() {
+    // the delimiter is compared as an int_type, so characters with the high bit set are found by their int_type value
+    const string str = "ab\xC8"
+                       "cd";
+    for (size_t chunk = 0; chunk < 4; ++chunk) {
+        chunked_buf buf(str, chunk);
+        istream is(&buf);
+        assert(is.ignore(100, char_traits<char>::to_int_type('\xC8')));
+        assert(is.gcount() == 3);
+        assert(rest_of(is) == "cd");
+    }
+}
+
+template <class Test>
+void run_everywhere(Test test) {
+    {
+        istringstream is(text);
+        test(is);
+    }
+
+    for (size_t chunk = 0; chunk < 16; ++chunk) {
+        chunked_buf buf(text, chunk);
+        istream is(&buf);
+        test(is);
+    }
+}
+
+void test_wide() {
+    wistringstream is(L"alpha\nbeta\n");
+    wstring line;
+    assert(getline(is, line) && line == L"alpha");
+    wchar_t buf[8];
+    assert(is.getline(buf, 8) && wstring(buf) == L"beta");
+    assert(!getline(is, line) && is.eof());
+}
+
+void test_long_lines() {
+    string big;
+    for (int i = 0; i < 1000; ++i) {
+        big += string(static_cast<size_t>(i), 'x');
+        big += '\n';
+    }
+
+    for (size_t chunk = 1; chunk < 4096; chunk *= 7) {
+        chunked_buf buf(big, chunk);
+        istream is(&buf);
+        string line;
+        for (size_t i = 0; i < 1000; ++i) {
+            assert(getline(is, line));
+            assert(line == string(i, 'x'));
+        }
+
+        assert(!getline(is, line) && is.eof());
+    }
+}
+
+int main() {
+    run_everywhere(test_std_getline);
+    run_everywhere(test_member_getline);
+    run_everywhere(test_member_getline_exact_fit);
+    run_everywhere(test_member_getline_eof);
+    run_everywhere(test_member_get);
+    run_everywhere(test_ignore);
+    test_ignore_high_delimiter();
+    test_wide();
+    test_long_lines();
+}
@@ -0,0 +1,238 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <locale>
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// views::istream parses numbers and strings straight from the read buffer of the stream buffer; these stream buffers
+// exercise read buffers that end in every possible place, and no read buffer at all.
+class chunked_buf : public streambuf {
+public:
+    chunked_buf(const string& str, const size_t chunk) : data(str), chunk_size(chunk) {}
+
+protected:
+    int_type underflow() override {
+        if (gptr() != nullptr && gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        if (pos == data.size()) {
+            return traits_type::eof();
+        }
+
+        if (chunk_size == 0) { // unbuffered
+            return traits_type::to_int_type(data[pos]);
+        }
+
+        const size_t count = data.size() - pos < chunk_size ? data.size() - pos : chunk_size;
+        char* const first  = &data[pos];
+        pos += count;
+        setg(first, first, first + count);
+        return traits_type::to_int_type(*first);
+    }
+
+    int_type uflow() override {
+        if (chunk_size != 0) {
+            return streambuf::uflow();
+        }
+
+        if (pos == data.size()) {
+            return traits_type::eof();
+        }
+
+        return traits_type::to_int_type(data[pos++]);
+    }
+
+private:
+    string data;
+    size_t chunk_size;
+    size_t pos = 0;
+};
+
+string rest_of(istream& is) {
+    is.clear();
+    string rest;
+    for (int meta = is.rdbuf()->sbumpc(); meta != char_traits<char>::eof(); meta = is.rdbuf()->sbumpc()) {
+        rest.push_back(static_cast<char>(meta));
+    }
+
+    return rest;
+}
+
+template <class T>
+struct extraction {
+    vector<T> values;
+    T last_value{};
+    ios_base::iostate state;
+    string rest;
+
+    bool operator==(const extraction&) const = default;
+};
+
+template <class T>
+extraction<T> extract_with_view(const string& str, const size_t chunk, const ios_base::fmtflags flags) {
+    chunked_buf buf(str, chunk);
+    istream is(&buf);
+    is.flags(flags);
+    extraction<T> result;
+    auto view = views::istream<T>(is);
+    auto it   = view.begin();
+    for (; it != default_sentinel; ++it) {
+        result.values.push_back(*it);
+    }
+
+    result.last_value = *it;
+    result.state      = is.rdstate();
+    result.rest       = rest_of(is);
+    return result;
+}
+
+template <class T>
+extraction<T> extract_with_operator(const string& str, const size_t chunk, const ios_base::fmtflags flags) {
+    chunked_buf buf(str, chunk);
+    istream is(&buf);
+    is.flags(flags);
+    extraction<T> result;
+    T val{};
+    while (is >> val) {
+        result.values.push_back(val);
+    }
+
+    result.last_value = val;
+    result.state      = is.rdstate();
+    result.rest       = rest_of(is);
+    return result;
+}
+
+template <class T>
+void test_input(const string& str, const ios_base::fmtflags flags = ios_base::skipws | ios_base::dec) {
+    for (const size_t chunk : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{5}, size_t{8}, size_t{64}}) {
+        assert(extract_with_view<T>(str, chunk, flags) == extract_with_operator<T>(str, chunk, flags));
+    }
+}
+
+template <class T>
+void test_all_inputs() {
+    static const char* const inputs[] = {"", "   ", "0", "1 2 3", "  \t\n17\v\f\r-42  ", "+5 -6 +-7", "--8", "12abc 3",
+        "1.5 .25 -0.75 2.", "1e3 2E-2 3e+ 4e", "0x1A 017", "99999999999999999999 1", "70000 -70000 1",
+        "4294967296 -1", "1e400 1e-400 5", "inf nan 1", "3.14159265358979323846264338327950288 2",
+        "meow purr\thiss\n", "a", "  trailing   ", "0000000000000000000000000000000000000000012 1"};
+
+    for (const char* const input : inputs) {
+        test_input<T>(input);
+        test_input<T>(input, ios_base::skipws | ios_base::hex);
+        test_input<T>(input, ios_base::skipws);
+        test_input<T>(input, ios_base::dec);
+    }
+}
+
+void test_long_tokens() {
+    string input;
+    for (int i = 0; i < 1000; ++i) {
+        input += to_string(i * 7919);
+        input += i % 3 == 0 ? "\n" : " ";
+        input += string(static_cast<size_t>(i % 50), 'x');
+        input += ' ';
+    }
+
+    test_input<string>(input);
+    test_input<int>(input);
+
+    chunked_buf buf(input, 100);
+    istream is(&buf);
+    size_t count = 0;
+    for (const string& token : views::istream<string>(is)) {
+        assert(!token.empty());
+        ++count;
+    }
+
+    assert(count == 1000 + 980);
+}
+
+void test_locale_fallback() {
+    // a decimal comma comes from the locale, not from the read buffer
+    struct comma_punct : numpunct<char> {
+        char do_decimal_point() const override {
+            return ',';
+        }
+    };
+
+    istringstream is("1,5 2,25");
+    is.imbue(locale(locale::classic(), new comma_punct));
+    vector<double> values;
+    for (const double val : views::istream<double>(is)) {
+        values.push_back(val);
+    }
+
+    assert((values == vector<double>{1.5, 2.25}));
+}
+
+void test_tie_flushed() {
+    struct sync_counter : stringbuf {
+        int syncs = 0;
+
+        int sync() override {
+            ++syncs;
+            return 0;
+        }
+    };
+
+    sync_counter counter;
+    ostream os(&counter);
+    istringstream is("10 20");
+    is.tie(&os);
+    int expected_syncs = 0;
+    for (const int val : views::istream<int>(is)) {
+        ++expected_syncs;
+        assert(val == expected_syncs * 10);
+        assert(counter.syncs >= expected_syncs);
+    }
+}
+
+void test_exceptions() {
+    istringstream is("1 2");
+    is.exceptions(ios_base::failbit);
+    int sum = 0;
+    try {
+        for (const int val : views::istream<int>(is)) {
+            sum += val;
+        }
+
+        assert(false);
+    } catch (const ios_base::failure&) {
+        assert(is.eof() && is.fail());
+    }
+
+    assert(sum == 3);
+}
+
+int main() {
+    test_all_inputs<short>();
+    test_all_inputs<unsigned short>();
+    test_all_inputs<int>();
+    test_all_inputs<unsigned int>();
+    test_all_inputs<long>();
+    test_all_inputs<unsigned long long>();
+    test_all_inputs<float>();
+    test_all_inputs<double>();
+    test_all_inputs<long double>();
+    test_all_inputs<string>();
+    test_all_inputs<char>();
+    test_all_inputs<bool>();
+
+    test_long_tokens();
+    test_locale_fallback();
+    test_tie_flushed();
+    test_exceptions();
+}
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// sizes around the insertion sort runs and the point where sorting goes through a buffer of node pointers
+constexpr size_t sizes[] = {0, 1, 2, 3, 31, 32, 33, 127, 128, 129, 1000, 4097, 100'000};
+
+struct first_less {
+    bool operator()(const pair<int, int>& left, const pair<int, int>& right) const {
+        return left.first < right.first;
+    }
+};
+
+int comparisons_before_throw = -1;
+
+struct throwing_less {
+    bool operator()(const pair<int, int>& left, const pair<int, int>& right) const {
+        if (comparisons_before_throw >= 0 && comparisons_before_throw-- == 0) {
+            throw runtime_error("compare");
+        }
+
+        return left.first < right.first;
+    }
+};
+
+vector<pair<int, int>> make_input(const size_t size, mt19937& gen) {
+    // few distinct keys, and the second member records the original position to check stability
+    uniform_int_distribution<int> keys(0, static_cast<int>(size / 3));
+    vector<pair<int, int>> result;
+    for (size_t idx = 0; idx < size; ++idx) {
+        result.emplace_back(keys(gen), static_cast<int>(idx));
+    }
+
+    return result;
+}
+
+template <class List>
+void assert_list_consistent(const List& l) {
+    assert(static_cast<size_t>(distance(l.begin(), l.end())) == l.size());
+    assert(static_cast<size_t>(distance(l.rbegin(), l.rend())) == l.size());
+}
+
+template <class T>
+void assert_list_consistent(const forward_list<T>&) {} // forward_list has no size() and no backward links to check
+
+void test_list(mt19937& gen) {
+    for (const auto size : sizes) {
+        auto expected = make_input(size, gen);
+        list<pair<int, int>> l(expected.begin(), expected.end());
+        vector<list<pair<int, int>>::iterator> iterators;
+        for (auto it = l.begin(); it != l.end(); ++it) {
+            iterators.push_back(it);
+        }
+
+        l.sort(first_less{});
+        stable_sort(expected.begin(), expected.end(), first_less{});
+        assert(equal(l.begin(), l.end(), expected.begin(), expected.end()));
+        assert(equal(l.rbegin(), l.rend(), expected.rbegin(), expected.rend()));
+        assert_list_consistent(l);
+
+        // sorting relinks the nodes, so iterators still refer to the same elements
+        for (size_t idx = 0; idx < iterators.size(); ++idx) {
+            assert(iterators[idx]->second == static_cast<int>(idx));
+        }
+
+        l.reverse();
+        l.sort(greater<>{});
+        assert(is_sorted(l.begin(), l.end(), greater<>{}));
+        assert_list_consistent(l);
+    }
+
+    list<int> ints{3, 1, 4, 1, 5, 9, 2, 6};
+    ints.sort();
+    assert((ints == list<int>{1, 1, 2, 3, 4, 5, 6, 9}));
+}
+
+void test_forward_list(mt19937& gen) {
+    for (const auto size : sizes) {
+        auto expected = make_input(size, gen);
+        forward_list<pair<int, int>> l(expected.begin(), expected.end());
+        l.sort(first_less{});
+        stable_sort(expected.begin(), expected.end(), first_less{});
+        assert(equal(l.begin(), l.end(), expected.begin(), expected.end()));
+
+        l.sort(greater<>{});
+        assert(is_sorted(l.begin(), l.end(), greater<>{}));
+        assert(static_cast<size_t>(distance(l.begin(), l.end())) == size);
+    }
+
+    forward_list<int> ints{3, 1, 4, 1, 5, 9, 2, 6};
+    ints.sort();
+    assert((ints == forward_list<int>{1, 1, 2, 3, 4, 5, 6, 9}));
+}
+
+template <class List>
+void test_throwing_comparator(mt19937& gen) {
+    // if the comparison throws, every element is still in the container (in an unspecified order) and it stays usable
+    for (const auto size : sizes) {
+        if (size < 2) {
+            continue;
+        }
+
+        for (int attempt = 0; attempt < 5; ++attempt) {
+            auto input = make_input(size, gen);
+            List l(input.begin(), input.end());
+            comparisons_before_throw = static_cast<int>(gen() % (2 * size));
+            try {
+                l.sort(throwing_less{});
+            } catch (const runtime_error&) {
+            }
+
+            comparisons_before_throw = -1;
+            assert_list_consistent(l);
+            vector<pair<int, int>> contents(l.begin(), l.end());
+            assert(contents.size() == size);
+            sort(input.begin(), input.end());
+            sort(contents.begin(), contents.end());
+            assert(contents == input);
+
+            l.sort(first_less{});
+            assert(is_sorted(l.begin(), l.end(), first_less{}));
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    test_list(gen);
+    test_forward_list(gen);
+    test_throwing_comparator<list<pair<int, int>>>(gen);
+    test_throwing_comparator<forward_list<pair<int, int>>>(gen);
+}
@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+int live_objects = 0;
+
+struct base {
+    base() {
+        ++live_objects;
+    }
+
+    base(const base&) = delete;
+    base& operator=(const base&) = delete;
+
+    virtual ~base() {
+        --live_objects;
+    }
+};
+
+struct derived : base {
+    explicit derived(int v) : value(v) {}
+
+    int value;
+};
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    explicit counting_allocator(int* allocations_) noexcept : allocations(allocations_) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : allocations(other.allocations) {}
+
+    T* allocate(const size_t n) {
+        ++*allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --*allocations;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept {
+        return allocations == other.allocations;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>& other) const noexcept {
+        return allocations != other.allocations;
+    }
+
+    int* allocations;
+};
+
+struct counting_deleter {
+    int* calls;
+
+    void operator()(base* const p) const {
+        ++*calls;
+        delete p;
+    }
+};
+
+void test_basics() {
+    stdext::local_shared_ptr<base> empty;
+    assert(!empty);
+    assert(empty.use_count() == 0);
+    assert(empty == nullptr);
+
+    {
+        stdext::local_shared_ptr<derived> p(new derived(5));
+        assert(live_objects == 1);
+        assert(p.use_count() == 1);
+        assert(p->value == 5);
+        assert((*p).value == 5);
+
+        auto copy = p;
+        assert(p.use_count() == 2);
+        assert(copy == p);
+
+        stdext::local_shared_ptr<base> converted = copy;
+        assert(p.use_count() == 3);
+        assert(converted.get() == p.get());
+
+        stdext::local_shared_ptr<base> moved = move(converted);
+        assert(!converted);
+        assert(p.use_count() == 3);
+
+        moved.reset();
+        copy = nullptr;
+        assert(p.use_count() == 1);
+        assert(live_objects == 1);
+    }
+
+    assert(live_objects == 0);
+}
+
+void test_make_local_shared() {
+    {
+        auto p = stdext::make_local_shared<derived>(42);
+        assert(live_objects == 1);
+        assert(p->value == 42);
+
+        vector<stdext::local_shared_ptr<derived>> copies(100, p);
+        assert(p.use_count() == 101);
+        copies.clear();
+        assert(p.use_count() == 1);
+
+        const auto s = stdext::make_local_shared<string>(3, 'x');
+        assert(*s == "xxx");
+    }
+
+    assert(live_objects == 0);
+}
+
+void test_allocate_local_shared() {
+    int allocations = 0;
+    {
+        const counting_allocator<int> al{&allocations};
+        auto p = stdext::allocate_local_shared<derived>(al, 7);
+        assert(allocations == 1); // the object and its control block share one allocation
+        assert(p->value == 7);
+
+        stdext::local_weak_ptr<derived> w = p;
+        p.reset();
+        assert(live_objects == 0);
+        assert(allocations == 1); // kept by w
+        assert(w.expired());
+    }
+
+    assert(allocations == 0);
+}
+
+void test_deleters() {
+    int calls = 0;
+    {
+        stdext::local_shared_ptr<base> p(new derived(1), counting_deleter{&calls});
+        auto copy = p;
+        assert(stdext::get_deleter<counting_deleter>(p) != nullptr);
+        assert(stdext::get_deleter<default_delete<base>>(p) == nullptr);
+    }
+
+    assert(calls == 1);
+
+    int allocations = 0;
+    {
+        const counting_allocator<int> al{&allocations};
+        stdext::local_shared_ptr<base> p(new derived(2), counting_deleter{&calls}, al);
+        assert(allocations == 1);
+    }
+
+    assert(calls == 2);
+    assert(allocations == 0);
+
+    {
+        unique_ptr<derived> u(new derived(3));
+        stdext::local_shared_ptr<base> p(move(u));
+        assert(!u);
+        assert(live_objects == 1);
+        p = unique_ptr<derived>(new derived(4));
+        assert(live_objects == 1);
+        assert(static_cast<derived&>(*p).value == 4);
+    }
+
+    assert(live_objects == 0);
+}
+
+void test_weak() {
+    stdext::local_weak_ptr<derived> w;
+    assert(w.expired());
+    assert(!w.lock());
+
+    {
+        auto p = stdext::make_local_shared<derived>(9);
+        w      = p;
+        assert(!w.expired());
+        assert(w.use_count() == 1);
+
+        auto locked = w.lock();
+        assert(locked == p);
+        assert(p.use_count() == 2);
+
+        stdext::local_weak_ptr<base> wb = w;
+        assert(wb.lock().get() == p.get());
+
+        stdext::local_shared_ptr<base> from_weak(wb);
+        assert(p.use_count() == 3);
+        assert(!w.owner_before(p) && !p.owner_before(w));
+    }
+
+    assert(w.expired());
+    assert(!w.lock());
+    assert(live_objects == 0);
+
+    bool threw = false;
+    try {
+        stdext::local_shared_ptr<derived> dead(w);
+    } catch (const bad_weak_ptr&) {
+        threw = true;
+    }
+    assert(threw);
+
+    stdext::local_weak_ptr<base> converted_expired = w;
+    assert(converted_expired.expired());
+}
+
+void test_casts_and_aliasing() {
+    auto d                           = stdext::make_local_shared<derived>(11);
+    stdext::local_shared_ptr<base> b = d;
+
+    const auto back = stdext::static_pointer_cast<derived>(b);
+    assert(back == d);
+    assert(d.use_count() == 3);
+
+    const auto dyn = stdext::dynamic_pointer_cast<derived>(b);
+    assert(dyn == d);
+
+    const auto c = stdext::const_pointer_cast<const derived>(d);
+    assert(c.get() == d.get());
+
+    stdext::local_shared_ptr<int> member(d, &d->value);
+    assert(*member == 11);
+    d.reset();
+    b.reset();
+    assert(live_objects == 1); // kept by the aliases
+
+    const stdext::local_shared_ptr<void> erased = back;
+    assert(erased.get() == back.get());
+}
+
+void test_hash_and_swap() {
+    auto a = stdext::make_local_shared<int>(1);
+    auto b = stdext::make_local_shared<int>(2);
+    assert(hash<stdext::local_shared_ptr<int>>{}(a) == hash<int*>{}(a.get()));
+
+    int* const pa = a.get();
+    swap(a, b);
+    assert(b.get() == pa);
+    assert(*a == 2);
+    assert((a < b) == (a.get() < b.get()));
+    assert(a != b);
+
+    static_assert(stdext::is_trivially_relocatable_v<stdext::local_shared_ptr<int>>, "");
+    static_assert(is_nothrow_move_constructible_v<stdext::local_weak_ptr<int>>, "");
+}
+
+struct node {
+    stdext::local_weak_ptr<node> parent;
+    vector<stdext::local_shared_ptr<node>> children;
+};
+
+void test_tree() {
+    auto root = stdext::make_local_shared<node>();
+    for (int i = 0; i < 10; ++i) {
+        auto child    = stdext::make_local_shared<node>();
+        child->parent = root;
+        for (int j = 0; j < 10; ++j) {
+            auto leaf    = stdext::make_local_shared<node>();
+            leaf->parent = child;
+            child->children.push_back(move(leaf));
+        }
+
+        root->children.push_back(move(child));
+    }
+
+    const auto leaf = root->children[3]->children[4];
+    assert(leaf->parent.lock()->parent.lock() == root);
+    root.reset();
+    assert(leaf->parent.expired());
+}
+
+int main() {
+    test_basics();
+    test_make_local_shared();
+    test_allocate_local_shared();
+    test_deleters();
+    test_weak();
+    test_casts_and_aliasing();
+    test_hash_and_swap();
+    test_tree();
+}
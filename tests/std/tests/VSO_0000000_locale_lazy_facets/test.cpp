@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <clocale>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <string.h>
+#include <typeinfo>
+#include <vector>
+
+#ifndef _M_CEE
+#include <thread>
+#endif // _M_CEE
+
+using namespace std;
+
+string crt_locale_name() {
+    const char* const name = setlocale(LC_ALL, nullptr);
+    assert(name != nullptr);
+    return name;
+}
+
+// Making a lazy facet switches the C locale to the locale of the facet and back; neither the switch nor the switch
+// back may be observable, whether or not the C locale already matches.
+void test_classic_facets_keep_c_locale() {
+    const string before = crt_locale_name();
+    const locale& loc   = locale::classic();
+    assert(use_facet<numpunct<char>>(loc).decimal_point() == '.');
+    assert(use_facet<ctype<wchar_t>>(loc).widen('a') == L'a');
+    assert(use_facet<moneypunct<char>>(loc).frac_digits() >= 0);
+    assert(crt_locale_name() == before);
+
+    ostringstream os;
+    os << 1729 << ' ' << 2.5;
+    assert(os.str() == "1729 2.5");
+    assert(crt_locale_name() == before);
+}
+
+void test_other_c_locale() {
+    // If the environment names a locale other than "C", the "C" facets must still be "C" facets made afresh,
+    // and the C locale of the program must be restored afterwards.
+    const char* const user = setlocale(LC_ALL, "");
+    if (user == nullptr) {
+        return;
+    }
+
+    const string user_name = user;
+    const locale loc("C");
+    assert(use_facet<numpunct<wchar_t>>(loc).decimal_point() == L'.');
+    assert(use_facet<collate<char>>(loc).compare("a", "a" + 1, "b", "b" + 1) < 0);
+    assert(crt_locale_name() == user_name);
+
+    setlocale(LC_ALL, "C");
+    assert(strcmp(setlocale(LC_ALL, nullptr), "C") == 0);
+}
+
+struct comma_numpunct : numpunct<char> {
+protected:
+    char do_decimal_point() const override {
+        return ',';
+    }
+};
+
+struct custom_facet : locale::facet {
+    static locale::id id;
+};
+
+locale::id custom_facet::id;
+
+string format(const locale& loc, const double val) {
+    ostringstream os;
+    os.imbue(loc);
+    os << val;
+    return os.str();
+}
+
+// use_facet skips the locale lock once a facet is known; the answers must not change from the locked lookup
+void test_use_facet_after_first_lookup() {
+    const locale comma(locale::classic(), new comma_numpunct);
+    for (int i = 0; i < 3; ++i) {
+        assert(format(locale::classic(), 2.5) == "2.5");
+        assert(format(comma, 2.5) == "2,5");
+    }
+
+    // a stream that is imbued again uses the facets of its new locale immediately
+    ostringstream os;
+    os << 1.5 << ' ';
+    os.imbue(comma);
+    os << 1.5 << ' ';
+    os.imbue(locale::classic());
+    os << 1.5;
+    assert(os.str() == "1.5 1,5 1.5");
+
+    const locale with_custom(locale::classic(), new custom_facet);
+    const custom_facet& fac = use_facet<custom_facet>(with_custom);
+    assert(&use_facet<custom_facet>(with_custom) == &fac);
+    assert(has_facet<custom_facet>(with_custom));
+    assert(!has_facet<custom_facet>(locale::classic()));
+
+    // a facet that can't be made lazily is still reported as missing from locales that lack it
+    bool threw = false;
+    try {
+        (void) use_facet<custom_facet>(locale::classic());
+    } catch (const bad_cast&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test_transparent_locale_follows_global() {
+    // a transparent locale looks up facets in the global locale, which can change between lookups
+    const locale transparent = locale::empty();
+    assert(use_facet<numpunct<char>>(transparent).decimal_point() == '.');
+
+    const locale old = locale::global(locale(locale::classic(), new comma_numpunct));
+    assert(use_facet<numpunct<char>>(transparent).decimal_point() == ',');
+
+    locale::global(old);
+    assert(use_facet<numpunct<char>>(transparent).decimal_point() == '.');
+}
+
+#ifndef _M_CEE
+void test_threads() {
+    const locale comma(locale::classic(), new comma_numpunct);
+    vector<thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&comma, t] {
+            for (int i = 0; i < 1000; ++i) {
+                const bool use_comma = (i + t) % 2 == 0;
+                assert(format(use_comma ? comma : locale::classic(), 0.5) == (use_comma ? "0,5" : "0.5"));
+                assert(use_facet<ctype<wchar_t>>(locale()).widen('x') == L'x');
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+#endif // _M_CEE
+
+int main() {
+    test_classic_facets_keep_c_locale();
+    test_other_c_locale();
+    test_classic_facets_keep_c_locale();
+    test_use_facet_after_first_lookup();
+    test_transparent_locale_follows_global();
+#ifndef _M_CEE
+    test_threads();
+#endif // _M_CEE
+}
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _M_CEE
+#include <thread>
+#endif // _M_CEE
+
+using namespace std;
+
+const numpunct<char>* numpunct_of(const locale& loc) {
+    return &use_facet<numpunct<char>>(loc);
+}
+
+string format(const locale& loc, const double val) {
+    ostringstream os;
+    os.imbue(loc);
+    os << val;
+    return os.str();
+}
+
+bool make_throws(const char* const name) {
+    try {
+        (void) locale(name);
+    } catch (const runtime_error&) {
+        return true;
+    }
+
+    return false;
+}
+
+void test_same_name_shares_facets() {
+    const numpunct<char>* first = nullptr;
+    {
+        const locale loc("C");
+        first = numpunct_of(loc);
+        assert(loc.name() == "C");
+        assert(format(loc, 2.5) == "2.5");
+    }
+
+    // the facets of a cached locale outlive the locales made from it
+    assert(first->decimal_point() == '.');
+
+    const locale again("C");
+    const locale from_string(string("C"));
+    assert(again == from_string);
+#ifndef _M_CEE
+    assert(numpunct_of(again) == first);
+    assert(numpunct_of(from_string) == first);
+#endif // _M_CEE
+
+    // locales of named categories, or made from other locales, are built as before
+    const locale numeric_only("C", locale::numeric);
+    assert(numpunct_of(numeric_only) != first);
+    assert(numeric_only.name() == "C");
+
+    const locale replaced(locale::classic(), "C", locale::all);
+    assert(numpunct_of(replaced) != first);
+    assert(replaced.name() == "C");
+    assert(format(replaced, 0.5) == "0.5");
+}
+
+void test_other_names() {
+    try {
+        const locale us("en-US");
+        const locale us_again("en-US");
+        assert(us.name() == "en-US");
+        assert(use_facet<numpunct<char>>(us).thousands_sep() == ',');
+#ifndef _M_CEE
+        assert(numpunct_of(us) == numpunct_of(us_again));
+#endif // _M_CEE
+        assert(numpunct_of(us) != numpunct_of(locale("C")));
+    } catch (const runtime_error&) {
+        // the locale isn't installed
+    }
+
+    assert(make_throws("not a locale name"));
+    assert(make_throws("not a locale name"));
+    assert(make_throws(nullptr));
+}
+
+void test_global() {
+    const locale old = locale::global(locale("C"));
+    assert(locale().name() == "C");
+    assert(format(locale(), 1.5) == "1.5");
+    locale::global(old);
+    assert(format(locale("C"), 1.5) == "1.5");
+}
+
+#ifndef _M_CEE
+void test_threads() {
+    vector<thread> threads;
+    vector<const numpunct<char>*> found(4);
+    for (size_t t = 0; t < found.size(); ++t) {
+        threads.emplace_back([&found, t] {
+            for (int i = 0; i < 1000; ++i) {
+                const locale loc("C");
+                assert(format(loc, 0.25) == "0.25");
+                found[t] = numpunct_of(loc);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    for (const auto ptr : found) {
+        assert(ptr == numpunct_of(locale("C")));
+    }
+}
+#endif // _M_CEE
+
+int main() {
+    test_same_name_shares_facets();
+    test_other_names();
+    test_global();
+#ifndef _M_CEE
+    test_threads();
+#endif // _M_CEE
+}
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <string>
+#include <utility>
+
+#if _HAS_CXX17
+#include <string_view>
+#endif // _HAS_CXX17
+
+#if _HAS_CXX20
+#include <span>
+#endif // _HAS_CXX20
+
+using namespace std;
+
+const char* const file_name  = "mapped_file.dat";
+const char* const empty_name = "mapped_file_empty.dat";
+
+string write_file() {
+    string contents;
+    for (int i = 0; i < 10'000; ++i) {
+        contents += to_string(i) + ' ' + to_string(i / 4) + ".25\n";
+    }
+
+    ofstream out(file_name, ios::binary);
+    out << contents;
+    return contents;
+}
+
+void test_mapped_file(const string& contents) {
+    stdext::mapped_file file(file_name);
+    assert(file.is_open());
+    assert(file.size() == contents.size());
+    assert(memcmp(file.data(), contents.data(), contents.size()) == 0);
+    assert(!file.open(file_name)); // already open
+
+#if _HAS_CXX17
+    assert(file.view() == contents);
+#endif // _HAS_CXX17
+
+#if defined(__cpp_lib_span) && _HAS_STD_BYTE
+    const auto bytes = file.bytes();
+    assert(bytes.size() == contents.size());
+    assert(static_cast<const void*>(bytes.data()) == file.data());
+#endif // defined(__cpp_lib_span) && _HAS_STD_BYTE
+
+    stdext::mapped_file moved(move(file));
+    assert(!file.is_open() && file.data() == nullptr && file.size() == 0);
+    assert(moved.is_open() && moved.size() == contents.size());
+    swap(file, moved);
+    assert(file.is_open() && !moved.is_open());
+    file.close();
+    assert(!file.is_open());
+
+    assert(file.open(string(file_name)));
+    assert(file.size() == contents.size());
+    file = stdext::mapped_file(L"mapped_file.dat");
+    assert(file.is_open() && file.size() == contents.size());
+
+    {
+        ofstream out(empty_name);
+    }
+
+    stdext::mapped_file empty(empty_name);
+    assert(empty.is_open() && empty.empty() && empty.data() == nullptr);
+
+    stdext::mapped_file missing("mapped_file_missing.dat");
+    assert(!missing.is_open());
+}
+
+void test_mmapbuf(const string& contents) {
+    stdext::mmapbuf buf;
+    assert(!buf.is_open());
+    assert(buf.open(file_name));
+    assert(!buf.open(file_name));
+    assert(buf.file().size() == contents.size());
+    assert(buf.in_avail() == static_cast<streamsize>(contents.size()));
+
+    istream is(&buf);
+    for (int i = 0; i < 10'000; ++i) {
+        int ival    = -1;
+        double dval = -1.0;
+        is >> ival >> dval;
+        assert(is.good());
+        assert(ival == i);
+        assert(dval == i / 4 + 0.25);
+    }
+
+    int ival = 0;
+    is >> ival;
+    assert(is.fail() && is.eof());
+    assert(buf.in_avail() == -1);
+
+    is.clear();
+    assert(is.seekg(0).tellg() == 0);
+    string line;
+    getline(is, line);
+    assert(line == "0 0.25");
+    assert(is.tellg() == static_cast<streamoff>(line.size() + 1));
+    assert(is.seekg(-1, ios::end).tellg() == static_cast<streamoff>(contents.size() - 1));
+    assert(is.get() == '\n');
+    is.seekg(1, ios::end);
+    assert(is.fail());
+    is.clear();
+    is.seekg(-2, ios::cur);
+    assert(is.get() == '5');
+    assert(buf.pubseekoff(0, ios::beg, ios::out) == -1);
+
+    // putting back an element that matches moves back over the mapping without writing it
+    assert(buf.sputbackc('5') == '5');
+    assert(buf.sputbackc('x') == EOF);
+
+    stdext::mmapbuf moved(move(buf));
+    assert(!buf.is_open() && buf.sgetc() == EOF);
+    assert(moved.is_open() && moved.sgetc() == '5');
+    assert(moved.close());
+    assert(!moved.close());
+
+    stdext::mmapbuf empty;
+    assert(empty.open(empty_name));
+    assert(empty.sgetc() == EOF);
+
+    stdext::wmmapbuf wide;
+    assert(wide.open(L"mapped_file.dat"));
+    assert(wide.in_avail() == static_cast<streamsize>(contents.size() / sizeof(wchar_t)));
+}
+
+int main() {
+    const string contents = write_file();
+    test_mapped_file(contents);
+    test_mmapbuf(contents);
+    assert(remove(file_name) == 0);
+    assert(remove(empty_name) == 0);
+}
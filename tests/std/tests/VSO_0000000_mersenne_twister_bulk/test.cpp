@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// A small state for which the history array is refilled one element at a time, because some of the values that a
+// block of the recurrence needs would be computed in that same block.
+using small_twister = mersenne_twister_engine<unsigned int, 32, 13, 8, 31, 0x9908b0df, 11, 0xffffffff, 7, 0x9d2c5680,
+    15, 0xefc60000, 18, 1812433253>;
+
+// A word size narrower than the result type
+using narrow_twister = mersenne_twister_engine<unsigned long long, 40, 312, 156, 31, 0xb5026f5aa9ULL, 29,
+    0x5555555555ULL, 17, 0x71d67fffedULL, 37, 0xfff7eee000ULL, 11, 1812433253>;
+
+template <class Engine>
+void test_bulk_matches_calls() {
+    // runs that start and end on both sides of every refill
+    const size_t lengths[] = {0, 1, 7, 8, 9, 100, Engine::state_size - 1, Engine::state_size, Engine::state_size + 1,
+        3 * Engine::state_size + 5};
+    Engine bulk;
+    Engine single;
+    for (const size_t first : lengths) {
+        for (const size_t second : lengths) {
+            vector<typename Engine::result_type> values(first + second);
+            stdext::generate_random(values.begin(), values.begin() + static_cast<ptrdiff_t>(first), bulk);
+            stdext::generate_random(values.begin() + static_cast<ptrdiff_t>(first), values.end(), bulk);
+            for (const auto val : values) {
+                assert(val == single());
+            }
+
+            assert(bulk == single);
+        }
+    }
+}
+
+template <class Engine>
+void test_discard() {
+    const unsigned long long counts[] = {0, 1, 5, Engine::state_size - 1, Engine::state_size, Engine::state_size + 1,
+        10 * Engine::state_size + 3};
+    Engine skipped;
+    Engine single;
+    for (const auto count : counts) {
+        skipped.discard(count);
+        for (unsigned long long i = 0; i < count; ++i) {
+            (void) single();
+        }
+
+        assert(skipped == single);
+        assert(skipped() == single());
+    }
+}
+
+void test_known_values() {
+    // N4868 [rand.predef]/3, /4: the 10000th consecutive invocation of a default-constructed object
+    mt19937 gen32;
+    mt19937_64 gen64;
+    vector<mt19937::result_type> values32(10000);
+    vector<mt19937_64::result_type> values64(10000);
+    stdext::generate_random(values32.begin(), values32.end(), gen32);
+    stdext::generate_random(values64.begin(), values64.end(), gen64);
+    assert(values32.back() == 4123659995u);
+    assert(values64.back() == 9981545732273789042ull);
+
+    mt19937 skip32;
+    mt19937_64 skip64;
+    skip32.discard(9999);
+    skip64.discard(9999);
+    assert(skip32() == 4123659995u);
+    assert(skip64() == 9981545732273789042ull);
+}
+
+void test_other_iterators() {
+    // ranges that aren't contiguous ranges of the result type are filled one call at a time
+    mt19937 bulk;
+    mt19937 single;
+    list<mt19937::result_type> lst(1000);
+    stdext::generate_random(lst.begin(), lst.end(), bulk);
+    for (const auto val : lst) {
+        assert(val == single());
+    }
+
+    vector<unsigned long long> wide(1000);
+    stdext::generate_random(wide.begin(), wide.end(), bulk);
+    for (const auto val : wide) {
+        assert(val == single());
+    }
+
+    unsigned int arr[700];
+    stdext::generate_random(begin(arr), end(arr), bulk);
+    for (const auto val : arr) {
+        assert(val == single());
+    }
+
+    minstd_rand lcg_bulk;
+    minstd_rand lcg_single;
+    vector<minstd_rand::result_type> lcg_values(100);
+    stdext::generate_random(lcg_values.begin(), lcg_values.end(), lcg_bulk);
+    for (const auto val : lcg_values) {
+        assert(val == lcg_single());
+    }
+}
+
+void test_distributions() {
+    mt19937_64 bulk;
+    mt19937_64 single;
+    uniform_real_distribution<double> real_dist(-1.0, 1.0);
+    uniform_int_distribution<int> int_dist(1, 6);
+    normal_distribution<float> normal_dist;
+
+    vector<double> reals(1000);
+    stdext::generate_random(reals.begin(), reals.end(), bulk, real_dist);
+    vector<int> ints(1000);
+    stdext::generate_random(ints.begin(), ints.end(), bulk, int_dist);
+    list<float> normals(1000);
+    stdext::generate_random(normals.begin(), normals.end(), bulk, normal_dist);
+
+    uniform_real_distribution<double> real_ref(-1.0, 1.0);
+    uniform_int_distribution<int> int_ref(1, 6);
+    normal_distribution<float> normal_ref;
+    for (const double val : reals) {
+        assert(val == real_ref(single));
+    }
+
+    for (const int val : ints) {
+        assert(val == int_ref(single));
+    }
+
+    for (const float val : normals) {
+        assert(val == normal_ref(single));
+    }
+
+    assert(bulk == single);
+}
+
+int main() {
+    test_bulk_matches_calls<mt19937>();
+    test_bulk_matches_calls<mt19937_64>();
+    test_bulk_matches_calls<small_twister>();
+    test_bulk_matches_calls<narrow_twister>();
+    test_discard<mt19937>();
+    test_discard<mt19937_64>();
+    test_discard<small_twister>();
+    test_discard<narrow_twister>();
+    test_known_values();
+    test_other_iterators();
+    test_distributions();
+}
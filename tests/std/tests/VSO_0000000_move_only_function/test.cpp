@@ -0,0 +1,275 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+size_t allocations = 0;
+
+void* operator new(size_t size) {
+    ++allocations;
+    void* const p = malloc(size == 0 ? 1 : size);
+    if (!p) {
+        throw bad_alloc{};
+    }
+
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+int live_objects = 0;
+
+struct tracked {
+    tracked() {
+        ++live_objects;
+    }
+
+    tracked(const tracked&) noexcept {
+        ++live_objects;
+    }
+
+    ~tracked() {
+        --live_objects;
+    }
+};
+
+struct big_callable {
+    tracked t;
+    char bytes[256] = {};
+
+    int operator()(int x) const {
+        return x + bytes[0] + 1;
+    }
+};
+
+struct throwing_move {
+    throwing_move() = default;
+    throwing_move(throwing_move&&) noexcept(false) {}
+
+    int operator()() {
+        return 17;
+    }
+};
+
+int add_one(int x) {
+    return x + 1;
+}
+
+int twice(int x) noexcept {
+    return x * 2;
+}
+
+void test_move_only_function() {
+    stdext::move_only_function<int(int)> empty;
+    assert(!empty);
+    assert(empty == nullptr);
+
+    // a lambda capturing a unique_ptr and several pointers is stored inline
+    auto ptr           = make_unique<int>(40);
+    void* others[4]    = {};
+    const size_t start = allocations;
+    stdext::move_only_function<int(int)> f = [p = move(ptr), others](int x) {
+        (void) others;
+        return *p + x;
+    };
+    assert(allocations == start);
+    assert(f);
+    assert(f(2) == 42);
+
+    auto g = move(f);
+    assert(!f);
+    assert(g(3) == 43);
+    assert(allocations == start);
+
+    g = add_one;
+    assert(g(1) == 2);
+
+    int (*null_function)(int) = nullptr;
+    g                         = null_function;
+    assert(!g);
+
+    g = [](int x) { return x - 1; };
+    swap(f, g);
+    assert(f(1) == 0);
+    assert(!g);
+
+    f = nullptr;
+    assert(!f);
+    assert(allocations == start);
+}
+
+void test_storage() {
+    {
+        const size_t start = allocations;
+        stdext::move_only_function<int(int) const> big = big_callable{};
+        assert(allocations == start + 1); // too large for the default buffer
+        assert(big(1) == 2);
+        assert(live_objects == 1);
+
+        auto moved = move(big);
+        assert(allocations == start + 1); // the pointer is moved
+        assert(moved(2) == 3);
+
+        // a larger buffer holds it inline
+        stdext::move_only_function<int(int) const, 512> inline_big = big_callable{};
+        assert(allocations == start + 1);
+        assert(inline_big(0) == 1);
+        assert(live_objects == 2);
+
+        stdext::move_only_function<int(int) const, 512> other = [](int x) { return x; };
+        swap(inline_big, other);
+        assert(other(5) == 6);
+        assert(inline_big(5) == 5);
+        assert(live_objects == 2);
+    }
+
+    assert(live_objects == 0);
+
+    // callables that might throw when moved can't be moved between buffers, so they are allocated
+    const size_t start = allocations;
+    stdext::move_only_function<int()> f{throwing_move{}};
+    assert(allocations == start + 1);
+    assert(f() == 17);
+
+    static_assert(sizeof(stdext::move_only_function<void()>) == 8 * sizeof(void*), "");
+    static_assert(!is_copy_constructible_v<stdext::move_only_function<void()>>, "");
+    static_assert(is_nothrow_move_constructible_v<stdext::move_only_function<void()>>, "");
+}
+
+void test_qualifiers() {
+    struct counter {
+        int count = 0;
+        int operator()() {
+            return ++count;
+        }
+    };
+
+    stdext::move_only_function<int()> mutating = counter{};
+    assert(mutating() == 1);
+    assert(mutating() == 2);
+
+    static_assert(!is_constructible_v<stdext::move_only_function<int() const>, counter>, "");
+    static_assert(is_constructible_v<stdext::move_only_function<int(int) const>, decltype(&add_one)>, "");
+
+#ifdef __cpp_noexcept_function_type
+    stdext::move_only_function<int(int) noexcept> nothrow = twice;
+    static_assert(noexcept(nothrow(1)), "");
+    assert(nothrow(4) == 8);
+    static_assert(!is_constructible_v<stdext::move_only_function<int(int) noexcept>, decltype(&add_one)>, "");
+#endif // __cpp_noexcept_function_type
+
+    stdext::move_only_function<string(string&&, const string&)> concat = [](string&& a, const string& b) {
+        return move(a) + b;
+    };
+    assert(concat("ab", "cd") == "abcd");
+
+    stdext::move_only_function<void(vector<int>&)> push = [](vector<int>& v) { v.push_back(1); };
+    vector<int> v;
+    push(v);
+    assert(v.size() == 1);
+
+    stdext::move_only_function<int(int)> in_place{in_place_type<big_callable>};
+    assert(in_place(0) == 1);
+}
+
+void test_task_queue() {
+    vector<stdext::move_only_function<void()>> queue;
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        queue.emplace_back([&sum, p = make_unique<int>(i)] { sum += *p; });
+    }
+
+    for (auto& task : queue) {
+        task();
+    }
+
+    assert(sum == 4950);
+}
+
+int call_with_five(stdext::function_ref<int(int)> f) {
+    return f(5);
+}
+
+void test_function_ref() {
+    assert(call_with_five(add_one) == 6);
+    assert(call_with_five(&add_one) == 6);
+    assert(call_with_five([](int x) { return x * 3; }) == 15);
+
+    int calls = 0;
+    auto counting = [&calls](int x) {
+        ++calls;
+        return x;
+    };
+    const size_t start = allocations;
+    stdext::function_ref<int(int)> ref = counting;
+    assert(ref(1) == 1);
+    assert(ref(2) == 2);
+    assert(calls == 2);
+    assert(allocations == start);
+
+    // copies refer to the same callable
+    auto copy = ref;
+    (void) copy(3);
+    assert(calls == 3);
+
+    ref = twice;
+    assert(ref(4) == 8);
+
+    stdext::move_only_function<int(int)> owner = [](int x) { return -x; };
+    stdext::function_ref<int(int)> to_owner = owner;
+    assert(to_owner(7) == -7);
+
+    struct const_only {
+        int operator()(int x) const {
+            return x + 100;
+        }
+    };
+    const const_only c{};
+    stdext::function_ref<int(int) const> const_ref = c;
+    assert(const_ref(1) == 101);
+
+    struct non_const_only {
+        int operator()(int x) {
+            return x;
+        }
+    };
+    static_assert(!is_constructible_v<stdext::function_ref<int(int) const>, non_const_only&>, "");
+    static_assert(is_constructible_v<stdext::function_ref<int(int)>, non_const_only&>, "");
+    static_assert(is_trivially_copyable_v<stdext::function_ref<int(int)>>, "");
+
+    stdext::function_ref deduced = add_one;
+    static_assert(is_same_v<decltype(deduced), stdext::function_ref<int(int)>>, "");
+    assert(deduced(0) == 1);
+
+#ifdef __cpp_noexcept_function_type
+    stdext::function_ref<int(int) noexcept> nothrow = twice;
+    static_assert(noexcept(nothrow(1)), "");
+    assert(nothrow(2) == 4);
+    static_assert(!is_constructible_v<stdext::function_ref<int(int) noexcept>, decltype(add_one)&>, "");
+#endif // __cpp_noexcept_function_type
+}
+
+int main() {
+    test_move_only_function();
+    test_storage();
+    test_qualifiers();
+    test_task_queue();
+    test_function_ref();
+}
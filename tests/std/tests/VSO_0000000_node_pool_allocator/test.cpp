@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+using pool_alloc = stdext::node_pool_allocator<T>;
+
+struct big {
+    char bytes[1000];
+};
+
+void test_reuse_after_clear() {
+    // once the nodes have been allocated, clearing and refilling the map never returns to upstream
+    stdext::pmr::statistics_resource upstream;
+    {
+        map<int, int, less<int>, pool_alloc<pair<const int, int>>> m{pool_alloc<pair<const int, int>>{&upstream}};
+        for (int i = 0; i < 10'000; ++i) {
+            m.emplace(i, i);
+        }
+
+        const auto allocations = upstream.allocations();
+        const auto bytes       = upstream.bytes_in_use();
+        for (int round = 0; round < 5; ++round) {
+            m.clear();
+            assert(m.empty());
+            for (int i = 0; i < 10'000; ++i) {
+                m.emplace(10'000 - i, i);
+            }
+
+            assert(m.size() == 10'000 && m.at(1) == 9'999);
+        }
+
+        assert(upstream.allocations() == allocations);
+        assert(upstream.bytes_in_use() == bytes);
+
+        // nodes come from slabs, not one allocation apiece
+        assert(allocations < 200);
+    }
+
+    // the pool returns its slabs when the last copy of the allocator is destroyed
+    assert(upstream.bytes_in_use() == 0);
+    assert(upstream.allocations() == upstream.deallocations());
+}
+
+void test_node_containers() {
+    stdext::pmr::statistics_resource upstream;
+    {
+        list<string, pool_alloc<string>> l{pool_alloc<string>{&upstream}};
+        forward_list<int, pool_alloc<int>> fl{pool_alloc<int>{&upstream}};
+        set<int, less<int>, pool_alloc<int>> s{pool_alloc<int>{&upstream}};
+        multimap<int, string, less<int>, pool_alloc<pair<const int, string>>> mm{
+            pool_alloc<pair<const int, string>>{&upstream}};
+        unordered_map<int, int, hash<int>, equal_to<int>, pool_alloc<pair<const int, int>>> um{
+            pool_alloc<pair<const int, int>>{&upstream}};
+
+        for (int i = 0; i < 1'000; ++i) {
+            l.push_back(to_string(i));
+            fl.push_front(i);
+            s.insert(i % 100);
+            mm.emplace(i % 10, to_string(i));
+            um.emplace(i, -i);
+        }
+
+        assert(l.size() == 1'000 && l.back() == "999");
+        assert(fl.front() == 999);
+        assert(s.size() == 100);
+        assert(mm.count(3) == 100);
+        assert(um.size() == 1'000 && um.at(500) == -500);
+
+        l.remove_if([](const string& str) { return str.size() < 3; });
+        assert(l.size() == 900 && l.front() == "100");
+        fl.sort();
+        assert(fl.front() == 0);
+        s.erase(s.begin(), s.find(50));
+        assert(s.size() == 50 && *s.begin() == 50);
+    }
+
+    assert(upstream.bytes_in_use() == 0);
+}
+
+void test_allocator_semantics() {
+    stdext::pmr::statistics_resource upstream;
+    pool_alloc<int> a{&upstream};
+    pool_alloc<int> b = a;
+    pool_alloc<long> c{a};
+    pool_alloc<int> d{&upstream};
+    assert(a == b && a == c && a != d);
+    assert(a.upstream_resource() == &upstream);
+
+    // a single object freed through any copy can be reused by any other copy
+    int* const p = a.allocate(1);
+    b.deallocate(p, 1);
+    assert(b.allocate(1) == p);
+    a.deallocate(p, 1);
+
+    // arrays and objects too large to pool go directly to upstream
+    const auto allocations   = upstream.allocations();
+    const auto deallocations = upstream.deallocations();
+    int* const arr           = a.allocate(10);
+    a.deallocate(arr, 10);
+    pool_alloc<big> large{a};
+    big* const q = large.allocate(1);
+    large.deallocate(q, 1);
+    assert(upstream.allocations() == allocations + 2);
+    assert(upstream.deallocations() == deallocations + 2);
+
+    d = a;
+    assert(d == a);
+}
+
+void test_container_copy_move_swap() {
+    using alloc_t = pool_alloc<pair<const int, int>>;
+    map<int, int, less<int>, alloc_t> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i * i);
+    }
+
+    // a copy gets a pool of its own, so the two maps can be used independently
+    auto copy = m;
+    assert(copy == m);
+    assert(copy.get_allocator() != m.get_allocator());
+
+    auto moved = move(copy);
+    assert(moved == m);
+
+    map<int, int, less<int>, alloc_t> other;
+    other.emplace(-1, 1);
+    other.swap(moved);
+    assert(other == m);
+    assert(moved.size() == 1 && moved.at(-1) == 1);
+
+    moved = move(other);
+    assert(moved == m);
+    other = m;
+    assert(other == m);
+    other.clear();
+    other.emplace(7, 49);
+    assert(other.size() == 1 && m.size() == 100);
+}
+
+int main() {
+    test_reuse_after_clear();
+    test_node_containers();
+    test_allocator_semantics();
+    test_container_copy_move_swap();
+}
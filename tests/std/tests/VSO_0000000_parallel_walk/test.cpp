@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_parallel_walk";
+
+size_t create_tree() {
+    // returns the number of entries below base
+    remove_all(base);
+    assert(create_directory(base));
+    size_t entries = 0;
+    for (int i = 0; i < 12; ++i) {
+        const path dir = base / to_wstring(i);
+        assert(create_directory(dir));
+        ++entries;
+        for (int j = 0; j < i; ++j) {
+            const path subdir = dir / (L"sub" + to_wstring(j));
+            assert(create_directory(subdir));
+            ++entries;
+            for (int k = 0; k < j; ++k) {
+                ofstream{subdir / (L"file" + to_wstring(k))} << string(static_cast<size_t>(k), 'x');
+                ++entries;
+            }
+        }
+    }
+
+    return entries;
+}
+
+multiset<wstring> walk_serially() {
+    multiset<wstring> result;
+    for (const auto& entry : recursive_directory_iterator(base)) {
+        result.insert(entry.path().native());
+    }
+
+    return result;
+}
+
+multiset<wstring> walk_in_parallel() {
+    mutex mtx;
+    multiset<wstring> result;
+    stdext::filesystem::parallel_walk(base, [&](const directory_entry& entry) {
+        // the entry comes with the attributes and size read during enumeration
+        if (entry.is_regular_file()) {
+            const auto name = entry.path().filename().native();
+            assert(entry.file_size() == stoul(name.substr(4)));
+        }
+
+        lock_guard<mutex> lock{mtx};
+        result.insert(entry.path().native());
+    });
+
+    return result;
+}
+
+void test_matches_recursive_directory_iterator(const size_t entries) {
+    const auto expected = walk_serially();
+    assert(expected.size() == entries);
+    for (int i = 0; i < 10; ++i) {
+        assert(walk_in_parallel() == expected);
+    }
+
+    // run serially on the calling thread
+    {
+        stdext::parallel_algorithms_scope serial{nullptr, 1};
+        assert(walk_in_parallel() == expected);
+    }
+}
+
+void test_errors() {
+    const path missing = base / L"missing";
+    error_code ec;
+    size_t calls = 0;
+    stdext::filesystem::parallel_walk(
+        missing, [&](const directory_entry&) { ++calls; }, directory_options::skip_permission_denied, ec);
+    assert(ec);
+    assert(calls == 0);
+
+    stdext::filesystem::parallel_walk(base, [](const directory_entry&) {}, ec);
+    assert(!ec);
+
+    bool threw = false;
+    try {
+        stdext::filesystem::parallel_walk(missing, [](const directory_entry&) {});
+    } catch (const filesystem_error& err) {
+        threw = err.path1() == missing;
+    }
+    assert(threw);
+}
+
+void test_callback_exception() {
+    // the first exception thrown by the callback stops the walk and is rethrown on the calling thread
+    atomic<int> calls{0};
+    bool threw = false;
+    try {
+        stdext::filesystem::parallel_walk(base, [&](const directory_entry&) {
+            if (++calls == 7) {
+                throw 42;
+            }
+        });
+    } catch (const int val) {
+        threw = val == 42;
+    }
+    assert(threw);
+}
+
+int main() {
+    const size_t entries = create_tree();
+    test_matches_recursive_directory_iterator(entries);
+    test_errors();
+    test_callback_exception();
+    remove_all(base);
+}
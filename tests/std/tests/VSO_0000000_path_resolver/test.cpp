@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_path_resolver";
+
+void test_canonical(stdext::filesystem::path_resolver& resolver) {
+    const path dir  = base / L"dir";
+    const path file = dir / L"file.txt";
+    for (int i = 0; i < 3; ++i) { // the first round fills the cache, the others are answered from it
+        assert(resolver.canonical(dir) == canonical(dir));
+        assert(resolver.canonical(file) == canonical(file));
+        assert(resolver.canonical(base / L"dir" / L".." / L"dir" / L"file.txt") == canonical(file));
+        assert(resolver.canonical(path{}).empty());
+    }
+
+    error_code ec;
+    assert(resolver.canonical(base / L"missing", ec).empty());
+    assert(ec);
+
+    bool threw = false;
+    try {
+        (void) resolver.canonical(base / L"missing");
+    } catch (const filesystem_error& err) {
+        threw = true;
+        assert(err.path1() == base / L"missing");
+    }
+    assert(threw);
+
+    // failures are not remembered
+    create_directory(base / L"missing");
+    assert(resolver.canonical(base / L"missing", ec) == canonical(base / L"missing"));
+    assert(!ec);
+
+    // relative paths are remembered by the absolute path they named, so changing the current directory is safe
+    const auto old_current = current_path();
+    current_path(dir);
+    assert(resolver.canonical(L"file.txt") == canonical(file));
+    assert(resolver.canonical(L".") == canonical(dir));
+    current_path(old_current);
+}
+
+void test_weakly_canonical(stdext::filesystem::path_resolver& resolver) {
+    const path dir = base / L"dir";
+    for (int i = 0; i < 3; ++i) {
+        assert(resolver.weakly_canonical(dir / L"not" / L"there") == weakly_canonical(dir / L"not" / L"there"));
+        assert(resolver.weakly_canonical(dir / L"." / L"file.txt") == weakly_canonical(dir / L"file.txt"));
+        assert(resolver.weakly_canonical(L"nonexistent_relative/x") == weakly_canonical(L"nonexistent_relative/x"));
+    }
+}
+
+void test_equivalent(stdext::filesystem::path_resolver& resolver) {
+    const path dir  = base / L"dir";
+    const path file = dir / L"file.txt";
+    for (int i = 0; i < 3; ++i) {
+        assert(resolver.equivalent(file, base / L"dir" / L".." / L"dir" / L"file.txt"));
+        assert(resolver.equivalent(dir, dir / L"."));
+        assert(!resolver.equivalent(dir, file));
+    }
+
+    error_code ec;
+    assert(!resolver.equivalent(file, base / L"missing_file", ec));
+    assert(ec);
+    assert(!resolver.equivalent(base / L"missing_file", file, ec));
+    assert(ec);
+
+    bool threw = false;
+    try {
+        (void) resolver.equivalent(file, base / L"missing_file");
+    } catch (const filesystem_error& err) {
+        threw = true;
+        assert(err.path1() == file);
+        assert(err.path2() == base / L"missing_file");
+    }
+    assert(threw);
+}
+
+void test_clear(stdext::filesystem::path_resolver& resolver) {
+    // the cache is not refreshed until clear() is called
+    const path old_name = base / L"before";
+    const path new_name = base / L"after";
+    create_directory(old_name);
+    const auto resolved = resolver.canonical(old_name);
+    rename(old_name, new_name);
+    assert(resolver.canonical(old_name) == resolved);
+    resolver.clear();
+    error_code ec;
+    (void) resolver.canonical(old_name, ec);
+    assert(ec);
+    assert(resolver.canonical(new_name) == canonical(new_name));
+}
+
+int main() {
+    remove_all(base);
+    create_directories(base / L"dir");
+    ofstream{base / L"dir" / L"file.txt"} << "contents";
+
+    stdext::filesystem::path_resolver resolver;
+    test_canonical(resolver);
+    test_weakly_canonical(resolver);
+    test_equivalent(resolver);
+    test_clear(resolver);
+    remove_all(base);
+}
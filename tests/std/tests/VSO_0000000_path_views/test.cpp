@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace std::filesystem;
+
+const wstring_view test_paths[] = {L"", L".", L"..", L"a", L"a/b", LR"(a\b\)", L"a//b//", L"/", L"//", L"///",
+    L"/a", L"//a", L"//a/", L"//a/b", L"///a", L"X:", L"x:a", L"X:/", LR"(X:\a\b.txt)", LR"(X:\a\\b.tar.gz)",
+    LR"(\\server)", LR"(\\server\share)", LR"(\\server\share\dir\file.ext)", LR"(\\?\X:\a)", LR"(\\.\device)",
+    LR"(\??\device\x)", LR"(\\?\UNC\server\share)", L"a/.b", L"a/b.", L"a/..", L"file:ads", L"a.b:c.d", L"/a/b/"};
+
+void test_decomposition(const path& p) {
+    // each view refers to the path's own characters and matches the corresponding member
+    const auto& text = p.native();
+    const auto check = [&](const wstring_view view, const path& expected) {
+        assert(view == expected.native());
+        if (!view.empty()) {
+            assert(view.data() >= text.data() && view.data() + view.size() <= text.data() + text.size());
+        }
+    };
+
+    check(stdext::filesystem::root_name_view(p), p.root_name());
+    check(stdext::filesystem::root_directory_view(p), p.root_directory());
+    check(stdext::filesystem::root_path_view(p), p.root_path());
+    check(stdext::filesystem::relative_path_view(p), p.relative_path());
+    check(stdext::filesystem::parent_path_view(p), p.parent_path());
+    check(stdext::filesystem::filename_view(p), p.filename());
+    check(stdext::filesystem::stem_view(p), p.stem());
+    check(stdext::filesystem::extension_view(p), p.extension());
+}
+
+void test_elements(const path& p) {
+    // path_element_view visits the same elements as path::iterator
+    vector<wstring> expected;
+    for (const auto& element : p) {
+        expected.push_back(element.native());
+    }
+
+    vector<wstring> actual;
+    const stdext::filesystem::path_element_view elements{p};
+    for (const wstring_view element : elements) {
+        actual.emplace_back(element);
+    }
+
+    assert(actual == expected);
+    assert(static_cast<size_t>(distance(elements.begin(), elements.end())) == expected.size());
+
+    // the iterators are multipass
+    auto first = elements.begin();
+    if (first != elements.end()) {
+        const auto copy = first;
+        ++first;
+        assert(*copy == expected[0]);
+        assert(copy != first);
+        assert(copy->size() == expected[0].size());
+    }
+}
+
+void test_iterator_reuse() {
+    // path::iterator produces the same elements after switching between short and long elements
+    const path p = LR"(X:\a\a_long_directory_name_that_needs_an_allocation\b\another_long_name_for_a_file.txt)";
+    vector<path> elements(p.begin(), p.end());
+    assert(elements.size() == 6);
+    assert(elements[0] == L"X:");
+    assert(elements[1] == LR"(\)");
+    assert(elements[2] == L"a");
+    assert(elements[3] == L"a_long_directory_name_that_needs_an_allocation");
+    assert(elements[4] == L"b");
+    assert(elements[5] == L"another_long_name_for_a_file.txt");
+
+    auto it = p.end();
+    for (size_t i = elements.size(); i-- != 0;) {
+        --it;
+        assert(*it == elements[i]);
+    }
+
+    assert(it == p.begin());
+}
+
+static_assert(is_same_v<iterator_traits<stdext::filesystem::path_element_view::iterator>::iterator_category,
+    forward_iterator_tag>);
+static_assert(!is_constructible_v<stdext::filesystem::path_element_view, path>);
+static_assert(is_constructible_v<stdext::filesystem::path_element_view, const path&>);
+
+int main() {
+    for (const auto& str : test_paths) {
+        const path p{str};
+        test_decomposition(p);
+        test_elements(p);
+    }
+
+    test_iterator_reuse();
+}
@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::philox4x32;
+using stdext::philox4x64;
+
+using philox2x16 = stdext::philox_engine<uint_fast32_t, 16, 2, 7, 0xD256, 0x9E37>;
+using philox2x40 = stdext::philox_engine<uint_fast64_t, 40, 2, 10, 0xD256D193ULL, 0x9E3779B9ULL>;
+
+STATIC_ASSERT(philox4x32::word_size == 32 && philox4x32::word_count == 4 && philox4x32::round_count == 10);
+STATIC_ASSERT(philox4x32::multipliers[0] == 0xCD9E8D57 && philox4x32::multipliers[1] == 0xD2511F53);
+STATIC_ASSERT(philox4x32::round_consts[0] == 0x9E3779B9 && philox4x32::round_consts[1] == 0xBB67AE85);
+STATIC_ASSERT((philox4x32::max)() == 0xFFFFFFFFu && (philox4x64::max)() == ~0ULL);
+STATIC_ASSERT((philox2x16::max)() == 0xFFFF && (philox2x40::max)() == 0xFF'FFFF'FFFFULL);
+STATIC_ASSERT(philox4x32::default_seed == 20111115u);
+
+void test_known_values() {
+    // N4971 [rand.predef]: the 10000th consecutive invocation of a default-constructed object
+    philox4x32 gen32;
+    philox4x64 gen64;
+    for (int i = 0; i < 9999; ++i) {
+        (void) gen32();
+        (void) gen64();
+    }
+
+    assert(gen32() == 1955073260u);
+    assert(gen64() == 3409172418970261260ULL);
+}
+
+template <class Engine>
+void test_discard() {
+    const unsigned long long counts[] = {0, 1, 2, 3, 4, 5, 7, 8, 100, 1001};
+    Engine skipped;
+    Engine single;
+    for (const auto count : counts) {
+        skipped.discard(count);
+        for (unsigned long long i = 0; i < count; ++i) {
+            (void) single();
+        }
+
+        assert(skipped == single);
+        assert(skipped() == single());
+    }
+}
+
+void test_counter() {
+    // the counter is one 128-bit number whose most significant word is set_counter's first element
+    philox4x32 carry;
+    carry.set_counter({{0, 0, 0, 0xFFFFFFFFu}});
+    carry.discard(2 * philox4x32::word_count);
+    philox4x32 expected;
+    expected.set_counter({{0, 0, 1, 1}});
+    assert(carry == expected);
+    assert(carry() == expected());
+
+    philox4x32 far;
+    far.discard(1ULL << 40); // 2^38 blocks
+    philox4x32 by_counter;
+    by_counter.set_counter({{0, 0, 0x40, 0}});
+    assert(far == by_counter);
+
+    // setting the counter starts a new block
+    philox4x64 started;
+    (void) started();
+    started.set_counter({{0, 0, 0, 0}});
+    philox4x64 fresh;
+    assert(started == fresh);
+    assert(started() == fresh());
+}
+
+void test_parallel_streams() {
+    // each chunk of a parallel computation can find its results in constant time, so the results don't depend on
+    // how the work is divided
+    constexpr size_t total = 10'000;
+    philox4x64 serial(1729);
+    vector<philox4x64::result_type> expected(total);
+    for (auto& val : expected) {
+        val = serial();
+    }
+
+    for (const size_t chunk : {1, 3, 4, 7, 64, 1000}) {
+        vector<philox4x64::result_type> actual(total);
+        for (size_t first = 0; first < total; first += chunk) {
+            philox4x64 worker(1729);
+            worker.discard(first);
+            const size_t last = first + chunk < total ? first + chunk : total;
+            stdext::generate_random(actual.begin() + static_cast<ptrdiff_t>(first),
+                actual.begin() + static_cast<ptrdiff_t>(last), worker);
+        }
+
+        assert(actual == expected);
+    }
+
+    // different keys give independent streams
+    philox4x32 stream0(0);
+    philox4x32 stream1(1);
+    int same = 0;
+    for (int i = 0; i < 1000; ++i) {
+        same += stream0() == stream1();
+    }
+    assert(same < 10);
+}
+
+template <class Engine>
+void test_bulk() {
+    const size_t lengths[] = {0, 1, 2, 3, 4, 5, 9, 100};
+    Engine bulk;
+    Engine single;
+    for (const size_t first : lengths) {
+        for (const size_t second : lengths) {
+            vector<typename Engine::result_type> values(first + second);
+            stdext::generate_random(values.begin(), values.begin() + static_cast<ptrdiff_t>(first), bulk);
+            stdext::generate_random(values.begin() + static_cast<ptrdiff_t>(first), values.end(), bulk);
+            for (const auto val : values) {
+                assert(val == single());
+            }
+
+            assert(bulk == single);
+        }
+    }
+}
+
+template <class Engine>
+void test_io_and_seeding() {
+    Engine gen;
+    gen.discard(6);
+    stringstream ss;
+    ss << gen;
+    Engine loaded(12345);
+    ss >> loaded;
+    assert(ss);
+    assert(loaded == gen);
+    for (int i = 0; i < 10; ++i) {
+        assert(loaded() == gen());
+    }
+
+    Engine reseeded(99);
+    (void) reseeded();
+    reseeded.seed();
+    assert(reseeded == Engine{});
+
+    seed_seq seq1{1, 2, 3};
+    seed_seq seq2{1, 2, 3};
+    Engine from_seq(seq1);
+    Engine other;
+    other.seed(seq2);
+    assert(from_seq == other);
+    assert(from_seq != Engine{});
+
+    for (int i = 0; i < 1000; ++i) {
+        const auto val = gen();
+        assert((Engine::min)() <= val && val <= (Engine::max)());
+    }
+}
+
+int main() {
+    test_known_values();
+    test_discard<philox4x32>();
+    test_discard<philox4x64>();
+    test_discard<philox2x16>();
+    test_discard<philox2x40>();
+    test_counter();
+    test_parallel_streams();
+    test_bulk<philox4x32>();
+    test_bulk<philox4x64>();
+    test_bulk<philox2x40>();
+    test_io_and_seeding<philox4x32>();
+    test_io_and_seeding<philox4x64>();
+    test_io_and_seeding<philox2x16>();
+}
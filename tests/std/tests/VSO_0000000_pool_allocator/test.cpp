@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// stdext::pool_allocator<T, Resource> calls the concrete resource without going through memory_resource's virtual
+// functions; it must otherwise behave as polymorphic_allocator does over the same resource.
+
+template <class T, class Resource = pmr::unsynchronized_pool_resource>
+using pool_alloc = stdext::pool_allocator<T, Resource>;
+
+static_assert(is_same_v<allocator_traits<pool_alloc<int>>::rebind_alloc<long>, pool_alloc<long>>);
+static_assert(is_same_v<allocator_traits<pool_alloc<int, pmr::monotonic_buffer_resource>>::rebind_alloc<long>,
+    pool_alloc<long, pmr::monotonic_buffer_resource>>);
+static_assert(is_convertible_v<pmr::unsynchronized_pool_resource*, pool_alloc<int>>);
+static_assert(!allocator_traits<pool_alloc<int>>::propagate_on_container_copy_assignment::value);
+static_assert(!allocator_traits<pool_alloc<int>>::is_always_equal::value);
+
+class counting_resource final : public pmr::memory_resource {
+public:
+    explicit counting_resource(pmr::memory_resource* const upstream) noexcept : upstream(upstream) {}
+
+    size_t allocations   = 0;
+    size_t deallocations = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        ++allocations;
+        return upstream->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        ++deallocations;
+        upstream->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+
+    pmr::memory_resource* upstream;
+};
+
+template <class Resource>
+void test_node_containers(Resource& resource) {
+    {
+        list<string, pool_alloc<string, Resource>> l{&resource};
+        forward_list<int, pool_alloc<int, Resource>> fl{&resource};
+        set<int, less<int>, pool_alloc<int, Resource>> s{&resource};
+        multimap<int, string, less<int>, pool_alloc<pair<const int, string>, Resource>> mm{&resource};
+        unordered_map<int, int, hash<int>, equal_to<int>, pool_alloc<pair<const int, int>, Resource>> um{&resource};
+        vector<int, pool_alloc<int, Resource>> v{&resource};
+
+        for (int i = 0; i < 1'000; ++i) {
+            l.push_back(to_string(i));
+            fl.push_front(i);
+            s.insert(i % 100);
+            mm.emplace(i % 10, to_string(i));
+            um.emplace(i, -i);
+            v.push_back(i);
+        }
+
+        assert(l.size() == 1'000 && l.back() == "999");
+        assert(fl.front() == 999);
+        assert(s.size() == 100);
+        assert(mm.count(3) == 100);
+        assert(um.size() == 1'000 && um.at(500) == -500);
+        assert(v.size() == 1'000 && v[999] == 999);
+
+        l.remove_if([](const string& str) { return str.size() < 3; });
+        assert(l.size() == 900 && l.front() == "100");
+        fl.sort();
+        assert(fl.front() == 0);
+        s.erase(s.begin(), s.find(50));
+        assert(s.size() == 50 && *s.begin() == 50);
+        v.clear();
+        v.shrink_to_fit();
+    }
+}
+
+void test_standard_resources() {
+    stdext::pmr::statistics_resource upstream;
+    {
+        pmr::unsynchronized_pool_resource pool{&upstream};
+        test_node_containers(pool);
+        assert(stdext::pmr::get_statistics(pool).bytes_in_use == 0);
+    }
+
+    {
+        pmr::synchronized_pool_resource pool{&upstream};
+        test_node_containers(pool);
+    }
+
+    {
+        pmr::monotonic_buffer_resource arena{&upstream};
+        test_node_containers(arena);
+    }
+
+    {
+        stdext::pmr::monotonic_arena_resource arena{&upstream};
+        const auto start = arena.checkpoint();
+        test_node_containers(arena);
+        arena.rewind(start);
+    }
+
+    {
+        stdext::pmr::concurrent_pool_resource pool{&upstream};
+        test_node_containers(pool);
+    }
+
+    assert(upstream.bytes_in_use() == 0);
+    assert(upstream.allocations() == upstream.deallocations());
+}
+
+void test_other_resources() {
+    // resources of other types are called through memory_resource, so derived classes keep their overrides
+    counting_resource counting{pmr::new_delete_resource()};
+    test_node_containers(counting);
+    assert(counting.allocations != 0);
+    assert(counting.allocations == counting.deallocations);
+
+    pmr::unsynchronized_pool_resource pool{&counting};
+    pmr::memory_resource& base = pool;
+    pool_alloc<int, pmr::memory_resource> erased{&base};
+    int* const p = erased.allocate(3);
+    p[2]         = 1729;
+    erased.deallocate(p, 3);
+}
+
+void test_allocator_semantics() {
+    pmr::unsynchronized_pool_resource pool;
+    pmr::unsynchronized_pool_resource other_pool;
+    pool_alloc<int> a{&pool};
+    pool_alloc<int> b = a;
+    pool_alloc<long> c{a};
+    pool_alloc<int> d{&other_pool};
+    assert(a == b && a == c && a != d);
+    assert(a.resource() == &pool && c.resource() == &pool);
+    assert(a.select_on_container_copy_construction() == a);
+
+    // the same blocks the pool hands to polymorphic_allocator
+    pmr::polymorphic_allocator<int> poly{&pool};
+    int* const p = a.allocate(1);
+    poly.deallocate(p, 1);
+    assert(poly.allocate(1) == p);
+    b.deallocate(p, 1);
+
+    // a copied container shares the resource, as it does with polymorphic_allocator
+    map<int, int, less<int>, pool_alloc<pair<const int, int>>> m{&pool};
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i * i);
+    }
+
+    auto copy = m;
+    assert(copy == m && copy.get_allocator() == m.get_allocator());
+    map<int, int, less<int>, pool_alloc<pair<const int, int>>> elsewhere{&other_pool};
+    elsewhere = move(copy);
+    assert(elsewhere == m && elsewhere.get_allocator().resource() == &other_pool);
+}
+
+int main() {
+    test_standard_resources();
+    test_other_resources();
+    test_allocator_semantics();
+}
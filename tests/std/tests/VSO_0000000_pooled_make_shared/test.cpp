@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+atomic<int> live_objects{0};
+
+struct message {
+    explicit message(int id_, string payload_) : id(id_), payload(move(payload_)) {
+        ++live_objects;
+    }
+
+    message(const message&) = delete;
+    message& operator=(const message&) = delete;
+
+    ~message() {
+        --live_objects;
+    }
+
+    int id;
+    string payload;
+};
+
+struct alignas(64) overaligned {
+    char bytes[64];
+};
+
+struct big {
+    char bytes[4096];
+};
+
+struct self_aware : enable_shared_from_this<self_aware> {};
+
+void test_basics() {
+    {
+        auto p = stdext::pooled_make_shared<message>(1, "hello");
+        assert(live_objects == 1);
+        assert(p->id == 1);
+        assert(p->payload == "hello");
+        assert(p.use_count() == 1);
+
+        shared_ptr<const message> copy = p;
+        assert(p.use_count() == 2);
+
+        weak_ptr<message> w = p;
+        p.reset();
+        copy.reset();
+        assert(live_objects == 0);
+        assert(w.expired());
+    }
+
+    const auto a = stdext::pooled_make_shared<overaligned>();
+    assert(reinterpret_cast<uintptr_t>(a.get()) % 64 == 0);
+
+    const auto b = stdext::pooled_make_shared<big>();
+    b->bytes[4095] = 'x';
+
+    const auto s = stdext::pooled_make_shared<self_aware>();
+    assert(s->shared_from_this() == s);
+
+    const auto l = stdext::pooled_make_local_shared<message>(2, "local");
+    assert(l->payload == "local");
+    assert(l.use_count() == 1);
+}
+
+void test_reuse() {
+    // blocks freed on this thread are handed out again from its cache
+    const void* first = nullptr;
+    {
+        const auto p = stdext::pooled_make_shared<message>(0, "");
+        first        = p.get();
+    }
+
+    bool reused = false;
+    for (int i = 0; i < 100 && !reused; ++i) {
+        const auto p = stdext::pooled_make_shared<message>(i, "");
+        reused       = p.get() == first;
+    }
+
+    assert(reused);
+}
+
+void test_cross_thread_release() {
+    // objects made on one thread and released on others go back to the shared pool
+    constexpr int count = 10'000;
+    vector<shared_ptr<message>> made;
+    made.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        made.push_back(stdext::pooled_make_shared<message>(i, "payload"));
+    }
+
+    vector<thread> releasers;
+    for (int t = 0; t < 4; ++t) {
+        releasers.emplace_back([&made, t] {
+            for (size_t i = static_cast<size_t>(t); i < made.size(); i += 4) {
+                made[i].reset();
+                made[i] = stdext::pooled_make_shared<message>(-1, "");
+                made[i].reset();
+            }
+        });
+    }
+
+    for (auto& t : releasers) {
+        t.join();
+    }
+
+    assert(live_objects == 0);
+}
+
+int main() {
+    test_basics();
+    test_reuse();
+    test_cross_thread_release();
+    assert(live_objects == 0);
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+using namespace std::chrono;
+
+// Sleeps and timed waits shorter than a tick of the system timer use high resolution timers where available, and spin
+// at the end; whether or not they are available, they must never return before the deadline.
+
+void test_sleep() {
+    for (const auto timeout : {microseconds{1}, microseconds{50}, microseconds{250}, microseconds{2'500}}) {
+        for (int i = 0; i < 10; ++i) {
+            const auto start = steady_clock::now();
+            this_thread::sleep_for(timeout);
+            assert(steady_clock::now() - start >= timeout);
+        }
+    }
+
+    const auto deadline = system_clock::now() + microseconds{300};
+    this_thread::sleep_until(deadline);
+    assert(system_clock::now() >= deadline);
+}
+
+void test_condition_variable() {
+    mutex m;
+    condition_variable cv;
+    unique_lock<mutex> lck(m);
+    for (const auto timeout : {microseconds{50}, microseconds{250}, microseconds{2'500}}) {
+        for (int i = 0; i < 10; ++i) {
+            const auto start = steady_clock::now();
+            assert(!cv.wait_for(lck, timeout, [] { return false; }));
+            assert(steady_clock::now() - start >= timeout);
+            assert(lck.owns_lock());
+        }
+    }
+
+    // being notified still ends the wait early
+    bool ready = false;
+    thread notifier([&] {
+        this_thread::sleep_for(milliseconds{10});
+        lock_guard<mutex> guard(m);
+        ready = true;
+        cv.notify_one();
+    });
+
+    assert(cv.wait_for(lck, hours{1}, [&] { return ready; }));
+    lck.unlock();
+    notifier.join();
+
+    condition_variable_any cv_any;
+    lck.lock();
+    const auto start = steady_clock::now();
+    assert(cv_any.wait_for(lck, microseconds{400}) == cv_status::timeout);
+    assert(steady_clock::now() - start >= microseconds{400});
+}
+
+void test_timed_mutex() {
+    timed_mutex m;
+    m.lock();
+    thread([&] {
+        const auto start = steady_clock::now();
+        assert(!m.try_lock_for(microseconds{300}));
+        assert(steady_clock::now() - start >= microseconds{300});
+    }).join();
+    m.unlock();
+}
+
+int main() {
+    test_sleep();
+    test_condition_variable();
+    test_timed_mutex();
+}
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#if _HAS_CXX20
+#include <span>
+#endif // _HAS_CXX20
+
+#ifndef _M_CEE
+#include <thread>
+#endif // _M_CEE
+
+using namespace std;
+
+template <class Range>
+bool looks_random(const Range& values) {
+    // 32-bit values from a CSPRNG practically never repeat among a few thousand
+    const set<unsigned long long> distinct(values.begin(), values.end());
+    return distinct.size() + 2 >= values.size();
+}
+
+void test_generate() {
+    random_device rd;
+    vector<unsigned int> values(10'000);
+    rd.generate(values.begin(), values.end());
+    assert(looks_random(values));
+
+    vector<unsigned int> more(values.size());
+    rd.generate(more.data(), more.data() + more.size());
+    assert(looks_random(more));
+    assert(!equal(values.begin(), values.end(), more.begin()));
+
+    // empty ranges, and iterators that aren't pointers to result_type
+    rd.generate(values.begin(), values.begin());
+    list<unsigned long long> wide(1'000);
+    rd.generate(wide.begin(), wide.end());
+    assert(looks_random(wide));
+    assert(all_of(wide.begin(), wide.end(), [](unsigned long long val) { return val <= 0xFFFF'FFFFULL; }));
+
+#if _HAS_CXX20
+    unsigned int arr[300]{};
+    rd.generate(span{arr});
+    assert(looks_random(span{arr}));
+    rd.generate(span<unsigned int>{});
+#endif // _HAS_CXX20
+
+    // seeding an engine with values from random_device
+    seed_seq seq(values.begin(), values.begin() + 8);
+    mt19937 eng(seq);
+    (void) eng();
+}
+
+void test_buffered() {
+    stdext::buffered_random_device rd;
+    static_assert(is_same<decltype(rd()), unsigned int>::value, "bad result_type");
+    static_assert((stdext::buffered_random_device::min)() == 0, "bad min");
+    static_assert((stdext::buffered_random_device::max)() == 0xFFFF'FFFFu, "bad max");
+    assert(rd.entropy() == 32.0);
+
+    vector<unsigned int> values;
+    for (int i = 0; i < 1'000; ++i) {
+        values.push_back(rd());
+    }
+
+    assert(looks_random(values));
+
+    uniform_int_distribution<int> dist(1, 6);
+    for (int i = 0; i < 1'000; ++i) {
+        const int roll = dist(rd);
+        assert(roll >= 1 && roll <= 6);
+    }
+
+    mt19937 eng(rd());
+    (void) eng();
+}
+
+#ifndef _M_CEE
+void test_buffered_threads() {
+    // each thread has its own buffer, and no two threads are handed the same values
+    vector<vector<unsigned int>> results(4);
+    vector<thread> threads;
+    for (auto& result : results) {
+        threads.emplace_back([&result] {
+            stdext::buffered_random_device rd;
+            for (int i = 0; i < 2'000; ++i) {
+                result.push_back(rd());
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    vector<unsigned int> all;
+    for (const auto& result : results) {
+        all.insert(all.end(), result.begin(), result.end());
+    }
+
+    assert(looks_random(all));
+}
+#endif // _M_CEE
+
+int main() {
+    test_generate();
+    test_buffered();
+#ifndef _M_CEE
+    test_buffered_threads();
+#endif // _M_CEE
+}
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <list>
+#include <regex>
+#include <string>
+
+using namespace std;
+
+// The backtracking matcher keeps the ifs, loops, and assertions it may return to in a stack on the heap, so the
+// depth of the backtracking no longer depends on the size of the thread's stack.
+void test_deep_backtracking() {
+    smatch m;
+    const string as(20'000, 'a');
+    assert(regex_match(as, m, regex("(a)*")));
+    assert(m[1].matched && m.position(1) == 19'999);
+
+    const string abs = string(5'000, 'a') + string(5'000, 'b');
+    assert(regex_match(abs, m, regex("(?:(a)|b)*\\1b*")));
+    assert(m.position(1) == 4'998);
+    assert(regex_match(abs, m, regex("(?:(a)|(b))*")));
+    assert(m.position(1) == 4'999 && m.position(2) == 9'999);
+
+    // back references require the backtracking matcher for the whole search
+    const string doubled(10'000, 'a');
+    assert(regex_match(doubled, m, regex("((?:a|b)*)\\1")));
+    assert(m.length(1) == 5'000);
+}
+
+void test_bidirectional_iterators() {
+    const string str = string(5'000, 'x') + "y";
+    const list<char> lst(str.begin(), str.end());
+    match_results<list<char>::const_iterator> m;
+    assert(regex_match(lst.begin(), lst.end(), m, regex("(?:(x)|z)*(y)")));
+    assert(m[1].matched && m[2].matched);
+    assert(!regex_match(lst.begin(), lst.end(), regex("(?:(x)|z)*(y)\\1")));
+}
+
+void test_alternation_and_assertions() {
+    smatch m;
+    const string text = "abcd";
+    assert(regex_match(text, m, regex("(a|ab)(c|bcd)(d*)")));
+    assert(m[1] == "a" && m[2] == "bcd" && m[3] == "");
+
+    // POSIX grammars look for the longest match
+    assert(regex_search(text, m, regex("(a|ab)(c|bcd)", regex::extended)));
+    assert(m[0] == "abcd");
+
+    const string words = "foobar foobaz";
+    assert(regex_search(words, m, regex("foo(?=baz)(\\w+)")));
+    assert(m.position(0) == 7 && m[1] == "baz");
+    assert(regex_search(words, m, regex("foo(?!bar)(\\w+)")));
+    assert(m[1] == "baz");
+}
+
+void test_repeated_failures() {
+    // once an unbounded loop has failed at a position, it isn't tried there again; without that, the first branch of
+    // this pattern would take exponential time before the second branch gets a chance
+    smatch m;
+    const string text = string(60, 'a') + "c";
+    assert(regex_search(text, m, regex("(a|aa)*b|(a*)c")));
+    assert(!m[1].matched && m[2].length() == 60);
+
+    const string spaces = "x" + string(60, ' ') + "!";
+    assert(regex_search(spaces, m, regex("x(\\s|  )*y|x(.*)")));
+    assert(m[2].length() == 61);
+}
+
+int main() {
+    test_deep_backtracking();
+    test_bidirectional_iterators();
+    test_alternation_and_assertions();
+    test_repeated_failures();
+}
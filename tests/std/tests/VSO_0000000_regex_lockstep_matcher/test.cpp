@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Patterns without back references are first run through a lockstep simulation, which finds out in linear time
+// whether and where they match; the backtracking matcher only runs to fill in sub-matches, starting from that place.
+void test_pathological_patterns() {
+    const string as(30, 'a');
+    assert(!regex_match(as, regex("(a*)*b")));
+    assert(!regex_search(as, regex("(a|aa)+b")));
+    assert(!regex_search(string(40, 'x'), regex("(x+x+)+y")));
+    assert(regex_search(as + "b", regex("(a*)*b")));
+
+    smatch m;
+    const string asb = as + "b";
+    assert(regex_search(asb, m, regex("(a|aa)+b")));
+    assert(m.position(0) == 0 && m.length(0) == 31);
+}
+
+void test_long_input() {
+    // the lockstep simulation keeps no stack that grows with the input
+    const string text = string(100'000, 'a') + "b";
+    const regex re("(?:a|b)*b");
+    assert(regex_match(text, re));
+    assert(regex_search(text, regex("a{3}b")));
+    assert(!regex_search(text, regex("ab{2}")));
+    assert(!regex_match(text, regex("(?:a|b)*c")));
+}
+
+void test_sub_matches() {
+    smatch m;
+    const string text = "xx key=value; other=thing";
+    assert(regex_search(text, m, regex("(\\w+)=(\\w+)")));
+    assert(m.prefix() == "xx ");
+    assert(m[1] == "key" && m[2] == "value");
+    assert(m.suffix() == "; other=thing");
+
+    assert(regex_match(text, m, regex("(x*) (.*?)=(.*)")));
+    assert(m[1] == "xx" && m[2] == "key" && m[3] == "value; other=thing");
+
+    // the leftmost match wins, not the longest one
+    const string abcd = "zabcd";
+    assert(regex_search(abcd, m, regex("c|abc")));
+    assert(m.position(0) == 1 && m[0] == "abc");
+    assert(regex_search(abcd, m, regex("bcd|ab")));
+    assert(m.position(0) == 1 && m[0] == "ab");
+
+    // unmatched groups stay unmatched
+    const string dashes = "--b--";
+    assert(regex_search(dashes, m, regex("(a)|(b)")));
+    assert(!m[1].matched && m[2].matched && m.position(2) == 2);
+}
+
+void test_flags() {
+    smatch m;
+    const string text = "aaa";
+    assert(regex_search(text, m, regex("a*"), regex_constants::match_not_null));
+    assert(m.length(0) == 3);
+    assert(!regex_search(string("bbb"), regex("a*"), regex_constants::match_not_null));
+    assert(!regex_match(string(), regex("a*"), regex_constants::match_not_null));
+
+    assert(!regex_search(string("xa"), regex("a"), regex_constants::match_continuous));
+    assert(regex_search(string("ax"), regex("a"), regex_constants::match_continuous));
+
+    assert(!regex_search(string("ab"), regex("^b")));
+    assert(!regex_search(string("ab"), regex("^a"), regex_constants::match_not_bol));
+    assert(!regex_search(string("ab"), regex("b$"), regex_constants::match_not_eol));
+    assert(!regex_search(string("ab"), regex("\\bb")));
+
+    const string words = "one two";
+    assert(regex_search(words.begin() + 4, words.end(), regex("\\btwo")));
+    assert(regex_search(words.begin() + 4, words.end(), regex("\\btwo"), regex_constants::match_prev_avail));
+    assert(!regex_search(words.begin() + 5, words.end(), regex("\\bwo"), regex_constants::match_prev_avail));
+    assert(regex_search(words.begin() + 5, words.end(), regex("\\Bwo"), regex_constants::match_prev_avail));
+    assert(!regex_search(words.begin() + 5, words.end(), regex("\\Bwo")));
+}
+
+void test_classes_and_icase() {
+    smatch m;
+    const string hello = "Hello World";
+    assert(regex_search(hello, m, regex("[[:upper:]][a-z]+$")));
+    assert(m[0] == "World");
+    assert(regex_match(string("HeLLo"), regex("hel+o", regex_constants::icase)));
+    assert(regex_match(string("HeLLo"), regex("[a-z]+", regex_constants::icase)));
+    assert(!regex_match(string("HeLLo"), regex("[a-z]+")));
+    const string number = "x = 12.5;";
+    assert(regex_search(number, m, regex("\\d+(\\.\\d*)?")));
+    assert(m[0] == "12.5" && m[1] == ".5");
+    assert(regex_match(string("a.b"), regex("a\\.b")));
+    assert(!regex_match(string("a\nb"), regex("a.b")));
+
+    const wstring wide = L"cafe ole";
+    wsmatch wm;
+    assert(regex_search(wide, wm, wregex(L"ol.")));
+    assert(wm.position(0) == 5);
+}
+
+void test_fallback_patterns() {
+    // back references and lookahead assertions are left to the backtracking matcher alone
+    smatch m;
+    const string twice = "abcabc";
+    assert(regex_search(twice, m, regex("(abc)\\1")));
+    assert(m.position(0) == 0);
+    assert(!regex_match(string("abcabd"), regex("(abc)\\1")));
+    const string foos = "foobar foobaz";
+    assert(regex_search(foos, m, regex("foo(?=baz)")));
+    assert(m.position(0) == 7);
+    assert(regex_search(foos, m, regex("foo(?!bar)")));
+    assert(m.position(0) == 7);
+
+    // so are repetitions of patterns that can match the empty string more than once
+    const string ab = "ab";
+    assert(regex_match(ab, m, regex("(a|b|){2,3}")));
+    assert(m[0] == "ab");
+}
+
+void test_other_grammars() {
+    assert(regex_match(string("aaab"), regex("a+b", regex_constants::extended)));
+    assert(regex_search(string("xaby"), regex("a\\{1,2\\}b", regex_constants::basic)));
+    assert(regex_match(string("bb"), regex("a|b+", regex_constants::awk)));
+    assert(!regex_search(string("one two"), regex("^two$", regex_constants::extended)));
+}
+
+void test_iteration() {
+    const string text = "a1b22c333d";
+    const regex re("\\d+");
+    vector<string> found;
+    for (sregex_iterator it(text.begin(), text.end(), re), end; it != end; ++it) {
+        found.push_back(it->str());
+    }
+
+    assert((found == vector<string>{"1", "22", "333"}));
+
+    // empty matches advance one element at a time
+    const string letters = "ab";
+    const regex xs("x*");
+    assert(distance(sregex_iterator(letters.begin(), letters.end(), xs), sregex_iterator()) == 3);
+
+    assert(regex_replace(string("a-b--c"), regex("-+"), "+") == "a+b+c");
+}
+
+int main() {
+    test_pathological_patterns();
+    test_long_input();
+    test_sub_matches();
+    test_flags();
+    test_classes_and_icase();
+    test_fallback_patterns();
+    test_other_grammars();
+    test_iteration();
+}
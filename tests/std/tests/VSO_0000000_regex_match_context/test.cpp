@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+    ++g_allocations;
+    void* const p = malloc(size == 0 ? 1 : size);
+    if (!p) {
+        throw bad_alloc();
+    }
+
+    return p;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+bool same_results(const smatch& left, const smatch& right) {
+    if (left.size() != right.size() || left.empty() != right.empty()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < left.size(); ++i) {
+        if (left[i].matched != right[i].matched || (left[i].matched && left[i] != right[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// a match_context gives the same results as a plain call, whichever regular expressions and texts it goes through
+void test_same_results() {
+    const vector<string> patterns = {
+        "(\\w+)\\[(\\d+)\\]: (ok|ERROR)", "(a|ab)(c|bcd)(d*)", "(\\w)\\1", "(?=\\d)(\\d+)x?", "^$", "b*"};
+    const vector<string> texts = {"host[42]: ERROR", "abcd", "no match here", "xx aabb", "", "123x 4", "\nbb"};
+
+    stdext::smatch_context context;
+    for (int round = 0; round < 2; ++round) {
+        for (const auto& pattern : patterns) {
+            const regex re(pattern);
+            for (const auto& text : texts) {
+                smatch expected;
+                smatch actual;
+                assert(regex_search(text, expected, re) == regex_search(text, actual, re, context));
+                assert(same_results(expected, actual));
+                assert(regex_match(text, expected, re) == regex_match(text, actual, re, context));
+                assert(same_results(expected, actual));
+                assert(regex_search(text, re) == regex_search(text, re, context));
+                assert(regex_match(text.begin(), text.end(), re) == regex_match(text.begin(), text.end(), re, context));
+                assert(regex_search(text, expected, re, regex_constants::match_not_bol)
+                       == regex_search(text, actual, re, context, regex_constants::match_not_bol));
+                assert(same_results(expected, actual));
+            }
+        }
+    }
+}
+
+// once the context and the match_results have grown to fit, matching allocates nothing
+void test_no_allocations() {
+    const string hit  = "host7 service[123]: ERROR here";
+    const string miss = "nothing to see";
+    for (const char* pattern : {"(\\w+)\\[(\\d+)\\]: (ok|ERROR)", "(\\w+) \\1", "(?=s)(\\w+)", "(a|b)*c"}) {
+        const regex re(pattern);
+        smatch m;
+        stdext::smatch_context context;
+        (void) regex_search(hit, m, re, context);
+        (void) regex_search(miss, m, re, context);
+        (void) regex_match(hit, m, re, context);
+
+        const size_t before = g_allocations;
+        for (int i = 0; i < 100; ++i) {
+            (void) regex_search(hit, m, re, context);
+            (void) regex_search(miss, m, re, context);
+            (void) regex_match(hit, m, re, context);
+            (void) regex_search(hit, re, context);
+        }
+
+        assert(g_allocations == before);
+    }
+}
+
+void test_outliving_the_regex() {
+    // the context keeps what it compiled for the last regular expression, even after that one is destroyed
+    stdext::cmatch_context context;
+    cmatch m;
+    const char text[] = "key=value";
+    {
+        const regex re("(\\w+)=(\\w+)");
+        assert(regex_match(text, text + sizeof(text) - 1, m, re, context));
+        assert(m[2] == "value");
+    }
+
+    const regex other("(\\w+)=");
+    assert(regex_search(text, text + sizeof(text) - 1, m, other, context));
+    assert(m[1] == "key" && m.suffix() == "value");
+}
+
+void test_wide() {
+    stdext::wsmatch_context context;
+    wsmatch m;
+    const wstring text = L"alpha beta";
+    assert(regex_search(text, m, wregex(L"(\\w+) (\\w+)"), context));
+    assert(m[2] == L"beta");
+    assert(!regex_match(text, wregex(L"\\w+"), context));
+}
+
+int main() {
+    test_same_results();
+    test_no_allocations();
+    test_outliving_the_regex();
+    test_wide();
+}
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// regex_search looks for the literal text that every match must contain, and jumps straight to the places where a
+// match can begin when that text is a prefix of every match.
+
+string make_log(const size_t lines) {
+    string log;
+    for (size_t i = 0; i < lines; ++i) {
+        log += i % 1000 == 999 ? "ERROR: " : "info: ";
+        log += to_string(i);
+        log += '\n';
+    }
+
+    return log;
+}
+
+void test_leading_literal() {
+    const string log = make_log(10'000);
+    const regex re("ERROR: (\\d+)");
+    smatch m;
+    assert(regex_search(log, m, re));
+    assert(m[1] == "999");
+    assert(m.prefix().length() == m.position(0));
+    assert(log.compare(static_cast<size_t>(m.position(0)), 7, "ERROR: ") == 0);
+
+    vector<string> found;
+    for (sregex_iterator it(log.begin(), log.end(), re), end; it != end; ++it) {
+        found.push_back((*it)[1]);
+    }
+
+    assert(found.size() == 10);
+    assert(found[0] == "999" && found[9] == "9999");
+
+    // the text may occur where no match begins
+    const string near_misses = "ERROR: x ERROR: ERROR: 7";
+    assert(regex_search(near_misses, m, re));
+    assert(m.position(0) == 16 && m[1] == "7");
+}
+
+void test_required_literal() {
+    const regex re("\\d+ ERROR|\\d+ WARN");
+    const regex required("(\\w+)=(\\d*)ms");
+    smatch m;
+    const string text = "took count=12ms";
+    assert(regex_search(text, m, required));
+    assert(m[1] == "count" && m[2] == "12");
+    assert(!regex_search(string("no millis here, count=12"), required));
+    assert(!regex_search(string(), required));
+    assert(regex_search(string("3 WARN"), re));
+}
+
+void test_flags_and_assertions() {
+    smatch m;
+    const string text = "xab ab";
+    assert(regex_search(text, m, regex("\\bab")));
+    assert(m.position(0) == 4);
+    assert(regex_search(text, m, regex("\\Bab")));
+    assert(m.position(0) == 1);
+
+    assert(!regex_search(text, regex("ab"), regex_constants::match_continuous));
+    assert(regex_search(text.begin() + 1, text.end(), regex("ab"), regex_constants::match_continuous));
+
+    const string lines = "one\ntwo";
+    assert(!regex_search(lines, regex("^wo")));
+    assert(!regex_search(lines.begin() + 4, lines.end(), regex("^two"), regex_constants::match_not_bol));
+    assert(!regex_search(lines.begin() + 5, lines.end(), regex("\\bwo"), regex_constants::match_prev_avail));
+
+    const string mixed = "xy-abAB";
+    assert(regex_search(mixed, m, regex("AB", regex_constants::icase)));
+    assert(m.position(0) == 3);
+    assert(regex_search(mixed, m, regex("(?=a)ab")));
+    assert(m.position(0) == 3);
+}
+
+void test_empty_matches() {
+    // a pattern beginning with literal text never matches the empty string, so iteration visits only real matches
+    const string text = "a-b--a";
+    const regex re("-+");
+    vector<ptrdiff_t> positions;
+    for (sregex_iterator it(text.begin(), text.end(), re), end; it != end; ++it) {
+        positions.push_back(it->position(0));
+    }
+
+    assert((positions == vector<ptrdiff_t>{1, 3}));
+    assert(regex_replace(text, re, "+") == "a+b+a");
+    assert(regex_replace(text, regex("a"), "[$&]") == "[a]-b--[a]");
+}
+
+void test_wide() {
+    const wstring text = L"key one=1 key two=2";
+    wsmatch m;
+    assert(regex_search(text, m, wregex(L"two=(\\d)")));
+    assert(m.position(0) == 14 && m[1] == L"2");
+    assert(!regex_search(text, wregex(L"three=\\d")));
+}
+
+int main() {
+    test_leading_literal();
+    test_required_literal();
+    test_flags_and_assertions();
+    test_empty_matches();
+    test_wide();
+}
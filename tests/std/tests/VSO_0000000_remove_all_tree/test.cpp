@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstdint>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+using namespace std;
+using namespace std::filesystem;
+
+const path base = L"test_remove_all_tree";
+
+uintmax_t create_tree(const path& root, const int width, const int depth) {
+    // returns the number of entries created, including root
+    create_directory(root);
+    uintmax_t entries = 1;
+    for (int i = 0; i < width; ++i) {
+        ofstream{root / (L"file" + to_wstring(i))} << i;
+        ++entries;
+        if (depth != 0) {
+            entries += create_tree(root / (L"dir" + to_wstring(i)), width, depth - 1);
+        }
+    }
+
+    if (depth != 0) {
+        create_directory(root / L"empty");
+        ++entries;
+    }
+
+    return entries;
+}
+
+template <class RemoveAll>
+void test_remove_all(RemoveAll remove_all_fn) {
+    const path tree = base / L"tree";
+    for (int depth = 0; depth < 4; ++depth) {
+        const auto entries = create_tree(tree, 4, depth);
+        error_code ec;
+        assert(remove_all_fn(tree, ec) == entries);
+        assert(!ec);
+        assert(!exists(tree));
+    }
+
+    // a deep, narrow tree
+    path deep = tree;
+    for (int i = 0; i < 40; ++i) {
+        deep /= L"d";
+    }
+    create_directories(deep);
+    ofstream{deep / L"leaf"} << "leaf";
+    error_code ec;
+    assert(remove_all_fn(tree, ec) == 42);
+    assert(!ec && !exists(tree));
+
+    // nonexistent paths remove nothing
+    assert(remove_all_fn(base / L"missing", ec) == 0);
+    assert(!ec);
+
+    // a file is removed alone
+    ofstream{base / L"single"} << "x";
+    assert(remove_all_fn(base / L"single", ec) == 1);
+    assert(!ec && !exists(base / L"single"));
+
+    // a directory symlink is removed without touching its target, when this process can create one
+    const auto target_entries = create_tree(base / L"target", 2, 1);
+    create_directory(tree);
+    create_directory_symlink(L"../target", tree / L"link", ec);
+    if (!ec) {
+        assert(remove_all_fn(tree, ec) == 2);
+        assert(!ec && !exists(tree));
+        assert(exists(base / L"target" / L"dir1" / L"file1"));
+    }
+
+    assert(remove_all_fn(base / L"target", ec) == target_entries);
+    assert(!ec);
+    remove_all(tree);
+}
+
+int main() {
+    remove_all(base);
+    create_directory(base);
+    test_remove_all([](const path& p, error_code& ec) { return remove_all(p, ec); });
+    test_remove_all([](const path& p, error_code& ec) { return stdext::filesystem::parallel_remove_all(p, ec); });
+    {
+        stdext::parallel_algorithms_scope serial{nullptr, 1};
+        test_remove_all([](const path& p, error_code& ec) { return stdext::filesystem::parallel_remove_all(p, ec); });
+    }
+
+    const auto entries = create_tree(base / L"tree", 3, 2);
+    assert(stdext::filesystem::parallel_remove_all(base / L"tree") == entries);
+    assert(remove_all(base) == 1);
+}
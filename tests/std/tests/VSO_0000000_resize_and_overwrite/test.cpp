@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+void test_string() {
+    string s = "abc";
+    s.resize_and_overwrite(100, [](char* const p, const size_t n) {
+        assert(n == 100);
+        assert(memcmp(p, "abc", 3) == 0); // the old contents are kept
+        memcpy(p + 3, "defgh", 5);
+        return 8;
+    });
+    assert(s == "abcdefgh");
+    assert(s.capacity() >= 100);
+    assert(s.c_str()[8] == '\0');
+
+    const auto capacity = s.capacity();
+    s.resize_and_overwrite(4, [](char* const p, const size_t n) {
+        assert(n == 4);
+        p[3] = 'x';
+        return n;
+    });
+    assert(s == "abcx");
+    assert(s.capacity() == capacity);
+
+    s.resize_and_overwrite(capacity, [](char*, size_t) { return size_t{0}; });
+    assert(s.empty());
+    assert(s.c_str()[0] == '\0');
+
+    wstring w(30, L'w'); // grows from a large string to a larger one
+    w.resize_and_overwrite(1000, [](wchar_t* const p, const size_t n) {
+        for (size_t i = 30; i < n; ++i) {
+            p[i] = L'v';
+        }
+        return static_cast<unsigned short>(n);
+    });
+    assert(w == wstring(30, L'w') + wstring(970, L'v'));
+}
+
+void test_vector() {
+    vector<unsigned char> v{1, 2, 3};
+    v.resize_and_overwrite(1 << 20, [](unsigned char* const p, const size_t n) {
+        assert(n == 1 << 20);
+        assert(p[0] == 1 && p[1] == 2 && p[2] == 3);
+        for (size_t i = 3; i < n / 2; ++i) {
+            p[i] = static_cast<unsigned char>(i);
+        }
+        return n / 2;
+    });
+    assert(v.size() == 1 << 19);
+    assert(v.capacity() >= 1 << 20);
+    assert(v[0] == 1 && v[2] == 3);
+    for (size_t i = 3; i < v.size(); ++i) {
+        assert(v[i] == static_cast<unsigned char>(i));
+    }
+
+    const auto capacity = v.capacity();
+    v.resize_and_overwrite(10, [](unsigned char*, size_t) { return 2; });
+    assert(v.size() == 2 && v[1] == 2);
+    assert(v.capacity() == capacity);
+
+    vector<int> growing;
+    for (int i = 1; i <= 100; ++i) {
+        const auto old_size = growing.size();
+        growing.resize_and_overwrite(old_size + 1, [&](int* const p, const size_t n) {
+            assert(p == growing.data());
+            p[n - 1] = i;
+            return n;
+        });
+    }
+
+    assert(growing.size() == 100 && growing.front() == 1 && growing.back() == 100);
+    assert(growing.capacity() < 200); // geometric growth
+
+    vector<double> empty_vec;
+    empty_vec.resize_and_overwrite(0, [](double*, size_t) { return 0; });
+    assert(empty_vec.empty());
+}
+
+int main() {
+    test_string();
+    test_vector();
+}
@@ -0,0 +1,416 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if _HAS_CXX17
+#include <memory_resource>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+template <class RingBuffer, class Reference>
+bool same_contents(const RingBuffer& r, const Reference& ref) {
+    return r.size() == ref.size() && equal(r.begin(), r.end(), ref.begin())
+        && equal(r.rbegin(), r.rend(), ref.rbegin())
+        && static_cast<size_t>(r.end() - r.begin()) == ref.size();
+}
+
+int allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    explicit counting_allocator(int id_) noexcept : id(id_) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --allocations;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+
+    int id = 0;
+};
+
+int copies_before_throw = -1;
+
+struct throwing_copy {
+    explicit throwing_copy(int val) noexcept : value(val) {}
+
+    throwing_copy(const throwing_copy& other) : value(other.value) {
+        if (copies_before_throw >= 0 && copies_before_throw-- == 0) {
+            throw runtime_error("copy");
+        }
+    }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+
+    int value;
+};
+
+void test_fifo_without_allocations() {
+    using alloc_t = counting_allocator<int>;
+    {
+        stdext::ring_buffer<int, alloc_t> r;
+        assert(r.empty() && r.capacity() == 0 && allocations == 0);
+
+        r.reserve(100);
+        assert(r.capacity() == 128);
+        assert(allocations == 1);
+
+        // the elements wrap around the end of the array many times without allocating
+        int next_push = 0;
+        int next_pop  = 0;
+        for (int round = 0; round < 1000; ++round) {
+            for (int i = 0; i < 97; ++i) {
+                r.push_back(next_push++);
+            }
+
+            assert(r.size() == 97);
+            assert(r.front() == next_pop);
+            assert(r.back() == next_push - 1);
+            for (int i = 0; i < 97; ++i) {
+                assert(r[static_cast<size_t>(i)] == next_pop + i);
+            }
+
+            while (!r.empty()) {
+                assert(r.front() == next_pop++);
+                r.pop_front();
+            }
+        }
+
+        assert(allocations == 1);
+        assert(r.capacity() == 128);
+    }
+
+    assert(allocations == 0);
+}
+
+void test_growth() {
+    stdext::ring_buffer<string> r;
+    deque<string> ref;
+    r.push_back("a");
+    ref.push_back("a");
+    assert(r.capacity() == 8);
+
+    // grow while the elements wrap around, at both ends
+    for (int i = 0; i < 6; ++i) {
+        r.pop_front();
+        ref.pop_front();
+        r.push_back(to_string(i));
+        ref.push_back(to_string(i));
+        r.push_back(to_string(i + 100));
+        ref.push_back(to_string(i + 100));
+    }
+
+    assert(same_contents(r, ref));
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0) {
+            r.push_front(to_string(-i));
+            ref.push_front(to_string(-i));
+        } else {
+            r.emplace_back(static_cast<size_t>(i % 7), 'x');
+            ref.emplace_back(static_cast<size_t>(i % 7), 'x');
+        }
+
+        assert(same_contents(r, ref));
+        const size_t cap = r.capacity();
+        assert(cap >= r.size() && (cap & (cap - 1)) == 0);
+    }
+
+    // the argument may be an element of the ring_buffer being grown
+    while (!r.full()) {
+        r.push_back(r.front());
+        ref.push_back(ref.front());
+    }
+
+    r.push_back(r.front());
+    ref.push_back(ref.front());
+    r.push_front(r.back());
+    ref.push_front(ref.back());
+    assert(same_contents(r, ref));
+
+    while (r.size() > 3) {
+        r.pop_back();
+        ref.pop_back();
+        if (r.size() > 3) {
+            r.pop_front();
+            ref.pop_front();
+        }
+    }
+
+    assert(same_contents(r, ref));
+    r.shrink_to_fit();
+    assert(r.capacity() == 4);
+    assert(same_contents(r, ref));
+    r.clear();
+    r.shrink_to_fit();
+    assert(r.capacity() == 0);
+}
+
+void test_iterators() {
+    stdext::ring_buffer<int> r;
+    r.reserve(8);
+    for (int i = 0; i < 6; ++i) {
+        r.push_back(i);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        r.pop_front();
+        r.push_back(i + 6);
+    }
+
+    // 4 5 6 7 8 9, wrapped
+    const auto first = r.begin();
+    assert(*first == 4);
+    assert(first[5] == 9);
+    assert(*(first + 3) == 7);
+    assert(*(3 + first) == 7);
+    assert(*(r.end() - 1) == 9);
+    assert(r.end() - r.begin() == 6);
+    assert(r.begin() < r.end() && r.end() > r.begin());
+    assert(r.begin() <= r.begin() && r.begin() >= r.begin());
+    assert(r.cbegin() == r.begin());
+
+    auto it = r.begin();
+    ++it;
+    it++;
+    it += 2;
+    assert(*it == 8);
+    --it;
+    it--;
+    it -= 1;
+    assert(*it == 5);
+
+    *it = 50;
+    assert(r[1] == 50);
+
+    // positions don't move when elements are pushed at the back or popped at the front
+    const auto sixth = r.begin() + 5;
+    r.pop_front();
+    r.push_back(10);
+    assert(*sixth == 9);
+
+    sort(r.begin(), r.end(), greater<>{});
+    assert(r.front() == 50 && r.back() == 6);
+    reverse(r.begin(), r.end());
+    assert(is_sorted(r.cbegin(), r.cend()));
+
+    const stdext::ring_buffer<int>& cr = r;
+    assert(*cr.crbegin() == 50);
+    assert(cr.at(0) == 6);
+
+    bool threw = false;
+    try {
+        (void) cr.at(6);
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+
+    assert(threw);
+}
+
+void test_constructors_and_assignment() {
+    using alloc_t = counting_allocator<int>;
+    {
+        const stdext::ring_buffer<int, alloc_t> filled(5, 7);
+        assert(filled.size() == 5 && filled.capacity() == 8);
+        assert(count(filled.begin(), filled.end(), 7) == 5);
+
+        stdext::ring_buffer<int, alloc_t> ilist{1, 2, 3};
+        stdext::ring_buffer<int, alloc_t> sized(3);
+        assert(sized == (stdext::ring_buffer<int, alloc_t>{0, 0, 0}));
+        assert(sized < ilist && ilist > sized && sized <= ilist && ilist >= sized && sized != ilist);
+
+        const int arr[] = {4, 5, 6, 7};
+        const deque<int> arr_ref(begin(arr), end(arr));
+        stdext::ring_buffer<int, alloc_t> ranged(begin(arr), end(arr));
+        assert(same_contents(ranged, arr_ref));
+
+        stdext::ring_buffer<int, alloc_t> copied(ranged);
+        assert(copied == ranged);
+
+        stdext::ring_buffer<int, alloc_t> moved(move(copied));
+        assert(copied.empty() && copied.capacity() == 0);
+        assert(moved == ranged);
+
+        // unequal allocators move the elements one by one
+        stdext::ring_buffer<int, alloc_t> other_alloc(move(moved), alloc_t{1});
+        assert(other_alloc == ranged && other_alloc.get_allocator().id == 1);
+
+        copied = ilist;
+        assert(copied == ilist);
+        copied = move(ranged);
+        assert(same_contents(copied, arr_ref));
+        copied = {9, 8};
+        assert(copied.size() == 2 && copied.front() == 9);
+
+        copied.assign(3, 1);
+        assert(copied == (stdext::ring_buffer<int, alloc_t>{1, 1, 1}));
+        copied.assign(begin(arr), end(arr));
+        assert(same_contents(copied, arr_ref));
+
+        copied.resize(6);
+        assert(copied.size() == 6 && copied.back() == 0);
+        copied.resize(2);
+        assert(copied.size() == 2 && copied.back() == 5);
+        copied.resize(20, copied.front());
+        assert(copied.size() == 20 && copied.back() == 4);
+
+        swap(copied, sized);
+        assert(copied.size() == 3 && sized.size() == 20);
+        sized.swap(copied);
+        assert(copied.size() == 20);
+    }
+
+    assert(allocations == 0);
+}
+
+void test_exception_safety() {
+    stdext::ring_buffer<throwing_copy> r;
+    for (int i = 0; i < 8; ++i) {
+        r.emplace_back(i);
+    }
+
+    r.pop_front();
+    r.pop_front();
+    r.emplace_back(8);
+    r.emplace_back(9);
+    assert(r.full());
+
+    // throwing_copy's move may throw, so growing copies the elements; a failure leaves r unchanged
+    const throwing_copy extra{10};
+    for (int fail_at = 0; fail_at < 9; ++fail_at) {
+        copies_before_throw = fail_at;
+        bool threw          = false;
+        try {
+            r.push_back(extra);
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+
+        assert(threw);
+        assert(r.size() == 8 && r.capacity() == 8);
+        for (int i = 0; i < 8; ++i) {
+            assert(r[static_cast<size_t>(i)].value == i + 2);
+        }
+    }
+
+    copies_before_throw = -1;
+    r.push_back(extra);
+    assert(r.size() == 9 && r.capacity() == 16 && r.back().value == 10);
+
+    // so do resize and the constructors
+    copies_before_throw = 3;
+    bool threw          = false;
+    try {
+        r.resize(20, extra);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+
+    assert(threw && r.size() == 9);
+    copies_before_throw = -1;
+}
+
+void test_adaptors() {
+    queue<string, stdext::ring_buffer<string>> q;
+    queue<string> ref;
+    for (int i = 0; i < 100; ++i) {
+        q.push(to_string(i));
+        ref.push(to_string(i));
+        q.emplace(to_string(i + 1000));
+        ref.emplace(to_string(i + 1000));
+        assert(q.front() == ref.front() && q.back() == ref.back());
+        q.pop();
+        ref.pop();
+    }
+
+    assert(q.size() == 100);
+    assert(q.back() == "1099");
+
+    stack<int, stdext::ring_buffer<int>> s;
+    for (int i = 0; i < 50; ++i) {
+        s.push(i);
+    }
+
+    for (int i = 49; i >= 0; --i) {
+        assert(s.top() == i);
+        s.pop();
+    }
+
+    assert(s.empty());
+
+    priority_queue<int, stdext::ring_buffer<int>> pq;
+    mt19937 gen{1729};
+    for (int i = 0; i < 200; ++i) {
+        pq.push(static_cast<int>(gen() % 1000));
+    }
+
+    int last = 1000;
+    while (!pq.empty()) {
+        assert(pq.top() <= last);
+        last = pq.top();
+        pq.pop();
+    }
+}
+
+#if _HAS_CXX17
+void test_pmr() {
+    pmr::monotonic_buffer_resource resource;
+    stdext::pmr::ring_buffer<pmr::string> r{&resource};
+    for (int i = 0; i < 100; ++i) {
+        r.emplace_back(static_cast<size_t>(i), 'a');
+        if (i % 2 == 0) {
+            r.pop_front();
+        }
+    }
+
+    assert(r.size() == 50);
+    assert(r.front().size() == 50);
+    assert(r.front().get_allocator().resource() == &resource);
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_fifo_without_allocations();
+    test_growth();
+    test_iterators();
+    test_constructors_and_assignment();
+    test_exception_safety();
+    test_adaptors();
+#if _HAS_CXX17
+    test_pmr();
+#endif // _HAS_CXX17
+}
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <chrono>
+#include <semaphore>
+#include <thread>
+
+using namespace std;
+using namespace std::chrono;
+
+// The bounds are loose: the tests can't depend on the scheduler, only check that the timeouts aren't ignored.
+constexpr auto short_timeout = microseconds{500};
+constexpr auto upper_bound   = seconds{5};
+
+template <class Semaphore>
+void test_short_timeouts() {
+    Semaphore sem{0};
+
+    auto start = steady_clock::now();
+    assert(!sem.try_acquire_for(short_timeout));
+    auto elapsed = steady_clock::now() - start;
+    assert(elapsed >= short_timeout);
+    assert(elapsed < upper_bound);
+
+    start = steady_clock::now();
+    assert(!sem.try_acquire_until(start + short_timeout));
+    elapsed = steady_clock::now() - start;
+    assert(elapsed >= short_timeout);
+    assert(elapsed < upper_bound);
+
+    // a deadline on another clock is converted
+    const auto system_start = system_clock::now();
+    assert(!sem.try_acquire_until(system_start + short_timeout));
+    assert(system_clock::now() - system_start < upper_bound);
+
+    // timeouts of zero or less, and deadlines already passed, only try to acquire
+    assert(!sem.try_acquire_for(nanoseconds::zero()));
+    assert(!sem.try_acquire_for(-milliseconds{1}));
+    assert(!sem.try_acquire_until(steady_clock::now() - seconds{1}));
+
+    sem.release();
+    assert(sem.try_acquire_for(short_timeout));
+    sem.release();
+    assert(sem.try_acquire_until(steady_clock::now() + short_timeout));
+}
+
+template <class Semaphore>
+void test_repeated_short_timeouts() {
+    // the timers used for precise timeouts are reused
+    Semaphore sem{0};
+    for (int i = 0; i < 200; ++i) {
+        assert(!sem.try_acquire_for(microseconds{50}));
+    }
+}
+
+template <class Semaphore>
+void test_release_wakes_timed_waiter() {
+    Semaphore sem{0};
+    thread waiter{[&] {
+        const auto start = steady_clock::now();
+        assert(sem.try_acquire_for(minutes{1}));
+        assert(steady_clock::now() - start < seconds{30});
+    }};
+
+    this_thread::sleep_for(milliseconds{20});
+    sem.release();
+    waiter.join();
+}
+
+template <class Semaphore>
+void test_release_wakes_precise_waiters() {
+    // waiters whose deadlines are too close for the system timer are woken by release, too
+    Semaphore sem{0};
+    bool acquired = false;
+    thread waiter{[&] {
+        while (!sem.try_acquire_for(microseconds{200})) {
+        }
+        acquired = true;
+    }};
+
+    this_thread::sleep_for(milliseconds{20});
+    sem.release();
+    waiter.join();
+    assert(acquired);
+}
+
+void test_many_waiters() {
+    counting_semaphore<> sem{0};
+    constexpr int count = 8;
+    thread waiters[count];
+    for (auto& waiter : waiters) {
+        waiter = thread{[&] {
+            while (!sem.try_acquire_for(microseconds{300})) {
+            }
+        }};
+    }
+
+    sem.release(count);
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+
+    assert(!sem.try_acquire());
+}
+
+int main() {
+    test_short_timeouts<counting_semaphore<>>();
+    test_short_timeouts<binary_semaphore>();
+    test_repeated_short_timeouts<counting_semaphore<>>();
+    test_repeated_short_timeouts<binary_semaphore>();
+    test_release_wakes_timed_waiter<counting_semaphore<>>();
+    test_release_wakes_timed_waiter<binary_semaphore>();
+    test_release_wakes_precise_waiters<counting_semaphore<>>();
+    test_release_wakes_precise_waiters<binary_semaphore>();
+    test_many_waiters();
+}
@@ -0,0 +1,308 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class SmallVector, class Reference>
+bool same_contents(const SmallVector& v, const Reference& ref) {
+    return v.size() == ref.size() && equal(v.begin(), v.end(), ref.begin())
+        && static_cast<size_t>(distance(v.rbegin(), v.rend())) == ref.size();
+}
+
+int allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    explicit counting_allocator(int id_) noexcept : id(id_) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --allocations;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+
+    int id = 0;
+};
+
+int copies_before_throw = -1;
+
+struct throwing_copy {
+    explicit throwing_copy(int val) noexcept : value(val) {}
+
+    throwing_copy(const throwing_copy& other) : value(other.value) {
+        if (copies_before_throw >= 0 && copies_before_throw-- == 0) {
+            throw runtime_error("copy");
+        }
+    }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+
+    int value;
+};
+
+void test_inline_storage() {
+    using alloc_t = counting_allocator<int>;
+    stdext::small_vector<int, 4, alloc_t> v;
+    assert(v.empty() && v.is_inline());
+    assert(v.capacity() == 4 && v.inline_capacity == 4);
+
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+
+    assert(v.is_inline() && allocations == 0);
+    v.push_back(4);
+    assert(!v.is_inline() && allocations == 1);
+    assert(v.capacity() == 6); // geometric growth, as vector does
+
+    v.resize(2);
+    v.shrink_to_fit();
+    assert(v.is_inline() && allocations == 0);
+    assert(v.size() == 2 && v[0] == 0 && v[1] == 1);
+
+    v.reserve(100);
+    assert(!v.is_inline() && v.capacity() == 100);
+    v.clear();
+    assert(v.capacity() == 100);
+}
+
+template <class T, size_t N, class Make>
+void test_against_vector(const unsigned int seed, Make make) {
+    mt19937 gen(seed);
+    stdext::small_vector<T, N> v;
+    vector<T> ref;
+    for (int step = 0; step < 5'000; ++step) {
+        const auto val = make(static_cast<int>(gen() % 1000));
+        const auto pos = ref.empty() ? size_t{0} : gen() % (ref.size() + 1);
+        switch (gen() % 12) {
+        case 0:
+        case 1:
+        case 2:
+            v.push_back(val);
+            ref.push_back(val);
+            break;
+        case 3:
+            v.emplace(v.begin() + pos, val);
+            ref.emplace(ref.begin() + static_cast<ptrdiff_t>(pos), val);
+            break;
+        case 4:
+            v.insert(v.begin() + pos, 3, val);
+            ref.insert(ref.begin() + static_cast<ptrdiff_t>(pos), 3, val);
+            break;
+        case 5:
+            {
+                const T arr[] = {val, val, make(-1)};
+                v.insert(v.begin() + pos, begin(arr), end(arr));
+                ref.insert(ref.begin() + static_cast<ptrdiff_t>(pos), begin(arr), end(arr));
+            }
+            break;
+        case 6:
+        case 7:
+            if (!ref.empty() && pos != ref.size()) {
+                assert(v.erase(v.begin() + pos) == v.begin() + pos);
+                ref.erase(ref.begin() + static_cast<ptrdiff_t>(pos));
+            }
+            break;
+        case 8:
+            {
+                const auto last = pos + (ref.size() - pos) / 2;
+                v.erase(v.begin() + pos, v.begin() + last);
+                ref.erase(ref.begin() + static_cast<ptrdiff_t>(pos), ref.begin() + static_cast<ptrdiff_t>(last));
+            }
+            break;
+        case 9:
+            if (!ref.empty()) {
+                v.pop_back();
+                ref.pop_back();
+            }
+            break;
+        case 10:
+            v.resize(pos, val);
+            ref.resize(pos, val);
+            break;
+        default:
+            if (gen() % 4 == 0) {
+                v.shrink_to_fit();
+                assert(v.is_inline() == (v.size() <= N));
+            }
+            break;
+        }
+
+        assert(same_contents(v, ref));
+        if (ref.size() > 200) {
+            v.erase(v.begin() + 10, v.end());
+            ref.erase(ref.begin() + 10, ref.end());
+        }
+    }
+}
+
+void test_aliasing() {
+    stdext::small_vector<string, 2> v{"first", "second"};
+    v.push_back(v[0]); // moves from inline to allocated storage
+    v.insert(v.begin(), 5, v[1]);
+    v.resize(20, v.back());
+    v.emplace(v.begin() + 1, v[6]);
+    const vector<string> expected{"second", "second", "second", "second", "second", "second", "first", "second"};
+    assert(v.size() == 21 && equal(expected.begin(), expected.end(), v.begin()));
+    assert(all_of(v.begin() + 8, v.end(), [](const string& str) { return str == "first"; }));
+}
+
+void test_copy_move_swap() {
+    using vec = stdext::small_vector<unique_ptr<int>, 3>;
+    vec inline_vec;
+    inline_vec.push_back(make_unique<int>(1));
+    inline_vec.push_back(make_unique<int>(2));
+    vec heap_vec;
+    for (int i = 0; i < 10; ++i) {
+        heap_vec.push_back(make_unique<int>(i + 100));
+    }
+
+    vec moved_inline(move(inline_vec));
+    assert(moved_inline.size() == 2 && *moved_inline[1] == 2 && moved_inline.is_inline());
+    assert(inline_vec.empty()); // implementation assumption; the source is left empty
+
+    const auto heap_data = heap_vec.data();
+    vec moved_heap(move(heap_vec));
+    assert(moved_heap.data() == heap_data && heap_vec.empty() && heap_vec.is_inline());
+
+    swap(moved_inline, moved_heap);
+    assert(moved_inline.size() == 10 && moved_inline.data() == heap_data);
+    assert(moved_heap.size() == 2 && *moved_heap[0] == 1 && moved_heap.is_inline());
+
+    vec other;
+    other.emplace_back(new int(7));
+    other.swap(moved_heap);
+    assert(other.size() == 2 && *other[1] == 2);
+    assert(moved_heap.size() == 1 && *moved_heap[0] == 7);
+
+    moved_heap = move(moved_inline);
+    assert(moved_heap.size() == 10 && moved_heap.data() == heap_data && moved_inline.empty());
+    moved_inline = move(other);
+    assert(moved_inline.size() == 2 && *moved_inline[0] == 1 && other.empty());
+
+    const stdext::small_vector<string, 2> strings{"a", "b", "c"};
+    auto copy = strings;
+    assert(copy == strings && !copy.is_inline());
+    stdext::small_vector<string, 2> assigned{"x"};
+    assigned = strings;
+    assert(assigned == strings);
+    assigned = {"y"};
+    assert(assigned.size() == 1 && assigned[0] == "y");
+    assert(assigned > strings && strings < assigned && strings <= copy && copy >= strings && assigned != copy);
+}
+
+void test_unequal_allocators() {
+    using alloc_t = counting_allocator<string>;
+    using vec     = stdext::small_vector<string, 2, alloc_t>;
+    vec left(alloc_t{1});
+    for (int i = 0; i < 10; ++i) {
+        left.push_back(to_string(i));
+    }
+
+    vec right(move(left), alloc_t{2});
+    assert(right.get_allocator().id == 2 && right.size() == 10 && right[9] == "9");
+
+    vec third(alloc_t{3});
+    third = move(right); // the allocator doesn't propagate, so the elements are moved one by one
+    assert(third.get_allocator().id == 3 && third.size() == 10 && third[4] == "4");
+
+    {
+        vec tmp(third.begin(), third.end(), alloc_t{4});
+        assert(tmp == third);
+    }
+
+    left.clear();
+    left.shrink_to_fit();
+    right.clear();
+    right.shrink_to_fit();
+    third.clear();
+    third.shrink_to_fit();
+    assert(allocations == 0);
+}
+
+void test_strong_guarantee() {
+    stdext::small_vector<throwing_copy, 2> v;
+    v.emplace_back(1);
+    v.emplace_back(2);
+    throwing_copy extra(3);
+    copies_before_throw = 1; // copying the old elements to allocated storage throws
+    bool threw = false;
+    try {
+        v.push_back(extra);
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+
+    copies_before_throw = -1;
+    assert(threw);
+    assert(v.size() == 2 && v.is_inline() && v[0].value == 1 && v[1].value == 2);
+
+    v.push_back(extra);
+    assert(v.size() == 3 && v[2].value == 3);
+    bool out_of_range_thrown = false;
+    try {
+        (void) v.at(3);
+    } catch (const out_of_range&) {
+        out_of_range_thrown = true;
+    }
+
+    assert(out_of_range_thrown);
+}
+
+void test_input_iterators() {
+    istringstream stream("1 2 3 4 5 6 7");
+    stdext::small_vector<int, 4> v(istream_iterator<int>{stream}, istream_iterator<int>{});
+    assert(v.size() == 7 && v.back() == 7);
+
+    istringstream more("10 11");
+    v.insert(v.begin() + 1, istream_iterator<int>{more}, istream_iterator<int>{});
+    const int expected[] = {1, 10, 11, 2, 3, 4, 5, 6, 7};
+    assert(v.size() == size(expected) && equal(v.begin(), v.end(), begin(expected)));
+
+    v.assign(3, 42);
+    assert(v.size() == 3 && v.front() == 42 && v.back() == 42);
+}
+
+int main() {
+    test_inline_storage();
+    test_against_vector<int, 4>(1729, [](int i) { return i; });
+    test_against_vector<string, 3>(1234, [](int i) { return i % 2 == 0 ? to_string(i) : string(40, 'x'); });
+    test_against_vector<int, 64>(42, [](int i) { return i; });
+    test_aliasing();
+    test_copy_move_swap();
+    test_unequal_allocators();
+    test_strong_guarantee();
+    test_input_iterators();
+}
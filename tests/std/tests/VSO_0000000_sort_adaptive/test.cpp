@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#if _ITERATOR_DEBUG_LEVEL == 2
+constexpr size_t debug_factor = 2; // _DEBUG_LT_PRED checks the reverse comparison whenever a comparison is true
+#else // ^^^ _ITERATOR_DEBUG_LEVEL == 2 / _ITERATOR_DEBUG_LEVEL != 2 vvv
+constexpr size_t debug_factor = 1;
+#endif // ^^^ _ITERATOR_DEBUG_LEVEL != 2 ^^^
+
+size_t comparisons = 0;
+
+struct counting_less {
+    bool operator()(const int left, const int right) const {
+        ++comparisons;
+        return left < right;
+    }
+};
+
+size_t max_comparisons(const size_t n) {
+    return n < 2 ? 0 : debug_factor * static_cast<size_t>(3 * static_cast<double>(n) * log2(static_cast<double>(n)));
+}
+
+template <class Pred>
+void test_pattern(vector<int> v, Pred pred) {
+    auto expected = v;
+    stable_sort(expected.begin(), expected.end(), pred);
+
+    auto copy   = v;
+    comparisons = 0;
+    sort(v.begin(), v.end(), counting_less{});
+    assert(is_sorted(v.begin(), v.end()));
+    assert(comparisons <= max_comparisons(v.size()));
+
+    sort(copy.begin(), copy.end(), pred);
+    assert(copy == expected);
+}
+
+void test_patterns(const size_t n, mt19937& gen) {
+    vector<int> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(gen() % 1'000'000);
+    }
+    test_pattern(v, less<>{});
+    test_pattern(v, greater<int>{});
+
+    for (size_t i = 0; i < n; ++i) { // few distinct values
+        v[i] = static_cast<int>(gen() % 4);
+    }
+    test_pattern(v, less<>{});
+    test_pattern(v, greater<>{});
+
+    for (size_t i = 0; i < n; ++i) { // organ pipe
+        v[i] = static_cast<int>(i < n / 2 ? i : n - i);
+    }
+    test_pattern(v, less<>{});
+
+    for (size_t i = 0; i < n; ++i) { // sawtooth
+        v[i] = static_cast<int>(i % 100);
+    }
+    test_pattern(v, less<>{});
+
+    for (size_t i = 0; i < n; ++i) { // interleaved ascending and descending
+        v[i] = static_cast<int>(i % 2 == 0 ? i : n - i);
+    }
+    test_pattern(v, less<>{});
+
+    for (size_t i = 0; i < n; ++i) { // sorted, then a random tail
+        v[i] = static_cast<int>(i < n - n / 10 ? i : gen() % (n + 1));
+    }
+    test_pattern(v, less<>{});
+
+    for (size_t i = 0; i < n; ++i) { // sorted, then a few elements out of place
+        v[i] = static_cast<int>(i);
+    }
+    for (int swaps = 0; swaps < 5 && n != 0; ++swaps) {
+        swap(v[gen() % n], v[gen() % n]);
+    }
+    test_pattern(v, less<>{});
+}
+
+void test_presorted(const size_t n) {
+    // large enough ascending and descending inputs take one pass
+    vector<int> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = static_cast<int>(i / 3);
+    }
+
+    auto expected = v;
+    comparisons   = 0;
+    sort(v.begin(), v.end(), counting_less{});
+    assert(v == expected);
+    assert(comparisons <= debug_factor * n);
+
+    reverse(v.begin(), v.end());
+    comparisons = 0;
+    sort(v.begin(), v.end(), counting_less{});
+    assert(v == expected);
+    assert(comparisons <= debug_factor * n);
+
+    reverse(v.begin(), v.end());
+    sort(execution::par, v.begin(), v.end());
+    assert(v == expected);
+}
+
+void test_adversary(const int n) {
+    // M. D. McIlroy, "A Killer Adversary for Quicksort": values are decided as the sort compares them,
+    // so that every pivot the sort picks is as small as possible
+    const int gas = n;
+    vector<int> values(static_cast<size_t>(n), gas);
+    vector<int> order(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        order[static_cast<size_t>(i)] = i;
+    }
+
+    int solid     = 0;
+    int candidate = 0;
+    comparisons   = 0;
+    sort(order.begin(), order.end(), [&](const int left, const int right) {
+        ++comparisons;
+        auto& l = values[static_cast<size_t>(left)];
+        auto& r = values[static_cast<size_t>(right)];
+        if (l == gas && r == gas) {
+            if (left == candidate) {
+                l = solid++;
+            } else {
+                r = solid++;
+            }
+        }
+
+        if (l == gas) {
+            candidate = left;
+        } else if (r == gas) {
+            candidate = right;
+        }
+
+        return l < r;
+    });
+
+    assert(comparisons <= max_comparisons(static_cast<size_t>(n)));
+}
+
+void test_strings(mt19937& gen) {
+    vector<string> v(5'000);
+    for (auto& str : v) {
+        str = to_string(gen() % 1'000);
+    }
+
+    auto expected = v;
+    stable_sort(expected.begin(), expected.end());
+    sort(v.begin(), v.end());
+    assert(v == expected);
+
+    sort(v.begin(), v.end());
+    assert(v == expected);
+}
+
+void test_floating_point(mt19937& gen) {
+    vector<double> v(10'000);
+    for (auto& val : v) {
+        val = static_cast<double>(gen() % 997) / 7.0;
+    }
+
+    auto expected = v;
+    stable_sort(expected.begin(), expected.end(), greater<>{});
+    sort(v.begin(), v.end(), greater<>{});
+    assert(v == expected);
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    int arr[200]{};
+    for (int i = 0; i < 200; ++i) {
+        arr[i] = (i * 71) % 200;
+    }
+
+    sort(begin(arr), end(arr));
+    for (int i = 0; i < 200; ++i) {
+        if (arr[i] != i) {
+            return false;
+        }
+    }
+
+    sort(begin(arr), end(arr), greater<>{});
+    return arr[0] == 199 && arr[199] == 0;
+}
+
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    mt19937 gen(1729);
+    for (const size_t n : {0, 1, 2, 31, 32, 33, 40, 41, 100, 129, 1'000, 4'096, 100'000}) {
+        test_patterns(n, gen);
+    }
+
+    test_presorted(1'000);
+    test_presorted(100'000);
+
+    test_adversary(1'000);
+    test_adversary(50'000);
+    test_strings(gen);
+    test_floating_point(gen);
+}
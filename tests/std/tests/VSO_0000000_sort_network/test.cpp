@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+void test_zero_one() {
+    // by the 0-1 principle, a sorting network that sorts every sequence of zeros and ones sorts everything
+    for (size_t n = 0; n <= 16; ++n) {
+        for (unsigned int bits = 0; bits < (1u << n); ++bits) {
+            int arr[16];
+            int ones = 0;
+            for (size_t i = 0; i < n; ++i) {
+                arr[i] = (bits >> i) & 1;
+                ones += arr[i];
+            }
+
+            sort(arr, arr + n);
+            for (size_t i = 0; i < n; ++i) {
+                assert(arr[i] == (i >= n - static_cast<size_t>(ones) ? 1 : 0));
+            }
+
+            sort(arr, arr + n, greater<>{});
+            for (size_t i = 0; i < n; ++i) {
+                assert(arr[i] == (i < static_cast<size_t>(ones) ? 1 : 0));
+            }
+        }
+    }
+}
+
+template <class T, class Pred>
+void test_random(mt19937& gen, Pred pred) {
+    uniform_int_distribution<long long> dist(static_cast<long long>(numeric_limits<T>::min()),
+        static_cast<long long>(numeric_limits<T>::max() < 1'000 ? numeric_limits<T>::max() : 1'000));
+    for (size_t n = 0; n <= 40; ++n) {
+        for (int trial = 0; trial < 200; ++trial) {
+            vector<T> v(n);
+            for (auto& val : v) {
+                val = static_cast<T>(dist(gen));
+            }
+
+            auto expected = v;
+            stable_sort(expected.begin(), expected.end(), pred);
+            sort(v.begin(), v.end(), pred);
+            assert(v == expected);
+        }
+    }
+}
+
+template <class T>
+void test_type(mt19937& gen) {
+    test_random<T>(gen, less<>{});
+    test_random<T>(gen, less<T>{});
+    test_random<T>(gen, greater<>{});
+    test_random<T>(gen, greater<T>{});
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    for (int n = 0; n <= 16; ++n) {
+        int arr[16]{};
+        for (int i = 0; i < n; ++i) {
+            arr[i] = (i * 17 + 3) % n;
+        }
+
+        sort(arr, arr + n);
+        for (int i = 0; i < n; ++i) {
+            if (arr[i] != i) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    test_zero_one();
+
+    mt19937 gen(1729);
+    test_type<signed char>(gen);
+    test_type<unsigned char>(gen);
+    test_type<short>(gen);
+    test_type<unsigned short>(gen);
+    test_type<int>(gen);
+    test_type<unsigned int>(gen);
+    test_type<long long>(gen);
+    test_type<unsigned long long>(gen);
+    test_type<double>(gen);
+}
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+bool same_value(const T actual, const T expected) {
+    return actual == expected || (isnan(actual) && isnan(expected));
+}
+
+template <class T>
+bool close_to(const T actual, const T expected) {
+    // the polynomial recurrences are evaluated in blocks, so allow for differences in floating-point contraction
+    if (isnan(expected) || isinf(expected)) {
+        return same_value(actual, expected);
+    }
+
+    const T scale = abs(expected) < 1 ? T{1} : abs(expected);
+    return abs(actual - expected) <= 1024 * numeric_limits<T>::epsilon() * scale;
+}
+
+template <class T>
+vector<T> make_grid(const T low, const T high, const size_t n) {
+    vector<T> values;
+    for (size_t i = 0; i < n; ++i) {
+        values.push_back(low + (high - low) * static_cast<T>(i) / static_cast<T>(n));
+    }
+
+    values.push_back(numeric_limits<T>::quiet_NaN());
+    return values;
+}
+
+template <class T, class Batch, class Scalar>
+void check_exact(const vector<T>& x, Batch batch, Scalar scalar) {
+    vector<T> out(x.size());
+    batch(x.data(), x.data() + x.size(), out.data());
+    for (size_t i = 0; i < x.size(); ++i) {
+        assert(same_value(out[i], scalar(x[i])));
+    }
+
+    // in place
+    vector<T> inout = x;
+    batch(inout.data(), inout.data() + inout.size(), inout.data());
+    for (size_t i = 0; i < x.size(); ++i) {
+        assert(same_value(inout[i], out[i]));
+    }
+
+    // empty ranges do not touch the output
+    batch(x.data(), x.data(), nullptr);
+}
+
+template <class T, class Batch, class Scalar>
+void check_close(const vector<T>& x, Batch batch, Scalar scalar) {
+    vector<T> out(x.size());
+    batch(x.data(), x.data() + x.size(), out.data());
+    for (size_t i = 0; i < x.size(); ++i) {
+        assert(close_to(out[i], scalar(x[i])));
+    }
+
+    vector<T> inout = x;
+    batch(inout.data(), inout.data() + inout.size(), inout.data());
+    for (size_t i = 0; i < x.size(); ++i) {
+        assert(same_value(inout[i], out[i]));
+    }
+}
+
+template <class T>
+void test_bessel() {
+    const auto x = make_grid<T>(0, 40, 300);
+    for (const T nu : {T{0}, T{1}, T{2.5}, T{7}}) {
+        check_exact(
+            x, [=](const T* f, const T* l, T* d) { stdext::cyl_bessel_j(nu, f, l, d); },
+            [=](const T v) { return cyl_bessel_j(nu, v); });
+        check_exact(
+            x, [=](const T* f, const T* l, T* d) { stdext::cyl_bessel_i(nu, f, l, d); },
+            [=](const T v) { return cyl_bessel_i(nu, v); });
+    }
+
+    const auto positive = make_grid<T>(T{0.25}, 40, 300);
+    for (const T nu : {T{0}, T{1}, T{3.5}}) {
+        check_exact(
+            positive, [=](const T* f, const T* l, T* d) { stdext::cyl_bessel_k(nu, f, l, d); },
+            [=](const T v) { return cyl_bessel_k(nu, v); });
+        check_exact(
+            positive, [=](const T* f, const T* l, T* d) { stdext::cyl_neumann(nu, f, l, d); },
+            [=](const T v) { return cyl_neumann(nu, v); });
+    }
+
+    for (const unsigned int n : {0u, 1u, 4u}) {
+        check_exact(
+            x, [=](const T* f, const T* l, T* d) { stdext::sph_bessel(n, f, l, d); },
+            [=](const T v) { return sph_bessel(n, v); });
+        check_exact(
+            positive, [=](const T* f, const T* l, T* d) { stdext::sph_neumann(n, f, l, d); },
+            [=](const T v) { return sph_neumann(n, v); });
+    }
+
+    // a NaN order produces NaN everywhere
+    vector<T> out(x.size());
+    stdext::cyl_bessel_j(numeric_limits<T>::quiet_NaN(), x.data(), x.data() + x.size(), out.data());
+    for (const T v : out) {
+        assert(isnan(v));
+    }
+}
+
+template <class T>
+void test_polynomials() {
+    const auto unit = make_grid<T>(-1, 1, 257);
+    const auto wide = make_grid<T>(-6, 6, 150);
+    for (const unsigned int n : {0u, 1u, 2u, 5u, 12u, 30u}) {
+        check_close(
+            unit, [=](const T* f, const T* l, T* d) { stdext::legendre(n, f, l, d); },
+            [=](const T v) { return legendre(n, v); });
+        check_close(
+            wide, [=](const T* f, const T* l, T* d) { stdext::hermite(n, f, l, d); },
+            [=](const T v) { return hermite(n, v); });
+        check_close(
+            wide, [=](const T* f, const T* l, T* d) { stdext::laguerre(n, f, l, d); },
+            [=](const T v) { return laguerre(n, v); });
+    }
+
+    // arguments outside [-1, 1] are domain errors for legendre, reported per element
+    const T outside[] = {T{0.5}, T{1.5}, T{-2}, T{-1}};
+    T out[4]{};
+    errno = 0;
+    stdext::legendre(3, begin(outside), end(outside), out);
+    assert(errno == EDOM);
+    assert(out[0] == legendre(3, T{0.5}));
+    assert(isnan(out[1]));
+    assert(isnan(out[2]));
+    assert(out[3] == legendre(3, T{-1}));
+}
+
+template <class T>
+void test_unary() {
+    const auto k = make_grid<T>(T{-0.99}, T{0.99}, 200);
+    check_exact(
+        k, [](const T* f, const T* l, T* d) { stdext::comp_ellint_1(f, l, d); },
+        [](const T v) { return comp_ellint_1(v); });
+    check_exact(
+        k, [](const T* f, const T* l, T* d) { stdext::comp_ellint_2(f, l, d); },
+        [](const T v) { return comp_ellint_2(v); });
+
+    const auto x = make_grid<T>(-20, 20, 199);
+    check_exact(
+        x, [](const T* f, const T* l, T* d) { stdext::expint(f, l, d); }, [](const T v) { return expint(v); });
+    check_exact(
+        x, [](const T* f, const T* l, T* d) { stdext::riemann_zeta(f, l, d); },
+        [](const T v) { return riemann_zeta(v); });
+}
+
+int main() {
+    test_bessel<double>();
+    test_bessel<float>();
+    test_polynomials<double>();
+    test_polynomials<float>();
+    test_unary<double>();
+    test_unary<float>();
+}
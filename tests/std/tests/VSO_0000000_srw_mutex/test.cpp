@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+static_assert(sizeof(stdext::srw_mutex) == sizeof(void*), "srw_mutex should be a bare SRW lock");
+static_assert(sizeof(stdext::srw_condition_variable) == sizeof(void*), "srw_condition_variable should be bare");
+
+stdext::srw_mutex global_mutex; // constant initialized, so usable during dynamic initialization
+
+void test_mutual_exclusion() {
+    // one mutex for each of many buckets
+    constexpr size_t buckets = 64;
+    stdext::srw_mutex mutexes[buckets];
+    size_t counts[buckets]{};
+    vector<thread> threads;
+    for (size_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < 20'000; ++i) {
+                const size_t bucket = (i * 7 + t) % buckets;
+                lock_guard<stdext::srw_mutex> guard(mutexes[bucket]);
+                ++counts[bucket];
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    size_t total = 0;
+    for (const size_t count : counts) {
+        total += count;
+    }
+
+    assert(total == 8 * 20'000);
+}
+
+void test_try_lock() {
+    stdext::srw_mutex m;
+    assert(m.try_lock());
+    thread([&] { assert(!m.try_lock()); }).join();
+    m.unlock();
+
+    unique_lock<stdext::srw_mutex> lck(m, try_to_lock);
+    assert(lck.owns_lock());
+    lck.unlock();
+
+    lock(m, global_mutex);
+    m.unlock();
+    global_mutex.unlock();
+
+    assert(m.native_handle() != nullptr);
+}
+
+void test_condition_variable() {
+    stdext::srw_mutex m;
+    stdext::srw_condition_variable cv;
+    vector<int> queue;
+    bool done = false;
+    int sum   = 0;
+
+    thread consumer([&] {
+        unique_lock<stdext::srw_mutex> lck(m);
+        for (;;) {
+            cv.wait(lck, [&] { return done || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+
+            sum += queue.back();
+            queue.pop_back();
+        }
+    });
+
+    for (int i = 1; i <= 1'000; ++i) {
+        {
+            lock_guard<stdext::srw_mutex> guard(m);
+            queue.push_back(i);
+        }
+
+        cv.notify_one();
+    }
+
+    {
+        lock_guard<stdext::srw_mutex> guard(m);
+        done = true;
+    }
+
+    cv.notify_all();
+    consumer.join();
+    assert(sum == 1'000 * 1'001 / 2);
+}
+
+void test_timeouts() {
+    stdext::srw_mutex m;
+    stdext::srw_condition_variable cv;
+    unique_lock<stdext::srw_mutex> lck(m);
+
+    const auto start = steady_clock::now();
+    assert(cv.wait_for(lck, milliseconds{50}) == cv_status::timeout);
+    assert(steady_clock::now() - start >= milliseconds{50});
+    assert(lck.owns_lock());
+
+    assert(cv.wait_for(lck, milliseconds{-1}) == cv_status::timeout);
+    assert(cv.wait_until(lck, steady_clock::now() - seconds{1}) == cv_status::timeout);
+    assert(!cv.wait_for(lck, microseconds{300}, [] { return false; }));
+    assert(cv.wait_for(lck, hours{1}, [] { return true; }));
+    assert(!cv.wait_until(lck, system_clock::now() + milliseconds{10}, [] { return false; }));
+
+    bool ready = false;
+    thread notifier([&] {
+        this_thread::sleep_for(milliseconds{20});
+        lock_guard<stdext::srw_mutex> guard(m);
+        ready = true;
+        cv.notify_all();
+    });
+
+    assert(cv.wait_for(lck, hours{1}, [&] { return ready; }));
+    lck.unlock();
+    notifier.join();
+}
+
+void test_condition_variable_any() {
+    stdext::srw_mutex m;
+    condition_variable_any cv;
+    unique_lock<stdext::srw_mutex> lck(m);
+    assert(!cv.wait_for(lck, milliseconds{1}, [] { return false; }));
+}
+
+int main() {
+    test_mutual_exclusion();
+    test_try_lock();
+    test_condition_variable();
+    test_timeouts();
+    test_condition_variable_any();
+}
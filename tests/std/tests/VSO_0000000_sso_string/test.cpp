@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+size_t allocations = 0; // of characters, not counting debugging proxies
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = true_type;
+
+    explicit counting_allocator(const int id_ = 0) noexcept : id(id_) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        if (is_same<T, char>::value) {
+            ++allocations;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>& other) const noexcept {
+        return id != other.id;
+    }
+
+    int id;
+};
+
+template <size_t Inline>
+using counted_string = stdext::basic_sso_string<char, char_traits<char>, counting_allocator<char>, Inline>;
+
+STATIC_ASSERT(is_same<stdext::sso_string::value_type, char>::value);
+STATIC_ASSERT(is_same<stdext::wsso_string::value_type, wchar_t>::value);
+STATIC_ASSERT(sizeof(stdext::sso_string) > sizeof(string));
+STATIC_ASSERT(sizeof(stdext::basic_sso_string<char, char_traits<char>, allocator<char>, 15>) == sizeof(string));
+
+void test_inline_capacity() {
+    assert(stdext::sso_string{}.capacity() == 23);
+    assert(stdext::wsso_string{}.capacity() == 23);
+    assert((stdext::basic_sso_string<char, char_traits<char>, allocator<char>, 40>{}.capacity() == 40));
+
+    // asking for less than the default keeps the default
+    assert((stdext::basic_sso_string<char, char_traits<char>, allocator<char>, 4>{}.capacity() == string{}.capacity()));
+
+    allocations = 0;
+    counted_string<23> s(23, 'x');
+    assert(allocations == 0);
+    s.assign("an identifier of 22 ch");
+    assert(allocations == 0);
+    s.push_back('!');
+    assert(s.size() == 23 && allocations == 0);
+    s.push_back('!');
+    assert(s.size() == 24 && allocations == 1);
+    assert(s.capacity() >= 24);
+
+    s.resize(5);
+    s.shrink_to_fit();
+    assert(s.capacity() == 23);
+    assert(s == "an id");
+}
+
+template <class Str>
+void test_operations() {
+    const Str small = "small";
+    const Str large = "a string long enough not to fit in any inline buffer";
+
+    Str s = small;
+    assert(s == "small");
+    s += large;
+    assert(s.size() == small.size() + large.size());
+    assert(s.substr(0, 5) == small);
+    assert(s.find("long") == 5 + large.find("long"));
+
+    s.erase(3);
+    assert(s == "sma");
+    s.insert(0, large);
+    assert(s.compare(0, large.size(), large) == 0);
+
+    Str copy = s;
+    assert(copy == s);
+    Str moved = move(copy);
+    assert(moved == s);
+
+    Str other = small;
+    other.swap(moved);
+    assert(other == s);
+    assert(moved == small);
+
+    const Str sum = small + large;
+    assert(sum.size() == small.size() + large.size());
+
+    unordered_set<Str> set{small, large};
+    assert(set.count(large) == 1);
+}
+
+void test_copy_assign_shrunk_large_string() {
+    // copying from a heap-allocated string that has shrunk below the inline capacity must allocate a buffer that's
+    // still large, including the terminator
+    counted_string<23> source(counting_allocator<char>{1});
+    source.assign(100, 'x');
+    source.resize(3);
+
+    counted_string<23> target(counting_allocator<char>{2});
+    target = source;
+    assert(target == "xxx");
+    assert(target.get_allocator().id == 1);
+    target.append(30, 'y');
+    assert(target.size() == 33);
+
+    basic_string<char, char_traits<char>, counting_allocator<char>> plain_source(100, 'x', counting_allocator<char>{1});
+    plain_source.resize(3);
+    basic_string<char, char_traits<char>, counting_allocator<char>> plain_target(counting_allocator<char>{2});
+    plain_target = plain_source;
+    assert(plain_target == "xxx" && plain_target.get_allocator().id == 1);
+    plain_target.append(30, 'y');
+    assert(plain_target.size() == 33);
+}
+
+int main() {
+    test_inline_capacity();
+    test_operations<stdext::sso_string>();
+    test_operations<counted_string<31>>();
+    test_operations<string>();
+    test_copy_assign_shrunk_large_string();
+}
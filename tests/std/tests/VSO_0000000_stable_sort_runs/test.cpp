@@ -0,0 +1,248 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#if _ITERATOR_DEBUG_LEVEL == 2
+constexpr size_t debug_factor = 2; // _DEBUG_LT_PRED checks the reverse comparison whenever a comparison is true
+#else // ^^^ _ITERATOR_DEBUG_LEVEL == 2 / _ITERATOR_DEBUG_LEVEL != 2 vvv
+constexpr size_t debug_factor = 1;
+#endif // ^^^ _ITERATOR_DEBUG_LEVEL != 2 ^^^
+
+struct element {
+    int key;
+    int index;
+};
+
+size_t comparisons = 0;
+
+struct key_less {
+    bool operator()(const element& left, const element& right) const {
+        ++comparisons;
+        return left.key < right.key;
+    }
+};
+
+size_t allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+enum class shape { random, few_keys, ascending, descending, descending_equal, append, sprinkled, sawtooth, organ };
+
+vector<element> make_input(const shape s, const int n, mt19937& gen) {
+    vector<element> v(static_cast<size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        int key = 0;
+        switch (s) {
+        case shape::random:
+            key = static_cast<int>(gen() % 1'000'000);
+            break;
+        case shape::few_keys:
+            key = static_cast<int>(gen() % 4);
+            break;
+        case shape::ascending:
+            key = i;
+            break;
+        case shape::descending:
+            key = n - i;
+            break;
+        case shape::descending_equal:
+            key = (n - i) / 3;
+            break;
+        case shape::append: // a sorted range with unsorted elements appended
+            key = i < n - n / 10 ? i : static_cast<int>(gen() % static_cast<unsigned int>(n));
+            break;
+        case shape::sprinkled: // sorted, except for a few elements
+            key = gen() % 100 == 0 ? static_cast<int>(gen() % static_cast<unsigned int>(n)) : i;
+            break;
+        case shape::sawtooth:
+            key = i % 300;
+            break;
+        case shape::organ:
+            key = i < n / 2 ? i : n - i;
+            break;
+        }
+
+        v[static_cast<size_t>(i)] = {key, i};
+    }
+
+    return v;
+}
+
+template <class Container>
+void assert_stably_sorted(const Container& c, vector<element> expected) {
+    // stability means equivalent elements keep the order of their indices, so (key, index) is a total order
+    sort(expected.begin(), expected.end(), [](const element& left, const element& right) {
+        return left.key < right.key || (left.key == right.key && left.index < right.index);
+    });
+
+    assert(c.size() == expected.size());
+    auto it = c.begin();
+    for (const auto& e : expected) {
+        assert(it->key == e.key && it->index == e.index);
+        ++it;
+    }
+}
+
+void test_shapes() {
+    mt19937 gen(1729);
+    stdext::stable_sort_buffer<element> buffer;
+    for (const int n : {0, 1, 2, 3, 31, 32, 33, 100, 255, 256, 257, 1000, 4'097, 50'000}) {
+        for (const auto s : {shape::random, shape::few_keys, shape::ascending, shape::descending,
+                 shape::descending_equal, shape::append, shape::sprinkled, shape::sawtooth, shape::organ}) {
+            const auto input = make_input(s, n, gen);
+
+            auto v = input;
+            stable_sort(v.begin(), v.end(), key_less{});
+            assert_stably_sorted(v, input);
+
+            v = input;
+            stdext::stable_sort(v.begin(), v.end(), key_less{}, buffer);
+            assert_stably_sorted(v, input);
+
+            if (n <= 5'000) {
+                list<element> l(input.begin(), input.end());
+                stable_sort(l.begin(), l.end(), key_less{});
+                assert_stably_sorted(l, input);
+            }
+        }
+    }
+}
+
+void test_presorted() {
+    // a single ascending or strictly descending run takes one pass, and no scratch storage
+    mt19937 gen(1234);
+    constexpr int n = 100'000;
+    stdext::stable_sort_buffer<element, counting_allocator<element>> buffer;
+
+    auto v      = make_input(shape::ascending, n, gen);
+    comparisons = 0;
+    stable_sort(v.begin(), v.end(), key_less{});
+    assert(comparisons == static_cast<size_t>(n - 1));
+
+    comparisons = 0;
+    stdext::stable_sort(v.begin(), v.end(), key_less{}, buffer);
+    assert(comparisons == static_cast<size_t>(n - 1));
+
+    v           = make_input(shape::descending, n, gen);
+    comparisons = 0;
+    stdext::stable_sort(v.begin(), v.end(), key_less{}, buffer);
+    assert(comparisons == debug_factor * static_cast<size_t>(n - 1));
+    assert_stably_sorted(v, make_input(shape::descending, n, gen));
+
+    assert(allocations == 0);
+    assert(buffer.capacity() == 0);
+}
+
+void test_skewed_merges() {
+    // appending a few elements to a long sorted range finds their places by galloping, rather than by linear merging
+    mt19937 gen(42);
+    constexpr int n = 100'000;
+    auto v          = make_input(shape::ascending, n, gen);
+    for (int i = 0; i < 10; ++i) {
+        v.push_back({static_cast<int>(gen() % n), n + i});
+    }
+
+    const auto input = v;
+    comparisons      = 0;
+    stable_sort(v.begin(), v.end(), key_less{});
+    assert(comparisons < debug_factor * static_cast<size_t>(n + n / 4));
+    assert_stably_sorted(v, input);
+}
+
+void test_buffer_reuse() {
+    mt19937 gen(5);
+    stdext::stable_sort_buffer<element, counting_allocator<element>> buffer;
+    assert(buffer.capacity() == 0);
+
+    for (int round = 0; round < 10; ++round) {
+        auto v = make_input(shape::random, 10'000, gen);
+        const auto input = v;
+        stdext::stable_sort(v.begin(), v.end(), key_less{}, buffer);
+        assert_stably_sorted(v, input);
+    }
+
+    assert(allocations == 1);
+    assert(buffer.capacity() >= 5'000);
+
+    buffer.reserve(100); // never shrinks
+    assert(buffer.capacity() >= 5'000);
+    buffer.reserve(20'000);
+    assert(buffer.capacity() >= 20'000);
+    assert(allocations == 2);
+
+    // the buffer is sized in elements, so it serves any range with that value type
+    stdext::stable_sort_buffer<int> ints;
+    int arr[300];
+    for (int i = 0; i < 300; ++i) {
+        arr[i] = (i * 37) % 300;
+    }
+
+    stdext::stable_sort(begin(arr), end(arr), ints);
+    assert(is_sorted(begin(arr), end(arr)));
+    assert(ints.capacity() >= 150);
+}
+
+void test_pmr() {
+    pmr::monotonic_buffer_resource mr;
+    stdext::stable_sort_buffer<string, pmr::polymorphic_allocator<string>> buffer(&mr);
+    assert(buffer.get_allocator().resource() == &mr);
+
+    mt19937 gen(99);
+    vector<string> v;
+    for (int i = 0; i < 1'000; ++i) {
+        v.push_back(to_string(gen() % 100) + " is a string long enough to need an allocation");
+    }
+
+    auto expected = v;
+    stable_sort(expected.begin(), expected.end());
+    stdext::stable_sort(v.begin(), v.end(), buffer);
+    assert(v == expected);
+    assert(buffer.capacity() >= 500);
+}
+
+int main() {
+    test_shapes();
+    test_presorted();
+    test_skewed_merges();
+    test_buffer_reuse();
+    test_pmr();
+}
@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <random>
+#include <regex>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+// stdext::static_regex compiles its pattern during translation; every match must agree with std::regex.
+
+template <class BidIt>
+bool same_results(const match_results<BidIt>& expected, const match_results<BidIt>& actual) {
+    if (expected.size() != actual.size() || expected.prefix() != actual.prefix()
+        || expected.suffix() != actual.suffix()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (expected[i].matched != actual[i].matched
+            || (expected[i].matched
+                && (expected[i].first != actual[i].first || expected[i].second != actual[i].second))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class StaticRegex>
+void check_against_std(mt19937& gen, const char* const pattern, const string& alphabet) {
+    const regex dynamic(pattern);
+    assert(StaticRegex::mark_count() == dynamic.mark_count());
+
+    for (int round = 0; round < 400; ++round) {
+        string str;
+        for (size_t length = gen() % 12; length != 0; --length) {
+            str += alphabet[gen() % alphabet.size()];
+        }
+
+        smatch expected;
+        smatch actual;
+        assert(stdext::regex_match(str, actual, StaticRegex{}) == regex_match(str, expected, dynamic));
+        assert(actual.ready() && (actual.empty() || same_results(expected, actual)));
+        assert(stdext::regex_search(str, actual, StaticRegex{}) == regex_search(str, expected, dynamic));
+        assert(actual.empty() || same_results(expected, actual));
+        assert(stdext::regex_search(str.c_str(), StaticRegex{}) == !expected.empty());
+    }
+}
+
+void test_against_std() {
+    mt19937 gen(1729);
+    const string ab  = "ab";
+    const string abc = "abc";
+    const string mix = "aZ1_ -.b9\t";
+
+    check_against_std<stdext::static_regex<"a">>(gen, "a", ab);
+    check_against_std<stdext::static_regex<"ab">>(gen, "ab", ab);
+    check_against_std<stdext::static_regex<"a*">>(gen, "a*", ab);
+    check_against_std<stdext::static_regex<"a+b">>(gen, "a+b", ab);
+    check_against_std<stdext::static_regex<"a?b">>(gen, "a?b", ab);
+    check_against_std<stdext::static_regex<"(a|b)*">>(gen, "(a|b)*", ab);
+    check_against_std<stdext::static_regex<"(a|ab)(c|bcd)">>(gen, "(a|ab)(c|bcd)", "abcd");
+    check_against_std<stdext::static_regex<"a*?b">>(gen, "a*?b", ab);
+    check_against_std<stdext::static_regex<"(a+?)(a*)">>(gen, "(a+?)(a*)", ab);
+    check_against_std<stdext::static_regex<"(a|b)+?a">>(gen, "(a|b)+?a", ab);
+    check_against_std<stdext::static_regex<"a{2}">>(gen, "a{2}", ab);
+    check_against_std<stdext::static_regex<"a{2,}">>(gen, "a{2,}", ab);
+    check_against_std<stdext::static_regex<"a{1,3}b">>(gen, "a{1,3}b", ab);
+    check_against_std<stdext::static_regex<"a{0,2}?a">>(gen, "a{0,2}?a", ab);
+    check_against_std<stdext::static_regex<"(ab){2,3}">>(gen, "(ab){2,3}", ab);
+    check_against_std<stdext::static_regex<"[ab]+">>(gen, "[ab]+", abc);
+    check_against_std<stdext::static_regex<"[^a]+">>(gen, "[^a]+", abc);
+    check_against_std<stdext::static_regex<"[a-c]{2}">>(gen, "[a-c]{2}", "abcd");
+    check_against_std<stdext::static_regex<"[^a-b]">>(gen, "[^a-b]", "abcd");
+    check_against_std<stdext::static_regex<".+">>(gen, ".+", "ab\n\r");
+    check_against_std<stdext::static_regex<"\\d+">>(gen, "\\d+", mix);
+    check_against_std<stdext::static_regex<"\\D+">>(gen, "\\D+", mix);
+    check_against_std<stdext::static_regex<"\\w+">>(gen, "\\w+", mix);
+    check_against_std<stdext::static_regex<"\\W">>(gen, "\\W", mix);
+    check_against_std<stdext::static_regex<"\\s">>(gen, "\\s", mix);
+    check_against_std<stdext::static_regex<"\\S+">>(gen, "\\S+", mix);
+    check_against_std<stdext::static_regex<"[\\d_]+">>(gen, "[\\d_]+", mix);
+    check_against_std<stdext::static_regex<"[^\\w]+">>(gen, "[^\\w]+", mix);
+    check_against_std<stdext::static_regex<"[\\s\\d]">>(gen, "[\\s\\d]", mix);
+    check_against_std<stdext::static_regex<"\\bab">>(gen, "\\bab", "ab c");
+    check_against_std<stdext::static_regex<"b\\b">>(gen, "b\\b", "ab c");
+    check_against_std<stdext::static_regex<"\\Ba">>(gen, "\\Ba", "ab a");
+    check_against_std<stdext::static_regex<"^a">>(gen, "^a", "ab\n");
+    check_against_std<stdext::static_regex<"b$">>(gen, "b$", "ab\n");
+    check_against_std<stdext::static_regex<"(a)|(b)">>(gen, "(a)|(b)", ab);
+    check_against_std<stdext::static_regex<"((a)|b)+">>(gen, "((a)|b)+", ab);
+    check_against_std<stdext::static_regex<"(a)\\1">>(gen, "(a)\\1", ab);
+    check_against_std<stdext::static_regex<"(a*)b\\1">>(gen, "(a*)b\\1", ab);
+    check_against_std<stdext::static_regex<"(?:ab)+">>(gen, "(?:ab)+", ab);
+    check_against_std<stdext::static_regex<"a(?=b)">>(gen, "a(?=b)", ab);
+    check_against_std<stdext::static_regex<"a(?!b)">>(gen, "a(?!b)", ab);
+    check_against_std<stdext::static_regex<"(a|ab)(?=b)">>(gen, "(a|ab)(?=b)", ab);
+    check_against_std<stdext::static_regex<"\\x61\\u0062+">>(gen, "\\x61\\u0062+", ab);
+    check_against_std<stdext::static_regex<"[a\\-.]+">>(gen, "[a\\-.]+", "a-.b");
+    check_against_std<stdext::static_regex<"(a(b(c)?)?)+">>(gen, "(a(b(c)?)?)+", abc);
+    check_against_std<stdext::static_regex<"(.*)c">>(gen, "(.*)c", abc);
+    check_against_std<stdext::static_regex<"(.*?)c">>(gen, "(.*?)c", abc);
+    check_against_std<stdext::static_regex<"ab|ac|a">>(gen, "ab|ac|a", abc);
+    check_against_std<stdext::static_regex<"[0-9]{3}-[0-9]{4}">>(gen, "[0-9]{3}-[0-9]{4}", "0123-");
+    check_against_std<stdext::static_regex<"(\\d+)\\.(\\d+)">>(gen, "(\\d+)\\.(\\d+)", "12.");
+}
+
+void test_empty_iterations() {
+    // an iteration that matches the empty string once the minimum has been reached stops the repetition
+    cmatch m;
+    assert(stdext::regex_search("aaba", m, stdext::static_regex<"(|a)+">{}));
+    assert(m.position(0) == 0 && m.length(0) == 2 && m.position(1) == 1 && m.length(1) == 1);
+    assert(stdext::regex_search("b", m, stdext::static_regex<"(a*)*b">{}));
+    assert(m[0].matched && !m[1].matched);
+    assert(stdext::regex_search("aab", m, stdext::static_regex<"(a*)+">{}));
+    assert(m.length(0) == 2 && m.length(1) == 2);
+    assert(stdext::regex_search("ab", m, stdext::static_regex<"(a*?)*">{}));
+    assert(m.length(0) == 1 && m.length(1) == 1);
+}
+
+void test_flags() {
+    using digits = stdext::static_regex<"[0-9]{3}-[0-9]{4}">;
+    static_assert(digits::mark_count() == 0);
+    static_assert(digits::flags() == regex_constants::ECMAScript);
+    static_assert(is_same_v<digits::value_type, char>);
+
+    assert(stdext::regex_match("555-0123", digits{}));
+    assert(!stdext::regex_match("555-01234", digits{}));
+    assert(stdext::regex_search("call 555-0123 now", digits{}));
+
+    cmatch m;
+    assert(stdext::regex_search("xxab", m, stdext::static_regex<"a*">{}));
+    assert(m.position(0) == 0 && m.length(0) == 0);
+    assert(stdext::regex_search("xxab", m, stdext::static_regex<"a*">{}, regex_constants::match_not_null));
+    assert(m.position(0) == 2 && m.length(0) == 1);
+    assert(!stdext::regex_search("xab", stdext::static_regex<"ab">{}, regex_constants::match_continuous));
+    assert(stdext::regex_search("abx", stdext::static_regex<"ab">{}, regex_constants::match_continuous));
+
+    // match_prev_avail looks at the character before the range, which overrides match_not_bol
+    const string lines = "ab\ncd";
+    assert(stdext::regex_search(lines.begin() + 3, lines.end(), stdext::static_regex<"^c">{}));
+    assert(!stdext::regex_search(
+        lines.begin() + 3, lines.end(), stdext::static_regex<"^c">{}, regex_constants::match_not_bol));
+    assert(stdext::regex_search(lines.begin() + 3, lines.end(), stdext::static_regex<"^c">{},
+        regex_constants::match_not_bol | regex_constants::match_prev_avail));
+
+    const string words = "ab cd";
+    assert(stdext::regex_search(words.begin() + 4, words.end(), stdext::static_regex<"\\bd">{}));
+    assert(!stdext::regex_search(
+        words.begin() + 4, words.end(), stdext::static_regex<"\\bd">{}, regex_constants::match_prev_avail));
+
+    // ^ and $ also match after and before a newline, as they do for std::regex
+    assert(stdext::regex_search("ab\ncd", m, stdext::static_regex<"^c">{}));
+    assert(m.position(0) == 3);
+    assert(stdext::regex_search("ab\ncd", m, stdext::static_regex<"b$">{}));
+    assert(m.position(0) == 1);
+}
+
+void test_wide() {
+    using assignment = stdext::static_regex<L"(\\w+)=(\\d*)">;
+    static_assert(assignment::mark_count() == 2);
+    static_assert(is_same_v<assignment::value_type, wchar_t>);
+
+    const wstring str = L"key=42";
+    wsmatch m;
+    assert(stdext::regex_match(str, m, assignment{}));
+    assert(m.str(1) == L"key" && m.str(2) == L"42");
+    assert(stdext::regex_search(L"  a=  ", assignment{}));
+    assert(!stdext::regex_search(L"=1", assignment{}));
+}
+
+int main() {
+    test_against_std();
+    test_empty_iterations();
+    test_flags();
+    test_wide();
+}
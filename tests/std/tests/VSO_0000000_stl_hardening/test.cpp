@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _MSVC_STL_HARDENING 1
+
+#include <array>
+#include <assert.h>
+#include <deque>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <test_death.hpp>
+using namespace std;
+
+// _MSVC_STL_HARDENING turns on the constant-time precondition checks at every _ITERATOR_DEBUG_LEVEL.
+static_assert(_CONTAINER_DEBUG_LEVEL == 1);
+
+void test_in_bounds() {
+    vector<int> v{10, 20, 30};
+    assert(v[2] == 30 && v.front() == 10 && v.back() == 30);
+
+    string str = "meow";
+    assert(str[4] == '\0' && str.front() == 'm' && str.back() == 'w');
+
+    string_view sv = str;
+    sv.remove_prefix(1);
+    sv.remove_suffix(1);
+    assert(sv == "eo" && sv[1] == 'o');
+
+    const array<int, 2> arr{1, 2};
+    assert(arr[1] == 2);
+
+    const span<const int> sp = v;
+    assert(sp[0] == 10 && sp.back() == 30);
+
+    optional<int> o{1729};
+    assert(*o == 1729);
+
+    deque<int> d{1};
+    assert(d[0] == 1 && d.back() == 1);
+}
+
+void test_case_vector_subscript() {
+    vector<int> v{10, 20, 30};
+    (void) v[3];
+}
+
+void test_case_vector_front_empty() {
+    vector<int> v;
+    (void) v.front();
+}
+
+void test_case_string_subscript() {
+    string str = "meow";
+    (void) str[5];
+}
+
+void test_case_string_back_empty() {
+    string str;
+    (void) str.back();
+}
+
+void test_case_string_view_subscript() {
+    string_view sv = "meow";
+    (void) sv[4];
+}
+
+void test_case_string_view_remove_prefix() {
+    string_view sv = "meow";
+    sv.remove_prefix(5);
+}
+
+void test_case_array_subscript() {
+    array<int, 2> arr{1, 2};
+    volatile size_t idx = 2;
+    (void) arr[idx];
+}
+
+void test_case_span_subscript() {
+    int arr[2]{1, 2};
+    span<int> sp = arr;
+    (void) sp[2];
+}
+
+void test_case_span_front_empty() {
+    span<int> sp;
+    (void) sp.front();
+}
+
+void test_case_optional_dereference_empty() {
+    optional<int> o;
+    (void) *o;
+}
+
+void test_case_deque_back_empty() {
+    deque<int> d;
+    (void) d.back();
+}
+
+int main(int argc, char* argv[]) {
+    std_testing::death_test_executive exec(test_in_bounds);
+
+    exec.add_death_tests({
+        test_case_vector_subscript,
+        test_case_vector_front_empty,
+        test_case_string_subscript,
+        test_case_string_back_empty,
+        test_case_string_view_subscript,
+        test_case_string_view_remove_prefix,
+        test_case_array_subscript,
+        test_case_span_subscript,
+        test_case_span_front_empty,
+        test_case_optional_dereference_empty,
+        test_case_deque_back_empty,
+    });
+
+    return exec.run(argc, argv);
+}
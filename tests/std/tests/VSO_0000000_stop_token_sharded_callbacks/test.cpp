@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// stop_callbacks are kept in several lists chosen by their addresses; these tests register enough of them, in enough
+// places, to use all of the lists.
+
+struct counting_callback {
+    atomic<int>* calls;
+
+    void operator()() const noexcept {
+        calls->fetch_add(1, memory_order_relaxed);
+    }
+};
+
+using callback_ptr = unique_ptr<stop_callback<counting_callback>>;
+
+void test_many_callbacks_called_once() {
+    stop_source source;
+    atomic<int> calls{0};
+    vector<callback_ptr> callbacks;
+    for (int i = 0; i < 1000; ++i) {
+        callbacks.push_back(make_unique<callback_ptr::element_type>(source.get_token(), counting_callback{&calls}));
+    }
+
+    // deregistering some of the callbacks before stop is requested keeps them from being called
+    for (size_t i = 0; i < callbacks.size(); i += 3) {
+        callbacks[i].reset();
+    }
+
+    assert(source.request_stop());
+    assert(calls.load() == 666);
+    assert(!source.request_stop());
+    assert(calls.load() == 666);
+
+    // callbacks registered after stop is requested are called immediately
+    stop_callback<counting_callback> late{source.get_token(), counting_callback{&calls}};
+    assert(calls.load() == 667);
+}
+
+void test_request_stop_without_callbacks() {
+    stop_source source;
+    const auto token = source.get_token();
+    {
+        atomic<int> calls{0};
+        stop_callback<counting_callback> cb{token, counting_callback{&calls}};
+    }
+
+    assert(source.request_stop());
+    assert(token.stop_requested());
+}
+
+void test_concurrent_registration() {
+    constexpr int thread_count = 8;
+    constexpr int iterations   = 2'000;
+    stop_source source;
+    atomic<int> registered{0};
+    atomic<int> calls{0};
+    atomic<bool> go{false};
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, token = source.get_token()] {
+            while (!go.load()) {
+                this_thread::yield();
+            }
+
+            for (int i = 0; i < iterations; ++i) {
+                // each callback is either deregistered before stop is requested, or called exactly once
+                atomic<int> mine{0};
+                {
+                    stop_callback<counting_callback> cb{token, counting_callback{&mine}};
+                }
+
+                assert(mine.load() <= 1);
+                calls.fetch_add(mine.load(), memory_order_relaxed);
+                registered.fetch_add(1, memory_order_relaxed);
+            }
+
+            // one callback that stays registered until stop is requested
+            atomic<int> last{0};
+            stop_callback<counting_callback> cb{token, counting_callback{&last}};
+            while (!token.stop_requested()) {
+                this_thread::yield();
+            }
+
+            assert(last.load() == 1);
+        });
+    }
+
+    go.store(true);
+    while (registered.load() < thread_count * iterations / 2) {
+        this_thread::yield();
+    }
+
+    assert(source.request_stop());
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(calls.load() <= thread_count * iterations);
+}
+
+void test_callback_deregistering_others() {
+    // a callback may destroy callbacks registered in other lists, which must not then be called
+    stop_source source;
+    atomic<int> calls{0};
+    vector<callback_ptr> others;
+    for (int i = 0; i < 64; ++i) {
+        others.push_back(make_unique<callback_ptr::element_type>(source.get_token(), counting_callback{&calls}));
+    }
+
+    struct clearing_callback {
+        vector<callback_ptr>* others;
+        atomic<int>* calls;
+
+        void operator()() const noexcept {
+            const int before = calls->load();
+            others->clear();
+            assert(calls->load() == before);
+        }
+    };
+
+    stop_callback<clearing_callback> clearer{source.get_token(), clearing_callback{&others, &calls}};
+    assert(source.request_stop());
+    assert(others.empty());
+    assert(calls.load() <= 64);
+}
+
+int main() {
+    test_many_callbacks_called_once();
+    test_request_stop_without_callbacks();
+    test_concurrent_registration();
+    test_callback_deregistering_others();
+}
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+size_t allocations = 0; // of characters, not counting debugging proxies
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if (is_same_v<T, char>) {
+            ++allocations;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+using counted_string = basic_string<char, char_traits<char>, counting_allocator<char>>;
+
+const string host        = "service.example.com";
+const string_view tenant = "a-tenant-name-long-enough-to-allocate";
+
+void test_concat() {
+    const auto key = stdext::concat(host, "/", tenant, '/', string("users"), "/", "index");
+    STATIC_ASSERT(is_same_v<decltype(key), const string>);
+    assert(key == "service.example.com/a-tenant-name-long-enough-to-allocate/users/index");
+
+    assert(stdext::concat("") == "");
+    assert(stdext::concat('x') == "x");
+    assert(stdext::concat("a", 'b', "c") == "abc");
+
+    const auto wide = stdext::concat(L"wide", wstring(L"/"), wstring_view(L"string"), L'!');
+    STATIC_ASSERT(is_same_v<decltype(wide), const wstring>);
+    assert(wide == L"wide/string!");
+}
+
+void test_concat_append() {
+    counted_string s;
+    allocations = 0;
+    stdext::concat_append(s, host, "/", tenant, "/", host, "/", tenant, '/');
+    assert(allocations == 1);
+    assert(s.size() == 2 * host.size() + 2 * tenant.size() + 4);
+    assert(s.find(tenant) == host.size() + 1);
+
+    // the pieces fit in the capacity, so nothing is allocated
+    s.reserve(s.size() + 10);
+    allocations = 0;
+    stdext::concat_append(s, "abc", 'd');
+    assert(allocations == 0);
+    assert(s.substr(s.size() - 5) == "/abcd");
+
+    auto& result = stdext::concat_append(s);
+    assert(&result == &s);
+}
+
+void test_self_append() {
+    // pieces may refer to the string being appended to, whether or not it has to reallocate
+    string s = "0123456789abcdefghijklmnopqrstuvwxyz";
+    s.shrink_to_fit();
+    stdext::concat_append(s, s, "-", string_view(s).substr(0, 3));
+    assert(s == "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz-012");
+
+    string t;
+    t.reserve(100);
+    t = "xy";
+    stdext::concat_append(t, t, t.c_str(), string_view(t));
+    assert(t == "xyxyxyxy");
+}
+
+void test_concat_append_range() {
+    const vector<string_view> parts{"usr", "/", "local", "/", "a directory name long enough to allocate", "/", "bin"};
+    counted_string path;
+    allocations = 0;
+    stdext::concat_append_range(path, parts.begin(), parts.end());
+    assert(allocations == 1);
+    assert(path == "usr/local/a directory name long enough to allocate/bin");
+
+    forward_list<string> words{"x", "y", "z"};
+    string joined = "w";
+    stdext::concat_append_range(joined, words.begin(), words.end());
+    assert(joined == "wxyz");
+
+    istringstream in("one two three");
+    string from_input;
+    stdext::concat_append_range(from_input, istream_iterator<string>(in), istream_iterator<string>());
+    assert(from_input == "onetwothree");
+}
+
+void test_growth() {
+    // repeated appends still grow geometrically
+    string s;
+    size_t reallocations = 0;
+    auto data            = s.data();
+    for (int i = 0; i < 10'000; ++i) {
+        stdext::concat_append(s, "ab", 'c');
+        if (s.data() != data) {
+            ++reallocations;
+            data = s.data();
+        }
+    }
+
+    assert(s.size() == 30'000);
+    assert(reallocations < 40);
+}
+
+int main() {
+    test_concat();
+    test_concat_append();
+    test_self_append();
+    test_concat_append_range();
+    test_growth();
+}
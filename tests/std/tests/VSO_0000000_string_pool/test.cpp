@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+class counting_resource : public pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t outstanding = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        ++allocations;
+        ++outstanding;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        --outstanding;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+void test_interning() {
+    stdext::string_pool pool;
+    assert(pool.empty() && pool.size() == 0);
+    assert(pool.upstream_resource() == pmr::get_default_resource());
+
+    const string meow_str = "meow";
+    const auto meow       = pool.intern(meow_str);
+    const auto meow_again = pool.intern("meow"sv);
+    const auto purr       = pool.intern("purr");
+    assert(meow == meow_again);
+    assert(meow != purr);
+    assert(meow.view() == "meow"sv && purr.view() == "purr"sv);
+    assert(meow.size() == 4 && !meow.empty());
+    assert(meow.c_str()[4] == '\0');
+    assert(meow.data() != meow_str.data()); // the pool keeps its own copy
+    assert(meow.hash() == hash<string_view>{}("meow"sv));
+    assert(hash<stdext::interned_string>{}(meow) == meow.hash());
+    assert(pool.size() == 2);
+
+    const string_view converted = purr;
+    assert(converted == "purr"sv);
+    assert(purr == "purr"sv); // compares the characters through the conversion to string_view
+
+    // the empty string is never stored, and is the default-constructed handle
+    const stdext::interned_string none;
+    assert(pool.intern("") == none);
+    assert(none.empty() && none.size() == 0 && none.c_str()[0] == '\0');
+    assert(none.hash() == hash<string_view>{}(""sv));
+    assert(pool.size() == 2 && pool.contains(""));
+
+    // embedded nulls are part of the string
+    const auto with_null = pool.intern("me\0ow"sv);
+    assert(with_null != meow && with_null.size() == 5);
+    assert(pool.contains("me\0ow"sv) && !pool.contains("me"sv));
+}
+
+void test_many_strings() {
+    counting_resource upstream;
+    {
+        stdext::string_pool pool(&upstream);
+        assert(pool.upstream_resource() == &upstream);
+        vector<stdext::interned_string> handles;
+        for (int i = 0; i < 10'000; ++i) {
+            handles.push_back(pool.intern("identifier_number_" + to_string(i)));
+        }
+
+        assert(pool.size() == 10'000);
+        const size_t allocations = upstream.allocations;
+        for (int i = 0; i < 10'000; ++i) { // interning again finds the same handles without allocating
+            const string name = "identifier_number_" + to_string(i);
+            assert(pool.contains(name));
+            assert(pool.intern(name) == handles[static_cast<size_t>(i)]);
+            assert(handles[static_cast<size_t>(i)].view() == name);
+        }
+
+        assert(upstream.allocations == allocations);
+        assert(pool.size() == 10'000);
+        assert(!pool.contains("identifier_number_10000"));
+
+        pool.clear();
+        assert(pool.empty() && !pool.contains("identifier_number_0"));
+        assert(pool.intern("identifier_number_0").view() == "identifier_number_0"sv);
+        assert(pool.size() == 1);
+    }
+
+    assert(upstream.outstanding == 0);
+}
+
+void test_unordered_keys() {
+    stdext::string_pool pool;
+    unordered_map<stdext::interned_string, int> symbols;
+    const char* const names[] = {"alpha", "beta", "gamma", "beta", "alpha", "alpha"};
+    for (const char* const name : names) {
+        ++symbols[pool.intern(name)];
+    }
+
+    assert(symbols.size() == 3);
+    assert(symbols[pool.intern("alpha")] == 3);
+    assert(symbols[pool.intern("beta")] == 2);
+    assert(symbols[pool.intern("gamma")] == 1);
+
+    unordered_set<stdext::interned_string> seen{pool.intern("x"), pool.intern("x"), pool.intern("y")};
+    assert(seen.size() == 2);
+}
+
+void test_wide() {
+    stdext::wstring_pool pool;
+    const auto woof = pool.intern(L"woof");
+    assert(woof == pool.intern(wstring(L"woof")));
+    assert(woof.view() == L"woof"sv);
+    assert(woof.hash() == hash<wstring_view>{}(L"woof"sv));
+    static_assert(is_same_v<stdext::wstring_pool::handle_type, stdext::winterned_string>);
+}
+
+int main() {
+    test_interning();
+    test_many_strings();
+    test_unordered_keys();
+    test_wide();
+}
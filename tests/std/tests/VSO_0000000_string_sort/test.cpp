@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// sort orders basic_string and basic_string_view ranges compared by less through keys holding their code units;
+// check that against sort with an equivalent predicate, which takes the comparison sort
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+struct lambda_less { // not less<>, so sort compares strings directly
+    template <class Ty>
+    bool operator()(const Ty& left, const Ty& right) const {
+        return left < right;
+    }
+};
+
+template <class Str>
+vector<Str> make_strings(mt19937& gen, const size_t count, const size_t alphabet, const size_t max_length) {
+    // strings sharing long prefixes, holding embedded nulls and code units with the high bit set
+    using Elem                 = typename Str::value_type;
+    constexpr Elem high_unit[] = {static_cast<Elem>(~Elem{}), static_cast<Elem>(~Elem{} - 1)};
+    const Str prefixes[]       = {Str{}, Str(3, Elem{'p'}), Str(20, Elem{'q'}), Str(40, Elem{'q'})};
+
+    vector<Str> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Str str          = prefixes[gen() % size(prefixes)];
+        const size_t len = gen() % (max_length + 1);
+        for (size_t k = 0; k < len; ++k) {
+            const size_t unit = gen() % (alphabet + 3);
+            if (unit == 0) {
+                str.push_back(Elem{});
+            } else if (unit <= 2) {
+                str.push_back(high_unit[unit - 1]);
+            } else {
+                str.push_back(static_cast<Elem>('a' + unit - 3));
+            }
+        }
+
+        result.push_back(str);
+    }
+
+    return result;
+}
+
+template <class Str>
+void test_one(const vector<Str>& input) {
+    auto expected = input;
+    sort(expected.begin(), expected.end(), lambda_less{});
+
+    auto actual = input;
+    sort(actual.begin(), actual.end());
+    assert(actual == expected);
+
+    actual = input;
+    sort(actual.begin(), actual.end(), less<Str>{});
+    assert(actual == expected);
+
+    actual = input;
+    sort(execution::par, actual.begin(), actual.end());
+    assert(actual == expected);
+
+    actual = input;
+    sort(execution::seq, actual.begin(), actual.end(), less<>{});
+    assert(actual == expected);
+}
+
+template <class Str>
+void test_strings(mt19937& gen) {
+    for (const size_t count : {0u, 1u, 31u, 33u, 200u, 5000u}) {
+        for (const size_t alphabet : {1u, 2u, 26u}) {
+            for (const size_t max_length : {0u, 1u, 8u, 30u}) {
+                const auto strings = make_strings<Str>(gen, count, alphabet, max_length);
+                test_one(strings);
+
+                using View = basic_string_view<typename Str::value_type>;
+                test_one(vector<View>(strings.begin(), strings.end()));
+            }
+        }
+    }
+
+    // all equal, all long and equal but the last code unit, already sorted, reversed
+    test_one(vector<Str>(1000, Str(50, 'x')));
+    vector<Str> strings;
+    for (int i = 0; i < 1000; ++i) {
+        strings.push_back(Str(100, 'x') + static_cast<typename Str::value_type>('a' + i % 26));
+    }
+
+    test_one(strings);
+    sort(strings.begin(), strings.end());
+    test_one(strings);
+    reverse(strings.begin(), strings.end());
+    test_one(strings);
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    string_view views[] = {"meow", "", "purr", "hiss", "me", "meow\0"sv, "mew", "purr", "a", "zzz"};
+    sort(begin(views), end(views));
+    return is_sorted(begin(views), end(views)) && views[0].empty() && views[4] == "meow" && views[5] == "meow\0"sv;
+}
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    mt19937 gen(1729);
+    test_strings<string>(gen);
+    test_strings<wstring>(gen);
+#ifdef __cpp_char8_t
+    test_strings<u8string>(gen);
+#endif // __cpp_char8_t
+    test_strings<u16string>(gen);
+    test_strings<u32string>(gen);
+}
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <ios>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <Windows.h>
+
+using namespace std;
+
+class user_category : public error_category {
+public:
+    const char* name() const noexcept override {
+        return "user";
+    }
+
+    string message(int) const override {
+        return "user message";
+    }
+};
+
+void test_system_category() {
+    const error_code found{ERROR_FILE_NOT_FOUND, system_category()};
+    const string message = found.message();
+    assert(!message.empty());
+    assert(message == found.message());
+
+    const string_view cached = stdext::cached_message(found);
+    assert(cached == message);
+    assert(stdext::cached_message(found).data() == cached.data()); // formatted once
+
+    const error_code unknown{0x7FFF'FFFF, system_category()};
+    assert(unknown.message() == "unknown error");
+    assert(stdext::cached_message(unknown) == "unknown error");
+
+    const system_error err{found, "prefix"};
+    assert(string_view{err.what()} == "prefix: " + message);
+}
+
+void test_other_categories() {
+    const error_code generic = make_error_code(errc::no_such_file_or_directory);
+    assert(stdext::cached_message(generic) == generic.message());
+    assert(stdext::cached_message(make_error_condition(errc::invalid_argument))
+           == make_error_condition(errc::invalid_argument).message());
+
+    const error_code stream = make_error_code(io_errc::stream);
+    assert(stdext::cached_message(stream) == stream.message());
+    assert(stdext::cached_message(0, iostream_category()) == iostream_category().message(0));
+
+    const user_category user;
+    assert(stdext::cached_message(1, user).empty());
+    assert(user.message(1) == "user message");
+}
+
+void test_many_messages_and_threads() {
+    // more messages than the cache holds, from several threads at once
+    constexpr int codes = 3'000;
+    vector<string> expected(codes);
+    for (int i = 0; i < codes; ++i) {
+        expected[static_cast<size_t>(i)] = system_category().message(i);
+    }
+
+    vector<thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (int n = 0; n < codes; ++n) {
+                const int i = (n * 7 + t * 101) % codes;
+                assert(system_category().message(i) == expected[static_cast<size_t>(i)]);
+                const string_view cached = stdext::cached_message(i, system_category());
+                assert(cached.empty() || cached == expected[static_cast<size_t>(i)]);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+int main() {
+    test_system_category();
+    test_other_categories();
+    test_many_messages_and_threads();
+}
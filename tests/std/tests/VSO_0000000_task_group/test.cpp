@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <execution>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+long long fib(const int n) {
+    if (n < 20) {
+        long long a = 0;
+        long long b = 1;
+        for (int i = 0; i < n; ++i) {
+            const long long c = a + b;
+            a                 = b;
+            b                 = c;
+        }
+
+        return a;
+    }
+
+    long long x;
+    long long y;
+    stdext::parallel_invoke([&] { x = fib(n - 1); }, [&] { y = fib(n - 2); });
+    return x + y;
+}
+
+void spawn_tree(stdext::task_group& group, atomic<int>& visited, const int depth) {
+    ++visited;
+    if (depth != 0) {
+        group.run([&group, &visited, depth] { spawn_tree(group, visited, depth - 1); });
+        group.run([&group, &visited, depth] { spawn_tree(group, visited, depth - 1); });
+    }
+}
+
+void test_recursive_tasks() {
+    stdext::task_group group;
+    atomic<int> visited{0};
+    group.run([&] { spawn_tree(group, visited, 14); });
+    group.wait();
+    assert(visited == (1 << 15) - 1);
+
+    // the group can be reused after wait
+    visited = 0;
+    for (int i = 0; i < 1000; ++i) {
+        group.run([&] { ++visited; });
+    }
+
+    group.wait();
+    assert(visited == 1000);
+}
+
+void test_exceptions() {
+    stdext::task_group group;
+    atomic<int> ran{0};
+    for (int i = 0; i < 100; ++i) {
+        group.run([&ran, i] {
+            ++ran;
+            if (i == 50) {
+                throw i;
+            }
+        });
+    }
+
+    bool caught = false;
+    try {
+        group.wait();
+    } catch (const int i) {
+        caught = i == 50;
+    }
+
+    assert(caught);
+    assert(ran >= 1 && ran <= 100);
+
+    // a later batch runs again
+    ran = 0;
+    group.run([&] { ++ran; });
+    group.wait();
+    assert(ran == 1);
+
+    try {
+        stdext::parallel_invoke([] {}, [] { throw 7; }, [] {});
+        assert(false);
+    } catch (const int i) {
+        assert(i == 7);
+    }
+}
+
+void test_destructor_waits() {
+    atomic<int> ran{0};
+    {
+        stdext::task_group group;
+        for (int i = 0; i < 100; ++i) {
+            group.run([&] { ++ran; });
+        }
+
+        group.run([] { throw 1; }); // discarded by the destructor
+    }
+
+    assert(ran == 100);
+}
+
+void test_nested_groups() {
+    atomic<int> ran{0};
+    mutex mtx;
+    set<thread::id> ids;
+    stdext::task_group outer;
+    for (int i = 0; i < 8; ++i) {
+        outer.run([&] {
+            stdext::task_group inner;
+            for (int j = 0; j < 50; ++j) {
+                inner.run([&] {
+                    ++ran;
+                    lock_guard<mutex> lck(mtx);
+                    ids.insert(this_thread::get_id());
+                });
+            }
+
+            inner.wait();
+        });
+    }
+
+    outer.wait();
+    assert(ran == 400);
+    assert(!ids.empty());
+}
+
+void test_serial_scope() {
+    const stdext::parallel_algorithms_scope scope{nullptr, 1};
+    const auto id = this_thread::get_id();
+    stdext::task_group group;
+    atomic<int> ran{0};
+    for (int i = 0; i < 10; ++i) {
+        group.run([&] {
+            assert(this_thread::get_id() == id);
+            ++ran;
+        });
+    }
+
+    assert(ran == 0); // nothing runs until wait
+    group.wait();
+    assert(ran == 10);
+}
+
+int main() {
+    assert(fib(30) == 832040);
+    test_recursive_tasks();
+    test_exceptions();
+    test_destructor_waits();
+    test_nested_groups();
+    test_serial_scope();
+}
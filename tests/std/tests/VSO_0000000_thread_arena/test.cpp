@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// stdext::thread_arena scopes scratch allocations from a per-thread stdext::pmr::monotonic_arena_resource, which
+// optionally becomes the calling thread's default resource for the scope.
+
+void test_default_resource() {
+    pmr::memory_resource* const outside = pmr::get_default_resource();
+    {
+        stdext::thread_arena scope;
+        assert(pmr::get_default_resource() == scope.resource());
+
+        pmr::vector<int> v(100, 1729);
+        assert(v.get_allocator().resource() == scope.resource());
+        pmr::string str(200, 'x');
+        assert(str.get_allocator().resource() == scope.resource());
+
+        {
+            stdext::thread_arena inner{false};
+            assert(inner.resource() == scope.resource()); // the same arena, further along
+            assert(pmr::get_default_resource() == scope.resource());
+        }
+
+        pmr::memory_resource* seen_by_other_thread = nullptr;
+        pmr::memory_resource* other_arena           = nullptr;
+        thread{[&] {
+            seen_by_other_thread = pmr::get_default_resource();
+            stdext::thread_arena other;
+            other_arena = other.resource();
+        }}.join();
+        assert(seen_by_other_thread == outside);
+        assert(other_arena != scope.resource());
+    }
+
+    assert(pmr::get_default_resource() == outside);
+
+    // the override takes precedence over set_default_resource, and is undone independently of it
+    pmr::monotonic_buffer_resource global;
+    pmr::memory_resource* const previous = pmr::set_default_resource(&global);
+    assert(previous == outside);
+    {
+        stdext::thread_arena scope;
+        assert(pmr::get_default_resource() == scope.resource());
+    }
+
+    assert(pmr::get_default_resource() == &global);
+    pmr::set_default_resource(previous);
+
+    {
+        stdext::thread_arena scope{false};
+        assert(pmr::get_default_resource() == outside);
+    }
+}
+
+void test_rewind_and_reuse() {
+    stdext::thread_arena::trim();
+    stdext::pmr::monotonic_arena_resource* arena;
+    size_t available;
+    {
+        stdext::thread_arena scope;
+        arena     = scope.resource();
+        available = stdext::pmr::get_statistics(*arena).bytes_available;
+        {
+            stdext::thread_arena inner{false};
+            (void) inner.resource()->allocate(64, 8);
+            assert(stdext::pmr::get_statistics(*arena).bytes_available != available);
+        }
+
+        assert(stdext::pmr::get_statistics(*arena).bytes_available == available); // the inner scope was reclaimed
+
+        // grow past the current buffer; the buffers obtained stay with the thread after the scope ends
+        pmr::vector<char> big(1 << 20);
+        (void) big;
+    }
+
+    const auto retained = stdext::pmr::get_statistics(*arena);
+    assert(retained.retained_buffers != 0);
+    {
+        stdext::thread_arena scope;
+        assert(scope.resource() == arena);
+        pmr::vector<char> big(1 << 20);
+        (void) big;
+        assert(stdext::pmr::get_statistics(*arena).bytes_reserved <= retained.bytes_reserved); // reused, not grown
+    }
+
+    stdext::thread_arena::trim();
+    assert(stdext::pmr::get_statistics(*arena).retained_buffers == 0);
+}
+
+void test_pool_allocator() {
+    stdext::thread_arena scope{false};
+    vector<int, stdext::pool_allocator<int, stdext::pmr::monotonic_arena_resource>> v(scope.resource());
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+
+    assert(v.size() == 1000 && v[999] == 999);
+}
+
+int main() {
+    test_default_resource();
+    test_rewind_and_reuse();
+    test_pool_allocator();
+}
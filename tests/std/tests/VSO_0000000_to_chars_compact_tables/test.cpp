@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+using namespace std;
+
+string call(const double value, const chars_format fmt, const int precision) {
+    string buf(1500, '\0');
+    const auto result = to_chars(buf.data(), buf.data() + buf.size(), value, fmt, precision);
+    assert(result.ec == errc{});
+    buf.resize(static_cast<size_t>(result.ptr - buf.data()));
+
+    // exactly enough space, and not enough
+    string exact(buf.size(), '\0');
+    const auto exact_result = to_chars(exact.data(), exact.data() + exact.size(), value, fmt, precision);
+    assert(exact_result.ec == errc{});
+    assert(exact == buf);
+    const auto short_result = to_chars(exact.data(), exact.data() + exact.size() - 1, value, fmt, precision);
+    assert(short_result.ec == errc::value_too_large);
+    return buf;
+}
+
+// rounds the decimal digits in str to keep > 0 digits, ties to even; returns whether the rounding carried out of them
+bool round_digits(string& str, const size_t keep) {
+    bool round_up = false;
+    if (keep < str.size()) {
+        const char dropped = str[keep];
+        if (dropped != '5') {
+            round_up = dropped > '5';
+        } else if (str.find_first_not_of('0', keep + 1) != string::npos) {
+            round_up = true;
+        } else {
+            round_up = (str[keep - 1] - '0') % 2 != 0;
+        }
+    }
+
+    str.resize(keep, '0');
+    for (size_t i = keep; round_up && i-- != 0;) {
+        if (str[i] == '9') {
+            str[i] = '0';
+        } else {
+            ++str[i];
+            round_up = false;
+        }
+    }
+
+    return round_up;
+}
+
+// the fixed notation with the given precision, from the exact expansion (every double has at most 1074 fractional
+// digits, and at most 767 significant digits)
+string expected_fixed(const double value, const int precision) {
+    const string exact = call(value, chars_format::fixed, 1074);
+    const size_t dot   = exact.find('.');
+    string digits      = exact.substr(0, dot) + exact.substr(dot + 1);
+    if (round_digits(digits, dot + static_cast<size_t>(precision))) {
+        digits.insert(0, 1, '1');
+    }
+
+    if (precision != 0) {
+        digits.insert(digits.size() - static_cast<size_t>(precision), 1, '.');
+    }
+
+    return digits;
+}
+
+string expected_scientific(const double value, const int precision) {
+    const string exact = call(value, chars_format::scientific, 800);
+    const size_t e     = exact.find('e');
+    string digits      = exact.substr(0, 1) + exact.substr(2, e - 2);
+    int exponent       = stoi(exact.substr(e + 1));
+    if (round_digits(digits, static_cast<size_t>(precision) + 1)) {
+        digits[0] = '1';
+        ++exponent;
+    }
+
+    string result = digits.substr(0, 1);
+    if (precision != 0) {
+        result += '.';
+        result += digits.substr(1);
+    }
+
+    const string exponent_digits = to_string(exponent < 0 ? -exponent : exponent);
+    result += exponent < 0 ? "e-" : "e+";
+    result += exponent_digits.size() == 1 ? "0" + exponent_digits : exponent_digits;
+    return result;
+}
+
+void test_known_values() {
+    assert(call(0.125, chars_format::fixed, 2) == "0.12");
+    assert(call(0.375, chars_format::fixed, 2) == "0.38");
+    assert(call(0.5, chars_format::fixed, 0) == "0");
+    assert(call(1.5, chars_format::fixed, 0) == "2");
+    assert(call(2.5, chars_format::fixed, 0) == "2");
+    assert(call(9.9999, chars_format::fixed, 2) == "10.00");
+    assert(call(0.1, chars_format::fixed, 20) == "0.10000000000000000555");
+    assert(call(1e23, chars_format::fixed, 0) == "99999999999999991611392");
+    assert(call(123456789012345680000.0, chars_format::fixed, 1) == "123456789012345683968.0");
+    assert(call(5e-324, chars_format::fixed, 3) == "0.000");
+    assert(call(0.0, chars_format::fixed, 3) == "0.000");
+
+    assert(call(9.5, chars_format::scientific, 0) == "1e+01");
+    assert(call(8.5, chars_format::scientific, 0) == "8e+00");
+    assert(call(1.0 / 3, chars_format::scientific, 16) == "3.3333333333333331e-01");
+    assert(call(0.1, chars_format::scientific, 25) == "1.0000000000000000555111512e-01");
+    assert(call(5e-324, chars_format::scientific, 2) == "4.94e-324");
+    assert(call(1.7976931348623157e308, chars_format::scientific, 5) == "1.79769e+308");
+    assert(call(9.999999e99, chars_format::scientific, 3) == "1.000e+100");
+    assert(call(1e-5, chars_format::scientific, 0) == "1e-05");
+    assert(call(0.0, chars_format::scientific, 2) == "0.00e+00");
+}
+
+void test_random_values() {
+    mt19937_64 urbg(1729);
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t bits = urbg();
+        bits &= i % 2 == 0 ? 0x7FEF'FFFF'FFFF'FFFFULL : 0x43FF'FFFF'FFFF'FFFFULL; // finite; half below 2^65
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        for (int precision = 0; precision <= 25; ++precision) {
+            assert(call(value, chars_format::fixed, precision) == expected_fixed(value, precision));
+            assert(call(value, chars_format::scientific, precision) == expected_scientific(value, precision));
+        }
+    }
+}
+
+int main() {
+    test_known_values();
+    test_random_values();
+}
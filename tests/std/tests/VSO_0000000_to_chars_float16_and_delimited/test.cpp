@@ -0,0 +1,300 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+using namespace std;
+
+struct narrow_type {
+    int mantissa_bits;
+    int exponent_bits;
+    to_chars_result (*plain)(char*, char*, uint16_t) noexcept;
+    to_chars_result (*with_format)(char*, char*, uint16_t, chars_format) noexcept;
+};
+
+constexpr narrow_type float16{10, 5, stdext::to_chars_float16, stdext::to_chars_float16};
+constexpr narrow_type bfloat16{7, 8, stdext::to_chars_bfloat16, stdext::to_chars_bfloat16};
+
+struct decoded {
+    bool negative;
+    uint32_t mantissa;
+    uint32_t exponent;
+    double magnitude; // exact
+    double lower; // rounding interval of magnitude, exact
+    double upper;
+};
+
+decoded decode(const narrow_type& type, const uint16_t bits) {
+    const int bias = (1 << (type.exponent_bits - 1)) - 1;
+    decoded d;
+    d.negative           = (bits >> 15) != 0;
+    d.mantissa           = bits & ((1u << type.mantissa_bits) - 1);
+    d.exponent           = (bits >> type.mantissa_bits) & ((1u << type.exponent_bits) - 1);
+    const int ulp_exp    = (d.exponent == 0 ? 1 : static_cast<int>(d.exponent)) - bias - type.mantissa_bits;
+    const uint32_t whole = d.exponent == 0 ? d.mantissa : d.mantissa | (1u << type.mantissa_bits);
+    d.magnitude          = ldexp(static_cast<double>(whole), ulp_exp);
+    d.upper              = d.magnitude + ldexp(1.0, ulp_exp - 1);
+    d.lower              = d.magnitude - ldexp(1.0, ulp_exp - (d.mantissa == 0 && d.exponent > 1 ? 2 : 1));
+    return d;
+}
+
+bool round_trips(const decoded& d, const double parsed) {
+    if (d.mantissa % 2 == 0) {
+        return d.lower <= parsed && parsed <= d.upper;
+    } else {
+        return d.lower < parsed && parsed < d.upper;
+    }
+}
+
+float widen(const narrow_type& type, const uint16_t bits) {
+    // infinity and NaN, keeping the payload
+    uint32_t float_bits = static_cast<uint32_t>(bits >> 15) << 31;
+    float_bits |= 0x7F800000u | ((bits & ((1u << type.mantissa_bits) - 1)) << (23 - type.mantissa_bits));
+    float f;
+    memcpy(&f, &float_bits, sizeof(f));
+    return f;
+}
+
+double parse_double(const string_view str) {
+    double result;
+    const auto [ptr, ec] = from_chars(str.data(), str.data() + str.size(), result);
+    assert(ec == errc{});
+    assert(ptr == str.data() + str.size());
+    return result;
+}
+
+double make_decimal(const long long mantissa, const int exponent) {
+    return parse_double(to_string(mantissa) + "e" + to_string(exponent));
+}
+
+// splits scientific notation into an integer of all the digits and the exponent of its last digit
+void split_scientific(string_view str, long long& digits, int& exponent, int& count) {
+    if (str[0] == '-') {
+        str.remove_prefix(1);
+    }
+
+    const size_t e = str.find('e');
+    assert(e != string_view::npos);
+    digits = 0;
+    count  = 0;
+    for (size_t i = 0; i != e; ++i) {
+        if (str[i] != '.') {
+            digits = digits * 10 + (str[i] - '0');
+            ++count;
+        }
+    }
+
+    exponent = stoi(string{str.substr(e + 1)}) - (count - 1);
+}
+
+void test_shortest(const decoded& d, const string_view str) {
+    long long digits;
+    int exponent;
+    int count;
+    split_scientific(str, digits, exponent, count);
+
+    // no decimal with fewer digits round-trips
+    if (count > 1) {
+        char buf[32];
+        const auto result = to_chars(buf, end(buf), d.magnitude, chars_format::scientific, count - 2);
+        assert(result.ec == errc{});
+        long long shorter;
+        int shorter_exponent;
+        int shorter_count;
+        split_scientific(string_view{buf, static_cast<size_t>(result.ptr - buf)}, shorter, shorter_exponent,
+            shorter_count);
+        for (long long candidate = shorter - 1; candidate <= shorter + 1; ++candidate) {
+            assert(candidate == 0 || !round_trips(d, make_decimal(candidate, shorter_exponent)));
+        }
+    }
+
+    // and of the decimals with as many digits that round-trip, this is the closest
+    const double distance = fabs(make_decimal(digits, exponent) - d.magnitude);
+    for (const long long candidate : {digits - 1, digits + 1}) {
+        const double other = make_decimal(candidate, exponent);
+        assert(!round_trips(d, other) || fabs(other - d.magnitude) >= distance);
+    }
+}
+
+void test_exhaustive(const narrow_type& type) {
+    const uint32_t max_exponent = (1u << type.exponent_bits) - 1;
+    for (uint32_t i = 0; i != 0x10000; ++i) {
+        const auto bits = static_cast<uint16_t>(i);
+        const decoded d = decode(type, bits);
+        const auto sign = d.negative ? "-"sv : ""sv;
+        char buf[64];
+        char expected[64];
+        for (const chars_format fmt :
+            {chars_format{}, chars_format::scientific, chars_format::fixed, chars_format::general}) {
+            const auto result =
+                fmt == chars_format{} ? type.plain(buf, end(buf), bits) : type.with_format(buf, end(buf), bits, fmt);
+            assert(result.ec == errc{});
+            const string_view str{buf, static_cast<size_t>(result.ptr - buf)};
+
+            if (d.exponent == max_exponent) {
+                const float widened = widen(type, bits);
+                const auto expected_result =
+                    fmt == chars_format{} ? to_chars(expected, end(expected), widened)
+                                          : to_chars(expected, end(expected), widened, fmt);
+                assert(str == string_view(expected, static_cast<size_t>(expected_result.ptr - expected)));
+                continue;
+            }
+
+            assert(str.substr(0, sign.size()) == sign);
+            if (d.magnitude == 0.0) {
+                assert(str.substr(sign.size()) == (fmt == chars_format::scientific ? "0e+00"sv : "0"sv));
+                continue;
+            }
+
+            assert(round_trips(d, fabs(parse_double(str))));
+            if (fmt == chars_format::scientific) {
+                test_shortest(d, str);
+            }
+
+            // integers too large to be dense are printed exactly in fixed notation
+            if (str.find('e') == string_view::npos && d.magnitude >= ldexp(1.0, type.mantissa_bits + 1)) {
+                const auto exact = to_chars(expected, end(expected), d.magnitude, chars_format::fixed, 0);
+                assert(str.substr(sign.size()) == string_view(expected, static_cast<size_t>(exact.ptr - expected)));
+            }
+        }
+
+        // too small a buffer
+        const auto full = type.plain(buf, end(buf), bits);
+        assert(type.plain(buf, full.ptr - 1, bits).ec == errc::value_too_large);
+    }
+}
+
+template <class Fn, class... Args>
+string call(Fn fn, Args... args) {
+    char buf[64];
+    const auto result = fn(buf, end(buf), args...);
+    assert(result.ec == errc{});
+    return string(buf, result.ptr);
+}
+
+void test_narrow_values() {
+    const auto half = [](char* first, char* last, uint16_t bits) {
+        return stdext::to_chars_float16(first, last, bits);
+    };
+    const auto half_fmt = [](char* first, char* last, uint16_t bits, chars_format fmt) {
+        return stdext::to_chars_float16(first, last, bits, fmt);
+    };
+    const auto bf16 = [](char* first, char* last, uint16_t bits) {
+        return stdext::to_chars_bfloat16(first, last, bits);
+    };
+    const auto bf16_fmt = [](char* first, char* last, uint16_t bits, chars_format fmt) {
+        return stdext::to_chars_bfloat16(first, last, bits, fmt);
+    };
+
+    assert(call(half, uint16_t{0x3C00}) == "1");
+    assert(call(half, uint16_t{0xC000}) == "-2");
+    assert(call(half, uint16_t{0x2E66}) == "0.1");
+    assert(call(half, uint16_t{0x3555}) == "0.3333");
+    assert(call(half, uint16_t{0x0001}) == "6e-08");
+    assert(call(half, uint16_t{0x7BFF}) == "65504");
+    assert(call(half_fmt, uint16_t{0x7BFF}, chars_format::scientific) == "6.55e+04");
+    assert(call(half_fmt, uint16_t{0x7BFF}, chars_format::general) == "65504");
+    assert(call(half_fmt, uint16_t{0x2E66}, chars_format::fixed) == "0.1");
+    assert(call(half, uint16_t{0x7C00}) == "inf");
+    assert(call(half, uint16_t{0xFC00}) == "-inf");
+    assert(call(half, uint16_t{0x7E00}) == "nan");
+    assert(call(half, uint16_t{0xFE00}) == "-nan(ind)");
+    assert(call(half, uint16_t{0x8000}) == "-0");
+
+    assert(call(bf16, uint16_t{0x3F80}) == "1");
+    assert(call(bf16, uint16_t{0x4049}) == "3.14");
+    assert(call(bf16, uint16_t{0x3DCD}) == "0.1");
+    assert(call(bf16, uint16_t{0x7F7F}) == "3.39e+38");
+    assert(call(bf16_fmt, uint16_t{0x7F7F}, chars_format::fixed) == "338953138925153547590470800371487866880");
+    assert(call(bf16, uint16_t{0x0001}) == "1e-40");
+    assert(call(bf16, uint16_t{0x7FC0}) == "nan");
+}
+
+void test_delimited() {
+    char buf[64];
+
+    {
+        const double values[] = {0.1, -2.5, 1e300, 3.0};
+        const auto result     = stdext::to_chars_delimited(buf, end(buf), values, 4, ',');
+        assert(result.ec == errc{});
+        assert(result.count == 4);
+        assert(string_view(buf, static_cast<size_t>(result.ptr - buf)) == "0.1,-2.5,1e+300,3");
+    }
+
+    {
+        const float values[] = {0.5f, 1e10f};
+        const auto result    = stdext::to_chars_delimited(buf, end(buf), values, 2, ' ', chars_format::scientific);
+        assert(result.ec == errc{});
+        assert(string_view(buf, static_cast<size_t>(result.ptr - buf)) == "5e-01 1e+10");
+    }
+
+    {
+        const int values[] = {1, -22, 333};
+        const auto result  = stdext::to_chars_delimited(buf, end(buf), values, 3, '\t');
+        assert(result.ec == errc{});
+        assert(string_view(buf, static_cast<size_t>(result.ptr - buf)) == "1\t-22\t333");
+    }
+
+    {
+        const auto result = stdext::to_chars_delimited(buf, end(buf), static_cast<const double*>(nullptr), 0, ',');
+        assert(result.ec == errc{});
+        assert(result.ptr == buf);
+        assert(result.count == 0);
+    }
+
+    {
+        // the buffer fills up; resume from the values not written
+        const double values[] = {1.25, 2.5, 3.75, 5.0};
+        const auto first      = stdext::to_chars_delimited(buf, buf + 10, values, 4, ',');
+        assert(first.ec == errc::value_too_large);
+        assert(first.count == 2);
+        assert(string_view(buf, static_cast<size_t>(first.ptr - buf)) == "1.25,2.5");
+
+        // no room for the delimiter
+        const auto second = stdext::to_chars_delimited(buf, buf + 3, values + 1, 3, ',');
+        assert(second.ec == errc::value_too_large);
+        assert(second.count == 1);
+        assert(string_view(buf, static_cast<size_t>(second.ptr - buf)) == "2.5");
+
+        const auto third = stdext::to_chars_delimited(buf, buf + 2, values, 4, ',');
+        assert(third.ec == errc::value_too_large);
+        assert(third.count == 0);
+        assert(third.ptr == buf);
+    }
+
+    {
+        // the same text as individual calls
+        string expected;
+        double values[1000];
+        for (int i = 0; i < 1000; ++i) {
+            values[i] = (i - 500) * 1.0009765625e-3 * (i % 7 == 0 ? 1e200 : 1.0);
+            if (i != 0) {
+                expected.push_back(';');
+            }
+
+            char one[32];
+            expected.append(one, to_chars(one, end(one), values[i]).ptr);
+        }
+
+        string actual(expected.size(), '\0');
+        const auto result = stdext::to_chars_delimited(actual.data(), actual.data() + actual.size(), values, 1000, ';');
+        assert(result.ec == errc{});
+        assert(result.ptr == actual.data() + actual.size());
+        assert(actual == expected);
+    }
+}
+
+int main() {
+    test_exhaustive(float16);
+    test_exhaustive(bfloat16);
+    test_narrow_values();
+    test_delimited();
+}
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#if _HAS_CXX17
+#include <charconv>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+// to_string must keep producing exactly what the printf family produces
+
+template <class T>
+void assert_matches_printf(const T val, const char* const format) {
+    char buf[400];
+    sprintf_s(buf, sizeof(buf), format, val);
+    assert(to_string(val) == buf);
+
+    const wstring wide = to_wstring(val);
+    assert(wide.size() == strlen(buf));
+    for (size_t idx = 0; idx < wide.size(); ++idx) {
+        assert(wide[idx] == static_cast<wchar_t>(buf[idx]));
+    }
+}
+
+void test_integers(mt19937_64& gen) {
+    for (int shift = 0; shift < 64; ++shift) {
+        for (int rep = 0; rep < 100; ++rep) {
+            const auto bits = gen() >> shift;
+            assert_matches_printf(static_cast<unsigned long long>(bits), "%llu");
+            assert_matches_printf(static_cast<long long>(bits), "%lld");
+            assert_matches_printf(static_cast<unsigned int>(bits), "%u");
+            assert_matches_printf(static_cast<int>(bits), "%d");
+        }
+    }
+
+    // every number of digits, and the powers of 10 on either side of it
+    unsigned long long power = 1;
+    for (int digits = 1; digits <= 19; ++digits, power *= 10) {
+        assert_matches_printf(power - 1, "%llu");
+        assert_matches_printf(power, "%llu");
+        assert_matches_printf(power + 1, "%llu");
+        assert_matches_printf(-static_cast<long long>(power), "%lld");
+    }
+
+    assert_matches_printf(numeric_limits<unsigned long long>::max(), "%llu");
+    assert_matches_printf(numeric_limits<long long>::min(), "%lld");
+}
+
+void test_floating(mt19937_64& gen) {
+    constexpr double special[] = {0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 0.0000005, 0.0000004999, 0.0000015, 123456.7890125,
+        1e15, 1e22, 1e300, DBL_MAX, -DBL_MAX, DBL_MIN, DBL_TRUE_MIN, numeric_limits<double>::infinity(),
+        -numeric_limits<double>::infinity(), numeric_limits<double>::quiet_NaN(),
+        -numeric_limits<double>::quiet_NaN(), numeric_limits<double>::signaling_NaN()};
+    for (const auto val : special) {
+        assert_matches_printf(val, "%f");
+    }
+
+    for (int rep = 0; rep < 20'000; ++rep) {
+        const auto bits = gen();
+        double val;
+        memcpy(&val, &bits, sizeof(val));
+        assert_matches_printf(val, "%f");
+    }
+
+    uniform_real_distribution<double> moderate(-1e6, 1e6);
+    for (int rep = 0; rep < 20'000; ++rep) {
+        assert_matches_printf(moderate(gen), "%f");
+    }
+
+    assert(to_string(0.1f) == "0.100000");
+    assert(to_string(static_cast<long double>(1729.5)) == "1729.500000");
+}
+
+#if _HAS_CXX17
+void test_append_to_chars() {
+    string s = "value=";
+    s.reserve(100);
+    const auto data = s.data();
+    stdext::append_to_chars(s, 1729);
+    s += ',';
+    stdext::append_to_chars(s, -42LL);
+    s += ',';
+    stdext::append_to_chars(s, 255U, 16);
+    s += ',';
+    stdext::append_to_chars(s, 0.1);
+    s += ',';
+    stdext::append_to_chars(s, 1.5f, chars_format::scientific);
+    s += ',';
+    stdext::append_to_chars(s, 2.0 / 3.0, chars_format::fixed, 3);
+    assert(s == "value=1729,-42,ff,0.1,1.5e+00,0.667");
+    assert(s.data() == data); // the spare capacity was enough, so nothing moved
+
+    // results longer than the first guess are retried with more room
+    string big;
+    auto& result = stdext::append_to_chars(big, -DBL_MAX, chars_format::fixed, 6);
+    assert(&result == &big);
+    assert(big == to_string(-DBL_MAX));
+
+    string digits;
+    for (int i = 0; i < 1000; ++i) {
+        stdext::append_to_chars(digits, i % 10);
+    }
+
+    assert(digits.size() == 1000);
+    assert(digits.compare(0, 10, "0123456789") == 0);
+}
+#endif // _HAS_CXX17
+
+int main() {
+    mt19937_64 gen(1729);
+    test_integers(gen);
+    test_floating(gen);
+#if _HAS_CXX17
+    test_append_to_chars();
+#endif // _HAS_CXX17
+}
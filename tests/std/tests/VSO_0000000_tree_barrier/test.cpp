@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct count_phases {
+    int* phases;
+
+    void operator()() noexcept {
+        ++*phases;
+    }
+};
+
+void test_phases(const ptrdiff_t participants) {
+    // every participant must see what all the others wrote before the phase ended
+    constexpr int rounds = 200;
+    int phases           = 0;
+    stdext::tree_barrier<count_phases> sync(participants, count_phases{&phases});
+    vector<int> written(static_cast<size_t>(participants));
+    vector<thread> threads;
+    for (ptrdiff_t p = 0; p < participants; ++p) {
+        threads.emplace_back([&, p] {
+            for (int round = 0; round < rounds; ++round) {
+                written[static_cast<size_t>(p)] = round;
+                sync.arrive_and_wait(p);
+                for (const int value : written) {
+                    assert(value == round);
+                }
+
+                assert(phases == round + 1);
+                sync.arrive_and_wait(p); // nobody writes the next round before everybody has checked this one
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(phases == 2 * rounds);
+}
+
+void test_split_arrive_and_wait() {
+    constexpr ptrdiff_t participants = 6;
+    stdext::tree_barrier<> sync(participants);
+    atomic<int> arrived{0};
+    vector<thread> threads;
+    for (ptrdiff_t p = 0; p < participants; ++p) {
+        threads.emplace_back([&, p] {
+            for (int round = 1; round <= 100; ++round) {
+                ++arrived;
+                auto token = sync.arrive(p);
+                auto moved = move(token);
+                sync.wait(move(moved));
+                assert(arrived.load() >= round * participants);
+                sync.arrive_and_wait(p);
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(arrived.load() == 100 * participants);
+}
+
+void test_single_participant() {
+    int phases = 0;
+    stdext::tree_barrier<count_phases> sync(1, count_phases{&phases});
+    for (int i = 0; i < 10; ++i) {
+        sync.arrive_and_wait(0);
+    }
+
+    assert(phases == 10);
+}
+
+int main() {
+    test_single_participant();
+    for (const ptrdiff_t participants : {2, 3, 4, 5, 16, 17, 33}) {
+        test_phases(participants);
+    }
+
+    test_split_arrive_and_wait();
+}
@@ -0,0 +1,296 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+long long comparisons     = 0;
+int compares_before_throw = -1;
+
+struct counting_less {
+    bool operator()(const int l, const int r) const {
+        if (compares_before_throw >= 0 && compares_before_throw-- == 0) {
+            throw runtime_error("compare");
+        }
+
+        ++comparisons;
+        return l < r;
+    }
+};
+
+template <class Container>
+vector<int> keys_of(const Container& c) {
+    vector<int> result;
+    for (const auto& val : c) {
+        if constexpr (is_same_v<typename Container::key_type, typename Container::value_type>) {
+            result.push_back(val);
+        } else {
+            result.push_back(val.first);
+        }
+    }
+
+    return result;
+}
+
+template <class Container>
+void assert_usable(Container& c) {
+    assert(is_sorted(c.begin(), c.end(), [&](const auto& l, const auto& r) { return c.value_comp()(l, r); }));
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+    assert(static_cast<size_t>(distance(c.rbegin(), c.rend())) == c.size());
+
+    // the tree stays usable for later insertions and erasures
+    Container copy = c;
+    for (auto it = copy.begin(); it != copy.end();) {
+        it = copy.erase(it);
+        if (it != copy.end()) {
+            ++it;
+        }
+    }
+
+    assert(copy.size() == c.size() / 2);
+}
+
+vector<int> random_keys(mt19937& gen, const size_t count, const int range, const bool sorted) {
+    vector<int> result(count);
+    for (auto& x : result) {
+        x = static_cast<int>(gen() % static_cast<unsigned int>(range));
+    }
+
+    if (sorted) {
+        sort(result.begin(), result.end());
+    }
+
+    return result;
+}
+
+template <class Target, class Source>
+void test_merge_matches_search(mt19937& gen) {
+    for (int round = 0; round < 300; ++round) {
+        const int range   = 1 + static_cast<int>(gen() % 200);
+        const auto first  = random_keys(gen, gen() % 150, range, false);
+        const auto second = random_keys(gen, gen() % 150, range, false);
+
+        Target target(first.begin(), first.end());
+        Source source(second.begin(), second.end());
+
+        // merging node by node through the public interface gives the expected contents
+        const bool target_is_multi = Target{0, 0}.size() == 2;
+        Target expected_target     = target;
+        Source expected_source;
+        for (const int x : keys_of(source)) {
+            if (target_is_multi || expected_target.find(x) == expected_target.end()) {
+                expected_target.insert(expected_target.upper_bound(x), x);
+            } else {
+                expected_source.insert(x);
+            }
+        }
+
+        vector<const int*> addresses;
+        for (const auto& x : source) {
+            addresses.push_back(&x);
+        }
+
+        target.merge(source);
+        assert(keys_of(target) == keys_of(expected_target));
+        assert(keys_of(source) == keys_of(expected_source));
+        assert_usable(target);
+        assert_usable(source);
+
+        // merging splices nodes rather than copying elements
+        for (const int* const address : addresses) {
+            const bool in_target = any_of(target.begin(), target.end(), [&](const int& x) { return &x == address; });
+            const bool in_source = any_of(source.begin(), source.end(), [&](const int& x) { return &x == address; });
+            assert(in_target != in_source);
+        }
+    }
+}
+
+void test_merge() {
+    mt19937 gen(1729);
+    test_merge_matches_search<set<int>, set<int>>(gen);
+    test_merge_matches_search<set<int>, multiset<int>>(gen);
+    test_merge_matches_search<multiset<int>, set<int>>(gen);
+    test_merge_matches_search<multiset<int>, multiset<int>>(gen);
+
+    // a source ordered by another comparator is walked against the target's order
+    test_merge_matches_search<set<int>, set<int, greater<>>>(gen);
+    test_merge_matches_search<multiset<int>, multiset<int, greater<>>>(gen);
+
+    // equivalent elements of multi containers keep their order, those of the source after those of the target
+    multimap<int, string> mm{{1, "a"}, {2, "b"}, {2, "c"}};
+    multimap<int, string> other{{0, "d"}, {2, "e"}, {2, "f"}, {3, "g"}};
+    mm.merge(other);
+    const vector<pair<const int, string>> expected{
+        {0, "d"}, {1, "a"}, {2, "b"}, {2, "c"}, {2, "e"}, {2, "f"}, {3, "g"}};
+    assert(equal(mm.begin(), mm.end(), expected.begin(), expected.end()));
+    assert(other.empty());
+
+    map<int, string> m{{1, "a"}, {3, "b"}};
+    map<int, string> from{{1, "c"}, {2, "d"}, {3, "e"}, {4, "f"}};
+    m.merge(move(from));
+    assert(m.size() == 4 && m[1] == "a" && m[2] == "d" && m[3] == "b" && m[4] == "f");
+    assert(from.size() == 2 && from[1] == "c" && from[3] == "e");
+}
+
+void test_range_insert() {
+    mt19937 gen(4321);
+    for (int round = 0; round < 300; ++round) {
+        const int range   = 1 + static_cast<int>(gen() % 200);
+        const auto first  = random_keys(gen, gen() % 150, range, false);
+        const auto second = random_keys(gen, gen() % 150, range, round % 2 == 0);
+
+        set<int> s(first.begin(), first.end());
+        multiset<int> ms(first.begin(), first.end());
+        s.insert(second.begin(), second.end());
+        ms.insert(second.begin(), second.end());
+
+        vector<int> all = first;
+        all.insert(all.end(), second.begin(), second.end());
+        sort(all.begin(), all.end());
+        assert(keys_of(ms) == all);
+        all.erase(unique(all.begin(), all.end()), all.end());
+        assert(keys_of(s) == all);
+        assert_usable(s);
+        assert_usable(ms);
+    }
+
+    // equivalent elements are inserted after existing ones, in the order of the input
+    multimap<int, int> mm{{1, 0}, {2, 0}};
+    const vector<pair<int, int>> input{{2, 1}, {1, 1}, {2, 2}, {3, 1}, {1, 2}};
+    mm.insert(input.begin(), input.end());
+    const vector<pair<const int, int>> expected{{1, 0}, {1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}, {3, 1}};
+    assert(equal(mm.begin(), mm.end(), expected.begin(), expected.end()));
+}
+
+void test_set_operations() {
+    mt19937 gen(2718);
+    for (int round = 0; round < 300; ++round) {
+        const int range   = 1 + static_cast<int>(gen() % 100);
+        const auto first  = random_keys(gen, gen() % 150, range, false);
+        const auto second = random_keys(gen, gen() % 150, range, false);
+
+        set<int> s(first.begin(), first.end());
+        const set<int> s2(second.begin(), second.end());
+        multiset<int> ms(first.begin(), first.end());
+        const multiset<int> ms2(second.begin(), second.end());
+
+        vector<int> expected;
+        set_union(s.begin(), s.end(), s2.begin(), s2.end(), back_inserter(expected));
+        set<int> u = s;
+        u.set_union(s2);
+        assert(keys_of(u) == expected);
+        assert_usable(u);
+
+        expected.clear();
+        set_union(ms.begin(), ms.end(), ms2.begin(), ms2.end(), back_inserter(expected));
+        multiset<int> mu = ms;
+        mu.set_union(ms2);
+        assert(keys_of(mu) == expected);
+        assert_usable(mu);
+
+        expected.clear();
+        set_intersection(s.begin(), s.end(), s2.begin(), s2.end(), back_inserter(expected));
+        s.set_intersection(s2);
+        assert(keys_of(s) == expected);
+        assert_usable(s);
+
+        expected.clear();
+        set_intersection(ms.begin(), ms.end(), ms2.begin(), ms2.end(), back_inserter(expected));
+        ms.set_intersection(ms2);
+        assert(keys_of(ms) == expected);
+        assert_usable(ms);
+    }
+
+    // elements already in *this are kept, those from the argument are copied
+    map<int, string> m{{1, "a"}, {3, "b"}};
+    const map<int, string> other{{2, "c"}, {3, "d"}};
+    m.set_union(other);
+    assert(m.size() == 3 && m[1] == "a" && m[2] == "c" && m[3] == "b");
+    m.set_intersection(other);
+    assert(m.size() == 2 && m[2] == "c" && m[3] == "b");
+
+    m.set_union(m);
+    m.set_intersection(m);
+    assert(m.size() == 2);
+    m.set_intersection(map<int, string>{});
+    assert(m.empty());
+}
+
+void test_comparison_counts() {
+    // merging interleaved sorted containers walks both in order rather than searching for each element
+    constexpr int n = 100000;
+    set<int, counting_less> evens;
+    set<int, counting_less> odds;
+    for (int i = 0; i < n; ++i) {
+        evens.insert(evens.end(), 2 * i);
+        odds.insert(odds.end(), 2 * i + 1);
+    }
+
+    comparisons = 0;
+    evens.merge(odds);
+    assert(evens.size() == 2 * n && odds.empty());
+    assert(comparisons <= 5LL * n);
+
+    vector<int> more;
+    for (int i = 0; i < n; ++i) {
+        more.push_back(4 * i + 1); // half are already present
+    }
+
+    comparisons = 0;
+    evens.insert(more.begin(), more.end());
+    assert(evens.size() == 2 * n + n / 2);
+    assert(comparisons <= 5LL * n);
+
+    set<int, counting_less> other(more.begin(), more.end());
+    comparisons = 0;
+    evens.set_union(other);
+    evens.set_intersection(other);
+    assert(evens.size() == static_cast<size_t>(n));
+    assert(comparisons <= 12LL * n);
+
+    // a few elements merged into a large container still cost a search each
+    set<int, counting_less> few{-1, n, 3 * n};
+    comparisons = 0;
+    evens.merge(few);
+    assert(evens.size() == static_cast<size_t>(n) + 3);
+    assert(comparisons <= 200);
+}
+
+void test_exceptions() {
+    for (int fail = 0; fail < 200; fail += 3) {
+        set<int, counting_less> target{0, 2, 4, 6, 8, 10, 12, 14};
+        multiset<int, counting_less> source{1, 2, 3, 5, 5, 7, 20, 30};
+        const size_t total    = target.size() + source.size();
+        compares_before_throw = fail;
+        try {
+            target.merge(source);
+        } catch (const runtime_error&) {
+        }
+
+        compares_before_throw = -1;
+
+        // every node is in exactly one of the containers, both still ordered
+        assert(target.size() + source.size() == total);
+        assert_usable(target);
+        assert_usable(source);
+    }
+}
+
+int main() {
+    test_merge();
+    test_range_insert();
+    test_set_operations();
+    test_comparison_counts();
+    test_exceptions();
+}
@@ -0,0 +1,210 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Set>
+void assert_set_matches(Set& s, const vector<int>& expected) {
+    assert(s.size() == expected.size());
+    assert(equal(s.begin(), s.end(), expected.begin(), expected.end()));
+    assert(equal(s.rbegin(), s.rend(), expected.rbegin(), expected.rend()));
+    for (const int x : expected) {
+        assert(s.find(x) != s.end());
+    }
+
+    // the tree stays usable for later insertions and erasures
+    Set copy = s;
+    for (int x = -5; x < static_cast<int>(expected.size()) * 3 + 5; x += 3) {
+        copy.insert(x);
+    }
+
+    for (auto it = copy.begin(); it != copy.end();) {
+        it = copy.erase(it);
+        if (it != copy.end()) {
+            ++it;
+        }
+    }
+
+    assert(is_sorted(copy.begin(), copy.end()));
+}
+
+void test_sorted_sizes() {
+    for (int n = 0; n < 300; ++n) {
+        vector<int> v(static_cast<size_t>(n));
+        for (int i = 0; i < n; ++i) {
+            v[static_cast<size_t>(i)] = i * 2;
+        }
+
+        set<int> s(v.begin(), v.end());
+        assert_set_matches(s, v);
+
+        multiset<int> ms(v.begin(), v.end());
+        assert_set_matches(ms, v);
+    }
+}
+
+void test_duplicates() {
+    const vector<int> input{1, 1, 2, 3, 3, 3, 4, 5, 5};
+    set<int> s(input.begin(), input.end());
+    assert_set_matches(s, {1, 2, 3, 4, 5});
+
+    multiset<int> ms(input.begin(), input.end());
+    assert_set_matches(ms, input);
+
+    const vector<pair<const int, string>> pairs{{1, "a"}, {1, "b"}, {2, "c"}, {2, "d"}};
+    map<int, string> m(pairs.begin(), pairs.end());
+    assert(m.size() == 2 && m[1] == "a" && m[2] == "c"); // the first of equivalent elements is kept
+
+    multimap<int, string> mm(pairs.begin(), pairs.end());
+    assert(equal(mm.begin(), mm.end(), pairs.begin(), pairs.end())); // equivalent elements keep their order
+}
+
+void test_unsorted_suffix() {
+    mt19937 gen(1729);
+    for (int round = 0; round < 200; ++round) {
+        vector<int> v(static_cast<size_t>(gen() % 100));
+        for (auto& x : v) {
+            x = static_cast<int>(gen() % 50);
+        }
+
+        // sort a random prefix, so the input stops being sorted at an arbitrary point
+        const auto mid = v.begin() + static_cast<ptrdiff_t>(v.empty() ? 0 : gen() % v.size());
+        sort(v.begin(), mid);
+
+        set<int> s(v.begin(), v.end());
+        vector<int> unique_sorted = v;
+        sort(unique_sorted.begin(), unique_sorted.end());
+        unique_sorted.erase(unique(unique_sorted.begin(), unique_sorted.end()), unique_sorted.end());
+        assert_set_matches(s, unique_sorted);
+
+        multiset<int> ms(v.begin(), v.end());
+        vector<int> sorted = v;
+        sort(sorted.begin(), sorted.end());
+        assert_set_matches(ms, sorted);
+    }
+}
+
+void test_other_inputs() {
+    // descending input, with a comparator that makes it sorted
+    const vector<int> descending{9, 7, 5, 3, 1};
+    set<int, greater<int>> g(descending.begin(), descending.end());
+    assert(equal(g.begin(), g.end(), descending.begin(), descending.end()));
+
+    set<int> ascending(descending.begin(), descending.end());
+    assert(equal(ascending.begin(), ascending.end(), descending.rbegin(), descending.rend()));
+
+    // input iterators and forward iterators
+    istringstream stream("1 2 3 5 4 6");
+    set<int> from_stream{istream_iterator<int>(stream), istream_iterator<int>()};
+    assert_set_matches(from_stream, {1, 2, 3, 4, 5, 6});
+
+    forward_list<int> fl{1, 3, 5, 7};
+    multiset<int> from_list(fl.begin(), fl.end());
+    assert_set_matches(from_list, {1, 3, 5, 7});
+
+    // move iterators move each element exactly once, including the one that ends the sorted prefix
+    vector<unique_ptr<int>> ptrs;
+    for (const int x : {1, 2, 4, 3, 5}) {
+        ptrs.push_back(make_unique<int>(x));
+    }
+
+    set<unique_ptr<int>, function<bool(const unique_ptr<int>&, const unique_ptr<int>&)>> owners(
+        [](const unique_ptr<int>& l, const unique_ptr<int>& r) { return *l < *r; });
+    owners.insert(make_move_iterator(ptrs.begin()), make_move_iterator(ptrs.end()));
+    assert(owners.size() == 5);
+    int expected = 1;
+    for (const auto& p : owners) {
+        assert(p && *p == expected++);
+    }
+
+    // insertion into a nonempty tree and initializer lists
+    set<int> s{1, 2, 3};
+    s.insert({0, 4, 5});
+    assert_set_matches(s, {0, 1, 2, 3, 4, 5});
+    s = {7, 8, 9};
+    assert_set_matches(s, {7, 8, 9});
+}
+
+int copies_before_throw = -1;
+
+struct throwing_copy {
+    int val;
+
+    explicit throwing_copy(const int v) : val(v) {}
+
+    throwing_copy(const throwing_copy& other) : val(other.val) {
+        if (copies_before_throw >= 0 && copies_before_throw-- == 0) {
+            throw runtime_error("copy");
+        }
+    }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+
+    friend bool operator<(const throwing_copy& l, const throwing_copy& r) {
+        return l.val < r.val;
+    }
+};
+
+void test_exceptions() {
+    vector<throwing_copy> v;
+    for (int i = 0; i < 100; ++i) {
+        v.emplace_back(i);
+    }
+
+    v.emplace_back(50); // ends the sorted prefix
+
+    for (int fail = 0; fail < 110; fail += 7) {
+        copies_before_throw = fail;
+        bool threw          = false;
+        try {
+            set<throwing_copy> s(v.begin(), v.end());
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+
+        assert(threw == (fail < 101));
+        copies_before_throw = -1;
+    }
+
+    // a failed insertion into an empty container leaves it empty, or holding a valid tree of earlier elements
+    v.emplace_back(7);
+    multiset<throwing_copy> ms;
+    copies_before_throw = 101; // throws after the sorted prefix has become a tree and 50 has been inserted into it
+    bool threw          = false;
+    try {
+        ms.insert(v.begin(), v.end());
+    } catch (const runtime_error&) {
+        threw = true;
+    }
+
+    assert(threw);
+
+    copies_before_throw = -1;
+    assert(ms.size() <= 101);
+    assert(is_sorted(ms.begin(), ms.end()));
+    ms.insert(throwing_copy{1000});
+    assert(prev(ms.end())->val == 1000);
+}
+
+int main() {
+    test_sorted_sizes();
+    test_duplicates();
+    test_unsorted_suffix();
+    test_other_inputs();
+    test_exceptions();
+}
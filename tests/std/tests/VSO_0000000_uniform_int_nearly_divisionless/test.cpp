@@ -0,0 +1,185 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _USE_NEARLY_DIVISIONLESS_RANDOM_RANGES 1
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// an engine narrower than every range type, so that wide ranges need several draws
+struct byte_engine {
+    using result_type = unsigned short;
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return 255;
+    }
+
+    result_type operator()() {
+        return static_cast<result_type>(gen() & 0xFF);
+    }
+
+    mt19937 gen;
+};
+
+// an engine whose range doesn't start at zero
+struct offset_engine {
+    using result_type = unsigned int;
+
+    static constexpr result_type min() {
+        return 1000;
+    }
+
+    static constexpr result_type max() {
+        return 1000 + 0xFFFF;
+    }
+
+    result_type operator()() {
+        return 1000 + (gen() & 0xFFFF);
+    }
+
+    mt19937 gen;
+};
+
+template <class Engine, class IntType>
+void test_buckets(const IntType lo, const IntType hi) {
+    Engine eng;
+    uniform_int_distribution<IntType> dist(lo, hi);
+    const auto buckets = static_cast<size_t>(hi - lo) + 1;
+    const int per_bucket = 2000;
+    vector<int> counts(buckets);
+    for (size_t i = 0; i < buckets * per_bucket; ++i) {
+        const IntType val = dist(eng);
+        assert(lo <= val && val <= hi);
+        ++counts[static_cast<size_t>(val - lo)];
+    }
+
+    // about 6 standard deviations; a biased reduction misses by far more for the ranges tested here
+    for (const int count : counts) {
+        assert(count > per_bucket * 3 / 4 && count < per_bucket * 5 / 4);
+    }
+}
+
+template <class Engine>
+void test_small_ranges() {
+    for (const int hi : {0, 1, 2, 4, 5, 6, 99, 254, 255}) {
+        test_buckets<Engine>(0, hi);
+        test_buckets<Engine>(-hi / 2, hi - hi / 2);
+    }
+
+    test_buckets<Engine, unsigned short>(10, 20);
+    test_buckets<Engine, long long>(-3, 3);
+    test_buckets<Engine, unsigned long long>(5, 50);
+}
+
+template <class Engine, class IntType>
+void test_halves(const IntType hi) {
+    // hi / 2 + 1 values need rejection for almost half of the draws of an engine with hi + 1 values
+    Engine eng;
+    uniform_int_distribution<IntType> dist(0, hi / 2);
+    int low_half = 0;
+    const int draws = 100'000;
+    for (int i = 0; i < draws; ++i) {
+        const IntType val = dist(eng);
+        assert(val <= hi / 2);
+        low_half += val < hi / 4;
+    }
+
+    assert(low_half > draws * 48 / 100 && low_half < draws * 52 / 100);
+}
+
+template <class Engine, class IntType>
+void test_wide_range(const IntType lo, const IntType hi) {
+    Engine eng;
+    uniform_int_distribution<IntType> dist(lo, hi);
+    for (int i = 0; i < 10'000; ++i) {
+        const IntType val = dist(eng);
+        assert(lo <= val && val <= hi);
+    }
+}
+
+void test_wide_ranges() {
+    test_wide_range<mt19937, long long>(0, 1LL << 40);
+    test_wide_range<mt19937, unsigned long long>(0, numeric_limits<unsigned long long>::max());
+    test_wide_range<mt19937_64, long long>(numeric_limits<long long>::min(), numeric_limits<long long>::max());
+    test_wide_range<mt19937_64, unsigned long long>(0, (1ULL << 63) + 5);
+    test_wide_range<minstd_rand, int>(numeric_limits<int>::min(), numeric_limits<int>::max());
+    test_wide_range<byte_engine, int>(-100'000, 100'000);
+    test_wide_range<offset_engine, unsigned int>(0, numeric_limits<unsigned int>::max());
+    test_buckets<byte_engine, int>(0, 999);
+}
+
+void test_shuffle() {
+    // all 6 permutations of 3 elements are equally likely
+    mt19937 eng;
+    int counts[6]{};
+    const int draws = 60'000;
+    for (int i = 0; i < draws; ++i) {
+        int arr[3] = {0, 1, 2};
+        shuffle(begin(arr), end(arr), eng);
+        ++counts[arr[0] * 2 + (arr[1] > arr[2])];
+    }
+
+    for (const int count : counts) {
+        assert(count > draws / 6 * 9 / 10 && count < draws / 6 * 11 / 10);
+    }
+
+    vector<int> v(1000);
+    iota(v.begin(), v.end(), 0);
+    shuffle(v.begin(), v.end(), eng);
+    sort(v.begin(), v.end());
+    for (int i = 0; i < 1000; ++i) {
+        assert(v[static_cast<size_t>(i)] == i);
+    }
+}
+
+void test_sample() {
+    mt19937_64 eng;
+    vector<int> src(100);
+    iota(src.begin(), src.end(), 0);
+    int counts[100]{};
+    for (int i = 0; i < 10'000; ++i) {
+        vector<int> out;
+        sample(src.begin(), src.end(), back_inserter(out), 10, eng);
+        assert(out.size() == 10);
+        assert(is_sorted(out.begin(), out.end())); // selection sampling preserves the order of a forward range
+        assert(adjacent_find(out.begin(), out.end()) == out.end());
+        for (const int val : out) {
+            ++counts[val];
+        }
+    }
+
+    // each element is chosen about 1000 times
+    for (const int count : counts) {
+        assert(count > 800 && count < 1200);
+    }
+}
+
+int main() {
+    test_small_ranges<mt19937>();
+    test_small_ranges<mt19937_64>();
+    test_small_ranges<minstd_rand>();
+    test_small_ranges<ranlux24>();
+    test_small_ranges<byte_engine>();
+    test_small_ranges<offset_engine>();
+
+    test_halves<mt19937, unsigned int>(numeric_limits<unsigned int>::max());
+    test_halves<mt19937_64, unsigned long long>(numeric_limits<unsigned long long>::max());
+    test_halves<byte_engine, int>(255);
+
+    test_wide_ranges();
+    test_shuffle();
+    test_sample();
+}
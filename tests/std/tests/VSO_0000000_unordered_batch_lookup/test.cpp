@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Container, class Keys>
+void check_find_many(Container& c, const Keys& keys) {
+    vector<typename Container::iterator> found;
+    c.find_many(keys.begin(), keys.end(), back_inserter(found));
+    assert(found.size() == keys.size());
+
+    const Container& cc = c;
+    vector<typename Container::const_iterator> const_found(keys.size());
+    const auto last = cc.find_many(keys.begin(), keys.end(), const_found.begin());
+    assert(last == const_found.end());
+
+    size_t idx = 0;
+    for (const auto& key : keys) {
+        assert(found[idx] == c.find(key));
+        assert(const_found[idx] == cc.find(key));
+        ++idx;
+    }
+}
+
+void test_unique() {
+    unordered_map<int, string> m;
+    for (int i = 0; i < 1000; i += 2) {
+        m.emplace(i, to_string(i));
+    }
+
+    vector<int> keys;
+    for (int i = -5; i < 1010; ++i) { // present and missing keys, across several batches
+        keys.push_back(i);
+    }
+
+    keys.push_back(4);
+    keys.push_back(4);
+    check_find_many(m, keys);
+
+    vector<unordered_map<int, string>::iterator> found(3);
+    const int few[] = {2, 3, 998};
+    m.find_many(begin(few), end(few), found.begin());
+    assert(found[0]->second == "2");
+    assert(found[1] == m.end());
+    assert(found[2]->second == "998");
+
+    // duplicates within the input and of existing elements are skipped, as by insert
+    vector<pair<const int, string>> values;
+    for (int i = 0; i < 2000; i += 3) {
+        values.emplace_back(i, "new" + to_string(i));
+        values.emplace_back(i, "dup" + to_string(i));
+    }
+
+    unordered_map<int, string> expected = m;
+    expected.insert(values.begin(), values.end());
+    const size_t old_buckets = m.bucket_count();
+    m.insert_many(values.begin(), values.end());
+    assert(m.bucket_count() > old_buckets);
+    assert(m == expected);
+    assert(m[6] == "6");
+    assert(m[9] == "new9");
+    assert(m.load_factor() <= m.max_load_factor());
+
+    unordered_set<string> s;
+    const forward_list<string> words{"a", "b", "a", "c", "b"};
+    s.insert_many(words.begin(), words.begin());
+    assert(s.empty());
+    s.insert_many(words.begin(), words.end());
+    assert(s.size() == 3);
+    check_find_many(s, vector<string>{"a", "c", "d"});
+}
+
+void test_multi() {
+    unordered_multimap<int, int> mm;
+    unordered_multiset<int> ms;
+    vector<pair<const int, int>> values;
+    vector<int> keys;
+    for (int i = 0; i < 500; ++i) {
+        values.emplace_back(i % 37, i);
+        keys.push_back(i % 41);
+    }
+
+    mm.insert_many(values.begin(), values.end());
+    ms.insert_many(keys.begin(), keys.end());
+    assert(mm.size() == 500 && ms.size() == 500);
+    for (int k = 0; k < 41; ++k) {
+        assert(mm.count(k) == (k < 37 ? static_cast<size_t>(500 / 37 + (k < 500 % 37)) : 0));
+        assert(ms.count(k) == static_cast<size_t>(500 / 41 + (k < 500 % 41)));
+    }
+
+    // find_many finds the same element of each equal range as find
+    check_find_many(mm, keys);
+    check_find_many(ms, keys);
+
+    // insert_many from a range of another type converts like insert
+    const list<short> shorts{1, 2, 3};
+    ms.insert_many(shorts.begin(), shorts.end());
+    assert(ms.size() == 503);
+}
+
+void test_range_insert_reserves() {
+    unordered_set<int> s;
+    vector<int> values;
+    for (int i = 0; i < 10'000; ++i) {
+        values.push_back(i);
+    }
+
+    s.insert(values.begin(), values.end());
+    assert(s.size() == 10'000);
+    assert(s.load_factor() <= s.max_load_factor());
+
+    // the buckets were sized for the input up front
+    const size_t buckets = s.bucket_count();
+    unordered_set<int> reserved;
+    reserved.reserve(values.size());
+    assert(buckets == reserved.bucket_count());
+
+    // input that fits the existing buckets doesn't change them
+    s.insert(values.begin(), values.begin() + 100);
+    assert(s.bucket_count() == buckets);
+
+    unordered_multimap<int, int> mm;
+    const pair<const int, int> arr[] = {{1, 1}, {1, 2}, {2, 3}};
+    mm.insert(begin(arr), end(arr));
+    assert(mm.size() == 3 && mm.count(1) == 2);
+}
+
+int main() {
+    test_unique();
+    test_multi();
+    test_range_insert_reserves();
+}
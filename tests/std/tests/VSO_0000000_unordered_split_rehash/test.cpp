@@ -0,0 +1,217 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+
+// deliberately poor hash function, so that buckets hold several distinct keys
+struct collide_hash {
+    size_t operator()(const int val) const noexcept {
+        return static_cast<size_t>(val) * 64;
+    }
+};
+
+int hash_calls_before_throw = -1;
+
+struct throwing_hash {
+    size_t operator()(const int val) const {
+        if (hash_calls_before_throw >= 0 && hash_calls_before_throw-- == 0) {
+            throw runtime_error("hash");
+        }
+
+        return static_cast<size_t>(val);
+    }
+};
+
+int key_of(const int val) {
+    return val;
+}
+
+int key_of(const pair<const int, int>& val) {
+    return val.first;
+}
+
+template <class Container>
+void assert_buckets_consistent(const Container& c) {
+    assert(c.load_factor() <= c.max_load_factor());
+
+    size_t elements = 0;
+    for (size_t b = 0; b < c.bucket_count(); ++b) {
+        for (auto it = c.begin(b); it != c.end(b); ++it) {
+            assert(c.bucket(key_of(*it)) == b);
+            ++elements;
+        }
+
+        assert(static_cast<size_t>(distance(c.begin(b), c.end(b))) == c.bucket_size(b));
+    }
+
+    assert(elements == c.size());
+}
+
+template <class Container>
+void assert_equivalent_keys_adjacent(const Container& c) {
+    // once the run of a key ends, that key must not appear again
+    set<typename Container::key_type> finished;
+    auto it = c.begin();
+    while (it != c.end()) {
+        const auto key = *it;
+        assert(finished.insert(key).second);
+        const auto range = c.equal_range(key);
+        assert(range.first == it);
+        assert(static_cast<size_t>(distance(range.first, range.second)) == c.count(key));
+        it = range.second;
+    }
+}
+
+void test_multiset_growth() {
+    unordered_multiset<int, collide_hash> s;
+    multiset<int> ref;
+    size_t last_buckets = s.bucket_count();
+    bool saw_partial    = false;
+    for (int i = 0; i < 20'000; ++i) {
+        const int key = (i * 7919) % 3'000;
+        s.insert(key);
+        ref.insert(key);
+        assert(s.bucket_count() >= last_buckets);
+        last_buckets = s.bucket_count();
+        if ((last_buckets & (last_buckets - 1)) != 0) {
+            saw_partial = true;
+        }
+
+        if (i % 1'000 == 0) {
+            assert_buckets_consistent(s);
+            assert_equivalent_keys_adjacent(s);
+        }
+    }
+
+    // bucket_count() is a power of 2 between rounds, and otherwise only while buckets are being split one at a time
+    assert(saw_partial == (_STL_INCREMENTAL_HASH_REHASH != 0));
+
+    assert_buckets_consistent(s);
+    assert_equivalent_keys_adjacent(s);
+    assert(multiset<int>(s.begin(), s.end()) == ref);
+
+    for (int key = 0; key < 3'000; key += 3) {
+        assert(s.erase(key) == ref.erase(key));
+    }
+
+    assert_buckets_consistent(s);
+    assert_equivalent_keys_adjacent(s);
+    assert(multiset<int>(s.begin(), s.end()) == ref);
+
+    s.rehash(s.bucket_count() * 4);
+    assert_buckets_consistent(s);
+    assert_equivalent_keys_adjacent(s);
+    assert(multiset<int>(s.begin(), s.end()) == ref);
+}
+
+void test_map_during_growth() {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 50'000; ++i) {
+        assert(m.emplace(i, -i).second);
+        if (i % 97 == 0) {
+            if (i != 0) {
+                assert(m.erase(i - 97) == 1);
+            }
+
+            // lookups and erasures are correct whether or not the bucket of the key has been split yet
+            for (int j = 0; j <= i; j += 13) {
+                const auto where = m.find(j);
+                assert((j % 97 != 0 || j == i) == (where != m.end()));
+                if (where != m.end()) {
+                    assert(where->second == -j);
+                }
+            }
+        }
+    }
+
+    assert_buckets_consistent(m);
+    const auto size = m.size();
+    m.clear();
+    assert(m.empty());
+    for (int i = 0; i < static_cast<int>(size); ++i) {
+        m.emplace(i, i);
+    }
+
+    assert_buckets_consistent(m);
+}
+
+void test_max_load_factor_change() {
+    unordered_set<int> s;
+    for (int i = 0; i < 10'000; ++i) {
+        s.insert(i);
+    }
+
+    s.max_load_factor(0.1f);
+    s.insert(-1);
+    assert_buckets_consistent(s);
+
+    s.max_load_factor(4.0f);
+    for (int i = 10'000; i < 60'000; ++i) {
+        s.insert(i);
+    }
+
+    assert_buckets_consistent(s);
+    assert(s.size() == 60'001);
+}
+
+void test_throwing_hash() {
+    // a hash function that throws while elements are being moved between buckets clears the container
+    unordered_set<int, throwing_hash> s;
+    for (int i = 0; i < 2'000; ++i) {
+        s.insert(i);
+    }
+
+    bool threw = false;
+    for (int i = 2'000; i < 100'000 && !threw; ++i) {
+        hash_calls_before_throw = 1; // the insertion's own hash succeeds, rehashing the old elements throws
+        try {
+            s.insert(i);
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+
+        hash_calls_before_throw = -1;
+    }
+
+    assert(threw);
+    assert(s.empty());
+    assert_buckets_consistent(s);
+    s.insert(1);
+    assert(s.count(1) == 1);
+}
+
+void test_copy_and_swap() {
+    unordered_multimap<int, int> m;
+    for (int i = 0; i < 5'000; ++i) {
+        m.emplace(i % 1'000, i);
+    }
+
+    auto copy = m;
+    assert(copy == m);
+    assert_buckets_consistent(copy);
+
+    unordered_multimap<int, int> other;
+    other.swap(copy);
+    assert(other == m);
+    assert(copy.empty());
+    copy = move(other);
+    assert(copy == m);
+    assert_buckets_consistent(copy);
+}
+
+int main() {
+    test_multiset_growth();
+    test_map_during_growth();
+    test_max_load_factor_change();
+    test_throwing_hash();
+    test_copy_and_swap();
+}
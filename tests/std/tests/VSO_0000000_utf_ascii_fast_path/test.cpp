@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
+#include <assert.h>
+#include <codecvt>
+#include <cstddef>
+#include <cwchar>
+#include <locale>
+#include <string>
+#include <vector>
+
+#if _HAS_CXX17
+#include <filesystem>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+// Runs of ASCII are converted a block at a time; these strings put a non-ASCII character at every position of the
+// first few blocks, so that every way a run can end is covered.
+const string euro_utf8 = "\xE2\x82\xAC";
+
+string ascii_run(const size_t len) {
+    string result;
+    for (size_t i = 0; i < len; ++i) {
+        result.push_back(static_cast<char>('!' + i % 90));
+    }
+
+    return result;
+}
+
+template <class Facet>
+void test_round_trip(const Facet& facet, const string& utf8, const basic_string<typename Facet::intern_type>& wide) {
+    using Elem = typename Facet::intern_type;
+    mbstate_t state{};
+    vector<Elem> wide_out(utf8.size() + 1);
+    const char* from_next;
+    Elem* to_next;
+    assert(facet.in(state, utf8.data(), utf8.data() + utf8.size(), from_next, wide_out.data(),
+               wide_out.data() + wide_out.size(), to_next)
+           == codecvt_base::ok);
+    assert(from_next == utf8.data() + utf8.size());
+    assert(basic_string<Elem>(wide_out.data(), to_next) == wide);
+
+    state = mbstate_t{};
+    vector<char> utf8_out(wide.size() * 4 + 1);
+    const Elem* wide_next;
+    char* out_next;
+    assert(facet.out(state, wide.data(), wide.data() + wide.size(), wide_next, utf8_out.data(),
+               utf8_out.data() + utf8_out.size(), out_next)
+           == codecvt_base::ok);
+    assert(wide_next == wide.data() + wide.size());
+    assert(string(utf8_out.data(), out_next) == utf8);
+}
+
+template <class Facet>
+void test_small_output(const Facet& facet) {
+    // an output range that ends inside a run of ASCII stops the conversion exactly there
+    using Elem         = typename Facet::intern_type;
+    const string utf8  = ascii_run(40);
+    mbstate_t state{};
+    Elem buf[21];
+    const char* from_next;
+    Elem* to_next;
+    assert(facet.in(state, utf8.data(), utf8.data() + utf8.size(), from_next, buf, buf + 21, to_next)
+           != codecvt_base::error);
+    assert(from_next == utf8.data() + 21 && to_next == buf + 21);
+    for (size_t i = 0; i < 21; ++i) {
+        assert(buf[i] == static_cast<Elem>(utf8[i]));
+    }
+}
+
+template <class Facet>
+void test_facet() {
+    using Elem = typename Facet::intern_type;
+    Facet facet;
+    for (size_t len = 0; len < 70; ++len) {
+        for (size_t pos = 0; pos <= len; pos += (len < 40 ? 1 : 7)) {
+            string utf8 = ascii_run(len);
+            basic_string<Elem> wide(utf8.begin(), utf8.end());
+            if (pos < len) {
+                utf8.replace(pos, 1, euro_utf8);
+                wide[pos] = static_cast<Elem>(0x20AC);
+            }
+
+            test_round_trip(facet, utf8, wide);
+        }
+    }
+
+    test_small_output(facet);
+
+    // invalid UTF-8 after a run of ASCII is still an error
+    string bad = ascii_run(35);
+    bad[33]    = '\x80';
+    mbstate_t state{};
+    Elem buf[64];
+    const char* from_next;
+    Elem* to_next;
+    assert(facet.in(state, bad.data(), bad.data() + bad.size(), from_next, buf, buf + 64, to_next)
+           == codecvt_base::error);
+    assert(to_next == buf + 33);
+}
+
+void test_headers() {
+    // the byte order mark is still consumed or generated around runs of ASCII
+    codecvt_utf8<wchar_t, 0x10ffff, codecvt_mode(consume_header | generate_header)> facet;
+    const string utf8 = "\xEF\xBB\xBF" + ascii_run(20);
+    mbstate_t state{};
+    wchar_t buf[32];
+    const char* from_next;
+    wchar_t* to_next;
+    assert(facet.in(state, utf8.data(), utf8.data() + utf8.size(), from_next, buf, buf + 32, to_next)
+           == codecvt_base::ok);
+    assert(to_next - buf == 20 && buf[0] == L'!');
+
+    state = mbstate_t{};
+    char out[32];
+    const wchar_t* wide_next;
+    char* out_next;
+    assert(facet.out(state, buf, to_next, wide_next, out, out + 32, out_next) == codecvt_base::ok);
+    assert(string(out, out_next) == utf8);
+
+    // values over the maximum are still rejected
+    const codecvt_utf8<char16_t, 0x40> small_max;
+    const string letters = "abcdefghijklmnopqrstuvwxyz";
+    state                = mbstate_t{};
+    char16_t buf16[32];
+    char16_t* to_next16;
+    assert(small_max.in(state, letters.data(), letters.data() + letters.size(), from_next, buf16, buf16 + 32,
+               to_next16)
+           == codecvt_base::error);
+}
+
+#if _HAS_CXX17
+void test_filesystem() {
+    for (size_t len = 0; len < 70; len += 3) {
+        for (size_t pos = 0; pos <= len; pos += 5) {
+            string utf8 = ascii_run(len);
+            wstring wide(utf8.begin(), utf8.end());
+            if (pos < len) {
+                utf8.replace(pos, 1, euro_utf8);
+                wide[pos] = L'\x20AC';
+            }
+
+            const filesystem::path p = filesystem::u8path(utf8);
+            assert(p.native() == wide);
+            assert(p.u8string() == utf8);
+        }
+    }
+
+    // an unpaired surrogate after a run of ASCII still can't be converted
+    wstring unpaired(20, L'a');
+    unpaired.push_back(L'\xD800');
+    bool threw = false;
+    try {
+        (void) filesystem::path(unpaired).u8string();
+    } catch (const filesystem::filesystem_error&) {
+        threw = true;
+    } catch (const system_error&) {
+        threw = true;
+    }
+    assert(threw);
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_facet<codecvt_utf8<wchar_t>>();
+    test_facet<codecvt_utf8<char16_t>>();
+    test_facet<codecvt_utf8<char32_t>>();
+    test_facet<codecvt_utf8_utf16<wchar_t>>();
+    test_facet<codecvt_utf8_utf16<char16_t>>();
+    test_headers();
+#if _HAS_CXX17
+    test_filesystem();
+#endif // _HAS_CXX17
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <valarray>
+
+using namespace std;
+
+template <class T>
+bool equal_to_list(const valarray<T>& arr, initializer_list<T> expected) {
+    if (arr.size() != expected.size()) {
+        return false;
+    }
+
+    size_t idx = 0;
+    for (const auto& val : expected) {
+        if (arr[idx++] != val) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void test_operators() {
+    const valarray<int> a{1, 2, 3, 4, 5};
+    const valarray<int> b{5, 4, 3, 2, 1};
+    const valarray<int> c{1, 1, 1, 1, 1};
+
+    // temporaries on either side, or both, are reused
+    assert(equal_to_list(a * b + c, {6, 9, 10, 9, 6}));
+    assert(equal_to_list(c + a * b, {6, 9, 10, 9, 6}));
+    assert(equal_to_list(a * b - a * b, {0, 0, 0, 0, 0}));
+    assert(equal_to_list(a - b * c, {-4, -2, 0, 2, 4}));
+    assert(equal_to_list(a * c - 10, {-9, -8, -7, -6, -5}));
+    assert(equal_to_list(10 - a * c, {9, 8, 7, 6, 5}));
+    assert(equal_to_list(100 / (a * c), {100, 50, 33, 25, 20}));
+    assert(equal_to_list((a * c) % 2, {1, 0, 1, 0, 1}));
+    assert(equal_to_list((a * c) << 1, {2, 4, 6, 8, 10}));
+    assert(equal_to_list(1 << (a * c), {2, 4, 8, 16, 32}));
+    assert(equal_to_list((a * c) ^ b, {4, 6, 0, 6, 4}));
+    assert(equal_to_list(-a, {-1, -2, -3, -4, -5}));
+    assert(equal_to_list(~a, {-2, -3, -4, -5, -6}));
+    assert(equal_to_list(!valarray<int>{0, 1}, {true, false}));
+
+    // a scalar operand that is an element of the array being modified is read once
+    valarray<int> d = a;
+    d *= d[2];
+    assert(equal_to_list(d, {3, 6, 9, 12, 15}));
+
+    valarray<int> e = a;
+    assert(equal_to_list(e[1] * move(e), {2, 4, 6, 8, 10}));
+
+    const valarray<double> p(1.5, 1000);
+    const valarray<double> q(2.0, 1000);
+    const valarray<double> r = p * q + p * q - q;
+    assert(r.size() == 1000);
+    assert(r[0] == 4.0);
+    assert(r[999] == 4.0);
+
+    valarray<int> empty;
+    empty = empty + empty * empty;
+    assert(empty.size() == 0);
+}
+
+void test_slices() {
+    valarray<int> x(20);
+    for (int i = 0; i < 20; ++i) {
+        x[static_cast<size_t>(i)] = i;
+    }
+
+    valarray<int> s = x[slice(2, 5, 3)];
+    assert(equal_to_list(s, {2, 5, 8, 11, 14}));
+    s = x[slice(1, 5, 2)]; // same size, reuses storage
+    assert(equal_to_list(s, {1, 3, 5, 7, 9}));
+
+    valarray<int> y = x;
+    y = y[slice(1, 5, 2)]; // gathering from itself
+    assert(equal_to_list(y, {1, 3, 5, 7, 9}));
+    y = x;
+    y = y[slice(19, 20, 0)];
+    assert(y.size() == 20);
+    assert(y.min() == 19 && y.max() == 19);
+
+    const gslice g2(1, {2, 3}, {7, 2});
+    assert(equal_to_list(valarray<int>(x[g2]), {1, 3, 5, 8, 10, 12}));
+
+    valarray<int> z = x;
+    z = z[g2];
+    assert(equal_to_list(z, {1, 3, 5, 8, 10, 12}));
+
+    valarray<int> w(6);
+    w = x[g2];
+    assert(equal_to_list(w, {1, 3, 5, 8, 10, 12}));
+
+    const gslice g3(0, {2, 2, 2}, {9, 3, 1});
+    assert(equal_to_list(valarray<int>(x[g3]), {0, 1, 3, 4, 9, 10, 12, 13}));
+
+    valarray<int> v = x;
+    v[g3] += valarray<int>(100, 8);
+    v[g3] *= valarray<int>(2, 8);
+    assert(v[0] == 200);
+    assert(v[2] == 2);
+    assert(v[13] == 226);
+    v[g3] = 7;
+    assert(v[12] == 7);
+    assert(v[14] == 14);
+
+    assert(valarray<int>(x[gslice(0, {2, 0}, {7, 2})]).size() == 0);
+    assert(valarray<int>(x[gslice(0, {}, {})]).size() == 0);
+}
+
+int main() {
+    test_operators();
+    test_slices();
+}
@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+using namespace std;
+
+// Visiting several variants whose states multiply to more than 256 dispatches on one variant at a time; these tests
+// exercise that path with large and small alternative counts, and with valueless variants.
+template <size_t I>
+struct alt {
+    static constexpr size_t value = I;
+};
+
+template <class Seq>
+struct make_big;
+
+template <size_t... Is>
+struct make_big<index_sequence<Is...>> {
+    using type = variant<alt<Is>...>;
+};
+
+using big_variant   = make_big<make_index_sequence<24>>::type; // 25 states, so two of them need 625
+using small_variant = make_big<make_index_sequence<8>>::type;  // 9 states, so three of them need 729
+
+template <size_t I, class Variant>
+Variant make_at() {
+    return Variant{in_place_index<I>};
+}
+
+template <class Variant, size_t... Is>
+Variant make_dynamic(const size_t idx, index_sequence<Is...>) {
+    Variant result;
+    (void) ((Is == idx ? (result.template emplace<Is>(), true) : false) || ...);
+    return result;
+}
+
+template <class Variant>
+Variant make_dynamic(const size_t idx) {
+    return make_dynamic<Variant>(idx, make_index_sequence<variant_size_v<Variant>>{});
+}
+
+struct combine {
+    template <size_t... Is>
+    size_t operator()(alt<Is>...) const {
+        size_t result = 0;
+        ((result = result * 100 + Is), ...);
+        return result;
+    }
+};
+
+void test_two_big() {
+    for (size_t i = 0; i < 24; ++i) {
+        for (size_t j = 0; j < 24; ++j) {
+            const big_variant a = make_dynamic<big_variant>(i);
+            big_variant b       = make_dynamic<big_variant>(j);
+            assert(visit(combine{}, a, b) == i * 100 + j);
+            assert(visit(combine{}, move(b), a) == j * 100 + i);
+        }
+    }
+}
+
+void test_three_small() {
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            for (size_t k = 0; k < 8; ++k) {
+                const small_variant a = make_dynamic<small_variant>(i);
+                const small_variant b = make_dynamic<small_variant>(j);
+                const small_variant c = make_dynamic<small_variant>(k);
+                assert(visit(combine{}, a, b, c) == (i * 100 + j) * 100 + k);
+            }
+        }
+    }
+}
+
+struct mixed_visitor {
+    template <size_t I, size_t J>
+    size_t operator()(int, alt<I>, alt<J>) const {
+        return 0;
+    }
+
+    template <size_t I, size_t J>
+    size_t operator()(const string& str, alt<I>, alt<J>) const {
+        return str.size() * 10'000 + I * 100 + J;
+    }
+};
+
+void test_mixed_sizes() {
+    // a small variant first, then big ones; each level picks its own switch size
+    const variant<int, string> first{string{"meow"}};
+    for (size_t i = 0; i < 24; ++i) {
+        for (size_t j = 0; j < 24; j += 5) {
+            const big_variant second = make_dynamic<big_variant>(i);
+            const big_variant third  = make_dynamic<big_variant>(j);
+            assert(visit(mixed_visitor{}, first, second, third) == 40'000 + i * 100 + j);
+        }
+    }
+}
+
+struct will_throw {
+    will_throw() = default;
+    will_throw(const will_throw&) {
+        throw runtime_error("copy");
+    }
+    will_throw& operator=(const will_throw&) = default;
+};
+
+void test_valueless() {
+    using throwing_big_variant = make_big<make_index_sequence<23>>::type;
+    variant<will_throw, alt<0>, alt<1>, alt<2>, alt<3>, alt<4>, alt<5>, alt<6>, alt<7>, alt<8>, alt<9>, alt<10>,
+        alt<11>, alt<12>, alt<13>, alt<14>, alt<15>, alt<16>, alt<17>, alt<18>, alt<19>, alt<20>, alt<21>, alt<22>>
+        v{in_place_index<1>};
+    try {
+        const will_throw source;
+        v.emplace<0>(source);
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+    assert(v.valueless_by_exception());
+
+    const throwing_big_variant other = make_at<5, throwing_big_variant>();
+    bool threw               = false;
+    try {
+        (void) visit([](const auto&, const auto&) { return 0; }, other, v);
+    } catch (const bad_variant_access&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void test_references() {
+    struct holder {
+        int first  = 1;
+        int second = 2;
+    };
+
+    holder h;
+    big_variant a = make_at<3, big_variant>();
+    big_variant b = make_at<20, big_variant>();
+    int& ref = visit([&h](auto x, auto y) -> int& { return x.value < y.value ? h.first : h.second; }, a, b);
+    assert(&ref == &h.first);
+    ref = 42;
+    assert(h.first == 42);
+}
+
+#if _HAS_CXX20
+void test_explicit_return() {
+    big_variant a     = make_at<7, big_variant>();
+    big_variant b     = make_at<11, big_variant>();
+    int calls = 0;
+    visit<void>(
+        [&calls](auto x, auto y) {
+            ++calls;
+            return x.value + y.value;
+        },
+        a, b);
+    assert(calls == 1);
+
+    const long long sum = visit<long long>([](auto x, auto y) { return static_cast<int>(x.value + y.value); }, a, b);
+    assert(sum == 18);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_two_big();
+    test_three_small();
+    test_mixed_sizes();
+    test_valueless();
+    test_references();
+#if _HAS_CXX20
+    test_explicit_return();
+#endif // _HAS_CXX20
+}
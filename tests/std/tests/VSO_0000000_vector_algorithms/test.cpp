@@ -6,7 +6,10 @@
 #include <deque>
 #include <isa_availability.h>
 #include <list>
+#include <numeric>
 #include <random>
+#include <string>
+#include <string_view>
 #include <vector>
 
 using namespace std;
@@ -21,6 +24,594 @@ void disable_instructions(ISA_AVAILABILITY isa) {
 
 constexpr size_t dataCount = 1024;
 
+template <class FwdIt, class T>
+inline ptrdiff_t last_known_good_count(FwdIt first, FwdIt last, T v) {
+    ptrdiff_t result = 0;
+    for (; first != last; ++first) {
+        result += (*first == v);
+    }
+    return result;
+}
+
+template <class T>
+void test_case_count(const vector<T>& input, T v) {
+    auto expected = last_known_good_count(input.begin(), input.end(), v);
+    auto actual   = count(input.begin(), input.end(), v);
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    assert(expected == ranges::count(input, v));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_count(mt19937_64& gen) {
+    // small value range so that matches are frequent
+    const auto fn = [&]() { return static_cast<T>(gen() % 10); };
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_count(input, fn());
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(fn());
+        test_case_count(input, fn());
+    }
+}
+
+template <class FwdIt, class T>
+inline auto last_known_good_find(FwdIt first, FwdIt last, T v) {
+    for (; first != last; ++first) {
+        if (*first == v) {
+            break;
+        }
+    }
+    return first;
+}
+
+template <class T>
+void test_case_find(const vector<T>& input, T v) {
+    auto expected = last_known_good_find(input.begin(), input.end(), v);
+    auto actual   = find(input.begin(), input.end(), v);
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    assert(expected == ranges::find(input, v));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_find(mt19937_64& gen) {
+    // large enough value range that the searched value is often absent from short inputs
+    const auto fn = [&]() { return static_cast<T>(gen() % 100); };
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_find(input, fn());
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(fn());
+        test_case_find(input, fn());
+    }
+}
+
+void test_find_count_value_conversions() {
+    // values that can't compare equal to any element must not match by truncation
+    const vector<signed char> sc = {-1, 0, 1, 127, -128};
+    assert(find(sc.begin(), sc.end(), 255) == sc.end());
+    assert(find(sc.begin(), sc.end(), -1) == sc.begin());
+    assert(count(sc.begin(), sc.end(), 0x100) == 0);
+
+    const vector<unsigned short> us = {0, 1, 0xFFFF, 0xFFFF};
+    assert(find(us.begin(), us.end(), -1) == us.end());
+    assert(find(us.begin(), us.end(), 0xFFFF) == us.begin() + 2);
+    assert(count(us.begin(), us.end(), 0x1FFFF) == 0);
+    assert(count(us.begin(), us.end(), 0xFFFFLL) == 2);
+
+    // the usual arithmetic conversions make -1 and 0xFFFFFFFFu compare equal
+    const vector<int> si = {5, -1, 7, -1};
+    assert(find(si.begin(), si.end(), 0xFFFFFFFFu) == si.begin() + 1);
+    assert(count(si.begin(), si.end(), 0xFFFFFFFFu) == 2);
+    assert(find(si.begin(), si.end(), 0xFFFFFFFFULL) == si.end());
+    assert(count(si.begin(), si.end(), -1LL) == 2);
+
+    const vector<long long> sll = {-1, 0, 1};
+    assert(find(sll.begin(), sll.end(), 0xFFFFFFFFu) == sll.end());
+    assert(find(sll.begin(), sll.end(), 1u) == sll.begin() + 2);
+
+    const bool b[] = {false, true, true};
+    assert(find(begin(b), end(b), true) == begin(b) + 1);
+    assert(count(begin(b), end(b), true) == 2);
+
+    int arr[3]{};
+    int* const ptrs[] = {&arr[0], nullptr, &arr[2], nullptr};
+    assert(find(begin(ptrs), end(ptrs), nullptr) == begin(ptrs) + 1);
+    assert(find(begin(ptrs), end(ptrs), &arr[2]) == begin(ptrs) + 2);
+    assert(find(begin(ptrs), end(ptrs), &arr[1]) == end(ptrs));
+    assert(count(begin(ptrs), end(ptrs), nullptr) == 2);
+}
+
+template <class FwdIt>
+inline pair<FwdIt, FwdIt> last_known_good_minmax_element(FwdIt first, FwdIt last) {
+    // find the first smallest and the last largest element
+    FwdIt min_found = first;
+    FwdIt max_found = first;
+    for (; first != last; ++first) {
+        if (*first < *min_found) {
+            min_found = first;
+        }
+
+        if (!(*first < *max_found)) {
+            max_found = first;
+        }
+    }
+
+    return {min_found, max_found};
+}
+
+template <class FwdIt>
+inline FwdIt last_known_good_max_element(FwdIt first, FwdIt last) {
+    FwdIt found = first;
+    for (; first != last; ++first) {
+        if (*found < *first) {
+            found = first;
+        }
+    }
+
+    return found;
+}
+
+template <class T>
+void test_case_min_max_element(const vector<T>& input) {
+    const auto expected_minmax = last_known_good_minmax_element(input.begin(), input.end());
+    const auto expected_max    = last_known_good_max_element(input.begin(), input.end());
+    assert(min_element(input.begin(), input.end()) == expected_minmax.first);
+    assert(max_element(input.begin(), input.end()) == expected_max);
+    assert(minmax_element(input.begin(), input.end()) == expected_minmax);
+#ifdef __cpp_lib_concepts
+    assert(ranges::min_element(input) == expected_minmax.first);
+    assert(ranges::max_element(input) == expected_max);
+    const auto actual_minmax = ranges::minmax_element(input);
+    assert(actual_minmax.min == expected_minmax.first);
+    assert(actual_minmax.max == expected_minmax.second);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_min_max_element(mt19937_64& gen) {
+    // alternate between a narrow value range with many ties and the full range of T
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_min_max_element(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        if (attempts % 2 == 0) {
+            input.push_back(static_cast<T>(gen() % 8)); // intentionally narrows
+        } else {
+            input.push_back(static_cast<T>(gen())); // intentionally narrows
+        }
+
+        test_case_min_max_element(input);
+    }
+}
+
+template <class T>
+void test_min_max_element_floating(mt19937_64& gen) {
+    // signed zeros are equivalent, so the first or last of them must be found
+    uniform_int_distribution<int> dis(-10, 10);
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_min_max_element(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const int val = dis(gen);
+        if (val == 0) {
+            input.push_back(attempts % 2 == 0 ? T{0.0} : -T{0.0});
+        } else {
+            input.push_back(static_cast<T>(val) / 4);
+        }
+
+        test_case_min_max_element(input);
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+inline pair<FwdIt1, FwdIt2> last_known_good_mismatch(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (; first1 != last1 && first2 != last2 && *first1 == *first2; ++first1, (void) ++first2) {
+    }
+
+    return {first1, first2};
+}
+
+template <class FwdIt1, class FwdIt2, class Pr>
+inline bool last_known_good_lex_compare(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2, Pr pred) {
+    for (; first1 != last1 && first2 != last2; ++first1, (void) ++first2) {
+        if (pred(*first1, *first2)) {
+            return true;
+        } else if (pred(*first2, *first1)) {
+            return false;
+        }
+    }
+
+    return first1 == last1 && first2 != last2;
+}
+
+template <class T>
+void test_case_mismatch_lex_compare(const vector<T>& left, const vector<T>& right) {
+    const auto expected = last_known_good_mismatch(left.begin(), left.end(), right.begin(), right.end());
+    assert(mismatch(left.begin(), left.end(), right.begin(), right.end()) == expected);
+    if (left.size() <= right.size()) {
+        assert(mismatch(left.begin(), left.end(), right.begin()) == expected);
+    }
+
+    const bool expected_less =
+        last_known_good_lex_compare(left.begin(), left.end(), right.begin(), right.end(), less<>{});
+    assert(lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()) == expected_less);
+    const bool expected_greater =
+        last_known_good_lex_compare(left.begin(), left.end(), right.begin(), right.end(), greater<>{});
+    assert(lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(), greater<>{})
+           == expected_greater);
+    assert(lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(), greater<T>{})
+           == expected_greater);
+#ifdef __cpp_lib_concepts
+    const auto actual = ranges::mismatch(left, right);
+    assert(actual.in1 == expected.first);
+    assert(actual.in2 == expected.second);
+    assert(ranges::lexicographical_compare(left, right) == expected_less);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_mismatch_lex_compare(mt19937_64& gen) {
+    // make the ranges differ at one random position, or be equal up to the length of the shorter one
+    vector<T> left;
+    vector<T> right;
+    left.reserve(dataCount);
+    right.reserve(dataCount);
+    test_case_mismatch_lex_compare(left, right);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const T val = static_cast<T>(gen()); // intentionally narrows
+        left.push_back(val);
+        right.push_back(val);
+        test_case_mismatch_lex_compare(left, right);
+
+        const size_t pos = static_cast<size_t>(gen() % left.size());
+        const T old_val  = right[pos];
+        right[pos]       = static_cast<T>(gen()); // intentionally narrows
+        test_case_mismatch_lex_compare(left, right);
+        right[pos] = old_val;
+
+        right.pop_back();
+        test_case_mismatch_lex_compare(left, right);
+        test_case_mismatch_lex_compare(right, left);
+        right.push_back(val);
+    }
+}
+
+void test_char_traits_compare() {
+    using traits = char_traits<char32_t>;
+    u32string left(dataCount, U'x');
+    u32string right = left;
+    assert(traits::compare(left.data(), right.data(), left.size()) == 0);
+    for (size_t pos = 0; pos < left.size(); pos += 7) {
+        right[pos] = U'\x10FFFF';
+        assert(traits::compare(left.data(), right.data(), left.size()) < 0);
+        assert(traits::compare(right.data(), left.data(), left.size()) > 0);
+        assert(traits::compare(left.data(), right.data(), pos) == 0);
+        assert(left.compare(right) < 0);
+        right[pos] = U'x';
+    }
+}
+
+template <class CharT>
+size_t last_known_good_find_of(const basic_string<CharT>& haystack, const basic_string<CharT>& needle,
+    const size_t pos, const bool in_needle, const bool backward) {
+    const auto matches = [&](const CharT ch) { return (needle.find(ch) != basic_string<CharT>::npos) == in_needle; };
+    if (backward) {
+        if (!haystack.empty()) {
+            for (size_t i = (min)(pos, haystack.size() - 1) + 1; i-- != 0;) {
+                if (matches(haystack[i])) {
+                    return i;
+                }
+            }
+        }
+    } else {
+        for (size_t i = pos; i < haystack.size(); ++i) {
+            if (matches(haystack[i])) {
+                return i;
+            }
+        }
+    }
+
+    return basic_string<CharT>::npos;
+}
+
+template <class CharT>
+void test_case_find_of(const basic_string<CharT>& haystack, const basic_string<CharT>& needle) {
+    const size_t size = haystack.size();
+    for (const size_t pos : {size_t{0}, size_t{1}, size / 2, size - 1, size, basic_string<CharT>::npos}) {
+        const size_t first_of     = last_known_good_find_of(haystack, needle, pos, true, false);
+        const size_t last_of      = last_known_good_find_of(haystack, needle, pos, true, true);
+        const size_t first_not_of = last_known_good_find_of(haystack, needle, pos, false, false);
+        const size_t last_not_of  = last_known_good_find_of(haystack, needle, pos, false, true);
+
+        assert(haystack.find_first_of(needle, pos) == first_of);
+        assert(haystack.find_last_of(needle, pos) == last_of);
+        assert(haystack.find_first_not_of(needle, pos) == first_not_of);
+        assert(haystack.find_last_not_of(needle, pos) == last_not_of);
+
+#if _HAS_CXX17
+        const basic_string_view<CharT> haystack_view = haystack;
+        const basic_string_view<CharT> needle_view   = needle;
+        assert(haystack_view.find_first_of(needle_view, pos) == first_of);
+        assert(haystack_view.find_last_of(needle_view, pos) == last_of);
+        assert(haystack_view.find_first_not_of(needle_view, pos) == first_not_of);
+        assert(haystack_view.find_last_not_of(needle_view, pos) == last_not_of);
+#endif // _HAS_CXX17
+    }
+}
+
+template <class CharT>
+void test_find_of(mt19937_64& gen) {
+    // small alphabets match often; large ones exercise characters outside the 1-byte bitmap
+    for (const unsigned int alphabet : {4U, 200U, 70000U}) {
+        basic_string<CharT> input;
+        for (size_t i = 0; i < dataCount; ++i) {
+            input.push_back(static_cast<CharT>(gen() % alphabet)); // intentionally narrows
+        }
+
+        basic_string<CharT> needle;
+        for (size_t needle_size = 0; needle_size <= 20; ++needle_size) {
+            for (const size_t hay_size : {0, 1, 15, 16, 17, 31, 33, 63, 100, 1024}) {
+                test_case_find_of(input.substr(0, hay_size), needle);
+            }
+
+            needle.push_back(static_cast<CharT>(gen() % alphabet)); // intentionally narrows
+        }
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+inline FwdIt1 last_known_good_search(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (;; ++first1) {
+        FwdIt1 mid1 = first1;
+        for (FwdIt2 mid2 = first2;; ++mid1, (void) ++mid2) {
+            if (mid2 == last2) {
+                return first1;
+            } else if (mid1 == last1) {
+                return last1;
+            } else if (*mid1 != *mid2) {
+                break;
+            }
+        }
+    }
+}
+
+template <class T>
+void test_case_search(const vector<T>& haystack, const vector<T>& needle) {
+    const auto expected = last_known_good_search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+    assert(search(haystack.begin(), haystack.end(), needle.begin(), needle.end()) == expected);
+}
+
+template <class T>
+void test_search(mt19937_64& gen) {
+    // a two-letter alphabet makes for repetitive inputs, which the vectorized search hands off to Two-Way
+    for (const unsigned int alphabet : {2U, 10U}) {
+        vector<T> haystack;
+        for (size_t i = 0; i < dataCount; ++i) {
+            haystack.push_back(static_cast<T>(gen() % alphabet)); // intentionally narrows
+        }
+
+        vector<T> needle;
+        for (size_t attempts = 0; attempts < 300; ++attempts) {
+            const size_t needle_size = attempts % 3 == 0 ? gen() % 8 : gen() % 80;
+            const size_t start       = gen() % (dataCount - needle_size);
+            needle.assign(haystack.begin() + static_cast<ptrdiff_t>(start),
+                haystack.begin() + static_cast<ptrdiff_t>(start + needle_size));
+            test_case_search(haystack, needle);
+
+            if (needle_size != 0) {
+                auto& changed = needle[gen() % needle_size];
+                changed       = static_cast<T>(changed ^ 1); // likely no longer matches
+                test_case_search(haystack, needle);
+            }
+        }
+
+        // a periodic haystack with a needle that differs only at its end
+        vector<T> periodic(dataCount, static_cast<T>(1));
+        periodic.back() = static_cast<T>(2);
+        needle.assign(100, static_cast<T>(1));
+        needle.back() = static_cast<T>(2);
+        test_case_search(periodic, needle);
+        needle.front() = static_cast<T>(2);
+        test_case_search(periodic, needle);
+    }
+}
+
+template <class CharT>
+void test_string_find(mt19937_64& gen) {
+    for (const unsigned int alphabet : {2U, 10U, 70000U}) {
+        basic_string<CharT> haystack;
+        for (size_t i = 0; i < dataCount; ++i) {
+            haystack.push_back(static_cast<CharT>(gen() % alphabet)); // intentionally narrows
+        }
+
+        for (size_t attempts = 0; attempts < 300; ++attempts) {
+            const size_t needle_size       = attempts % 3 == 0 ? gen() % 8 : gen() % 80;
+            basic_string<CharT> needle     = haystack.substr(gen() % (dataCount - needle_size), needle_size);
+            const size_t pos               = gen() % (dataCount + 2);
+            const auto last_known_good_pos = [&] {
+                if (pos > haystack.size()) {
+                    return basic_string<CharT>::npos;
+                }
+
+                const auto found =
+                    last_known_good_search(haystack.begin() + static_cast<ptrdiff_t>(pos), haystack.end(),
+                        needle.begin(), needle.end());
+                if (found == haystack.end() && !needle.empty()) {
+                    return basic_string<CharT>::npos;
+                }
+
+                return static_cast<size_t>(found - haystack.begin());
+            };
+
+            assert(haystack.find(needle, pos) == last_known_good_pos());
+#if _HAS_CXX17
+            assert(basic_string_view<CharT>{haystack}.find(needle, pos) == last_known_good_pos());
+#endif // _HAS_CXX17
+
+            if (needle_size != 0) {
+                auto& changed = needle[gen() % needle_size];
+                changed       = static_cast<CharT>(changed ^ 1); // likely no longer matches
+                assert(haystack.find(needle, pos) == last_known_good_pos());
+            }
+        }
+    }
+}
+
+template <class FwdIt, class T>
+inline FwdIt last_known_good_remove(FwdIt first, FwdIt last, T v) {
+    FwdIt dest = first;
+    for (; first != last; ++first) {
+        if (*first != v) {
+            *dest = *first;
+            ++dest;
+        }
+    }
+
+    return dest;
+}
+
+template <class FwdIt>
+inline FwdIt last_known_good_unique(FwdIt first, FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    FwdIt dest = first;
+    while (++first != last) {
+        if (*dest != *first) {
+            ++dest;
+            *dest = *first;
+        }
+    }
+
+    return ++dest;
+}
+
+template <class T>
+void test_case_remove_unique(const vector<T>& input, T v) {
+    vector<T> expected = input;
+    expected.erase(last_known_good_remove(expected.begin(), expected.end(), v), expected.end());
+
+    vector<T> actual = input;
+    actual.erase(remove(actual.begin(), actual.end(), v), actual.end());
+    assert(actual == expected);
+
+    actual.assign(input.size(), T{});
+    actual.erase(remove_copy(input.begin(), input.end(), actual.begin(), v), actual.end());
+    assert(actual == expected);
+
+    expected = input;
+    expected.erase(last_known_good_unique(expected.begin(), expected.end()), expected.end());
+    actual = input;
+    actual.erase(unique(actual.begin(), actual.end()), actual.end());
+    assert(actual == expected);
+
+#ifdef __cpp_lib_concepts
+    expected = input;
+    expected.erase(last_known_good_remove(expected.begin(), expected.end(), v), expected.end());
+    actual = input;
+    actual.erase(ranges::remove(actual, v).begin(), actual.end());
+    assert(actual == expected);
+
+    expected = input;
+    expected.erase(last_known_good_unique(expected.begin(), expected.end()), expected.end());
+    actual = input;
+    actual.erase(ranges::unique(actual).begin(), actual.end());
+    assert(actual == expected);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_remove_unique(mt19937_64& gen) {
+    // a narrow value range produces both runs of duplicates and many removed elements
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_remove_unique(input, static_cast<T>(1));
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(gen() % 3)); // intentionally narrows
+        test_case_remove_unique(input, static_cast<T>(gen() % 3)); // intentionally narrows
+    }
+}
+
+template <class T>
+bool all_equal_to(const vector<T>& v, const T& val) {
+    for (const auto& e : v) {
+        if (e != val) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class T>
+void test_fill(mt19937_64& gen) {
+    const auto val = static_cast<T>(gen() | 1); // intentionally narrows; never all bits zero
+    for (size_t count = 0; count < dataCount; ++count) {
+        const vector<T> constructed(count, val);
+        assert(constructed.size() == count && all_equal_to(constructed, val));
+
+        vector<T> actual(count + 2, T{});
+        fill(actual.begin() + 1, actual.end() - 1, val);
+        assert(actual.front() == T{} && actual.back() == T{});
+        assert(count == 0 || (actual[1] == val && actual[count] == val));
+
+        actual.assign(count, T{});
+        assert(fill_n(actual.begin(), count, val) == actual.end());
+        assert(all_equal_to(actual, val));
+
+#ifdef __cpp_lib_concepts
+        actual.assign(count, T{});
+        assert(ranges::fill(actual, val) == actual.end());
+        assert(all_equal_to(actual, val));
+
+        actual.assign(count, T{});
+        assert(ranges::fill_n(actual.begin(), static_cast<ptrdiff_t>(count), val) == actual.end());
+        assert(all_equal_to(actual, val));
+#endif // __cpp_lib_concepts
+    }
+}
+
+template <class FwdIt, class T>
+inline void last_known_good_replace(FwdIt first, FwdIt last, const T old_val, const T new_val) {
+    for (; first != last; ++first) {
+        if (*first == old_val) {
+            *first = new_val;
+        }
+    }
+}
+
+template <class T>
+void test_case_replace(const vector<T>& input, const T old_val, const T new_val) {
+    vector<T> expected = input;
+    last_known_good_replace(expected.begin(), expected.end(), old_val, new_val);
+
+    vector<T> actual = input;
+    replace(actual.begin(), actual.end(), old_val, new_val);
+    assert(actual == expected);
+
+#ifdef __cpp_lib_concepts
+    actual = input;
+    assert(ranges::replace(actual, old_val, new_val) == actual.end());
+    assert(actual == expected);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_replace(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_replace(input, static_cast<T>(1), static_cast<T>(2));
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(gen() % 3)); // intentionally narrows
+        test_case_replace(input, static_cast<T>(gen() % 3), static_cast<T>(gen())); // intentionally narrows
+    }
+}
+
 template <class BidIt>
 inline void last_known_good_reverse(BidIt first, BidIt last) {
     for (; first != last && first != --last; ++first) {
@@ -105,8 +696,270 @@ void test_swap_ranges(mt19937_64& gen) {
     }
 }
 
+template <class FwdIt, class T>
+inline FwdIt last_known_good_search_n(FwdIt first, const FwdIt last, const size_t count, const T v) {
+    size_t run = 0;
+    for (; first != last; ++first) {
+        if (*first != v) {
+            run = 0;
+        } else if (++run == count) {
+            return first - static_cast<ptrdiff_t>(count - 1);
+        }
+    }
+
+    return last;
+}
+
+template <class T>
+void test_case_search_n(const vector<T>& input, const size_t count, const T v) {
+    const auto expected = last_known_good_search_n(input.begin(), input.end(), count, v);
+    const auto actual   = search_n(input.begin(), input.end(), static_cast<ptrdiff_t>(count), v);
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    const auto actual_range = ranges::search_n(input, static_cast<ptrdiff_t>(count), v);
+    assert(expected == actual_range.begin());
+    assert(actual_range.size() == (expected == input.end() ? 0 : count));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_search_n(mt19937_64& gen) {
+    // mostly matching elements, so that runs of all lengths occur
+    const auto fn = [&]() { return static_cast<T>(gen() % 8 == 0); };
+    vector<T> input;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(fn());
+        for (const size_t count : {size_t{1}, size_t{2}, size_t{3}, size_t{5}, size_t{16}, size_t{33}, size_t{70}}) {
+            test_case_search_n(input, count, T{0});
+        }
+
+        test_case_search_n(input, static_cast<size_t>(gen() % (input.size() + 1)) + 1, T{0});
+    }
+}
+
+template <class T>
+T random_small_enough(mt19937_64& gen, const int headroom) {
+    // keeps sums and products of signed int and long long, which are not promoted, from overflowing
+    if constexpr (is_signed_v<T> && sizeof(T) >= sizeof(int)) {
+        return static_cast<T>(static_cast<T>(gen()) >> headroom); // intentionally narrows
+    } else {
+        return static_cast<T>(gen()); // intentionally narrows
+    }
+}
+
+template <class FwdIt, class T>
+inline T last_known_good_accumulate(FwdIt first, FwdIt last, T val) {
+    for (; first != last; ++first) {
+        val = static_cast<T>(val + *first);
+    }
+
+    return val;
+}
+
+template <class T>
+void test_accumulate(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts <= dataCount; ++attempts) {
+        const T init = random_small_enough<T>(gen, 12);
+        assert(accumulate(input.begin(), input.end(), init)
+               == last_known_good_accumulate(input.begin(), input.end(), init));
+        assert(
+            accumulate(input.begin(), input.end(), 0LL) == last_known_good_accumulate(input.begin(), input.end(), 0LL));
+        assert(accumulate(input.begin(), input.end(), 0ULL)
+               == last_known_good_accumulate(input.begin(), input.end(), 0ULL));
+        input.push_back(random_small_enough<T>(gen, 12));
+    }
+}
+
+template <class FwdIt1, class FwdIt2, class T>
+inline T last_known_good_inner_product(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, T val) {
+    for (; first1 != last1; ++first1, ++first2) {
+        val = static_cast<T>(val + *first1 * *first2);
+    }
+
+    return val;
+}
+
+template <class T>
+void test_inner_product(mt19937_64& gen) {
+    const int headroom = static_cast<int>(sizeof(T)) * 4 + 6;
+    vector<T> left;
+    vector<T> right;
+    left.reserve(dataCount);
+    right.reserve(dataCount);
+    for (size_t attempts = 0; attempts <= dataCount; ++attempts) {
+        const T init = random_small_enough<T>(gen, headroom);
+        assert(inner_product(left.begin(), left.end(), right.begin(), init)
+               == last_known_good_inner_product(left.begin(), left.end(), right.begin(), init));
+        assert(inner_product(left.begin(), left.end(), right.begin(), 0LL)
+               == last_known_good_inner_product(left.begin(), left.end(), right.begin(), 0LL));
+        left.push_back(random_small_enough<T>(gen, headroom));
+        right.push_back(random_small_enough<T>(gen, headroom));
+    }
+}
+
+template <class T>
+void test_iota(mt19937_64& gen) {
+    for (size_t count = 0; count <= dataCount; ++count) {
+        const T start = random_small_enough<T>(gen, 12);
+        vector<T> actual(count + 2, T{});
+        iota(actual.begin() + 1, actual.end() - 1, start);
+        assert(actual.front() == T{} && actual.back() == T{});
+        T expected = start;
+        for (size_t i = 1; i <= count; ++i, ++expected) {
+            assert(actual[i] == expected);
+        }
+    }
+}
+
+template <class FwdIt, class OutIt>
+inline OutIt last_known_good_adjacent_difference(FwdIt first, FwdIt last, OutIt dest) {
+    if (first != last) {
+        auto prev = *first;
+        *dest     = prev;
+        while (++first != last) {
+            const auto val = *first;
+            *++dest        = static_cast<decltype(prev)>(val - prev);
+            prev           = val;
+        }
+
+        ++dest;
+    }
+
+    return dest;
+}
+
+template <class T>
+void test_adjacent_difference(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts <= dataCount; ++attempts) {
+        vector<T> expected(input.size());
+        last_known_good_adjacent_difference(input.begin(), input.end(), expected.begin());
+
+        vector<T> actual(input.size());
+        assert(adjacent_difference(input.begin(), input.end(), actual.begin()) == actual.end());
+        assert(actual == expected);
+
+        // in place, as permitted by the standard
+        actual = input;
+        assert(adjacent_difference(actual.begin(), actual.end(), actual.begin()) == actual.end());
+        assert(actual == expected);
+
+        input.push_back(random_small_enough<T>(gen, 1));
+    }
+}
+
 void test_vector_algorithms() {
     mt19937_64 gen(1729);
+
+    test_count<char>(gen);
+    test_count<signed char>(gen);
+    test_count<unsigned char>(gen);
+    test_count<short>(gen);
+    test_count<unsigned short>(gen);
+    test_count<int>(gen);
+    test_count<unsigned int>(gen);
+    test_count<long long>(gen);
+    test_count<unsigned long long>(gen);
+
+    test_find<char>(gen);
+    test_find<signed char>(gen);
+    test_find<unsigned char>(gen);
+    test_find<short>(gen);
+    test_find<unsigned short>(gen);
+    test_find<int>(gen);
+    test_find<unsigned int>(gen);
+    test_find<long long>(gen);
+    test_find<unsigned long long>(gen);
+
+    test_find_count_value_conversions();
+
+    test_min_max_element<char>(gen);
+    test_min_max_element<signed char>(gen);
+    test_min_max_element<unsigned char>(gen);
+    test_min_max_element<short>(gen);
+    test_min_max_element<unsigned short>(gen);
+    test_min_max_element<int>(gen);
+    test_min_max_element<unsigned int>(gen);
+    test_min_max_element<long long>(gen);
+    test_min_max_element<unsigned long long>(gen);
+    test_min_max_element_floating<float>(gen);
+    test_min_max_element_floating<double>(gen);
+    test_min_max_element_floating<long double>(gen);
+
+    test_mismatch_lex_compare<char>(gen);
+    test_mismatch_lex_compare<signed char>(gen);
+    test_mismatch_lex_compare<unsigned char>(gen);
+    test_mismatch_lex_compare<short>(gen);
+    test_mismatch_lex_compare<unsigned short>(gen);
+    test_mismatch_lex_compare<int>(gen);
+    test_mismatch_lex_compare<unsigned int>(gen);
+    test_mismatch_lex_compare<long long>(gen);
+    test_mismatch_lex_compare<unsigned long long>(gen);
+    test_char_traits_compare();
+
+    test_find_of<char>(gen);
+    test_find_of<wchar_t>(gen);
+    test_find_of<char16_t>(gen);
+    test_find_of<char32_t>(gen);
+
+    test_search<char>(gen);
+    test_search<signed char>(gen);
+    test_search<unsigned char>(gen);
+    test_search<short>(gen);
+    test_search<unsigned short>(gen);
+    test_search<int>(gen);
+    test_search<unsigned int>(gen);
+    test_search<long long>(gen);
+    test_search<unsigned long long>(gen);
+
+    test_search_n<char>(gen);
+    test_search_n<signed char>(gen);
+    test_search_n<unsigned char>(gen);
+    test_search_n<short>(gen);
+    test_search_n<unsigned short>(gen);
+    test_search_n<int>(gen);
+    test_search_n<unsigned int>(gen);
+    test_search_n<long long>(gen);
+    test_search_n<unsigned long long>(gen);
+
+    test_string_find<char>(gen);
+    test_string_find<wchar_t>(gen);
+    test_string_find<char16_t>(gen);
+    test_string_find<char32_t>(gen);
+
+    test_remove_unique<char>(gen);
+    test_remove_unique<signed char>(gen);
+    test_remove_unique<unsigned char>(gen);
+    test_remove_unique<short>(gen);
+    test_remove_unique<unsigned short>(gen);
+    test_remove_unique<int>(gen);
+    test_remove_unique<unsigned int>(gen);
+    test_remove_unique<long long>(gen);
+    test_remove_unique<unsigned long long>(gen);
+
+    test_fill<short>(gen);
+    test_fill<unsigned short>(gen);
+    test_fill<int>(gen);
+    test_fill<unsigned int>(gen);
+    test_fill<long long>(gen);
+    test_fill<unsigned long long>(gen);
+    test_fill<float>(gen);
+    test_fill<double>(gen);
+
+    test_replace<char>(gen);
+    test_replace<signed char>(gen);
+    test_replace<unsigned char>(gen);
+    test_replace<short>(gen);
+    test_replace<unsigned short>(gen);
+    test_replace<int>(gen);
+    test_replace<unsigned int>(gen);
+    test_replace<long long>(gen);
+    test_replace<unsigned long long>(gen);
+
     test_reverse<char>(gen);
     test_reverse<signed char>(gen);
     test_reverse<unsigned char>(gen);
@@ -138,6 +991,41 @@ void test_vector_algorithms() {
     test_swap_ranges<int>(gen);
     test_swap_ranges<unsigned int>(gen);
     test_swap_ranges<unsigned long long>(gen);
+
+    test_accumulate<char>(gen);
+    test_accumulate<signed char>(gen);
+    test_accumulate<unsigned char>(gen);
+    test_accumulate<short>(gen);
+    test_accumulate<unsigned short>(gen);
+    test_accumulate<int>(gen);
+    test_accumulate<unsigned int>(gen);
+    test_accumulate<long long>(gen);
+    test_accumulate<unsigned long long>(gen);
+
+    test_inner_product<int>(gen);
+    test_inner_product<unsigned int>(gen);
+    test_inner_product<long long>(gen);
+    test_inner_product<unsigned long long>(gen);
+
+    test_iota<char>(gen);
+    test_iota<signed char>(gen);
+    test_iota<unsigned char>(gen);
+    test_iota<short>(gen);
+    test_iota<unsigned short>(gen);
+    test_iota<int>(gen);
+    test_iota<unsigned int>(gen);
+    test_iota<long long>(gen);
+    test_iota<unsigned long long>(gen);
+
+    test_adjacent_difference<char>(gen);
+    test_adjacent_difference<signed char>(gen);
+    test_adjacent_difference<unsigned char>(gen);
+    test_adjacent_difference<short>(gen);
+    test_adjacent_difference<unsigned short>(gen);
+    test_adjacent_difference<int>(gen);
+    test_adjacent_difference<unsigned int>(gen);
+    test_adjacent_difference<long long>(gen);
+    test_adjacent_difference<unsigned long long>(gen);
 }
 
 template <typename Container1, typename Container2>
@@ -183,6 +1071,8 @@ int main() {
     test_various_containers();
 #ifndef _M_CEE_PURE
 #if defined(_M_IX86) || defined(_M_X64)
+    disable_instructions(__ISA_AVAILABLE_AVX512);
+    test_vector_algorithms();
     disable_instructions(__ISA_AVAILABLE_AVX2);
     test_vector_algorithms();
     disable_instructions(__ISA_AVAILABLE_SSE42);
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+int moves     = 0;
+int destroyed = 0;
+
+// counts its moves and destructions, and opts in to relocation
+struct relocatable {
+    relocatable() = default;
+    explicit relocatable(int val) : ptr(make_unique<int>(val)) {}
+
+    relocatable(relocatable&& other) noexcept : ptr(move(other.ptr)) {
+        ++moves;
+    }
+
+    relocatable& operator=(relocatable&& other) noexcept {
+        ptr = move(other.ptr);
+        return *this;
+    }
+
+    ~relocatable() {
+        ++destroyed;
+    }
+
+    unique_ptr<int> ptr;
+};
+
+namespace stdext {
+    template <>
+    struct is_trivially_relocatable<relocatable> : true_type {};
+} // namespace stdext
+
+// points into itself, so it must be moved element by element
+struct self_referencing {
+    explicit self_referencing(int val) noexcept : value(val), self(&value) {}
+
+    self_referencing(const self_referencing& other) noexcept : value(other.value), self(&value) {
+        assert(other.self == &other.value);
+    }
+
+    self_referencing& operator=(const self_referencing& other) noexcept {
+        assert(other.self == &other.value);
+        value = other.value;
+        return *this;
+    }
+
+    ~self_referencing() {
+        assert(self == &value);
+    }
+
+    int value;
+    int* self;
+};
+
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<int>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<const int*>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<unique_ptr<int>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<unique_ptr<int[]>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<shared_ptr<int>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<weak_ptr<int>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<pair<const int, unique_ptr<int>>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<relocatable>);
+STATIC_ASSERT(!stdext::is_trivially_relocatable_v<self_referencing>);
+STATIC_ASSERT(!stdext::is_trivially_relocatable_v<pair<int, self_referencing>>);
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<string> == (_ITERATOR_DEBUG_LEVEL == 0));
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<pair<const string, int>> == (_ITERATOR_DEBUG_LEVEL == 0));
+STATIC_ASSERT(stdext::is_trivially_relocatable_v<vector<int>> == (_ITERATOR_DEBUG_LEVEL == 0));
+
+void test_relocation_skips_moves() {
+    // implementation assumption: reallocation neither moves nor destroys relocatable elements
+    vector<relocatable> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.emplace_back(i);
+    }
+
+    v.shrink_to_fit();
+    v.emplace(v.begin() + 10, -1);
+    v.reserve(v.capacity() + 1);
+    v.shrink_to_fit();
+    v.emplace_back(1000);
+    v.resize(v.capacity() + 1);
+    assert(moves == 0);
+    assert(destroyed == 0);
+
+    assert(*v[10].ptr == -1);
+    for (int i = 0; i <= 1000; ++i) {
+        assert(*v[static_cast<size_t>(i < 10 ? i : i + 1)].ptr == i);
+    }
+
+    assert(!v.back().ptr);
+    const auto size = v.size();
+    v.clear();
+    assert(destroyed == static_cast<int>(size));
+}
+
+void test_unique_ptr() {
+    vector<unique_ptr<int>> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(make_unique<int>(i));
+    }
+
+    v.insert(v.begin(), make_unique<int>(-1));
+    v.emplace(v.begin() + 500, make_unique<int>(-2));
+    v.resize(v.capacity() + 10);
+    assert(!v.back());
+    v.resize(1002);
+    v.shrink_to_fit();
+    assert(v.size() == 1002);
+
+    assert(*v[0] == -1);
+    assert(*v[500] == -2);
+    for (int i = 0; i < 1000; ++i) {
+        assert(*v[static_cast<size_t>(i < 499 ? i + 1 : i + 2)] == i);
+    }
+}
+
+void test_string() {
+    vector<string> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i % 2 == 0 ? to_string(i) : string(50, static_cast<char>('a' + i % 26))); // small and large
+    }
+
+    const vector<string> middle(5, "middle");
+    v.insert(v.begin() + 100, middle.begin(), middle.end());
+    v.insert(v.begin() + 200, v.capacity(), "fill");
+    v.reserve(v.capacity() * 2);
+
+    for (int i = 0; i < 100; ++i) {
+        assert(v[static_cast<size_t>(i)] == (i % 2 == 0 ? to_string(i) : string(50, static_cast<char>('a' + i % 26))));
+    }
+
+    assert(v[100] == "middle" && v[104] == "middle");
+    assert(v[200] == "fill");
+    assert(v.back() == string(50, static_cast<char>('a' + 999 % 26)));
+
+    for (auto& str : v) {
+        str += "!"; // the relocated strings refer to their own buffers
+    }
+
+    assert(v[0] == "0!");
+}
+
+void test_self_referencing() {
+    vector<self_referencing> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.emplace_back(i);
+    }
+
+    v.emplace(v.begin(), -1);
+    v.reserve(v.capacity() * 2);
+    v.resize(v.capacity() + 1, self_referencing{-2});
+    assert(v[0].value == -1);
+    assert(v[1000].value == 999);
+    assert(v.back().value == -2);
+}
+
+int main() {
+    test_relocation_skips_moves();
+    test_unique_ptr();
+    test_string();
+    test_self_referencing();
+}
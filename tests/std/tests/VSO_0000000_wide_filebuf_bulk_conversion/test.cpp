@@ -0,0 +1,217 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
+#include <algorithm>
+#include <assert.h>
+#include <codecvt>
+#include <cstddef>
+#include <cwchar>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <locale>
+#include <string>
+
+using namespace std;
+
+const char* const file_name = "wide_filebuf_bulk_conversion.dat";
+
+// converts ASCII only, counting how often it is called
+struct ascii_codecvt : codecvt<wchar_t, char, mbstate_t> {
+    mutable int out_calls = 0;
+    mutable int in_calls  = 0;
+
+protected:
+    result do_out(mbstate_t&, const wchar_t* first, const wchar_t* last, const wchar_t*& next, char* to,
+        char* to_last, char*& to_next) const override {
+        ++out_calls;
+        result res = ok;
+        for (; first != last && to != to_last; ++first, ++to) {
+            if (*first >= 0x80) {
+                res = error;
+                break;
+            }
+
+            *to = static_cast<char>(*first);
+        }
+
+        next    = first;
+        to_next = to;
+        return res;
+    }
+
+    result do_in(mbstate_t&, const char* first, const char* last, const char*& next, wchar_t* to, wchar_t* to_last,
+        wchar_t*& to_next) const override {
+        ++in_calls;
+        result res = ok;
+        for (; first != last && to != to_last; ++first, ++to) {
+            if (static_cast<unsigned char>(*first) >= 0x80) {
+                res = error;
+                break;
+            }
+
+            *to = static_cast<wchar_t>(*first);
+        }
+
+        next    = first;
+        to_next = to;
+        return res;
+    }
+
+    result do_unshift(mbstate_t&, char* to, char*, char*& to_next) const override {
+        to_next = to;
+        return noconv;
+    }
+
+    bool do_always_noconv() const noexcept override {
+        return false;
+    }
+
+    int do_encoding() const noexcept override {
+        return 1;
+    }
+
+    int do_max_length() const noexcept override {
+        return 1;
+    }
+};
+
+// claims to convert nothing, so the file stream puts and gets elements as is
+struct noconv_codecvt : codecvt<wchar_t, char, mbstate_t> {
+protected:
+    bool do_always_noconv() const noexcept override {
+        return true;
+    }
+};
+
+string read_bytes() {
+    ifstream is(file_name, ios::binary);
+    return string(istreambuf_iterator<char>(is), istreambuf_iterator<char>());
+}
+
+wstring read_wide(const locale& loc, const size_t max_size, const ios::openmode mode = ios::binary) {
+    wifstream is;
+    is.imbue(loc);
+    is.open(file_name, ios::in | mode);
+    wstring result(max_size, L'\0');
+    is.read(&result[0], static_cast<streamsize>(max_size));
+    result.resize(static_cast<size_t>(is.gcount()));
+    return result;
+}
+
+void test_converts_in_bulk() {
+    const auto cvt = new ascii_codecvt;
+    const locale loc(locale::classic(), cvt);
+
+    wstring text;
+    string expected;
+    for (int i = 0; i < 100'000; ++i) {
+        const char ch = static_cast<char>('!' + i % 90);
+        text.push_back(static_cast<wchar_t>(ch));
+        expected.push_back(ch);
+    }
+
+    {
+        wofstream os;
+        os.imbue(loc);
+        os.open(file_name, ios::binary);
+        os.write(text.data(), static_cast<streamsize>(text.size()));
+        assert(os.good());
+    }
+
+    assert(cvt->out_calls < 1'000);
+    assert(read_bytes() == expected);
+
+    assert(read_wide(loc, text.size() + 10) == text);
+    assert(cvt->in_calls < 1'000);
+
+    // a putback element is gotten before the rest of the file
+    wifstream is;
+    is.imbue(loc);
+    is.open(file_name, ios::binary);
+    wchar_t first[3];
+    is.read(first, 3);
+    assert(is.putback(first[2]));
+    wstring rest(text.size(), L'\0');
+    is.read(&rest[0], static_cast<streamsize>(rest.size()));
+    assert(static_cast<size_t>(is.gcount()) == text.size() - 2);
+    assert(rest.compare(0, text.size() - 2, text, 2, text.size() - 2) == 0);
+}
+
+void test_conversion_errors() {
+    const locale loc(locale::classic(), new ascii_codecvt);
+    {
+        wofstream os;
+        os.imbue(loc);
+        os.open(file_name, ios::binary);
+        const wchar_t text[] = L"abc\u00E9def";
+        os.write(text, 7);
+        assert(os.bad());
+    }
+
+    // what was converted before the error is written
+    assert(read_bytes() == "abc");
+
+    {
+        ofstream os(file_name, ios::binary);
+        os << "abc\xE9" << "def";
+    }
+
+    assert(read_wide(loc, 10) == L"abc");
+}
+
+void test_utf8_round_trip() {
+    const locale loc(locale::classic(), new codecvt_utf8_utf16<wchar_t>);
+    const wstring unit   = L"a\u00E9\u4E2D\xD83D\xDE00z";
+    const string encoded = "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80z";
+
+    wstring text;
+    string expected;
+    for (int i = 0; i < 20'000; ++i) {
+        text += unit;
+        expected += encoded;
+    }
+
+    {
+        wofstream os;
+        os.imbue(loc);
+        os.open(file_name, ios::binary);
+        // pieces of odd sizes split surrogate pairs
+        for (size_t pos = 0; pos < text.size(); pos += 7) {
+            os.write(text.data() + pos, static_cast<streamsize>((min)(size_t{7}, text.size() - pos)));
+        }
+
+        os << L'!';
+        assert(os.good());
+    }
+
+    assert(read_bytes() == expected + "!");
+
+    // elements straddle the end of the C stream's buffer
+    assert(read_wide(loc, text.size() + 10) == text + L"!");
+}
+
+void test_no_conversion() {
+    const locale loc(locale::classic(), new noconv_codecvt);
+    const wstring text(10'000, L'x');
+    {
+        wofstream os;
+        os.imbue(loc);
+        os.open(file_name);
+        os.write(text.data(), static_cast<streamsize>(text.size()));
+        assert(os.good());
+    }
+
+    // elements are put and gotten as with fputwc and fgetwc, which convert them in text mode
+    assert(read_bytes() == string(text.size(), 'x'));
+    assert(read_wide(loc, text.size() + 10, ios::in) == text);
+}
+
+int main() {
+    test_converts_in_bulk();
+    test_conversion_errors();
+    test_utf8_round_trip();
+    test_no_conversion();
+}
@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+constexpr int draws = 1'000'000;
+
+// the edges of the base layers, beyond which the tails are sampled separately
+constexpr double normal_tail      = 3.6541528853610088;
+constexpr double exponential_tail = 7.69711747013104972;
+
+double normal_cdf(const double x) {
+    return 0.5 * erfc(-x / sqrt(2.0));
+}
+
+double exponential_cdf(const double x) {
+    return x <= 0 ? 0 : 1 - exp(-x);
+}
+
+// compare the fraction of the results below each edge with the CDF, within about 5 standard deviations
+template <class Cdf>
+void check_fractions(const vector<double>& results, Cdf cdf, const vector<double>& edges) {
+    for (const double edge : edges) {
+        size_t below = 0;
+        for (const double x : results) {
+            below += x < edge;
+        }
+
+        const double expected = cdf(edge);
+        const double fraction = static_cast<double>(below) / static_cast<double>(results.size());
+        assert(fabs(fraction - expected) < 5 * sqrt(expected * (1 - expected) / static_cast<double>(results.size())));
+    }
+}
+
+template <class Real, class Engine>
+void test_normal() {
+    Engine eng;
+    stdext::ziggurat_normal_distribution<Real> dist(3, 2);
+    vector<double> standardized;
+    standardized.reserve(draws);
+    double sum         = 0;
+    double sum_squares = 0;
+    for (int i = 0; i < draws; ++i) {
+        const Real val = dist(eng);
+        assert(isfinite(val));
+        const double z = (static_cast<double>(val) - 3) / 2;
+        standardized.push_back(z);
+        sum += z;
+        sum_squares += z * z;
+    }
+
+    const double mean = sum / draws;
+    assert(fabs(mean) < 0.005);
+    assert(fabs(sum_squares / draws - mean * mean - 1) < 0.01);
+    check_fractions(standardized, normal_cdf,
+        {-normal_tail, -3, -2, -1.5, -1, -0.5, -0.1, 0, 0.1, 0.5, 1, 1.5, 2, 3, normal_tail});
+}
+
+template <class Real, class Engine>
+void test_exponential() {
+    Engine eng;
+    stdext::ziggurat_exponential_distribution<Real> dist(4);
+    vector<double> scaled;
+    scaled.reserve(draws);
+    double sum = 0;
+    for (int i = 0; i < draws; ++i) {
+        const Real val = dist(eng);
+        assert(isfinite(val) && val >= 0);
+        const double x = static_cast<double>(val) * 4;
+        scaled.push_back(x);
+        sum += x;
+    }
+
+    assert(fabs(sum / draws - 1) < 0.005);
+    check_fractions(scaled, exponential_cdf, {0.01, 0.1, 0.5, 1, 2, 3, 5, exponential_tail - 1, exponential_tail});
+}
+
+void test_tails() {
+    // the tails are drawn on about 1 in 4000 and 1 in 2000 of the results; check that both sides of the normal tail
+    // and the exponential tail have the right weight beyond the edge
+    mt19937_64 eng(1729);
+    stdext::ziggurat_normal_distribution<> normal;
+    stdext::ziggurat_exponential_distribution<> exponential;
+    const int tail_draws = 4'000'000;
+    int low              = 0;
+    int high             = 0;
+    int beyond           = 0;
+    int far_beyond       = 0;
+    for (int i = 0; i < tail_draws; ++i) {
+        const double z = normal(eng);
+        low += z < -normal_tail;
+        high += z > normal_tail;
+        const double x = exponential(eng);
+        beyond += x > exponential_tail;
+        far_beyond += x > exponential_tail + 1;
+    }
+
+    const double normal_expected = tail_draws * normal_cdf(-normal_tail); // about 516
+    assert(fabs(low - normal_expected) < 5 * sqrt(normal_expected));
+    assert(fabs(high - normal_expected) < 5 * sqrt(normal_expected));
+    const double exponential_expected = tail_draws * exp(-exponential_tail); // about 1817
+    assert(fabs(beyond - exponential_expected) < 5 * sqrt(exponential_expected));
+    assert(fabs(far_beyond - exponential_expected / exp(1.0)) < 5 * sqrt(exponential_expected / exp(1.0)));
+}
+
+void test_interface() {
+    using normal_dist = stdext::ziggurat_normal_distribution<>;
+    static_assert(is_same_v<normal_dist::result_type, double>, "");
+    static_assert(is_same_v<normal_dist::param_type::distribution_type, normal_dist>, "");
+
+    normal_dist dist(1.5, 0.25);
+    assert(dist.mean() == 1.5 && dist.stddev() == 0.25);
+    assert(dist.param() == normal_dist::param_type(1.5, 0.25));
+    assert(dist != normal_dist{});
+    assert((dist.min)() == -numeric_limits<double>::infinity());
+    assert((dist.max)() == numeric_limits<double>::infinity());
+
+    // parameters convert from those of normal_distribution
+    const normal_dist::param_type converted = normal_distribution<>::param_type(-1, 3);
+    dist.param(converted);
+    assert(dist.mean() == -1 && dist.stddev() == 3);
+
+    stringstream ss;
+    ss << dist;
+    normal_dist read_back;
+    ss >> read_back;
+    assert(read_back == dist);
+
+    // the results depend only on the engine; reset() and the parameters carry no state to the next result
+    mt19937 eng1(42);
+    mt19937 eng2(42);
+    normal_dist standard;
+    for (int i = 0; i < 1000; ++i) {
+        const double val = standard(eng1);
+        assert(dist(eng2, normal_dist::param_type{}) == val);
+        dist.reset();
+    }
+
+    using exponential_dist = stdext::ziggurat_exponential_distribution<float>;
+    static_assert(is_same_v<exponential_dist::result_type, float>, "");
+    exponential_dist exponential(0.5f);
+    assert(exponential.lambda() == 0.5f);
+    assert(exponential.param() == exponential_dist::param_type(0.5f));
+    assert(exponential != exponential_dist{});
+    assert((exponential.min)() == 0);
+    assert((exponential.max)() == numeric_limits<float>::infinity());
+
+    ss.str("");
+    ss.clear();
+    ss << exponential;
+    exponential_dist exponential_read_back;
+    ss >> exponential_read_back;
+    assert(exponential_read_back == exponential);
+
+    vector<float> values(1000);
+    stdext::generate_random(values.begin(), values.end(), eng1, exponential);
+    for (const float val : values) {
+        assert(val >= 0);
+    }
+}
+
+int main() {
+    // mt19937_64 supplies 64 bits per draw, mt19937 two draws, and minstd_rand the generic path
+    test_normal<double, mt19937_64>();
+    test_normal<float, mt19937>();
+    test_normal<long double, minstd_rand>();
+    test_exponential<double, mt19937_64>();
+    test_exponential<float, minstd_rand>();
+    test_exponential<long double, mt19937>();
+    test_tails();
+    test_interface();
+}
@@ -17,6 +17,20 @@ int main() {} // COMPILE-ONLY
 STATIC_ASSERT(__cpp_lib_addressof_constexpr == 201603L);
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_allocate_at_least
+#error __cpp_lib_allocate_at_least is not defined
+#elif __cpp_lib_allocate_at_least != 202106L
+#error __cpp_lib_allocate_at_least is not 202106L
+#else
+STATIC_ASSERT(__cpp_lib_allocate_at_least == 202106L);
+#endif
+#else
+#ifdef __cpp_lib_allocate_at_least
+#error __cpp_lib_allocate_at_least is defined
+#endif
+#endif
+
 #ifndef __cpp_lib_allocator_traits_is_always_equal
 #error __cpp_lib_allocator_traits_is_always_equal is not defined
 #elif __cpp_lib_allocator_traits_is_always_equal != 201411L
@@ -661,6 +675,20 @@ STATIC_ASSERT(__cpp_lib_filesystem == 201703L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_lib_concepts)
+#ifndef __cpp_lib_format
+#error __cpp_lib_format is not defined
+#elif __cpp_lib_format != 202106L
+#error __cpp_lib_format is not 202106L
+#else
+STATIC_ASSERT(__cpp_lib_format == 202106L);
+#endif
+#else
+#ifdef __cpp_lib_format
+#error __cpp_lib_format is defined
+#endif
+#endif
+
 #if _HAS_CXX17
 #ifndef __cpp_lib_gcd_lcm
 #error __cpp_lib_gcd_lcm is not defined
@@ -1187,6 +1215,62 @@ STATIC_ASSERT(__cpp_lib_raw_memory_algorithms == 201606L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_lib_concepts)
+#ifndef __cpp_lib_ranges_chunk
+#error __cpp_lib_ranges_chunk is not defined
+#elif __cpp_lib_ranges_chunk != 202202L
+#error __cpp_lib_ranges_chunk is not 202202L
+#else
+STATIC_ASSERT(__cpp_lib_ranges_chunk == 202202L);
+#endif
+#else
+#ifdef __cpp_lib_ranges_chunk
+#error __cpp_lib_ranges_chunk is defined
+#endif
+#endif
+
+#if _HAS_CXX20 && defined(__cpp_lib_concepts)
+#ifndef __cpp_lib_ranges_slide
+#error __cpp_lib_ranges_slide is not defined
+#elif __cpp_lib_ranges_slide != 202202L
+#error __cpp_lib_ranges_slide is not 202202L
+#else
+STATIC_ASSERT(__cpp_lib_ranges_slide == 202202L);
+#endif
+#else
+#ifdef __cpp_lib_ranges_slide
+#error __cpp_lib_ranges_slide is defined
+#endif
+#endif
+
+#if _HAS_CXX20 && defined(__cpp_lib_concepts)
+#ifndef __cpp_lib_ranges_stride
+#error __cpp_lib_ranges_stride is not defined
+#elif __cpp_lib_ranges_stride != 202207L
+#error __cpp_lib_ranges_stride is not 202207L
+#else
+STATIC_ASSERT(__cpp_lib_ranges_stride == 202207L);
+#endif
+#else
+#ifdef __cpp_lib_ranges_stride
+#error __cpp_lib_ranges_stride is defined
+#endif
+#endif
+
+#if _HAS_CXX20 && defined(__cpp_lib_concepts)
+#ifndef __cpp_lib_ranges_to_container
+#error __cpp_lib_ranges_to_container is not defined
+#elif __cpp_lib_ranges_to_container != 202202L
+#error __cpp_lib_ranges_to_container is not 202202L
+#else
+STATIC_ASSERT(__cpp_lib_ranges_to_container == 202202L);
+#endif
+#else
+#ifdef __cpp_lib_ranges_to_container
+#error __cpp_lib_ranges_to_container is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_remove_cvref
 #error __cpp_lib_remove_cvref is not defined